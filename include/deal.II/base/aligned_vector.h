@@ -137,6 +137,12 @@ public:
    * function omits constructor/destructor calls and in particular the
    * initialization of new elements.
    *
+   * Even though the new elements are not initialized in this case, the
+   * underlying memory pages of large allocations are touched from multiple
+   * threads so that a first-touch NUMA page placement policy distributes
+   * the pages across the memory domains of the machine, in the same way as
+   * the multithreaded initialization in resize() does.
+   *
    * @note This method can only be invoked for classes @p T that define a
    * default constructor, @p T(). Otherwise, compilation will fail.
    */
@@ -1067,6 +1073,66 @@ namespace internal
     }
   };
 
+
+
+  /**
+   * Given a range of freshly allocated memory, touch one element per memory
+   * page from multiple threads without initializing the data. On NUMA
+   * systems with a first-touch page placement policy, this distributes the
+   * pages of large allocations across the memory domains of the threads
+   * instead of committing all of them to the domain of the allocating
+   * thread, mirroring the distribution that the multithreaded
+   * initialization in AlignedVectorInitialize produces.
+   *
+   * This class may only be used for trivial types, for which writing to
+   * uninitialized memory is allowed (the content of the touched elements is
+   * indeterminate before and after the operation).
+   *
+   * @relatesalso AlignedVector
+   */
+  template <typename T>
+  class AlignedVectorFirstTouch : private dealii::parallel::ParallelForInteger
+  {
+    static const std::size_t minimum_parallel_grain_size =
+      160000 / sizeof(T) + 1;
+
+  public:
+    /**
+     * Constructor. Issues a parallel page touch if there are sufficiently
+     * many elements, otherwise does nothing (a short range is committed to
+     * a single memory domain anyway).
+     */
+    AlignedVectorFirstTouch(const std::size_t size, T *const destination)
+      : destination_(destination)
+    {
+      static_assert(std::is_trivial_v<T>,
+                    "First-touch without initialization is only allowed "
+                    "for trivial types.");
+      if (size < minimum_parallel_grain_size)
+        return;
+      Assert(destination != nullptr, ExcInternalError());
+
+      apply_parallel(0, size, minimum_parallel_grain_size);
+    }
+
+    /**
+     * Touch one byte per page on a subrange given by two integers.
+     */
+    virtual void
+    apply_to_subrange(const std::size_t begin,
+                      const std::size_t end) const override
+    {
+      constexpr std::size_t page_size = 4096;
+      constexpr std::size_t stride =
+        (page_size + sizeof(T) - 1) / sizeof(T);
+      for (std::size_t i = begin; i < end; i += stride)
+        std::memset(static_cast<void *>(destination_ + i), 0, 1);
+    }
+
+  private:
+    mutable T *destination_;
+  };
+
 } // end of namespace internal
 
 
@@ -1320,9 +1386,16 @@ AlignedVector<T>::resize_fast(const size_type new_size)
 
       // need to still set the values in case the class is non-trivial because
       // virtual classes etc. need to run their (default) constructor
-      if (std::is_trivial_v<T> == false)
+      if constexpr (std::is_trivial_v<T> == false)
         dealii::internal::AlignedVectorDefaultInitialize<T, true>(
           new_size - old_size, elements.get() + old_size);
+      else
+        // for trivial classes, the new elements remain uninitialized, but we
+        // still touch the underlying memory pages from multiple threads so
+        // that a first-touch NUMA policy distributes large allocations
+        // across the memory domains in the same way as resize() does
+        dealii::internal::AlignedVectorFirstTouch<T>(new_size - old_size,
+                                                    elements.get() + old_size);
     }
 }
 
@@ -1080,8 +1080,21 @@ namespace DataOutBase
      */
     DataOutBase::CompressionLevel compression_level;
 
+    /**
+     * Number of consecutive MPI ranks whose data is aggregated onto a single
+     * writer rank before the HDF5 file is accessed. With the default value 1,
+     * every rank participates in the collective file accesses, which can
+     * suffer from metadata contention on parallel file systems when running
+     * with very large numbers of ranks. For larger values, the data of each
+     * group of that many ranks is gathered on the first rank of the group,
+     * and only these writer ranks open the file and perform the collective
+     * dataset writes. The resulting file is identical in all cases.
+     */
+    unsigned int n_ranks_per_writer;
+
     explicit Hdf5Flags(
-      const CompressionLevel compression_level = CompressionLevel::best_speed);
+      const CompressionLevel compression_level = CompressionLevel::best_speed,
+      const unsigned int     n_ranks_per_writer = 1);
   };
 
   /**
@@ -2414,6 +2427,31 @@ namespace DataOutBase
                       const std::string &solution_filename,
                       const MPI_Comm     comm);
 
+  /**
+   * Same as the function above, but with an additional @p solution_group
+   * argument for writing time series into a single solution file. If
+   * @p solution_group is not empty, the solution file is opened in
+   * read-write mode &mdash; it is only created if it does not exist yet
+   * &mdash; and the solution data sets are placed in a newly created HDF5
+   * group of that name instead of the root of the file. Appending the
+   * records of one more time step this way is an O(1) file system
+   * operation independent of the number of steps already stored, which
+   * avoids the per-step file creation cost of writing one file per step.
+   * The geometry is shared by all steps and written only once, to
+   * @p mesh_filename. See DataOutInterface::write_hdf5_parallel() for an
+   * example of usage.
+   */
+  template <int dim, int spacedim>
+  void
+  write_hdf5_parallel(const std::vector<Patch<dim, spacedim>> &patches,
+                      const DataOutFilter                     &data_filter,
+                      const DataOutBase::Hdf5Flags            &flags,
+                      const bool                               write_mesh_file,
+                      const std::string                       &mesh_filename,
+                      const std::string &solution_filename,
+                      const std::string &solution_group,
+                      const MPI_Comm     comm);
+
   /**
    * DataOutFilter is an intermediate data format that reduces the amount of
    * data that will be written to files. The object filled by this function
@@ -2908,6 +2946,21 @@ public:
                     const double                      cur_time,
                     const MPI_Comm                    comm) const;
 
+  /**
+   * Create an XDMFEntry based on the data in the data_filter. This assumes
+   * the mesh was written to its own file and the solution data sets of this
+   * time step were written to the HDF5 group @p h5_solution_group within
+   * @p h5_solution_filename, as done by the write_hdf5_parallel() overload
+   * taking a group name. See that function for an example of usage.
+   */
+  XDMFEntry
+  create_xdmf_entry(const DataOutBase::DataOutFilter &data_filter,
+                    const std::string                &h5_mesh_filename,
+                    const std::string                &h5_solution_filename,
+                    const std::string                &h5_solution_group,
+                    const double                      cur_time,
+                    const MPI_Comm                    comm) const;
+
   /**
    * Write an XDMF file based on the provided vector of XDMFEntry objects.
    * Below is an example of how to use this function with HDF5 and the
@@ -2970,6 +3023,40 @@ public:
                       const std::string                &solution_filename,
                       const MPI_Comm                    comm) const;
 
+  /**
+   * Write the data in @p data_filter to the HDF5 group @p solution_group of
+   * the file @p solution_filename, creating the file if it does not exist
+   * yet and appending to it otherwise. Together with a mesh file written
+   * once, this allows consolidating the output of a whole time series into
+   * two files, rather than creating one file per time step whose file
+   * system metadata cost can dominate for runs with many steps:
+   *
+   * @code
+   * DataOutBase::DataOutFilter data_filter(
+   *   DataOutBase::DataOutFilterFlags(true, true));
+   * data_out.write_filtered_data(data_filter);
+   * const std::string group = "step_" + Utilities::int_to_string(step, 6);
+   * // Write the mesh file in the first step only, the solution data of
+   * // every step into its own group of the common solution file
+   * data_out.write_hdf5_parallel(data_filter,
+   *                              step == 0,
+   *                              "mesh.h5",
+   *                              "solution.h5",
+   *                              group,
+   *                              MPI_COMM_WORLD);
+   * xdmf_entries.push_back(data_out.create_xdmf_entry(
+   *   data_filter, "mesh.h5", "solution.h5", group, time, MPI_COMM_WORLD));
+   * data_out.write_xdmf_file(xdmf_entries, "solution.xdmf", MPI_COMM_WORLD);
+   * @endcode
+   */
+  void
+  write_hdf5_parallel(const DataOutBase::DataOutFilter &data_filter,
+                      const bool                        write_mesh_file,
+                      const std::string                &mesh_filename,
+                      const std::string                &solution_filename,
+                      const std::string                &solution_group,
+                      const MPI_Comm                    comm) const;
+
   /**
    * DataOutFilter is an intermediate data format that reduces the amount of
    * data that will be written to files. The object filled by this function
@@ -3469,6 +3556,16 @@ public:
   void
   add_attribute(const std::string &attr_name, const unsigned int dimension);
 
+  /**
+   * Set the name of the HDF5 group within the solution file that contains
+   * the data sets of this entry. If this function is not called, the data
+   * sets are assumed to live at the root of the solution file. See
+   * DataOutInterface::write_hdf5_parallel() for how to write time series
+   * output with one group per step.
+   */
+  void
+  set_solution_group(const std::string &group_name);
+
   /**
    * Read or write the data of this object for serialization using the
    * [BOOST serialization
@@ -3478,8 +3575,9 @@ public:
   void
   serialize(Archive &ar, const unsigned int /*version*/)
   {
-    ar &valid &h5_sol_filename &h5_mesh_filename &entry_time &num_nodes
-      &num_cells &dimension &space_dimension &cell_type &attribute_dims;
+    ar &valid &h5_sol_filename &h5_sol_group &h5_mesh_filename &entry_time
+      &num_nodes &num_cells &dimension &space_dimension &cell_type
+        &attribute_dims;
   }
 
   /**
@@ -3511,6 +3609,13 @@ private:
    */
   std::string h5_sol_filename;
 
+  /**
+   * The name of the HDF5 group within the solution file that contains the
+   * data sets of this entry; an empty string refers to the root of the
+   * file.
+   */
+  std::string h5_sol_group;
+
   /**
    * The name of the HDF5 mesh file this entry references.
    */
@@ -1654,6 +1654,115 @@ namespace deal_II_exceptions
 
 
 
+#ifndef DEAL_II_ASSERT_SAMPLING_INTERVAL
+/**
+ * The number of invocations of a given AssertSampled() call site between two
+ * evaluations of its condition. The default of 256 keeps the overhead of
+ * sampled assertions in release mode to a thread-local counter increment on
+ * most invocations. The value can be overridden by defining the macro before
+ * including any deal.II header.
+ *
+ * @ingroup Exceptions
+ */
+#  define DEAL_II_ASSERT_SAMPLING_INTERVAL 256
+#endif
+
+/**
+ * A variant of the <tt>Assert</tt> macro above for checks on hot paths that
+ * are too expensive to perform on every invocation in optimized builds, but
+ * valuable enough that one does not want to lose them entirely outside of
+ * debug mode.
+ *
+ * In debug mode, this macro is identical to <tt>Assert</tt> and checks its
+ * condition on every invocation. In release mode, it is by default compiled
+ * out like <tt>Assert</tt>; however, if the macro
+ * <tt>DEAL_II_SAMPLED_ASSERTIONS</tt> is defined (typically via
+ * <tt>-DDEAL_II_SAMPLED_ASSERTIONS</tt> on the compiler command line of the
+ * user code), the condition is evaluated on every
+ * DEAL_II_ASSERT_SAMPLING_INTERVAL-th invocation of the call site, counted
+ * per thread. For checks inside loops whose iterations fail in batches —
+ * out-of-range indices of a contiguous index array, for example — sampling
+ * catches the error with high probability at a small fraction of the cost of
+ * checking every element, which makes this mode suitable for triaging
+ * problems that only appear in production-size runs.
+ *
+ * Since the condition is not evaluated on most invocations, it must not have
+ * side effects.
+ *
+ * @note This and similar macro names are examples of preprocessor definitions
+ * in the deal.II library that are not prefixed by a string that likely makes
+ * them unique to deal.II. As a consequence, it is possible that other
+ * libraries your code interfaces with define the same name, and the result
+ * will be name collisions (see
+ * https://en.wikipedia.org/wiki/Name_collision). One can <code>\#undef</code>
+ * this macro, as well as all other macros defined by deal.II that are not
+ * prefixed with either <code>DEAL</code> or <code>deal</code>, by including
+ * the header <code>deal.II/base/undefine_macros.h</code> after all other
+ * deal.II headers have been included.
+ *
+ * @ingroup Exceptions
+ */
+#ifdef DEBUG
+#  define AssertSampled(cond, exc) Assert(cond, exc)
+#elif defined(DEAL_II_SAMPLED_ASSERTIONS)
+#  ifdef DEAL_II_HAVE_BUILTIN_EXPECT
+#    define AssertSampled(cond, exc)                                       \
+      do                                                                   \
+        {                                                                  \
+          static thread_local unsigned int deal_ii_sample_counter = 0;     \
+          if (__builtin_expect(++deal_ii_sample_counter >=                 \
+                                 DEAL_II_ASSERT_SAMPLING_INTERVAL,         \
+                               false))                                     \
+            {                                                              \
+              deal_ii_sample_counter = 0;                                  \
+              if (!(cond))                                                 \
+                ::dealii::deal_II_exceptions::internals::                  \
+                  issue_error_noreturn(                                    \
+                    ::dealii::deal_II_exceptions::internals::              \
+                      ExceptionHandling::abort_or_throw_on_exception,      \
+                    __FILE__,                                              \
+                    __LINE__,                                              \
+                    __PRETTY_FUNCTION__,                                   \
+                    #cond,                                                 \
+                    #exc,                                                  \
+                    exc);                                                  \
+            }                                                              \
+        }                                                                  \
+      while (false)
+#  else /*ifdef DEAL_II_HAVE_BUILTIN_EXPECT*/
+#    define AssertSampled(cond, exc)                                       \
+      do                                                                   \
+        {                                                                  \
+          static thread_local unsigned int deal_ii_sample_counter = 0;     \
+          if (++deal_ii_sample_counter >=                                  \
+              DEAL_II_ASSERT_SAMPLING_INTERVAL)                            \
+            {                                                              \
+              deal_ii_sample_counter = 0;                                  \
+              if (!(cond))                                                 \
+                ::dealii::deal_II_exceptions::internals::                  \
+                  issue_error_noreturn(                                    \
+                    ::dealii::deal_II_exceptions::internals::              \
+                      ExceptionHandling::abort_or_throw_on_exception,      \
+                    __FILE__,                                              \
+                    __LINE__,                                              \
+                    __PRETTY_FUNCTION__,                                   \
+                    #cond,                                                 \
+                    #exc,                                                  \
+                    exc);                                                  \
+            }                                                              \
+        }                                                                  \
+      while (false)
+#  endif /*ifdef DEAL_II_HAVE_BUILTIN_EXPECT*/
+#else
+#  define AssertSampled(cond, exc) \
+    do                             \
+      {                            \
+      }                            \
+    while (false)
+#endif
+
+
+
 /**
  * A variant of the <tt>Assert</tt> macro above that exhibits the same runtime
  * behavior as long as disable_abort_on_exception was not called.
@@ -2058,6 +2167,35 @@ namespace internal
                                                                    0,        \
                                                                    (range)))
 
+/**
+ * A variant of AssertIndexRange that uses AssertSampled instead of Assert,
+ * i.e., in release mode with <tt>DEAL_II_SAMPLED_ASSERTIONS</tt> defined the
+ * index is checked on every DEAL_II_ASSERT_SAMPLING_INTERVAL-th invocation of
+ * the call site only. It is intended for index accesses in hot inner loops
+ * where checking every access is too expensive outside of debug mode.
+ *
+ * @note This and similar macro names are examples of preprocessor definitions
+ * in the deal.II library that are not prefixed by a string that likely makes
+ * them unique to deal.II. As a consequence, it is possible that other
+ * libraries your code interfaces with define the same name, and the result
+ * will be name collisions (see
+ * https://en.wikipedia.org/wiki/Name_collision). One can <code>\#undef</code>
+ * this macro, as well as all other macros defined by deal.II that are not
+ * prefixed with either <code>DEAL</code> or <code>deal</code>, by including
+ * the header <code>deal.II/base/undefine_macros.h</code> after all other
+ * deal.II headers have been included.
+ *
+ * @ingroup Exceptions
+ */
+#define AssertIndexRangeSampled(index, range)                                \
+  AssertSampled(                                                             \
+    ::dealii::deal_II_exceptions::internals::compare_less_than(index,        \
+                                                               range),       \
+    dealii::ExcIndexRangeType<::dealii::internal::argument_type_t<void(      \
+      std::common_type_t<decltype(index), decltype(range)>)>>((index),       \
+                                                              0,             \
+                                                              (range)))
+
 /**
  * An assertion that checks whether a number is finite or not. We explicitly
  * cast the number to std::complex to match the signature of the exception
@@ -102,6 +102,15 @@ class TensorFunction;
  * returning a whole array), since the cost of evaluation of a point value is
  * often less than the virtual function call itself.
  *
+ * The functions returning several values at a time are also the batch
+ * interface through which the library itself evaluates objects of this
+ * class: functions such as VectorTools::interpolate(),
+ * VectorTools::integrate_difference(), and the MatrixCreator functions call
+ * value_list() and vector_value_list() with all quadrature or support points
+ * of a cell at once. Overloading these list functions with an implementation
+ * that evaluates all points in one sweep (for example using vectorized
+ * loops) therefore speeds up all of these consumers at the same time.
+ *
  * Support for time dependent functions can be found in the base class
  * FunctionTime.
  *
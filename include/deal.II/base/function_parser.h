@@ -343,6 +343,17 @@ public:
   virtual double
   value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+  /**
+   * Return the value of the function at multiple points. This is equivalent
+   * to calling value() for each point, but substantially faster for large
+   * numbers of points because the internal parser state is looked up only
+   * once for the whole batch.
+   */
+  virtual void
+  value_list(const std::vector<Point<dim>> &points,
+             std::vector<double>           &values,
+             const unsigned int             component = 0) const override;
+
   /**
    * Return an array of function expressions (one per component), used to
    * initialize this function.
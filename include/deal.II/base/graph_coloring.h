@@ -455,6 +455,111 @@ namespace GraphColoring
 
       return coloring;
     }
+
+
+
+    /**
+     * Try to dissolve colors with few elements by moving their elements into
+     * larger colors in which they do not conflict with any element. Since a
+     * color acts as a synchronization point in a colored loop such as the one
+     * of WorkStream::run(), colors that contain only a small fraction of the
+     * elements serialize the tail of the loop while providing almost no
+     * parallelism. Such colors typically remain after gather_colors() when a
+     * single zone requires more colors than all other zones.
+     *
+     * An element may join another color if its conflict indices do not
+     * intersect the union of the conflict indices of the elements already in
+     * that color; this is exactly the condition under which the element does
+     * not conflict with any of them. Elements that cannot be placed anywhere
+     * keep their original color, so the result is always a valid coloring
+     * with at most as many colors as the input. The colors are returned
+     * ordered by decreasing number of elements.
+     */
+    template <typename Iterator>
+    void
+    balance_colors(
+      const std::function<std::vector<types::global_dof_index>(
+        const Iterator &)>               &get_conflict_indices,
+      std::vector<std::vector<Iterator>> &coloring)
+    {
+      if (coloring.size() < 2)
+        return;
+
+      // Sort the colors by decreasing number of elements so that the small
+      // colors to be dissolved are at the back.
+      std::sort(coloring.begin(),
+                coloring.end(),
+                [](const std::vector<Iterator> &a,
+                   const std::vector<Iterator> &b) {
+                  return a.size() > b.size();
+                });
+
+      std::size_t n_elements = 0;
+      for (const auto &color : coloring)
+        n_elements += color.size();
+
+      // Consider a color as small if it holds less than half the number of
+      // elements of a perfectly balanced coloring. This bounds the work of
+      // the pass while covering the tail colors that matter.
+      const std::size_t small_color_threshold =
+        n_elements / (2 * coloring.size());
+
+      if (coloring.back().size() >= small_color_threshold)
+        return;
+
+      // Collect the union of the conflict indices of each color, against
+      // which candidate elements are checked.
+      std::vector<std::unordered_set<types::global_dof_index>> color_indices(
+        coloring.size());
+      for (unsigned int c = 0; c < coloring.size(); ++c)
+        for (const Iterator &element : coloring[c])
+          for (const auto index : get_conflict_indices(element))
+            color_indices[c].insert(index);
+
+      for (unsigned int c = coloring.size() - 1;
+           c > 0 && coloring[c].size() < small_color_threshold;
+           --c)
+        {
+          std::vector<Iterator> remaining;
+          for (const Iterator &element : coloring[c])
+            {
+              const std::vector<types::global_dof_index> indices =
+                get_conflict_indices(element);
+
+              bool moved = false;
+              for (unsigned int t = 0; t < c; ++t)
+                {
+                  bool conflicts = false;
+                  for (const auto index : indices)
+                    if (color_indices[t].count(index) == 1)
+                      {
+                        conflicts = true;
+                        break;
+                      }
+
+                  if (conflicts == false)
+                    {
+                      coloring[t].push_back(element);
+                      color_indices[t].insert(indices.begin(), indices.end());
+                      moved = true;
+                      break;
+                    }
+                }
+
+              if (moved == false)
+                remaining.push_back(element);
+            }
+          coloring[c] = std::move(remaining);
+        }
+
+      // Remove colors that have been dissolved completely.
+      coloring.erase(std::remove_if(coloring.begin(),
+                                    coloring.end(),
+                                    [](const std::vector<Iterator> &color) {
+                                      return color.empty();
+                                    }),
+                     coloring.end());
+    }
   } // namespace internal
 
 
@@ -519,6 +624,13 @@ namespace GraphColoring
    * conflict indicator sets have overlap will not be assigned to the same
    * color.
    *
+   * The returned colors are balanced in the sense that colors containing
+   * only a small fraction of the elements are dissolved into larger colors
+   * where the conflict structure permits, and the colors are ordered by
+   * decreasing number of elements. This keeps the parallelism high
+   * throughout a colored loop such as the one of WorkStream::run(), which
+   * synchronizes at each color boundary.
+   *
    * @note The algorithm used in this function is described in a paper by
    * Turcksin, Kronbichler and Bangerth, see
    * @ref workstream_paper.
@@ -566,7 +678,15 @@ namespace GraphColoring
     tasks.join_all();
 
     // Gather the colors together.
-    return internal::gather_colors(partition_coloring);
+    std::vector<std::vector<Iterator>> coloring =
+      internal::gather_colors(partition_coloring);
+
+    // Dissolve small trailing colors where possible: in a colored loop such
+    // as the one of WorkStream::run(), each color is a synchronization
+    // point, and colors with few elements serialize the tail of the loop.
+    internal::balance_colors(get_conflict_indices, coloring);
+
+    return coloring;
   }
 
   /**
@@ -17,6 +17,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/mutex.h>
@@ -298,6 +299,22 @@ public:
   size_type
   index_within_set(const size_type global_index) const;
 
+  /**
+   * Same as the function above, but translating many global indices in one
+   * call: for each element of @p global_indices, the position of that index
+   * within the set (or numbers::invalid_dof_index if it is not an element of
+   * the set) is written to the corresponding entry of @p local_indices. The
+   * two arrays must have the same length.
+   *
+   * This function is more efficient than calling the single-index variant in
+   * a loop if the queried indices are sorted or clustered, as consecutive
+   * queries then tend to fall into the same contiguous range of the set and
+   * the binary search over all ranges can often be skipped.
+   */
+  void
+  index_within_set(const ArrayView<const size_type> &global_indices,
+                   const ArrayView<size_type>       &local_indices) const;
+
   /**
    * Each index set can be represented as the union of a number of contiguous
    * intervals of indices, where if necessary intervals may only consist of
@@ -29,6 +29,7 @@
 #include <limits>
 #include <map>
 #include <numeric>
+#include <ostream>
 #include <vector>
 
 
@@ -862,6 +863,45 @@ namespace Utilities
         const MPI_Comm            mpi_communicator,
         const ArrayView<T>       &minima);
 
+    /**
+     * A nonblocking version of sum(): start the reduction with
+     * <code>MPI_Iallreduce</code> and immediately return a Future object
+     * from which the result can later be obtained via Future::get(). This
+     * allows overlapping the communication latency of global reductions with
+     * local work, which is particularly valuable for the dot products of
+     * Krylov solvers at large process counts where each iteration is
+     * otherwise dominated by the latency of the blocking
+     * <code>MPI_Allreduce</code> calls.
+     *
+     * Between the call to this function and the call to Future::get() or
+     * Future::wait(), the caller must not start another collective operation
+     * on the same communicator from a different thread unless MPI has been
+     * initialized with full thread support.
+     *
+     * If deal.II has not been configured for use of MPI, the returned Future
+     * simply holds the value of @p t.
+     *
+     * @note This function is only implemented for certain template arguments
+     * <code>T</code>, namely <code>float, double, int, unsigned int</code>.
+     */
+    template <typename T>
+    Future<T>
+    isum(const T &t, const MPI_Comm mpi_communicator);
+
+    /**
+     * A nonblocking version of max(), with the same semantics as isum().
+     */
+    template <typename T>
+    Future<T>
+    imax(const T &t, const MPI_Comm mpi_communicator);
+
+    /**
+     * A nonblocking version of min(), with the same semantics as isum().
+     */
+    template <typename T>
+    Future<T>
+    imin(const T &t, const MPI_Comm mpi_communicator);
+
     /**
      * Performs a <i>logical or</i> operation over all processors of the value
      * @p t. The <i>logical or</i> operator `||` returns the boolean value
@@ -1034,6 +1074,29 @@ namespace Utilities
                 const MPI_Comm                 mpi_communicator);
 
 
+    /**
+     * Print the memory statistics provided by
+     * Utilities::System::get_memory_stats(), aggregated to minimum, average,
+     * and maximum over all processes of @p mpi_communicator, to the stream
+     * @p out on the first process. For each of the four fields of
+     * Utilities::System::MemoryStats, i.e., the peak and current virtual
+     * memory size as well as the peak ("high-water mark") and current
+     * resident set size, one line in kB is printed. The peak values are
+     * reported by the operating system for the whole lifetime of each
+     * process and thus also capture transient maxima that snapshots of the
+     * current usage would miss.
+     *
+     * This is a @ref GlossCollectiveOperation "collective operation" that
+     * performs a single reduction sweep, so it is cheap enough to be called
+     * periodically, for example once per time step, to monitor how close a
+     * long-running computation comes to the available memory. The underlying
+     * per-process data is only available on Linux; on other systems, all
+     * values are reported as zero.
+     */
+    void
+    print_memory_stats(const MPI_Comm mpi_communicator, std::ostream &out);
+
+
     /**
      * A class that is used to initialize the MPI system at the beginning of a
      * program and to shut it down again at the end. It also allows you to
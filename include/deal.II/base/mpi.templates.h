@@ -134,10 +134,76 @@ namespace Utilities
               std::copy(values.begin(), values.end(), output.begin());
           }
       }
+
+
+
+      template <typename T>
+      Future<T>
+      i_all_reduce(const MPI_Op  &mpi_op,
+                   const T       &t,
+                   const MPI_Comm mpi_communicator)
+      {
+#ifdef DEAL_II_WITH_MPI
+        if (job_supports_mpi())
+          {
+            // The result buffer must stay alive until the operation has
+            // completed, so hold it by a shared pointer that is captured by
+            // the function objects given to the Future object.
+            auto        result = std::make_shared<T>(t);
+            MPI_Request request;
+            const int   ierr = MPI_Iallreduce(MPI_IN_PLACE,
+                                            result.get(),
+                                            1,
+                                            mpi_type_id_for_type<T>,
+                                            mpi_op,
+                                            mpi_communicator,
+                                            &request);
+            AssertThrowMPI(ierr);
+
+            auto wait = [request]() mutable {
+              const int ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+            };
+            auto get_and_cleanup = [result]() { return *result; };
+            return Future<T>(wait, get_and_cleanup);
+          }
+#else
+        (void)mpi_op;
+        (void)mpi_communicator;
+#endif
+        return Future<T>([]() {}, [t]() { return t; });
+      }
     } // namespace internal
 
 
 
+    template <typename T>
+    Future<T>
+    isum(const T &t, const MPI_Comm mpi_communicator)
+    {
+      return internal::i_all_reduce(MPI_SUM, t, mpi_communicator);
+    }
+
+
+
+    template <typename T>
+    Future<T>
+    imax(const T &t, const MPI_Comm mpi_communicator)
+    {
+      return internal::i_all_reduce(MPI_MAX, t, mpi_communicator);
+    }
+
+
+
+    template <typename T>
+    Future<T>
+    imin(const T &t, const MPI_Comm mpi_communicator)
+    {
+      return internal::i_all_reduce(MPI_MIN, t, mpi_communicator);
+    }
+
+
+
     template <typename T>
     T
     sum(const T &t, const MPI_Comm mpi_communicator)
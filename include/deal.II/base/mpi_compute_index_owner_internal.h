@@ -306,7 +306,11 @@ namespace Utilities
            * Utilities::MPI::ConsensusAlgorithms::Process::answer_request(),
            * adding the owner of a particular index in request_buffer (and
            * keeping track of who requested a particular index in case that
-           * information is also desired).
+           * information is also desired). The owners are stored as pairs of
+           * the owning rank and the length of the run of consecutive
+           * requested indices with that owner, which keeps the answer
+           * messages short when ownership is mostly contiguous; the pairs
+           * are expanded again in read_answer().
            */
           virtual void
           answer_request(
@@ -166,6 +166,32 @@ namespace Utilities
              const Triangulation<dim, spacedim>                        &tria,
              const Mapping<dim, spacedim> &mapping);
 
+      /**
+       * Update the internal data structures for a new set of points @p points,
+       * assuming that the points have only moved slightly since the last call
+       * to reinit(). The new coordinates are communicated to the processes
+       * owning the previously determined cells, the mapping is inverted there,
+       * and only the cached reference-cell coordinates are replaced; the
+       * communication pattern is left untouched. If any point has left its
+       * cell (or if not all points had been found by the previous search, so
+       * that re-entry into the domain cannot be detected locally), the
+       * function automatically falls back to a full reinit().
+       *
+       * This is useful, e.g., for points attached to a slowly moving
+       * interface, where the points typically travel only a small fraction of
+       * a cell diameter between two calls and a full search would dominate
+       * the runtime.
+       *
+       * @note The size of @p points has to match the size of the point list
+       *   passed to the previous reinit() call, and the points have to be in
+       *   the same order.
+       *
+       * @warning This is a collective call that needs to be executed by all
+       *   processors in the communicator.
+       */
+      void
+      update(const std::vector<Point<spacedim>> &points);
+
       /**
        * Helper class to store and to access data of points positioned in
        * processed cells.
@@ -195,6 +195,19 @@ namespace internal
                     const double       time,
                     ArrayView<Number> &values) const;
 
+      /**
+       * Compute the value of a single component at each of the given points.
+       * This is equivalent to calling do_value() for each point, but
+       * retrieves the thread-local parser state only once for the whole
+       * batch, which is considerably cheaper than the per-point lookup when
+       * evaluating expressions at many points.
+       */
+      void
+      do_value_list(const ArrayView<const Point<dim>> &points,
+                    const double                       time,
+                    const unsigned int                 component,
+                    ArrayView<Number>                 &values) const;
+
       /**
        * An array of function expressions (one per component), required to
        * initialize tfp in each thread.
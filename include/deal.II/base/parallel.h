@@ -37,6 +37,14 @@
 #  include <boost/range/iterator_range.hpp>
 #endif
 
+#ifdef DEAL_II_WITH_TASKFLOW
+#  include <deal.II/base/multithread_info.h>
+
+#  include <taskflow/taskflow.hpp>
+
+#  include <algorithm>
+#endif
+
 #ifdef DEAL_II_HAVE_CXX20
 #  include <concepts>
 #endif
@@ -108,6 +116,41 @@ namespace parallel
                         *partitioner);
     }
 
+#elif defined(DEAL_II_WITH_TASKFLOW)
+
+    /**
+     * Split the half-open range <code>[x_begin,x_end)</code> into chunks of
+     * at most @p grainsize elements and schedule each chunk as a task on the
+     * work-stealing executor returned by
+     * MultithreadInfo::get_taskflow_executor(). The function returns once
+     * all chunks have been worked on. In contrast to the TBB variant above,
+     * the functor is called with the first and one-past-the-last element of
+     * each chunk rather than with a tbb::blocked_range object.
+     */
+    template <typename Iterator, typename Functor>
+    void
+    parallel_for(Iterator           x_begin,
+                 Iterator           x_end,
+                 const Functor     &functor,
+                 const unsigned int grainsize)
+    {
+      tf::Executor &executor = MultithreadInfo::get_taskflow_executor();
+      tf::Taskflow  taskflow;
+
+      for (Iterator chunk_begin = x_begin; chunk_begin != x_end;)
+        {
+          const Iterator chunk_end =
+            chunk_begin + std::min<std::size_t>(std::max(grainsize, 1u),
+                                                x_end - chunk_begin);
+          taskflow.emplace([chunk_begin, chunk_end, &functor]() {
+            functor(chunk_begin, chunk_end);
+          });
+          chunk_begin = chunk_end;
+        }
+
+      executor.run(taskflow).wait();
+    }
+
 #else
 
     /**
@@ -168,14 +211,7 @@ namespace parallel
                  const Function      &function,
                  const unsigned int   grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)grainsize;
-
-    for (OutputIterator in = begin_in; in != end_in;)
-      *out++ = function(*in++);
-#else
+#ifdef DEAL_II_WITH_TBB
     using Iterators     = std::tuple<InputIterator, OutputIterator>;
     using SyncIterators = SynchronousIterators<Iterators>;
     Iterators x_begin(begin_in, out);
@@ -188,6 +224,26 @@ namespace parallel
           *std::get<1>(p) = function(*std::get<0>(p));
       },
       grainsize);
+#elif defined(DEAL_II_WITH_TASKFLOW)
+    using Iterators     = std::tuple<InputIterator, OutputIterator>;
+    using SyncIterators = SynchronousIterators<Iterators>;
+    Iterators x_begin(begin_in, out);
+    Iterators x_end(end_in, OutputIterator());
+    internal::parallel_for(
+      SyncIterators(x_begin),
+      SyncIterators(x_end),
+      [function](const SyncIterators &begin, const SyncIterators &end) {
+        for (SyncIterators p = begin; p != end; ++p)
+          *std::get<1>(*p) = function(*std::get<0>(*p));
+      },
+      grainsize);
+#else
+    // make sure we don't get compiler
+    // warnings about unused arguments
+    (void)grainsize;
+
+    for (OutputIterator in = begin_in; in != end_in;)
+      *out++ = function(*in++);
 #endif
   }
 
@@ -244,14 +300,7 @@ namespace parallel
                  const Function       &function,
                  const unsigned int    grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)grainsize;
-
-    for (OutputIterator in1 = begin_in1; in1 != end_in1;)
-      *out++ = function(*in1++, *in2++);
-#else
+#ifdef DEAL_II_WITH_TBB
     using Iterators =
       std::tuple<InputIterator1, InputIterator2, OutputIterator>;
     using SyncIterators = SynchronousIterators<Iterators>;
@@ -265,6 +314,27 @@ namespace parallel
           *std::get<2>(p) = function(*std::get<0>(p), *std::get<1>(p));
       },
       grainsize);
+#elif defined(DEAL_II_WITH_TASKFLOW)
+    using Iterators =
+      std::tuple<InputIterator1, InputIterator2, OutputIterator>;
+    using SyncIterators = SynchronousIterators<Iterators>;
+    Iterators x_begin(begin_in1, in2, out);
+    Iterators x_end(end_in1, InputIterator2(), OutputIterator());
+    internal::parallel_for(
+      SyncIterators(x_begin),
+      SyncIterators(x_end),
+      [function](const SyncIterators &begin, const SyncIterators &end) {
+        for (SyncIterators p = begin; p != end; ++p)
+          *std::get<2>(*p) = function(*std::get<0>(*p), *std::get<1>(*p));
+      },
+      grainsize);
+#else
+    // make sure we don't get compiler
+    // warnings about unused arguments
+    (void)grainsize;
+
+    for (OutputIterator in1 = begin_in1; in1 != end_in1;)
+      *out++ = function(*in1++, *in2++);
 #endif
   }
 
@@ -327,14 +397,7 @@ namespace parallel
                  const Function       &function,
                  const unsigned int    grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)grainsize;
-
-    for (OutputIterator in1 = begin_in1; in1 != end_in1;)
-      *out++ = function(*in1++, *in2++, *in3++);
-#else
+#ifdef DEAL_II_WITH_TBB
     using Iterators = std::
       tuple<InputIterator1, InputIterator2, InputIterator3, OutputIterator>;
     using SyncIterators = SynchronousIterators<Iterators>;
@@ -352,6 +415,31 @@ namespace parallel
             function(*std::get<0>(p), *std::get<1>(p), *std::get<2>(p));
       },
       grainsize);
+#elif defined(DEAL_II_WITH_TASKFLOW)
+    using Iterators = std::
+      tuple<InputIterator1, InputIterator2, InputIterator3, OutputIterator>;
+    using SyncIterators = SynchronousIterators<Iterators>;
+    Iterators x_begin(begin_in1, in2, in3, out);
+    Iterators x_end(end_in1,
+                    InputIterator2(),
+                    InputIterator3(),
+                    OutputIterator());
+    internal::parallel_for(
+      SyncIterators(x_begin),
+      SyncIterators(x_end),
+      [function](const SyncIterators &begin, const SyncIterators &end) {
+        for (SyncIterators p = begin; p != end; ++p)
+          *std::get<3>(*p) =
+            function(*std::get<0>(*p), *std::get<1>(*p), *std::get<2>(*p));
+      },
+      grainsize);
+#else
+    // make sure we don't get compiler
+    // warnings about unused arguments
+    (void)grainsize;
+
+    for (OutputIterator in1 = begin_in1; in1 != end_in1;)
+      *out++ = function(*in1++, *in2++, *in3++);
 #endif
   }
 
@@ -454,13 +542,7 @@ namespace parallel
                           const Function                             &f,
                           const unsigned int                          grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)grainsize;
-
-    f(begin, end);
-#else
+#ifdef DEAL_II_WITH_TBB
     internal::parallel_for(
       begin,
       end,
@@ -468,6 +550,17 @@ namespace parallel
         internal::apply_to_subranges<Iterator, Function>(range, f);
       },
       grainsize);
+#elif defined(DEAL_II_WITH_TASKFLOW)
+    // The function object already has the signature that the Taskflow
+    // variant of internal::parallel_for() expects for its functor, so
+    // simply pass it through.
+    internal::parallel_for(begin, end, f, grainsize);
+#else
+    // make sure we don't get compiler
+    // warnings about unused arguments
+    (void)grainsize;
+
+    f(begin, end);
 #endif
   }
 
@@ -610,13 +703,7 @@ namespace parallel
                               const std_cxx20::type_identity_t<Iterator> &end,
                               const unsigned int grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)grainsize;
-
-    return f(begin, end);
-#else
+#ifdef DEAL_II_WITH_TBB
     return tbb::parallel_reduce(
       tbb::blocked_range<Iterator>(begin, end, grainsize),
       ResultType(0),
@@ -627,6 +714,31 @@ namespace parallel
       },
       std::plus<ResultType>(),
       tbb::auto_partitioner());
+#elif defined(DEAL_II_WITH_TASKFLOW)
+    // Accumulate the results of the subranges under a lock. The grain size
+    // is chosen by callers such that each chunk performs a substantial
+    // amount of work, so the brief serialization when adding up results
+    // does not matter.
+    ResultType     result = ResultType(0);
+    Threads::Mutex mutex;
+    internal::parallel_for(
+      begin,
+      end,
+      [&f, &result, &mutex](const Iterator &chunk_begin,
+                            const Iterator &chunk_end) {
+        const ResultType local_result = f(chunk_begin, chunk_end);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        result += local_result;
+      },
+      grainsize);
+    return result;
+#else
+    // make sure we don't get compiler
+    // warnings about unused arguments
+    (void)grainsize;
+
+    return f(begin, end);
 #endif
   }
 
@@ -744,13 +856,7 @@ namespace parallel
     const std::size_t end,
     const std::size_t minimum_parallel_grain_size) const
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)minimum_parallel_grain_size;
-
-    apply_to_subrange(begin, end);
-#else
+#ifdef DEAL_II_WITH_TBB
     internal::parallel_for(
       begin,
       end,
@@ -758,6 +864,20 @@ namespace parallel
         apply_to_subrange(range.begin(), range.end());
       },
       minimum_parallel_grain_size);
+#elif defined(DEAL_II_WITH_TASKFLOW)
+    internal::parallel_for(
+      begin,
+      end,
+      [this](const std::size_t chunk_begin, const std::size_t chunk_end) {
+        apply_to_subrange(chunk_begin, chunk_end);
+      },
+      minimum_parallel_grain_size);
+#else
+    // make sure we don't get compiler
+    // warnings about unused arguments
+    (void)minimum_parallel_grain_size;
+
+    apply_to_subrange(begin, end);
 #endif
   }
 
@@ -1594,6 +1594,32 @@ public:
   BOOST_SERIALIZATION_SPLIT_MEMBER()
 #endif
 
+  /**
+   * Write the current state of this object -- i.e., the tree of sections and
+   * entries, including current values, default values, documentation
+   * strings, and the descriptions of the associated patterns -- to the given
+   * file in a compact binary archive format.
+   *
+   * Together with load(), this function allows applications that repeatedly
+   * start up with the same large parameter file to bypass the cost of
+   * parsing and pattern matching on every run: parse and validate the input
+   * once, save() the resulting state to a cache file (keyed, for example, by
+   * a hash or the modification time of the input file), and let subsequent
+   * runs call load() on the cache file instead as long as the input file is
+   * unchanged.
+   */
+  void
+  save(const std::string &filename) const;
+
+  /**
+   * Restore the state of this object from a file previously written by
+   * save(), replacing the currently stored sections, entries, and patterns.
+   * Since all values written by save() have been validated against their
+   * patterns before, no revalidation happens when loading.
+   */
+  void
+  load(const std::string &filename);
+
   /**
    * Test for equality.
    */
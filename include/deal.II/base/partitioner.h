@@ -28,6 +28,7 @@
 
 #include <limits>
 #include <memory>
+#include <type_traits>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -635,6 +636,56 @@ namespace Utilities
         const ArrayView<Number, MemorySpaceType>       &locally_owned_storage,
         const ArrayView<Number, MemorySpaceType>       &ghost_array,
         std::vector<MPI_Request>                       &requests) const;
+
+      /**
+       * Same as the export_to_ghosted_array_start() function above, except
+       * that the data is converted to the (typically lower-precision) type
+       * @p WireNumber before it is sent, halving the exchanged ghost payload
+       * for the common case `Number = double`, `WireNumber = float`. The
+       * owned data as well as the final content of @p ghost_array remain in
+       * the precision of @p Number; the conversion happens on the fly while
+       * packing the send buffers and when unpacking the received data in
+       * export_to_ghosted_array_finish(). This is useful in situations where
+       * the ghost exchange is limited by the network bandwidth and the
+       * algorithm consuming the ghost values tolerates reduced precision,
+       * such as multigrid smoothers.
+       *
+       * The @p temporary_storage array must have length n_import_indices()
+       * and hold elements of type @p WireNumber. The received data is
+       * likewise transferred in @p WireNumber precision and widened in place
+       * within @p ghost_array by the corresponding
+       * export_to_ghosted_array_finish() variant, which must be given the
+       * same @p WireNumber template argument. In contrast to the
+       * full-precision function, @p ghost_array must have length
+       * n_ghost_indices(), i.e., selective exchange of a subset of ghost
+       * entries is not supported in this mode. Only available for data in
+       * host memory.
+       */
+      template <typename Number,
+                typename WireNumber,
+                typename = std::enable_if_t<!std::is_same_v<Number, WireNumber>>>
+      void
+      export_to_ghosted_array_start(
+        const unsigned int             communication_channel,
+        const ArrayView<const Number> &locally_owned_array,
+        const ArrayView<WireNumber>   &temporary_storage,
+        const ArrayView<Number>       &ghost_array,
+        std::vector<MPI_Request>      &requests) const;
+
+      /**
+       * Finish the reduced-precision exportation started by the
+       * export_to_ghosted_array_start() variant with a separate @p WireNumber
+       * type. After the communication has completed, the received
+       * @p WireNumber values are widened in place to the full precision of
+       * @p Number within @p ghost_array.
+       */
+      template <typename Number,
+                typename WireNumber,
+                typename = std::enable_if_t<!std::is_same_v<Number, WireNumber>>>
+      void
+      export_to_ghosted_array_finish(
+        const ArrayView<Number>  &ghost_array,
+        std::vector<MPI_Request> &requests) const;
 #endif
 
       /**
@@ -720,15 +771,29 @@ namespace Utilities
       /**
        * The set of (local) indices that we are importing during compress(),
        * i.e., others' ghosts that belong to the local range. The data stored is
-       * the same as in import_indices_data but the data is expanded in plain
-       * arrays. This variable is only used when using @ref GlossDevice "device"-aware MPI.
+       * the same as in import_indices_data but the data is expanded in one
+       * plain array, concatenated over all ranks we import from in the same
+       * order in which the contiguous send and receive buffers are
+       * subdivided. The part belonging to the i-th import target is
+       * delimited by import_indices_plain_chunks_by_rank. This variable is
+       * only used when using @ref GlossDevice "device"-aware MPI.
        */
       // The variable is mutable to enable lazy initialization in
       // export_to_ghosted_array_start().
-      mutable std::vector<
-        Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>>
+      mutable Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
         import_indices_plain_dev;
 
+      /**
+       * The start of the part of import_indices_plain_dev that belongs to
+       * each rank we import from, in the same way in which
+       * import_indices_chunks_by_rank_data subdivides import_indices_data.
+       * The array has length import_targets_data.size()+1 once
+       * initialize_import_indices_plain_dev() has been called; whether it is
+       * empty indicates whether that lazy initialization still needs to
+       * happen.
+       */
+      mutable std::vector<unsigned int> import_indices_plain_chunks_by_rank;
+
       /**
        * A variable caching the number of ghost indices. It would be expensive
        * to compute it by iterating over the import indices and accumulate them.
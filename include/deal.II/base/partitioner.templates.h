@@ -111,33 +111,43 @@ namespace Utilities
       // kernel launched. The indices are expanded the first time the function
       // is called.
       if ((std::is_same_v<MemorySpaceType, MemorySpace::Default>)&&(
-            import_indices_plain_dev.empty()))
+            import_indices_plain_chunks_by_rank.empty()))
         initialize_import_indices_plain_dev();
+
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
+        {
+          // Pack the send buffers of all destination ranks through a single
+          // segmented gather kernel: the indices of all ranks are
+          // concatenated in import_indices_plain_dev in the same order in
+          // which the contiguous temporary storage is handed to the
+          // individual MPI_Isend() calls below, and every entry of the send
+          // buffer is written exactly once. Compared to one kernel launch
+          // and fence per destination rank, this avoids a storm of small
+          // kernel launches on nodes with many neighbors.
+          const auto n_indices = import_indices_plain_dev.size();
+          using IndexType      = decltype(n_indices);
+
+          auto import_indices           = import_indices_plain_dev;
+          auto locally_owned_array_data = locally_owned_array.data();
+          MemorySpace::Default::kokkos_space::execution_space exec;
+          Kokkos::parallel_for(
+            "dealii::fill temp_array_ptr",
+            Kokkos::RangePolicy<
+              MemorySpace::Default::kokkos_space::execution_space>(exec,
+                                                                   0,
+                                                                   n_indices),
+            KOKKOS_LAMBDA(IndexType idx) {
+              temp_array_ptr[idx] =
+                locally_owned_array_data[import_indices[idx]];
+            });
+          exec.fence();
+        }
 #    endif
 
       for (unsigned int i = 0; i < n_import_targets; ++i)
         {
 #    if defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
-          if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
-            {
-              const auto chunk_size = import_indices_plain_dev[i].size();
-              using IndexType       = decltype(chunk_size);
-
-              auto import_indices           = import_indices_plain_dev[i];
-              auto locally_owned_array_data = locally_owned_array.data();
-              MemorySpace::Default::kokkos_space::execution_space exec;
-              Kokkos::parallel_for(
-                "dealii::fill temp_array_ptr",
-                Kokkos::RangePolicy<
-                  MemorySpace::Default::kokkos_space::execution_space>(
-                  exec, 0, chunk_size),
-                KOKKOS_LAMBDA(IndexType idx) {
-                  temp_array_ptr[idx] =
-                    locally_owned_array_data[import_indices[idx]];
-                });
-              exec.fence();
-            }
-          else
+          if constexpr (!std::is_same_v<MemorySpaceType, MemorySpace::Default>)
 #    endif
             {
               // copy the data to be sent to the import_data field
@@ -287,6 +297,133 @@ namespace Utilities
 
 
 
+    template <typename Number, typename WireNumber, typename>
+    void
+    Partitioner::export_to_ghosted_array_start(
+      const unsigned int             communication_channel,
+      const ArrayView<const Number> &locally_owned_array,
+      const ArrayView<WireNumber>   &temporary_storage,
+      const ArrayView<Number>       &ghost_array,
+      std::vector<MPI_Request>      &requests) const
+    {
+      AssertDimension(temporary_storage.size(), n_import_indices());
+      AssertIndexRange(communication_channel, 200);
+      Assert(ghost_array.size() == n_ghost_indices(),
+             ExcMessage("The reduced-precision ghost exchange does not "
+                        "support filling a subset of a larger ghost index "
+                        "set; the ghost array must have length "
+                        "n_ghost_indices()."));
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      if (n_import_targets > 0)
+        AssertDimension(locally_owned_array.size(), locally_owned_size());
+
+      Assert(requests.empty(),
+             ExcMessage("Another operation seems to still be running. "
+                        "Call update_ghost_values_finish() first."));
+
+      const unsigned int mpi_tag =
+        Utilities::MPI::internal::Tags::partitioner_export_start +
+        communication_channel;
+      Assert(mpi_tag <= Utilities::MPI::internal::Tags::partitioner_export_end,
+             ExcInternalError());
+
+      requests.resize(n_import_targets + n_ghost_targets);
+
+      // The received data is placed at the front of the ghost array in wire
+      // precision; export_to_ghosted_array_finish() then widens it in place
+      // with a backward loop, which is safe because sizeof(WireNumber) <=
+      // sizeof(Number).
+      static_assert(sizeof(WireNumber) <= sizeof(Number),
+                    "The wire type must not be wider than the storage type.");
+      WireNumber *ghost_array_ptr =
+        reinterpret_cast<WireNumber *>(ghost_array.data());
+
+      for (unsigned int i = 0; i < n_ghost_targets; ++i)
+        {
+          const int ierr =
+            MPI_Irecv(ghost_array_ptr,
+                      ghost_targets_data[i].second * sizeof(WireNumber),
+                      MPI_BYTE,
+                      ghost_targets_data[i].first,
+                      mpi_tag,
+                      communicator,
+                      &requests[i]);
+          AssertThrowMPI(ierr);
+          ghost_array_ptr += ghost_targets_data[i].second;
+        }
+
+      WireNumber *temp_array_ptr = temporary_storage.data();
+      for (unsigned int i = 0; i < n_import_targets; ++i)
+        {
+          // copy the data to be sent to the import_data field, converting to
+          // the wire precision on the fly
+          std::vector<std::pair<unsigned int, unsigned int>>::const_iterator
+            my_imports = import_indices_data.begin() +
+                         import_indices_chunks_by_rank_data[i],
+            end_my_imports = import_indices_data.begin() +
+                             import_indices_chunks_by_rank_data[i + 1];
+          unsigned int index = 0;
+          for (; my_imports != end_my_imports; ++my_imports)
+            {
+              for (unsigned int j = my_imports->first; j < my_imports->second;
+                   ++j)
+                temp_array_ptr[index++] =
+                  static_cast<WireNumber>(locally_owned_array[j]);
+            }
+          AssertDimension(index, import_targets_data[i].second);
+
+          const int ierr =
+            MPI_Isend(temp_array_ptr,
+                      import_targets_data[i].second * sizeof(WireNumber),
+                      MPI_BYTE,
+                      import_targets_data[i].first,
+                      mpi_tag,
+                      communicator,
+                      &requests[n_ghost_targets + i]);
+          AssertThrowMPI(ierr);
+          temp_array_ptr += import_targets_data[i].second;
+        }
+    }
+
+
+
+    template <typename Number, typename WireNumber, typename>
+    void
+    Partitioner::export_to_ghosted_array_finish(
+      const ArrayView<Number>  &ghost_array,
+      std::vector<MPI_Request> &requests) const
+    {
+      Assert(ghost_array.size() == n_ghost_indices(),
+             ExcMessage("The reduced-precision ghost exchange does not "
+                        "support filling a subset of a larger ghost index "
+                        "set; the ghost array must have length "
+                        "n_ghost_indices()."));
+
+      // wait for both sends and receives to complete, even though only
+      // receives are really necessary. this gives (much) better performance
+      AssertDimension(ghost_targets().size() + import_targets().size(),
+                      requests.size());
+      if (requests.size() > 0)
+        {
+          const int ierr =
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+      requests.resize(0);
+
+      // widen the received wire-precision data in place; going backwards
+      // ensures that no source entry is overwritten before it has been read
+      const WireNumber *ghost_array_wire =
+        reinterpret_cast<const WireNumber *>(ghost_array.data());
+      for (unsigned int i = n_ghost_indices(); i > 0; --i)
+        ghost_array[i - 1] = static_cast<Number>(ghost_array_wire[i - 1]);
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Partitioner::import_from_ghosted_array_start(
@@ -578,7 +715,7 @@ namespace Utilities
       // kernel launched. The indices are expanded the first time the function
       // is called.
       if ((std::is_same_v<MemorySpaceType, MemorySpace::Default>)&&(
-            import_indices_plain_dev.empty()))
+            import_indices_plain_chunks_by_rank.empty()))
         initialize_import_indices_plain_dev();
 #    endif
 
@@ -596,95 +733,72 @@ namespace Utilities
 #    if defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
           if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
             {
-              if (vector_operation == VectorOperation::add)
-                {
-                  for (const auto &import_indices_plain :
-                       import_indices_plain_dev)
-                    {
-                      const auto chunk_size = import_indices_plain.size();
-
-                      using IndexType = decltype(chunk_size);
-                      MemorySpace::Default::kokkos_space::execution_space exec;
-                      Kokkos::parallel_for(
-                        "dealii::fill locally_owned_array, add",
-                        Kokkos::RangePolicy<
-                          MemorySpace::Default::kokkos_space::execution_space>(
-                          exec, 0, chunk_size),
-                        KOKKOS_LAMBDA(IndexType idx) {
-                          locally_owned_array
-                            .data()[import_indices_plain(idx)] +=
-                            read_position[idx];
-                        });
-                      exec.fence();
-
-                      read_position += chunk_size;
-                    }
-                }
-              else if (vector_operation == VectorOperation::min)
-                {
-                  for (const auto &import_indices_plain :
-                       import_indices_plain_dev)
-                    {
-                      const auto chunk_size = import_indices_plain.size();
-
-                      using IndexType = decltype(chunk_size);
-                      MemorySpace::Default::kokkos_space::execution_space exec;
-                      Kokkos::parallel_for(
-                        "dealii::fill locally_owned_array, min",
-                        Kokkos::RangePolicy<
-                          MemorySpace::Default::kokkos_space::execution_space>(
-                          exec, 0, chunk_size),
-                        KOKKOS_LAMBDA(IndexType idx) {
-                          locally_owned_array
-                            .data()[import_indices_plain(idx)] =
-                            internal::get_min(
-                              locally_owned_array
-                                .data()[import_indices_plain(idx)],
-                              read_position[idx]);
-                        });
-                      exec.fence();
-
-                      read_position += chunk_size;
-                    }
-                }
-              else if (vector_operation == VectorOperation::max)
-                {
-                  for (const auto &import_indices_plain :
-                       import_indices_plain_dev)
-                    {
-                      const auto chunk_size = import_indices_plain.size();
-
-                      using IndexType = decltype(chunk_size);
-                      MemorySpace::Default::kokkos_space::execution_space exec;
-                      Kokkos::parallel_for(
-                        "dealii::fill locally_owned_array, max",
-                        Kokkos::RangePolicy<
-                          MemorySpace::Default::kokkos_space::execution_space>(
-                          exec, 0, chunk_size),
-                        KOKKOS_LAMBDA(IndexType idx) {
-                          locally_owned_array
-                            .data()[import_indices_plain(idx)] =
-                            internal::get_max(
-                              locally_owned_array
-                                .data()[import_indices_plain(idx)],
-                              read_position[idx]);
-                        });
-                      exec.fence();
-
-                      read_position += chunk_size;
-                    }
-                }
-              else
+              // The indices of all ranks we import from are concatenated in
+              // import_indices_plain_dev. Since the same locally owned entry
+              // may be imported from several ranks, the contributions must
+              // not be combined within a single kernel; instead, submit one
+              // kernel per rank to the same execution space instance, which
+              // executes them in order, and synchronize only once at the end
+              // instead of after every rank.
+              MemorySpace::Default::kokkos_space::execution_space exec;
+              auto locally_owned_array_data = locally_owned_array.data();
+
+              for (unsigned int i = 0;
+                   i + 1 < import_indices_plain_chunks_by_rank.size();
+                   ++i)
                 {
-                  for (const auto &import_indices_plain :
-                       import_indices_plain_dev)
+                  const auto import_indices = Kokkos::subview(
+                    import_indices_plain_dev,
+                    Kokkos::pair<unsigned int, unsigned int>(
+                      import_indices_plain_chunks_by_rank[i],
+                      import_indices_plain_chunks_by_rank[i + 1]));
+                  const auto chunk_size = import_indices.size();
+                  using IndexType       = decltype(chunk_size);
+
+                  if (vector_operation == VectorOperation::add)
+                    Kokkos::parallel_for(
+                      "dealii::fill locally_owned_array, add",
+                      Kokkos::RangePolicy<
+                        MemorySpace::Default::kokkos_space::execution_space>(
+                        exec, 0, chunk_size),
+                      KOKKOS_LAMBDA(IndexType idx) {
+                        locally_owned_array_data[import_indices(idx)] +=
+                          read_position[idx];
+                      });
+                  else if (vector_operation == VectorOperation::min)
+                    Kokkos::parallel_for(
+                      "dealii::fill locally_owned_array, min",
+                      Kokkos::RangePolicy<
+                        MemorySpace::Default::kokkos_space::execution_space>(
+                        exec, 0, chunk_size),
+                      KOKKOS_LAMBDA(IndexType idx) {
+                        locally_owned_array_data[import_indices(idx)] =
+                          internal::get_min(
+                            locally_owned_array_data[import_indices(idx)],
+                            read_position[idx]);
+                      });
+                  else if (vector_operation == VectorOperation::max)
+                    Kokkos::parallel_for(
+                      "dealii::fill locally_owned_array, max",
+                      Kokkos::RangePolicy<
+                        MemorySpace::Default::kokkos_space::execution_space>(
+                        exec, 0, chunk_size),
+                      KOKKOS_LAMBDA(IndexType idx) {
+                        locally_owned_array_data[import_indices(idx)] =
+                          internal::get_max(
+                            locally_owned_array_data[import_indices(idx)],
+                            read_position[idx]);
+                      });
+                  else
                     {
-                      // We can't easily assert here, so we just move the
-                      // pointer matching the host code.
-                      const auto chunk_size = import_indices_plain.size();
-                      read_position += chunk_size;
+                      // For insert, nothing is to be done here; we can't
+                      // easily assert as in the host code, so we just move
+                      // the read position.
                     }
+
+                  read_position += chunk_size;
                 }
+              exec.fence();
             }
           else
 #    endif
@@ -20,6 +20,8 @@
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/mpi.h>
 
+#include <memory>
+
 #ifdef DEAL_II_WITH_SCALAPACK
 
 DEAL_II_NAMESPACE_OPEN
@@ -102,6 +104,43 @@ namespace Utilities
        */
       ~ProcessGrid();
 
+      /**
+       * Return a shared pointer to a process grid with @p n_rows and
+       * @p n_columns on @p mpi_communicator. If a grid with the same
+       * dimensions and the same communicator obtained through this function
+       * is still alive, it is reused instead of creating a new BLACS
+       * context; otherwise, a new grid is created and remembered. Setting
+       * up a BLACS context is a collective operation whose cost grows with
+       * the number of processes, so programs that repeatedly construct
+       * ScaLAPACKMatrix objects with the same layout should obtain their
+       * grids through this function rather than constructing a fresh
+       * ProcessGrid every time.
+       *
+       * The registry only keeps weak references: once the last
+       * ScaLAPACKMatrix (or other holder) referencing a grid has been
+       * destroyed, the associated BLACS context is released as usual. Like
+       * the constructors, this function must be called collectively by all
+       * processes of @p mpi_communicator, and because the registry is
+       * populated and emptied in the same order on all of these processes,
+       * all of them consistently either reuse or create a grid.
+       */
+      static std::shared_ptr<const ProcessGrid>
+      get_shared_process_grid(const MPI_Comm     mpi_communicator,
+                              const unsigned int n_rows,
+                              const unsigned int n_columns);
+
+      /**
+       * Same as above, but with the grid dimensions determined
+       * heuristically from the dimensions and block-cyclic distribution of
+       * a target matrix in the same way as the corresponding constructor.
+       */
+      static std::shared_ptr<const ProcessGrid>
+      get_shared_process_grid(const MPI_Comm     mpi_communicator,
+                              const unsigned int n_rows_matrix,
+                              const unsigned int n_columns_matrix,
+                              const unsigned int row_block_size,
+                              const unsigned int column_block_size);
+
       /**
        * Return the number of rows in the processes grid.
        */
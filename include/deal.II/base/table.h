@@ -25,8 +25,10 @@
 #include <deal.II/base/table_indices.h>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <limits>
+#include <type_traits>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -3705,6 +3707,146 @@ Table<7, T>::operator()(const size_type i,
 
 
 
+/**
+ * A lightweight, non-owning view into a Table (or any contiguous block of
+ * memory in C-style ordering, i.e., with the last index running fastest)
+ * whose extents are given as compile-time template parameters. In contrast
+ * to Table, where the strides between the indices are run-time quantities,
+ * all strides of this class are compile-time constants, which allows
+ * compilers to completely unroll and vectorize loops over the entries. This
+ * is mostly useful in inner kernels that are instantiated for a fixed
+ * polynomial degree or a fixed number of quadrature points, where the
+ * dimensions of the underlying Table are known at compile time even though
+ * the Table itself carries them as run-time values.
+ *
+ * An object of this class is cheap to create and copy and should be treated
+ * like a pointer: it must not outlive the Table or array it was created
+ * from, and resizing the underlying Table invalidates the view. A read-only
+ * view is obtained by using a const qualified type, e.g.,
+ * <tt>StaticTableView<const double, n_rows, n_columns></tt>.
+ *
+ * @ingroup data
+ */
+template <typename T, std::size_t... Ns>
+class StaticTableView
+{
+public:
+  static_assert(sizeof...(Ns) > 0,
+                "The view must have at least one dimension.");
+
+  /**
+   * The type of the stored entries, possibly const qualified.
+   */
+  using value_type = T;
+
+  /**
+   * The number of indices of the view.
+   */
+  static constexpr unsigned int rank = sizeof...(Ns);
+
+  /**
+   * The extents of the view in each direction.
+   */
+  static constexpr std::array<std::size_t, rank> extents = {{Ns...}};
+
+  /**
+   * The total number of entries the view refers to, i.e., the product of
+   * the extensions in each dimension.
+   */
+  static constexpr std::size_t n_elements = (Ns * ...);
+
+  /**
+   * Constructor from a pointer to the first entry of a contiguous block of
+   * memory with at least n_elements entries, stored with the last index
+   * running fastest.
+   */
+  constexpr StaticTableView(T *const data)
+    : data_ptr(data)
+  {}
+
+  /**
+   * Constructor from a Table of matching rank. The sizes of the table must
+   * equal the extents given as template parameters, which is checked in
+   * debug mode.
+   */
+  template <typename Dummy = T,
+            std::enable_if_t<!std::is_const_v<Dummy>> * = nullptr>
+  StaticTableView(Table<rank, T> &table)
+    : data_ptr(&table(TableIndices<rank>()))
+  {
+    for (unsigned int d = 0; d < rank; ++d)
+      AssertDimension(table.size(d), extents[d]);
+  }
+
+  /**
+   * Same as above, creating a read-only view from a constant Table. This
+   * constructor is only available if the template parameter @p T is const
+   * qualified.
+   */
+  template <typename Dummy = T,
+            std::enable_if_t<std::is_const_v<Dummy>> * = nullptr>
+  StaticTableView(const Table<rank, std::remove_const_t<T>> &table)
+    : data_ptr(&table(TableIndices<rank>()))
+  {
+    for (unsigned int d = 0; d < rank; ++d)
+      AssertDimension(table.size(d), extents[d]);
+  }
+
+  /**
+   * Return a reference to the entry identified by the given indices. The
+   * number of indices must equal the rank of the view. As all strides are
+   * compile-time constants, the address computation reduces to additions
+   * of constants once the surrounding loops are unrolled.
+   */
+  template <typename... Indices>
+  constexpr T &
+  operator()(const Indices... indices) const
+  {
+    static_assert(sizeof...(Indices) == rank,
+                  "The number of indices must equal the rank of the view.");
+    return data_ptr[linear_index({{static_cast<std::size_t>(indices)...}})];
+  }
+
+  /**
+   * Return a pointer to the first entry of the view.
+   */
+  constexpr T *
+  data() const
+  {
+    return data_ptr;
+  }
+
+  /**
+   * Size of the view in direction <tt>i</tt>.
+   */
+  static constexpr std::size_t
+  size(const unsigned int i)
+  {
+    return extents[i];
+  }
+
+private:
+  /**
+   * Compute the position of the entry with the given indices within the
+   * underlying contiguous array.
+   */
+  static constexpr std::size_t
+  linear_index(const std::array<std::size_t, rank> &indices)
+  {
+    std::size_t index = indices[0];
+    for (unsigned int d = 1; d < rank; ++d)
+      index = index * extents[d] + indices[d];
+    return index;
+  }
+
+  /**
+   * Pointer to the first entry of the underlying storage.
+   */
+  T *const data_ptr;
+};
+
+
+
 /**
  * Global function @p swap which overloads the default implementation of the
  * C++ standard library which uses a temporary object. The function simply
@@ -18,6 +18,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/exceptions.h>
 #include <deal.II/base/signaling_nan.h>
 
 #include <functional>
@@ -31,6 +32,10 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace TimeStepping
 {
+  DeclExceptionMsg(ExcNoMethodSelected,
+                   "No method selected. You need to call initialize or pass a "
+                   "runge_kutta_method to the constructor.");
+
   /**
    * The following Runge-Kutta methods are available:
    * - Explicit methods (see ExplicitRungeKutta::initialize):
@@ -469,6 +474,48 @@ namespace TimeStepping
       VectorType &vec_ri,
       VectorType &vec_ki);
 
+    /**
+     * This function is used to advance from time @p t to t+ @p delta_t while
+     * fusing the stage vector updates into the operator evaluation. In
+     * contrast to the other evolve_one_time_step() functions, the operator
+     * @p f does not return the result vector but must be callable as
+     * @code
+     * f(const double      time,
+     *   const VectorType &src,
+     *   VectorType       &dst,
+     *   const std::function<void(const unsigned int, const unsigned int)>
+     *     &operation_before_loop,
+     *   const std::function<void(const unsigned int, const unsigned int)>
+     *     &operation_after_loop);
+     * @endcode
+     * setting `dst` to $f(\mathrm{time}, \mathrm{src})$ and invoking the two
+     * callbacks on every contiguous range of locally owned vector entries
+     * right before the entries are first accessed and right after they have
+     * been accessed for the last time, respectively. This is exactly the
+     * contract of MatrixFree::cell_loop() with pre- and post-operations, so
+     * for MatrixFree-backed operators @p f can simply forward its arguments
+     * to cell_loop(). The Runge-Kutta update of a vector entry is then
+     * performed while the entry is still resident in caches, which roughly
+     * halves the memory traffic per stage compared to the separate vector
+     * updates of evolve_one_time_step(); see also step-67 and step-76, whose
+     * hand-written stage loops this function replaces.
+     *
+     * The vector type must provide local_element() access, as
+     * LinearAlgebra::distributed::Vector does. As in the function above,
+     * @p vec_ki holds the evaluation of the differential operator and
+     * @p vec_ri the right-hand side for the operator application.
+     * evolve_one_time_step_fused() returns the time at the end of the time
+     * step.
+     */
+    template <typename OperatorType>
+    double
+    evolve_one_time_step_fused(const OperatorType &f,
+                               double              t,
+                               double              delta_t,
+                               VectorType         &solution,
+                               VectorType         &vec_ri,
+                               VectorType         &vec_ki);
+
     /**
      * Get the coefficients of the scheme.
      * Note that here vector @p a is not the conventional definition in terms of a
@@ -856,6 +903,65 @@ namespace TimeStepping
      */
     Status status;
   };
+
+
+
+#ifndef DOXYGEN
+  /* ---------------------- inline and template functions ------------------ */
+
+  template <typename VectorType>
+  template <typename OperatorType>
+  double
+  LowStorageRungeKutta<VectorType>::evolve_one_time_step_fused(
+    const OperatorType &f,
+    double              t,
+    double              delta_t,
+    VectorType         &solution,
+    VectorType         &vec_ri,
+    VectorType         &vec_ki)
+  {
+    Assert(status.method != runge_kutta_method::invalid, ExcNoMethodSelected());
+
+    using Number = typename VectorType::value_type;
+
+    for (unsigned int stage = 0; stage < this->n_stages; ++stage)
+      {
+        const Number factor_solution = this->b[stage] * delta_t;
+        const Number factor_ai =
+          (stage == this->n_stages - 1 ? 0. : this->a[0][stage] * delta_t);
+
+        // the first stage works on the solution vector directly, all
+        // subsequent stages on the right-hand side vector written by the
+        // previous stage
+        const VectorType &current_ri = (stage == 0) ? solution : vec_ri;
+
+        f(t + this->c[stage] * delta_t,
+          current_ri,
+          vec_ki,
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              vec_ki.local_element(i) = Number();
+          },
+          [&](const unsigned int begin, const unsigned int end) {
+            if (factor_ai == Number())
+              for (unsigned int i = begin; i < end; ++i)
+                solution.local_element(i) +=
+                  factor_solution * vec_ki.local_element(i);
+            else
+              for (unsigned int i = begin; i < end; ++i)
+                {
+                  const Number k_i   = vec_ki.local_element(i);
+                  const Number sol_i = solution.local_element(i);
+
+                  solution.local_element(i) = sol_i + factor_solution * k_i;
+                  vec_ri.local_element(i)   = sol_i + factor_ai * k_i;
+                }
+          });
+      }
+
+    return (t + delta_t);
+  }
+#endif
 } // namespace TimeStepping
 
 DEAL_II_NAMESPACE_CLOSE
@@ -26,10 +26,6 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace TimeStepping
 {
-  DeclExceptionMsg(ExcNoMethodSelected,
-                   "No method selected. You need to call initialize or pass a "
-                   "runge_kutta_method to the constructor.");
-
   // ----------------------------------------------------------------------
   // RungeKutta
   // ----------------------------------------------------------------------
@@ -21,10 +21,13 @@
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mutex.h>
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -763,6 +766,19 @@ public:
   void
   leave_subsection(const std::string &section_name = "");
 
+  /**
+   * Add an externally measured wall time to the section with the given
+   * name, creating the section if it does not exist yet. This allows to
+   * fold measurements that are too fine-grained for
+   * enter_subsection()/leave_subsection() pairs, e.g. those collected by a
+   * LightweightTimer, into the summary table of this class. Only the wall
+   * time of the section is updated; its CPU time is left unchanged.
+   */
+  void
+  add_section_time(const std::string &section_name,
+                   const double       wall_time,
+                   const unsigned int n_calls = 1);
+
   /**
    * Get a map with the collected data of the specified type for each subsection
    */
@@ -797,6 +813,70 @@ public:
   print_wall_time_statistics(const MPI_Comm mpi_comm,
                              const double   print_quantile = 0.) const;
 
+  /**
+   * Print a formatted table that shows, for each section, a histogram of the
+   * wall times recorded on the individual MPI ranks of @p mpi_comm. Whereas
+   * print_wall_time_statistics() condenses the distribution of run times into
+   * a few numbers (minimum, average, maximum, and possibly quantiles), the
+   * histogram makes load imbalance between the ranks visible at a glance: a
+   * well-balanced section puts all ranks into one or two adjacent bins,
+   * whereas stragglers show up as outlier bins far to the right.
+   *
+   * For each section, the interval between the minimal and maximal wall time
+   * over all ranks is split into @p n_bins bins of equal width, and the
+   * number of ranks falling into each bin is printed, together with the
+   * interval boundaries. As for print_wall_time_statistics(), this call only
+   * provides useful information when the TimerOutput object is constructed
+   * without an MPI_Comm argument, to let individual sections run without
+   * being disturbed by barriers.
+   */
+  void
+  print_wall_time_histograms(const MPI_Comm     mpi_comm,
+                             const unsigned int n_bins = 10) const;
+
+  /**
+   * Start recording an individual trace event for every
+   * enter_subsection()/leave_subsection() pair, in addition to the
+   * accumulated times that are collected anyway. The recorded events can be
+   * written out with write_trace() for visualization as a timeline or flame
+   * graph. Recording is disabled by default because long-running programs
+   * with fine-grained sections can generate a large number of events; the
+   * cost per event is small (a clock query and a push into a vector).
+   *
+   * Only sections entered after this call are recorded.
+   */
+  void
+  enable_trace_events();
+
+  /**
+   * Stop recording trace events previously enabled by
+   * enable_trace_events(). Events recorded so far are kept and can still be
+   * written out with write_trace().
+   */
+  void
+  disable_trace_events();
+
+  /**
+   * Write the trace events recorded since enable_trace_events() was called
+   * to the given stream, in the JSON trace event format understood by the
+   * <code>chrome://tracing</code> viewer (also known as Perfetto) and by
+   * speedscope. These viewers display the sections of the current process as
+   * a timeline in which nested sections are drawn stacked on top of their
+   * enclosing sections, reconstructing the nesting hierarchy from the
+   * recorded start and end times; this gives a flame-graph style view of
+   * where the run time goes.
+   *
+   * Each MPI process records only its own events, with its rank within the
+   * communicator passed to the constructor stored in the `pid` field of each
+   * event. To inspect a single rank, write its trace to a file of its own;
+   * traces of several ranks may also be concatenated into the `traceEvents`
+   * array of one file to compare their timelines side by side. Note that the
+   * time stamps of different ranks refer to each rank's own clock and are
+   * only comparable to the extent that the clocks are synchronized.
+   */
+  void
+  write_trace(std::ostream &out) const;
+
   /**
    * By calling this function, all output can be disabled. This function
    * together with enable_output() can be useful if one wants to control the
@@ -849,6 +929,13 @@ private:
     double       total_cpu_time;
     double       total_wall_time;
     unsigned int n_calls;
+
+    /**
+     * The point in time at which the section was entered most recently,
+     * relative to trace_reference_time. Only kept up to date while trace
+     * event recording is enabled.
+     */
+    std::chrono::time_point<std::chrono::steady_clock> trace_start;
   };
 
   /**
@@ -856,6 +943,40 @@ private:
    */
   std::map<std::string, Section> sections;
 
+  /**
+   * A structure that describes one completed
+   * enter_subsection()/leave_subsection() pair for the trace event recording
+   * of write_trace(). Times are measured in seconds relative to
+   * trace_reference_time.
+   */
+  struct TraceEvent
+  {
+    std::string name;
+    double      start;
+    double      duration;
+  };
+
+  /**
+   * The trace events recorded so far, in the order in which the sections
+   * were left. Only filled while trace event recording is enabled, see
+   * enable_trace_events().
+   */
+  std::vector<TraceEvent> trace_events;
+
+  /**
+   * The point in time that serves as the origin of the time stamps recorded
+   * in trace_events. Set when the object is created and when reset() is
+   * called.
+   */
+  std::chrono::time_point<std::chrono::steady_clock> trace_reference_time =
+    std::chrono::steady_clock::now();
+
+  /**
+   * A boolean variable that sets whether trace events are currently being
+   * recorded, see enable_trace_events().
+   */
+  bool trace_events_are_enabled = false;
+
   /**
    * The stream object to which we are to output.
    */
@@ -889,6 +1010,132 @@ private:
 
 
 
+/**
+ * A class to measure the accumulated wall time spent in frequently executed,
+ * very short sections of code, such as the work done on a single cell batch
+ * inside a loop of the MatrixFree framework. Entering a section of
+ * TimerOutput acquires a mutex and, depending on how the object was set up,
+ * performs an MPI barrier, which is far too expensive at this granularity.
+ * In contrast, starting and stopping a LightweightTimer::Scope consists of a
+ * query of `std::chrono::steady_clock` and an atomic addition, so sections
+ * in the microsecond range can be measured from many threads concurrently
+ * without serializing them.
+ *
+ * The accumulated time can be queried with total_wall_time() and, together
+ * with the number of measured scopes, be folded into a section of a
+ * TimerOutput object through add_to() in order to appear alongside the
+ * coarser measurements in the usual summary table. A typical use looks like
+ * this:
+ * @code
+ *   LightweightTimer cell_work;
+ *   matrix_free.cell_loop(
+ *     [&](const auto &data, auto &dst, const auto &src, const auto range) {
+ *       LightweightTimer::Scope scope(cell_work);
+ *       ... // work on the given cell batch range
+ *     },
+ *     dst,
+ *     src);
+ *   cell_work.add_to(timer_output, "cell loop: cell work");
+ * @endcode
+ *
+ * @ingroup utilities
+ */
+class LightweightTimer
+{
+public:
+  /**
+   * Helper class that measures the wall time between its construction and
+   * destruction (or the call to stop()) and adds it to the LightweightTimer
+   * object given to the constructor.
+   */
+  class Scope
+  {
+  public:
+    /**
+     * Constructor. Starts the measurement.
+     */
+    Scope(LightweightTimer &timer);
+
+    /**
+     * Destructor. Stops the measurement if stop() has not been called.
+     */
+    ~Scope();
+
+    /**
+     * In case you want to stop the measurement before the destructor is
+     * executed, call this function.
+     */
+    void
+    stop();
+
+  private:
+    /**
+     * Reference to the LightweightTimer object the measured time is added
+     * to.
+     */
+    LightweightTimer &timer;
+
+    /**
+     * The point in time at which the measurement started.
+     */
+    std::chrono::steady_clock::time_point start;
+
+    /**
+     * Whether the measurement is still running.
+     */
+    bool in;
+  };
+
+  /**
+   * Constructor. Sets the accumulated time and the number of calls to zero.
+   */
+  LightweightTimer();
+
+  /**
+   * Return the wall time in seconds accumulated by all scopes measured on
+   * this object so far.
+   */
+  double
+  total_wall_time() const;
+
+  /**
+   * Return the number of scopes measured on this object so far.
+   */
+  std::uint64_t
+  n_calls() const;
+
+  /**
+   * Reset the accumulated time and the number of calls to zero.
+   */
+  void
+  reset();
+
+  /**
+   * Add the accumulated wall time and number of calls to the section with
+   * the given name of a TimerOutput object, see
+   * TimerOutput::add_section_time(). The accumulated data of the current
+   * object is left unchanged, so this function should be called once after
+   * the measurements, not repeatedly.
+   */
+  void
+  add_to(TimerOutput &timer_output, const std::string &section_name) const;
+
+private:
+  /**
+   * The accumulated wall time in the ticks of `std::chrono::steady_clock`,
+   * stored atomically so that concurrently ending scopes do not need a
+   * lock.
+   */
+  std::atomic<std::chrono::steady_clock::rep> accumulated_ticks;
+
+  /**
+   * The number of measured scopes.
+   */
+  std::atomic<std::uint64_t> call_count;
+};
+
+
+
 /* ---------------- inline functions ----------------- */
 
 
@@ -963,6 +1210,83 @@ TimerOutput::Scope::stop()
 }
 
 
+
+inline LightweightTimer::Scope::Scope(LightweightTimer &timer)
+  : timer(timer)
+  , start(std::chrono::steady_clock::now())
+  , in(true)
+{}
+
+
+
+inline LightweightTimer::Scope::~Scope()
+{
+  stop();
+}
+
+
+
+inline void
+LightweightTimer::Scope::stop()
+{
+  if (!in)
+    return;
+  in = false;
+
+  const std::chrono::steady_clock::duration elapsed =
+    std::chrono::steady_clock::now() - start;
+  timer.accumulated_ticks.fetch_add(elapsed.count(),
+                                    std::memory_order_relaxed);
+  timer.call_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+
+inline LightweightTimer::LightweightTimer()
+  : accumulated_ticks(0)
+  , call_count(0)
+{}
+
+
+
+inline double
+LightweightTimer::total_wall_time() const
+{
+  return std::chrono::duration_cast<std::chrono::duration<double>>(
+           std::chrono::steady_clock::duration(
+             accumulated_ticks.load(std::memory_order_relaxed)))
+    .count();
+}
+
+
+
+inline std::uint64_t
+LightweightTimer::n_calls() const
+{
+  return call_count.load(std::memory_order_relaxed);
+}
+
+
+
+inline void
+LightweightTimer::reset()
+{
+  accumulated_ticks.store(0, std::memory_order_relaxed);
+  call_count.store(0, std::memory_order_relaxed);
+}
+
+
+
+inline void
+LightweightTimer::add_to(TimerOutput       &timer_output,
+                         const std::string &section_name) const
+{
+  timer_output.add_section_time(section_name,
+                                total_wall_time(),
+                                static_cast<unsigned int>(n_calls()));
+}
+
+
 DEAL_II_NAMESPACE_CLOSE
 
 #endif
@@ -53,6 +53,10 @@
 #  undef AssertIndexRange
 #endif // #ifdef AssertIndexRange
 
+#ifdef AssertIndexRangeSampled
+#  undef AssertIndexRangeSampled
+#endif // #ifdef AssertIndexRangeSampled
+
 #ifdef AssertIsFinite
 #  undef AssertIsFinite
 #endif // #ifdef AssertIsFinite
@@ -73,6 +77,10 @@
 #  undef AssertNothrowCusparse
 #endif // #ifdef AssertNothrowCusparse
 
+#ifdef AssertSampled
+#  undef AssertSampled
+#endif // #ifdef AssertSampled
+
 #ifdef AssertThrow
 #  undef AssertThrow
 #endif // #ifdef AssertThrow
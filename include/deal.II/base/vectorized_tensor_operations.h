@@ -0,0 +1,236 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_vectorized_tensor_operations_h
+#define dealii_vectorized_tensor_operations_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <cstddef>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @name Conversion between arrays of tensors and tensors of VectorizedArray
+ * @{
+ */
+
+/**
+ * Load the @p width consecutive tensors starting at @p input into the lanes
+ * of a tensor of VectorizedArray entries, i.e., transpose from an
+ * array-of-structs to a struct-of-arrays layout. The caller is responsible
+ * for ensuring that all @p width tensors are valid objects.
+ *
+ * Together with store_vectorized(), this function removes the need for
+ * hand-written packing when evaluating tensor expressions over many
+ * quadrature or evaluation points with SIMD instructions: load batches of
+ * tensors, evaluate the expression once on `Tensor<rank, dim,
+ * VectorizedArray<Number>>` objects, and store the result back.
+ *
+ * The lane width has to be given explicitly as the first template argument,
+ * typically as `VectorizedArray<Number>::size()`.
+ */
+template <std::size_t width, int rank_, int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE Tensor<rank_, dim, VectorizedArray<Number, width>>
+load_vectorized(const Tensor<rank_, dim, Number> *input)
+{
+  Tensor<rank_, dim, VectorizedArray<Number, width>> result;
+  for (unsigned int c = 0;
+       c < Tensor<rank_, dim, Number>::n_independent_components;
+       ++c)
+    {
+      const TableIndices<rank_> indices =
+        Tensor<rank_, dim, Number>::unrolled_to_component_indices(c);
+      VectorizedArray<Number, width> component;
+      for (std::size_t v = 0; v < width; ++v)
+        component[v] = input[v][indices];
+      result[indices] = component;
+    }
+  return result;
+}
+
+
+
+/**
+ * Same as above, but for symmetric tensors. Only the independent components
+ * are transposed.
+ */
+template <std::size_t width, int rank_, int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE
+  SymmetricTensor<rank_, dim, VectorizedArray<Number, width>>
+  load_vectorized(const SymmetricTensor<rank_, dim, Number> *input)
+{
+  SymmetricTensor<rank_, dim, VectorizedArray<Number, width>> result;
+  for (unsigned int c = 0;
+       c < SymmetricTensor<rank_, dim, Number>::n_independent_components;
+       ++c)
+    {
+      const TableIndices<rank_> indices =
+        SymmetricTensor<rank_, dim, Number>::unrolled_to_component_indices(c);
+      VectorizedArray<Number, width> component;
+      for (std::size_t v = 0; v < width; ++v)
+        component[v] = input[v](indices);
+      result(indices) = component;
+    }
+  return result;
+}
+
+
+
+/**
+ * The inverse of load_vectorized(): distribute the lanes of the given tensor
+ * of VectorizedArray entries to the @p width consecutive tensors starting at
+ * @p output.
+ */
+template <std::size_t width, int rank_, int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE void
+store_vectorized(const Tensor<rank_, dim, VectorizedArray<Number, width>> &input,
+                 Tensor<rank_, dim, Number> *output)
+{
+  for (unsigned int c = 0;
+       c < Tensor<rank_, dim, Number>::n_independent_components;
+       ++c)
+    {
+      const TableIndices<rank_> indices =
+        Tensor<rank_, dim, Number>::unrolled_to_component_indices(c);
+      const VectorizedArray<Number, width> component = input[indices];
+      for (std::size_t v = 0; v < width; ++v)
+        output[v][indices] = component[v];
+    }
+}
+
+
+
+/**
+ * Same as above, but for symmetric tensors.
+ */
+template <std::size_t width, int rank_, int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE void
+store_vectorized(
+  const SymmetricTensor<rank_, dim, VectorizedArray<Number, width>> &input,
+  SymmetricTensor<rank_, dim, Number>                               *output)
+{
+  for (unsigned int c = 0;
+       c < SymmetricTensor<rank_, dim, Number>::n_independent_components;
+       ++c)
+    {
+      const TableIndices<rank_> indices =
+        SymmetricTensor<rank_, dim, Number>::unrolled_to_component_indices(c);
+      const VectorizedArray<Number, width> component = input(indices);
+      for (std::size_t v = 0; v < width; ++v)
+        output[v](indices) = component[v];
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @name Bulk contractions over arrays of tensors
+ * @{
+ */
+
+/**
+ * Compute, for every index $q$ of the given arrays, the single contraction
+ * of the last index of <tt>left[q]</tt> with the first index of
+ * <tt>right[q]</tt>, i.e., the equivalent of
+ * @code
+ *   for (std::size_t q = 0; q < left.size(); ++q)
+ *     result[q] = left[q] * right[q];
+ * @endcode
+ * but processing `VectorizedArray<Number>::size()` entries at once with SIMD
+ * instructions. For the rank-2 times rank-2 contractions that dominate
+ * constitutive updates in quadrature-point loops, this reaches significantly
+ * higher throughput than the scalar loop, which the compiler can only
+ * partially vectorize across the short inner dimensions.
+ *
+ * The three arrays have to have the same size; @p result may not overlap
+ * with @p left or @p right. Use make_array_view() to pass AlignedVector or
+ * std::vector arguments.
+ */
+template <int rank_1, int rank_2, int dim, typename Number>
+void
+contract(const ArrayView<Tensor<rank_1 + rank_2 - 2, dim, Number>> &result,
+         const ArrayView<const Tensor<rank_1, dim, Number>>        &left,
+         const ArrayView<const Tensor<rank_2, dim, Number>>        &right)
+{
+  AssertDimension(left.size(), right.size());
+  AssertDimension(left.size(), result.size());
+
+  constexpr std::size_t width        = VectorizedArray<Number>::size();
+  const std::size_t     n_entries    = left.size();
+  const std::size_t     regular_size = n_entries / width * width;
+
+  for (std::size_t q = 0; q < regular_size; q += width)
+    store_vectorized(load_vectorized<width>(left.data() + q) *
+                       load_vectorized<width>(right.data() + q),
+                     result.data() + q);
+
+  // process the tail that does not fill a complete SIMD lane
+  for (std::size_t q = regular_size; q < n_entries; ++q)
+    result[q] = left[q] * right[q];
+}
+
+
+
+/**
+ * Like the contract() function above for two arrays of rank-2 tensors, but
+ * additionally symmetrize each product, i.e., compute the equivalent of
+ * @code
+ *   for (std::size_t q = 0; q < left.size(); ++q)
+ *     result[q] = symmetrize(left[q] * right[q]);
+ * @endcode
+ * The symmetrization is fused into the vectorized kernel, so the
+ * non-symmetric intermediate product never leaves the CPU registers. This is
+ * the typical pattern of strain or stress updates in material models, e.g.,
+ * $\mathbf b = \mathbf F \mathbf F^T$ or the push-forward of a symmetric
+ * tensor.
+ */
+template <int dim, typename Number>
+void
+contract_and_symmetrize(
+  const ArrayView<SymmetricTensor<2, dim, Number>> &result,
+  const ArrayView<const Tensor<2, dim, Number>>    &left,
+  const ArrayView<const Tensor<2, dim, Number>>    &right)
+{
+  AssertDimension(left.size(), right.size());
+  AssertDimension(left.size(), result.size());
+
+  constexpr std::size_t width        = VectorizedArray<Number>::size();
+  const std::size_t     n_entries    = left.size();
+  const std::size_t     regular_size = n_entries / width * width;
+
+  for (std::size_t q = 0; q < regular_size; q += width)
+    store_vectorized(symmetrize(load_vectorized<width>(left.data() + q) *
+                                load_vectorized<width>(right.data() + q)),
+                     result.data() + q);
+
+  for (std::size_t q = regular_size; q < n_entries; ++q)
+    result[q] = symmetrize(left[q] * right[q]);
+}
+
+/**
+ * @}
+ */
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -36,6 +36,7 @@
 
 #  include <functional>
 #  include <iterator>
+#  include <list>
 #  include <memory>
 #  include <utility>
 #  include <vector>
@@ -164,6 +165,70 @@ namespace WorkStream
    */
   namespace internal
   {
+    /**
+     * A structure that contains a pointer to a scratch data object along
+     * with a flag that indicates whether this object is currently in use.
+     */
+    template <typename ScratchData>
+    struct ScratchDataObject
+    {
+      std::unique_ptr<ScratchData> scratch_data;
+      bool                         currently_in_use;
+
+      /**
+       * Default constructor.
+       */
+      ScratchDataObject()
+        : currently_in_use(false)
+      {}
+
+      ScratchDataObject(ScratchData *p, const bool in_use)
+        : scratch_data(p)
+        , currently_in_use(in_use)
+      {}
+
+      // Provide a copy constructor that actually doesn't copy the
+      // internal state. This makes handling ScratchAndCopyDataObjects
+      // easier to handle with STL containers.
+      ScratchDataObject(const ScratchDataObject &)
+        : currently_in_use(false)
+      {}
+
+      ScratchDataObject(ScratchDataObject &&o) noexcept = default;
+    };
+
+    /**
+     * Typedef to a list of scratch data objects. The rationale for using a
+     * list is that each thread may hold more than one scratch object, see
+     * the documentation of
+     * tbb_no_coloring::IteratorRangeToItemStream::ItemType::scratch_data.
+     */
+    template <typename ScratchData>
+    using ScratchDataList = std::list<ScratchDataObject<ScratchData>>;
+
+    /**
+     * Detection helper for the reset() customization point used by
+     * ScratchDataPool.
+     */
+    template <typename ScratchData>
+    using scratch_reset_t = decltype(std::declval<ScratchData &>().reset());
+
+    /**
+     * Call the reset() member function of the given scratch object if its
+     * type provides one, and do nothing otherwise. This is the
+     * customization point through which scratch objects taken from a
+     * ScratchDataPool can restore the invariants a freshly copied object
+     * would have.
+     */
+    template <typename ScratchData>
+    inline void
+    reset_scratch_object(ScratchData &scratch_object)
+    {
+      if constexpr (dealii::internal::is_supported_operation<scratch_reset_t,
+                                                             ScratchData>)
+        scratch_object.reset();
+    }
+
 #  ifdef DEAL_II_WITH_TBB
     /**
      * A namespace for the implementation of details of the WorkStream pattern
@@ -201,39 +266,14 @@ namespace WorkStream
            * along with a flag that indicates whether this object is currently
            * in use.
            */
-          struct ScratchDataObject
-          {
-            std::unique_ptr<ScratchData> scratch_data;
-            bool                         currently_in_use;
-
-            /**
-             * Default constructor.
-             */
-            ScratchDataObject()
-              : currently_in_use(false)
-            {}
-
-            ScratchDataObject(ScratchData *p, const bool in_use)
-              : scratch_data(p)
-              , currently_in_use(in_use)
-            {}
-
-            // Provide a copy constructor that actually doesn't copy the
-            // internal state. This makes handling ScratchAndCopyDataObjects
-            // easier to handle with STL containers.
-            ScratchDataObject(const ScratchDataObject &)
-              : currently_in_use(false)
-            {}
-
-            ScratchDataObject(ScratchDataObject &&o) noexcept = default;
-          };
+          using ScratchDataObject = internal::ScratchDataObject<ScratchData>;
 
 
           /**
            * Typedef to a list of scratch data objects. The rationale for this
            * list is provided in the variables that use these lists.
            */
-          using ScratchDataList = std::list<ScratchDataObject>;
+          using ScratchDataList = internal::ScratchDataList<ScratchData>;
 
           /**
            * A list of iterators that need to be worked on. Only the first
@@ -319,25 +359,33 @@ namespace WorkStream
          * hold items, and the sample additional data object that will be
          * passed to each worker and copier function invocation.
          */
-        IteratorRangeToItemStream(const Iterator    &begin,
-                                  const Iterator    &end,
-                                  const unsigned int buffer_size,
-                                  const unsigned int chunk_size,
-                                  const ScratchData &sample_scratch_data,
-                                  const CopyData    &sample_copy_data)
+        IteratorRangeToItemStream(
+          const Iterator    &begin,
+          const Iterator    &end,
+          const unsigned int buffer_size,
+          const unsigned int chunk_size,
+          const ScratchData &sample_scratch_data,
+          const CopyData    &sample_copy_data,
+          Threads::ThreadLocalStorage<typename ItemType::ScratchDataList>
+            *external_scratch_data = nullptr)
           : remaining_iterator_range(begin, end)
           , item_buffer(buffer_size)
           , sample_scratch_data(sample_scratch_data)
           , chunk_size(chunk_size)
         {
-          // initialize the elements of the ring buffer
+          // initialize the elements of the ring buffer. the scratch objects
+          // either live in our own thread-local variable, which dies with
+          // this object, or in an externally provided one (fed by a
+          // ScratchDataPool) that outlives the current operation
           for (auto &item : item_buffer)
             {
               Assert(item.n_iterators == 0, ExcInternalError());
 
               item.iterators.resize(chunk_size,
                                     remaining_iterator_range.second);
-              item.scratch_data        = &thread_local_scratch;
+              item.scratch_data        = (external_scratch_data != nullptr ?
+                                            external_scratch_data :
+                                            &thread_local_scratch);
               item.sample_scratch_data = &sample_scratch_data;
               item.copy_datas.resize(chunk_size, sample_copy_data);
               item.currently_in_use = false;
@@ -475,7 +523,9 @@ namespace WorkStream
           const ScratchData                          &sample_scratch_data,
           const CopyData                             &sample_copy_data,
           const unsigned int                          queue_length,
-          const unsigned int                          chunk_size)
+          const unsigned int                          chunk_size,
+          Threads::ThreadLocalStorage<ScratchDataList<ScratchData>>
+            *pool_scratch_data = nullptr)
       {
         using ItemType = typename IteratorRangeToItemStream<Iterator,
                                                             ScratchData,
@@ -494,7 +544,8 @@ namespace WorkStream
                                         queue_length,
                                         chunk_size,
                                         sample_scratch_data,
-                                        sample_copy_data);
+                                        sample_copy_data,
+                                        pool_scratch_data);
         auto item_generator = [&](tbb::flow_control &fc) -> ItemType * {
           if (const auto item = iterator_range_to_item_stream.get_item())
             return item;
@@ -515,7 +566,8 @@ namespace WorkStream
              std::function<void(const Iterator &, ScratchData &, CopyData &)>(
                worker),
            copier_exists =
-             static_cast<bool>(std::function<void(const CopyData &)>(copier))](
+             static_cast<bool>(std::function<void(const CopyData &)>(copier)),
+           reset_reused_scratch_data = (pool_scratch_data != nullptr)](
             ItemType *current_item) {
             // we need to find an unused scratch data object in the list that
             // corresponds to the current thread and then mark it as used. if
@@ -538,6 +590,13 @@ namespace WorkStream
                     scratch_data       = p.scratch_data.get();
                     p.currently_in_use = true;
 
+                    // if the object comes out of a ScratchDataPool, it may
+                    // still carry state from a previous chunk or a previous
+                    // invocation of this function; give it the opportunity
+                    // to reset itself
+                    if (reset_reused_scratch_data)
+                      reset_scratch_object(*scratch_data);
+
                     break;
                   }
 
@@ -1004,6 +1063,77 @@ namespace WorkStream
 
 
 
+  /**
+   * A pool of scratch data objects that keeps the thread-local scratch
+   * objects used by WorkStream::run() alive between invocations.
+   *
+   * By default, every call to WorkStream::run() creates the scratch objects
+   * it needs by copying the provided sample object and destroys them again
+   * when the call returns. If the scratch objects are expensive to set up --
+   * the typical example is a scratch object holding FEValues objects whose
+   * constructors allocate and precompute substantial amounts of data -- and
+   * run() is invoked many times on small ranges, for example during time
+   * stepping or in nonlinear iterations on small systems, then this
+   * construction and destruction can dominate the actual work. Passing a
+   * ScratchDataPool to WorkStream::run() avoids this cost: the scratch
+   * objects are created on their first use per thread, are handed out again
+   * on subsequent invocations, and live until the pool itself is destroyed
+   * or clear() is called.
+   *
+   * Since a recycled scratch object retains whatever state the last worker
+   * call left behind, a scratch data class used with this pool can declare a
+   * member function <code>void reset()</code> as a customization point: it
+   * is invoked every time an existing object is taken out of the pool for a
+   * new chunk of work, and should restore the invariants that a freshly
+   * copied sample object would have. Scratch data types without such a
+   * member function are handed out unchanged, which is appropriate for the
+   * common case of scratch objects (like those holding FEValues) that are
+   * fully reinitialized by the worker function anyway.
+   *
+   * A pool may be used with different ranges and different worker functions,
+   * but the scratch objects it hands out are always copies of the sample
+   * object of the first run() invocation that created them; it is the
+   * caller's responsibility to use a pool only with sample objects of
+   * identical layout, and to clear() the pool when that layout changes
+   * (e.g., after mesh refinement if the scratch object sizes depend on the
+   * mesh).
+   */
+  template <typename ScratchData>
+  class ScratchDataPool
+  {
+  public:
+    /**
+     * Destroy all scratch objects currently held by the pool. The next
+     * invocation of WorkStream::run() with this pool will create scratch
+     * objects afresh from its sample object.
+     */
+    void
+    clear()
+    {
+      scratch_data.clear();
+    }
+
+    /**
+     * Return the underlying thread-local storage of scratch objects. This
+     * function is used internally by WorkStream::run(); there is usually no
+     * reason to call it in user code.
+     */
+    Threads::ThreadLocalStorage<internal::ScratchDataList<ScratchData>> &
+    get_storage()
+    {
+      return scratch_data;
+    }
+
+  private:
+    /**
+     * The scratch objects of this pool, one list per thread.
+     */
+    Threads::ThreadLocalStorage<internal::ScratchDataList<ScratchData>>
+      scratch_data;
+  };
+
+
+
   /**
    * This is one of two main functions of the WorkStream concept, doing work
    * as described in the introduction to this namespace. It corresponds to
@@ -1198,6 +1328,108 @@ namespace WorkStream
 
 
 
+  /**
+   * Same as the function above, but taking scratch objects from (and
+   * returning them to) the given ScratchDataPool instead of creating them by
+   * copying @p sample_scratch_data on every invocation. See the
+   * documentation of ScratchDataPool for when this is profitable and for the
+   * reset() customization point that recycled scratch objects can implement.
+   *
+   * This overload does not support colored iterator graphs.
+   */
+  template <typename Worker,
+            typename Copier,
+            typename Iterator,
+            typename ScratchData,
+            typename CopyData>
+  void
+  run(const Iterator                             &begin,
+      const std_cxx20::type_identity_t<Iterator> &end,
+      Worker                                      worker,
+      Copier                                      copier,
+      const ScratchData                          &sample_scratch_data,
+      const CopyData                             &sample_copy_data,
+      ScratchDataPool<ScratchData>               &scratch_pool,
+      const unsigned int queue_length = 2 * MultithreadInfo::n_threads(),
+      const unsigned int chunk_size   = 8)
+  {
+    Assert(queue_length > 0,
+           ExcMessage("The queue length must be at least one, and preferably "
+                      "larger than the number of processors on this system."));
+    (void)queue_length; // removes -Wunused-parameter warning in optimized mode
+    Assert(chunk_size > 0, ExcMessage("The chunk_size must be at least one."));
+    (void)chunk_size; // removes -Wunused-parameter warning in optimized mode
+
+    // If no work then skip. (only use operator!= for iterators since we may
+    // not have an equality comparison operator)
+    if (!(begin != end))
+      return;
+
+#  ifdef DEAL_II_WITH_TBB
+    if (MultithreadInfo::n_threads() > 1)
+      {
+        internal::tbb_no_coloring::run(begin,
+                                       end,
+                                       worker,
+                                       copier,
+                                       sample_scratch_data,
+                                       sample_copy_data,
+                                       queue_length,
+                                       chunk_size,
+                                       &scratch_pool.get_storage());
+
+        // exit this function to not run the sequential version below:
+        return;
+      }
+#  endif
+
+    // no TBB installed or we are requested to run sequentially. take (or, on
+    // first use, create) the scratch object of the current thread from the
+    // pool and otherwise proceed as internal::sequential::run() does
+    internal::ScratchDataList<ScratchData> &scratch_data_list =
+      scratch_pool.get_storage().get();
+
+    internal::ScratchDataObject<ScratchData> *scratch_data_object = nullptr;
+    for (auto &p : scratch_data_list)
+      if (p.currently_in_use == false)
+        {
+          scratch_data_object = &p;
+          internal::reset_scratch_object(*scratch_data_object->scratch_data);
+          break;
+        }
+    if (scratch_data_object == nullptr)
+      {
+        scratch_data_list.emplace_back(new ScratchData(sample_scratch_data),
+                                       false);
+        scratch_data_object = &scratch_data_list.back();
+      }
+    scratch_data_object->currently_in_use = true;
+
+    CopyData copy_data = sample_copy_data; // NOLINT
+
+    // Optimization: Check if the functions are not the zero function. To
+    // check zero-ness, create a C++ function out of it:
+    const bool have_worker =
+      (static_cast<const std::function<
+         void(const Iterator &, ScratchData &, CopyData &)> &>(worker)) !=
+      nullptr;
+    const bool have_copier =
+      (static_cast<const std::function<void(const CopyData &)> &>(copier)) !=
+      nullptr;
+
+    for (Iterator i = begin; i != end; ++i)
+      {
+        if (have_worker)
+          worker(i, *scratch_data_object->scratch_data, copy_data);
+        if (have_copier)
+          copier(copy_data);
+      }
+
+    scratch_data_object->currently_in_use = false;
+  }
+
+
+
   /**
    * Same as the function above, but for iterator ranges and C-style arrays.
    * A class that fulfills the requirements of an iterator range defines the
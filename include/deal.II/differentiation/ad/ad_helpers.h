@@ -38,6 +38,7 @@
 #  include <algorithm>
 #  include <iostream>
 #  include <iterator>
+#  include <map>
 #  include <numeric>
 
 DEAL_II_NAMESPACE_OPEN
@@ -573,6 +574,53 @@ namespace Differentiation
       void
       clear_active_tape();
 
+      /**
+       * Return the index of the tape associated with the user-defined cell
+       * @p category, allocating a previously unused tape index the first
+       * time a category is encountered.
+       *
+       * This function supports assembly loops that record the dependent
+       * function only once per group of structurally identical cells (same
+       * finite element, same quadrature formula, same branches taken in the
+       * constitutive law) and then replay the stored tape with new values of
+       * the independent variables on all other cells of that group, which
+       * removes the cost of retaping from every cell but the first of each
+       * category:
+       * @code
+       * const auto tape_index =
+       *   ad_helper.get_tape_index_for_category(cell_category);
+       * if (ad_helper.start_recording_operations(tape_index))
+       *   {
+       *     // first cell of this category: record the operations
+       *     ...
+       *     ad_helper.stop_recording_operations();
+       *   }
+       * else
+       *   {
+       *     // tape already recorded: replay it at the new evaluation point
+       *     ad_helper.activate_recorded_tape(tape_index);
+       *     ad_helper.set_independent_variables(...);
+       *   }
+       * @endcode
+       * After evaluating values or derivatives, the caller should consult
+       * active_tape_requires_retaping() to detect branch switching and, if
+       * necessary, re-record the tape at the current evaluation point by
+       * calling start_recording_operations() with the @p overwrite_tape
+       * argument set to <tt>true</tt>.
+       *
+       * @note Tape indices handed out by this function are allocated
+       * consecutively starting directly above
+       * Numbers<ad_type>::invalid_tape_index. They should therefore not be
+       * mixed with manually chosen tape indices in the same helper object.
+       *
+       * @note For tapeless auto-differentiable numbers, categorization is of
+       * no benefit since every cell evaluates the dependent function anew.
+       * The function can nevertheless be called in generic code and simply
+       * returns an index that the taped code path would use.
+       */
+      typename Types<ad_type>::tape_index
+      get_tape_index_for_category(const unsigned int category);
+
       /** @} */
 
     protected:
@@ -617,6 +665,15 @@ namespace Differentiation
       activate_tape(const typename Types<ad_type>::tape_index tape_index,
                     const bool                                read_mode);
 
+      /**
+       * The tape indices that get_tape_index_for_category() has allocated
+       * for the cell categories encountered so far. Since entries are never
+       * removed, the number of entries also identifies the next unused
+       * index.
+       */
+      std::map<unsigned int, typename Types<ad_type>::tape_index>
+        category_to_tape_index;
+
       /** @} */
 
       /**
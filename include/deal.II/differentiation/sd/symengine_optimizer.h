@@ -1570,6 +1570,63 @@ namespace Differentiation
       BOOST_SERIALIZATION_SPLIT_MEMBER()
 #  endif
 
+      /**
+       * Return a hash value computed from the registered independent
+       * variables, the dependent functions, the selected optimization
+       * method, and the optimization flags.
+       *
+       * The intended use of this function is to construct a file name for
+       * save_state() and load_state() that identifies the optimizer setup,
+       * so that the result of an expensive optimization -- in particular the
+       * just-in-time compilation performed by the "llvm" optimization method
+       * -- can be cached on disk and shared between jobs that build the same
+       * expressions:
+       * @code
+       * BatchOptimizer<double> optimizer(...);
+       * // ... register symbols and functions ...
+       * const std::string cache_file =
+       *   "sd_cache_" + std::to_string(optimizer.state_hash()) + ".bin";
+       * if (optimizer.load_state(cache_file) == false)
+       *   {
+       *     optimizer.optimize();
+       *     optimizer.save_state(cache_file);
+       *   }
+       * @endcode
+       *
+       * @note The hash is computed from the structural hashes that SymEngine
+       * assigns to the registered expressions. It is stable between runs of
+       * the same executable, but not necessarily between different versions
+       * of deal.II or SymEngine, so a cache directory should not be reused
+       * across library upgrades.
+       */
+      std::size_t
+      state_hash() const;
+
+      /**
+       * Write the complete state of this object, including the result of
+       * optimize() if it has been called, to the file @p filename using a
+       * binary archive. See the documentation of state_hash() for the
+       * intended usage pattern.
+       */
+      void
+      save_state(const std::string &filename) const;
+
+      /**
+       * Restore the state of this object from a file previously written by
+       * save_state(), returning <tt>false</tt> without changing this object
+       * if the file cannot be opened. Any symbols and functions registered
+       * with this object so far are discarded and replaced by the stored
+       * ones; as for the load() function, all symbolic variables used in the
+       * stored expressions must have been created before this call.
+       *
+       * When the "llvm" optimization method was used, the stored machine
+       * code is loaded directly and the just-in-time compilation step is
+       * skipped entirely; for the "lambda" method the optimization is
+       * re-run during loading, as for load().
+       */
+      bool
+      load_state(const std::string &filename);
+
       /**
        * @name Independent variables
        */
@@ -148,6 +148,57 @@ namespace RepartitioningPolicyTools
     const unsigned int n_min_cells;
   };
 
+  /**
+   * A policy that partitions the cells by recursive coordinate bisection of
+   * their centers, balancing the sum of the cell weights between the two
+   * sides of every cut. In contrast to the space-filling-curve partitioning
+   * used by the distributed triangulation classes, which assigns contiguous
+   * curve segments to the processes, the resulting subdomains are
+   * intersections of axis-aligned half-spaces and therefore geometrically
+   * compact. This considerably reduces the number of ghost cells when the
+   * cell weights vary strongly, since weighted cuts of the space-filling
+   * curve then produce subdomains with a large surface.
+   *
+   * The bisection works level by level on all processes at once: for every
+   * node of the bisection tree, the axis with the largest extent of the
+   * bounding box of the contained cell centers is selected and the cut
+   * position is determined from a weight histogram accumulated with a global
+   * reduction, so the setup requires a number of reduction steps that is
+   * logarithmic in the number of processes. Since the cut position is
+   * resolved only up to the histogram bin width, the weight balance is
+   * approximate.
+   */
+  template <int dim, int spacedim = dim>
+  class RecursiveBisectionPolicy : public Base<dim, spacedim>
+  {
+  public:
+    /**
+     * Constructor. Without a weighting function, each cell is assigned unit
+     * weight.
+     */
+    RecursiveBisectionPolicy();
+
+    /**
+     * Constructor taking a function that gives a weight to each cell.
+     */
+    RecursiveBisectionPolicy(
+      const std::function<unsigned int(
+        const typename Triangulation<dim, spacedim>::cell_iterator &,
+        const CellStatus)> &weighting_function);
+
+    virtual LinearAlgebra::distributed::Vector<double>
+    partition(const Triangulation<dim, spacedim> &tria_in) const override;
+
+  private:
+    /**
+     * A function that gives a weight to each cell.
+     */
+    const std::function<
+      unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                   const CellStatus)>
+      weighting_function;
+  };
+
   /**
    * A policy that allows to specify a weight of each cell. The underlying
    * algorithm will try to distribute the weights equally among the processes.
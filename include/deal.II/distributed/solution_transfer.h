@@ -21,6 +21,8 @@
 
 #include <deal.II/dofs/dof_handler.h>
 
+#include <deal.II/lac/vector.h>
+
 #include <vector>
 
 
@@ -340,6 +342,14 @@ namespace parallel
        */
       unsigned int handle;
 
+      /**
+       * Scratch storage for the DoF values of a single cell and vector.
+       * The pack and unpack callbacks are invoked once per cell; keeping
+       * this object around between invocations avoids allocating and
+       * deallocating memory on every cell.
+       */
+      Vector<typename VectorType::value_type> cell_dof_values;
+
       /**
        * A callback function used to pack the data on the current mesh into
        * objects that can later be retrieved after refinement, coarsening and
@@ -22,6 +22,7 @@
 #include <deal.II/base/smartpointer.h>
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/template_constraints.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/distributed/p4est_wrappers.h>
 #include <deal.II/distributed/tria_base.h>
@@ -619,6 +620,42 @@ namespace parallel
       virtual void
       save(const std::string &filename) const override;
 
+      /**
+       * Same as save(), but the file I/O -- usually the dominant cost of a
+       * checkpoint -- is performed by a background task so that computations
+       * can continue while the data is being written to disk.
+       *
+       * When this function returns, the data attached through
+       * register_data_attach() has been packed into internal buffers and a
+       * lightweight snapshot of the mesh has been taken. The triangulation
+       * may consequently be refined, coarsened, or repartitioned again, and
+       * new data may be attached, without affecting the checkpoint being
+       * written. The triangulation object itself must remain alive until the
+       * returned task has completed, since the snapshot shares immutable
+       * data with it.
+       *
+       * The returned Threads::Task object serves as a completion handle:
+       * call Threads::Task::join() on it to wait for the checkpoint to be
+       * on disk. You must join the task before initiating another save to
+       * the same set of files, before destroying the triangulation, and
+       * before MPI is finalized. Exceptions raised during the write are
+       * re-thrown by Threads::Task::join().
+       *
+       * All communication of the background task happens on a duplicate of
+       * the triangulation's communicator, so that it cannot interfere with
+       * messages exchanged by the ongoing computation. This requires that
+       * MPI has been initialized with full thread support, i.e., with
+       * `MPI_THREAD_MULTIPLE` (see the documentation of
+       * Utilities::MPI::MPI_InitFinalize); the function aborts with an
+       * exception otherwise.
+       *
+       * @note The signal Signals::post_distributed_save is triggered from
+       * the background task once the checkpoint is complete, i.e.,
+       * potentially concurrently with user code running on other threads.
+       */
+      Threads::Task<void>
+      save_async(const std::string &filename) const;
+
       /**
        * Load the refinement information saved with save() back in. The mesh
        * must contain the same coarse mesh that was used in save() before
@@ -740,6 +777,96 @@ namespace parallel
        */
       typename dealii::internal::p4est::types<dim>::ghost *parallel_ghost;
 
+      /**
+       * A copy of the locally relevant part of the forest -- the locally
+       * owned quadrants, the ghost layer with its owners, and the partition
+       * boundaries -- as it was when copy_local_forest_to_triangulation()
+       * last synchronized the triangulation with it. If the forest has not
+       * changed locally since then, which is common on processes far away
+       * from the region touched by an adaptation or repartition step, the
+       * triangulation already matches the forest and the synchronization can
+       * be skipped entirely. See copy_local_forest_to_triangulation().
+       */
+      struct LocalForestSnapshot
+      {
+        /**
+         * Whether the snapshot describes the state of the forest the
+         * triangulation was last synchronized with. False initially and
+         * after the forest has been replaced, for example when loading a
+         * checkpoint.
+         */
+        bool is_valid = false;
+
+        /**
+         * The range of trees that have quadrants on this process, as stored
+         * in the forest.
+         */
+        typename dealii::internal::p4est::types<dim>::topidx first_local_tree;
+        typename dealii::internal::p4est::types<dim>::topidx last_local_tree;
+
+        /**
+         * The number of locally owned quadrants of each tree in the range
+         * [first_local_tree, last_local_tree].
+         */
+        std::vector<typename dealii::internal::p4est::types<dim>::locidx>
+          quadrants_per_tree;
+
+        /**
+         * The locally owned quadrants of all local trees, concatenated in
+         * tree order.
+         */
+        std::vector<typename dealii::internal::p4est::types<dim>::quadrant>
+          local_quadrants;
+
+        /**
+         * The quadrants of the ghost layer, in the order stored by p4est.
+         */
+        std::vector<typename dealii::internal::p4est::types<dim>::quadrant>
+          ghost_quadrants;
+
+        /**
+         * The tree and owning process offsets into the ghost quadrant array,
+         * as stored in the p4est ghost layer. Equality of these offsets
+         * implies that every ghost quadrant belongs to the same tree and the
+         * same owner as in the snapshot.
+         */
+        std::vector<typename dealii::internal::p4est::types<dim>::locidx>
+          ghost_tree_offsets;
+        std::vector<typename dealii::internal::p4est::types<dim>::locidx>
+          ghost_proc_offsets;
+
+        /**
+         * The global indices of the first quadrant owned by each process.
+         * Only compared when a multigrid hierarchy is constructed, where the
+         * level subdomain ids depend on the global partition.
+         */
+        std::vector<typename dealii::internal::p4est::types<dim>::gloidx>
+          global_first_quadrant;
+      };
+
+      /**
+       * The snapshot of the forest state that
+       * copy_local_forest_to_triangulation() last consumed, see
+       * LocalForestSnapshot.
+       */
+      LocalForestSnapshot local_forest_snapshot;
+
+      /**
+       * Fill local_forest_snapshot from the current parallel_forest and
+       * parallel_ghost. Called at the end of
+       * copy_local_forest_to_triangulation().
+       */
+      void
+      store_local_forest_snapshot();
+
+      /**
+       * Return whether the current parallel_forest and parallel_ghost are
+       * identical, as far as this process is concerned, to the state
+       * recorded in local_forest_snapshot.
+       */
+      bool
+      local_forest_matches_snapshot() const;
+
       /**
        * Go through all p4est trees and record the relations between locally
        * owned p4est quadrants and active deal.II cells in the private member
@@ -0,0 +1,297 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_cell_dof_indices_cache_h
+#define dealii_cell_dof_indices_cache_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mutex.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/grid/tria.h>
+
+#include <boost/signals2.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * A class that caches the global DoF indices of all active cells of a
+ * DoFHandler in one flat array.
+ *
+ * DoFCellAccessor::get_dof_indices() assembles the indices of a cell anew on
+ * every call by walking the internal vertex, line, and quad index arrays of
+ * the DoFHandler. This is cheap for a single call, but assembly-type loops
+ * that run over the mesh many times -- building constraints, creating
+ * sparsity patterns, assembling matrices and right hand sides -- repeat the
+ * same gather work in every sweep. This class performs the gather once for
+ * all non-artificial active cells, stores the result contiguously in the
+ * order of the cells' active cell indices, and hands out the indices of an
+ * individual cell as a non-owning ArrayView, so that repeated queries reduce
+ * to reading a ready-made array.
+ *
+ * The class attaches to the Triangulation::Signals::any_change signal of the
+ * triangulation underlying the DoFHandler passed to the constructor, so the
+ * cached indices are rebuilt automatically after mesh refinement or
+ * coarsening (followed, as usual, by a call to
+ * DoFHandler::distribute_dofs()). Operations that change DoF indices without
+ * touching the triangulation -- in particular
+ * DoFRenumbering/DoFHandler::renumber_dofs() -- are not observable through
+ * triangulation signals; after such an operation you have to call
+ * mark_for_update() yourself before querying the cache again.
+ *
+ * A typical use looks as follows:
+ * @code
+ * CellDoFIndicesCache<dim> dof_indices_cache(dof_handler);
+ *
+ * for (const auto &cell : dof_handler.active_cell_iterators())
+ *   {
+ *     const ArrayView<const types::global_dof_index> dof_indices =
+ *       dof_indices_cache.get_dof_indices(cell);
+ *     ...
+ *   }
+ * @endcode
+ *
+ * The get_dof_indices() function may be called concurrently from several
+ * threads. The one-time rebuild after a mesh change happens under a lock;
+ * once the cache is up to date, queries are pure reads that do not acquire
+ * any lock.
+ */
+template <int dim, int spacedim = dim>
+class CellDoFIndicesCache : public Subscriptor
+{
+public:
+  /**
+   * Constructor. Stores a pointer to the given DoFHandler and connects to
+   * the underlying triangulation to keep track of mesh changes. The cached
+   * indices are built lazily upon the first call to get_dof_indices(), so
+   * the DoFHandler does not need to have distributed degrees of freedom yet
+   * at the time the cache object is created.
+   */
+  CellDoFIndicesCache(const DoFHandler<dim, spacedim> &dof_handler);
+
+  /**
+   * Destructor. Releases the connection to the triangulation signal.
+   */
+  ~CellDoFIndicesCache() override;
+
+  /**
+   * Return the global DoF indices of the given non-artificial active cell,
+   * in the same order in which DoFCellAccessor::get_dof_indices() would
+   * return them. The returned view points directly into the cached array;
+   * it remains valid until the cache is rebuilt, i.e., until the
+   * triangulation changes or mark_for_update() is called.
+   */
+  ArrayView<const types::global_dof_index>
+  get_dof_indices(
+    const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell)
+    const;
+
+  /**
+   * Make sure the cached indices are rebuilt during the next call to
+   * get_dof_indices(). This needs to be called by hand after every operation
+   * that changes DoF indices without changing the triangulation, such as
+   * DoFHandler::renumber_dofs().
+   *
+   * Notice that no work is performed when you call this function; the actual
+   * rebuild happens the next time the cache is queried.
+   */
+  void
+  mark_for_update();
+
+  /**
+   * Return a reference to the stored DoFHandler.
+   */
+  const DoFHandler<dim, spacedim> &
+  get_dof_handler() const;
+
+private:
+  /**
+   * Gather the DoF indices of all non-artificial active cells into
+   * #cell_dof_indices.
+   */
+  void
+  update() const;
+
+  /**
+   * A pointer to the DoFHandler whose cell indices are cached.
+   */
+  SmartPointer<const DoFHandler<dim, spacedim>,
+               CellDoFIndicesCache<dim, spacedim>>
+    dof_handler;
+
+  /**
+   * Whether the cache needs to be rebuilt before the next query. Stored in
+   * an atomic variable so that readers can check it without acquiring
+   * #update_mutex.
+   */
+  mutable std::atomic<bool> update_required;
+
+  /**
+   * The DoF indices of all non-artificial active cells, stored contiguously
+   * in the order of the cells' active cell indices.
+   */
+  mutable std::vector<types::global_dof_index> cell_dof_indices;
+
+  /**
+   * Start of the indices of each active cell within #cell_dof_indices, in
+   * compressed row storage format: the indices of the cell with active cell
+   * index `c` occupy the range `[cell_dof_indices_ptr[c],
+   * cell_dof_indices_ptr[c+1])`. Artificial cells are represented by empty
+   * ranges. The two-array layout is necessary because the number of DoFs
+   * per cell can vary in the hp-case.
+   */
+  mutable std::vector<std::size_t> cell_dof_indices_ptr;
+
+  /**
+   * Mutex that serializes the one-time rebuild of the cache.
+   */
+  mutable Threads::Mutex update_mutex;
+
+  /**
+   * Storage for the status of the triangulation signal.
+   */
+  boost::signals2::connection tria_signal;
+};
+
+
+#ifndef DOXYGEN
+
+// Implementation
+
+template <int dim, int spacedim>
+CellDoFIndicesCache<dim, spacedim>::CellDoFIndicesCache(
+  const DoFHandler<dim, spacedim> &dof_handler)
+  : dof_handler(&dof_handler)
+  , update_required(true)
+{
+  tria_signal =
+    dof_handler.get_triangulation().signals.any_change.connect(
+      [this]() { this->mark_for_update(); });
+}
+
+
+
+template <int dim, int spacedim>
+CellDoFIndicesCache<dim, spacedim>::~CellDoFIndicesCache()
+{
+  if (tria_signal.connected())
+    tria_signal.disconnect();
+}
+
+
+
+template <int dim, int spacedim>
+void
+CellDoFIndicesCache<dim, spacedim>::mark_for_update()
+{
+  update_required = true;
+}
+
+
+
+template <int dim, int spacedim>
+const DoFHandler<dim, spacedim> &
+CellDoFIndicesCache<dim, spacedim>::get_dof_handler() const
+{
+  return *dof_handler;
+}
+
+
+
+template <int dim, int spacedim>
+void
+CellDoFIndicesCache<dim, spacedim>::update() const
+{
+  Assert(dof_handler->n_dofs() > 0,
+         ExcMessage("The DoFHandler has no degrees of freedom. You need to "
+                    "call DoFHandler::distribute_dofs() before querying "
+                    "cached DoF indices."));
+
+  const Triangulation<dim, spacedim> &triangulation =
+    dof_handler->get_triangulation();
+
+  // First record the number of DoFs of each cell, then turn the counts into
+  // offsets by accumulation.
+  cell_dof_indices_ptr.assign(triangulation.n_active_cells() + 1, 0);
+  for (const auto &cell : dof_handler->active_cell_iterators())
+    if (cell->is_artificial() == false)
+      cell_dof_indices_ptr[cell->active_cell_index() + 1] =
+        cell->get_fe().n_dofs_per_cell();
+  std::partial_sum(cell_dof_indices_ptr.begin(),
+                   cell_dof_indices_ptr.end(),
+                   cell_dof_indices_ptr.begin());
+
+  cell_dof_indices.resize(cell_dof_indices_ptr.back());
+
+  std::vector<types::global_dof_index> local_dof_indices;
+  for (const auto &cell : dof_handler->active_cell_iterators())
+    if (cell->is_artificial() == false)
+      {
+        local_dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(local_dof_indices);
+        std::copy(local_dof_indices.begin(),
+                  local_dof_indices.end(),
+                  cell_dof_indices.begin() +
+                    cell_dof_indices_ptr[cell->active_cell_index()]);
+      }
+}
+
+
+
+template <int dim, int spacedim>
+ArrayView<const types::global_dof_index>
+CellDoFIndicesCache<dim, spacedim>::get_dof_indices(
+  const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell) const
+{
+  Assert(&cell->get_dof_handler() == &*dof_handler,
+         ExcMessage("The given cell does not belong to the DoFHandler passed "
+                    "to the constructor of this object."));
+  Assert(cell->is_artificial() == false,
+         ExcMessage("Can't ask for DoF indices on artificial cells."));
+
+  if (update_required)
+    {
+      std::lock_guard<std::mutex> lock(update_mutex);
+      if (update_required)
+        {
+          update();
+          update_required = false;
+        }
+    }
+
+  const unsigned int active_cell_index = cell->active_cell_index();
+  return make_array_view(cell_dof_indices.begin() +
+                           cell_dof_indices_ptr[active_cell_index],
+                         cell_dof_indices.begin() +
+                           cell_dof_indices_ptr[active_cell_index + 1]);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -23,6 +23,7 @@
 
 #include <deal.II/dofs/dof_handler.h>
 
+#include <iosfwd>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -1367,6 +1368,76 @@ namespace DoFRenumbering
     const AffineConstraints<Number> &constraints,
     const AdditionalDataType        &matrix_free_additional_data);
 
+  /**
+   * Same renumbering strategy as the matrix_free_data_locality() function
+   * taking a single MatrixFree argument, but considering several MatrixFree
+   * objects that all include the given DoFHandler, e.g., operators set up
+   * with different quadrature formulas or a combination of continuous and
+   * discontinuous fields on separate DoFHandler objects. The traversal
+   * through the cells of the first entry in the list determines the basic
+   * order of the unknowns, whereas the distinction between unknowns of short
+   * reach and unknowns touched from cell groups far apart in the loop (or by
+   * other MPI processes) is made with respect to all given loops combined:
+   * an unknown gets sorted into the cache-friendly part of the vector only
+   * if every loop in the list touches it from within a single range of cell
+   * batches. This keeps the renumbering effective when several matrix-free
+   * loops alternate on the same vector layout. All entries in the list must
+   * agree on the set of locally owned unknowns of the DoFHandler and on the
+   * multigrid level they are set up on.
+   */
+  template <int dim,
+            int spacedim,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  matrix_free_data_locality(
+    DoFHandler<dim, spacedim> &dof_handler,
+    const std::vector<const MatrixFree<dim, Number, VectorizedArrayType> *>
+      &matrix_free_objects);
+
+  /**
+   * Compute the renumbering vector needed by the matrix_free_data_locality()
+   * function taking several MatrixFree objects.
+   * Does not perform the renumbering on the @p DoFHandler dofs but returns the
+   * renumbering vector.
+   */
+  template <int dim,
+            int spacedim,
+            typename Number,
+            typename VectorizedArrayType>
+  std::vector<types::global_dof_index>
+  compute_matrix_free_data_locality(
+    const DoFHandler<dim, spacedim> &dof_handler,
+    const std::vector<const MatrixFree<dim, Number, VectorizedArrayType> *>
+      &matrix_free_objects);
+
+  /**
+   * Print a prediction of the data transfer between main memory and caches
+   * caused by the vector entries accessed in MatrixFree::cell_loop() for
+   * each of the given MatrixFree objects, comparing the current numbering of
+   * unknowns in the DoFHandler to the renumbering given by
+   * @p new_global_numbers, which is typically the result of
+   * compute_matrix_free_data_locality(). The prediction is based on a simple
+   * cache model where a cache line of 64 bytes gets transferred once for
+   * every range of cell batches (i.e., every call-back of the loop) touching
+   * at least one of its entries, which is precisely the kind of reuse the
+   * renumbering aims to improve. The numbers refer to the locally owned
+   * entries of a single input vector of the respective loop; the intent is
+   * to compare them against measurements obtained with hardware performance
+   * counters through external profiling tools.
+   */
+  template <int dim,
+            int spacedim,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  report_matrix_free_data_locality(
+    std::ostream                    &out,
+    const DoFHandler<dim, spacedim> &dof_handler,
+    const std::vector<const MatrixFree<dim, Number, VectorizedArrayType> *>
+      &matrix_free_objects,
+    const std::vector<types::global_dof_index> &new_global_numbers);
+
   /**
    * @}
    */
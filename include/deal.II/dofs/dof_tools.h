@@ -29,6 +29,7 @@
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/sparsity_pattern_base.h>
 
+#include <functional>
 #include <map>
 #include <ostream>
 #include <set>
@@ -753,12 +754,34 @@ namespace DoFTools
    * all constraints due to differing mesh sizes (h) or polynomial degrees (p)
    * between adjacent cells.
    *
+   * The optional argument @p cell_filter allows restricting the computation
+   * to a subset of cells. If a non-empty function object is given, only those
+   * locally relevant cells for which it returns `true` are visited, and
+   * consequently only constraints on faces of these cells are entered into
+   * @p constraints. This is useful in adaptive computations in which only a
+   * small fraction of the mesh changes between refinement cycles: one can
+   * then record which cells were refined, coarsened, or touch such a cell
+   * (for example through the signals of the Triangulation class), recompute
+   * the constraints only on this region, and obtain the remaining ones by
+   * merging with constraints stored for the unchanged part of the mesh. Note
+   * that DoFHandler::distribute_dofs() generally assigns new global indices
+   * to all degrees of freedom, so stored constraints can only be reused if
+   * the enumeration of the unchanged degrees of freedom is stable, for
+   * example after renumbering accordingly. Note also that hanging node
+   * constraints on a face are computed from the coarse cell adjacent to the
+   * refined face; the filter must therefore accept at least all cells
+   * adjacent to faces on which constraints are to be computed.
+   *
    * @ingroup constraints
    */
   template <int dim, int spacedim, typename number>
   void
-  make_hanging_node_constraints(const DoFHandler<dim, spacedim> &dof_handler,
-                                AffineConstraints<number>       &constraints);
+  make_hanging_node_constraints(
+    const DoFHandler<dim, spacedim> &dof_handler,
+    AffineConstraints<number>       &constraints,
+    const std::function<bool(
+      const typename DoFHandler<dim, spacedim>::active_cell_iterator &)>
+      &cell_filter = {});
 
   /**
    * This function is used when different variables in a problem are
@@ -1595,6 +1618,27 @@ namespace DoFTools
   extract_locally_relevant_dofs(const DoFHandler<dim, spacedim> &dof_handler,
                                 IndexSet                        &dof_set);
 
+  /**
+   * Extract the union of DoFHandler::locally_owned_dofs() and the DoF
+   * indices on those ghost cells that share at least one face (possibly a
+   * periodic one) with a locally owned cell. This is a subset of what
+   * extract_locally_relevant_dofs() returns: ghost cells that only touch
+   * the locally owned subdomain at a vertex or an edge are not included.
+   *
+   * The returned set is sufficient for operations that only couple cells
+   * through faces, such as evaluating the jump terms of an error estimator
+   * with FEInterfaceValues. Ghosting a vector with this smaller set &mdash;
+   * by passing the returned IndexSet instead of the locally relevant DoFs
+   * to the vector's reinit() function or to the
+   * Utilities::MPI::Partitioner constructor &mdash; reduces both the memory
+   * footprint of the ghost entries and the communication volume of
+   * update_ghost_values(), which can be substantial in 3d where most ghost
+   * cells of a partition touch it only at vertices or edges.
+   */
+  template <int dim, int spacedim>
+  IndexSet
+  extract_face_halo_dofs(const DoFHandler<dim, spacedim> &dof_handler);
+
   /**
    * Extract the set of locally owned DoF indices for each component within the
    * mask that are owned by the current processor. For components disabled by
@@ -1201,8 +1201,11 @@ public:
    * with this, then you might want to use the constraints_are_implemented()
    * function to check up front whether this function will succeed or generate
    * the exception.
+   *
+   * Derived classes may override this function to compute the constraint
+   * matrix only upon first request, as FESystem does.
    */
-  const FullMatrix<double> &
+  virtual const FullMatrix<double> &
   constraints(const dealii::internal::SubfaceCase<dim> &subface_case =
                 dealii::internal::SubfaceCase<dim>::case_isotropic) const;
 
@@ -1221,7 +1224,7 @@ public:
    * however, one then still needs to cope with the lack of information this
    * just expresses.
    */
-  bool
+  virtual bool
   constraints_are_implemented(
     const dealii::internal::SubfaceCase<dim> &subface_case =
       dealii::internal::SubfaceCase<dim>::case_isotropic) const;
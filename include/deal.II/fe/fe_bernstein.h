@@ -58,6 +58,20 @@ DEAL_II_NAMESPACE_OPEN
  * support points are at the vertices, then on the line, on the quads, and
  * finally (for 3d) on the hexes. See the documentation of FE_Q for more
  * details.
+ *
+ * <h3>Matrix-free operator evaluation</h3>
+ *
+ * This element is supported by the MatrixFree framework and evaluated with
+ * sum-factorized kernels, since the underlying basis is a tensor product of
+ * one-dimensional Bernstein polynomials. The Bernstein basis is symmetric
+ * about the cell center, so for odd polynomial degrees FEEvaluation applies
+ * the fastest even-odd decomposed kernels, with costs comparable to FE_Q of
+ * the same degree. For even degrees of four and higher combined with an odd
+ * number of quadrature points per direction, the element is processed by the
+ * general sum-factorization kernels instead: the even-odd kernels
+ * additionally assume that all but the middle basis function vanish at the
+ * cell center, which holds for the Lagrange basis of FE_Q but not for the
+ * Bernstein basis, whose functions are all positive in the interior.
  */
 
 template <int dim, int spacedim = dim>
@@ -27,6 +27,9 @@
 
 #include <deal.II/fe/fe_values_views.h>
 
+#include <algorithm>
+#include <numeric>
+
 DEAL_II_NAMESPACE_OPEN
 
 // Forward declaration
@@ -35,6 +38,56 @@ template <int dim, int spacedim>
 class FEValuesBase;
 #endif
 
+namespace internal
+{
+  namespace FECouplingValuesImplementation
+  {
+    /**
+     * Compare two points lexicographically by their coordinates, where
+     * coordinates that differ by less than @p tol are considered equal.
+     */
+    template <int spacedim>
+    inline bool
+    lexicographic_less(const Point<spacedim> &p,
+                       const Point<spacedim> &q,
+                       const double           tol)
+    {
+      for (unsigned int d = 0; d < spacedim; ++d)
+        {
+          const double diff = p[d] - q[d];
+          if (std::abs(diff) > tol)
+            return diff < 0;
+        }
+      return false;
+    }
+
+
+
+    /**
+     * Return a permutation of the indices `[0, points.size())` that sorts the
+     * given points lexicographically by their coordinates, using
+     * lexicographic_less() with the given tolerance as comparator. Sorting
+     * both of two point sets this way allows matching them up in
+     * $O(n \log n)$ operations rather than comparing all pairs, provided the
+     * distance between distinct points is large compared to @p tol.
+     */
+    template <int spacedim>
+    inline std::vector<unsigned int>
+    lexicographic_ordering(const std::vector<Point<spacedim>> &points,
+                           const double                        tol)
+    {
+      std::vector<unsigned int> order(points.size());
+      std::iota(order.begin(), order.end(), 0U);
+      std::sort(order.begin(),
+                order.end(),
+                [&points, tol](const unsigned int i, const unsigned int j) {
+                  return lexicographic_less(points[i], points[j], tol);
+                });
+      return order;
+    }
+  } // namespace FECouplingValuesImplementation
+} // namespace internal
+
 namespace FEValuesViews
 {
   /**
@@ -1543,23 +1596,28 @@ FECouplingValues<dim1, dim2, spacedim>::reinit(
           first_quad_map.clear();
           second_quad_map.resize(fe_values_1.get_quadrature_points().size());
 
-          // [TODO]: Avoid quadratic complexity here
-          for (const unsigned int &i : fe_values_1.quadrature_point_indices())
+          // Match the two point sets in O(n log n) operations by sorting
+          // both of them lexicographically (with coordinates closer than the
+          // tolerance considered equal) and pairing up the two sorted
+          // sequences element by element. This assumes that distinct
+          // quadrature points are separated by distances large compared to
+          // the tolerance, which is the same assumption the distance-based
+          // comparison makes.
+          const auto order_1 = internal::FECouplingValuesImplementation::
+            lexicographic_ordering(quadrature_points_1, tol);
+          const auto order_2 = internal::FECouplingValuesImplementation::
+            lexicographic_ordering(quadrature_points_2, tol);
+
+          for (unsigned int k = 0; k < order_1.size(); ++k)
             {
-              auto id = numbers::invalid_unsigned_int;
-              for (const unsigned int &j :
-                   fe_values_2.quadrature_point_indices())
-                if (quadrature_points_1[i].distance(quadrature_points_2[j]) <
-                    tol)
-                  {
-                    id                 = i;
-                    second_quad_map[i] = j;
-                    break;
-                  }
-              Assert(id != numbers::invalid_unsigned_int,
+              const unsigned int i = order_1[k];
+              const unsigned int j = order_2[k];
+              Assert(quadrature_points_1[i].distance(quadrature_points_2[j]) <
+                       tol,
                      ExcMessage(
                        "The two FEValuesBase objects must have the same "
                        "quadrature points, even if not in the same order."));
+              second_quad_map[i] = j;
             }
           break;
         }
@@ -1568,19 +1626,62 @@ FECouplingValues<dim1, dim2, spacedim>::reinit(
           const auto &quadrature_points_1 = fe_values_1.get_quadrature_points();
           const auto &quadrature_points_2 = fe_values_2.get_quadrature_points();
 
-          // [TODO]: Avoid quadratic complexity here
-          for (const unsigned int &i : fe_values_1.quadrature_point_indices())
+          // Find the overlapping subset of the two point sets in O(n log n)
+          // operations by walking the two lexicographically sorted sequences
+          // in parallel, in the same spirit as std::set_intersection. As in
+          // the 'reorder' case above, this assumes that distinct quadrature
+          // points are separated by distances large compared to the
+          // tolerance.
+          const auto order_1 = internal::FECouplingValuesImplementation::
+            lexicographic_ordering(quadrature_points_1, tol);
+          const auto order_2 = internal::FECouplingValuesImplementation::
+            lexicographic_ordering(quadrature_points_2, tol);
+
+          unsigned int k1 = 0;
+          unsigned int k2 = 0;
+          while ((k1 < order_1.size()) && (k2 < order_2.size()))
             {
-              for (const unsigned int &j :
-                   fe_values_2.quadrature_point_indices())
-                if (quadrature_points_1[i].distance(quadrature_points_2[j]) <
-                    tol)
-                  {
-                    first_quad_map.emplace_back(i);
-                    second_quad_map.emplace_back(j);
-                    break;
-                  }
+              const unsigned int i = order_1[k1];
+              const unsigned int j = order_2[k2];
+              if (quadrature_points_1[i].distance(quadrature_points_2[j]) <
+                  tol)
+                {
+                  first_quad_map.emplace_back(i);
+                  second_quad_map.emplace_back(j);
+                  ++k1;
+                  ++k2;
+                }
+              else if (internal::FECouplingValuesImplementation::
+                         lexicographic_less(quadrature_points_1[i],
+                                            quadrature_points_2[j],
+                                            tol))
+                ++k1;
+              else
+                ++k2;
             }
+
+          // Restore the enumeration of the matched pairs by increasing index
+          // in the first point set, as produced by the former pairwise
+          // search.
+          {
+            std::vector<unsigned int> pair_order(first_quad_map.size());
+            std::iota(pair_order.begin(), pair_order.end(), 0U);
+            std::sort(pair_order.begin(),
+                      pair_order.end(),
+                      [&](const unsigned int a, const unsigned int b) {
+                        return first_quad_map[a] < first_quad_map[b];
+                      });
+            std::vector<unsigned int> sorted_first(first_quad_map.size());
+            std::vector<unsigned int> sorted_second(second_quad_map.size());
+            for (unsigned int k = 0; k < pair_order.size(); ++k)
+              {
+                sorted_first[k]  = first_quad_map[pair_order[k]];
+                sorted_second[k] = second_quad_map[pair_order[k]];
+              }
+            first_quad_map  = std::move(sorted_first);
+            second_quad_map = std::move(sorted_second);
+          }
+
           n_quadrature_points_ = first_quad_map.size();
 
           first_n_quadrature_points  = n_quadrature_points_;
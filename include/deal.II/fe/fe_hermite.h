@@ -216,41 +216,6 @@ public:
 
 
 
-protected:
-  /**
-   * Wrapper function for FE_Poly::get_data() that ensures relevant
-   * shape value data is copied to the new data object as well.
-   */
-  virtual std::unique_ptr<
-    typename FiniteElement<dim, spacedim>::InternalDataBase>
-  get_data(
-    const UpdateFlags             update_flags,
-    const Mapping<dim, spacedim> &mapping,
-    const Quadrature<dim>        &quadrature,
-    dealii::internal::FEValuesImplementation::FiniteElementRelatedData<dim,
-                                                                       spacedim>
-      &output_data) const override
-  {
-    std::unique_ptr<typename FiniteElement<dim, spacedim>::InternalDataBase>
-          data_ptr = FE_Poly<dim, spacedim>::get_data(update_flags,
-                                                  mapping,
-                                                  quadrature,
-                                                  output_data);
-    auto &data =
-      dynamic_cast<typename FE_Poly<dim, spacedim>::InternalData &>(*data_ptr);
-
-    const unsigned int n_q_points = quadrature.size();
-
-    if ((update_flags & update_values) &&
-        ((output_data.shape_values.n_rows() > 0) &&
-         (output_data.shape_values.n_cols() == n_q_points)))
-      data.shape_values = output_data.shape_values;
-
-    return data_ptr;
-  }
-
-
-
 private:
   /**
    * Variable storing the order of the highest derivative that the current
@@ -18,12 +18,15 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mutex.h>
 #include <deal.II/base/quadrature.h>
 #include <deal.II/base/scalar_polynomials_base.h>
 
 #include <deal.II/fe/fe.h>
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -269,106 +272,144 @@ protected:
   {
     (void)mapping;
 
+    const unsigned int n_q_points = quadrature.size();
+
+    // the tables of shape function values and derivatives on the unit cell
+    // only depend on the requested kinds of shape information and on the
+    // quadrature formula, so look them up in the cache of previously
+    // computed tables first. the typical situation in which this pays off
+    // is a WorkStream assembly loop, where every thread copies an FEValues
+    // object for the same element and quadrature: the threads then share
+    // one set of (potentially large) tables instead of recomputing and
+    // storing one copy each
+    const UpdateFlags table_flags =
+      update_flags & (update_values | update_gradients | update_hessians |
+                      update_3rd_derivatives);
+
+    std::shared_ptr<ShapeData> shape_data;
+    {
+      std::lock_guard<std::mutex> lock(shape_data_cache_mutex);
+      for (const auto &entry : shape_data_cache)
+        if (entry.first.first == table_flags &&
+            entry.first.second == quadrature)
+          {
+            // the cache only holds weak pointers, so the tables may have
+            // been destroyed in the meantime; in that case we simply
+            // recompute them below
+            shape_data = entry.second.lock();
+            break;
+          }
+    }
+    const bool shape_data_was_cached = (shape_data != nullptr);
+    if (shape_data_was_cached == false)
+      shape_data = std::make_shared<ShapeData>();
+
     // generate a new data object and
     // initialize some fields
     std::unique_ptr<typename FiniteElement<dim, spacedim>::InternalDataBase>
-          data_ptr   = std::make_unique<InternalData>();
+          data_ptr   = std::make_unique<InternalData>(shape_data);
     auto &data       = dynamic_cast<InternalData &>(*data_ptr);
     data.update_each = requires_update_flags(update_flags);
 
-    const unsigned int n_q_points = quadrature.size();
-
-    // initialize some scratch arrays. we need them for the underlying
-    // polynomial to put the values and derivatives of shape functions
-    // to put there, depending on what the user requested
-    std::vector<double> values(
-      update_flags & update_values ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<1, dim>> grads(
-      update_flags & update_gradients ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<2, dim>> grad_grads(
-      update_flags & update_hessians ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<3, dim>> third_derivatives(
-      update_flags & update_3rd_derivatives ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<4, dim>>
-      fourth_derivatives; // won't be needed, so leave empty
-
-    // now also initialize fields the fields of this class's own
-    // temporary storage, depending on what we need for the given
-    // update flags.
-    //
-    // there is one exception from the rule: if we are dealing with
-    // cells (i.e., if this function is not called via
-    // get_(sub)face_data()), then we can already store things in the
-    // final location where FEValues::reinit() later wants to see
-    // things. we then don't need the intermediate space. we determine
-    // whether we are on a cell by asking whether the number of
-    // elements in the output array equals the number of quadrature
-    // points (yes, it's a cell) or not (because in that case the
-    // number of quadrature points we use here equals the number of
-    // quadrature points summed over *all* faces or subfaces, whereas
-    // the number of output slots equals the number of quadrature
-    // points on only *one* face)
+    if (shape_data_was_cached == false)
+      {
+        // initialize some scratch arrays. we need them for the underlying
+        // polynomial to put the values and derivatives of shape functions
+        // to put there, depending on what the user requested
+        std::vector<double> values(
+          update_flags & update_values ? this->n_dofs_per_cell() : 0);
+        std::vector<Tensor<1, dim>> grads(
+          update_flags & update_gradients ? this->n_dofs_per_cell() : 0);
+        std::vector<Tensor<2, dim>> grad_grads(
+          update_flags & update_hessians ? this->n_dofs_per_cell() : 0);
+        std::vector<Tensor<3, dim>> third_derivatives(
+          update_flags & update_3rd_derivatives ? this->n_dofs_per_cell() : 0);
+        std::vector<Tensor<4, dim>>
+          fourth_derivatives; // won't be needed, so leave empty
+
+        // now also initialize the tables of this class's own storage,
+        // depending on what we need for the given update flags
+        if (update_flags & update_values)
+          data.shape_values.reinit(this->n_dofs_per_cell(), n_q_points);
+
+        if (update_flags & update_gradients)
+          data.shape_gradients.reinit(this->n_dofs_per_cell(), n_q_points);
+
+        if (update_flags & update_hessians)
+          data.shape_hessians.reinit(this->n_dofs_per_cell(), n_q_points);
+
+        if (update_flags & update_3rd_derivatives)
+          data.shape_3rd_derivatives.reinit(this->n_dofs_per_cell(),
+                                            n_q_points);
+
+        // next already fill those fields of which we have information by
+        // now. note that the shape gradients are only those on the unit
+        // cell, and need to be transformed when visiting an actual cell
+        if (update_flags & (update_values | update_gradients |
+                            update_hessians | update_3rd_derivatives))
+          for (unsigned int i = 0; i < n_q_points; ++i)
+            {
+              poly_space->evaluate(quadrature.point(i),
+                                   values,
+                                   grads,
+                                   grad_grads,
+                                   third_derivatives,
+                                   fourth_derivatives);
+
+              if (update_flags & update_values)
+                for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
+                  data.shape_values[k][i] = values[k];
+
+              // derivatives need to be transformed on each cell, so we
+              // write them into our scratch space and only later copy
+              // stuff into where FEValues wants it
+              if (update_flags & update_gradients)
+                for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
+                  data.shape_gradients[k][i] = grads[k];
+
+              if (update_flags & update_hessians)
+                for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
+                  data.shape_hessians[k][i] = grad_grads[k];
+
+              if (update_flags & update_3rd_derivatives)
+                for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
+                  data.shape_3rd_derivatives[k][i] = third_derivatives[k];
+            }
+
+        // publish the newly computed tables only now that they are
+        // complete; from this point on they must not be modified any more.
+        // if another thread computed the same tables concurrently, one of
+        // the two copies simply replaces the other in the cache
+        std::lock_guard<std::mutex> lock(shape_data_cache_mutex);
+        bool                        replaced_expired_entry = false;
+        for (auto &entry : shape_data_cache)
+          if (entry.second.expired())
+            {
+              entry.first.first      = table_flags;
+              entry.first.second     = quadrature;
+              entry.second           = shape_data;
+              replaced_expired_entry = true;
+              break;
+            }
+        if (replaced_expired_entry == false)
+          shape_data_cache.emplace_back(std::make_pair(table_flags,
+                                                       quadrature),
+                                        shape_data);
+      }
+
+    // the values of shape functions at quadrature points don't change.
+    // consequently, if this function is called for data on a cell (i.e.,
+    // not via get_(sub)face_data(), in which case the number of output
+    // slots equals the number of quadrature points on only one face),
+    // write these values right into the output array where
+    // FEValues::reinit() later wants to see them
     if ((update_flags & update_values) &&
-        !((output_data.shape_values.n_rows() > 0) &&
-          (output_data.shape_values.n_cols() == n_q_points)))
-      data.shape_values.reinit(this->n_dofs_per_cell(), n_q_points);
-
-    if (update_flags & update_gradients)
-      data.shape_gradients.reinit(this->n_dofs_per_cell(), n_q_points);
-
-    if (update_flags & update_hessians)
-      data.shape_hessians.reinit(this->n_dofs_per_cell(), n_q_points);
-
-    if (update_flags & update_3rd_derivatives)
-      data.shape_3rd_derivatives.reinit(this->n_dofs_per_cell(), n_q_points);
-
-    // next already fill those fields of which we have information by
-    // now. note that the shape gradients are only those on the unit
-    // cell, and need to be transformed when visiting an actual cell
-    if (update_flags & (update_values | update_gradients | update_hessians |
-                        update_3rd_derivatives))
-      for (unsigned int i = 0; i < n_q_points; ++i)
-        {
-          poly_space->evaluate(quadrature.point(i),
-                               values,
-                               grads,
-                               grad_grads,
-                               third_derivatives,
-                               fourth_derivatives);
-
-          // the values of shape functions at quadrature points don't change.
-          // consequently, write these values right into the output array if
-          // we can, i.e., if the output array has the correct size. this is
-          // the case on cells. on faces, we already precompute data on *all*
-          // faces and subfaces, but we later on copy only a portion of it
-          // into the output object; in that case, copy the data from all
-          // faces into the scratch object
-          if (update_flags & update_values)
-            if (output_data.shape_values.n_rows() > 0)
-              {
-                if (output_data.shape_values.n_cols() == n_q_points)
-                  for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-                    output_data.shape_values[k][i] = values[k];
-                else
-                  for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-                    data.shape_values[k][i] = values[k];
-              }
-
-          // for everything else, derivatives need to be transformed,
-          // so we write them into our scratch space and only later
-          // copy stuff into where FEValues wants it
-          if (update_flags & update_gradients)
-            for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-              data.shape_gradients[k][i] = grads[k];
-
-          if (update_flags & update_hessians)
-            for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-              data.shape_hessians[k][i] = grad_grads[k];
-
-          if (update_flags & update_3rd_derivatives)
-            for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-              data.shape_3rd_derivatives[k][i] = third_derivatives[k];
-        }
+        (output_data.shape_values.n_rows() > 0) &&
+        (output_data.shape_values.n_cols() == n_q_points))
+      for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
+        for (unsigned int i = 0; i < n_q_points; ++i)
+          output_data.shape_values[k][i] = data.shape_values[k][i];
+
     return data_ptr;
   }
 
@@ -418,12 +459,20 @@ protected:
       &output_data) const override;
 
   /**
-   * Fields of cell-independent data.
+   * A bundle of the tables of shape function values and derivatives in the
+   * quadrature points on the unit cell. Since these tables do not depend on
+   * the cell that is visited, they are computed only once in get_data() and
+   * are then shared, via std::shared_ptr, among all InternalData objects
+   * created for the same combination of update flags and quadrature formula.
+   * In particular, the FEValues objects held by the different threads of a
+   * WorkStream loop all reference a single copy of these tables instead of
+   * each storing their own.
    *
-   * For information about the general purpose of this class, see the
-   * documentation of the base class.
+   * Objects of this type must not be modified any more once they have been
+   * put into the cache in get_data(), since other threads may be reading
+   * them concurrently.
    */
-  class InternalData : public FiniteElement<dim, spacedim>::InternalDataBase
+  class ShapeData
   {
   public:
     /**
@@ -471,6 +520,59 @@ protected:
     Table<2, Tensor<3, dim>> shape_3rd_derivatives;
   };
 
+  /**
+   * Fields of cell-independent data.
+   *
+   * For information about the general purpose of this class, see the
+   * documentation of the base class. The shape function tables themselves
+   * live in a ShapeData bundle that may be shared with the InternalData
+   * objects of other FEValues objects, see there; the reference members of
+   * the current class only provide convenient access to the tables of that
+   * bundle.
+   */
+  class InternalData : public FiniteElement<dim, spacedim>::InternalDataBase
+  {
+  public:
+    /**
+     * Constructor. Take (shared) ownership of the given shape function
+     * table bundle and bind the reference members to its tables.
+     */
+    InternalData(const std::shared_ptr<ShapeData> &shape_data)
+      : shape_data(shape_data)
+      , shape_values(shape_data->shape_values)
+      , shape_gradients(shape_data->shape_gradients)
+      , shape_hessians(shape_data->shape_hessians)
+      , shape_3rd_derivatives(shape_data->shape_3rd_derivatives)
+    {}
+
+    /**
+     * The bundle of shape function tables, possibly shared with the
+     * InternalData objects of other FEValues objects that use the same
+     * element, update flags, and quadrature formula.
+     */
+    const std::shared_ptr<ShapeData> shape_data;
+
+    /**
+     * Reference to ShapeData::shape_values of #shape_data.
+     */
+    Table<2, double> &shape_values;
+
+    /**
+     * Reference to ShapeData::shape_gradients of #shape_data.
+     */
+    Table<2, Tensor<1, dim>> &shape_gradients;
+
+    /**
+     * Reference to ShapeData::shape_hessians of #shape_data.
+     */
+    Table<2, Tensor<2, dim>> &shape_hessians;
+
+    /**
+     * Reference to ShapeData::shape_3rd_derivatives of #shape_data.
+     */
+    Table<2, Tensor<3, dim>> &shape_3rd_derivatives;
+  };
+
   /**
    * Correct the shape Hessians by subtracting the terms corresponding to the
    * Jacobian pushed forward gradient.
@@ -530,6 +632,28 @@ protected:
    * The polynomial space.
    */
   const std::unique_ptr<ScalarPolynomialsBase<dim>> poly_space;
+
+private:
+  /**
+   * A cache for the ShapeData bundles created by get_data(), keyed by the
+   * subset of the update flags that determines which tables are filled and
+   * by the quadrature formula. The cache stores weak pointers so that the
+   * tables are freed as soon as the last InternalData object referencing
+   * them goes away; expired entries are recycled by get_data().
+   *
+   * Since the cache does not participate in the observable state of the
+   * element, it is mutable and deliberately not copied along with the
+   * element itself.
+   */
+  mutable std::vector<
+    std::pair<std::pair<UpdateFlags, Quadrature<dim>>, std::weak_ptr<ShapeData>>>
+    shape_data_cache;
+
+  /**
+   * A mutex guarding #shape_data_cache, since FEValues objects referencing
+   * the same element may be set up concurrently on different threads.
+   */
+  mutable Threads::Mutex shape_data_cache_mutex;
 };
 
 /** @} */
@@ -125,6 +125,27 @@ namespace FESeries
               const unsigned int            cell_active_fe_index,
               Table<dim, CoefficientType>  &fourier_coefficients);
 
+    /**
+     * Calculate the Fourier coefficients for a whole batch of cells at once.
+     * All fields must belong to the FiniteElement with
+     * @p cell_active_fe_index; entry @p b of @p fourier_coefficients
+     * receives the coefficients of the field given by entry @p b of
+     * @p local_dof_values. Instead of one matrix-vector product per cell,
+     * the transformation of the whole batch is performed as a single
+     * matrix-matrix product, which makes much better use of caches.
+     *
+     * In contrast to the single-cell calculate(), this function does not
+     * modify any scratch data of the object and may therefore be called
+     * concurrently from several threads, provided the transformation
+     * matrices have been set up beforehand by calling
+     * precalculate_all_transformation_matrices().
+     */
+    template <typename Number>
+    void
+    calculate(const std::vector<dealii::Vector<Number>> &local_dof_values,
+              const unsigned int                         cell_active_fe_index,
+              std::vector<Table<dim, CoefficientType>>  &fourier_coefficients);
+
     /**
      * Return the number of coefficients in each coordinate direction for the
      * finite element associated with @p index in the provided hp::FECollection.
@@ -295,6 +316,27 @@ namespace FESeries
               const unsigned int            cell_active_fe_index,
               Table<dim, CoefficientType>  &legendre_coefficients);
 
+    /**
+     * Calculate the Legendre coefficients for a whole batch of cells at
+     * once. All fields must belong to the FiniteElement with
+     * @p cell_active_fe_index; entry @p b of @p legendre_coefficients
+     * receives the coefficients of the field given by entry @p b of
+     * @p local_dof_values. Instead of one matrix-vector product per cell,
+     * the transformation of the whole batch is performed as a single
+     * matrix-matrix product, which makes much better use of caches.
+     *
+     * In contrast to the single-cell calculate(), this function does not
+     * modify any scratch data of the object and may therefore be called
+     * concurrently from several threads, provided the transformation
+     * matrices have been set up beforehand by calling
+     * precalculate_all_transformation_matrices().
+     */
+    template <typename Number>
+    void
+    calculate(const std::vector<dealii::Vector<Number>> &local_dof_values,
+              const unsigned int                         cell_active_fe_index,
+              std::vector<Table<dim, CoefficientType>>  &legendre_coefficients);
+
     /**
      * Return the number of coefficients in each coordinate direction for the
      * finite element associated with @p index in the provided hp::FECollection.
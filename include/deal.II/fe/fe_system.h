@@ -855,6 +855,32 @@ public:
     const RefinementCase<dim> &refinement_case =
       RefinementCase<dim>::isotropic_refinement) const override;
 
+  /**
+   * Return the matrix that describes the constraints at the interface
+   * between a refined and an unrefined cell. Overrides the respective
+   * method in FiniteElement, implementing lazy evaluation (initialize
+   * when requested): composing the interface constraint matrices of the
+   * base elements is expensive for systems with many components or high
+   * polynomial degrees, so the matrix is only built on first access. This
+   * keeps the construction of large hp::FECollection objects cheap for
+   * those elements whose constraints are never queried.
+   */
+  virtual const FullMatrix<double> &
+  constraints(const internal::SubfaceCase<dim> &subface_case =
+                internal::SubfaceCase<dim>::case_isotropic) const override;
+
+  /**
+   * Return whether this element implements its hanging node constraints,
+   * which is the case if and only if all base elements do. In contrast to
+   * the base class implementation, this function does not inspect the
+   * constraint matrix itself -- which is only computed upon first use --
+   * and can therefore be called without triggering its construction.
+   */
+  virtual bool
+  constraints_are_implemented(
+    const internal::SubfaceCase<dim> &subface_case =
+      internal::SubfaceCase<dim>::case_isotropic) const override;
+
   /**
    * Given an index in the natural ordering of indices on a face, return the
    * index of the same degree of freedom on the cell.
@@ -1236,7 +1262,9 @@ private:
              const std::vector<unsigned int> &multiplicities);
 
   /**
-   * Used by @p initialize.
+   * Compose the interface constraint matrix from the constraint matrices
+   * of the base elements. Called upon first access to the constraints()
+   * function.
    */
   void
   build_interface_constraints();
@@ -1325,11 +1353,12 @@ private:
   };
 
   /**
-   * Mutex variables used for protecting the initialization of restriction
-   * and embedding matrices.
+   * Mutex variables used for protecting the initialization of restriction,
+   * embedding and interface constraint matrices.
    */
   mutable std::mutex restriction_matrix_mutex;
   mutable std::mutex prolongation_matrix_mutex;
+  mutable std::mutex interface_constraints_mutex;
 
   friend class FE_Enriched<dim, spacedim>;
 };
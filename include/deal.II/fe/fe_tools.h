@@ -648,6 +648,15 @@ namespace FETools
    *
    * @note There are also various interpolation-related functions in
    *   namespace VectorTools.
+   *
+   * @note For pairs of scalar elements with tensor-product structure whose
+   *   degrees of freedom are point evaluations on a tensor product of 1d
+   *   points, such as FE_Q and FE_DGQ, the cell-local interpolation into the
+   *   equal or richer space is applied by sum factorization rather than by a
+   *   dense matrix, which considerably reduces the cost at higher polynomial
+   *   degrees. If the same transfer between two fixed spaces is applied in
+   *   every step of a time loop, also consider setting up a
+   *   MGTwoLevelTransfer object once and reusing it.
    */
   template <int dim, int spacedim, class InVector, class OutVector>
   void
@@ -18,9 +18,12 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/index_set.h>
+#include <deal.II/base/numbers.h>
 #include <deal.II/base/qprojector.h>
 #include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/utilities.h>
 
 #include <deal.II/dofs/dof_accessor.h>
 #include <deal.II/dofs/dof_handler.h>
@@ -46,6 +49,9 @@
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector.h>
 
+#include <deal.II/matrix_free/evaluation_kernels.h>
+#include <deal.II/matrix_free/shape_info.h>
+
 #include <iostream>
 #include <memory>
 
@@ -54,6 +60,179 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace FETools
 {
+  namespace internal
+  {
+    /**
+     * A helper class for interpolate() that detects whether the local
+     * interpolation between a pair of scalar elements has tensor-product
+     * structure and, if so, tabulates the univariate interpolation matrix
+     * from the basis of the first element to the unit support points of the
+     * second element. The cell-local interpolation can then be applied by
+     * sum factorization at a cost of $\mathcal O(d\,k^{d+1})$ per cell with
+     * $k$ points per direction, rather than the $\mathcal O(k^{2d})$ of the
+     * dense interpolation matrix.
+     */
+    template <int dim, int spacedim, typename Number>
+    struct TensorProductEmbedding
+    {
+      /**
+       * The matrix entries are real-valued also for complex-valued vectors.
+       */
+      using Number2 = typename numbers::NumberTraits<Number>::real_type;
+
+      /**
+       * Whether reinit() has been called for this object.
+       */
+      bool initialized = false;
+
+      /**
+       * Whether the element pair given to reinit() is covered by the
+       * sum-factorized path. If false, the caller needs to fall back to the
+       * dense interpolation matrix.
+       */
+      bool active = false;
+
+      /**
+       * The number of basis functions per direction of the two elements.
+       */
+      unsigned int n_dofs_1d_in  = 0;
+      unsigned int n_dofs_1d_out = 0;
+
+      /**
+       * The univariate basis of the source element tabulated at the
+       * univariate support points of the target element, with the points
+       * running fastest as expected by
+       * internal::FEEvaluationImplBasisChange::do_forward().
+       */
+      AlignedVector<Number2> interpolation_1d;
+
+      /**
+       * The renumbering from lexicographic to the deal.II ordering of cell
+       * degrees of freedom for the two elements.
+       */
+      std::vector<unsigned int> lexicographic_in;
+      std::vector<unsigned int> lexicographic_out;
+
+      /**
+       * Set up the plan for interpolation from @p fe_in to @p fe_out. The
+       * sum-factorized path covers scalar elements whose degrees of freedom
+       * are point evaluations on a tensor product of a single set of 1d
+       * points (such as FE_Q and FE_DGQ), interpolated from an element with
+       * tensor-product basis of at most the same univariate size, i.e.,
+       * embeddings into nested equal-or-richer spaces. All other pairs,
+       * including degree-reducing interpolations, leave the object inactive.
+       */
+      void
+      reinit(const FiniteElement<dim, spacedim> &fe_in,
+             const FiniteElement<dim, spacedim> &fe_out)
+      {
+        initialized = true;
+        active      = false;
+
+        if (fe_in.n_components() != 1 || fe_out.n_components() != 1)
+          return;
+        if (fe_out.has_support_points() == false)
+          return;
+
+        using ShapeInfo =
+          ::dealii::internal::MatrixFreeFunctions::ShapeInfo<double>;
+        if (ShapeInfo::is_supported(fe_in) == false ||
+            ShapeInfo::is_supported(fe_out) == false)
+          return;
+
+        const ShapeInfo shape_info_out(QGauss<1>(fe_out.degree + 1), fe_out);
+        n_dofs_1d_out = shape_info_out.data.front().fe_degree + 1;
+
+        // exclude bases that are not full tensor products, e.g. the
+        // truncated tensor products of FE_DGP
+        if (Utilities::pow(n_dofs_1d_out, dim) != fe_out.n_dofs_per_cell())
+          return;
+
+        // extract the candidate 1d abscissae from the first lexicographic
+        // row of support points and verify that all support points are
+        // indeed the tensor product of these abscissae
+        const std::vector<Point<dim>> &points =
+          fe_out.get_unit_support_points();
+        AssertDimension(points.size(), fe_out.n_dofs_per_cell());
+        std::vector<Point<1>> points_1d(n_dofs_1d_out);
+        for (unsigned int i = 0; i < n_dofs_1d_out; ++i)
+          points_1d[i][0] =
+            points[shape_info_out.lexicographic_numbering[i]][0];
+        for (unsigned int i = 0; i < points.size(); ++i)
+          {
+            const Point<dim> &p =
+              points[shape_info_out.lexicographic_numbering[i]];
+            for (unsigned int d = 0, j = i; d < dim; ++d, j /= n_dofs_1d_out)
+              if (std::abs(p[d] - points_1d[j % n_dofs_1d_out][0]) > 1e-12)
+                return;
+          }
+
+        // tabulate the univariate basis of fe_in at the support points of
+        // fe_out; ShapeInfo stores the result with the evaluation points
+        // running fastest, which is the layout do_forward() expects
+        const ShapeInfo shape_info_in(Quadrature<1>(points_1d), fe_in);
+        n_dofs_1d_in = shape_info_in.data.front().fe_degree + 1;
+        if (Utilities::pow(n_dofs_1d_in, dim) != fe_in.n_dofs_per_cell())
+          return;
+
+        // do_forward() requires the second basis to be at least as large as
+        // the first one, which is the case exactly for embeddings
+        if (n_dofs_1d_in > n_dofs_1d_out)
+          return;
+
+        lexicographic_in  = shape_info_in.lexicographic_numbering;
+        lexicographic_out = shape_info_out.lexicographic_numbering;
+        const AlignedVector<double> &shape_values =
+          shape_info_in.data.front().shape_values;
+        AssertDimension(shape_values.size(), n_dofs_1d_in * n_dofs_1d_out);
+        interpolation_1d.resize(shape_values.size());
+        for (unsigned int i = 0; i < shape_values.size(); ++i)
+          interpolation_1d[i] = static_cast<Number2>(shape_values[i]);
+
+        active = true;
+      }
+
+      /**
+       * Apply the plan to a vector of cell-local values of the source
+       * element, writing the cell-local values of the target element. The
+       * two scratch arrays avoid allocations when the function is called in
+       * a loop over cells.
+       */
+      void
+      apply(const Vector<Number>  &u_in,
+            Vector<Number>        &u_out,
+            AlignedVector<Number> &scratch_in,
+            AlignedVector<Number> &scratch_out) const
+      {
+        Assert(active, ExcInternalError());
+        AssertDimension(u_in.size(), lexicographic_in.size());
+        AssertDimension(u_out.size(), lexicographic_out.size());
+
+        scratch_in.resize_fast(u_in.size());
+        scratch_out.resize_fast(u_out.size());
+        for (unsigned int i = 0; i < u_in.size(); ++i)
+          scratch_in[i] = u_in(lexicographic_in[i]);
+
+        ::dealii::internal::FEEvaluationImplBasisChange<
+          ::dealii::internal::evaluate_general,
+          ::dealii::internal::EvaluatorQuantity::value,
+          dim,
+          0,
+          0>::do_forward(1,
+                         interpolation_1d,
+                         scratch_in.data(),
+                         scratch_out.data(),
+                         n_dofs_1d_in,
+                         n_dofs_1d_out);
+
+        for (unsigned int i = 0; i < u_out.size(); ++i)
+          u_out(lexicographic_out[i]) = scratch_out[i];
+      }
+    };
+  } // namespace internal
+
+
+
   template <int dim, int spacedim, class InVector, class OutVector>
   void
   interpolate(const DoFHandler<dim, spacedim> &dof1,
@@ -117,6 +296,19 @@ namespace FETools
                       std::unique_ptr<FullMatrix<double>>>>
       interpolation_matrices;
 
+    // for pairs of tensor-product elements, apply the cell-local
+    // interpolation by sum factorization instead of the dense matrix; the
+    // plans are likewise cached per pair of elements
+    std::map<const FiniteElement<dim, spacedim> *,
+             std::map<const FiniteElement<dim, spacedim> *,
+                      internal::TensorProductEmbedding<
+                        dim,
+                        spacedim,
+                        typename OutVector::value_type>>>
+      tensor_product_plans;
+    AlignedVector<typename OutVector::value_type> scratch_in;
+    AlignedVector<typename OutVector::value_type> scratch_out;
+
     typename DoFHandler<dim, spacedim>::active_cell_iterator
       cell1 = dof1.begin_active(),
       endc1 = dof1.end();
@@ -168,28 +360,38 @@ namespace FETools
           u1_local.reinit(dofs_per_cell1);
           u2_local.reinit(dofs_per_cell2);
 
-          // check if interpolation
-          // matrix for this particular
-          // pair of elements is already
-          // there
-          if (interpolation_matrices[&cell1->get_fe()][&cell2->get_fe()]
-                .get() == nullptr)
+          // check if the interpolation plan for this particular pair of
+          // elements is already there
+          auto &plan =
+            tensor_product_plans[&cell1->get_fe()][&cell2->get_fe()];
+          if (plan.initialized == false)
+            plan.reinit(cell1->get_fe(), cell2->get_fe());
+
+          cell1->get_dof_values(u1, u1_local);
+          if (plan.active)
+            plan.apply(u1_local, u2_local, scratch_in, scratch_out);
+          else
             {
-              auto interpolation_matrix =
-                std::make_unique<FullMatrix<double>>(dofs_per_cell2,
-                                                     dofs_per_cell1);
+              // fall back to the dense interpolation matrix, which is
+              // likewise built only once per pair of elements
+              if (interpolation_matrices[&cell1->get_fe()][&cell2->get_fe()]
+                    .get() == nullptr)
+                {
+                  auto interpolation_matrix =
+                    std::make_unique<FullMatrix<double>>(dofs_per_cell2,
+                                                         dofs_per_cell1);
 
-              get_interpolation_matrix(cell1->get_fe(),
-                                       cell2->get_fe(),
-                                       *interpolation_matrix);
+                  get_interpolation_matrix(cell1->get_fe(),
+                                           cell2->get_fe(),
+                                           *interpolation_matrix);
 
-              interpolation_matrices[&cell1->get_fe()][&cell2->get_fe()] =
-                std::move(interpolation_matrix);
-            }
+                  interpolation_matrices[&cell1->get_fe()][&cell2->get_fe()] =
+                    std::move(interpolation_matrix);
+                }
 
-          cell1->get_dof_values(u1, u1_local);
-          interpolation_matrices[&cell1->get_fe()][&cell2->get_fe()]->vmult(
-            u2_local, u1_local);
+              interpolation_matrices[&cell1->get_fe()][&cell2->get_fe()]
+                ->vmult(u2_local, u1_local);
+            }
 
           dofs.resize(dofs_per_cell2);
           cell2->get_dof_indices(dofs);
@@ -0,0 +1,374 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_fe_values_batch_h
+#define dealii_fe_values_batch_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/std_cxx20/iota_view.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe_values.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A class that evaluates shape functions and mapping data on a batch of
+ * VectorizedArray<double>::size() cells at once and exposes the result in a
+ * SIMD-friendly struct-of-arrays layout.
+ *
+ * Classical assembly loops built on FEValues process one cell at a time,
+ * which leaves the innermost loops over shape functions and quadrature
+ * points with scalar arithmetic. MatrixFree avoids this by vectorizing
+ * across cells, but porting existing assembly code to the matrix-free
+ * framework is often not feasible. This class provides a middle ground: it
+ * holds one FEValues object per SIMD lane, calls FEValues::reinit() on each
+ * cell of a batch, and transposes the per-cell data into
+ * VectorizedArray-valued tables. A conventional cell loop can then be
+ * rewritten to advance in steps of n_lanes cells and perform the local
+ * integration with SIMD arithmetic:
+ * @code
+ * FEValuesBatch<dim> fe_values_batch(mapping, fe, quadrature,
+ *                                    update_gradients | update_JxW_values);
+ * std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+ * for (const auto &cell : dof_handler.active_cell_iterators())
+ *   {
+ *     cells.push_back(cell);
+ *     if (cells.size() == fe_values_batch.n_lanes)
+ *       {
+ *         fe_values_batch.reinit(cells);
+ *         for (const unsigned int i : fe_values_batch.dof_indices())
+ *           for (const unsigned int j : fe_values_batch.dof_indices())
+ *             {
+ *               VectorizedArray<double> sum = 0.;
+ *               for (unsigned int q = 0;
+ *                    q < fe_values_batch.n_quadrature_points; ++q)
+ *                 sum += fe_values_batch.shape_grad(i, q) *
+ *                        fe_values_batch.shape_grad(j, q) *
+ *                        fe_values_batch.JxW(q);
+ *               // scatter sum[v] into the local matrix of cell v ...
+ *             }
+ *         cells.clear();
+ *       }
+ *   }
+ * @endcode
+ * An incomplete batch at the end of the loop is handled by passing fewer
+ * than n_lanes cells to reinit(); the unused lanes are padded with a copy of
+ * the last cell and n_filled_lanes() reports how many lanes carry real data.
+ *
+ * The per-lane FEValues objects remain accessible through get_lane() for
+ * operations that have no batched equivalent, such as retrieving the DoF
+ * indices of the individual cells when distributing local contributions.
+ *
+ * In contrast to the matrix-free framework, no tensor-product structure of
+ * the finite element is exploited here, so every element and mapping that
+ * works with FEValues works with this class; the speed-up comes entirely
+ * from the vectorization of the user's local integration loops.
+ */
+template <int dim, int spacedim = dim>
+class FEValuesBatch
+{
+public:
+  /**
+   * The vectorized data type in which the batched data is returned.
+   */
+  using VectorizedArrayType = VectorizedArray<double>;
+
+  /**
+   * The number of cells processed together in one batch.
+   */
+  static constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  /**
+   * Number of quadrature points of the quadrature formula passed to the
+   * constructor.
+   */
+  const unsigned int n_quadrature_points;
+
+  /**
+   * Number of shape functions per cell.
+   */
+  const unsigned int dofs_per_cell;
+
+  /**
+   * Constructor. Gets cell independent data from mapping and finite element
+   * objects, matching the quadrature rule and update flags, just like the
+   * corresponding FEValues constructor.
+   */
+  FEValuesBatch(const Mapping<dim, spacedim>       &mapping,
+                const FiniteElement<dim, spacedim> &fe,
+                const Quadrature<dim>              &quadrature,
+                const UpdateFlags                   update_flags);
+
+  /**
+   * Constructor. This constructor is equivalent to the other one except that
+   * it makes the object use a $Q_1$ mapping (i.e., an object of type
+   * MappingQ(1)) implicitly.
+   */
+  FEValuesBatch(const FiniteElement<dim, spacedim> &fe,
+                const Quadrature<dim>              &quadrature,
+                const UpdateFlags                   update_flags);
+
+  /**
+   * Reinitialize the object for the given batch of cells. Between one and
+   * n_lanes cells may be passed; remaining lanes are filled with a copy of
+   * the last given cell so that all lanes always contain valid data. The
+   * cell iterators may be of any type accepted by FEValues::reinit().
+   */
+  template <typename CellIteratorType>
+  void
+  reinit(const std::vector<CellIteratorType> &cells);
+
+  /**
+   * Return the number of lanes that correspond to distinct cells of the
+   * batch most recently passed to reinit().
+   */
+  unsigned int
+  n_filled_lanes() const;
+
+  /**
+   * Return the values of the shape function with index @p i at the
+   * quadrature point with index @p q on all cells of the batch.
+   */
+  VectorizedArrayType
+  shape_value(const unsigned int i, const unsigned int q) const;
+
+  /**
+   * Return the gradients of the shape function with index @p i at the
+   * quadrature point with index @p q on all cells of the batch.
+   */
+  Tensor<1, spacedim, VectorizedArrayType>
+  shape_grad(const unsigned int i, const unsigned int q) const;
+
+  /**
+   * Return the mapped quadrature weight at the quadrature point with index
+   * @p q on all cells of the batch.
+   */
+  VectorizedArrayType
+  JxW(const unsigned int q) const;
+
+  /**
+   * Return the position of the quadrature point with index @p q in real
+   * space on all cells of the batch.
+   */
+  Point<spacedim, VectorizedArrayType>
+  quadrature_point(const unsigned int q) const;
+
+  /**
+   * Return the FEValues object associated with the lane with index @p lane,
+   * reinitialized on the respective cell of the current batch. This gives
+   * access to all per-cell information that is not available in batched
+   * form.
+   */
+  const FEValues<dim, spacedim> &
+  get_lane(const unsigned int lane) const;
+
+  /**
+   * Return an object that can be thought of as an array containing all
+   * indices from zero to dofs_per_cell, for use in range-based for loops
+   * in the same way as FEValuesBase::dof_indices().
+   */
+  std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+  dof_indices() const;
+
+  /**
+   * Return an object that can be thought of as an array containing all
+   * indices from zero to n_quadrature_points, for use in range-based for
+   * loops in the same way as FEValuesBase::quadrature_point_indices().
+   */
+  std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+  quadrature_point_indices() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Transpose the data of the per-lane FEValues objects into the batched
+   * tables, according to the update flags passed to the constructor.
+   */
+  void
+  fill_batched_tables();
+
+  /**
+   * One FEValues object per SIMD lane.
+   */
+  std::vector<std::unique_ptr<FEValues<dim, spacedim>>> fe_values;
+
+  /**
+   * The number of lanes of the current batch that refer to distinct cells.
+   */
+  unsigned int n_filled_lanes_of_batch;
+
+  /**
+   * Shape values on the current batch, indexed by shape function and
+   * quadrature point.
+   */
+  Table<2, VectorizedArrayType> batched_shape_values;
+
+  /**
+   * Shape gradients on the current batch, indexed by shape function and
+   * quadrature point.
+   */
+  Table<2, Tensor<1, spacedim, VectorizedArrayType>> batched_shape_gradients;
+
+  /**
+   * Mapped quadrature weights on the current batch.
+   */
+  AlignedVector<VectorizedArrayType> batched_JxW_values;
+
+  /**
+   * Quadrature points in real space on the current batch.
+   */
+  AlignedVector<Point<spacedim, VectorizedArrayType>>
+    batched_quadrature_points;
+};
+
+
+#ifndef DOXYGEN
+
+/*---------------------- Inline functions -----------------------------------*/
+
+template <int dim, int spacedim>
+template <typename CellIteratorType>
+inline void
+FEValuesBatch<dim, spacedim>::reinit(
+  const std::vector<CellIteratorType> &cells)
+{
+  Assert(cells.size() > 0 && cells.size() <= n_lanes,
+         ExcIndexRange(cells.size(), 1, n_lanes + 1));
+
+  n_filled_lanes_of_batch = cells.size();
+
+  // pad incomplete batches with the last cell, which guarantees that all
+  // lanes hold valid data and allows filling the tables without special
+  // cases
+  for (unsigned int v = 0; v < n_lanes; ++v)
+    fe_values[v]->reinit(cells[std::min<std::size_t>(v, cells.size() - 1)]);
+
+  fill_batched_tables();
+}
+
+
+
+template <int dim, int spacedim>
+inline unsigned int
+FEValuesBatch<dim, spacedim>::n_filled_lanes() const
+{
+  return n_filled_lanes_of_batch;
+}
+
+
+
+template <int dim, int spacedim>
+inline typename FEValuesBatch<dim, spacedim>::VectorizedArrayType
+FEValuesBatch<dim, spacedim>::shape_value(const unsigned int i,
+                                          const unsigned int q) const
+{
+  AssertIndexRange(i, dofs_per_cell);
+  AssertIndexRange(q, n_quadrature_points);
+  Assert(batched_shape_values.n_rows() > 0,
+         (typename FEValuesBase<dim, spacedim>::ExcAccessToUninitializedField(
+           "update_values")));
+  return batched_shape_values(i, q);
+}
+
+
+
+template <int dim, int spacedim>
+inline Tensor<1,
+              spacedim,
+              typename FEValuesBatch<dim, spacedim>::VectorizedArrayType>
+FEValuesBatch<dim, spacedim>::shape_grad(const unsigned int i,
+                                         const unsigned int q) const
+{
+  AssertIndexRange(i, dofs_per_cell);
+  AssertIndexRange(q, n_quadrature_points);
+  Assert(batched_shape_gradients.n_rows() > 0,
+         (typename FEValuesBase<dim, spacedim>::ExcAccessToUninitializedField(
+           "update_gradients")));
+  return batched_shape_gradients(i, q);
+}
+
+
+
+template <int dim, int spacedim>
+inline typename FEValuesBatch<dim, spacedim>::VectorizedArrayType
+FEValuesBatch<dim, spacedim>::JxW(const unsigned int q) const
+{
+  AssertIndexRange(q, n_quadrature_points);
+  Assert(batched_JxW_values.size() > 0,
+         (typename FEValuesBase<dim, spacedim>::ExcAccessToUninitializedField(
+           "update_JxW_values")));
+  return batched_JxW_values[q];
+}
+
+
+
+template <int dim, int spacedim>
+inline Point<spacedim,
+             typename FEValuesBatch<dim, spacedim>::VectorizedArrayType>
+FEValuesBatch<dim, spacedim>::quadrature_point(const unsigned int q) const
+{
+  AssertIndexRange(q, n_quadrature_points);
+  Assert(batched_quadrature_points.size() > 0,
+         (typename FEValuesBase<dim, spacedim>::ExcAccessToUninitializedField(
+           "update_quadrature_points")));
+  return batched_quadrature_points[q];
+}
+
+
+
+template <int dim, int spacedim>
+inline const FEValues<dim, spacedim> &
+FEValuesBatch<dim, spacedim>::get_lane(const unsigned int lane) const
+{
+  AssertIndexRange(lane, n_lanes);
+  return *fe_values[lane];
+}
+
+
+
+template <int dim, int spacedim>
+inline std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+FEValuesBatch<dim, spacedim>::dof_indices() const
+{
+  return {0U, dofs_per_cell};
+}
+
+
+
+template <int dim, int spacedim>
+inline std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+FEValuesBatch<dim, spacedim>::quadrature_point_indices() const
+{
+  return {0U, n_quadrature_points};
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
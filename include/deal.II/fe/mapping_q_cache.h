@@ -191,6 +191,31 @@ public:
              const MGLevelObject<VectorType> &vectors,
              const bool vector_describes_relative_displacement);
 
+  /**
+   * Recompute the cached support points of the cells in the half-open range
+   * `[begin, end)` by calling the given function on each of these cells, in
+   * the same way as the initialize() function taking a
+   * @p compute_points_on_cell argument does for the whole triangulation. The
+   * cache entries of all other cells remain untouched. This is useful when
+   * only a small part of the mesh is deformed in every step, e.g., near a
+   * moving boundary, and recomputing the support points of all cells on
+   * every step would dominate the run time: the cost of this function is
+   * proportional to the number of cells in the given range.
+   *
+   * This function requires that initialize() has been called before and that
+   * the triangulation has not changed in the meantime; it is the caller's
+   * responsibility to pass a range that covers all cells whose geometry has
+   * changed. If multiple threads are enabled, the function passed in is
+   * invoked from several threads in parallel, with the same requirements as
+   * for initialize().
+   */
+  void
+  update(const typename Triangulation<dim, spacedim>::cell_iterator &begin,
+         const typename Triangulation<dim, spacedim>::cell_iterator &end,
+         const std::function<std::vector<Point<spacedim>>(
+           const typename Triangulation<dim, spacedim>::cell_iterator &)>
+           &compute_points_on_cell);
+
   /**
    * @copydoc Mapping::get_vertices()
    */
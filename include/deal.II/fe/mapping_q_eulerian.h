@@ -89,6 +89,15 @@ class Vector;
  * To enable the use of the MappingQEulerian class also in the context of
  * parallel codes using the PETSc or Trilinos wrapper classes, the type
  * of the vector can be specified as template parameter <tt>VectorType</tt>.
+ *
+ * @note This class evaluates the displacement field anew on every cell
+ * visit. If the mapping is queried repeatedly between updates of the
+ * displacement field — e.g., by assembly, output, and point searches within
+ * the same time step — it is usually more efficient to evaluate the
+ * deformation only once per step into a MappingQCache via
+ * MappingQCache::initialize() with the displacement vector and
+ * `vector_describes_relative_displacement = true`, and to pass the cache
+ * object to all consumers instead.
  */
 template <int dim, typename VectorType = Vector<double>, int spacedim = dim>
 class MappingQEulerian : public MappingQ<dim, spacedim>
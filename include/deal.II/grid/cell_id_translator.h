@@ -23,6 +23,8 @@
 
 #include <cstdint>
 #include <limits>
+#include <unordered_map>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -84,6 +86,14 @@ namespace internal
     translate(const TriaIterator<Accessor>  &cell,
               const types::global_cell_index i) const;
 
+    /**
+     * Convert a @p cell_id to an index. The result is identical to calling
+     * the iterator version of translate() for the cell the CellId refers to,
+     * but does not require access to a Triangulation object.
+     */
+    types::global_cell_index
+    translate(const CellId &cell_id) const;
+
     /**
      * Convert an index to a CellId.
      */
@@ -218,6 +228,28 @@ namespace internal
 
 
 
+  template <int dim>
+  types::global_cell_index
+  CellIDTranslator<dim>::translate(const CellId &cell_id) const
+  {
+    // follow the same path as
+    // convert_cell_id_binary_type_to_level_coarse_cell_id(), but starting
+    // from the uncompressed representation of the CellId:
+    // c_{i+1} = c_{i}*2^dim + q on the path to the cell
+    types::global_cell_index id = cell_id.get_coarse_cell_id();
+
+    const auto child_indices = cell_id.get_child_indices();
+
+    for (const auto child_index : child_indices)
+      id = id * GeometryInfo<dim>::max_children_per_cell + child_index;
+
+    AssertIndexRange(child_indices.size(), tree_sizes.size());
+
+    return id + tree_sizes[child_indices.size()];
+  }
+
+
+
   template <int dim>
   CellId
   CellIDTranslator<dim>::to_cell_id(const types::global_cell_index id) const
@@ -290,6 +322,107 @@ namespace internal
     return level_coarse_cell_id;
   }
 
+
+
+  /**
+   * A class that provides constant-time translation from CellId to the
+   * active cell index of the corresponding cell of a Triangulation. It is
+   * built on top of CellIDTranslator: since the indices produced by that
+   * class uniquely identify cells, a hash map keyed on them can answer each
+   * query with a single lookup, whereas
+   * Triangulation::create_cell_iterator() walks down the refinement tree
+   * for every call. Setting up an object of this class requires one sweep
+   * over the active cells, so it pays off whenever many CellIds need to be
+   * translated for an unchanged triangulation, e.g., when receiving
+   * cell-wise data from other processes in every time step.
+   *
+   * The index stores all active cells of the local portion of the
+   * triangulation, including ghost and artificial cells. CellIds that do
+   * not correspond to a stored active cell translate to
+   * numbers::invalid_unsigned_int.
+   *
+   * @note The object is only valid as long as the triangulation is not
+   * refined, coarsened, or repartitioned.
+   */
+  template <int dim>
+  class CellIDIndex
+  {
+  public:
+    /**
+     * Constructor taking the Triangulation to be indexed.
+     */
+    template <typename TriangulationType>
+    CellIDIndex(const TriangulationType &tria);
+
+    /**
+     * Return the active cell index of the cell identified by @p cell_id, or
+     * numbers::invalid_unsigned_int if no active cell with this CellId is
+     * stored locally.
+     */
+    unsigned int
+    active_cell_index(const CellId &cell_id) const;
+
+    /**
+     * Translate a whole batch of CellIds at once. The result is the same as
+     * calling active_cell_index() for each entry of @p cell_ids.
+     */
+    std::vector<unsigned int>
+    translate(const ArrayView<const CellId> &cell_ids) const;
+
+  private:
+    /**
+     * The underlying translator from CellIds to unique indices.
+     */
+    const CellIDTranslator<dim> translator;
+
+    /**
+     * Map from the unique index of a cell to its active cell index.
+     */
+    std::unordered_map<types::global_cell_index, unsigned int> index;
+  };
+
+
+
+  template <int dim>
+  template <typename TriangulationType>
+  CellIDIndex<dim>::CellIDIndex(const TriangulationType &tria)
+    : translator(tria.n_global_coarse_cells(), tria.n_global_levels())
+  {
+    index.reserve(tria.n_active_cells());
+
+    for (const auto &cell : tria.active_cell_iterators())
+      index[translator.translate(cell)] = cell->active_cell_index();
+  }
+
+
+
+  template <int dim>
+  unsigned int
+  CellIDIndex<dim>::active_cell_index(const CellId &cell_id) const
+  {
+    const auto ptr = index.find(translator.translate(cell_id));
+
+    if (ptr != index.end())
+      return ptr->second;
+    else
+      return numbers::invalid_unsigned_int;
+  }
+
+
+
+  template <int dim>
+  std::vector<unsigned int>
+  CellIDIndex<dim>::translate(const ArrayView<const CellId> &cell_ids) const
+  {
+    std::vector<unsigned int> active_cell_indices;
+    active_cell_indices.reserve(cell_ids.size());
+
+    for (const auto &cell_id : cell_ids)
+      active_cell_indices.push_back(active_cell_index(cell_id));
+
+    return active_cell_indices;
+  }
+
 } // namespace internal
 
 DEAL_II_NAMESPACE_CLOSE
@@ -1133,6 +1133,12 @@ namespace internal
 
           std::sort(keys.begin(), keys.end());
 
+          // the compatibility keys are not needed beyond this point, so
+          // release their memory before allocating the output arrays to
+          // reduce the peak memory consumption on large meshes
+          ad_compatibility.clear();
+          ad_compatibility.shrink_to_fit();
+
           ptr_0.reserve(n_unique_entities + 1);
           col_0.reserve(n_unique_entity_vertices);
         }
@@ -1441,6 +1447,11 @@ namespace internal
                              connectivity.entity_to_entities(2, 1),
                              connectivity.entity_orientations(1),
                              connectivity.entity_types(2));
+
+          // the temporary cell->line table is not needed any more; release
+          // its memory before determine_neighbors() allocates the neighbor
+          // table of the same size as the cell->face table
+          temp1 = CRS<T>();
         }
 
       // determine neighbors
@@ -23,6 +23,7 @@
 #include <deal.II/base/smartpointer.h>
 
 #include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -369,6 +370,13 @@ public:
    * Open the file given by the string and call the previous function read().
    * This function uses the PathSearch mechanism to find files. The file class
    * used is <code>MESH</code>.
+   *
+   * On POSIX systems, regular files are memory-mapped and parsed directly
+   * from the mapped pages through a zero-copy stream instead of going
+   * through a buffered std::ifstream. This is considerably faster for large
+   * meshes and avoids holding a second copy of the file contents in memory.
+   * If the file cannot be mapped, the function transparently falls back to
+   * reading through a regular input stream.
    */
   void
   read(const std::string &in, Format format = Default);
@@ -405,7 +413,10 @@ public:
    * file: `SCALARS MaterialID`, used to specify the material_id of the cells,
    * or the boundary_id of the faces and edges, and `SCALARS ManifoldID`, that
    * can be used to specify the manifold id of any Triangulation object (cell,
-   * face, or edge).
+   * face, or edge). All other `SCALARS` fields in the CELL_DATA section are
+   * stored and can be retrieved after reading via get_cell_data(); this is
+   * useful when restarting from the output of another simulation code that
+   * attaches field data to the cells.
    *
    * The companion GridOut::write_vtk function can be used to write VTK files
    * compatible with this method.
@@ -416,6 +427,23 @@ public:
   void
   read_vtk(std::istream &in);
 
+  /**
+   * Return the cell data fields that were encountered while reading a mesh
+   * file, as a map from the name of a field to its values on all cells. The
+   * values are stored in the same order in which the cells appeared in the
+   * input file, which is also the order in which the active cells of the
+   * resulting triangulation are traversed as long as the mesh is not refined
+   * or renumbered. Values attached to lower-dimensional objects (boundary
+   * faces and edges) are not stored.
+   *
+   * Currently, only read_vtk() fills this map, from the `SCALARS` fields of
+   * the CELL_DATA section other than the `MaterialID` and `ManifoldID`
+   * fields that are interpreted directly (see the documentation of
+   * read_vtk()). For all other mesh formats, the map is empty.
+   */
+  const std::map<std::string, std::vector<double>> &
+  get_cell_data() const;
+
   /**
    * Read grid data from a unstructured vtu file, saved by deal.II using
    * GridOut::write_vtu(), with the flag
@@ -947,6 +975,11 @@ private:
    * Input format used by read() if no format is given.
    */
   Format default_format;
+
+  /**
+   * The cell data fields read from the mesh file, see get_cell_data().
+   */
+  std::map<std::string, std::vector<double>> cell_data;
 };
 
 /* -------------- declaration of explicit specializations ------------- */
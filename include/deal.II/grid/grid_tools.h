@@ -20,11 +20,14 @@
 
 #include <deal.II/base/bounding_box.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/point.h>
+#include <deal.II/base/smartpointer.h>
 
 #include <deal.II/boost_adaptors/bounding_box.h>
 
 #include <deal.II/distributed/shared_tria.h>
+#include <deal.II/distributed/tria.h>
 
 #include <deal.II/dofs/dof_handler.h>
 
@@ -212,6 +215,12 @@ namespace GridTools
    * This function is used in the "Possibilities for extensions" section of
    * step-38. It is also used in step-49 and step-53.
    *
+   * @note The transformation is applied to the vertices in chunks that are
+   * worked on in parallel if deal.II is configured with thread support.
+   * As a consequence, the @p transformation object must either be free of
+   * state or guard its state appropriately, since its call operator may be
+   * invoked by several threads at the same time.
+   *
    * @dealiiConceptRequires{(std::invocable<Transformation, Point<spacedim>> &&
    *    std::assignable_from<Point<spacedim> &,
    *    std::invoke_result_t<Transformation, Point<spacedim>>>)}
@@ -626,6 +635,45 @@ namespace GridTools
       &cell_hint =
         typename Triangulation<dim, spacedim>::active_cell_iterator());
 
+  /**
+   * A batched variant of GridTools::compute_point_locations_try_all() that
+   * is optimized for large numbers of points. Instead of walking the points
+   * one by one through find_active_cell_around_point(), this function
+   * performs the coarse candidate search for all points at once by querying
+   * an ArborXWrappers::BVH built from the bounding boxes of all locally
+   * relevant cells, and then inverts the mapping for all candidate points of
+   * a cell in a single call to Mapping::transform_points_real_to_unit_cell(),
+   * which processes the points of each cell in vectorized batches.
+   *
+   * The return type and its contents are the same as for
+   * GridTools::compute_point_locations_try_all(). Points that are not found
+   * in any locally relevant, non-artificial cell are reported in the last
+   * entry of the returned tuple. The @p tolerance argument controls both the
+   * enlargement of the query boxes in the candidate search and the
+   * classification of the inverted reference coordinates, in the same way as
+   * the tolerance of find_active_cell_around_point().
+   *
+   * @note This function is only available if deal.II is configured with
+   * ArborX; it throws an exception otherwise.
+   *
+   * @note This function is not implemented for the codimension one case
+   * (<tt>spacedim != dim</tt>).
+   */
+  template <int dim, int spacedim>
+#ifndef DOXYGEN
+  std::tuple<
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>,
+    std::vector<std::vector<Point<dim>>>,
+    std::vector<std::vector<unsigned int>>,
+    std::vector<unsigned int>>
+#else
+  return_type
+#endif
+  compute_point_locations_batched(
+    const Cache<dim, spacedim>         &cache,
+    const std::vector<Point<spacedim>> &points,
+    const double                        tolerance = 1e-10);
+
   /**
    * Given a @p cache and a list of
    * @p local_points for each process, find the points lying on the locally
@@ -2643,6 +2691,49 @@ namespace GridTools
     bool overwrite_only_flat_manifold_ids = true);
   /** @} */
 
+  /**
+   * Return the active cells of @p mesh -- a Triangulation or DoFHandler --
+   * ordered along the hierarchical space-filling curve of the mesh
+   * hierarchy, i.e., by a depth-first traversal of the refinement trees of
+   * the coarse cells. Within each refined cell, children are visited in
+   * their z-order, so the resulting sequence is the Morton order of the
+   * active cells. This is the same order that underlies
+   * DoFRenumbering::hierarchical(), and for
+   * parallel::distributed::Triangulation objects the coarse cells are
+   * traversed in the order of the underlying forest so that the sequence
+   * matches the z-order used by p4est.
+   *
+   * After heavy adaptive refinement, the creation order in which
+   * Triangulation::active_cell_iterators() traverses the mesh correlates
+   * poorly with the order in which cells were created and their data laid
+   * out in memory. Iterating in hierarchical order keeps geometrically
+   * close cells close in the sequence, which considerably improves cache
+   * locality of cell loops on such meshes. The returned vector can be
+   * handed directly to WorkStream::run() or MeshWorker::mesh_loop():
+   * @code
+   * const auto cells =
+   *   GridTools::get_active_cell_iterators_in_hierarchical_order(
+   *     dof_handler);
+   * WorkStream::run(cells.begin(),
+   *                 cells.end(),
+   *                 cell_worker,
+   *                 copier,
+   *                 scratch_data,
+   *                 copy_data);
+   * @endcode
+   *
+   * The vector contains all active cells, including ghost and artificial
+   * ones on parallel triangulations; filter in the worker as usual. The
+   * order remains valid until the triangulation is changed; recomputing it
+   * after refinement is a single sweep over the mesh hierarchy.
+   *
+   * @dealiiConceptRequires{concepts::is_triangulation_or_dof_handler<MeshType>}
+   */
+  template <typename MeshType>
+  DEAL_II_CXX20_REQUIRES(concepts::is_triangulation_or_dof_handler<MeshType>)
+  std::vector<typename MeshType::active_cell_iterator>
+  get_active_cell_iterators_in_hierarchical_order(const MeshType &mesh);
+
   /**
    * Exchange arbitrary data of type @p DataType provided by the function
    * objects from locally owned cells to ghost cells on other processors.
@@ -2727,6 +2818,12 @@ namespace GridTools
    * material ids, user indices, boundary indicators, or any kind of other
    * data with similar calls as the ones above.)
    *
+   * @note If this function is called repeatedly for the same set of cells
+   *   -- for example, once per time step -- consider using the class
+   *   CellDataExchanger instead, which communicates the cell lists only
+   *   once and thereafter transfers a single payload message per neighbor
+   *   and call.
+   *
    * @dealiiConceptRequires{concepts::is_triangulation_or_dof_handler<MeshType>}
    */
   template <typename DataType, typename MeshType>
@@ -2765,6 +2862,102 @@ namespace GridTools
       cell_filter = always_return<typename MeshType::level_cell_iterator, bool>{
         true});
 
+  /**
+   * A class that repeatedly exchanges arbitrary data from locally owned
+   * cells to the corresponding ghost cells on other processes, in the spirit
+   * of exchange_cell_data_to_ghosts() and
+   * exchange_cell_data_to_level_ghosts().
+   *
+   * Each call to those functions first communicates, for every neighboring
+   * process, the list of cells for which data is requested, and then
+   * resolves the received cell ids to cell iterators before any payload is
+   * transferred. If the same set of cells is exchanged many times -- say,
+   * once per data kind and time step in a multiphysics application -- this
+   * setup cost is paid over and over again. This class performs the setup
+   * once in its constructor and caches the per-neighbor cell lists, so that
+   * every subsequent call to exchange() transfers a single payload message
+   * per neighbor and nothing else.
+   *
+   * Several data kinds can be aggregated into one exchange -- and thereby
+   * into one message per neighbor -- by choosing the @p DataType of the
+   * call to exchange() as a `std::pair`, `std::tuple`, or another
+   * serializable compound of the individual pieces of data.
+   *
+   * The template argument @p MeshCellIteratorType selects which ghost layer
+   * is covered: the default, `MeshType::active_cell_iterator`, exchanges
+   * data for the ghost cells of the active mesh like
+   * exchange_cell_data_to_ghosts(), whereas
+   * `MeshType::level_cell_iterator` exchanges data for the level ghost
+   * cells of all multigrid levels like
+   * exchange_cell_data_to_level_ghosts().
+   *
+   * The cached cell lists remain valid as long as the triangulation does
+   * not change; after refinement, coarsening, or repartitioning, a new
+   * object needs to be created.
+   *
+   * @dealiiConceptRequires{concepts::is_triangulation_or_dof_handler<MeshType>}
+   */
+  template <typename MeshType,
+            typename MeshCellIteratorType =
+              typename MeshType::active_cell_iterator>
+  class CellDataExchanger
+  {
+  public:
+    /**
+     * Constructor. Build the lists of cells taking part in the exchange and
+     * communicate them among the neighboring processes. Only cells for
+     * which @p cell_filter returns `true` take part in the exchange.
+     *
+     * This constructor involves communication and must therefore be called
+     * collectively by all processes of the underlying communicator.
+     */
+    CellDataExchanger(
+      const MeshType                                          &mesh,
+      const std::function<bool(const MeshCellIteratorType &)> &cell_filter =
+        always_return<MeshCellIteratorType, bool>{true});
+
+    /**
+     * Exchange data of type @p DataType for the cells registered in the
+     * constructor. The @p pack and @p unpack functions have the same
+     * semantics as in exchange_cell_data_to_ghosts(): @p pack is called on
+     * every locally owned cell that is a ghost cell elsewhere and may
+     * return an empty `std::optional` to skip the cell, and @p unpack is
+     * called on every ghost cell for which the owner packed data.
+     */
+    template <typename DataType>
+    void
+    exchange(const std::function<std::optional<DataType>(
+               const MeshCellIteratorType &)> &pack,
+             const std::function<void(const MeshCellIteratorType &,
+                                      const DataType &)> &unpack) const;
+
+  private:
+    /**
+     * Pointer to the mesh passed to the constructor.
+     */
+    SmartPointer<const MeshType,
+                 CellDataExchanger<MeshType, MeshCellIteratorType>>
+      mesh;
+
+    /**
+     * For each neighboring process, the locally owned cells -- stored as
+     * pairs of level and index within the level -- whose data the neighbor
+     * requested, in the order in which the payload is packed. Neighbors
+     * whose cell filter excluded all relevant cells do not appear, so that
+     * this map and the receive_cells map of the neighbors describe exactly
+     * one message per pair of processes with non-empty traffic.
+     */
+    std::map<types::subdomain_id, std::vector<std::pair<int, int>>>
+      send_cells;
+
+    /**
+     * For each neighboring process, the local ghost cells owned by that
+     * process, in the order in which the payload arrives.
+     */
+    std::map<types::subdomain_id, std::vector<std::pair<int, int>>>
+      receive_cells;
+  };
+
   /* Exchange with all processors of the MPI communicator @p mpi_communicator the vector of bounding
    * boxes @p local_bboxes.
    *
@@ -3126,26 +3319,24 @@ namespace GridTools
   void transform(const Transformation         &transformation,
                  Triangulation<dim, spacedim> &triangulation)
   {
-    std::vector<bool> treated_vertices(triangulation.n_vertices(), false);
-
-    // loop over all active cells, and
-    // transform those vertices that
-    // have not yet been touched. note
-    // that we get to all vertices in
-    // the triangulation by only
-    // visiting the active cells.
-    typename Triangulation<dim, spacedim>::active_cell_iterator
-      cell = triangulation.begin_active(),
-      endc = triangulation.end();
-    for (; cell != endc; ++cell)
-      for (const unsigned int v : cell->vertex_indices())
-        if (treated_vertices[cell->vertex_index(v)] == false)
-          {
-            // transform this vertex
-            cell->vertex(v) = transformation(cell->vertex(v));
-            // and mark it as treated
-            treated_vertices[cell->vertex_index(v)] = true;
-          };
+    // The transformation is applied to every vertex individually, so
+    // rather than visiting the vertices indirectly through the cells (and
+    // keeping track of which ones have already been treated), we can
+    // sweep over the contiguous vertex array of the triangulation once,
+    // splitting it into chunks that are worked on in parallel. The only
+    // thing to pay attention to is that the array may contain entries of
+    // vertices that are currently unused, which we must not touch.
+    const ArrayView<Point<spacedim>> vertices =
+      triangulation.get_writable_vertices();
+    parallel::apply_to_subranges(
+      std::size_t(0),
+      vertices.size(),
+      [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+          if (triangulation.vertex_used(i))
+            vertices[i] = transformation(vertices[i]);
+      },
+      1000);
 
 
     // now fix any vertices on hanging nodes so that we don't create any holes
@@ -3291,6 +3482,77 @@ namespace GridTools
 
 
 
+  namespace internal
+  {
+    template <typename MeshType>
+    void
+    collect_active_cells_hierarchically(
+      const typename MeshType::cell_iterator               &cell,
+      std::vector<typename MeshType::active_cell_iterator> &cells)
+    {
+      if (cell->is_active())
+        cells.push_back(cell);
+      else
+        for (unsigned int child = 0; child < cell->n_children(); ++child)
+          collect_active_cells_hierarchically<MeshType>(cell->child(child),
+                                                        cells);
+    }
+  } // namespace internal
+
+
+
+  template <typename MeshType>
+  DEAL_II_CXX20_REQUIRES(concepts::is_triangulation_or_dof_handler<MeshType>)
+  std::vector<typename MeshType::active_cell_iterator>
+  get_active_cell_iterators_in_hierarchical_order(const MeshType &mesh)
+  {
+    constexpr int dim      = MeshType::dimension;
+    constexpr int spacedim = MeshType::space_dimension;
+
+    const Triangulation<dim, spacedim> &tria = mesh.get_triangulation();
+
+    std::vector<typename MeshType::active_cell_iterator> cells;
+    cells.reserve(tria.n_active_cells());
+
+    if (const parallel::distributed::Triangulation<dim, spacedim> *ptria =
+          dynamic_cast<const parallel::distributed::Triangulation<dim, spacedim>
+                         *>(&tria))
+      {
+#ifdef DEAL_II_WITH_P4EST
+        // this is a distributed triangulation. we need to traverse the coarse
+        // cells in the order p4est does to match the z-order of the forest
+        for (unsigned int c = 0; c < tria.n_cells(0); ++c)
+          {
+            const unsigned int coarse_cell_index =
+              ptria->get_p4est_tree_to_coarse_cell_permutation()[c];
+
+            const typename MeshType::cell_iterator coarse_cell(
+              &tria, 0, coarse_cell_index, &mesh);
+
+            internal::collect_active_cells_hierarchically<MeshType>(coarse_cell,
+                                                                    cells);
+          }
+#else
+        (void)ptria;
+        DEAL_II_NOT_IMPLEMENTED();
+#endif
+      }
+    else
+      {
+        // this is not a distributed triangulation, so we simply traverse the
+        // coarse cells in the order in which they were created
+        for (const auto &coarse_cell : mesh.cell_iterators_on_level(0))
+          internal::collect_active_cells_hierarchically<MeshType>(coarse_cell,
+                                                                  cells);
+      }
+
+    AssertDimension(cells.size(), tria.n_active_cells());
+
+    return cells;
+  }
+
+
+
   template <typename CellIterator>
   std::size_t
   PeriodicFacePair<CellIterator>::memory_consumption() const
@@ -3668,6 +3930,322 @@ namespace GridTools
       [](const auto &tria) { return tria.level_ghost_owners(); });
 #  endif
   }
+
+
+
+#  ifdef DEAL_II_WITH_MPI
+  namespace internal
+  {
+    // All CellDataExchanger objects share one mutex, independent of the
+    // template arguments of the calling instantiation: the payload
+    // messages of exchange() all use the same MPI tag, so two exchanges
+    // with different data types must never overlap on the same
+    // communicator.
+    inline Utilities::MPI::CollectiveMutex &
+    cell_data_exchanger_mutex()
+    {
+      static Utilities::MPI::CollectiveMutex mutex;
+      return mutex;
+    }
+  } // namespace internal
+#  endif
+
+
+
+  template <typename MeshType, typename MeshCellIteratorType>
+  CellDataExchanger<MeshType, MeshCellIteratorType>::CellDataExchanger(
+    const MeshType                                          &mesh,
+    const std::function<bool(const MeshCellIteratorType &)> &cell_filter)
+    : mesh(&mesh)
+  {
+#  ifndef DEAL_II_WITH_MPI
+    (void)cell_filter;
+    Assert(false, ExcNeedsMPI());
+#  else
+    constexpr int dim      = MeshType::dimension;
+    constexpr int spacedim = MeshType::space_dimension;
+    const auto   *tria =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &mesh.get_triangulation());
+    Assert(tria != nullptr,
+           ExcMessage(
+             "The class CellDataExchanger only works with parallel "
+             "triangulations."));
+
+    constexpr bool use_active_ghosts =
+      std::is_same_v<MeshCellIteratorType,
+                     typename MeshType::active_cell_iterator>;
+
+    // build the list of cells to request from each neighbor, and remember
+    // the cells in the same order for unpacking the received payloads later
+    std::set<types::subdomain_id> ghost_owners;
+    if constexpr (use_active_ghosts)
+      ghost_owners = tria->ghost_owners();
+    else
+      ghost_owners = tria->level_ghost_owners();
+
+    std::map<types::subdomain_id, std::vector<typename CellId::binary_type>>
+      neighbor_cell_list;
+    for (const auto ghost_owner : ghost_owners)
+      neighbor_cell_list[ghost_owner] = {};
+
+    const auto register_cell = [&](const auto               &cell,
+                                   const types::subdomain_id owner) {
+      if (cell_filter(cell))
+        {
+          neighbor_cell_list[owner].emplace_back(
+            cell->id().template to_binary<spacedim>());
+          receive_cells[owner].emplace_back(cell->level(), cell->index());
+        }
+    };
+
+    if constexpr (use_active_ghosts)
+      {
+        for (const auto &cell : mesh.active_cell_iterators())
+          if (cell->is_ghost())
+            register_cell(cell, cell->subdomain_id());
+      }
+    else
+      {
+        for (const auto &cell : mesh.cell_iterators())
+          if (cell->is_ghost_on_level())
+            register_cell(cell, cell->level_subdomain_id());
+      }
+
+    // now communicate the cell lists once, exactly like
+    // internal::exchange_cell_data() does on every call, and store the
+    // incoming requests resolved to (level, index) pairs
+    Utilities::MPI::CollectiveMutex::ScopedLock lock(
+      internal::cell_data_exchanger_mutex(), tria->get_communicator());
+
+    const int mpi_tag =
+      Utilities::MPI::internal::Tags::exchange_cell_data_request;
+
+    std::vector<MPI_Request> requests(ghost_owners.size());
+    {
+      unsigned int idx = 0;
+      for (const auto &it : neighbor_cell_list)
+        {
+          const int ierr = MPI_Isend(it.second.data(),
+                                     it.second.size() * sizeof(it.second[0]),
+                                     MPI_BYTE,
+                                     it.first,
+                                     mpi_tag,
+                                     tria->get_communicator(),
+                                     &requests[idx]);
+          AssertThrowMPI(ierr);
+          ++idx;
+        }
+    }
+
+    for (unsigned int idx = 0; idx < ghost_owners.size(); ++idx)
+      {
+        MPI_Status status;
+        int        ierr = MPI_Probe(MPI_ANY_SOURCE,
+                             mpi_tag,
+                             tria->get_communicator(),
+                             &status);
+        AssertThrowMPI(ierr);
+
+        int len;
+        ierr = MPI_Get_count(&status, MPI_BYTE, &len);
+        AssertThrowMPI(ierr);
+        Assert(len % sizeof(typename CellId::binary_type) == 0,
+               ExcInternalError());
+
+        const unsigned int n_cells = len / sizeof(typename CellId::binary_type);
+        std::vector<typename CellId::binary_type> cells_with_requests(n_cells);
+
+        ierr = MPI_Recv(cells_with_requests.data(),
+                        len,
+                        MPI_BYTE,
+                        status.MPI_SOURCE,
+                        status.MPI_TAG,
+                        tria->get_communicator(),
+                        &status);
+        AssertThrowMPI(ierr);
+
+        // an empty request means that the filter on the other side excluded
+        // all of its ghost cells owned by this process; do not create an
+        // entry for this neighbor, so that exchange() sends exactly one
+        // payload per neighbor that expects one -- otherwise the unmatched
+        // reply would stay queued and be picked up by a later exchange()
+        if (n_cells == 0)
+          continue;
+
+        std::vector<std::pair<int, int>> &cells = send_cells[status.MPI_SOURCE];
+        cells.reserve(n_cells);
+        for (unsigned int c = 0; c < n_cells; ++c)
+          {
+            const auto cell =
+              tria->create_cell_iterator(CellId(cells_with_requests[c]));
+            cells.emplace_back(cell->level(), cell->index());
+          }
+      }
+
+    if (requests.size() > 0)
+      {
+        const int ierr =
+          MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        AssertThrowMPI(ierr);
+      }
+#  endif // DEAL_II_WITH_MPI
+  }
+
+
+
+  template <typename MeshType, typename MeshCellIteratorType>
+  template <typename DataType>
+  void
+  CellDataExchanger<MeshType, MeshCellIteratorType>::exchange(
+    const std::function<std::optional<DataType>(const MeshCellIteratorType &)>
+      &pack,
+    const std::function<void(const MeshCellIteratorType &, const DataType &)>
+      &unpack) const
+  {
+#  ifndef DEAL_II_WITH_MPI
+    (void)pack;
+    (void)unpack;
+    Assert(false, ExcNeedsMPI());
+#  else
+    constexpr int dim      = MeshType::dimension;
+    constexpr int spacedim = MeshType::space_dimension;
+    const auto   *tria =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &mesh->get_triangulation());
+    Assert(tria != nullptr, ExcInternalError());
+
+    Utilities::MPI::CollectiveMutex::ScopedLock lock(
+      internal::cell_data_exchanger_mutex(), tria->get_communicator());
+
+    const int mpi_tag_reply =
+      Utilities::MPI::internal::Tags::exchange_cell_data_reply;
+
+    // pack and send the payload for each neighbor, using the same wire
+    // format as internal::exchange_cell_data()
+    std::vector<MPI_Request>       send_requests(send_cells.size());
+    std::vector<std::vector<char>> sendbuffers(send_cells.size());
+    {
+      unsigned int idx = 0;
+      for (const auto &[neighbor, cells] : send_cells)
+        {
+          std::vector<DataType> data_to_send;
+          data_to_send.reserve(cells.size());
+          std::vector<bool> cell_carries_data(cells.size(), false);
+
+          for (unsigned int c = 0; c < cells.size(); ++c)
+            {
+              const MeshCellIteratorType cell(tria,
+                                              cells[c].first,
+                                              cells[c].second,
+                                              mesh);
+              const std::optional<DataType> data = pack(cell);
+              if (data)
+                {
+                  data_to_send.emplace_back(*data);
+                  cell_carries_data[c] = true;
+                }
+            }
+
+          // (a) make room for storing the local offsets, (b) append the
+          // actual data, (c) append the mask of cells without data if needed
+          sendbuffers[idx].resize(sizeof(std::size_t));
+          const std::size_t size_of_send =
+            Utilities::pack(data_to_send,
+                            sendbuffers[idx],
+                            /*enable_compression*/ false);
+          std::memcpy(sendbuffers[idx].data(),
+                      &size_of_send,
+                      sizeof(std::size_t));
+          if (data_to_send.size() < cells.size())
+            Utilities::pack(cell_carries_data,
+                            sendbuffers[idx],
+                            /*enable_compression*/ false);
+
+          const int ierr = MPI_Isend(sendbuffers[idx].data(),
+                                     sendbuffers[idx].size(),
+                                     MPI_BYTE,
+                                     neighbor,
+                                     mpi_tag_reply,
+                                     tria->get_communicator(),
+                                     &send_requests[idx]);
+          AssertThrowMPI(ierr);
+          ++idx;
+        }
+    }
+
+    // receive the payloads and call the unpack function on the cells
+    // recorded in the constructor
+    std::vector<char> receive;
+    for (unsigned int id = 0; id < receive_cells.size(); ++id)
+      {
+        MPI_Status status;
+        int        ierr = MPI_Probe(MPI_ANY_SOURCE,
+                             mpi_tag_reply,
+                             tria->get_communicator(),
+                             &status);
+        AssertThrowMPI(ierr);
+
+        int len;
+        ierr = MPI_Get_count(&status, MPI_BYTE, &len);
+        AssertThrowMPI(ierr);
+
+        receive.resize(len);
+
+        ierr = MPI_Recv(receive.data(),
+                        len,
+                        MPI_BYTE,
+                        status.MPI_SOURCE,
+                        status.MPI_TAG,
+                        tria->get_communicator(),
+                        &status);
+        AssertThrowMPI(ierr);
+
+        auto        data_iterator = receive.begin();
+        std::size_t size_of_received_data =
+          Utilities::unpack<std::size_t>(data_iterator,
+                                         data_iterator + sizeof(std::size_t));
+        data_iterator += sizeof(std::size_t);
+
+        auto received_data = Utilities::unpack<std::vector<DataType>>(
+          data_iterator,
+          data_iterator + size_of_received_data,
+          /*enable_compression*/ false);
+        data_iterator += size_of_received_data;
+
+        const std::vector<std::pair<int, int>> &cells =
+          receive_cells.at(status.MPI_SOURCE);
+        AssertIndexRange(received_data.size(), cells.size() + 1);
+        std::vector<bool> cells_with_data;
+        if (received_data.size() < cells.size())
+          {
+            cells_with_data = Utilities::unpack<std::vector<bool>>(
+              data_iterator, receive.end(), /*enable_compression*/ false);
+            AssertDimension(cells_with_data.size(), cells.size());
+          }
+
+        auto received_data_iterator = received_data.begin();
+        for (unsigned int c = 0; c < cells.size(); ++c)
+          if (cells_with_data.empty() || cells_with_data[c])
+            {
+              const MeshCellIteratorType cell(tria,
+                                              cells[c].first,
+                                              cells[c].second,
+                                              mesh);
+              unpack(cell, *received_data_iterator);
+              ++received_data_iterator;
+            }
+      }
+
+    if (send_requests.size() > 0)
+      {
+        const int ierr = MPI_Waitall(send_requests.size(),
+                                     send_requests.data(),
+                                     MPI_STATUSES_IGNORE);
+        AssertThrowMPI(ierr);
+      }
+#  endif // DEAL_II_WITH_MPI
+  }
 } // namespace GridTools
 
 #endif // DOXYGEN
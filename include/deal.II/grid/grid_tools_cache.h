@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mutex.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/subscriptor.h>
 
@@ -33,6 +34,7 @@
 
 #include <boost/signals2.hpp>
 
+#include <atomic>
 #include <cmath>
 
 DEAL_II_NAMESPACE_OPEN
@@ -59,6 +61,15 @@ namespace GridTools
    * some vertex locations, then some of the structures in this class become
    * obsolete, and you will have to mark them as outdated, by calling the
    * method mark_for_update() manually.
+   *
+   * The `get_*` functions of this class may be called concurrently from
+   * several threads. A data structure that is still marked for update is
+   * computed exactly once, under a lock specific to that data structure;
+   * once it is up to date, subsequent calls return the cached object without
+   * acquiring any lock. To avoid even the one-time computation cost inside
+   * a parallel region, call warm_up() beforehand. The only exception is
+   * get_covering_rtree(), which performs collective MPI communication and
+   * must consequently be called by all processes in the same order.
    */
   template <int dim, int spacedim = dim>
   class Cache : public Subscriptor
@@ -101,6 +112,20 @@ namespace GridTools
     void
     mark_for_update(const CacheUpdateFlags &flags = update_all);
 
+    /**
+     * Compute all data structures selected by @p flags that are currently
+     * marked for update, using one task per data structure.
+     *
+     * Calling this function before handing the cache to several worker
+     * threads guarantees that the subsequent `get_*` calls are pure reads
+     * that do not acquire any lock. The covering rtree is excluded from
+     * this function, since building it requires collective MPI
+     * communication; use get_covering_rtree() directly if you need it.
+     *
+     * @param flags Which data structures to compute
+     */
+    void
+    warm_up(const CacheUpdateFlags &flags = update_all) const;
 
     /**
      * Return the cached vertex_to_cell_map as computed by
@@ -220,9 +245,12 @@ namespace GridTools
 
   private:
     /**
-     * Keep track of what needs to be updated next.
+     * Keep track of what needs to be updated next. The flags are stored as
+     * the integer representation of a CacheUpdateFlags bitmask inside an
+     * atomic variable, so that readers can find out whether a data
+     * structure is up to date without acquiring any of the mutexes below.
      */
-    mutable CacheUpdateFlags update_flags;
+    mutable std::atomic<unsigned int> update_flags;
 
     /**
      * A pointer to the Triangulation.
@@ -305,6 +333,60 @@ namespace GridTools
     mutable std::map<unsigned int, std::set<dealii::types::subdomain_id>>
       vertices_with_ghost_neighbors;
 
+    /**
+     * Mutexes that serialize the one-time computation of each of the data
+     * structures above. Each `get_*` function first checks the atomic
+     * #update_flags variable; only if the corresponding structure is still
+     * marked for update does it acquire the associated mutex, re-check the
+     * flag, and perform the computation. Readers of an up-to-date structure
+     * consequently never take a lock.
+     */
+    mutable Threads::Mutex vertex_to_cells_mutex;
+
+    /**
+     * Same as #vertex_to_cells_mutex, for #vertex_to_cell_centers.
+     */
+    mutable Threads::Mutex vertex_to_cell_centers_mutex;
+
+    /**
+     * Same as #vertex_to_cells_mutex, for #covering_rtree. In contrast to
+     * the other mutexes, this one is held for the whole duration of
+     * get_covering_rtree(), since that function may insert new levels into
+     * the map while other levels are being read.
+     */
+    mutable Threads::Mutex covering_rtree_mutex;
+
+    /**
+     * Same as #vertex_to_cells_mutex, for #used_vertices.
+     */
+    mutable Threads::Mutex used_vertices_mutex;
+
+    /**
+     * Same as #vertex_to_cells_mutex, for #used_vertices_rtree.
+     */
+    mutable Threads::Mutex used_vertices_rtree_mutex;
+
+    /**
+     * Same as #vertex_to_cells_mutex, for #cell_bounding_boxes_rtree.
+     */
+    mutable Threads::Mutex cell_bounding_boxes_rtree_mutex;
+
+    /**
+     * Same as #vertex_to_cells_mutex, for
+     * #locally_owned_cell_bounding_boxes_rtree.
+     */
+    mutable Threads::Mutex locally_owned_cell_bounding_boxes_rtree_mutex;
+
+    /**
+     * Same as #vertex_to_cells_mutex, for #vertex_to_neighbor_subdomain.
+     */
+    mutable Threads::Mutex vertex_to_neighbor_subdomain_mutex;
+
+    /**
+     * Same as #vertex_to_cells_mutex, for #vertices_with_ghost_neighbors.
+     */
+    mutable Threads::Mutex vertices_with_ghost_neighbors_mutex;
+
     /**
      * Storage for the status of the triangulation signal.
      */
@@ -271,6 +271,68 @@ namespace GridTools
                                const Triangulation<dim> &triangulation,
                                const Quadrature<dim>    &quadrature);
 
+  /**
+   * A structure that describes the geometry and quality of the active cells
+   * of a triangulation in summary form. Objects of this type are returned by
+   * compute_mesh_geometry_statistics(), which computes all members in a
+   * single traversal of the mesh.
+   */
+  struct MeshGeometryStatistics
+  {
+    /**
+     * The diameter of the smallest active cell, as also computed by
+     * minimal_cell_diameter().
+     */
+    double min_cell_diameter;
+
+    /**
+     * The diameter of the largest active cell, as also computed by
+     * maximal_cell_diameter().
+     */
+    double max_cell_diameter;
+
+    /**
+     * The dim-dimensional measure of the triangulation, as also computed by
+     * volume().
+     */
+    double volume;
+
+    /**
+     * The maximum over all cells of the ratio of the maximum to minimum
+     * singular value of the Jacobian, as also computed by
+     * compute_maximum_aspect_ratio(). Inverted cells are reported as an
+     * infinite aspect ratio.
+     */
+    double max_aspect_ratio;
+  };
+
+  /**
+   * Compute the quantities returned individually by minimal_cell_diameter(),
+   * maximal_cell_diameter(), volume(), and compute_maximum_aspect_ratio() in
+   * a single traversal of the active cells of @p triangulation and return
+   * them collected in a MeshGeometryStatistics object.
+   *
+   * The results are the same as those of the individual functions listed
+   * above, but each cell is visited only once and the mapping is evaluated
+   * only once per cell. On large meshes this is considerably cheaper than
+   * calling the individual functions one after the other, for example when
+   * mesh diagnostics are recorded after every adaptation step. The loop over
+   * cells is parallelized using the WorkStream framework.
+   *
+   * @note When running in parallel with a Triangulation that supports MPI,
+   * this is a collective call and the returned values are reduced over all
+   * processors.
+   *
+   * @note This function can only be used if deal.II was configured with
+   * support for LAPACK, since the aspect ratio computation relies on a
+   * singular value decomposition of the Jacobian.
+   */
+  template <int dim>
+  MeshGeometryStatistics
+  compute_mesh_geometry_statistics(const Mapping<dim>       &mapping,
+                                   const Triangulation<dim> &triangulation,
+                                   const Quadrature<dim>    &quadrature);
+
   /**
    * Compute the smallest box containing the entire triangulation.
    *
@@ -20,9 +20,13 @@
 
 #include <deal.II/base/function.h>
 #include <deal.II/base/function_parser.h>
+#include <deal.II/base/mutex.h>
 
 #include <deal.II/grid/manifold.h>
 
+#include <array>
+#include <map>
+
 DEAL_II_NAMESPACE_OPEN
 
 // forward declaration
@@ -1150,6 +1154,28 @@ private:
                 InverseQuadraticApproximation<dim, spacedim>>
     quadratic_approximation;
 
+  /**
+   * A cache of the chart preimages computed by pull_back(), one map per
+   * coarse mesh cell, keyed by the coordinates of the real-space point.
+   * During a refinement sweep, every existing vertex serves as a
+   * surrounding point for the creation of many new points, once for each
+   * adjacent line, quad, and cell, and each of these queries would
+   * otherwise repeat the expensive Newton iteration for the very same
+   * point. Only successful pull backs are cached; the preimage of a given
+   * point with respect to a given coarse cell does not depend on the
+   * context of the query, so the cache stays valid until the coarse cells
+   * change, i.e., until initialize() is called again, which clears it.
+   */
+  mutable std::vector<std::map<std::array<double, spacedim>, Point<dim>>>
+    chart_points_cache;
+
+  /**
+   * Mutex protecting the access to chart_points_cache, as this manifold
+   * might be queried concurrently, for example when filling a
+   * MappingQCache.
+   */
+  mutable Threads::Mutex chart_points_cache_mutex;
+
   /**
    * The connection to Triangulation::signals::clear that must be reset once
    * this class goes out of scope.
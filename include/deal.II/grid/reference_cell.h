@@ -2236,11 +2236,8 @@ ReferenceCell::face_to_cell_lines(
         }
       case ReferenceCells::Quadrilateral:
         {
-          const auto [face_orientation, face_rotation, face_flip] =
-            internal::split_face_orientation(combined_face_orientation);
-
-          return GeometryInfo<2>::face_to_cell_lines(
-            face, line, face_orientation, face_flip, face_rotation);
+          // the faces of a quadrilateral are its lines
+          return face;
         }
       case ReferenceCells::Tetrahedron:
         {
@@ -2276,11 +2273,31 @@ ReferenceCell::face_to_cell_lines(
         }
       case ReferenceCells::Hexahedron:
         {
-          const auto [face_orientation, face_rotation, face_flip] =
-            internal::split_face_orientation(combined_face_orientation);
-
-          return GeometryInfo<3>::face_to_cell_lines(
-            face, line, face_orientation, face_flip, face_rotation);
+          static constexpr ndarray<unsigned int, 6, 4> table = {
+            {{{8, 10, 0, 4}},
+             {{9, 11, 1, 5}},
+             {{2, 6, 8, 9}},
+             {{3, 7, 10, 11}},
+             {{0, 1, 2, 3}},
+             {{4, 5, 6, 7}}}};
+
+          // Things are tabulated in the opposite direction compared to the
+          // simplex cells above: for hypercubes, the combined orientation
+          // has historically been applied by mapping the given (real) face
+          // line back to the line of the face in standard orientation, i.e.,
+          // by using the inverse permutation.
+          static constexpr ndarray<unsigned int, 8, 4>
+            real_to_standard_line = {{{{2, 3, 0, 1}},
+                                      {{0, 1, 2, 3}},
+                                      {{0, 1, 3, 2}},
+                                      {{2, 3, 1, 0}},
+                                      {{3, 2, 1, 0}},
+                                      {{1, 0, 3, 2}},
+                                      {{1, 0, 2, 3}},
+                                      {{3, 2, 0, 1}}}};
+
+          return table[face]
+                      [real_to_standard_line[combined_face_orientation][line]];
         }
       default:
         DEAL_II_NOT_IMPLEMENTED();
@@ -2317,11 +2334,8 @@ ReferenceCell::face_to_cell_vertices(
         }
       case ReferenceCells::Line:
         {
-          const auto [face_orientation, face_rotation, face_flip] =
-            internal::split_face_orientation(combined_face_orientation);
-
-          return GeometryInfo<1>::face_to_cell_vertices(
-            face, vertex, face_orientation, face_flip, face_rotation);
+          // the faces of a line are its vertices
+          return face;
         }
       case ReferenceCells::Triangle:
         {
@@ -2335,11 +2349,14 @@ ReferenceCell::face_to_cell_vertices(
         }
       case ReferenceCells::Quadrilateral:
         {
-          const auto [face_orientation, face_rotation, face_flip] =
-            internal::split_face_orientation(combined_face_orientation);
+          static constexpr ndarray<unsigned int, 4, 2> table = {
+            {{{0, 2}}, {{1, 3}}, {{0, 1}}, {{2, 3}}}};
 
-          return GeometryInfo<2>::face_to_cell_vertices(
-            face, vertex, face_orientation, face_flip, face_rotation);
+          // the line permutations are involutory, so applying them in
+          // either direction gives the same result
+          return table[face]
+                      [line_vertex_permutations[combined_face_orientation]
+                                               [vertex]];
         }
       case ReferenceCells::Tetrahedron:
         {
@@ -2377,11 +2394,25 @@ ReferenceCell::face_to_cell_vertices(
         }
       case ReferenceCells::Hexahedron:
         {
-          const auto [face_orientation, face_rotation, face_flip] =
-            internal::split_face_orientation(combined_face_orientation);
+          static constexpr ndarray<unsigned int, 6, 4> table = {
+            {{{0, 2, 4, 6}},
+             {{1, 3, 5, 7}},
+             {{0, 4, 1, 5}},
+             {{2, 6, 3, 7}},
+             {{0, 1, 2, 3}},
+             {{4, 5, 6, 7}}}};
+
+          // Things are tabulated in the opposite direction compared to the
+          // simplex cells above: for hypercubes, the combined orientation
+          // has historically been applied by mapping the given (real) face
+          // vertex back to the vertex of the face in standard orientation,
+          // i.e., by using the inverse permutation.
+          static constexpr std::array<unsigned char, 8> inverse_orientation =
+            {{0, 1, 2, 7, 4, 5, 6, 3}};
 
-          return GeometryInfo<3>::face_to_cell_vertices(
-            face, vertex, face_orientation, face_flip, face_rotation);
+          return table[face][quadrilateral_vertex_permutations
+                               [inverse_orientation[combined_face_orientation]]
+                               [vertex]];
         }
       default:
         DEAL_II_NOT_IMPLEMENTED();
@@ -2467,6 +2498,16 @@ ReferenceCell::standard_to_real_face_line(
                                                                   {{0, 2, 1}},
                                                                   {{1, 2, 0}}}};
 
+  static constexpr ndarray<unsigned int, 8, 4> quadrilateral_table = {
+    {{{2, 3, 0, 1}},
+     {{0, 1, 2, 3}},
+     {{0, 1, 3, 2}},
+     {{3, 2, 0, 1}},
+     {{3, 2, 1, 0}},
+     {{1, 0, 3, 2}},
+     {{1, 0, 2, 3}},
+     {{2, 3, 1, 0}}}};
+
 
   switch (this->kind)
     {
@@ -2480,45 +2521,16 @@ ReferenceCell::standard_to_real_face_line(
         return triangle_table[combined_face_orientation][line];
       case ReferenceCells::Pyramid:
         if (face == 0) // The quadrilateral face
-          {
-            const auto [face_orientation, face_rotation, face_flip] =
-              internal::split_face_orientation(combined_face_orientation);
-
-            return GeometryInfo<3>::standard_to_real_face_line(line,
-                                                               face_orientation,
-                                                               face_flip,
-                                                               face_rotation);
-          }
+          return quadrilateral_table[combined_face_orientation][line];
         else // One of the triangular faces
-          {
-            return triangle_table[combined_face_orientation][line];
-          }
+          return triangle_table[combined_face_orientation][line];
       case ReferenceCells::Wedge:
         if (face > 1) // One of the quadrilateral faces
-          {
-            const auto [face_orientation, face_rotation, face_flip] =
-              internal::split_face_orientation(combined_face_orientation);
-
-            return GeometryInfo<3>::standard_to_real_face_line(line,
-                                                               face_orientation,
-                                                               face_flip,
-                                                               face_rotation);
-          }
+          return quadrilateral_table[combined_face_orientation][line];
         else // One of the triangular faces
           return triangle_table[combined_face_orientation][line];
       case ReferenceCells::Hexahedron:
-        {
-          static constexpr ndarray<unsigned int, 8, 4> table = {
-            {{{2, 3, 0, 1}},
-             {{0, 1, 2, 3}},
-             {{0, 1, 3, 2}},
-             {{3, 2, 0, 1}},
-             {{3, 2, 1, 0}},
-             {{1, 0, 3, 2}},
-             {{1, 0, 2, 3}},
-             {{2, 3, 1, 0}}}};
-          return table[combined_face_orientation][line];
-        }
+        return quadrilateral_table[combined_face_orientation][line];
       default:
         DEAL_II_NOT_IMPLEMENTED();
     }
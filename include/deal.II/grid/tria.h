@@ -18,6 +18,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/iterator_range.h>
 #include <deal.II/base/partitioner.h>
@@ -451,13 +452,25 @@ namespace internal
      * simultaneously via MPIIO. Each processor's position to write to will be
      * determined from the provided input parameters.
      *
+     * If @p compression_level is larger than zero, the data buffers are
+     * compressed with zlib before they are written to disk: the cells are
+     * grouped into chunks of @p cells_per_compression_chunk cells, each
+     * chunk is compressed independently, and a table of chunk offsets is
+     * stored in the file so that the data can be read back by an arbitrary
+     * number of processes. Independent chunks keep the memory overhead
+     * bounded and allow the compression to proceed concurrently on all
+     * ranks. Since the compression changes the file layout, the files can
+     * only be read back by passing `data_is_compressed = true` to load().
+     *
      * Data has to be previously packed with pack_data().
      */
     void
     save(const unsigned int global_first_cell,
          const unsigned int global_num_cells,
          const std::string &filename,
-         const MPI_Comm    &mpi_communicator) const;
+         const MPI_Comm    &mpi_communicator,
+         const unsigned int compression_level           = 0,
+         const unsigned int cells_per_compression_chunk = 4096) const;
 
     /**
      * Deserialize data from file system.
@@ -474,6 +487,10 @@ namespace internal
      * simultaneously via MPIIO. Each processor's position to read from will be
      * determined from the provided input arguments.
      *
+     * If the data has been written with compression enabled in save(),
+     * @p data_is_compressed needs to be set to `true`; each processor then
+     * reads and decompresses the chunks overlapping its range of cells.
+     *
      * After loading, unpack_data() needs to be called to finally
      * distribute data across the associated triangulation.
      */
@@ -484,7 +501,8 @@ namespace internal
          const std::string &filename,
          const unsigned int n_attached_deserialize_fixed,
          const unsigned int n_attached_deserialize_variable,
-         const MPI_Comm    &mpi_communicator);
+         const MPI_Comm    &mpi_communicator,
+         const bool         data_is_compressed = false);
 
     /**
      * Clears all containers and associated data, and resets member
@@ -2006,6 +2024,32 @@ public:
   virtual void
   copy_triangulation(const Triangulation<dim, spacedim> &other_tria);
 
+  /**
+   * Return a new, independent triangulation that represents the current
+   * state of this triangulation. The returned object can be traversed --
+   * and, for example, handed to GridOut or used to build output patches --
+   * on a separate thread while the current triangulation continues to be
+   * refined or coarsened, because the two objects do not share any data.
+   * This allows pipelining graphical output with the next adaptation step.
+   *
+   * The snapshot is a deep copy obtained through copy_triangulation(), so
+   * creating it costs memory and time proportional to the size of the mesh.
+   * A copy-on-write view that shares unchanged levels with the live mesh is
+   * not possible with the present internal data structures: iterators store
+   * a plain pointer to the triangulation that owns them, and the level and
+   * face storage is held by value, so a shared view would be invalidated by
+   * the very reallocations a snapshot is supposed to protect against.
+   *
+   * For triangulations of derived types, the snapshot is a plain, serial
+   * Triangulation that contains a copy of the locally stored cells; for a
+   * parallel::distributed::Triangulation this includes ghost and artificial
+   * cells along with their subdomain ids. Manifold objects attached to this
+   * triangulation are cloned into the snapshot, so curved geometry remains
+   * available through it independently of the original objects.
+   */
+  std::unique_ptr<Triangulation<dim, spacedim>>
+  create_snapshot() const;
+
   /**
    * Create a triangulation from a list of vertices and a list of cells, each
    * of the latter being a list of <tt>1<<dim</tt> vertex indices. The
@@ -3385,6 +3429,27 @@ public:
   const std::vector<Point<spacedim>> &
   get_vertices() const;
 
+  /**
+   * Return a writable view of all the vertices present in this
+   * triangulation, stored as one contiguous array. This function is
+   * intended for bulk mesh deformation, where the new vertex positions are
+   * computed for many vertices at once (see, for example,
+   * GridTools::transform()); going through the array directly is
+   * considerably faster than visiting the vertices through cell iterators.
+   *
+   * As with the function above, not all entries of the array are
+   * necessarily associated with vertices that are actually used, and the
+   * positions of unused vertices (see vertex_used()) must not be relied
+   * upon. The view only allows changing vertex positions, not the number
+   * of vertices. After moving vertices through this view, you need to
+   * trigger the Triangulation::Signals::mesh_movement signal yourself so
+   * that objects caching information about the mesh geometry, such as
+   * FEValues, are informed -- or better, use GridTools::transform() which
+   * takes care of this as well as of hanging nodes.
+   */
+  ArrayView<Point<spacedim>>
+  get_writable_vertices();
+
   /**
    * Return the number of vertices that are presently in use, i.e. belong to
    * at least one used element.
@@ -3855,6 +3920,26 @@ public:
 
   internal::CellAttachedData<dim, spacedim> cell_attached_data;
 
+  /**
+   * Select whether the cell-attached data buffers written by save() are
+   * compressed. A @p compression_level of zero (the default) writes the
+   * buffers verbatim; values between one and nine select the corresponding
+   * zlib effort. When compression is enabled, the cells are grouped into
+   * chunks of @p cells_per_compression_chunk cells that are compressed
+   * independently and can therefore be read back by an arbitrary number of
+   * processes.
+   *
+   * Since the compression changes the layout of the checkpoint files, the
+   * same setting has to be active when calling load() for a checkpoint as
+   * was active when it was written with save(), in the same way in which
+   * Utilities::unpack() needs to be called with the same `allow_compression`
+   * flag as the matching Utilities::pack().
+   */
+  void
+  set_attached_data_compression(
+    const unsigned int compression_level,
+    const unsigned int cells_per_compression_chunk = 4096);
+
 protected:
   /**
    * Save additional cell-attached data into the given file. The first
@@ -3906,6 +3991,18 @@ protected:
     local_cell_relations;
 
   internal::CellAttachedDataSerializer<dim, spacedim> data_serializer;
+
+  /**
+   * The zlib effort used for the cell-attached data buffers written by
+   * save(), see set_attached_data_compression(). Zero disables compression.
+   */
+  unsigned int attached_data_compression_level = 0;
+
+  /**
+   * Number of cells whose attached data is compressed as one independent
+   * chunk, see set_attached_data_compression().
+   */
+  unsigned int attached_data_compression_chunk_cells = 4096;
   /**
    * @}
    */
@@ -4072,6 +4169,55 @@ private:
            std::pair<std::pair<cell_iterator, unsigned int>, unsigned char>>
     periodic_face_map;
 
+  /**
+   * A representation of one entry of periodic_face_pairs_level_0 in terms of
+   * cell indices instead of cell iterators, used to serialize the periodic
+   * face pairs in save() and load(). The rotation matrix of the pair is
+   * stored as its size and a flat list of entries, so that this struct can
+   * be defined without the full definition of GridTools::PeriodicFacePair,
+   * which is only forward declared in this header.
+   */
+  struct PeriodicFacePairData
+  {
+    int                 first_cell_index;
+    int                 second_cell_index;
+    unsigned int        first_face_idx;
+    unsigned int        second_face_idx;
+    unsigned char       orientation;
+    unsigned int        matrix_size;
+    std::vector<double> matrix_entries;
+
+    /**
+     * Read or write the data of this object for serialization.
+     */
+    template <class Archive>
+    void
+    serialize(Archive &ar, const unsigned int)
+    {
+      ar &first_cell_index &second_cell_index &first_face_idx
+        &second_face_idx &orientation &matrix_size &matrix_entries;
+    }
+  };
+
+  /**
+   * Convert periodic_face_pairs_level_0 into the index-based representation
+   * that is stored when the triangulation is serialized in save().
+   */
+  std::vector<PeriodicFacePairData>
+  pack_periodic_face_pairs_level_0() const;
+
+  /**
+   * Restore periodic_face_pairs_level_0 from the index-based representation
+   * written by pack_periodic_face_pairs_level_0() and rebuild the
+   * periodic_face_map. Used in load() after the cell data has been read, so
+   * that the periodicity information of a serialized triangulation survives
+   * a save()/load() cycle without having to match the faces geometrically
+   * again with GridTools::collect_periodic_faces().
+   */
+  void
+  restore_periodic_face_pairs_level_0(
+    const std::vector<PeriodicFacePairData> &periodic_face_pair_data);
+
   /**
    * Declare a number of iterator types for raw iterators, i.e., iterators
    * that also iterate over holes in the list of cells left by cells that have
@@ -4647,6 +4793,15 @@ inline const std::vector<Point<spacedim>>
 }
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+inline ArrayView<Point<spacedim>>
+Triangulation<dim, spacedim>::get_writable_vertices()
+{
+  return make_array_view(vertices);
+}
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 template <class Archive>
@@ -4682,6 +4837,13 @@ void Triangulation<dim, spacedim>::save(Archive &ar, const unsigned int) const
       ar &vertex_to_boundary_id_map_1d;
       ar &vertex_to_manifold_id_map_1d;
     }
+
+  // store the periodic face pairs of the coarse mesh in an index-based
+  // representation, so that periodicity set up with add_periodicity()
+  // survives serialization without geometric re-matching
+  const std::vector<PeriodicFacePairData> periodic_face_pair_data =
+    pack_periodic_face_pairs_level_0();
+  ar &periodic_face_pair_data;
 }
 
 
@@ -4751,6 +4913,12 @@ void Triangulation<dim, spacedim>::load(Archive &ar, const unsigned int)
       ar &vertex_to_manifold_id_map_1d;
     }
 
+  // restore the periodic face pairs of the coarse mesh and rebuild the
+  // periodic face map from them
+  std::vector<PeriodicFacePairData> periodic_face_pair_data;
+  ar &periodic_face_pair_data;
+  restore_periodic_face_pairs_level_0(periodic_face_pair_data);
+
   // trigger the create signal to indicate
   // that new content has been imported into
   // the triangulation
@@ -710,6 +710,65 @@ namespace TriangulationDescription
       const TriangulationDescription::Settings setting =
         TriangulationDescription::Settings::default_setting);
 
+    /**
+     * Write the given Description into the file @p filename using a compact
+     * binary representation. Together with create_description_from_file(),
+     * this function allows setting up a
+     * parallel::fullydistributed::Triangulation without ever creating a
+     * serial triangulation or touching p4est: the description of each
+     * process's partition is computed once -- for example with
+     * create_description_from_triangulation_in_groups() -- and written to
+     * one file per process. Subsequent program runs then start up by only
+     * reading back the per-process files, which requires neither
+     * communication nor memory for cells other than the locally relevant
+     * ones, and therefore scales to meshes that are far too large to be
+     * replicated on every process:
+     * @code
+     * // preprocessing run: create and store the per-process descriptions
+     * const auto description = TriangulationDescription::Utilities::
+     *   create_description_from_triangulation_in_groups<dim, spacedim>(
+     *     ..., comm, group_size);
+     * TriangulationDescription::Utilities::save_description(
+     *   description,
+     *   file_prefix + "." +
+     *     std::to_string(Utilities::MPI::this_mpi_process(comm)));
+     *
+     * // production runs: read the pre-split files
+     * parallel::fullydistributed::Triangulation<dim, spacedim> tria(comm);
+     * tria.create_triangulation(
+     *   TriangulationDescription::Utilities::create_description_from_file<
+     *     dim, spacedim>(
+     *     file_prefix + "." +
+     *       std::to_string(Utilities::MPI::this_mpi_process(comm)),
+     *     comm));
+     * @endcode
+     *
+     * All information stored in the description is preserved, including the
+     * settings; in particular, a description created with
+     * Settings::construct_multigrid_hierarchy yields a triangulation with
+     * multigrid levels after reading it back in.
+     */
+    template <int dim, int spacedim = dim>
+    void
+    save_description(const Description<dim, spacedim> &description,
+                     const std::string                &filename);
+
+    /**
+     * Read a Description back from a file previously written by
+     * save_description() and associate it with the communicator @p comm.
+     * The file has to describe the partition of the calling process, i.e.,
+     * each process reads its own slice of the pre-split file set; see the
+     * documentation of save_description() for the typical usage.
+     *
+     * The function verifies that the dimensions stored in the file match
+     * the template parameters and that the file set has been created for
+     * the number of processes in @p comm.
+     */
+    template <int dim, int spacedim = dim>
+    Description<dim, spacedim>
+    create_description_from_file(const std::string &filename,
+                                 const MPI_Comm     comm);
+
   } // namespace Utilities
 
 
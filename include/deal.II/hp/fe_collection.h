@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mutex.h>
+
 #include <deal.II/fe/component_mask.h>
 #include <deal.II/fe/fe.h>
 #include <deal.II/fe/fe_values_extractors.h>
@@ -24,6 +26,7 @@
 #include <deal.II/hp/collection.h>
 
 #include <memory>
+#include <tuple>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -869,6 +872,28 @@ namespace hp
     std::function<unsigned int(const typename hp::FECollection<dim, spacedim> &,
                                const unsigned int)>
       hierarchy_prev;
+
+    /**
+     * A cache for the results of the hp_vertex_dof_identities(),
+     * hp_line_dof_identities(), and hp_quad_dof_identities() functions.
+     * These functions are called repeatedly with the same small sets of
+     * fe indices whenever a DoFHandler enumerates degrees of freedom on a
+     * mesh whose cells carry different elements of this collection, and
+     * their results only depend on the elements stored in the collection,
+     * which can no longer change once they have been added. The key of the
+     * map combines the dimension of the object the identities live on, the
+     * face number (only relevant for identities on quads), and the set of
+     * fe indices the query was made for.
+     */
+    mutable std::map<
+      std::tuple<unsigned int, unsigned int, std::set<unsigned int>>,
+      std::vector<std::map<unsigned int, unsigned int>>>
+      hp_dof_identities_cache;
+
+    /**
+     * Mutex guarding concurrent access to hp_dof_identities_cache.
+     */
+    mutable Threads::Mutex hp_dof_identities_cache_mutex;
   };
 
 
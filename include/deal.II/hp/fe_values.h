@@ -29,6 +29,7 @@
 #include <deal.II/hp/mapping_collection.h>
 #include <deal.II/hp/q_collection.h>
 
+#include <array>
 #include <memory>
 
 DEAL_II_NAMESPACE_OPEN
@@ -136,6 +137,19 @@ namespace hp
                            const std::vector<unsigned int> &mapping_indices,
                            const std::vector<unsigned int> &q_indices);
 
+    /**
+     * Same as above, but with the FE, mapping, and quadrature index of each
+     * FE*Values object to be created combined into one array. This is the
+     * form returned by get_used_fe_value_indices(), so that the combinations
+     * a previous, otherwise identical run has actually used can be recorded
+     * there and passed to this function on restart, restricting the up-front
+     * work and memory to the entries that are known to be needed instead of
+     * the full cross product of the collections.
+     */
+    void
+    precalculate_fe_values(
+      const std::vector<std::array<unsigned int, 3>> &indices);
+
     /**
      * Same as above, geared to the most common use of hp::FEValues objects in
      * which FE, quadrature and mapping indices are similar on each individual
@@ -151,6 +165,19 @@ namespace hp
     void
     precalculate_fe_values();
 
+    /**
+     * Return the list of triples of finite element, mapping, and quadrature
+     * index for which an FE*Values object exists in this object. Since these
+     * objects are created lazily on first use, the returned list describes
+     * exactly the combinations the program has worked with so far -- a usage
+     * profile -- provided none of the precalculate_fe_values() functions has
+     * been called on this object. The list can be stored at the end of a
+     * run and handed to precalculate_fe_values() on restart to build only
+     * the table entries that will actually be needed.
+     */
+    std::vector<std::array<unsigned int, 3>>
+    get_used_fe_value_indices() const;
+
     /**
      * Get a reference to the collection of finite element objects used
      * here.
@@ -4235,8 +4235,6 @@ AffineConstraints<number>::distribute_local_to_global(
   // calling the other function above.
   const bool use_vectors =
     (local_vector.size() == 0 && global_vector.size() == 0) ? false : true;
-  const bool use_dealii_matrix =
-    std::is_same_v<MatrixType, SparseMatrix<number>>;
 
   AssertDimension(local_matrix.n(), local_dof_indices.size());
   AssertDimension(local_matrix.m(), local_dof_indices.size());
@@ -4259,6 +4257,97 @@ AffineConstraints<number>::distribute_local_to_global(
   global_rows.reinit(n_local_dofs);
   make_sorted_row_list(local_dof_indices, global_rows);
 
+  distribute_local_to_global_resolved(local_matrix,
+                                      local_vector,
+                                      local_dof_indices,
+                                      global_matrix,
+                                      global_vector,
+                                      use_inhomogeneities_for_rhs,
+                                      global_rows,
+                                      *scratch_data);
+}
+
+
+
+// version of the function above that replays a previously compiled
+// ScatterPlan instead of resolving the constraint chains again
+template <typename number>
+template <typename MatrixType, typename VectorType>
+void
+AffineConstraints<number>::distribute_local_to_global(
+  const FullMatrix<number>     &local_matrix,
+  const Vector<number>         &local_vector,
+  const std::vector<size_type> &local_dof_indices,
+  MatrixType                   &global_matrix,
+  VectorType                   &global_vector,
+  const bool                    use_inhomogeneities_for_rhs,
+  ScatterPlan                  &scatter_plan) const
+{
+  static_assert(internal::AffineConstraints::IsBlockMatrix<MatrixType>::value ==
+                  false,
+                "Scatter plans are only available for non-block matrices. "
+                "Use the overload without the ScatterPlan argument for "
+                "block matrices.");
+
+  const bool use_vectors =
+    (local_vector.size() == 0 && global_vector.size() == 0) ? false : true;
+
+  AssertDimension(local_matrix.n(), local_dof_indices.size());
+  AssertDimension(local_matrix.m(), local_dof_indices.size());
+  Assert(global_vector.has_ghost_elements() == false, ExcGhostsPresent());
+  Assert(global_matrix.m() == global_matrix.n(), ExcNotQuadratic());
+  if (use_vectors == true)
+    {
+      AssertDimension(local_matrix.m(), local_vector.size());
+      AssertDimension(global_matrix.m(), global_vector.size());
+    }
+  Assert(lines.empty() || sorted == true, ExcMatrixNotClosed());
+
+  typename internal::AffineConstraints::ScratchDataAccessor<number>
+    scratch_data(this->scratch_data);
+
+  // (re-)compile the plan in case it does not belong to the given set of
+  // local degrees of freedom, e.g. on its first use for a cell or after the
+  // plan has been invalidated
+  if (scatter_plan.local_dof_indices != local_dof_indices)
+    {
+      scatter_plan.local_dof_indices = local_dof_indices;
+      scatter_plan.global_rows.reinit(local_dof_indices.size());
+      make_sorted_row_list(local_dof_indices, scatter_plan.global_rows);
+    }
+
+  distribute_local_to_global_resolved(local_matrix,
+                                      local_vector,
+                                      local_dof_indices,
+                                      global_matrix,
+                                      global_vector,
+                                      use_inhomogeneities_for_rhs,
+                                      scatter_plan.global_rows,
+                                      *scratch_data);
+}
+
+
+
+// common part of the two functions above: scatter the local contributions
+// into the global objects, given an already resolved list of global rows
+template <typename number>
+template <typename MatrixType, typename VectorType>
+void
+AffineConstraints<number>::distribute_local_to_global_resolved(
+  const FullMatrix<number>     &local_matrix,
+  const Vector<number>         &local_vector,
+  const std::vector<size_type> &local_dof_indices,
+  MatrixType                   &global_matrix,
+  VectorType                   &global_vector,
+  const bool                    use_inhomogeneities_for_rhs,
+  const internal::AffineConstraints::GlobalRowsFromLocal<number> &global_rows,
+  internal::AffineConstraints::ScratchData<number> &scratch_data) const
+{
+  const bool use_vectors =
+    (local_vector.size() == 0 && global_vector.size() == 0) ? false : true;
+  const bool use_dealii_matrix =
+    std::is_same_v<MatrixType, SparseMatrix<number>>;
+
   const size_type n_actual_dofs = global_rows.size();
 
   // create arrays for the column data (indices and values) that will then be
@@ -4267,12 +4356,12 @@ AffineConstraints<number>::distribute_local_to_global(
   // an array in any case since we cannot know about the actual data type in
   // the AffineConstraints class (unless we do cast). This involves a little
   // bit of logic to determine the type of the matrix value.
-  std::vector<size_type> &cols = scratch_data->columns;
-  std::vector<number>    &vals = scratch_data->values;
+  std::vector<size_type> &cols = scratch_data.columns;
+  std::vector<number>    &vals = scratch_data.values;
   // create arrays for writing into the vector as well
-  std::vector<size_type> &vector_indices = scratch_data->vector_indices;
+  std::vector<size_type> &vector_indices = scratch_data.vector_indices;
   std::vector<typename VectorType::value_type> &vector_values =
-    scratch_data->vector_values;
+    scratch_data.vector_values;
   vector_indices.resize(n_actual_dofs);
   vector_values.resize(n_actual_dofs);
   SparseMatrix<number> *sparse_matrix =
@@ -0,0 +1,317 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_batched_lapack_full_matrix_h
+#define dealii_batched_lapack_full_matrix_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/lapack_support.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// forward declarations
+#ifndef DOXYGEN
+template <typename number>
+class Vector;
+#endif
+
+/**
+ * A class that stores a batch of small, square full matrices of equal size
+ * contiguously in memory and performs factorizations and solves on all of
+ * them at once. The entries of groups of VectorizedArray<number>::size()
+ * consecutive matrices are interleaved, i.e., the entry $(i,j)$ of all
+ * matrices of a group sits in adjacent memory locations, so that the
+ * operations run in SIMD fashion across the matrices of a group rather than
+ * within an individual matrix. This layout addresses the use case of
+ * inverting thousands of small matrices (of size of a few dozens, say, as
+ * they appear in cell-local solvers or limiters of discontinuous Galerkin
+ * methods), for which individual calls to LAPACKFullMatrix involve a
+ * considerable call and dispatch overhead and poor data locality.
+ *
+ * The interface deliberately follows LAPACKFullMatrix where applicable: the
+ * usual cycle is to fill the entries (through the access operator), call
+ * compute_lu_factorization() or, for matrices marked as
+ * LAPACKSupport::symmetric via set_property(),
+ * compute_cholesky_factorization(), and then solve() for one right-hand side
+ * per matrix. The factorizations are computed by vectorized internal
+ * kernels; the LU factorization uses partial pivoting, performed in lockstep
+ * across the lanes of a group. Since all matrices of a batch share their
+ * size, padding lanes arising when the batch size is not a multiple of the
+ * SIMD width are filled with identity matrices internally and do not
+ * influence the results.
+ *
+ * As for LAPACKFullMatrix, a factorization replaces the stored matrix
+ * entries and changes the internal state, after which the matrix entries can
+ * no longer be accessed; call reinit() to start a new fill-factorize-solve
+ * cycle.
+ *
+ * @note This class is only available for real scalar number types, as the
+ *   kernels are built on VectorizedArray.
+ */
+template <typename number>
+class BatchedLAPACKFullMatrix : public Subscriptor
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = unsigned int;
+
+  /**
+   * The number of matrices processed together in SIMD fashion.
+   */
+  static constexpr std::size_t n_lanes = VectorizedArray<number>::size();
+
+  /**
+   * Constructor. Initialize the object as an empty batch; use reinit() to
+   * give it a size.
+   */
+  BatchedLAPACKFullMatrix();
+
+  /**
+   * Constructor. Initialize the batch as @p batch_size zero matrices of size
+   * @p size times @p size.
+   */
+  BatchedLAPACKFullMatrix(const size_type size, const size_type batch_size);
+
+  /**
+   * Resize the batch to @p batch_size zero matrices of size @p size times
+   * @p size and reset the internal state, discarding previous content and
+   * factorizations.
+   */
+  void
+  reinit(const size_type size, const size_type batch_size);
+
+  /**
+   * Return the number of rows (and, as the matrices are square, columns) of
+   * each matrix in the batch.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of each matrix in the batch.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of matrices in the batch.
+   */
+  size_type
+  batch_size() const;
+
+  /**
+   * Read-write access to the entry $(i,j)$ of the matrix with index
+   * @p batch_index. Only available before a factorization has been
+   * computed.
+   */
+  number &
+  operator()(const size_type batch_index,
+             const size_type i,
+             const size_type j);
+
+  /**
+   * Read-only access to the entry $(i,j)$ of the matrix with index
+   * @p batch_index.
+   */
+  number
+  operator()(const size_type batch_index,
+             const size_type i,
+             const size_type j) const;
+
+  /**
+   * Assign a property to all matrices of the batch, analogous to
+   * LAPACKFullMatrix::set_property(). Marking the matrices as
+   * LAPACKSupport::symmetric is a prerequisite for
+   * compute_cholesky_factorization().
+   */
+  void
+  set_property(const LAPACKSupport::Property property);
+
+  /**
+   * Compute the LU factorization of all matrices of the batch with partial
+   * pivoting, replacing the stored matrix entries by the factors. Throws
+   * LACExceptions::ExcSingular if one of the matrices turns out to be
+   * singular.
+   */
+  void
+  compute_lu_factorization();
+
+  /**
+   * Compute the Cholesky factorization of all matrices of the batch, which
+   * must have been marked as LAPACKSupport::symmetric through
+   * set_property() and be positive definite, replacing the stored matrix
+   * entries by the factor. Throws LACExceptions::ExcSingular if one of the
+   * matrices is not positive definite.
+   */
+  void
+  compute_cholesky_factorization();
+
+  /**
+   * Solve one linear system per matrix of the batch, replacing each
+   * right-hand side by the respective solution. The vector @p v must
+   * contain batch_size() vectors of length n(). Requires that
+   * compute_lu_factorization() or compute_cholesky_factorization() has been
+   * called before. The flag @p transposed indicates whether the transposed
+   * matrices should be considered instead.
+   */
+  void
+  solve(std::vector<Vector<number>> &v, const bool transposed = false) const;
+
+  /**
+   * Same as the function above, but taking the right-hand sides in the
+   * interleaved layout this class uses internally: the entry $i$ of the
+   * right-hand side of matrix `b` is lane `b % n_lanes` of
+   * `v[(b / n_lanes) * n() + i]`. This variant avoids the interleaving and
+   * de-interleaving step of the function above and is the method of choice
+   * when the surrounding code already holds its data in vectorized form.
+   */
+  void
+  solve(AlignedVector<VectorizedArray<number>> &v,
+        const bool                              transposed = false) const;
+
+private:
+  /**
+   * Return the number of groups of matrices processed together, i.e., the
+   * batch size divided by the number of lanes, rounded up.
+   */
+  size_type
+  n_blocks() const;
+
+  /**
+   * The number of rows and columns of each matrix.
+   */
+  size_type matrix_size;
+
+  /**
+   * The number of matrices in the batch.
+   */
+  size_type n_matrices;
+
+  /**
+   * The interleaved entries of all matrices: the entry $(i,j)$ of the
+   * matrices of group `b` is stored in the lanes of
+   * `values[(b * matrix_size + i) * matrix_size + j]`.
+   */
+  AlignedVector<VectorizedArray<number>> values;
+
+  /**
+   * The row permutations chosen by the pivoting of the LU factorization,
+   * one entry per row and group, with one permutation index per lane.
+   */
+  AlignedVector<VectorizedArray<number>> row_permutation;
+
+  /**
+   * The state of the batch, following the same life cycle as
+   * LAPACKFullMatrix::state.
+   */
+  LAPACKSupport::State state;
+
+  /**
+   * The property assigned through set_property().
+   */
+  LAPACKSupport::Property property;
+};
+
+
+#ifndef DOXYGEN
+
+template <typename number>
+inline typename BatchedLAPACKFullMatrix<number>::size_type
+BatchedLAPACKFullMatrix<number>::m() const
+{
+  return matrix_size;
+}
+
+
+
+template <typename number>
+inline typename BatchedLAPACKFullMatrix<number>::size_type
+BatchedLAPACKFullMatrix<number>::n() const
+{
+  return matrix_size;
+}
+
+
+
+template <typename number>
+inline typename BatchedLAPACKFullMatrix<number>::size_type
+BatchedLAPACKFullMatrix<number>::batch_size() const
+{
+  return n_matrices;
+}
+
+
+
+template <typename number>
+inline typename BatchedLAPACKFullMatrix<number>::size_type
+BatchedLAPACKFullMatrix<number>::n_blocks() const
+{
+  return (n_matrices + n_lanes - 1) / n_lanes;
+}
+
+
+
+template <typename number>
+inline number &
+BatchedLAPACKFullMatrix<number>::operator()(const size_type batch_index,
+                                            const size_type i,
+                                            const size_type j)
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  AssertIndexRange(batch_index, n_matrices);
+  AssertIndexRange(i, matrix_size);
+  AssertIndexRange(j, matrix_size);
+  return values[((batch_index / n_lanes) * matrix_size + i) * matrix_size + j]
+               [batch_index % n_lanes];
+}
+
+
+
+template <typename number>
+inline number
+BatchedLAPACKFullMatrix<number>::operator()(const size_type batch_index,
+                                            const size_type i,
+                                            const size_type j) const
+{
+  AssertIndexRange(batch_index, n_matrices);
+  AssertIndexRange(i, matrix_size);
+  AssertIndexRange(j, matrix_size);
+  return values[((batch_index / n_lanes) * matrix_size + i) * matrix_size + j]
+               [batch_index % n_lanes];
+}
+
+
+
+template <typename number>
+inline void
+BatchedLAPACKFullMatrix<number>::set_property(
+  const LAPACKSupport::Property p)
+{
+  property = p;
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
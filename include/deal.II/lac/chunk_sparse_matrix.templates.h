@@ -39,9 +39,11 @@ DEAL_II_NAMESPACE_OPEN
 namespace internal
 {
   // TODO: the goal of the ChunkSparseMatrix class is to stream data and use
-  // the vectorization features of modern processors. to make this happen,
-  // we will have to vectorize the functions in the following namespace, either
-  // by hand or by using, for example, optimized BLAS versions for them.
+  // the vectorization features of modern processors. the kernels below
+  // dispatch to fixed-size variants for the common chunk sizes, whose fully
+  // known loop bounds the compiler can unroll and vectorize. further gains
+  // would require an interleaved storage order within chunks or optimized
+  // BLAS versions of the kernels.
   namespace ChunkSparseMatrixImplementation
   {
     /**
@@ -49,6 +51,37 @@ namespace internal
      */
     using size_type = types::global_dof_index;
 
+    /**
+     * Variant of chunk_vmult_add() for a chunk size that is known at compile
+     * time. With the loop bounds known, the compiler can fully unroll and
+     * vectorize the loops over the chunk, which is where the bulk of the
+     * work of a matrix-vector product is spent.
+     */
+    template <size_type chunk_size,
+              typename MatrixIterator,
+              typename SrcIterator,
+              typename DstIterator>
+    inline void
+    chunk_vmult_add(const MatrixIterator matrix,
+                    const SrcIterator    src,
+                    DstIterator          dst)
+    {
+      MatrixIterator matrix_row = matrix;
+
+      for (size_type i = 0; i < chunk_size; ++i, matrix_row += chunk_size)
+        {
+          typename std::iterator_traits<DstIterator>::value_type sum = 0;
+
+          DEAL_II_OPENMP_SIMD_PRAGMA
+          for (size_type j = 0; j < chunk_size; ++j)
+            sum += matrix_row[j] * src[j];
+
+          dst[i] += sum;
+        }
+    }
+
+
+
     /**
      * Add the result of multiplying a chunk of size chunk_size times
      * chunk_size by a source vector fragment of size chunk_size to the
@@ -63,6 +96,20 @@ namespace internal
                     const SrcIterator    src,
                     DstIterator          dst)
     {
+      // chunk sizes in practice are usually powers of two matching the SIMD
+      // width of the processor, so use the fixed-size kernels for those
+      switch (chunk_size)
+        {
+          case 4:
+            chunk_vmult_add<4>(matrix, src, dst);
+            return;
+          case 8:
+            chunk_vmult_add<8>(matrix, src, dst);
+            return;
+          default:
+            break;
+        }
+
       MatrixIterator matrix_row = matrix;
 
       for (size_type i = 0; i < chunk_size; ++i, matrix_row += chunk_size)
@@ -79,7 +126,36 @@ namespace internal
 
 
     /**
-     * Like the previous function, but subtract. We need this for computing
+     * Variant of chunk_vmult_subtract() for a chunk size that is known at
+     * compile time.
+     */
+    template <size_type chunk_size,
+              typename MatrixIterator,
+              typename SrcIterator,
+              typename DstIterator>
+    inline void
+    chunk_vmult_subtract(const MatrixIterator matrix,
+                         const SrcIterator    src,
+                         DstIterator          dst)
+    {
+      MatrixIterator matrix_row = matrix;
+
+      for (size_type i = 0; i < chunk_size; ++i, matrix_row += chunk_size)
+        {
+          typename std::iterator_traits<DstIterator>::value_type sum = 0;
+
+          DEAL_II_OPENMP_SIMD_PRAGMA
+          for (size_type j = 0; j < chunk_size; ++j)
+            sum += matrix_row[j] * src[j];
+
+          dst[i] -= sum;
+        }
+    }
+
+
+
+    /**
+     * Like chunk_vmult_add(), but subtract. We need this for computing
      * the residual.
      */
     template <typename MatrixIterator,
@@ -91,6 +167,18 @@ namespace internal
                          const SrcIterator    src,
                          DstIterator          dst)
     {
+      switch (chunk_size)
+        {
+          case 4:
+            chunk_vmult_subtract<4>(matrix, src, dst);
+            return;
+          case 8:
+            chunk_vmult_subtract<8>(matrix, src, dst);
+            return;
+          default:
+            break;
+        }
+
       MatrixIterator matrix_row = matrix;
 
       for (size_type i = 0; i < chunk_size; ++i, matrix_row += chunk_size)
@@ -105,6 +193,32 @@ namespace internal
     }
 
 
+    /**
+     * Variant of chunk_Tvmult_add() for a chunk size that is known at
+     * compile time.
+     */
+    template <size_type chunk_size,
+              typename MatrixIterator,
+              typename SrcIterator,
+              typename DstIterator>
+    inline void
+    chunk_Tvmult_add(const MatrixIterator matrix,
+                     const SrcIterator    src,
+                     DstIterator          dst)
+    {
+      for (size_type i = 0; i < chunk_size; ++i)
+        {
+          typename std::iterator_traits<DstIterator>::value_type sum = 0;
+
+          DEAL_II_OPENMP_SIMD_PRAGMA
+          for (size_type j = 0; j < chunk_size; ++j)
+            sum += matrix[j * chunk_size + i] * src[j];
+
+          dst[i] += sum;
+        }
+    }
+
+
     /**
      * Add the result of multiplying the transpose of a chunk of size
      * chunk_size times chunk_size by a source vector fragment of size
@@ -119,6 +233,18 @@ namespace internal
                      const SrcIterator    src,
                      DstIterator          dst)
     {
+      switch (chunk_size)
+        {
+          case 4:
+            chunk_Tvmult_add<4>(matrix, src, dst);
+            return;
+          case 8:
+            chunk_Tvmult_add<8>(matrix, src, dst);
+            return;
+          default:
+            break;
+        }
+
       for (size_type i = 0; i < chunk_size; ++i)
         {
           typename std::iterator_traits<DstIterator>::value_type sum = 0;
@@ -131,6 +257,39 @@ namespace internal
     }
 
 
+    /**
+     * Variant of chunk_matrix_scalar_product() for a chunk size that is
+     * known at compile time.
+     */
+    template <size_type chunk_size,
+              typename result_type,
+              typename MatrixIterator,
+              typename SrcIterator1,
+              typename SrcIterator2>
+    inline result_type
+    chunk_matrix_scalar_product(const MatrixIterator matrix,
+                                const SrcIterator1   u,
+                                const SrcIterator2   v)
+    {
+      result_type result = 0;
+
+      MatrixIterator matrix_row = matrix;
+
+      for (size_type i = 0; i < chunk_size; ++i, matrix_row += chunk_size)
+        {
+          typename std::iterator_traits<SrcIterator2>::value_type sum = 0;
+
+          DEAL_II_OPENMP_SIMD_PRAGMA
+          for (size_type j = 0; j < chunk_size; ++j)
+            sum += matrix_row[j] * v[j];
+
+          result += u[i] * sum;
+        }
+
+      return result;
+    }
+
+
     /**
      * Produce the result of the matrix scalar product $u^TMv$ for an
      * individual chunk.
@@ -145,6 +304,16 @@ namespace internal
                                 const SrcIterator1   u,
                                 const SrcIterator2   v)
     {
+      switch (chunk_size)
+        {
+          case 4:
+            return chunk_matrix_scalar_product<4, result_type>(matrix, u, v);
+          case 8:
+            return chunk_matrix_scalar_product<8, result_type>(matrix, u, v);
+          default:
+            break;
+        }
+
       result_type result = 0;
 
       MatrixIterator matrix_row = matrix;
@@ -0,0 +1,105 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_concurrent_sparsity_pattern_h
+#define dealii_concurrent_sparsity_pattern_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/smartpointer.h>
+
+#include <deal.II/lac/sparsity_pattern_base.h>
+
+#include <mutex>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Sparsity
+ * @{
+ */
+
+/**
+ * A decorator around an existing sparsity pattern that makes the insertion
+ * functions of the SparsityPatternBase interface safe to call from several
+ * threads at the same time.
+ *
+ * Most dynamic sparsity pattern classes, in particular
+ * DynamicSparsityPattern, store each row independently but are not
+ * thread-safe during insertion because concurrent calls may modify the same
+ * row. This class serializes insertions by hashing rows onto a configurable
+ * number of independently locked shards: calls targeting rows in different
+ * shards proceed fully in parallel, while calls targeting the same shard
+ * are serialized by a mutex. With sufficiently many shards (the default of
+ * 256 is adequate for typical thread counts), lock contention is rare and
+ * the construction of the sparsity pattern scales with the number of
+ * threads.
+ *
+ * A typical use is to build a sparsity pattern from a multithreaded
+ * (e.g. WorkStream-based) loop over cells without accumulating per-thread
+ * patterns and merging them afterwards:
+ * @code
+ * DynamicSparsityPattern    dsp(dof_handler.n_dofs());
+ * ConcurrentSparsityPattern concurrent_dsp(dsp);
+ * DoFTools::make_sparsity_pattern(dof_handler, concurrent_dsp);
+ * @endcode
+ * After all threads have finished inserting, the wrapped pattern can be
+ * used as usual; the wrapper itself stores no entries.
+ *
+ * @note The wrapped pattern must store its rows independently so that
+ * concurrent insertions into different rows do not conflict. This holds
+ * for DynamicSparsityPattern, but not, for example, for patterns that
+ * maintain a single global entry list.
+ */
+class ConcurrentSparsityPattern : public SparsityPatternBase
+{
+public:
+  /**
+   * Constructor. The given @p pattern receives all entries added through
+   * this object and must live at least as long as the current object.
+   * @p n_shards determines the number of independently locked groups of
+   * rows.
+   */
+  explicit ConcurrentSparsityPattern(SparsityPatternBase &pattern,
+                                     const unsigned int   n_shards = 256);
+
+  /**
+   * Add the given column indices to the specified row of the wrapped
+   * pattern, holding the lock of the shard the row belongs to. This
+   * function may be called concurrently from several threads.
+   */
+  virtual void
+  add_row_entries(const size_type                  &row,
+                  const ArrayView<const size_type> &columns,
+                  const bool indices_are_sorted = false) override;
+
+private:
+  /**
+   * The pattern that stores the entries.
+   */
+  SmartPointer<SparsityPatternBase, ConcurrentSparsityPattern> pattern;
+
+  /**
+   * One mutex per shard of rows; row @p r is protected by entry
+   * <code>r % mutexes.size()</code>.
+   */
+  std::vector<std::mutex> mutexes;
+};
+
+/** @} */
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
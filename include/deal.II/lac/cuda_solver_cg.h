@@ -0,0 +1,142 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_cuda_solver_cg_h
+#define dealii_cuda_solver_cg_h
+
+#include <deal.II/base/config.h>
+
+#ifdef DEAL_II_WITH_CUDA
+#  include <deal.II/base/cuda.h>
+
+#  include <deal.II/lac/cuda_sparse_matrix.h>
+#  include <deal.II/lac/cuda_vector.h>
+#  include <deal.II/lac/solver_control.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace CUDAWrappers
+{
+  /**
+   * Conjugate gradient solver that runs entirely on the @ref GlossDevice
+   * "device". In contrast to using the generic SolverCG class with
+   * CUDAWrappers::SparseMatrix and LinearAlgebra::CUDAWrappers::Vector, no
+   * intermediate result is transferred to the host during the iteration:
+   * the scalar coefficients of the recurrence are computed and consumed in
+   * device memory, the cuSPARSE work buffer for the matrix-vector product is
+   * allocated only once, and the residual norm is copied to the host --
+   * which synchronizes the device -- only every
+   * AdditionalData::convergence_check_interval iterations. This removes the
+   * per-iteration kernel launch and synchronization latency that dominates
+   * the run time for systems that are small for the device they run on.
+   *
+   * If AdditionalData::use_graph_capture is set, the operations of one
+   * iteration are additionally recorded into a CUDA graph that is replayed
+   * between two convergence checks, which reduces the launch overhead of the
+   * individual kernels further.
+   *
+   * Since the host only observes the residual at the check points, the
+   * solver may perform up to `convergence_check_interval - 1` more
+   * iterations than strictly necessary, and a breakdown of the method is
+   * also only detected at a check point. The first argument of
+   * SolverControl::last_step() consequently reports a multiple of the check
+   * interval.
+   *
+   * @note Instantiations for this template are provided for <tt>@<float@></tt>
+   * and <tt>@<double@></tt>.
+   *
+   * @ingroup CUDAWrappers
+   */
+  template <typename Number>
+  class SolverCG
+  {
+  public:
+    /**
+     * Struct for additional settings for SolverCG.
+     */
+    struct AdditionalData
+    {
+      /**
+       * Constructor.
+       */
+      explicit AdditionalData(
+        const unsigned int convergence_check_interval = 10,
+        const bool         use_graph_capture          = true);
+
+      /**
+       * The number of iterations performed on the device between two
+       * residual norm checks on the host. Larger values reduce the number of
+       * device synchronizations at the price of potentially performing up to
+       * `convergence_check_interval - 1` superfluous iterations.
+       */
+      unsigned int convergence_check_interval;
+
+      /**
+       * Whether to record the operations of one iteration into a CUDA graph
+       * and replay the graph, instead of launching the kernels of every
+       * iteration individually.
+       */
+      bool use_graph_capture;
+    };
+
+    /**
+     * Constructor. Takes the solver control object and creates the solver.
+     */
+    SolverCG(const Utilities::CUDA::Handle &handle,
+             SolverControl                 &cn,
+             const AdditionalData          &data = AdditionalData());
+
+    /**
+     * Destructor.
+     */
+    virtual ~SolverCG() = default;
+
+    /**
+     * Solve the linear system <tt>Ax=b</tt>.
+     */
+    void
+    solve(const SparseMatrix<Number>                        &A,
+          LinearAlgebra::CUDAWrappers::Vector<Number>       &x,
+          const LinearAlgebra::CUDAWrappers::Vector<Number> &b);
+
+    /**
+     * Access to object that controls convergence.
+     */
+    SolverControl &
+    control() const;
+
+  private:
+    /**
+     * Handle
+     */
+    const Utilities::CUDA::Handle &cuda_handle;
+
+    /**
+     * Reference to the object that controls convergence of the iterative
+     * solver. The residual norm is copied into it at every check point.
+     */
+    SolverControl &solver_control;
+
+    /**
+     * Store a copy of the flags for this particular solver.
+     */
+    const AdditionalData additional_data;
+  };
+} // namespace CUDAWrappers
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
+
+#endif
@@ -26,6 +26,7 @@
 #include <deal.II/lac/sparsity_pattern_base.h>
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <vector>
 
@@ -665,9 +666,11 @@ public:
 
 private:
   /**
-   * A flag that stores whether any entries have been added so far.
+   * A flag that stores whether any entries have been added so far. The flag
+   * is atomic so that entries can be added to independent rows from several
+   * threads concurrently, e.g. through ConcurrentSparsityPattern.
    */
-  bool have_entries;
+  std::atomic<bool> have_entries;
 
   /**
    * A set that contains the valid rows.
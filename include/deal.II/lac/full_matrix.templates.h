@@ -573,18 +573,37 @@ FullMatrix<number>::mmult(FullMatrix<number2>       &dst,
 
   const size_type m = this->m(), n = src.n(), l = this->n();
 
-  // arrange the loops in a way that we keep write operations low, (writing is
-  // usually more costly than reading), even though we need to access the data
-  // in src not in a contiguous way.
-  for (size_type i = 0; i < m; ++i)
-    for (size_type j = 0; j < n; ++j)
-      {
-        number2 add_value = adding ? dst(i, j) : 0.;
-        for (size_type k = 0; k < l; ++k)
-          add_value += static_cast<number2>((*this)(i, k)) *
-                       static_cast<number2>((src(k, j)));
-        dst(i, j) = add_value;
-      }
+  if (adding == false)
+    dst = number2();
+
+  // Tile the loops over the columns of dst/src and over the inner dimension
+  // so that the panel of src used within a tile stays in cache even for
+  // matrices that are much larger than the cache. Within a tile, the
+  // innermost loop runs over contiguous entries of one row of src and one
+  // row of dst each and can therefore be vectorized by the compiler. For
+  // small matrices the tiles simply degenerate to the full loop ranges, so
+  // no separate code path is necessary there.
+  constexpr size_type tile_n = 128;
+  constexpr size_type tile_k = 64;
+  for (size_type j0 = 0; j0 < n; j0 += tile_n)
+    {
+      const size_type j1 = std::min(j0 + tile_n, n);
+      for (size_type k0 = 0; k0 < l; k0 += tile_k)
+        {
+          const size_type k1 = std::min(k0 + tile_k, l);
+          for (size_type i = 0; i < m; ++i)
+            {
+              number2 *dst_row = &dst(i, 0);
+              for (size_type k = k0; k < k1; ++k)
+                {
+                  const number2 a_ik = static_cast<number2>((*this)(i, k));
+                  const number2 *src_row = &src(k, 0);
+                  for (size_type j = j0; j < j1; ++j)
+                    dst_row[j] += a_ik * src_row[j];
+                }
+            }
+        }
+    }
 }
 
 
@@ -1837,19 +1856,24 @@ FullMatrix<number>::gauss_jordan()
           std::swap(p[j], p[r]);
         }
 
-      // transformation
+      // transformation: rank-1 update of all rows other than row j. Loop
+      // over the rows so that the inner loop runs over contiguous memory
+      // and can be vectorized by the compiler; the update of the entry in
+      // column j is undone afterwards rather than excluded from the inner
+      // loop, since a branch in the inner loop would prevent vectorization.
       const number hr = number(1.) / (*this)(j, j);
       (*this)(j, j)   = hr;
-      for (size_type k = 0; k < N; ++k)
+      for (size_type i = 0; i < N; ++i)
         {
-          if (k == j)
+          if (i == j)
             continue;
-          for (size_type i = 0; i < N; ++i)
-            {
-              if (i == j)
-                continue;
-              (*this)(i, k) -= (*this)(i, j) * (*this)(j, k) * hr;
-            }
+          number       *row_i = &(*this)(i, 0);
+          const number *row_j = &(*this)(j, 0);
+          const number  a_ij  = row_i[j];
+          const number  h     = a_ij * hr;
+          for (size_type k = 0; k < N; ++k)
+            row_i[k] -= h * row_j[k];
+          row_i[j] = a_ij;
         }
       for (size_type i = 0; i < N; ++i)
         {
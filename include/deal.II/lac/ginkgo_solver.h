@@ -109,11 +109,27 @@ namespace GinkgoWrappers
     virtual ~SolverBase() = default;
 
     /**
-     * Initialize the matrix and copy over its data to Ginkgo's data structures.
+     * Initialize the matrix and copy over its data to Ginkgo's data
+     * structures. This also generates the solver, including a possible
+     * preconditioner, from the matrix, so that repeated calls to apply()
+     * reuse the matrix and preconditioner kept on the device.
      */
     void
     initialize(const SparseMatrix<ValueType> &matrix);
 
+    /**
+     * Update the numerical values of the matrix previously passed to
+     * initialize() without changing its sparsity pattern, and regenerate the
+     * solver from the updated values. The matrix data already residing on the
+     * device is reused, so in contrast to calling initialize() again no
+     * device memory is allocated and the structural set-up of the matrix is
+     * not repeated. This is useful when the same system has to be solved for
+     * a sequence of matrices that share the sparsity pattern, e.g. within a
+     * nonlinear or time-dependent solve.
+     */
+    void
+    update_values(const SparseMatrix<ValueType> &matrix);
+
     /**
      * Solve the linear system <tt>Ax=b</tt>. Dependent on the information
      * provided by derived classes one of Ginkgo's linear solvers is
@@ -196,6 +212,13 @@ namespace GinkgoWrappers
      */
     std::shared_ptr<gko::matrix::Csr<ValueType, IndexType>> system_matrix;
 
+    /**
+     * The solver generated from the solver factory and the system matrix. It
+     * is kept across calls to apply() so that the preconditioner and the
+     * matrix stay on the device.
+     */
+    std::shared_ptr<gko::LinOp> generated_solver;
+
     /**
      * The execution paradigm as a string to be set by the user. The choices
      * are between `omp`, `cuda` and `reference` and more details can be found
@@ -567,6 +590,172 @@ namespace GinkgoWrappers
   };
 
 
+  /**
+   * This class forms the base class for the preconditioners that Ginkgo
+   * implements. In contrast to passing a preconditioner factory to one of the
+   * solver classes above, objects of the derived classes behave like the
+   * preconditioner classes of deal.II itself: after initialize() has copied
+   * the matrix to the device and generated the preconditioner there, vmult()
+   * applies the preconditioner to a deal.II vector, so that the object can be
+   * handed to the iterative solvers of deal.II, e.g. dealii::SolverCG. The
+   * generated preconditioner is kept on the device across all applications,
+   * and update_values() allows to refresh it for a matrix with new entries
+   * but unchanged sparsity pattern without allocating new device memory.
+   *
+   * @ingroup GinkgoWrappers
+   */
+  template <typename ValueType = double, typename IndexType = int32_t>
+  class PreconditionBase
+  {
+  public:
+    /**
+     * Destructor.
+     */
+    virtual ~PreconditionBase() = default;
+
+    /**
+     * Copy the matrix to Ginkgo's data structures on the device and generate
+     * the preconditioner from it.
+     */
+    void
+    initialize(const SparseMatrix<ValueType> &matrix);
+
+    /**
+     * Update the numerical values of the matrix previously passed to
+     * initialize() without changing its sparsity pattern, and regenerate the
+     * preconditioner from the updated values. The matrix data already
+     * residing on the device is reused.
+     */
+    void
+    update_values(const SparseMatrix<ValueType> &matrix);
+
+    /**
+     * Apply the preconditioner to @p src, writing the result into @p dst.
+     */
+    void
+    vmult(Vector<ValueType> &dst, const Vector<ValueType> &src) const;
+
+    /**
+     * Access to the underlying Ginkgo preconditioner factory. The returned
+     * factory can be passed to the constructors of the solver classes of this
+     * namespace in order to use the preconditioner inside a Ginkgo solver.
+     */
+    const std::shared_ptr<gko::LinOpFactory> &
+    get_factory() const;
+
+  protected:
+    /**
+     * Constructor.
+     *
+     * The @p exec_type defines the paradigm where the preconditioner is
+     * generated and applied and takes the same values as for SolverBase.
+     */
+    PreconditionBase(const std::string &exec_type);
+
+    /**
+     * The Ginkgo preconditioner factory object, set by the derived classes.
+     */
+    std::shared_ptr<gko::LinOpFactory> preconditioner_gen;
+
+    /**
+     * The execution paradigm in Ginkgo.
+     */
+    std::shared_ptr<gko::Executor> executor;
+
+  private:
+    /**
+     * Ginkgo matrix data structure the preconditioner is generated from.
+     */
+    std::shared_ptr<gko::matrix::Csr<ValueType, IndexType>> system_matrix;
+
+    /**
+     * The preconditioner generated from the factory and the system matrix.
+     */
+    std::shared_ptr<gko::LinOp> preconditioner;
+  };
+
+
+  /**
+   * A wrapper for the block-Jacobi preconditioner of Ginkgo.
+   *
+   * @ingroup GinkgoWrappers
+   */
+  template <typename ValueType = double, typename IndexType = int32_t>
+  class PreconditionJacobi : public PreconditionBase<ValueType, IndexType>
+  {
+  public:
+    /**
+     * A standardized data struct to pipe additional data to the
+     * preconditioner.
+     */
+    struct AdditionalData
+    {
+      /**
+       * Constructor. By default, blocks of at most 32 rows are used, which
+       * corresponds to the default of Ginkgo.
+       */
+      AdditionalData(const unsigned int max_block_size = 32);
+
+      /**
+       * Maximum size of the diagonal blocks.
+       */
+      unsigned int max_block_size;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param[in] exec_type The execution paradigm for the preconditioner.
+     *
+     * @param[in] data The additional data required by the preconditioner.
+     */
+    PreconditionJacobi(const std::string    &exec_type,
+                       const AdditionalData &data = AdditionalData());
+
+  protected:
+    /**
+     * Store a copy of the settings for this particular preconditioner.
+     */
+    const AdditionalData additional_data;
+  };
+
+
+  /**
+   * A wrapper for the incomplete LU factorization (ILU) preconditioner of
+   * Ginkgo. The triangular factors are computed on the device when the
+   * preconditioner is generated and applied through triangular solves.
+   *
+   * @ingroup GinkgoWrappers
+   */
+  template <typename ValueType = double, typename IndexType = int32_t>
+  class PreconditionILU : public PreconditionBase<ValueType, IndexType>
+  {
+  public:
+    /**
+     * A standardized data struct to pipe additional data to the
+     * preconditioner.
+     */
+    struct AdditionalData
+    {};
+
+    /**
+     * Constructor.
+     *
+     * @param[in] exec_type The execution paradigm for the preconditioner.
+     *
+     * @param[in] data The additional data required by the preconditioner.
+     */
+    PreconditionILU(const std::string    &exec_type,
+                    const AdditionalData &data = AdditionalData());
+
+  protected:
+    /**
+     * Store a copy of the settings for this particular preconditioner.
+     */
+    const AdditionalData additional_data;
+  };
+
+
 } // namespace GinkgoWrappers
 
 DEAL_II_NAMESPACE_CLOSE
@@ -825,6 +825,23 @@ namespace LinearAlgebra
            const Number                       a,
            const Vector<Number, MemorySpace> &V);
 
+      /**
+       * Fused scaling and addition of multiples of several vectors, i.e.
+       * <tt>*this = s*(*this) + a[0]*V[0] + ... + a[k-1]*V[k-1]</tt>.
+       *
+       * Compared to the equivalent sequence of sadd() and add() calls, this
+       * function streams the memory of the current vector only once for the
+       * whole linear combination, which for bandwidth-bound operations such
+       * as the stage updates of explicit Runge-Kutta time integrators cuts
+       * the memory traffic almost in half. Up to eight source vectors are
+       * fused into a single sweep over memory; longer linear combinations
+       * are transparently split into several sweeps.
+       */
+      void
+      sadd(const Number                                            s,
+           const std::vector<Number>                              &a,
+           const std::vector<const Vector<Number, MemorySpace> *> &V);
+
       /**
        * Scale each element of this vector by the corresponding element in the
        * argument. This function is mostly meant to simulate multiplication (and
@@ -926,6 +943,40 @@ namespace LinearAlgebra
        */
       std::size_t
       memory_consumption() const;
+
+      /**
+       * Write the content of the vector into the file @p filename in a
+       * binary format: a small header containing the global size and the
+       * size of the stored number type, followed by all vector elements in
+       * ascending global index order. Since the elements are addressed by
+       * their global index, the file does not depend on the partition of the
+       * vector and can be read back with load() on a different number of MPI
+       * processes or with a different partitioning. When deal.II is
+       * configured with MPI, the data is written with collective MPI-IO and
+       * each process only touches the part of the file corresponding to its
+       * locally owned range.
+       *
+       * Ghost values are not written to the file.
+       */
+      void
+      save(const std::string &filename) const;
+
+      /**
+       * Read the content of a file previously written by save() into the
+       * locally owned elements of this vector. The vector must already be
+       * initialized with the desired partition -- which need not be related
+       * to the partition the file was written with -- and the global size of
+       * the vector must coincide with the global size stored in the file.
+       * Each process reads exactly the part of the file corresponding to its
+       * locally owned range, so a post-processing tool can map a sub-range
+       * of a large file by initializing a vector that only owns the indices
+       * of interest on the reading processes.
+       *
+       * Ghost values are not read from the file and remain unchanged; call
+       * update_ghost_values() after this function if they are needed.
+       */
+      void
+      load(const std::string &filename);
       /** @} */
 
       /**
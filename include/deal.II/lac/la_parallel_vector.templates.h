@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_large_count.h>
 
 #include <deal.II/lac/exceptions.h>
 #include <deal.II/lac/la_parallel_vector.h>
@@ -27,6 +28,8 @@
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector_operations_internal.h>
 
+#include <cstdint>
+#include <fstream>
 #include <memory>
 
 
@@ -1657,6 +1660,64 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::sadd(
+      const Number                                                s,
+      const std::vector<Number>                                  &a,
+      const std::vector<const Vector<Number, MemorySpaceType> *> &v)
+    {
+      AssertIsFinite(s);
+      AssertDimension(a.size(), v.size());
+
+      if (v.empty())
+        {
+          if (s != Number(1.))
+            *this *= s;
+          return;
+        }
+
+      constexpr unsigned int max_vectors = dealii::internal::VectorOperations::
+        Vectorization_sadd_xav_multi<Number>::max_vectors;
+
+      // the first sweep scales the current vector by s; the sweeps for any
+      // remaining source vectors must only add to the result
+      Number x = s;
+      for (std::size_t first = 0; first < v.size(); first += max_vectors)
+        {
+          const unsigned int n_vectors =
+            std::min<std::size_t>(max_vectors, v.size() - first);
+
+          std::array<Number, max_vectors>         a_chunk  = {};
+          std::array<const Number *, max_vectors> v_values = {};
+          for (unsigned int j = 0; j < n_vectors; ++j)
+            {
+              AssertIsFinite(a[first + j]);
+              AssertDimension(locally_owned_size(),
+                              v[first + j]->locally_owned_size());
+              a_chunk[j]  = a[first + j];
+              v_values[j] = v[first + j]->data.values.data();
+            }
+
+          dealii::internal::VectorOperations::
+            functions<Number, Number, MemorySpaceType>::sadd_xav_multi(
+              thread_loop_partitioner,
+              partitioner->locally_owned_size(),
+              x,
+              a_chunk,
+              v_values,
+              n_vectors,
+              data);
+
+          x = Number(1.);
+        }
+
+      if (vector_is_ghosted)
+        update_ghost_values();
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     Vector<Number, MemorySpaceType> &
     Vector<Number, MemorySpaceType>::operator*=(const Number factor)
@@ -2047,6 +2108,172 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::save(const std::string &filename) const
+    {
+      Assert(partitioner.get() != nullptr, ExcInternalError());
+
+      // the file stores the elements by global index, so it is independent
+      // of the partition: a small header with the global size and the size
+      // of the number type, followed by the elements in ascending global
+      // index order. every process writes the contiguous slice of the file
+      // corresponding to its locally owned range.
+      const std::uint64_t header[2] = {
+        static_cast<std::uint64_t>(partitioner->size()),
+        static_cast<std::uint64_t>(sizeof(Number))};
+
+      // stage the locally owned range in a host buffer, which also covers
+      // vectors whose data lives in device memory
+      std::vector<Number> stored_elements(partitioner->locally_owned_size());
+      data.copy_to(stored_elements.data(), stored_elements.size());
+
+#ifdef DEAL_II_WITH_MPI
+      const MPI_Comm comm = partitioner->get_mpi_communicator();
+
+      MPI_Info info;
+      int      ierr = MPI_Info_create(&info);
+      AssertThrowMPI(ierr);
+
+      MPI_File fh;
+      ierr = MPI_File_open(
+        comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, info, &fh);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_File_set_size(fh, 0); // delete the file contents
+      AssertThrowMPI(ierr);
+      // this barrier is necessary, because otherwise others might already
+      // write while one core is still setting the size to zero.
+      ierr = MPI_Barrier(comm);
+      AssertThrowMPI(ierr);
+      ierr = MPI_Info_free(&info);
+      AssertThrowMPI(ierr);
+
+      if (partitioner->this_mpi_process() == 0)
+        {
+          ierr = MPI_File_write_at(
+            fh,
+            0,
+            header,
+            2,
+            Utilities::MPI::mpi_type_id_for_type<std::uint64_t>,
+            MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+
+      const MPI_Offset data_offset =
+        sizeof(header) + static_cast<MPI_Offset>(partitioner->local_range().first) *
+                           sizeof(Number);
+      ierr = Utilities::MPI::LargeCount::File_write_at_all_c(
+        fh,
+        data_offset,
+        stored_elements.data(),
+        stored_elements.size(),
+        Utilities::MPI::mpi_type_id_for_type<Number>,
+        MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_File_close(&fh);
+      AssertThrowMPI(ierr);
+#else
+      std::ofstream out(filename, std::ios::binary);
+      AssertThrow(out.fail() == false, ExcIO());
+      out.write(reinterpret_cast<const char *>(header), sizeof(header));
+      out.write(reinterpret_cast<const char *>(stored_elements.data()),
+                stored_elements.size() * sizeof(Number));
+      AssertThrow(out.fail() == false, ExcIO());
+#endif
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::load(const std::string &filename)
+    {
+      Assert(partitioner.get() != nullptr, ExcInternalError());
+
+      std::uint64_t       header[2];
+      std::vector<Number> stored_elements(partitioner->locally_owned_size());
+
+#ifdef DEAL_II_WITH_MPI
+      const MPI_Comm comm = partitioner->get_mpi_communicator();
+
+      MPI_Info info;
+      int      ierr = MPI_Info_create(&info);
+      AssertThrowMPI(ierr);
+
+      MPI_File fh;
+      ierr = MPI_File_open(comm, filename.c_str(), MPI_MODE_RDONLY, info, &fh);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_Info_free(&info);
+      AssertThrowMPI(ierr);
+
+      ierr =
+        MPI_File_read_at_all(fh,
+                             0,
+                             header,
+                             2,
+                             Utilities::MPI::mpi_type_id_for_type<std::uint64_t>,
+                             MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      AssertThrow(header[0] == partitioner->size(),
+                  ExcMessage("The global size stored in the file '" + filename +
+                             "' is " + std::to_string(header[0]) +
+                             ", but the vector has global size " +
+                             std::to_string(partitioner->size()) + "."));
+      AssertThrow(header[1] == sizeof(Number),
+                  ExcMessage("The file '" + filename +
+                             "' stores elements of a number type with " +
+                             std::to_string(header[1]) +
+                             " bytes, but the vector stores elements with " +
+                             std::to_string(sizeof(Number)) + " bytes."));
+
+      const MPI_Offset data_offset =
+        sizeof(header) + static_cast<MPI_Offset>(partitioner->local_range().first) *
+                           sizeof(Number);
+      ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
+        fh,
+        data_offset,
+        stored_elements.data(),
+        stored_elements.size(),
+        Utilities::MPI::mpi_type_id_for_type<Number>,
+        MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_File_close(&fh);
+      AssertThrowMPI(ierr);
+#else
+      std::ifstream in(filename, std::ios::binary);
+      AssertThrow(in.fail() == false, ExcIO());
+      in.read(reinterpret_cast<char *>(header), sizeof(header));
+
+      AssertThrow(header[0] == partitioner->size(),
+                  ExcMessage("The global size stored in the file '" + filename +
+                             "' is " + std::to_string(header[0]) +
+                             ", but the vector has global size " +
+                             std::to_string(partitioner->size()) + "."));
+      AssertThrow(header[1] == sizeof(Number),
+                  ExcMessage("The file '" + filename +
+                             "' stores elements of a number type with " +
+                             std::to_string(header[1]) +
+                             " bytes, but the vector stores elements with " +
+                             std::to_string(sizeof(Number)) + " bytes."));
+
+      in.seekg(sizeof(header) +
+               partitioner->local_range().first * sizeof(Number));
+      in.read(reinterpret_cast<char *>(stored_elements.data()),
+              stored_elements.size() * sizeof(Number));
+      AssertThrow(in.fail() == false, ExcIO());
+#endif
+
+      data.copy_from(stored_elements.data(), stored_elements.size());
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Vector<Number, MemorySpaceType>::print(std::ostream      &out,
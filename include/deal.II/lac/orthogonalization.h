@@ -29,29 +29,38 @@ namespace LinearAlgebra
   enum class OrthogonalizationStrategy
   {
     /**
-     * Use modified Gram-Schmidt algorithm.
+     * Use modified Gram-Schmidt algorithm. Note that each inner product of
+     * this algorithm involves a separate global reduction, i.e., $n+1$
+     * synchronization points for orthogonalizing against $n$ vectors, which
+     * makes this the most expensive variant in terms of communication
+     * latency on large parallel machines.
      */
     modified_gram_schmidt,
     /**
      * Use classical Gram-Schmidt algorithm. Since this approach works on
-     * multi-vectors with a single global reduction (of multiple elements), it
-     * is more efficient than the modified Gram-Schmidt algorithm. However, it
-     * is less stable in terms of roundoff error propagation, requiring
-     * additional re-orthogonalization steps more frequently.
+     * multi-vectors with a single global reduction (of multiple elements)
+     * for the projections, followed by a second reduction for the norm of
+     * the resulting vector, it is more efficient than the modified
+     * Gram-Schmidt algorithm. However, it is less stable in terms of
+     * roundoff error propagation, requiring additional re-orthogonalization
+     * steps more frequently.
      */
     classical_gram_schmidt,
     /**
      * Use classical Gram-Schmidt algorithm with two orthogonalization
      * iterations and delayed orthogonalization using the algorithm described
-     * in @cite Bielich2022. This approach works on multi-vectors with a
-     * single global reduction (of multiple elements) and is more efficient
-     * than the modified Gram-Schmidt algorithm. At the same time, it
-     * unconditionally performs the second orthogonalization step, making it
-     * more stable than the classical Gram-Schmidt variant. For deal.II's own
-     * vectors, there is no additional cost compared to the classical
-     * Gram-Schmidt algorithm, because the second orthogonalization step is
-     * done on cached data. For these beneficial reasons, this is the default
-     * algorithm in the SolverGMRES class.
+     * in @cite Bielich2022, which belongs to the class of low-synchronization
+     * Gram-Schmidt variants introduced by @cite Swirydowicz2020. This
+     * approach works on multi-vectors and combines the projections, the
+     * delayed re-orthogonalization, and the (delayed) normalization into a
+     * single global reduction (of multiple elements) per iteration, and is
+     * therefore the variant with the lowest communication latency. At the
+     * same time, it unconditionally performs the second orthogonalization
+     * step, making it more stable than the classical Gram-Schmidt variant.
+     * For deal.II's own vectors, there is no additional cost compared to the
+     * classical Gram-Schmidt algorithm, because the second orthogonalization
+     * step is done on cached data. For these beneficial reasons, this is the
+     * default algorithm in the SolverGMRES class.
      */
     delayed_classical_gram_schmidt
   };
@@ -600,6 +600,24 @@ namespace PETScWrappers
     void
     compress(const VectorOperation::values operation);
 
+    /**
+     * Exchange the entries that have been accumulated for rows owned by
+     * other MPI processes with their owners, without finalizing the matrix.
+     * In contrast to compress(), entries can still be added or set after
+     * this call. Calling this function periodically during a long assembly
+     * loop keeps the off-process send buffers small and moves part of the
+     * data exchange into the assembly phase, so that the final compress()
+     * call has little data left to communicate.
+     *
+     * This function is collective over the underlying communicator: all MPI
+     * processes have to call it, including those that have not accumulated
+     * any off-process entries. As with compress(), all processes have to
+     * perform the same kind of operation (adding or inserting) before and
+     * after this call.
+     */
+    void
+    flush_assembly();
+
     /**
      * Return the value of the entry (<i>i,j</i>).  This may be an expensive
      * operation and you should always take care where to call this function.
@@ -19,9 +19,14 @@
 #include <deal.II/base/config.h>
 
 #ifdef DEAL_II_WITH_PETSC
+#  include <deal.II/base/smartpointer.h>
+
 #  include <deal.II/lac/exceptions.h>
+#  include <deal.II/lac/la_parallel_vector.h>
 #  include <deal.II/lac/petsc_matrix_base.h>
 #  include <deal.II/lac/petsc_vector.h>
+
+#  include <algorithm>
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -274,6 +279,286 @@ namespace PETScWrappers
 
 
 
+  /**
+   * A matrix class that presents an existing matrix-free operator --
+   * typically one derived from MatrixFreeOperators::Base -- to PETSc as a
+   * shell matrix. This makes it possible to hand an operator that is only
+   * available through its action on a vector to PETSc solvers, in particular
+   * as the Jacobian of a PETScWrappers::NonlinearSolver or
+   * PETScWrappers::TimeStepper via their <tt>set_matrix()</tt> functions, and
+   * have PETSc's Krylov solvers apply it without ever assembling a sparse
+   * matrix.
+   *
+   * The @p OperatorType class needs to provide the member functions
+   * <tt>initialize_dof_vector(VectorType &)</tt>, <tt>vmult(VectorType &,
+   * const VectorType &)</tt>, and <tt>Tvmult(VectorType &, const VectorType
+   * &)</tt>, where @p VectorType is the second template argument of this
+   * class. If the operator also provides <tt>get_matrix_diagonal()</tt> with
+   * previously computed diagonal entries (see
+   * MatrixFreeOperators::Base::compute_diagonal()), then this class
+   * additionally registers the diagonal with the PETSc shell matrix, so that
+   * Jacobi-type preconditioners such as <tt>PCJACOBI</tt> can be used on the
+   * PETSc side.
+   *
+   * Since deal.II's distributed vectors cannot alias memory owned by PETSc,
+   * every application of the operator copies the locally owned range of the
+   * source vector from PETSc memory into a scratch vector and the result
+   * back; ghost values are exchanged by the wrapped operator itself. No
+   * global communication or allocation happens after construction.
+   *
+   * @ingroup PETScWrappers
+   * @ingroup Matrix1
+   */
+  template <typename OperatorType,
+            typename VectorType =
+              LinearAlgebra::distributed::Vector<PetscScalar>>
+  class MatrixFreeOperatorShell : public MatrixFree
+  {
+    static_assert(
+      std::is_same_v<typename VectorType::value_type, PetscScalar>,
+      "The vector type used by the wrapped operator must store elements "
+      "of type PetscScalar.");
+
+  public:
+    /**
+     * Constructor. Wrap the given @p matrix_free_operator, whose vector
+     * layout determines the size and parallel partitioning of this matrix.
+     * The operator object needs to live at least as long as the present
+     * object.
+     */
+    MatrixFreeOperatorShell(const MPI_Comm      communicator,
+                            const OperatorType &matrix_free_operator);
+
+    /**
+     * Matrix-vector multiplication <i>dst = M*src</i> performed by the
+     * wrapped operator.
+     */
+    virtual void
+    vmult(VectorBase &dst, const VectorBase &src) const override;
+
+    /**
+     * Transpose matrix-vector multiplication <i>dst = M<sup>T</sup>*src</i>
+     * performed by the wrapped operator.
+     */
+    virtual void
+    Tvmult(VectorBase &dst, const VectorBase &src) const override;
+
+    /**
+     * Adding matrix-vector multiplication <i>dst += M*src</i> performed by
+     * the wrapped operator.
+     */
+    virtual void
+    vmult_add(VectorBase &dst, const VectorBase &src) const override;
+
+    /**
+     * Adding transpose matrix-vector multiplication <i>dst +=
+     * M<sup>T</sup>*src</i> performed by the wrapped operator.
+     */
+    virtual void
+    Tvmult_add(VectorBase &dst, const VectorBase &src) const override;
+
+  private:
+    /**
+     * Callback-function registered as <tt>MATOP_GET_DIAGONAL</tt> of this
+     * shell matrix. It copies the diagonal entries stored by the wrapped
+     * operator into the PETSc vector @p dst.
+     */
+    static int
+    matrix_free_get_diagonal(Mat A, Vec dst);
+
+    /**
+     * Copy the locally owned range of the PETSc vector @p src into the
+     * deal.II vector @p dst.
+     */
+    void
+    copy_from_petsc(const VectorBase &src, VectorType &dst) const;
+
+    /**
+     * Copy (or, if @p add_into is true, add) the locally owned range of the
+     * deal.II vector @p src into the PETSc vector @p dst.
+     */
+    void
+    copy_to_petsc(const VectorType &src,
+                  VectorBase       &dst,
+                  const bool        add_into) const;
+
+    /**
+     * Pointer to the operator whose action this matrix represents.
+     */
+    SmartPointer<const OperatorType,
+                 MatrixFreeOperatorShell<OperatorType, VectorType>>
+      matrix_free_operator;
+
+    /**
+     * Scratch vectors used to move data between PETSc and deal.II memory
+     * in the matrix-vector products.
+     */
+    mutable VectorType src_scratch;
+    mutable VectorType dst_scratch;
+  };
+
+
+#  ifndef DOXYGEN
+
+  // ------------------------- inline and template functions ----------------
+
+
+  template <typename OperatorType, typename VectorType>
+  MatrixFreeOperatorShell<OperatorType, VectorType>::MatrixFreeOperatorShell(
+    const MPI_Comm      communicator,
+    const OperatorType &matrix_free_operator)
+    : matrix_free_operator(&matrix_free_operator)
+  {
+    this->matrix_free_operator->initialize_dof_vector(src_scratch);
+    this->matrix_free_operator->initialize_dof_vector(dst_scratch);
+
+    reinit(communicator,
+           static_cast<unsigned int>(dst_scratch.size()),
+           static_cast<unsigned int>(src_scratch.size()),
+           static_cast<unsigned int>(dst_scratch.locally_owned_size()),
+           static_cast<unsigned int>(src_scratch.locally_owned_size()));
+
+    // in addition to the matrix-vector product set up by the base class,
+    // expose the operator's diagonal so that PETSc's Jacobi-type
+    // preconditioners can be used with this matrix
+    const PetscErrorCode ierr =
+      MatShellSetOperation(petsc_matrix(),
+                           MATOP_GET_DIAGONAL,
+                           reinterpret_cast<void (*)()>(
+                             &matrix_free_get_diagonal));
+    AssertThrow(ierr == 0, ExcPETScError(ierr));
+  }
+
+
+
+  template <typename OperatorType, typename VectorType>
+  void
+  MatrixFreeOperatorShell<OperatorType, VectorType>::vmult(
+    VectorBase       &dst,
+    const VectorBase &src) const
+  {
+    copy_from_petsc(src, src_scratch);
+    matrix_free_operator->vmult(dst_scratch, src_scratch);
+    copy_to_petsc(dst_scratch, dst, /* add_into = */ false);
+  }
+
+
+
+  template <typename OperatorType, typename VectorType>
+  void
+  MatrixFreeOperatorShell<OperatorType, VectorType>::Tvmult(
+    VectorBase       &dst,
+    const VectorBase &src) const
+  {
+    copy_from_petsc(src, src_scratch);
+    matrix_free_operator->Tvmult(dst_scratch, src_scratch);
+    copy_to_petsc(dst_scratch, dst, /* add_into = */ false);
+  }
+
+
+
+  template <typename OperatorType, typename VectorType>
+  void
+  MatrixFreeOperatorShell<OperatorType, VectorType>::vmult_add(
+    VectorBase       &dst,
+    const VectorBase &src) const
+  {
+    copy_from_petsc(src, src_scratch);
+    matrix_free_operator->vmult(dst_scratch, src_scratch);
+    copy_to_petsc(dst_scratch, dst, /* add_into = */ true);
+  }
+
+
+
+  template <typename OperatorType, typename VectorType>
+  void
+  MatrixFreeOperatorShell<OperatorType, VectorType>::Tvmult_add(
+    VectorBase       &dst,
+    const VectorBase &src) const
+  {
+    copy_from_petsc(src, src_scratch);
+    matrix_free_operator->Tvmult(dst_scratch, src_scratch);
+    copy_to_petsc(dst_scratch, dst, /* add_into = */ true);
+  }
+
+
+
+  template <typename OperatorType, typename VectorType>
+  int
+  MatrixFreeOperatorShell<OperatorType, VectorType>::matrix_free_get_diagonal(
+    Mat A,
+    Vec dst)
+  {
+    // the shell matrix stores a pointer to its base-class subobject as the
+    // context, see MatrixFree::do_reinit()
+    void          *this_object;
+    PetscErrorCode ierr = MatShellGetContext(A, &this_object);
+    AssertThrow(ierr == 0, ExcPETScError(ierr));
+
+    const auto &matrix =
+      *static_cast<const MatrixFreeOperatorShell<OperatorType, VectorType> *>(
+        static_cast<const MatrixFree *>(this_object));
+
+    // get_matrix_diagonal() asserts that the diagonal has been computed
+    // before, e.g., by MatrixFreeOperators::Base::compute_diagonal()
+    const auto diagonal = matrix.matrix_free_operator->get_matrix_diagonal();
+
+    VectorBase dst_dealii(dst);
+    matrix.copy_to_petsc(diagonal->get_vector(),
+                         dst_dealii,
+                         /* add_into = */ false);
+    return 0;
+  }
+
+
+
+  template <typename OperatorType, typename VectorType>
+  void
+  MatrixFreeOperatorShell<OperatorType, VectorType>::copy_from_petsc(
+    const VectorBase &src,
+    VectorType       &dst) const
+  {
+    AssertDimension(src.locally_owned_size(), dst.locally_owned_size());
+
+    const PetscScalar *src_array;
+    PetscErrorCode     ierr = VecGetArrayRead(src, &src_array);
+    AssertThrow(ierr == 0, ExcPETScError(ierr));
+
+    std::copy(src_array, src_array + dst.locally_owned_size(), dst.begin());
+
+    ierr = VecRestoreArrayRead(src, &src_array);
+    AssertThrow(ierr == 0, ExcPETScError(ierr));
+  }
+
+
+
+  template <typename OperatorType, typename VectorType>
+  void
+  MatrixFreeOperatorShell<OperatorType, VectorType>::copy_to_petsc(
+    const VectorType &src,
+    VectorBase       &dst,
+    const bool        add_into) const
+  {
+    AssertDimension(src.locally_owned_size(), dst.locally_owned_size());
+
+    PetscScalar   *dst_array;
+    PetscErrorCode ierr = VecGetArray(dst.petsc_vector(), &dst_array);
+    AssertThrow(ierr == 0, ExcPETScError(ierr));
+
+    if (add_into)
+      for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+        dst_array[i] += src.local_element(i);
+    else
+      std::copy(src.begin(),
+                src.begin() + src.locally_owned_size(),
+                dst_array);
+
+    ierr = VecRestoreArray(dst.petsc_vector(), &dst_array);
+    AssertThrow(ierr == 0, ExcPETScError(ierr));
+  }
+
+#  endif // DOXYGEN
+
 } // namespace PETScWrappers
 
 DEAL_II_NAMESPACE_CLOSE
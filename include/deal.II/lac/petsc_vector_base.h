@@ -305,6 +305,30 @@ namespace PETScWrappers
     void
     compress(const VectorOperation::values operation);
 
+    /**
+     * Start the communication of compress(), i.e., flush the buffers of the
+     * underlying PETSc object, but do not wait for the data exchange to
+     * finish. This allows overlapping the communication with computations
+     * that do not touch this vector. The call must be followed by a call to
+     * compress_finish() with the same @p operation before the vector is used
+     * again.
+     *
+     * The @p communication_channel argument exists for interface
+     * compatibility with LinearAlgebra::distributed::Vector and is ignored
+     * here, since PETSc manages the message tags of the exchange itself.
+     */
+    void
+    compress_start(const unsigned int            communication_channel = 0,
+                   const VectorOperation::values operation = VectorOperation::add);
+
+    /**
+     * Wait for the data exchange initiated by compress_start() to finish and
+     * insert or add the communicated data, see compress(). Must follow a
+     * call to compress_start().
+     */
+    void
+    compress_finish(const VectorOperation::values operation);
+
     /**
      * The copy assignment operator.
      */
@@ -424,6 +448,28 @@ namespace PETScWrappers
     void
     update_ghost_values() const;
 
+    /**
+     * Start the communication of update_ghost_values(), but do not wait for
+     * the data exchange to finish. This allows overlapping the communication
+     * with computations that do not read the ghost elements of this vector.
+     * The call must be followed by a call to update_ghost_values_finish()
+     * before ghost elements are read.
+     *
+     * The @p communication_channel argument exists for interface
+     * compatibility with LinearAlgebra::distributed::Vector and is ignored
+     * here, since PETSc manages the message tags of the exchange itself.
+     */
+    void
+    update_ghost_values_start(const unsigned int communication_channel = 0) const;
+
+    /**
+     * Wait for the data exchange initiated by update_ghost_values_start() to
+     * finish. Must follow a call to update_ghost_values_start() before
+     * reading data from ghost elements.
+     */
+    void
+    update_ghost_values_finish() const;
+
     /**
      * Provide access to a given element, both read and write.
      */
@@ -1130,13 +1176,35 @@ namespace PETScWrappers
   inline void
   VectorBase::update_ghost_values() const
   {
+    update_ghost_values_start();
+    update_ghost_values_finish();
+  }
+
+
+
+  inline void
+  VectorBase::update_ghost_values_start(
+    const unsigned int communication_channel) const
+  {
+    (void)communication_channel;
+
     if (ghosted)
       {
-        PetscErrorCode ierr;
-
-        ierr = VecGhostUpdateBegin(vector, INSERT_VALUES, SCATTER_FORWARD);
+        const PetscErrorCode ierr =
+          VecGhostUpdateBegin(vector, INSERT_VALUES, SCATTER_FORWARD);
         AssertThrow(ierr == 0, ExcPETScError(ierr));
-        ierr = VecGhostUpdateEnd(vector, INSERT_VALUES, SCATTER_FORWARD);
+      }
+  }
+
+
+
+  inline void
+  VectorBase::update_ghost_values_finish() const
+  {
+    if (ghosted)
+      {
+        const PetscErrorCode ierr =
+          VecGhostUpdateEnd(vector, INSERT_VALUES, SCATTER_FORWARD);
         AssertThrow(ierr == 0, ExcPETScError(ierr));
       }
   }
@@ -2304,6 +2304,156 @@ private:
 
 
 
+/**
+ * This class adapts a preconditioner that operates on vectors of a lower
+ * (typically single) precision for use in an outer iteration that runs in a
+ * higher (typically double) precision. A common use case is a multigrid
+ * V-cycle whose level matrices are bandwidth bound, such as matrix-free
+ * operators for the Laplacian: the smoother, usually PreconditionChebyshev,
+ * spends almost all of its time streaming vector and matrix data through
+ * memory, so running the smoothing recurrence in single precision nearly
+ * halves the data volume and thus nearly doubles throughput, while the outer
+ * residual computation and the coarse-grid correction remain in double
+ * precision and keep the overall iteration accurate.
+ *
+ * The class stores a pointer to the inner preconditioner, which must have
+ * been initialized on a separate, lower-precision instantiation of the
+ * operator, and presents the usual vmult(), Tvmult(), step() and Tstep()
+ * interface in terms of the outer (higher-precision) vector type. Each call
+ * converts the source vector into internally managed scratch vectors of the
+ * inner type, applies the inner preconditioner, and converts the result
+ * back. The rounding introduced by these conversions is of the order of the
+ * single-precision machine epsilon and is harmless for smoothing purposes
+ * because a smoother only needs to reduce the high-frequency error
+ * components, not resolve them to full accuracy; the double-precision parts
+ * of the multigrid cycle restore the accuracy of the final result.
+ *
+ * A typical setup for a level smoother looks as follows, assuming that
+ * `laplace_operator_float` has been initialized with the same discretization
+ * as the double-precision level operator:
+ * @code
+ * using VectorTypeFloat = LinearAlgebra::distributed::Vector<float>;
+ *
+ * using SmootherTypeFloat =
+ *   PreconditionChebyshev<LaplaceOperatorFloat, VectorTypeFloat>;
+ *
+ * SmootherTypeFloat chebyshev;
+ * chebyshev.initialize(laplace_operator_float, chebyshev_data);
+ *
+ * PreconditionMixedPrecision<SmootherTypeFloat,
+ *                            LinearAlgebra::distributed::Vector<double>,
+ *                            VectorTypeFloat>
+ *   smoother;
+ * smoother.initialize(chebyshev);
+ * @endcode
+ * The resulting object can be handed to mg::SmootherRelaxation or
+ * MGSmootherPrecondition in the same way as a preconditioner running
+ * natively in double precision.
+ *
+ * Both vector types need to provide conversion between each other through
+ * their respective assignment operators, which is the case for the deal.II
+ * vector classes such as Vector and LinearAlgebra::distributed::Vector.
+ */
+template <typename PreconditionerType, typename VectorType,
+          typename InnerVectorType>
+class PreconditionMixedPrecision : public Subscriptor
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Initialize function. Stores a pointer to the given preconditioner, which
+   * must outlive the present object and must already have been initialized
+   * on the lower-precision representation of the operator.
+   */
+  void
+  initialize(const PreconditionerType &preconditioner);
+
+  /**
+   * Compute the action of the preconditioner on <tt>src</tt>, storing the
+   * result in <tt>dst</tt>. The source vector is converted to the inner
+   * vector type, the inner preconditioner is applied, and the result is
+   * converted back.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Compute the action of the transposed preconditioner on <tt>src</tt>,
+   * storing the result in <tt>dst</tt>.
+   */
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Perform one step of the preconditioned Richardson iteration. Note that
+   * both <tt>dst</tt> and <tt>src</tt> are converted to the inner precision
+   * before the step is delegated to the inner preconditioner, so the
+   * iterate is rounded to that precision as well.
+   */
+  void
+  step(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Perform one transposed step of the preconditioned Richardson iteration.
+   */
+  void
+  Tstep(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Resets the preconditioner, releasing the pointer to the inner
+   * preconditioner and the internal scratch vectors.
+   */
+  void
+  clear();
+
+  /**
+   * Return the dimension of the codomain (or range) space. Note that the
+   * matrix is of dimension $m \times n$.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the dimension of the domain space. Note that the matrix is of
+   * dimension $m \times n$.
+   */
+  size_type
+  n() const;
+
+private:
+  /**
+   * A pointer to the underlying lower-precision preconditioner.
+   */
+  SmartPointer<
+    const PreconditionerType,
+    PreconditionMixedPrecision<PreconditionerType, VectorType,
+                               InnerVectorType>>
+    preconditioner;
+
+  /**
+   * Internal lower-precision vector holding the converted source.
+   */
+  mutable InnerVectorType vector_src;
+
+  /**
+   * Internal lower-precision vector holding the result of the inner
+   * preconditioner.
+   */
+  mutable InnerVectorType vector_dst;
+
+  /**
+   * A mutex to avoid that multiple vmult() invocations by different threads
+   * overwrite the temporary vectors.
+   */
+  mutable Threads::Mutex mutex;
+};
+
+
+
 /** @} */
 /* ---------------------------------- Inline functions ------------------- */
 
@@ -4160,6 +4310,122 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::n() const
   return matrix_ptr->n();
 }
 
+
+
+//---------------------------------------------------------------------------
+
+template <typename PreconditionerType, typename VectorType,
+          typename InnerVectorType>
+inline void
+PreconditionMixedPrecision<PreconditionerType, VectorType, InnerVectorType>::
+  initialize(const PreconditionerType &preconditioner)
+{
+  this->preconditioner = &preconditioner;
+}
+
+
+
+template <typename PreconditionerType, typename VectorType,
+          typename InnerVectorType>
+inline void
+PreconditionMixedPrecision<PreconditionerType, VectorType, InnerVectorType>::
+  vmult(VectorType &dst, const VectorType &src) const
+{
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+  std::lock_guard<std::mutex> lock(mutex);
+  vector_src = src;
+  vector_dst.reinit(vector_src, true);
+  preconditioner->vmult(vector_dst, vector_src);
+  dst = vector_dst;
+}
+
+
+
+template <typename PreconditionerType, typename VectorType,
+          typename InnerVectorType>
+inline void
+PreconditionMixedPrecision<PreconditionerType, VectorType, InnerVectorType>::
+  Tvmult(VectorType &dst, const VectorType &src) const
+{
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+  std::lock_guard<std::mutex> lock(mutex);
+  vector_src = src;
+  vector_dst.reinit(vector_src, true);
+  preconditioner->Tvmult(vector_dst, vector_src);
+  dst = vector_dst;
+}
+
+
+
+template <typename PreconditionerType, typename VectorType,
+          typename InnerVectorType>
+inline void
+PreconditionMixedPrecision<PreconditionerType, VectorType, InnerVectorType>::
+  step(VectorType &dst, const VectorType &src) const
+{
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+  std::lock_guard<std::mutex> lock(mutex);
+  vector_src = src;
+  vector_dst = dst;
+  preconditioner->step(vector_dst, vector_src);
+  dst = vector_dst;
+}
+
+
+
+template <typename PreconditionerType, typename VectorType,
+          typename InnerVectorType>
+inline void
+PreconditionMixedPrecision<PreconditionerType, VectorType, InnerVectorType>::
+  Tstep(VectorType &dst, const VectorType &src) const
+{
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+  std::lock_guard<std::mutex> lock(mutex);
+  vector_src = src;
+  vector_dst = dst;
+  preconditioner->Tstep(vector_dst, vector_src);
+  dst = vector_dst;
+}
+
+
+
+template <typename PreconditionerType, typename VectorType,
+          typename InnerVectorType>
+inline void
+PreconditionMixedPrecision<PreconditionerType, VectorType, InnerVectorType>::
+  clear()
+{
+  preconditioner = nullptr;
+  vector_src     = InnerVectorType();
+  vector_dst     = InnerVectorType();
+}
+
+
+
+template <typename PreconditionerType, typename VectorType,
+          typename InnerVectorType>
+inline typename PreconditionMixedPrecision<PreconditionerType, VectorType,
+                                           InnerVectorType>::size_type
+PreconditionMixedPrecision<PreconditionerType, VectorType, InnerVectorType>::
+  m() const
+{
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+  return preconditioner->m();
+}
+
+
+
+template <typename PreconditionerType, typename VectorType,
+          typename InnerVectorType>
+inline typename PreconditionMixedPrecision<PreconditionerType, VectorType,
+                                           InnerVectorType>::size_type
+PreconditionMixedPrecision<PreconditionerType, VectorType, InnerVectorType>::
+  n() const
+{
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+  return preconditioner->n();
+}
+
 #endif // DOXYGEN
 
 DEAL_II_NAMESPACE_CLOSE
@@ -129,32 +129,85 @@ namespace LinearAlgebra
         const VectorOperation::values                     operation,
         ::dealii::LinearAlgebra::ReadWriteVector<Number> &rw_vector)
       {
-        distributed::Vector<Number, ::dealii::MemorySpace::Host> tmp_vector(
-          communication_pattern);
+        // Gather the ghost entries of the source array, i.e., those stored
+        // elements that are not locally owned by the source vector. All other
+        // elements are read directly out of @p values below, so only the
+        // entries that actually travel between processes pass through the
+        // import and ghost buffers; in particular, we do not stage a copy of
+        // the whole locally owned array in a temporary vector.
+        const unsigned int n_ghosts = communication_pattern->n_ghost_indices();
+        std::vector<Number> ghost_values(n_ghosts);
+#ifdef DEAL_II_WITH_MPI
+        if (n_ghosts > 0 || communication_pattern->n_import_indices() > 0)
+          {
+            std::vector<Number> import_buffer(
+              communication_pattern->n_import_indices());
+            std::vector<MPI_Request> requests;
+            communication_pattern->export_to_ghosted_array_start(
+              0,
+              ArrayView<const Number>(
+                values, communication_pattern->locally_owned_size()),
+              make_array_view(import_buffer),
+              make_array_view(ghost_values),
+              requests);
+            communication_pattern->export_to_ghosted_array_finish(
+              make_array_view(ghost_values), requests);
+          }
+#endif
 
-        const unsigned int n_elements =
+        const std::pair<size_type, size_type> local_range =
+          communication_pattern->local_range();
+        const unsigned int n_owned =
           communication_pattern->locally_owned_size();
-        std::copy(values, values + n_elements, tmp_vector.begin());
-        tmp_vector.update_ghost_values();
 
+        const auto process_range =
+          [operation](const Number *source, Number *destination, const size_type n) {
+            if (operation == VectorOperation::add)
+              for (size_type j = 0; j < n; ++j)
+                destination[j] += source[j];
+            else if (operation == VectorOperation::min)
+              for (size_type j = 0; j < n; ++j)
+                destination[j] = get_min(source[j], destination[j]);
+            else if (operation == VectorOperation::max)
+              for (size_type j = 0; j < n; ++j)
+                destination[j] = get_max(source[j], destination[j]);
+            else
+              std::copy(source, source + n, destination);
+          };
+
+        // Go through the stored elements interval by interval: intervals that
+        // lie inside the locally owned range of the source vector are
+        // processed in one go directly from the source array, only elements
+        // outside that range need the indirection through the ghost buffer.
         const IndexSet &stored = rw_vector.get_stored_elements();
-        if (operation == VectorOperation::add)
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) +=
-              tmp_vector(stored.nth_index_in_set(i));
-        else if (operation == VectorOperation::min)
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) =
-              get_min(tmp_vector(stored.nth_index_in_set(i)),
-                      rw_vector.local_element(i));
-        else if (operation == VectorOperation::max)
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) =
-              get_max(tmp_vector(stored.nth_index_in_set(i)),
-                      rw_vector.local_element(i));
-        else
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) = tmp_vector(stored.nth_index_in_set(i));
+        Number         *destination = rw_vector.begin();
+        size_type       position    = 0;
+        for (auto interval = stored.begin_intervals();
+             interval != stored.end_intervals();
+             ++interval)
+          {
+            const size_type begin = *interval->begin();
+            const size_type end   = interval->last() + 1;
+            if (begin >= local_range.first && end <= local_range.second)
+              {
+                process_range(values + (begin - local_range.first),
+                              destination + position,
+                              end - begin);
+                position += end - begin;
+              }
+            else
+              for (size_type idx = begin; idx < end; ++idx, ++position)
+                {
+                  const unsigned int local_index =
+                    communication_pattern->global_to_local(idx);
+                  const Number source_value =
+                    local_index < n_owned ?
+                      values[local_index] :
+                      ghost_values[local_index - n_owned];
+                  process_range(&source_value, destination + position, 1);
+                }
+          }
+        AssertDimension(position, stored.n_elements());
       }
     };
 
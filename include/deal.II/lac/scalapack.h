@@ -605,6 +605,52 @@ public:
   compute_SVD(ScaLAPACKMatrix<NumberType> *U  = nullptr,
               ScaLAPACKMatrix<NumberType> *VT = nullptr);
 
+  /**
+   * Computing an approximate rank-@p rank singular value decomposition of the
+   * matrix $\mathbf{A} \in \mathbb{R}^{M \times N}$ using the randomized
+   * range-finder algorithm of Halko, Martinsson and Tropp (SIAM Review,
+   * 53(2), 2011): a Gaussian random matrix $\mathbf{\Omega} \in
+   * \mathbb{R}^{N \times (\text{rank} + p)}$ is used to sample the range of
+   * $\mathbf{A}$, the sample $\mathbf{Y} = \mathbf{A} \cdot \mathbf{\Omega}$
+   * is orthonormalized into $\mathbf{Q}$ by a QR factorization, and the
+   * singular value decomposition of the small matrix $\mathbf{B} =
+   * \mathbf{Q}^T \cdot \mathbf{A} \in \mathbb{R}^{(\text{rank} + p) \times
+   * N}$ then yields the approximate factorization $\mathbf{A} \approx
+   * \mathbf{U} \cdot \mathbf{\Sigma} \cdot \mathbf{V}^T$. The parameter
+   * $p$ is the @p oversampling and the optional @p n_power_iterations
+   * subspace iterations $\mathbf{Y} \leftarrow \mathbf{A} \cdot \mathbf{A}^T
+   * \cdot \mathbf{Y}$ improve the accuracy for matrices with slowly decaying
+   * singular values.
+   *
+   * In contrast to compute_SVD(), only matrices of size $M \times
+   * \text{rank}$ for $\mathbf{U}$ and $\text{rank} \times N$ for
+   * $\mathbf{V}^T$ are needed, never a full $M \times M$ or $N \times N$
+   * matrix, so that low-rank factorizations of strongly rectangular
+   * matrices, e.g. snapshot matrices in model order reduction, become
+   * feasible. The matrix $\mathbf{A}$ is only accessed through
+   * matrix-matrix products and its content is preserved.
+   *
+   * The function returns the first @p rank approximate singular values in
+   * decreasing order. To avoid computing the left and/or right singular
+   * vectors the function accepts <code>nullptr</code> for @p U and/or @p VT.
+   * The matrices $\mathbf{U}$ and $\mathbf{V}^T$ must be constructed with
+   * the same process grid and block sizes as $\mathbf{A}$, and the block
+   * cyclic distribution of $\mathbf{A}$ must be identical for rows and
+   * columns.
+   *
+   * @p seed controls the generation of the random test matrix and allows to
+   * reproduce a factorization; the sequence additionally depends on the
+   * process rank so that no communication is needed to fill
+   * $\mathbf{\Omega}$.
+   */
+  std::vector<NumberType>
+  compute_randomized_SVD(const unsigned int           rank,
+                         ScaLAPACKMatrix<NumberType> *U  = nullptr,
+                         ScaLAPACKMatrix<NumberType> *VT = nullptr,
+                         const unsigned int           oversampling       = 10,
+                         const unsigned int           n_power_iterations = 2,
+                         const unsigned int           seed               = 0);
+
   /**
    * Solving overdetermined or underdetermined real linear
    * systems involving matrix $\mathbf{A} \in \mathbb{R}^{M \times N}$, or its
@@ -879,6 +925,14 @@ private:
   void
   load_parallel(const std::string &filename);
 
+  /*
+   * Replaces the columns of the matrix by an orthonormal basis of its
+   * column space, computed through a QR factorization. The matrix must have
+   * at least as many rows as columns. Used by compute_randomized_SVD().
+   */
+  void
+  orthonormalize_columns();
+
   /**
    * Since ScaLAPACK operations notoriously change the meaning of the matrix
    * entries, we record the current state after the last operation here.
@@ -804,6 +804,63 @@ extern "C"
           int        *lwork,
           int        *info);
 
+  /*
+   * P_GEQRF computes a QR factorization of an M-by-N distributed matrix
+   * A = Q * R.
+   */
+  void
+  pdgeqrf_(const int *m,
+           const int *n,
+           double    *A,
+           const int *ia,
+           const int *ja,
+           const int *desca,
+           double    *tau,
+           double    *work,
+           const int *lwork,
+           int       *info);
+  void
+  psgeqrf_(const int *m,
+           const int *n,
+           float     *A,
+           const int *ia,
+           const int *ja,
+           const int *desca,
+           float     *tau,
+           float     *work,
+           const int *lwork,
+           int       *info);
+
+  /*
+   * P_ORGQR generates an M-by-N distributed matrix Q with orthonormal
+   * columns, which is defined as the first N columns of a product of K
+   * elementary reflectors as returned by P_GEQRF.
+   */
+  void
+  pdorgqr_(const int    *m,
+           const int    *n,
+           const int    *k,
+           double       *A,
+           const int    *ia,
+           const int    *ja,
+           const int    *desca,
+           const double *tau,
+           double       *work,
+           const int    *lwork,
+           int          *info);
+  void
+  psorgqr_(const int   *m,
+           const int   *n,
+           const int   *k,
+           float       *A,
+           const int   *ia,
+           const int   *ja,
+           const int   *desca,
+           const float *tau,
+           float       *work,
+           const int   *lwork,
+           int         *info);
+
   /*
    * Perform matrix sum:
    * @f{equation*}{
@@ -2019,6 +2076,103 @@ pgels(const char *trans,
 }
 
 
+template <typename number>
+inline void
+pgeqrf(const int * /*m*/,
+       const int * /*n*/,
+       number * /*A*/,
+       const int * /*ia*/,
+       const int * /*ja*/,
+       const int * /*desca*/,
+       number * /*tau*/,
+       number * /*work*/,
+       const int * /*lwork*/,
+       int * /*info*/)
+{
+  DEAL_II_NOT_IMPLEMENTED();
+}
+
+inline void
+pgeqrf(const int *m,
+       const int *n,
+       double    *A,
+       const int *ia,
+       const int *ja,
+       const int *desca,
+       double    *tau,
+       double    *work,
+       const int *lwork,
+       int       *info)
+{
+  pdgeqrf_(m, n, A, ia, ja, desca, tau, work, lwork, info);
+}
+
+inline void
+pgeqrf(const int *m,
+       const int *n,
+       float     *A,
+       const int *ia,
+       const int *ja,
+       const int *desca,
+       float     *tau,
+       float     *work,
+       const int *lwork,
+       int       *info)
+{
+  psgeqrf_(m, n, A, ia, ja, desca, tau, work, lwork, info);
+}
+
+
+template <typename number>
+inline void
+porgqr(const int * /*m*/,
+       const int * /*n*/,
+       const int * /*k*/,
+       number * /*A*/,
+       const int * /*ia*/,
+       const int * /*ja*/,
+       const int * /*desca*/,
+       const number * /*tau*/,
+       number * /*work*/,
+       const int * /*lwork*/,
+       int * /*info*/)
+{
+  DEAL_II_NOT_IMPLEMENTED();
+}
+
+inline void
+porgqr(const int    *m,
+       const int    *n,
+       const int    *k,
+       double       *A,
+       const int    *ia,
+       const int    *ja,
+       const int    *desca,
+       const double *tau,
+       double       *work,
+       const int    *lwork,
+       int          *info)
+{
+  pdorgqr_(m, n, k, A, ia, ja, desca, tau, work, lwork, info);
+}
+
+inline void
+porgqr(const int   *m,
+       const int   *n,
+       const int   *k,
+       float       *A,
+       const int   *ia,
+       const int   *ja,
+       const int   *desca,
+       const float *tau,
+       float       *work,
+       const int   *lwork,
+       int         *info)
+{
+  psorgqr_(m, n, k, A, ia, ja, desca, tau, work, lwork, info);
+}
+
+
 template <typename number>
 inline void
 pgeadd(const char * /*transa*/,
@@ -20,6 +20,7 @@
 
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/vectorization.h>
@@ -387,6 +388,112 @@ public:
 };
 
 
+
+/**
+ * This class implements the pipelined variant of the preconditioned
+ * conjugate gradient method proposed by @cite Ghysels2014 . It solves the
+ * same class of problems as SolverCG, but rearranges the recurrences such
+ * that all inner products of an iteration are combined into a single global
+ * reduction, and such that this reduction can be started before the
+ * preconditioner application and matrix-vector product of the same
+ * iteration. At large process counts, where the latency of the two blocking
+ * reductions of the standard conjugate gradient method becomes a
+ * considerable part of the run time, this allows the communication to be
+ * hidden behind the local work.
+ *
+ * The communication is actually overlapped, i.e., performed with a
+ * nonblocking <code>MPI_Iallreduce</code> that is completed only after the
+ * matrix-vector product, in case the vector type is
+ * LinearAlgebra::distributed::Vector with a real-valued scalar type. For all
+ * other vector types, the class falls back to blocking inner products and
+ * merely benefits from the reduced number of synchronization points (one
+ * instead of two per iteration). Note that effective overlap additionally
+ * requires an MPI implementation that makes asynchronous progress on
+ * nonblocking collectives.
+ *
+ * These advantages come at a price: The pipelined algorithm needs nine
+ * auxiliary vectors instead of the three used by SolverCG, performs
+ * additional vector updates, and computes the preconditioned residual and
+ * the vector resulting from the matrix-vector product by recurrences rather
+ * than directly. As a consequence, rounding errors accumulate somewhat
+ * faster than in the standard algorithm, and the attainable accuracy can be
+ * slightly lower for very ill-conditioned problems. Furthermore, the
+ * residual norm passed to the SolverControl object lags behind by one
+ * iteration, because the norm of the current residual only becomes available
+ * together with the reduction of the next iteration; the solver therefore
+ * typically performs one more iteration than SolverCG. For moderate process
+ * counts or cheap matrix-vector products, SolverCG remains the method of
+ * choice, in particular since it can interleave the vector updates with the
+ * matrix-vector product as described in its class documentation.
+ */
+template <typename VectorType = Vector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverCGPipelined : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   * Here, it does not store anything but just exists for consistency
+   * with the other solver classes.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverCGPipelined(SolverControl            &cn,
+                    VectorMemory<VectorType> &mem,
+                    const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverCGPipelined(SolverControl        &cn,
+                    const AdditionalData &data = AdditionalData());
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~SolverCGPipelined() override = default;
+
+  /**
+   * Solve the linear system $Ax=b$ for x.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+  void solve(const MatrixType         &A,
+             VectorType               &x,
+             const VectorType         &b,
+             const PreconditionerType &preconditioner);
+
+protected:
+  /**
+   * Interface for derived class. This function gets the current iteration
+   * vector, the residual and the update vector in each step. It can be used
+   * for graphical output of the convergence history.
+   */
+  virtual void
+  print_vectors(const unsigned int step,
+                const VectorType  &x,
+                const VectorType  &r,
+                const VectorType  &d) const;
+
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+};
+
+
 /** @} */
 
 /*------------------------- Implementation ----------------------------*/
@@ -1259,6 +1366,272 @@ namespace internal
           }
       }
     };
+
+
+
+    // Worker for the pipelined conjugate gradient method of Ghysels and
+    // Vanroose. In contrast to the workers above, the three inner products
+    // of an iteration are combined into a single reduction that is started
+    // before the preconditioner application and matrix-vector product of the
+    // same iteration, so that the communication can proceed in the
+    // background while the local work is done. The fully overlapped path is
+    // only available for LinearAlgebra::distributed::Vector with a
+    // real-valued scalar type, where we have access to the locally owned
+    // range of entries and the communicator; for other vector types, the
+    // blocking inner products of the vector class are used, which still
+    // results in a single synchronization point per iteration.
+    template <typename VectorType,
+              typename MatrixType,
+              typename PreconditionerType>
+    struct PipelinedIterationWorker
+    {
+      using Number = typename VectorType::value_type;
+
+      static constexpr bool use_nonblocking_reduction =
+        std::is_same_v<VectorType,
+                       LinearAlgebra::distributed::Vector<Number,
+                                                          MemorySpace::Host>> &&
+        numbers::NumberTraits<Number>::is_complex == false;
+
+      const MatrixType         &A;
+      const PreconditionerType &preconditioner;
+      VectorType               &x;
+
+      typename VectorMemory<VectorType>::Pointer r_pointer;
+      typename VectorMemory<VectorType>::Pointer u_pointer;
+      typename VectorMemory<VectorType>::Pointer w_pointer;
+      typename VectorMemory<VectorType>::Pointer m_pointer;
+      typename VectorMemory<VectorType>::Pointer n_pointer;
+      typename VectorMemory<VectorType>::Pointer z_pointer;
+      typename VectorMemory<VectorType>::Pointer q_pointer;
+      typename VectorMemory<VectorType>::Pointer s_pointer;
+      typename VectorMemory<VectorType>::Pointer p_pointer;
+
+      // Define some aliases for simpler access, following the notation of
+      // Algorithm 5 in the paper by Ghysels and Vanroose: 'r' is the
+      // residual b - A*x, 'u' the preconditioned residual, 'w' the matrix
+      // times the preconditioned residual, 'm' and 'n' the results of the
+      // preconditioner application and matrix-vector product of the current
+      // iteration, and 'z', 'q', 's', 'p' the search directions in terms of
+      // n, m, w, and u, respectively.
+      VectorType &r;
+      VectorType &u;
+      VectorType &w;
+      VectorType &m;
+      VectorType &n;
+      VectorType &z;
+      VectorType &q;
+      VectorType &s;
+      VectorType &p;
+
+      Number alpha;
+      Number beta;
+      Number previous_alpha;
+      Number previous_gamma;
+      double residual_norm;
+
+      MPI_Request reduction_request;
+
+      PipelinedIterationWorker(const MatrixType         &A,
+                               const PreconditionerType &preconditioner,
+                               VectorMemory<VectorType> &memory,
+                               VectorType               &x)
+        : A(A)
+        , preconditioner(preconditioner)
+        , x(x)
+        , r_pointer(memory)
+        , u_pointer(memory)
+        , w_pointer(memory)
+        , m_pointer(memory)
+        , n_pointer(memory)
+        , z_pointer(memory)
+        , q_pointer(memory)
+        , s_pointer(memory)
+        , p_pointer(memory)
+        , r(*r_pointer)
+        , u(*u_pointer)
+        , w(*w_pointer)
+        , m(*m_pointer)
+        , n(*n_pointer)
+        , z(*z_pointer)
+        , q(*q_pointer)
+        , s(*s_pointer)
+        , p(*p_pointer)
+        , alpha(Number())
+        , beta(Number())
+        , previous_alpha(Number())
+        , previous_gamma(Number())
+        , residual_norm(0.0)
+        , reduction_request(MPI_Request())
+      {}
+
+      void
+      startup(const VectorType &b)
+      {
+        // Initialize without setting the vector entries, as those would soon
+        // be overwritten anyway
+        r.reinit(x, true);
+        u.reinit(x, true);
+        w.reinit(x, true);
+        m.reinit(x, true);
+        n.reinit(x, true);
+        z.reinit(x, true);
+        q.reinit(x, true);
+        s.reinit(x, true);
+        p.reinit(x, true);
+
+        // compute residual. if vector is zero, then short-circuit the full
+        // computation
+        if (!x.all_zero())
+          {
+            A.vmult(r, x);
+            r.sadd(-1., 1., b);
+          }
+        else
+          r.equ(1., b);
+
+        residual_norm = r.l2_norm();
+
+        preconditioner.vmult(u, r);
+        A.vmult(w, u);
+      }
+
+      // Compute the three inner products (r,u), (w,u), (r,r) of the current
+      // iteration and, if supported by the vector type, start the
+      // nonblocking reduction over all processes that is completed by
+      // finish_reduction() below.
+      void
+      start_reduction(std::array<Number, 3> &sums)
+      {
+        if constexpr (use_nonblocking_reduction)
+          {
+            const Number          *r_ptr      = r.begin();
+            const Number          *u_ptr      = u.begin();
+            const Number          *w_ptr      = w.begin();
+            const unsigned int     local_size = r.locally_owned_size();
+            constexpr unsigned int n_lanes    = VectorizedArray<Number>::size();
+            const unsigned int     regular_size =
+              local_size / n_lanes * n_lanes;
+
+            std::array<VectorizedArray<Number>, 3> vectorized_sums = {};
+            for (unsigned int j = 0; j < regular_size; j += n_lanes)
+              {
+                VectorizedArray<Number> rj, uj, wj;
+                rj.load(r_ptr + j);
+                uj.load(u_ptr + j);
+                wj.load(w_ptr + j);
+                vectorized_sums[0] += rj * uj;
+                vectorized_sums[1] += wj * uj;
+                vectorized_sums[2] += rj * rj;
+              }
+            for (unsigned int j = regular_size; j < local_size; ++j)
+              {
+                vectorized_sums[0][0] += r_ptr[j] * u_ptr[j];
+                vectorized_sums[1][0] += w_ptr[j] * u_ptr[j];
+                vectorized_sums[2][0] += r_ptr[j] * r_ptr[j];
+              }
+            for (unsigned int i = 0; i < 3; ++i)
+              {
+                sums[i] = vectorized_sums[i][0];
+                for (unsigned int l = 1; l < n_lanes; ++l)
+                  sums[i] += vectorized_sums[i][l];
+              }
+
+#ifdef DEAL_II_WITH_MPI
+            if (Utilities::MPI::job_supports_mpi())
+              {
+                const int ierr =
+                  MPI_Iallreduce(MPI_IN_PLACE,
+                                 sums.data(),
+                                 3,
+                                 Utilities::MPI::mpi_type_id_for_type<Number>,
+                                 MPI_SUM,
+                                 r.get_mpi_communicator(),
+                                 &reduction_request);
+                AssertThrowMPI(ierr);
+              }
+#endif
+          }
+        else
+          {
+            sums[0] = r * u;
+            sums[1] = w * u;
+
+            const double norm = r.l2_norm();
+            sums[2]           = norm * norm;
+          }
+      }
+
+      void
+      finish_reduction()
+      {
+#ifdef DEAL_II_WITH_MPI
+        if constexpr (use_nonblocking_reduction)
+          if (Utilities::MPI::job_supports_mpi())
+            {
+              const int ierr =
+                MPI_Wait(&reduction_request, MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+            }
+#endif
+      }
+
+      void
+      do_iteration(const unsigned int iteration_index)
+      {
+        std::array<Number, 3> sums = {};
+        start_reduction(sums);
+
+        // While the reduction is in flight, apply the preconditioner and
+        // the matrix to the vector 'w' of the current iteration
+        preconditioner.vmult(m, w);
+        A.vmult(n, m);
+
+        finish_reduction();
+
+        const Number gamma = sums[0];
+        const Number delta = sums[1];
+
+        // The norm of the residual held at the beginning of this iteration
+        // only becomes available here, i.e., the reported residual norm lags
+        // behind the iterate by one iteration
+        residual_norm = std::sqrt(std::abs(sums[2]));
+
+        previous_alpha = alpha;
+        if (iteration_index > 1)
+          {
+            Assert(std::abs(previous_gamma) != 0., ExcDivideByZero());
+            beta = gamma / previous_gamma;
+
+            Assert(std::abs(previous_alpha) != 0., ExcDivideByZero());
+            const Number denominator = delta - beta / previous_alpha * gamma;
+            Assert(std::abs(denominator) != 0., ExcDivideByZero());
+            alpha = gamma / denominator;
+
+            z.sadd(beta, 1., n);
+            q.sadd(beta, 1., m);
+            s.sadd(beta, 1., w);
+            p.sadd(beta, 1., u);
+          }
+        else
+          {
+            Assert(std::abs(delta) != 0., ExcDivideByZero());
+            beta  = Number();
+            alpha = gamma / delta;
+
+            z.equ(1., n);
+            q.equ(1., m);
+            s.equ(1., w);
+            p.equ(1., u);
+          }
+        previous_gamma = gamma;
+
+        x.add(alpha, p);
+        r.add(-alpha, s);
+        u.add(-alpha, q);
+        w.add(-alpha, z);
+      }
+    };
   } // namespace SolverCG
 } // namespace internal
 
@@ -1418,6 +1791,82 @@ SolverFlexibleCG<VectorType>::SolverFlexibleCG(SolverControl &cn,
 
 
 
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverCGPipelined<VectorType>::SolverCGPipelined(SolverControl &cn,
+                                                 VectorMemory<VectorType> &mem,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverCGPipelined<VectorType>::SolverCGPipelined(SolverControl        &cn,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+void SolverCGPipelined<VectorType>::print_vectors(const unsigned int,
+                                                  const VectorType &,
+                                                  const VectorType &,
+                                                  const VectorType &) const
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+void SolverCGPipelined<VectorType>::solve(const MatrixType &A,
+                                          VectorType       &x,
+                                          const VectorType &b,
+                                          const PreconditionerType
+                                            &preconditioner)
+{
+  SolverControl::State solver_state = SolverControl::iterate;
+
+  LogStream::Prefix prefix("cg");
+
+  int it = 0;
+
+  internal::SolverCG::
+    PipelinedIterationWorker<VectorType, MatrixType, PreconditionerType>
+      worker(A, preconditioner, this->memory, x);
+
+  worker.startup(b);
+
+  solver_state = this->iteration_status(0, worker.residual_norm, x);
+  if (solver_state != SolverControl::iterate)
+    return;
+
+  while (solver_state == SolverControl::iterate)
+    {
+      ++it;
+
+      worker.do_iteration(it);
+
+      print_vectors(it, x, worker.r, worker.p);
+
+      solver_state = this->iteration_status(it, worker.residual_norm, x);
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, worker.residual_norm));
+}
+
+
+
 #endif // DOXYGEN
 
 DEAL_II_NAMESPACE_CLOSE
@@ -20,6 +20,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/smartpointer.h>
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/vectorization.h>
@@ -280,6 +281,118 @@ namespace internal
   } // namespace SolverGMRESImplementation
 } // namespace internal
 
+#ifndef DOXYGEN
+// forward declaration
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverGMRES;
+#endif
+
+/**
+ * A user-owned workspace for Krylov subspace recycling between successive
+ * solves with SolverGMRES. When attached to a solver via
+ * SolverGMRES::set_recycling_workspace(), the solver deposits an
+ * approximation of the subspace in which the operator acts most weakly
+ * (extracted from the final Arnoldi decomposition of each solve) into this
+ * object, and uses the stored subspace at the beginning of the next solve to
+ * improve the initial guess by a minimal-residual projection. For sequences
+ * of slowly varying linear systems, as they arise for example in implicit
+ * time stepping, this typically reduces the number of iterations per solve
+ * considerably.
+ *
+ * The workspace stores up to @p max_recycled_vectors pairs of vectors $(u_i,
+ * c_i)$ with $c_i \approx A u_i$ (for the preconditioned operator the solver
+ * iterates on) and the $c_i$ orthonormal. They are computed from the right
+ * singular vectors belonging to the smallest singular values of the final
+ * Hessenberg matrix, so no additional operator applications are needed to
+ * build them. At the start of the next solve, the correction $\sum_i (c_i^T
+ * r) u_i$ is added to the initial guess, after which the solver recomputes
+ * the true residual and proceeds as usual. The stored subspace is therefore
+ * only a guess-improver: even if the matrix or preconditioner have changed
+ * substantially since the last solve, the subsequent iteration remains
+ * correct, merely without the expected savings.
+ *
+ * A typical use looks as follows:
+ * @code
+ * KrylovSpaceRecycling<VectorType> recycling(10);
+ * SolverGMRES<VectorType>          solver(control);
+ * solver.set_recycling_workspace(recycling);
+ * for (unsigned int step = 0; step < n_time_steps; ++step)
+ *   {
+ *     // assemble matrix and right hand side ...
+ *     solver.solve(matrix, solution, rhs, preconditioner);
+ *   }
+ * @endcode
+ *
+ * Call clear() when the linear system changes so drastically that the stored
+ * subspace is no longer useful, for example after remeshing.
+ */
+template <typename VectorType = Vector<double>>
+class KrylovSpaceRecycling : public Subscriptor
+{
+public:
+  /**
+   * Constructor. The argument determines how many vectors are retained
+   * between solves.
+   */
+  explicit KrylovSpaceRecycling(const unsigned int max_recycled_vectors = 8);
+
+  /**
+   * Discard the stored subspace.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of vector pairs currently stored.
+   */
+  unsigned int
+  size() const;
+
+private:
+  /**
+   * Replace the stored subspace by the @p n_vectors right singular vectors
+   * belonging to the smallest singular values of the given Hessenberg
+   * matrix, expanded through the given Arnoldi basis. Called by the solver
+   * at the end of each solve.
+   */
+  void
+  update(
+    const internal::SolverGMRESImplementation::TmpVectors<VectorType> &basis,
+    const FullMatrix<double> &hessenberg,
+    const unsigned int        n_vectors);
+
+  /**
+   * Given the residual of the current initial guess, accumulate the
+   * minimal-residual correction from the stored subspace in @p correction.
+   * Called by the solver at the beginning of each solve.
+   */
+  void
+  apply(const VectorType &residual, VectorType &correction) const;
+
+  /**
+   * The maximal number of vector pairs to retain.
+   */
+  const unsigned int max_recycled_vectors;
+
+  /**
+   * The recycled directions $u_i$, expressed in terms of the solution
+   * update of the (possibly right-preconditioned) iteration.
+   */
+  std::vector<VectorType> directions;
+
+  /**
+   * The images $c_i \approx A u_i$ of the recycled directions under the
+   * preconditioned operator, orthonormalized.
+   */
+  std::vector<VectorType> images;
+
+  // Allow the solver to harvest and apply the subspace.
+  template <typename T>
+  DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<T>)
+  friend class SolverGMRES;
+};
+
 /**
  * Implementation of the Restarted Preconditioned Direct Generalized Minimal
  * Residual Method. The stopping criterion is the norm of the residual.
@@ -365,7 +478,10 @@ public:
      * information is disabled by default. Finally, the default
      * orthogonalization algorithm is the classical Gram-Schmidt method with
      * delayed reorthogonalization, which combines stability with fast
-     * execution, especially in parallel.
+     * execution, especially in parallel: it needs only a single global
+     * reduction per iteration, as opposed to two for the classical
+     * Gram-Schmidt method and one per basis vector for the modified
+     * Gram-Schmidt method.
      */
     explicit AdditionalData(const unsigned int max_basis_size        = 30,
                             const bool         right_preconditioning = false,
@@ -518,6 +634,17 @@ public:
   boost::signals2::connection
   connect_re_orthogonalization_slot(const std::function<void(int)> &slot);
 
+  /**
+   * Attach a user-owned workspace for Krylov subspace recycling between
+   * successive solves. See the documentation of KrylovSpaceRecycling for
+   * details and an example. The workspace must live at least as long as the
+   * solver, and the recycled subspace is only meaningful as long as the same
+   * preconditioning side (left or right) is used for all solves it
+   * participates in.
+   */
+  void
+  set_recycling_workspace(KrylovSpaceRecycling<VectorType> &workspace);
+
 
   DeclException1(ExcTooFewTmpVectors,
                  int,
@@ -584,6 +711,13 @@ protected:
    */
   boost::signals2::signal<void(int)> re_orthogonalize_signal;
 
+  /**
+   * Pointer to the user-owned recycling workspace, if one has been attached
+   * via set_recycling_workspace().
+   */
+  SmartPointer<KrylovSpaceRecycling<VectorType>, SolverGMRES<VectorType>>
+    recycling_workspace;
+
   /**
    * A reference to the underlying SolverControl object. In the regular case,
    * this is not needed, as the signal from the base class is used, but the
@@ -720,6 +854,133 @@ private:
 
 #ifndef DOXYGEN
 
+template <typename VectorType>
+KrylovSpaceRecycling<VectorType>::KrylovSpaceRecycling(
+  const unsigned int max_recycled_vectors)
+  : max_recycled_vectors(max_recycled_vectors)
+{}
+
+
+
+template <typename VectorType>
+void
+KrylovSpaceRecycling<VectorType>::clear()
+{
+  directions.clear();
+  images.clear();
+}
+
+
+
+template <typename VectorType>
+unsigned int
+KrylovSpaceRecycling<VectorType>::size() const
+{
+  return images.size();
+}
+
+
+
+template <typename VectorType>
+void
+KrylovSpaceRecycling<VectorType>::update(
+  const internal::SolverGMRESImplementation::TmpVectors<VectorType> &basis,
+  const FullMatrix<double> &hessenberg,
+  const unsigned int        n_vectors)
+{
+  const unsigned int m = n_vectors;
+  const unsigned int k = std::min(max_recycled_vectors, m);
+
+  directions.clear();
+  images.clear();
+
+  if (k == 0)
+    return;
+
+  // Compute the singular value decomposition of the (m+1) x m Hessenberg
+  // matrix of the final Arnoldi decomposition A V_m = V_{m+1} H. The right
+  // singular vectors y belonging to the smallest singular values span the
+  // subspace in which the (preconditioned) operator acts most weakly, i.e.,
+  // the part of the spectrum that slows down future Krylov iterations the
+  // most. Both u = V_m y and its image A u = V_{m+1} (H y) are linear
+  // combinations of the stored basis vectors, so no operator applications
+  // are needed here.
+  LAPACKFullMatrix<double> H(m + 1, m);
+  for (unsigned int i = 0; i < m + 1; ++i)
+    for (unsigned int j = 0; j < m; ++j)
+      H(i, j) = hessenberg(i, j);
+  H.compute_svd();
+  const LAPACKFullMatrix<double> &Vt = H.get_svd_vt();
+
+  directions.reserve(k);
+  images.reserve(k);
+
+  // the singular values are sorted in decreasing order, so the right
+  // singular vectors of interest are the last k rows of V^T
+  for (unsigned int s = m - k; s < m; ++s)
+    {
+      directions.emplace_back(basis[0]);
+      VectorType &u = directions.back();
+      u             = 0.;
+      for (unsigned int j = 0; j < m; ++j)
+        u.add(Vt(s, j), basis[j]);
+
+      Vector<double> image_coefficients(m + 1);
+      for (unsigned int i = 0; i < m + 1; ++i)
+        for (unsigned int j = 0; j < m; ++j)
+          image_coefficients(i) += hessenberg(i, j) * Vt(s, j);
+
+      images.emplace_back(basis[0]);
+      VectorType &c = images.back();
+      c             = 0.;
+      for (unsigned int i = 0; i < m + 1; ++i)
+        c.add(image_coefficients(i), basis[i]);
+    }
+
+  // orthonormalize the images by modified Gram-Schmidt, applying the same
+  // transformation to the directions so that the relation c_i ~ A u_i is
+  // preserved. if an image becomes linearly dependent, drop it and all
+  // later (even less significant) vectors
+  for (unsigned int i = 0; i < images.size(); ++i)
+    {
+      for (unsigned int j = 0; j < i; ++j)
+        {
+          const double proj = images[j] * images[i];
+          images[i].add(-proj, images[j]);
+          directions[i].add(-proj, directions[j]);
+        }
+      const double norm = images[i].l2_norm();
+      if (norm > 1000. * std::numeric_limits<double>::epsilon())
+        {
+          images[i] /= norm;
+          directions[i] /= norm;
+        }
+      else
+        {
+          images.resize(i);
+          directions.resize(i);
+          break;
+        }
+    }
+}
+
+
+
+template <typename VectorType>
+void
+KrylovSpaceRecycling<VectorType>::apply(const VectorType &residual,
+                                        VectorType       &correction) const
+{
+  Assert(images.size() > 0, ExcInternalError());
+  AssertDimension(images[0].size(), residual.size());
+
+  correction = 0.;
+  for (unsigned int i = 0; i < images.size(); ++i)
+    correction.add(images[i] * residual, directions[i]);
+}
+
+
+
 template <typename VectorType>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
 inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
@@ -767,6 +1028,16 @@ SolverGMRES<VectorType>::SolverGMRES(SolverControl        &cn,
 
 
 
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+void SolverGMRES<VectorType>::set_recycling_workspace(
+  KrylovSpaceRecycling<VectorType> &workspace)
+{
+  recycling_workspace = &workspace;
+}
+
+
+
 namespace internal
 {
   namespace SolverGMRESImplementation
@@ -1854,6 +2125,30 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
     {
       VectorType &v = basis_vectors(0, x);
 
+      // If a recycling workspace with a subspace stored during a previous
+      // solve is attached, improve the initial guess by the minimal-residual
+      // projection onto that subspace. The residual is recomputed from the
+      // corrected guess below, so an outdated subspace can only cost the
+      // extra operator application here, never correctness.
+      if (accumulated_iterations == 0 && recycling_workspace != nullptr &&
+          recycling_workspace->size() > 0)
+        {
+          A.vmult(p, x);
+          p.sadd(-1., 1., b);
+          if (left_precondition)
+            {
+              preconditioner.vmult(v, p);
+              recycling_workspace->apply(v, p);
+              x.add(1., p);
+            }
+          else
+            {
+              recycling_workspace->apply(p, v);
+              preconditioner.vmult(p, v);
+              x.add(1., p);
+            }
+        }
+
       // Compute the preconditioned/unpreconditioned residual for left/right
       // preconditioning. If 'x' is the zero vector, then we can bypass the
       // full computation. But 'x' is only likely to be the zero vector if
@@ -2044,6 +2339,12 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
           if (!additional_data.batched_mode && !krylov_space_signal.empty())
             krylov_space_signal(basis_vectors);
 
+          // deposit the subspace to recycle in the next solve
+          if (recycling_workspace != nullptr && !additional_data.batched_mode)
+            recycling_workspace->update(basis_vectors,
+                                        arnoldi_process.get_hessenberg_matrix(),
+                                        inner_iteration);
+
           // end of outer iteration. restart if no convergence and the number of
           // iterations is not exceeded
         }
@@ -132,11 +132,13 @@ public:
   /**
    * Factorize the matrix. This function may be called multiple times for
    * different matrices, after the object of this class has been initialized
-   * for a certain sparsity pattern. You may therefore save some computing
-   * time if you want to invert several matrices with the same sparsity
-   * pattern. However, note that the bulk of the computing time is actually
-   * spent in the factorization, so this functionality may not always be of
-   * large benefit.
+   * for a certain sparsity pattern. If the sparsity pattern of the matrix is
+   * the same as in the previous call to this function, the symbolic analysis
+   * computed by UMFPACK is reused and only the numeric factorization is
+   * performed anew. This saves a substantial fraction of the factorization
+   * time when repeatedly factorizing matrices with an unchanged sparsity
+   * pattern, as happens for example for the Jacobian matrices of a Newton
+   * iteration on a fixed mesh.
    *
    * In contrast to the other direct solver classes, the initialization method
    * does nothing. Therefore initialize is not automatically called by this
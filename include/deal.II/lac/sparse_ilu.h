@@ -41,6 +41,18 @@ DEAL_II_NAMESPACE_OPEN
  * given in the book Y. Saad: "Iterative methods for sparse linear systems",
  * second edition, in section 10.3.2.
  *
+ * The triangular solves performed in vmult() are parallelized by level
+ * scheduling: at factorization time, the rows are grouped into dependency
+ * levels such that all rows within one level can be processed independently
+ * once the previous levels are complete. If deal.II is configured with
+ * multithreading and the factorization exposes enough parallelism -- which
+ * is typically the case for matrices ordered by the downstream numbering of
+ * a structured or unstructured mesh, but not for band matrices -- the rows
+ * of each level are then processed on all available threads. Since the
+ * operations performed for each individual row are not reordered, the
+ * parallel solve produces results that are bitwise identical to the
+ * sequential one.
+ *
  *
  * <h3>Usage and state management</h3>
  *
@@ -153,6 +165,35 @@ public:
                     "that the matrix for which you try to compute a "
                     "decomposition is singular.");
   /** @} */
+
+private:
+  /**
+   * Group the rows of the decomposition into dependency levels for the
+   * forward (lower triangular) and backward (upper triangular) solves. A row
+   * belongs to the first level after the levels of all rows it depends on,
+   * so that the rows within one level can be processed in any order -- in
+   * particular concurrently -- once the previous levels are complete. Called
+   * at the end of initialize().
+   */
+  void
+  compute_level_scheduling();
+
+  /**
+   * The rows of the matrix ordered by dependency level for the forward
+   * solve, and the start of each level within that array (in the usual
+   * compressed row storage convention, so that level $l$ comprises the rows
+   * <tt>forward_level_rows[forward_level_start[l]]</tt> to
+   * <tt>forward_level_rows[forward_level_start[l+1]-1]</tt>).
+   */
+  std::vector<size_type> forward_level_rows;
+  std::vector<size_type> forward_level_start;
+
+  /**
+   * Same as forward_level_rows and forward_level_start, but for the backward
+   * solve.
+   */
+  std::vector<size_type> backward_level_rows;
+  std::vector<size_type> backward_level_start;
 };
 
 /** @} */
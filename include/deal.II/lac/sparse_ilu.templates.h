@@ -19,6 +19,10 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/lac/sparse_ilu.h>
 #include <deal.II/lac/vector.h>
 
@@ -128,6 +132,84 @@ SparseILU<number>::initialize(const SparseMatrix<somenumber> &matrix,
       for (size_type j = j1; j <= j2; ++j)
         iw[ja[j]] = numbers::invalid_size_type;
     }
+
+  compute_level_scheduling();
+}
+
+
+
+template <typename number>
+void
+SparseILU<number>::compute_level_scheduling()
+{
+  const SparsityPattern   &sparsity = this->get_sparsity_pattern();
+  const std::size_t *const ia       = sparsity.rowstart.get();
+  const size_type *const   ja       = sparsity.colnums.get();
+
+  const size_type N = this->m();
+
+  // temporary array holding the dependency level of each row, and a helper
+  // sorting the rows into the level arrays by a counting sort once the
+  // levels are known
+  std::vector<size_type> level(N);
+
+  const auto sort_rows_by_level = [N](const std::vector<size_type> &level,
+                                      const size_type               n_levels,
+                                      std::vector<size_type>       &rows,
+                                      std::vector<size_type>       &start) {
+    start.assign(n_levels + 1, 0);
+    for (size_type row = 0; row < N; ++row)
+      ++start[level[row] + 1];
+    for (size_type l = 0; l < n_levels; ++l)
+      start[l + 1] += start[l];
+
+    rows.resize(N);
+    std::vector<size_type> next_position(start.begin(), start.end() - 1);
+    for (size_type row = 0; row < N; ++row)
+      rows[next_position[level[row]]++] = row;
+  };
+
+  // forward solve: row 'row' depends on the rows corresponding to the
+  // column indices left of the diagonal
+  size_type n_levels = 0;
+  for (size_type row = 0; row < N; ++row)
+    {
+      // get start of this row, skipping the diagonal element that is
+      // stored first
+      const size_type *const rowstart = &ja[ia[row] + 1];
+      const size_type *const first_after_diagonal =
+        this->prebuilt_lower_bound[row];
+
+      size_type row_level = 0;
+      for (const size_type *col = rowstart; col != first_after_diagonal; ++col)
+        row_level = std::max(row_level, level[*col] + 1);
+
+      level[row] = row_level;
+      n_levels   = std::max(n_levels, row_level + 1);
+    }
+  sort_rows_by_level(level, n_levels, forward_level_rows, forward_level_start);
+
+  // backward solve: row 'row' depends on the rows corresponding to the
+  // column indices right of the diagonal
+  n_levels = 0;
+  for (size_type row_plus_one = N; row_plus_one > 0; --row_plus_one)
+    {
+      const size_type        row = row_plus_one - 1;
+      const size_type *const rowend = &ja[ia[row + 1]];
+      const size_type *const first_after_diagonal =
+        this->prebuilt_lower_bound[row];
+
+      size_type row_level = 0;
+      for (const size_type *col = first_after_diagonal; col != rowend; ++col)
+        row_level = std::max(row_level, level[*col] + 1);
+
+      level[row] = row_level;
+      n_levels   = std::max(n_levels, row_level + 1);
+    }
+  sort_rows_by_level(level,
+                     n_levels,
+                     backward_level_rows,
+                     backward_level_start);
 }
 
 
@@ -148,6 +230,71 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
   const size_type *const column_numbers =
     this->get_sparsity_pattern().colnums.get();
 
+  // if multithreading is enabled and the dependency levels computed at
+  // factorization time contain enough rows on average to outweigh the
+  // cost of spawning tasks, process the rows of each level in parallel.
+  // within each row the operations below are identical to the sequential
+  // code path, and rows within one level do not depend on each other, so
+  // the result is bitwise the same as for the sequential sweeps
+  const size_type minimum_level_grain_size = 512;
+  if (MultithreadInfo::n_threads() > 1 &&
+      N >= minimum_level_grain_size * (forward_level_start.size() - 1) &&
+      N >= minimum_level_grain_size * (backward_level_start.size() - 1))
+    {
+      dst = src;
+      for (size_type l = 0; l < forward_level_start.size() - 1; ++l)
+        parallel::apply_to_subranges(
+          forward_level_start[l],
+          forward_level_start[l + 1],
+          [&](const size_type begin, const size_type end) {
+            for (size_type i = begin; i < end; ++i)
+              {
+                const size_type        row = forward_level_rows[i];
+                const size_type *const rowstart =
+                  &column_numbers[rowstart_indices[row] + 1];
+                const size_type *const first_after_diagonal =
+                  this->prebuilt_lower_bound[row];
+
+                somenumber    dst_row = dst(row);
+                const number *luval   = this->SparseMatrix<number>::val.get() +
+                                      (rowstart - column_numbers);
+                for (const size_type *col = rowstart;
+                     col != first_after_diagonal;
+                     ++col, ++luval)
+                  dst_row -= *luval * dst(*col);
+                dst(row) = dst_row;
+              }
+          },
+          minimum_level_grain_size);
+
+      for (size_type l = 0; l < backward_level_start.size() - 1; ++l)
+        parallel::apply_to_subranges(
+          backward_level_start[l],
+          backward_level_start[l + 1],
+          [&](const size_type begin, const size_type end) {
+            for (size_type i = begin; i < end; ++i)
+              {
+                const size_type        row = backward_level_rows[i];
+                const size_type *const rowend =
+                  &column_numbers[rowstart_indices[row + 1]];
+                const size_type *const first_after_diagonal =
+                  this->prebuilt_lower_bound[row];
+
+                somenumber    dst_row = dst(row);
+                const number *luval   = this->SparseMatrix<number>::val.get() +
+                                      (first_after_diagonal - column_numbers);
+                for (const size_type *col = first_after_diagonal; col != rowend;
+                     ++col, ++luval)
+                  dst_row -= *luval * dst(*col);
+
+                dst(row) = dst_row * this->diag_element(row);
+              }
+          },
+          minimum_level_grain_size);
+
+      return;
+    }
+
   // solve LUx=b in two steps:
   // first Ly = b, then
   //       Ux = y
@@ -301,7 +448,11 @@ template <typename number>
 std::size_t
 SparseILU<number>::memory_consumption() const
 {
-  return SparseLUDecomposition<number>::memory_consumption();
+  return (SparseLUDecomposition<number>::memory_consumption() +
+          MemoryConsumption::memory_consumption(forward_level_rows) +
+          MemoryConsumption::memory_consumption(forward_level_start) +
+          MemoryConsumption::memory_consumption(backward_level_rows) +
+          MemoryConsumption::memory_consumption(backward_level_start));
 }
 
 DEAL_II_NAMESPACE_CLOSE
@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/smartpointer.h>
 #include <deal.II/base/subscriptor.h>
@@ -489,6 +491,65 @@ DEAL_II_NAMESPACE_OPEN
 
 // TODO: Add multithreading to the other vmult functions.
 
+namespace internal
+{
+  namespace SparseMatrixImplementation
+  {
+    /**
+     * A copy of the entries of a SparseMatrix in SELL-C-$\sigma$ (sliced
+     * ELLPACK) storage, created by
+     * SparseMatrix::build_vectorized_storage(). In this format, the matrix
+     * rows are grouped into slices of #slice_size rows each and the entries
+     * of a slice are interleaved, i.e., the $j$th entries of all rows of a
+     * slice are stored next to each other. Rows shorter than the longest row
+     * of their slice are padded with explicit zeros. This layout allows a
+     * matrix-vector product to process one entry of #slice_size rows with a
+     * single vector instruction, which is not possible with the row-by-row
+     * compressed row storage of SparsityPattern.
+     */
+    template <typename number>
+    struct SellCSigmaStorage
+    {
+      /**
+       * Number of rows grouped into one slice (the "C" in SELL-C-$\sigma$).
+       * This equals the number of lanes of VectorizedArray for @p number, or
+       * one for number types without VectorizedArray support.
+       */
+      unsigned int slice_size;
+
+      /**
+       * Start of each slice within #values and #column_indices, in CRS-like
+       * fashion: slice $s$ occupies the range
+       * <tt>[slice_start[s], slice_start[s+1])</tt>, whose length is the
+       * padded row length of the slice times #slice_size.
+       */
+      std::vector<std::size_t> slice_start;
+
+      /**
+       * Matrix entries, stored slice by slice in interleaved order. Padding
+       * entries are zero.
+       */
+      AlignedVector<number> values;
+
+      /**
+       * Column indices corresponding to #values. The indices are stored as
+       * 32-bit integers since that is what the gather instructions behind
+       * VectorizedArray::gather() consume; padding entries repeat the last
+       * column of their row to keep the padded reads local.
+       */
+      AlignedVector<unsigned int> column_indices;
+
+      /**
+       * For each lane of each slice, the index of the matrix row stored in
+       * that lane. This encodes the row permutation resulting from sorting
+       * the rows by decreasing length within windows of $\sigma$ rows, which
+       * reduces the padding overhead for matrices with varying row lengths.
+       */
+      std::vector<types::global_dof_index> rows;
+    };
+  } // namespace SparseMatrixImplementation
+} // namespace internal
+
 /**
  * Sparse matrix. This class implements the functionality to store matrix
  * entry values in the locations denoted by a SparsityPattern. See
@@ -1114,6 +1175,53 @@ public:
    * @name Multiplying matrices and vectors
    */
   /** @{ */
+  /**
+   * Build an internal copy of the matrix in SELL-C-$\sigma$ (sliced ELLPACK)
+   * storage that is subsequently used by vmult() and vmult_add() whenever
+   * source and destination are of type Vector with the same number type as
+   * the matrix.
+   *
+   * In the compressed row storage underlying this class, the entries of each
+   * row are stored consecutively (with the diagonal entry of square matrices
+   * first), so the multiplication kernel processes one row after the other
+   * and the compiler cannot make good use of the SIMD units. The
+   * SELL-C-$\sigma$ format instead interleaves the entries of
+   * <tt>C = VectorizedArray@<number@>::%size()</tt> rows, so that one vector
+   * instruction multiplies one entry of $C$ rows at once, with the entries of
+   * the source vector collected by gather instructions. To limit the zero
+   * padding implied by grouping rows of different lengths, rows are sorted by
+   * decreasing length within windows of @p sort_window rows; the resulting
+   * permutation only affects the internal storage, not the interface.
+   *
+   * The copy reflects the entries of the matrix at the time of the call:
+   * modifying entries afterwards (e.g., during a new assembly cycle) does
+   * not update it, so this function must be called again after the entries
+   * have changed. The copy is discarded by reinit(), clear(), and assignment
+   * of zero to the matrix, and roughly doubles the memory consumption of the
+   * matrix, which is usually worth it only if vmult() is called many times
+   * per assembly, as in iterative solvers.
+   *
+   * @note Tvmult(), Tvmult_add(), and all other operations are not affected
+   *   and continue to use the compressed row storage.
+   */
+  void
+  build_vectorized_storage(const unsigned int sort_window = 256);
+
+  /**
+   * Discard the SELL-C-$\sigma$ copy of the matrix created by
+   * build_vectorized_storage(), so that subsequent vmult() calls use the
+   * compressed row storage again.
+   */
+  void
+  clear_vectorized_storage();
+
+  /**
+   * Return whether a SELL-C-$\sigma$ copy of the matrix created by
+   * build_vectorized_storage() is currently in use.
+   */
+  bool
+  has_vectorized_storage() const;
+
   /**
    * Matrix-vector multiplication: let <i>dst = M*src</i> with <i>M</i> being
    * this matrix.
@@ -1134,6 +1242,29 @@ public:
   void
   vmult(OutVector &dst, const InVector &src) const;
 
+  /**
+   * Matrix-multi-vector multiplication: apply this matrix to each of the
+   * vectors pointed to by @p src and store the results in the vectors
+   * pointed to by the corresponding entries of @p dst, i.e.,
+   * <i>dst[k] = M*src[k]</i>.
+   *
+   * In contrast to calling vmult() once per right-hand side, the matrix
+   * entries of each row are streamed from memory only once and applied to
+   * all vectors, which is considerably faster for operations on many
+   * simultaneous right-hand sides as they appear in block Krylov methods or
+   * eigenvalue computations, where the matrix data traffic is the
+   * bottleneck. The right-hand sides are processed in small blocks so that
+   * the compiler can vectorize across the vectors.
+   *
+   * None of the destination vectors may coincide with a source vector.
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <class OutVector, class InVector>
+  void
+  vmult(const ArrayView<OutVector *const>      &dst,
+        const ArrayView<const InVector *const> &src) const;
+
   /**
    * Matrix-vector multiplication: let <i>dst = M<sup>T</sup>*src</i> with
    * <i>M</i> being this matrix. This function does the same as vmult() but
@@ -1763,6 +1894,15 @@ private:
    */
   std::size_t max_len;
 
+  /**
+   * Optional copy of the matrix in SELL-C-sigma storage, used by vmult()
+   * and vmult_add() if it has been requested by a call to
+   * build_vectorized_storage(). A value of <tt>nullptr</tt> means that the
+   * compressed row storage is used.
+   */
+  std::unique_ptr<internal::SparseMatrixImplementation::SellCSigmaStorage<number>>
+    sell_data;
+
   // make all other sparse matrices friends
   template <typename somenumber>
   friend class SparseMatrix;
@@ -21,6 +21,7 @@
 #include <deal.II/base/parallel.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/utilities.h>
+#include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/full_matrix.h>
@@ -35,6 +36,7 @@
 #include <cmath>
 #include <functional>
 #include <iomanip>
+#include <limits>
 #include <numeric>
 #include <ostream>
 #include <vector>
@@ -76,6 +78,7 @@ SparseMatrix<number>::SparseMatrix(SparseMatrix<number> &&m) noexcept
   , cols(m.cols)
   , val(std::move(m.val))
   , max_len(m.max_len)
+  , sell_data(std::move(m.sell_data))
 {
   m.cols    = nullptr;
   m.val     = nullptr;
@@ -104,9 +107,10 @@ template <typename number>
 SparseMatrix<number> &
 SparseMatrix<number>::operator=(SparseMatrix<number> &&m) noexcept
 {
-  cols    = m.cols;
-  val     = std::move(m.val);
-  max_len = m.max_len;
+  cols      = m.cols;
+  val       = std::move(m.val);
+  max_len   = m.max_len;
+  sell_data = std::move(m.sell_data);
 
   m.cols    = nullptr;
   m.val     = nullptr;
@@ -195,6 +199,9 @@ SparseMatrix<number>::operator=(const double d)
   Assert(cols->compressed || cols->empty(),
          SparsityPattern::ExcNotCompressed());
 
+  // a possibly existing SELL-C-sigma copy of the entries is now stale
+  sell_data.reset();
+
   // do initial zeroing of elements in parallel. Try to achieve a similar
   // layout as when doing matrix-vector products, as on some NUMA systems, a
   // memory block is assigned to memory banks where the first access is
@@ -253,6 +260,7 @@ void
 SparseMatrix<number>::reinit(const SparsityPattern &sparsity)
 {
   cols = &sparsity;
+  sell_data.reset();
 
   if (cols->empty())
     {
@@ -280,6 +288,7 @@ SparseMatrix<number>::clear()
   cols = nullptr;
   val.reset();
   max_len = 0;
+  sell_data.reset();
 }
 
 
@@ -521,6 +530,142 @@ namespace internal
             *dst_ptr++ = s;
           }
     }
+
+
+
+    /**
+     * Like vmult_on_subrange(), but applying the matrix to several vectors
+     * at once so that the matrix entries of each row are streamed from
+     * memory only once. The right-hand sides are processed in small blocks
+     * of accumulators to let the compiler vectorize across the vectors.
+     */
+    template <typename number, typename InVector, typename OutVector>
+    void
+    vmult_multi_on_subrange(const size_type                         begin_row,
+                            const size_type                         end_row,
+                            const number                           *values,
+                            const std::size_t                      *rowstart,
+                            const size_type                        *colnums,
+                            const ArrayView<const InVector *const> &src,
+                            const ArrayView<OutVector *const>      &dst)
+    {
+      using value_type                   = typename OutVector::value_type;
+      constexpr unsigned int block_size  = 4;
+      const unsigned int     n_vectors   = src.size();
+
+      for (unsigned int k0 = 0; k0 < n_vectors; k0 += block_size)
+        {
+          const unsigned int n_k =
+            std::min<unsigned int>(block_size, n_vectors - k0);
+          for (size_type row = begin_row; row < end_row; ++row)
+            {
+              value_type s[block_size] = {};
+              for (std::size_t ind = rowstart[row]; ind < rowstart[row + 1];
+                   ++ind)
+                {
+                  const value_type v(values[ind]);
+                  const size_type  col = colnums[ind];
+                  for (unsigned int k = 0; k < n_k; ++k)
+                    s[k] += v * value_type((*src[k0 + k])(col));
+                }
+              for (unsigned int k = 0; k < n_k; ++k)
+                (*dst[k0 + k])(row) = s[k];
+            }
+        }
+    }
+
+
+
+    /**
+     * Width of the SIMD vectorization available for a given number type.
+     * Number types not covered by VectorizedArray, e.g. complex numbers,
+     * are processed with scalar operations.
+     */
+    template <typename number, typename = void>
+    struct VectorizationWidth
+    {
+      static constexpr unsigned int value = 1;
+    };
+
+    template <typename number>
+    struct VectorizationWidth<number,
+                              std::enable_if_t<std::is_same_v<number, float> ||
+                                               std::is_same_v<number, double>>>
+    {
+      static constexpr unsigned int value = VectorizedArray<number>::size();
+    };
+
+
+
+    /**
+     * Perform a vmult using the SELL-C-sigma copy of the matrix created by
+     * SparseMatrix::build_vectorized_storage(), restricted to the slices in
+     * the half-open interval [begin_slice, end_slice).
+     *
+     * Each iteration of the inner loop processes one entry of all rows of a
+     * slice: the matrix entries are read with a contiguous vector load, the
+     * source vector entries are collected with a gather, and a single
+     * multiply-add updates the accumulators of all rows of the slice. The
+     * accumulators are finally written back through the row permutation
+     * induced by the sigma-sorting.
+     */
+    template <typename number>
+    void
+    vmult_sell_on_subrange(const size_type                  begin_slice,
+                           const size_type                  end_slice,
+                           const SellCSigmaStorage<number> &sell,
+                           const number *const              src,
+                           number *const                    dst,
+                           const bool                       add)
+    {
+      constexpr unsigned int width = VectorizationWidth<number>::value;
+      if constexpr (width > 1)
+        {
+          for (size_type slice = begin_slice; slice < end_slice; ++slice)
+            {
+              VectorizedArray<number> sums = number();
+              for (std::size_t j = sell.slice_start[slice];
+                   j < sell.slice_start[slice + 1];
+                   j += width)
+                {
+                  VectorizedArray<number> matrix_values, src_values;
+                  matrix_values.load(sell.values.data() + j);
+                  src_values.gather(src, sell.column_indices.data() + j);
+                  sums += matrix_values * src_values;
+                }
+
+              // write the accumulators to the (sigma-sorted) rows of the
+              // slice; the last slice may only be partially filled
+              const types::global_dof_index *const rows =
+                sell.rows.data() + slice * width;
+              const unsigned int n_lanes =
+                std::min<std::size_t>(width, sell.rows.size() - slice * width);
+              if (add == false)
+                for (unsigned int lane = 0; lane < n_lanes; ++lane)
+                  dst[rows[lane]] = sums[lane];
+              else
+                for (unsigned int lane = 0; lane < n_lanes; ++lane)
+                  dst[rows[lane]] += sums[lane];
+            }
+        }
+      else
+        {
+          // for number types without SIMD support, each slice holds a
+          // single row
+          for (size_type slice = begin_slice; slice < end_slice; ++slice)
+            {
+              number s = number();
+              for (std::size_t j = sell.slice_start[slice];
+                   j < sell.slice_start[slice + 1];
+                   ++j)
+                s += sell.values[j] * src[sell.column_indices[j]];
+              if (add == false)
+                dst[sell.rows[slice]] = s;
+              else
+                dst[sell.rows[slice]] += s;
+            }
+        }
+    }
   } // namespace SparseMatrixImplementation
 } // namespace internal
 
@@ -766,6 +911,117 @@ SparseMatrix<number>::set(const size_type  row,
 
 
 
+template <typename number>
+void
+SparseMatrix<number>::build_vectorized_storage(const unsigned int sort_window)
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  Assert(sort_window > 0, ExcMessage("The sort window must not be empty."));
+  AssertThrow(
+    n() <= std::numeric_limits<unsigned int>::max(),
+    ExcMessage("The SELL-C-sigma storage addresses columns with 32-bit "
+               "indices and can therefore not be used for this matrix."));
+
+  constexpr unsigned int slice_size =
+    internal::SparseMatrixImplementation::VectorizationWidth<number>::value;
+
+  const size_type          n_rows   = m();
+  const std::size_t *const rowstart = cols->rowstart.get();
+  const size_type *const   colnums  = cols->colnums.get();
+
+  auto data = std::make_unique<
+    internal::SparseMatrixImplementation::SellCSigmaStorage<number>>();
+  data->slice_size = slice_size;
+
+  // sigma-sorting: sort rows by decreasing length within windows of
+  // sort_window rows, so that the rows grouped into a slice have similar
+  // lengths; the sort is stable to keep the access pattern close to the
+  // original row ordering
+  data->rows.resize(n_rows);
+  for (size_type row = 0; row < n_rows; ++row)
+    data->rows[row] = row;
+  for (size_type window_begin = 0; window_begin < n_rows;
+       window_begin += sort_window)
+    std::stable_sort(data->rows.begin() + window_begin,
+                     data->rows.begin() +
+                       std::min<size_type>(window_begin + sort_window, n_rows),
+                     [&](const size_type a, const size_type b) {
+                       return (rowstart[a + 1] - rowstart[a]) >
+                              (rowstart[b + 1] - rowstart[b]);
+                     });
+
+  // the padded length of a slice is the length of its longest row
+  const size_type n_slices = (n_rows + slice_size - 1) / slice_size;
+  data->slice_start.resize(n_slices + 1);
+  data->slice_start[0] = 0;
+  for (size_type slice = 0; slice < n_slices; ++slice)
+    {
+      std::size_t max_length = 0;
+      for (unsigned int lane = 0;
+           lane < slice_size && slice * slice_size + lane < n_rows;
+           ++lane)
+        {
+          const size_type row = data->rows[slice * slice_size + lane];
+          max_length = std::max(max_length, rowstart[row + 1] - rowstart[row]);
+        }
+      data->slice_start[slice + 1] =
+        data->slice_start[slice] + max_length * slice_size;
+    }
+
+  // interleave values and column indices; padding entries hold a zero value
+  // and repeat the last column index of their row so that the padded gathers
+  // stay local
+  data->values.resize(data->slice_start[n_slices], number());
+  data->column_indices.resize(data->slice_start[n_slices], 0u);
+  for (size_type slice = 0; slice < n_slices; ++slice)
+    {
+      const std::size_t slice_begin = data->slice_start[slice];
+      const std::size_t padded_length =
+        (data->slice_start[slice + 1] - slice_begin) / slice_size;
+      for (unsigned int lane = 0;
+           lane < slice_size && slice * slice_size + lane < n_rows;
+           ++lane)
+        {
+          const size_type   row    = data->rows[slice * slice_size + lane];
+          const std::size_t length = rowstart[row + 1] - rowstart[row];
+          for (std::size_t j = 0; j < length; ++j)
+            {
+              data->values[slice_begin + j * slice_size + lane] =
+                val[rowstart[row] + j];
+              data->column_indices[slice_begin + j * slice_size + lane] =
+                static_cast<unsigned int>(colnums[rowstart[row] + j]);
+            }
+          if (length > 0)
+            for (std::size_t j = length; j < padded_length; ++j)
+              data->column_indices[slice_begin + j * slice_size + lane] =
+                static_cast<unsigned int>(colnums[rowstart[row + 1] - 1]);
+        }
+    }
+
+  sell_data = std::move(data);
+}
+
+
+
+template <typename number>
+void
+SparseMatrix<number>::clear_vectorized_storage()
+{
+  sell_data.reset();
+}
+
+
+
+template <typename number>
+bool
+SparseMatrix<number>::has_vectorized_storage() const
+{
+  return sell_data != nullptr;
+}
+
+
+
 template <typename number>
 template <class OutVector, class InVector>
 void
@@ -778,6 +1034,29 @@ SparseMatrix<number>::vmult(OutVector &dst, const InVector &src) const
 
   Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
 
+  if constexpr (std::is_same_v<InVector, Vector<number>> &&
+                std::is_same_v<OutVector, Vector<number>>)
+    if (sell_data != nullptr)
+      {
+        parallel::apply_to_subranges(
+          0U,
+          sell_data->slice_start.size() - 1,
+          [this, &src, &dst](const size_type begin_slice,
+                             const size_type end_slice) {
+            internal::SparseMatrixImplementation::vmult_sell_on_subrange(
+              begin_slice,
+              end_slice,
+              *sell_data,
+              src.begin(),
+              dst.begin(),
+              false);
+          },
+          internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+              sell_data->slice_size +
+            1);
+        return;
+      }
+
   parallel::apply_to_subranges(
     0U,
     m(),
@@ -797,6 +1076,42 @@ SparseMatrix<number>::vmult(OutVector &dst, const InVector &src) const
 
 
 
+template <typename number>
+template <class OutVector, class InVector>
+void
+SparseMatrix<number>::vmult(const ArrayView<OutVector *const>      &dst,
+                            const ArrayView<const InVector *const> &src) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(dst.size(), src.size());
+  for (unsigned int k = 0; k < src.size(); ++k)
+    {
+      Assert(m() == dst[k]->size(), ExcDimensionMismatch(m(), dst[k]->size()));
+      Assert(n() == src[k]->size(), ExcDimensionMismatch(n(), src[k]->size()));
+      for (unsigned int j = 0; j < dst.size(); ++j)
+        Assert(!PointerComparison::equal(src[k], dst[j]),
+               ExcSourceEqualsDestination());
+    }
+
+  parallel::apply_to_subranges(
+    0U,
+    m(),
+    [this, &src, &dst](const size_type begin_row, const size_type end_row) {
+      internal::SparseMatrixImplementation::vmult_multi_on_subrange(
+        begin_row,
+        end_row,
+        val.get(),
+        cols->rowstart.get(),
+        cols->colnums.get(),
+        src,
+        dst);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+}
+
+
+
 template <typename number>
 template <class OutVector, class InVector>
 void
@@ -836,6 +1151,29 @@ SparseMatrix<number>::vmult_add(OutVector &dst, const InVector &src) const
 
   Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
 
+  if constexpr (std::is_same_v<InVector, Vector<number>> &&
+                std::is_same_v<OutVector, Vector<number>>)
+    if (sell_data != nullptr)
+      {
+        parallel::apply_to_subranges(
+          0U,
+          sell_data->slice_start.size() - 1,
+          [this, &src, &dst](const size_type begin_slice,
+                             const size_type end_slice) {
+            internal::SparseMatrixImplementation::vmult_sell_on_subrange(
+              begin_slice,
+              end_slice,
+              *sell_data,
+              src.begin(),
+              dst.begin(),
+              true);
+          },
+          internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+              sell_data->slice_size +
+            1);
+        return;
+      }
+
   parallel::apply_to_subranges(
     0U,
     m(),
@@ -2086,7 +2424,14 @@ template <typename number>
 std::size_t
 SparseMatrix<number>::memory_consumption() const
 {
-  return max_len * static_cast<std::size_t>(sizeof(number)) + sizeof(*this);
+  std::size_t mem =
+    max_len * static_cast<std::size_t>(sizeof(number)) + sizeof(*this);
+  if (sell_data != nullptr)
+    mem += sell_data->values.memory_consumption() +
+           sell_data->column_indices.memory_consumption() +
+           sell_data->slice_start.capacity() * sizeof(std::size_t) +
+           sell_data->rows.capacity() * sizeof(types::global_dof_index);
+  return mem;
 }
 
 
@@ -682,6 +682,18 @@ public:
   void
   copy_from(const DynamicSparsityPattern &dsp);
 
+  /**
+   * Same as the function above, but destructively consume the given
+   * DynamicSparsityPattern: the memory of each of its rows is released
+   * right after the row has been copied into the current object. Since the
+   * intermediate dynamic representation is typically several times larger
+   * than the final compressed pattern, this substantially reduces the peak
+   * memory consumption of the conversion for large problems. The source
+   * pattern is empty afterwards.
+   */
+  void
+  copy_from(DynamicSparsityPattern &&dsp);
+
   /**
    * Copy data from a SparsityPattern. Previous content of this object is
    * lost, and the sparsity pattern is in compressed mode afterwards.
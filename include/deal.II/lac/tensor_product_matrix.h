@@ -444,24 +444,13 @@ private:
     cache;
 
   /**
-   * Map from index to the storage position within mass_matrices,
-   * derivative_matrices, eigenvectors, and
+   * Map from index to the storage position within eigenvectors and
    * eigenvalues. If compression was not successful, this
    * vector is empty, since the vectors can be access directly
    * with the given index.
    */
   std::vector<unsigned int> indices;
 
-  /**
-   * Vector of 1d mass matrices.
-   */
-  AlignedVector<Number> mass_matrices;
-
-  /**
-   * Vector of 1d derivative matrices.
-   */
-  AlignedVector<Number> derivative_matrices;
-
   /**
    * Vector of eigenvectors.
    */
@@ -478,12 +467,12 @@ private:
   AlignedVector<Number> inverted_eigenvalues;
 
   /**
-   * Pointer into mass_matrices, derivative_matrices, and eigenvalues.
+   * Pointer into eigenvalues and inverted_eigenvalues.
    */
   std::vector<unsigned int> vector_ptr;
 
   /**
-   * Pointer into mass_matrices, derivative_matrices, and eigenvalues.
+   * Pointer into eigenvectors.
    */
   std::vector<unsigned int> matrix_ptr;
 
@@ -1225,11 +1214,7 @@ TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::finalize()
          ++i, ++v)
       {
         for (unsigned int j = 0; j < mass_matrix[0].n_cols(); ++j, ++m)
-          {
-            this->mass_matrices[m]       = mass_matrix[0][i][j];
-            this->derivative_matrices[m] = derivative_matrix[0][i][j];
-            this->eigenvectors[m]        = eigenvectors[0][i][j];
-          }
+          this->eigenvectors[m] = eigenvectors[0][i][j];
 
         this->eigenvalues[v] = eigenvalues[0][i];
       }
@@ -1259,8 +1244,6 @@ TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::finalize()
           this->matrix_ptr[i + 1] += this->matrix_ptr[i];
         }
 
-      this->mass_matrices.resize_fast(matrix_ptr.back());
-      this->derivative_matrices.resize_fast(matrix_ptr.back());
       this->eigenvectors.resize_fast(matrix_ptr.back());
       this->eigenvalues.resize_fast(vector_ptr.back());
 
@@ -1295,8 +1278,6 @@ TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::finalize()
           this->matrix_ptr[i + 1] += this->matrix_ptr[i];
         }
 
-      this->mass_matrices.resize_fast(matrix_ptr.back());
-      this->derivative_matrices.resize_fast(matrix_ptr.back());
       this->eigenvectors.resize_fast(matrix_ptr.back());
       this->eigenvalues.resize_fast(vector_ptr.back());
 
@@ -1327,8 +1308,6 @@ TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::finalize()
           this->matrix_ptr[i + 1] += this->matrix_ptr[i];
         }
 
-      this->mass_matrices.resize_fast(matrix_ptr.back());
-      this->derivative_matrices.resize_fast(matrix_ptr.back());
       this->eigenvectors.resize_fast(matrix_ptr.back());
       this->eigenvalues.resize_fast(vector_ptr.back());
 
@@ -1567,12 +1546,12 @@ TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::
   memory_consumption() const
 {
   return MemoryConsumption::memory_consumption(indices) +
-         MemoryConsumption::memory_consumption(mass_matrices) +
-         MemoryConsumption::memory_consumption(derivative_matrices) +
          MemoryConsumption::memory_consumption(eigenvectors) +
          MemoryConsumption::memory_consumption(eigenvalues) +
+         MemoryConsumption::memory_consumption(inverted_eigenvalues) +
          MemoryConsumption::memory_consumption(matrix_ptr) +
-         MemoryConsumption::memory_consumption(vector_ptr);
+         MemoryConsumption::memory_consumption(vector_ptr) +
+         MemoryConsumption::memory_consumption(vector_n_rows_1d);
 }
 
 
@@ -1657,10 +1657,42 @@ namespace TrilinosWrappers
      * considerably faster than the initialize function, since the coarsening
      * pattern is usually the most difficult thing to do when setting up the
      * AMG ML preconditioner.
+     *
+     * @note This function assumes that the matrix object handed to
+     * initialize() is still alive and that its entries have been updated in
+     * place, since the multilevel hierarchy keeps referencing that matrix.
+     * If the preconditioner was set up from a deal.II sparse matrix via the
+     * initialize() function taking a ::dealii::SparseMatrix, use
+     * update_values() instead, which first refreshes the internally stored
+     * Trilinos copy of the matrix.
      */
     void
     reinit();
 
+    /**
+     * A combination of the initialize() function taking a deal.II sparse
+     * matrix and reinit(): copy the (changed) entries of
+     * @p deal_ii_sparse_matrix into the internally stored Trilinos matrix
+     * without touching its sparsity pattern, and then recompute the
+     * multilevel hierarchy reusing the already generated coarsening
+     * structure. This is the function to call in, e.g., a Newton iteration
+     * where the matrix values change in every step but the sparsity pattern
+     * remains the same, and it is usually considerably cheaper than a full
+     * initialize() call.
+     *
+     * The entries of @p deal_ii_sparse_matrix are copied by walking the
+     * sparsity pattern of the stored Trilinos matrix, so entries that were
+     * dropped when the preconditioner was first set up (see the
+     * @p drop_tolerance argument of initialize()) are ignored again.
+     *
+     * This function can only be called if the preconditioner has previously
+     * been set up with the initialize() function taking a deal.II sparse
+     * matrix.
+     */
+    template <typename number>
+    void
+    update_values(const ::dealii::SparseMatrix<number> &deal_ii_sparse_matrix);
+
     /**
      * Destroys the preconditioner, leaving an object like just after having
      * called the constructor.
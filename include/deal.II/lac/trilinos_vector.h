@@ -662,6 +662,27 @@ namespace TrilinosWrappers
       void
       compress(VectorOperation::values operation);
 
+      /**
+       * Start the communication of compress(). This function exists for
+       * interface compatibility with
+       * LinearAlgebra::distributed::Vector, so that generic code can
+       * overlap communication and computation independently of the vector
+       * backend. Since Epetra only provides blocking data exchange, this
+       * function does nothing and the whole exchange is performed in
+       * compress_finish(); the @p communication_channel argument is ignored.
+       */
+      void
+      compress_start(const unsigned int      communication_channel = 0,
+                     VectorOperation::values operation = VectorOperation::add);
+
+      /**
+       * Finish the communication started by compress_start(). For this
+       * class, this is where the actual (blocking) data exchange of
+       * compress() happens.
+       */
+      void
+      compress_finish(VectorOperation::values operation);
+
       /**
        * Set all components of the vector to the given number @p s. Simply
        * pass this down to the base class, but we still need to declare this
@@ -870,6 +891,24 @@ namespace TrilinosWrappers
       void
       update_ghost_values() const;
 
+      /**
+       * This function only exists for compatibility with the @p
+       * LinearAlgebra::distributed::Vector class and does nothing, see
+       * update_ghost_values(); the @p communication_channel argument is
+       * ignored.
+       */
+      void
+      update_ghost_values_start(
+        const unsigned int communication_channel = 0) const;
+
+      /**
+       * This function only exists for compatibility with the @p
+       * LinearAlgebra::distributed::Vector class and does nothing, see
+       * update_ghost_values().
+       */
+      void
+      update_ghost_values_finish() const;
+
       /**
        * Return the scalar (inner) product of two vectors. The vectors must have
        * the same size.
@@ -1546,6 +1585,32 @@ namespace TrilinosWrappers
 
 
 
+    inline void
+    Vector::update_ghost_values_start(const unsigned int) const
+    {}
+
+
+
+    inline void
+    Vector::update_ghost_values_finish() const
+    {}
+
+
+
+    inline void
+    Vector::compress_start(const unsigned int, VectorOperation::values)
+    {}
+
+
+
+    inline void
+    Vector::compress_finish(const VectorOperation::values operation)
+    {
+      compress(operation);
+    }
+
+
+
     inline internal::VectorReference
     Vector::operator()(const size_type index)
     {
@@ -380,6 +380,29 @@ public:
   static void
   release_unused_memory();
 
+  /**
+   * Release vectors that are not currently in use, but in contrast to the
+   * function above keep the @p n_vectors_to_keep most recently used ones
+   * around for later reuse. This allows trimming the pool in applications
+   * that go through phases with very different demands for temporary
+   * vectors, without giving up the allocation reuse that this class exists
+   * for: after a phase with many concurrent solvers has ended, a call to
+   * this function returns the excess memory to the operating system while
+   * the vectors a subsequent phase is likely to need again stay pooled.
+   */
+  static void
+  release_unused_memory(const size_type n_vectors_to_keep);
+
+  /**
+   * Print statistics about the memory pool for this vector type to the
+   * given stream: the number of vectors currently handed out to users and
+   * the number of vectors kept unused in the pool, along with the number of
+   * bytes each of the two groups consumes. This allows identifying idle
+   * pooled memory that could be released via release_unused_memory().
+   */
+  static void
+  print_statistics(std::ostream &out);
+
   /**
    * Memory consumed by this class and all currently allocated vectors.
    */
@@ -388,12 +411,18 @@ public:
 
 private:
   /**
-   * A type that describes this entries of an array that represents
-   * the vectors stored by this object. The first component of the pair
-   * is be a flag telling whether the vector is used, the second
-   * a pointer to the vector itself.
+   * A type that describes the entries of an array that represents the
+   * vectors stored by this object: a flag telling whether the vector is
+   * currently in use, a counter recording when the vector was last returned
+   * to the pool (used to identify the least recently used entries when
+   * trimming the pool), and a pointer to the vector itself.
    */
-  using entry_type = std::pair<bool, std::unique_ptr<VectorType>>;
+  struct entry_type
+  {
+    bool                        used;
+    size_type                   last_use;
+    std::unique_ptr<VectorType> vector;
+  };
 
   /**
    * The class providing the actual storage for the memory pool.
@@ -424,6 +453,14 @@ private:
      * Pointer to the storage object
      */
     std::vector<entry_type> *data;
+
+    /**
+     * A counter that is increased every time a vector is returned to the
+     * pool. Its value at that time is recorded in the corresponding entry,
+     * so that entries with small values are the ones that have been idle
+     * longest and are released first by release_unused_memory(n).
+     */
+    size_type last_use_counter;
   };
 
   /**
@@ -24,7 +24,9 @@
 
 #include <deal.II/lac/vector_memory.h>
 
+#include <algorithm>
 #include <memory>
+#include <ostream>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -61,6 +63,7 @@ Threads::Mutex GrowingVectorMemory<VectorType>::mutex;
 template <typename VectorType>
 inline GrowingVectorMemory<VectorType>::Pool::Pool()
   : data(nullptr)
+  , last_use_counter(0)
 {}
 
 
@@ -91,8 +94,9 @@ GrowingVectorMemory<VectorType>::Pool::initialize(const size_type size)
            i != data->end();
            ++i)
         {
-          i->first  = false;
-          i->second = std::make_unique<VectorType>();
+          i->used     = false;
+          i->last_use = 0;
+          i->vector   = std::make_unique<VectorType>();
         }
     }
 }
@@ -145,19 +149,19 @@ GrowingVectorMemory<VectorType>::alloc()
   // See if there is a currently unused vector available in our list
   for (entry_type &i : *get_pool().data)
     {
-      if (i.first == false)
+      if (i.used == false)
         {
-          i.first = true;
-          return i.second.get();
+          i.used = true;
+          return i.vector.get();
         }
     }
 
   // No currently unused vector found, so let's just allocate a new one
   // and return it:
-  const auto &new_entry =
-    get_pool().data->emplace_back(true, std::make_unique<VectorType>());
+  const auto &new_entry = get_pool().data->emplace_back(
+    entry_type{true, 0, std::make_unique<VectorType>()});
 
-  return new_entry.second.get();
+  return new_entry.vector.get();
 }
 
 
@@ -168,12 +172,14 @@ GrowingVectorMemory<VectorType>::free(const VectorType *const v)
 {
   std::lock_guard<std::mutex> lock(mutex);
 
-  // Find the vector to be de-allocated and mark it as now unused:
+  // Find the vector to be de-allocated and mark it as now unused,
+  // recording when it was returned:
   for (entry_type &i : *get_pool().data)
     {
-      if (v == i.second.get())
+      if (v == i.vector.get())
         {
-          i.first = false;
+          i.used     = false;
+          i.last_use = ++get_pool().last_use_counter;
           --current_alloc;
           return;
         }
@@ -198,6 +204,84 @@ GrowingVectorMemory<VectorType>::release_unused_memory()
 
 
 
+template <typename VectorType>
+inline void
+GrowingVectorMemory<VectorType>::release_unused_memory(
+  const size_type n_vectors_to_keep)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (get_pool().data == nullptr)
+    return;
+
+  // Collect all currently unused entries and order them so that the most
+  // recently returned ones come first.
+  std::vector<entry_type *> unused_entries;
+  for (entry_type &entry : *get_pool().data)
+    if (entry.used == false)
+      unused_entries.push_back(&entry);
+
+  if (unused_entries.size() <= n_vectors_to_keep)
+    return;
+
+  std::sort(unused_entries.begin(),
+            unused_entries.end(),
+            [](const entry_type *a, const entry_type *b) {
+              return a->last_use > b->last_use;
+            });
+
+  // Release the vectors of all unused entries beyond the requested number
+  // and then remove the emptied entries from the pool altogether.
+  for (std::size_t i = n_vectors_to_keep; i < unused_entries.size(); ++i)
+    unused_entries[i]->vector.reset();
+
+  get_pool().data->erase(std::remove_if(get_pool().data->begin(),
+                                        get_pool().data->end(),
+                                        [](const entry_type &entry) {
+                                          return (entry.used == false) &&
+                                                 (entry.vector == nullptr);
+                                        }),
+                         get_pool().data->end());
+}
+
+
+
+template <typename VectorType>
+inline void
+GrowingVectorMemory<VectorType>::print_statistics(std::ostream &out)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  GrowingVectorMemory<VectorType>::size_type n_used = 0, n_unused = 0;
+  std::size_t used_bytes = 0, unused_bytes = 0;
+
+  if (get_pool().data != nullptr)
+    for (const entry_type &entry : *get_pool().data)
+      {
+        const std::size_t bytes =
+          (entry.vector != nullptr ?
+             MemoryConsumption::memory_consumption(*entry.vector) :
+             0);
+        if (entry.used)
+          {
+            ++n_used;
+            used_bytes += bytes;
+          }
+        else
+          {
+            ++n_unused;
+            unused_bytes += bytes;
+          }
+      }
+
+  out << "GrowingVectorMemory: " << n_used << " vectors handed out ("
+      << used_bytes << " bytes), " << n_unused
+      << " vectors kept unused in the pool (" << unused_bytes << " bytes)"
+      << std::endl;
+}
+
+
+
 template <typename VectorType>
 inline std::size_t
 GrowingVectorMemory<VectorType>::memory_consumption() const
@@ -205,9 +289,11 @@ GrowingVectorMemory<VectorType>::memory_consumption() const
   std::lock_guard<std::mutex> lock(mutex);
 
   std::size_t result = sizeof(*this);
-  for (const auto &[_, ptr] : *get_pool().data)
-    result += sizeof(ptr) + (ptr ? MemoryConsumption::memory_consumption(*ptr) :
-                                   MemoryConsumption::memory_consumption(ptr));
+  for (const auto &entry : *get_pool().data)
+    result += sizeof(entry) +
+              (entry.vector ?
+                 MemoryConsumption::memory_consumption(*entry.vector) :
+                 MemoryConsumption::memory_consumption(entry.vector));
 
   return result;
 }
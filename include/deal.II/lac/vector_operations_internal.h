@@ -27,6 +27,7 @@
 
 #include <deal.II/lac/vector_operation.h>
 
+#include <array>
 #include <cstdio>
 #include <cstring>
 
@@ -564,6 +565,106 @@ namespace internal
       const Number        stored_b;
     };
 
+    template <typename Number>
+    struct Vectorization_sadd_xav_multi
+    {
+      /**
+       * Maximum number of source vectors that are fused into a single sweep
+       * over memory. Longer linear combinations need to be split into
+       * several calls.
+       */
+      static constexpr unsigned int max_vectors = 8;
+
+      Vectorization_sadd_xav_multi(
+        Number                                        *val,
+        const std::array<const Number *, max_vectors> &v_val,
+        const std::array<Number, max_vectors>         &a,
+        const unsigned int                             n_vectors,
+        const Number                                   x)
+        : val(val)
+        , v_val(v_val)
+        , stored_a(a)
+        , n_vectors(n_vectors)
+        , stored_x(x)
+      {}
+
+      void
+      operator()(const size_type begin, const size_type end) const
+      {
+        // dispatch to a loop with a compile-time number of source vectors so
+        // that the compiler can fully unroll the inner loop and keep the
+        // coefficients in registers
+        switch (n_vectors)
+          {
+            case 1:
+              do_loop<1>(begin, end);
+              break;
+            case 2:
+              do_loop<2>(begin, end);
+              break;
+            case 3:
+              do_loop<3>(begin, end);
+              break;
+            case 4:
+              do_loop<4>(begin, end);
+              break;
+            case 5:
+              do_loop<5>(begin, end);
+              break;
+            case 6:
+              do_loop<6>(begin, end);
+              break;
+            case 7:
+              do_loop<7>(begin, end);
+              break;
+            case 8:
+              do_loop<8>(begin, end);
+              break;
+            default:
+              DEAL_II_ASSERT_UNREACHABLE();
+          }
+      }
+
+    private:
+      template <unsigned int n>
+      void
+      do_loop(const size_type begin, const size_type end) const
+      {
+        // create local copies of the variables to help the compiler with the
+        // aliasing analysis
+        const Number                          x = stored_x;
+        const std::array<Number, max_vectors> a = stored_a;
+
+        if (::dealii::parallel::internal::EnableOpenMPSimdFor<Number>::value)
+          {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (size_type i = begin; i < end; ++i)
+              {
+                Number sum = x * val[i];
+                for (unsigned int j = 0; j < n; ++j)
+                  sum += a[j] * v_val[j][i];
+                val[i] = sum;
+              }
+          }
+        else
+          {
+            for (size_type i = begin; i < end; ++i)
+              {
+                Number sum = x * val[i];
+                for (unsigned int j = 0; j < n; ++j)
+                  sum += a[j] * v_val[j][i];
+                val[i] = sum;
+              }
+          }
+      }
+
+      Number *const                                 val;
+      const std::array<const Number *, max_vectors> v_val;
+      const std::array<Number, max_vectors>         stored_a;
+      const unsigned int                            n_vectors;
+      const Number                                  stored_x;
+    };
+
     template <typename Number>
     struct Vectorization_scale
     {
@@ -1578,6 +1679,22 @@ namespace internal
         ::dealii::MemorySpace::MemorySpaceData<Number, MemorySpace> & /*data*/)
       {}
 
+      static void
+      sadd_xav_multi(
+        const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner> &
+        /*thread_loop_partitioner*/,
+        const size_type /*size*/,
+        const Number /*x*/,
+        const std::array<Number,
+                         Vectorization_sadd_xav_multi<Number>::max_vectors>
+          & /*a*/,
+        const std::array<const Number *,
+                         Vectorization_sadd_xav_multi<Number>::max_vectors>
+          & /*v_val*/,
+        const unsigned int /*n_vectors*/,
+        ::dealii::MemorySpace::MemorySpaceData<Number, MemorySpace> & /*data*/)
+      {}
+
       static void
       multiply_factor(
         const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner> &
@@ -1886,6 +2003,27 @@ namespace internal
         parallel_for(vector_sadd, 0, size, thread_loop_partitioner);
       }
 
+      static void
+      sadd_xav_multi(
+        const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
+                       &thread_loop_partitioner,
+        const size_type size,
+        const Number    x,
+        const std::array<Number,
+                         Vectorization_sadd_xav_multi<Number>::max_vectors> &a,
+        const std::array<const Number *,
+                         Vectorization_sadd_xav_multi<Number>::max_vectors>
+                          &v_val,
+        const unsigned int n_vectors,
+        ::dealii::MemorySpace::MemorySpaceData<Number,
+                                               ::dealii::MemorySpace::Host>
+          &data)
+      {
+        Vectorization_sadd_xav_multi<Number> vector_sadd(
+          data.values.data(), v_val, a, n_vectors, x);
+        parallel_for(vector_sadd, 0, size, thread_loop_partitioner);
+      }
+
       static void
       multiply_factor(
         const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
@@ -2343,6 +2481,37 @@ namespace internal
         exec.fence();
       }
 
+      static void
+      sadd_xav_multi(
+        const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner> &,
+        const size_type size,
+        const Number    x,
+        const std::array<Number,
+                         Vectorization_sadd_xav_multi<Number>::max_vectors> &a,
+        const std::array<const Number *,
+                         Vectorization_sadd_xav_multi<Number>::max_vectors>
+                          &v_val,
+        const unsigned int n_vectors,
+        ::dealii::MemorySpace::MemorySpaceData<Number,
+                                               ::dealii::MemorySpace::Default>
+          &data)
+      {
+        auto exec = typename ::dealii::MemorySpace::Default::kokkos_space::
+          execution_space{};
+        Kokkos::parallel_for(
+          "dealii::sadd_xav_multi",
+          Kokkos::RangePolicy<
+            ::dealii::MemorySpace::Default::kokkos_space::execution_space>(
+            exec, 0, size),
+          KOKKOS_LAMBDA(size_type i) {
+            Number sum = x * data.values(i);
+            for (unsigned int j = 0; j < n_vectors; ++j)
+              sum += a[j] * v_val[j][i];
+            data.values(i) = sum;
+          });
+        exec.fence();
+      }
+
       static void
       multiply_factor(
         const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner> &,
@@ -26,6 +26,7 @@
 #include <deal.II/matrix_free/shape_info.h>
 
 #include <array>
+#include <cstdint>
 #include <memory>
 
 
@@ -42,6 +43,8 @@ namespace internal
     template <int dim>
     class HangingNodes;
 
+    enum class ConstraintKinds : std::uint16_t;
+
     struct TaskInfo;
 
     template <typename Number>
@@ -213,6 +216,9 @@ namespace internal
       /**
        * For a given cell, determine if it has hanging node constraints. If yes,
        * adjust the dof indices, store the mask, and return true as indication.
+       * The geometric refinement configuration of the cell is passed in by the
+       * caller, which allows it to be computed only once per cell and shared
+       * between all DoFHandler objects attached to the same triangulation.
        */
       template <int dim>
       bool
@@ -221,7 +227,8 @@ namespace internal
         const std::vector<std::vector<unsigned int>> &lexicographic_mapping,
         const unsigned int                            cell_number,
         const TriaIterator<DoFCellAccessor<dim, dim, false>> &cell,
-        std::vector<types::global_dof_index>                 &dof_indices);
+        std::vector<types::global_dof_index>                 &dof_indices,
+        const ConstraintKinds &refinement_configuration);
 
       /**
        * This method assigns the correct indices to ghost indices from the
@@ -537,7 +544,11 @@ namespace internal
         constraint_indicator;
 
       /**
-       * Reordered index storage for `IndexStorageVariants::interleaved`.
+       * Reordered index storage for `IndexStorageVariants::interleaved`. The
+       * array is only allocated in case at least one cell batch has been
+       * classified with that storage variant, so it does not contribute to
+       * the memory consumption in the common case where all cell batches use
+       * one of the other variants.
        */
       std::vector<unsigned int> dof_indices_interleaved;
 
@@ -165,6 +165,32 @@ namespace internal
                   constraint_iterator.first++;
                 }
             }
+          // the positions in row_starts as well as the local index space
+          // (locally owned plus ghost indices) are stored as 32-bit numbers;
+          // rather than wrapping around silently on very large problems,
+          // detect the overflow and abort with a useful message
+          AssertThrow(dof_indices.size() <=
+                        std::numeric_limits<unsigned int>::max(),
+                      ExcMessage(
+                        "The total number of cell DoF indices on this process "
+                        "exceeds the 32-bit index range used by the "
+                        "matrix-free index storage. Use more MPI processes to "
+                        "reduce the number of cells per process."));
+          AssertThrow(constraint_indicator.size() <=
+                        std::numeric_limits<unsigned int>::max(),
+                      ExcMessage(
+                        "The total number of constraint indicators on this "
+                        "process exceeds the 32-bit index range used by the "
+                        "matrix-free index storage. Use more MPI processes to "
+                        "reduce the number of cells per process."));
+          AssertThrow(n_owned + ghost_dofs.size() <
+                        std::numeric_limits<unsigned int>::max(),
+                      ExcMessage(
+                        "The local index space consisting of the locally "
+                        "owned and ghost DoFs on this process exceeds the "
+                        "32-bit index range used by the matrix-free index "
+                        "storage. Use more MPI processes to reduce the "
+                        "number of DoFs per process."));
           row_starts[cell_number * n_components + comp + 1].first =
             dof_indices.size();
           row_starts[cell_number * n_components + comp + 1].second =
@@ -212,15 +238,14 @@ namespace internal
       const std::vector<std::vector<unsigned int>> &lexicographic_mapping,
       const unsigned int                            cell_number,
       const TriaIterator<DoFCellAccessor<dim, dim, false>> &cell,
-      std::vector<types::global_dof_index>                 &dof_indices)
+      std::vector<types::global_dof_index>                 &dof_indices,
+      const ConstraintKinds &refinement_configuration)
     {
       if (this->hanging_node_constraint_masks_comp.empty())
         return false;
 
-      // 2) determine the refinement configuration of the cell
-      const auto refinement_configuration =
-        hanging_nodes.compute_refinement_configuration(cell);
-
+      // 2) check the refinement configuration of the cell determined by the
+      //    caller via HangingNodes::compute_refinement_configuration()
       if (refinement_configuration == ConstraintKinds::unconstrained)
         return false;
 
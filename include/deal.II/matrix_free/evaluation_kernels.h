@@ -1155,7 +1155,9 @@ namespace internal
    * functions represented by bases in the collocation space, used by
    * FEEvaluationImplCollocation and FEEvaluationImplTransformToCollocation.
    * The evaluation strategy uses sum factorization with the even-odd
-   * optimization and fixed loop bounds.
+   * optimization and fixed loop bounds, unless the template parameter
+   * @p n_points_1d is zero, in which case the number of points is taken
+   * from the given shape data at run time.
    */
   template <int n_points_1d, int dim, typename Number, typename Number2>
   inline void
@@ -1164,8 +1166,10 @@ namespace internal
     const Number                                            *values,
     Number                                                  *gradients)
   {
+    const unsigned int n_points =
+      n_points_1d > 0 ? n_points_1d : shape.n_q_points_1d;
     AssertDimension(shape.shape_gradients_collocation_eo.size(),
-                    (n_points_1d + 1) / 2 * n_points_1d);
+                    (n_points + 1) / 2 * n_points);
 
     EvaluatorTensorProduct<evaluate_evenodd,
                            dim,
@@ -1173,14 +1177,14 @@ namespace internal
                            n_points_1d,
                            Number,
                            Number2>
-      eval({}, shape.shape_gradients_collocation_eo, {});
+      eval({}, shape.shape_gradients_collocation_eo, {}, n_points, n_points);
     EvaluatorTensorProduct<evaluate_evenodd,
                            2,
                            n_points_1d,
                            n_points_1d,
                            Number,
                            Number2>
-      eval_2d({}, shape.shape_gradients_collocation_eo, {});
+      eval_2d({}, shape.shape_gradients_collocation_eo, {}, n_points, n_points);
 
     if (dim == 1)
       eval.template gradients<0, true, false>(values, gradients);
@@ -1188,9 +1192,9 @@ namespace internal
       {
         if (dim > 2)
           eval.template gradients<2, true, false, dim>(values, gradients + 2);
-        constexpr unsigned int loop_bound  = (dim > 2 ? n_points_1d : 1);
-        constexpr unsigned int n_points_2d = n_points_1d * n_points_1d;
-        const Number          *in = values + (loop_bound - 1) * n_points_2d;
+        const unsigned int loop_bound  = (dim > 2 ? n_points : 1);
+        const unsigned int n_points_2d = n_points * n_points;
+        const Number      *in          = values + (loop_bound - 1) * n_points_2d;
         Number *out = gradients + (loop_bound - 1) * dim * n_points_2d;
         for (unsigned int l = 0; l < loop_bound; ++l)
           {
@@ -1209,7 +1213,9 @@ namespace internal
    * sums over quadrature points for function representations in the
    * collocation space, used by FEEvaluationImplCollocation and
    * FEEvaluationImplTransformToCollocation. The evaluation strategy uses sum
-   * factorization with the even-odd optimization and fixed loop bounds.
+   * factorization with the even-odd optimization and fixed loop bounds,
+   * unless the template parameter @p n_points_1d is zero, in which case the
+   * number of points is taken from the given shape data at run time.
    */
   template <int n_points_1d, int dim, typename Number, typename Number2>
   inline void
@@ -1219,8 +1225,10 @@ namespace internal
     const Number                                            *gradients,
     const bool add_into_values_array)
   {
+    const unsigned int n_points =
+      n_points_1d > 0 ? n_points_1d : shape.n_q_points_1d;
     AssertDimension(shape.shape_gradients_collocation_eo.size(),
-                    (n_points_1d + 1) / 2 * n_points_1d);
+                    (n_points + 1) / 2 * n_points);
 
     EvaluatorTensorProduct<evaluate_evenodd,
                            dim,
@@ -1228,14 +1236,14 @@ namespace internal
                            n_points_1d,
                            Number,
                            Number2>
-      eval({}, shape.shape_gradients_collocation_eo, {});
+      eval({}, shape.shape_gradients_collocation_eo, {}, n_points, n_points);
     EvaluatorTensorProduct<evaluate_evenodd,
                            2,
                            n_points_1d,
                            n_points_1d,
                            Number,
                            Number2>
-      eval_2d({}, shape.shape_gradients_collocation_eo, {});
+      eval_2d({}, shape.shape_gradients_collocation_eo, {}, n_points, n_points);
 
     if (dim == 1)
       {
@@ -1246,8 +1254,8 @@ namespace internal
       }
     else
       {
-        constexpr unsigned int loop_bound  = (dim > 2 ? n_points_1d : 1);
-        constexpr unsigned int n_points_2d = n_points_1d * n_points_1d;
+        const unsigned int loop_bound  = (dim > 2 ? n_points : 1);
+        const unsigned int n_points_2d = n_points * n_points;
 
         const Number *in  = gradients + (loop_bound - 1) * dim * n_points_2d;
         Number       *out = values + (loop_bound - 1) * n_points_2d;
@@ -1847,17 +1855,30 @@ namespace internal
       return;
 
     AssertDimension(fe_eval.get_shape_info().data.size(), 2);
-    AssertDimension(n_q_points_1d,
-                    fe_eval.get_shape_info().data[0].n_q_points_1d);
-    AssertDimension(n_q_points_1d,
-                    fe_eval.get_shape_info().data[1].n_q_points_1d);
-    AssertDimension(fe_degree, fe_eval.get_shape_info().data[0].fe_degree);
-    AssertDimension(fe_degree, fe_eval.get_shape_info().data[1].fe_degree + 1);
-
-    const auto        &shape_data = fe_eval.get_shape_info().data;
+    if constexpr (fe_degree != -1)
+      {
+        AssertDimension(n_q_points_1d,
+                        fe_eval.get_shape_info().data[0].n_q_points_1d);
+        AssertDimension(n_q_points_1d,
+                        fe_eval.get_shape_info().data[1].n_q_points_1d);
+        AssertDimension(fe_degree, fe_eval.get_shape_info().data[0].fe_degree);
+        AssertDimension(fe_degree,
+                        fe_eval.get_shape_info().data[1].fe_degree + 1);
+      }
+    else
+      AssertDimension(fe_eval.get_shape_info().data[0].fe_degree,
+                      fe_eval.get_shape_info().data[1].fe_degree + 1);
+
+    const auto &shape_data = fe_eval.get_shape_info().data;
+
+    // the loop bounds, either from the template arguments or at run time
+    const unsigned int degree =
+      fe_degree != -1 ? fe_degree : shape_data[0].fe_degree;
+    const unsigned int n_points_1d =
+      fe_degree != -1 ? n_q_points_1d : shape_data[0].n_q_points_1d;
     const unsigned int dofs_per_component =
-      Utilities::pow(fe_degree, dim - 1) * (fe_degree + 1);
-    const unsigned int n_points  = Utilities::pow(n_q_points_1d, dim);
+      Utilities::pow(degree, dim - 1) * (degree + 1);
+    const unsigned int n_points  = Utilities::pow(n_points_1d, dim);
     Number            *gradients = fe_eval.begin_gradients();
     Number            *values    = fe_eval.begin_values();
 
@@ -2098,7 +2119,9 @@ namespace internal
         }
       else if (element_type == ElementType::tensor_raviart_thomas)
         {
-          if constexpr (fe_degree > 0 && n_q_points_1d > 0 && dim > 1)
+          if constexpr (((fe_degree > 0 && n_q_points_1d > 0) ||
+                         fe_degree == -1) &&
+                        dim > 1)
             {
               FEEvaluationImpl<ElementType::tensor_raviart_thomas,
                                dim,
@@ -2114,8 +2137,8 @@ namespace internal
           else
             {
               Assert(false,
-                     ExcNotImplemented("Raviart-Thomas currently only possible "
-                                       "in 2d/3d and with templated degree"));
+                     ExcNotImplemented(
+                       "Raviart-Thomas is currently only possible in 2d/3d"));
             }
         }
       else
@@ -147,7 +147,11 @@ namespace internal
               {
                 case 3:
                   if (symmetric_evaluate &&
-                      use_collocation_evaluation(fe_degree, n_q_points_1d))
+                      (fe_degree > -1 ?
+                         use_collocation_evaluation(fe_degree, n_q_points_1d) :
+                         (data.has_collocation_gradients() &&
+                          use_collocation_evaluation(data.fe_degree,
+                                                     data.n_q_points_1d))))
                     {
                       eval0.template values<0, true, false>(values_dofs,
                                                             values_quad);
@@ -159,7 +163,11 @@ namespace internal
                                              n_q_points_1d,
                                              Number,
                                              Number2>
-                        eval_grad({}, data.shape_gradients_collocation_eo, {});
+                        eval_grad({},
+                                  data.shape_gradients_collocation_eo,
+                                  {},
+                                  data.n_q_points_1d,
+                                  data.n_q_points_1d);
                       eval_grad.template gradients<0, true, false, 3>(
                         values_quad, gradients_quad);
                       eval_grad.template gradients<1, true, false, 3>(
@@ -349,7 +357,11 @@ namespace internal
                   eval0.template values<0, false, false>(scratch_data,
                                                          values_dofs + n_dofs);
                   if (symmetric_evaluate &&
-                      use_collocation_evaluation(fe_degree, n_q_points_1d))
+                      (fe_degree > -1 ?
+                         use_collocation_evaluation(fe_degree, n_q_points_1d) :
+                         (data.has_collocation_gradients() &&
+                          use_collocation_evaluation(data.fe_degree,
+                                                     data.n_q_points_1d))))
                     {
                       EvaluatorTensorProduct<evaluate_evenodd,
                                              dim - 1,
@@ -357,7 +369,11 @@ namespace internal
                                              n_q_points_1d,
                                              Number,
                                              Number2>
-                        eval_grad({}, data.shape_gradients_collocation_eo, {});
+                        eval_grad({},
+                                  data.shape_gradients_collocation_eo,
+                                  {},
+                                  data.n_q_points_1d,
+                                  data.n_q_points_1d);
                       if ((integration_flag & EvaluationFlags::values) != 0u)
                         eval_grad.template gradients<1, false, true, 3>(
                           gradients_quad + 1, values_quad);
@@ -21,6 +21,7 @@
 
 #include <deal.II/matrix_free/evaluation_kernels_face.h>
 #include <deal.II/matrix_free/evaluation_template_factory.h>
+#include <deal.II/matrix_free/evaluation_template_factory_extension.h>
 #include <deal.II/matrix_free/evaluation_template_factory_internal.h>
 
 DEAL_II_NAMESPACE_OPEN
@@ -35,10 +36,30 @@ namespace internal
     const Number                          *values_dofs,
     FEEvaluationData<dim, Number, true>   &fe_eval)
   {
+    const unsigned int fe_degree = fe_eval.get_shape_info().data[0].fe_degree;
+    const unsigned int n_q_points_1d =
+      fe_eval.get_shape_info().data[0].n_q_points_1d;
+
+    // If the degree is beyond what the library has pre-compiled, give
+    // kernels registered by user code through
+    // MatrixFreeTools::register_fe_evaluation_kernels() a chance before
+    // falling back to the non-templated code path.
+    if (!instantiation_helper_run<1, FastEvaluationSupported>(fe_degree,
+                                                              n_q_points_1d) &&
+        run_registered_kernel(
+          &FEFaceEvaluationFactoryExtension<dim, Number>::evaluate,
+          fe_degree,
+          n_q_points_1d,
+          n_components,
+          evaluation_flag,
+          values_dofs,
+          fe_eval))
+      return;
+
     instantiation_helper_run<1,
                              FEFaceEvaluationImplEvaluateSelector<dim, Number>>(
-      fe_eval.get_shape_info().data[0].fe_degree,
-      fe_eval.get_shape_info().data[0].n_q_points_1d,
+      fe_degree,
+      n_q_points_1d,
       n_components,
       evaluation_flag,
       values_dofs,
@@ -55,14 +76,25 @@ namespace internal
     const Number                          *values_dofs,
     FEEvaluationData<dim, Number, true>   &fe_eval)
   {
+    const unsigned int fe_degree = fe_eval.get_shape_info().data[0].fe_degree;
+
+    if (fe_degree > FE_EVAL_FACTORY_DEGREE_MAX &&
+        run_registered_kernel_degree(
+          &FEFaceEvaluationFactoryExtension<dim, Number>::project_to_face,
+          fe_degree,
+          n_components,
+          evaluation_flag,
+          values_dofs,
+          fe_eval))
+      return;
+
     instantiation_helper_degree_run<
       1,
-      FEFaceEvaluationImplProjectToFaceSelector<dim, Number>>(
-      fe_eval.get_shape_info().data[0].fe_degree,
-      n_components,
-      evaluation_flag,
-      values_dofs,
-      fe_eval);
+      FEFaceEvaluationImplProjectToFaceSelector<dim, Number>>(fe_degree,
+                                                              n_components,
+                                                              evaluation_flag,
+                                                              values_dofs,
+                                                              fe_eval);
   }
 
 
@@ -74,14 +106,28 @@ namespace internal
     const EvaluationFlags::EvaluationFlags evaluation_flag,
     FEEvaluationData<dim, Number, true>   &fe_eval)
   {
+    const unsigned int fe_degree = fe_eval.get_shape_info().data[0].fe_degree;
+    const unsigned int n_q_points_1d =
+      fe_eval.get_shape_info().data[0].n_q_points_1d;
+
+    if (!instantiation_helper_run<1, FastEvaluationSupported>(fe_degree,
+                                                              n_q_points_1d) &&
+        run_registered_kernel(
+          &FEFaceEvaluationFactoryExtension<dim, Number>::evaluate_in_face,
+          fe_degree,
+          n_q_points_1d,
+          n_components,
+          evaluation_flag,
+          fe_eval))
+      return;
+
     instantiation_helper_run<
       1,
-      FEFaceEvaluationImplEvaluateInFaceSelector<dim, Number>>(
-      fe_eval.get_shape_info().data[0].fe_degree,
-      fe_eval.get_shape_info().data[0].n_q_points_1d,
-      n_components,
-      evaluation_flag,
-      fe_eval);
+      FEFaceEvaluationImplEvaluateInFaceSelector<dim, Number>>(fe_degree,
+                                                               n_q_points_1d,
+                                                               n_components,
+                                                               evaluation_flag,
+                                                               fe_eval);
   }
 
 
@@ -95,16 +141,32 @@ namespace internal
     FEEvaluationData<dim, Number, true>   &fe_eval,
     const bool                             sum_into_values)
   {
+    const unsigned int fe_degree = fe_eval.get_shape_info().data[0].fe_degree;
+    const unsigned int n_q_points_1d =
+      fe_eval.get_shape_info().data[0].n_q_points_1d;
+
+    if (!instantiation_helper_run<1, FastEvaluationSupported>(fe_degree,
+                                                              n_q_points_1d) &&
+        run_registered_kernel(
+          &FEFaceEvaluationFactoryExtension<dim, Number>::integrate,
+          fe_degree,
+          n_q_points_1d,
+          n_components,
+          integration_flag,
+          values_dofs,
+          fe_eval,
+          sum_into_values))
+      return;
+
     instantiation_helper_run<
       1,
-      FEFaceEvaluationImplIntegrateSelector<dim, Number>>(
-      fe_eval.get_shape_info().data[0].fe_degree,
-      fe_eval.get_shape_info().data[0].n_q_points_1d,
-      n_components,
-      integration_flag,
-      values_dofs,
-      fe_eval,
-      sum_into_values);
+      FEFaceEvaluationImplIntegrateSelector<dim, Number>>(fe_degree,
+                                                          n_q_points_1d,
+                                                          n_components,
+                                                          integration_flag,
+                                                          values_dofs,
+                                                          fe_eval,
+                                                          sum_into_values);
   }
 
 
@@ -118,14 +180,23 @@ namespace internal
     FEEvaluationData<dim, Number, true>   &fe_eval,
     const bool                             sum_into_values)
   {
+    const unsigned int fe_degree = fe_eval.get_shape_info().data[0].fe_degree;
+
+    if (fe_degree > FE_EVAL_FACTORY_DEGREE_MAX &&
+        run_registered_kernel_degree(
+          &FEFaceEvaluationFactoryExtension<dim, Number>::collect_from_face,
+          fe_degree,
+          n_components,
+          integration_flag,
+          values_dofs,
+          fe_eval,
+          sum_into_values))
+      return;
+
     instantiation_helper_degree_run<
       1,
       FEFaceEvaluationImplCollectFromFaceSelector<dim, Number>>(
-      fe_eval.get_shape_info().data[0].fe_degree,
-      n_components,
-      integration_flag,
-      values_dofs,
-      fe_eval,
+      fe_degree, n_components, integration_flag, values_dofs, fe_eval,
       sum_into_values);
   }
 
@@ -138,14 +209,25 @@ namespace internal
     const EvaluationFlags::EvaluationFlags integration_flag,
     FEEvaluationData<dim, Number, true>   &fe_eval)
   {
+    const unsigned int fe_degree = fe_eval.get_shape_info().data[0].fe_degree;
+    const unsigned int n_q_points_1d =
+      fe_eval.get_shape_info().data[0].n_q_points_1d;
+
+    if (!instantiation_helper_run<1, FastEvaluationSupported>(fe_degree,
+                                                              n_q_points_1d) &&
+        run_registered_kernel(
+          &FEFaceEvaluationFactoryExtension<dim, Number>::integrate_in_face,
+          fe_degree,
+          n_q_points_1d,
+          n_components,
+          integration_flag,
+          fe_eval))
+      return;
+
     instantiation_helper_run<
       1,
       FEFaceEvaluationImplIntegrateInFaceSelector<dim, Number>>(
-      fe_eval.get_shape_info().data[0].fe_degree,
-      fe_eval.get_shape_info().data[0].n_q_points_1d,
-      n_components,
-      integration_flag,
-      fe_eval);
+      fe_degree, n_q_points_1d, n_components, integration_flag, fe_eval);
   }
 
 
@@ -159,13 +241,33 @@ namespace internal
     const std::vector<ArrayView<const Number>>       *sm_ptr,
     FEEvaluationData<dim, VectorizedArrayType, true> &fe_eval)
   {
+    const unsigned int fe_degree = fe_eval.get_shape_info().data[0].fe_degree;
+    const unsigned int n_q_points_1d =
+      fe_eval.get_shape_info().data[0].n_q_points_1d;
+
+    if (!instantiation_helper_run<1, FastEvaluationSupported>(fe_degree,
+                                                              n_q_points_1d) &&
+        run_registered_kernel(
+          &FEFaceEvaluationGatherFactoryExtension<dim,
+                                                  Number,
+                                                  VectorizedArrayType>::
+            evaluate,
+          fe_degree,
+          n_q_points_1d,
+          n_components,
+          evaluation_flag,
+          src_ptr,
+          sm_ptr,
+          fe_eval))
+      return;
+
     instantiation_helper_run<
       1,
       FEFaceEvaluationImplGatherEvaluateSelector<dim,
                                                  Number,
                                                  VectorizedArrayType>>(
-      fe_eval.get_shape_info().data[0].fe_degree,
-      fe_eval.get_shape_info().data[0].n_q_points_1d,
+      fe_degree,
+      n_q_points_1d,
       n_components,
       evaluation_flag,
       src_ptr,
@@ -184,13 +286,33 @@ namespace internal
     const std::vector<ArrayView<const Number>>       *sm_ptr,
     FEEvaluationData<dim, VectorizedArrayType, true> &fe_eval)
   {
+    const unsigned int fe_degree = fe_eval.get_shape_info().data[0].fe_degree;
+    const unsigned int n_q_points_1d =
+      fe_eval.get_shape_info().data[0].n_q_points_1d;
+
+    if (!instantiation_helper_run<1, FastEvaluationSupported>(fe_degree,
+                                                              n_q_points_1d) &&
+        run_registered_kernel(
+          &FEFaceEvaluationGatherFactoryExtension<dim,
+                                                  Number,
+                                                  VectorizedArrayType>::
+            integrate,
+          fe_degree,
+          n_q_points_1d,
+          n_components,
+          integration_flag,
+          dst_ptr,
+          sm_ptr,
+          fe_eval))
+      return;
+
     instantiation_helper_run<
       1,
       FEFaceEvaluationImplIntegrateScatterSelector<dim,
                                                    Number,
                                                    VectorizedArrayType>>(
-      fe_eval.get_shape_info().data[0].fe_degree,
-      fe_eval.get_shape_info().data[0].n_q_points_1d,
+      fe_degree,
+      n_q_points_1d,
       n_components,
       integration_flag,
       dst_ptr,
@@ -210,8 +332,16 @@ namespace internal
     const unsigned int given_degree,
     const unsigned int n_q_points_1d)
   {
-    return instantiation_helper_run<1, FastEvaluationSupported>(given_degree,
-                                                                n_q_points_1d);
+    if (instantiation_helper_run<1, FastEvaluationSupported>(given_degree,
+                                                             n_q_points_1d))
+      return true;
+
+    for (const auto &extension :
+         FEFaceEvaluationFactoryExtension<dim, Number>::get_registry())
+      if (extension.fast_evaluation_supported(given_degree, n_q_points_1d))
+        return true;
+
+    return false;
   }
 } // end of namespace internal
 
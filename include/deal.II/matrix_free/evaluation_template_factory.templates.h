@@ -22,6 +22,7 @@
 #include <deal.II/matrix_free/evaluation_kernels.h>
 #include <deal.II/matrix_free/evaluation_selector.h>
 #include <deal.II/matrix_free/evaluation_template_factory.h>
+#include <deal.II/matrix_free/evaluation_template_factory_extension.h>
 #include <deal.II/matrix_free/evaluation_template_factory_internal.h>
 
 DEAL_II_NAMESPACE_OPEN
@@ -36,9 +37,29 @@ namespace internal
     const Number                          *values_dofs,
     FEEvaluationData<dim, Number, false>  &fe_eval)
   {
+    const unsigned int fe_degree = fe_eval.get_shape_info().data[0].fe_degree;
+    const unsigned int n_q_points_1d =
+      fe_eval.get_shape_info().data[0].n_q_points_1d;
+
+    // If the degree is beyond what the library has pre-compiled, give
+    // kernels registered by user code through
+    // MatrixFreeTools::register_fe_evaluation_kernels() a chance before
+    // falling back to the non-templated code path.
+    if (!instantiation_helper_run<1, FastEvaluationSupported>(fe_degree,
+                                                              n_q_points_1d) &&
+        run_registered_kernel(
+          &FEEvaluationFactoryExtension<dim, Number>::evaluate,
+          fe_degree,
+          n_q_points_1d,
+          n_components,
+          evaluation_flag,
+          values_dofs,
+          fe_eval))
+      return;
+
     instantiation_helper_run<1, FEEvaluationImplSelector<dim, Number, false>>(
-      fe_eval.get_shape_info().data[0].fe_degree,
-      fe_eval.get_shape_info().data[0].n_q_points_1d,
+      fe_degree,
+      n_q_points_1d,
       n_components,
       evaluation_flag,
       values_dofs,
@@ -56,9 +77,26 @@ namespace internal
     FEEvaluationData<dim, Number, false>  &fe_eval,
     const bool                             sum_into_values_array)
   {
+    const unsigned int fe_degree = fe_eval.get_shape_info().data[0].fe_degree;
+    const unsigned int n_q_points_1d =
+      fe_eval.get_shape_info().data[0].n_q_points_1d;
+
+    if (!instantiation_helper_run<1, FastEvaluationSupported>(fe_degree,
+                                                              n_q_points_1d) &&
+        run_registered_kernel(
+          &FEEvaluationFactoryExtension<dim, Number>::integrate,
+          fe_degree,
+          n_q_points_1d,
+          n_components,
+          integration_flag,
+          values_dofs,
+          fe_eval,
+          sum_into_values_array))
+      return;
+
     instantiation_helper_run<1, FEEvaluationImplSelector<dim, Number, true>>(
-      fe_eval.get_shape_info().data[0].fe_degree,
-      fe_eval.get_shape_info().data[0].n_q_points_1d,
+      fe_degree,
+      n_q_points_1d,
       n_components,
       integration_flag,
       values_dofs,
@@ -78,8 +116,16 @@ namespace internal
     const unsigned int given_degree,
     const unsigned int n_q_points_1d)
   {
-    return instantiation_helper_run<1, FastEvaluationSupported>(given_degree,
-                                                                n_q_points_1d);
+    if (instantiation_helper_run<1, FastEvaluationSupported>(given_degree,
+                                                             n_q_points_1d))
+      return true;
+
+    for (const auto &extension :
+         FEEvaluationFactoryExtension<dim, Number>::get_registry())
+      if (extension.fast_evaluation_supported(given_degree, n_q_points_1d))
+        return true;
+
+    return false;
   }
 
 
@@ -0,0 +1,310 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_evaluation_template_factory_extension_h
+#define dealii_matrix_free_evaluation_template_factory_extension_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/evaluation_template_factory.h>
+
+#include <utility>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  /**
+   * An entry in the registry of user-compiled cell-evaluation kernels that
+   * extend the set of polynomial degrees for which FEEvaluation with a
+   * run-time polynomial degree reaches the templated fast path. The library
+   * pre-compiles the tensor-product kernels for degrees up to
+   * `FE_EVAL_FACTORY_DEGREE_MAX`; kernels for higher degrees can be compiled
+   * into the application and registered through
+   * MatrixFreeTools::register_fe_evaluation_kernels(), after which
+   * FEEvaluationFactory consults this registry before falling back to the
+   * non-templated code path.
+   */
+  template <int dim, typename Number>
+  struct FEEvaluationFactoryExtension
+  {
+    void (*evaluate)(const unsigned int                     n_components,
+                     const EvaluationFlags::EvaluationFlags evaluation_flag,
+                     const Number                          *values_dofs,
+                     FEEvaluationData<dim, Number, false>  &fe_eval);
+
+    void (*integrate)(const unsigned int                     n_components,
+                      const EvaluationFlags::EvaluationFlags integration_flag,
+                      Number                                *values_dofs,
+                      FEEvaluationData<dim, Number, false>  &fe_eval,
+                      const bool sum_into_values_array);
+
+    bool (*fast_evaluation_supported)(const unsigned int given_degree,
+                                      const unsigned int n_q_points_1d);
+
+    /**
+     * Return the global registry of this extension type. The registry is
+     * implemented as a function-local static variable so that the library
+     * and kernels compiled into user code share a single instance.
+     */
+    static std::vector<FEEvaluationFactoryExtension> &
+    get_registry()
+    {
+      static std::vector<FEEvaluationFactoryExtension> registry;
+      return registry;
+    }
+  };
+
+
+
+  /**
+   * The analogue of FEEvaluationFactoryExtension for the face-evaluation
+   * kernels dispatched through FEFaceEvaluationFactory.
+   */
+  template <int dim, typename Number>
+  struct FEFaceEvaluationFactoryExtension
+  {
+    /**
+     * The maximal polynomial degree covered by the registered kernels, used
+     * for the code paths that dispatch on the degree only.
+     */
+    unsigned int max_degree;
+
+    void (*evaluate)(const unsigned int                     n_components,
+                     const EvaluationFlags::EvaluationFlags evaluation_flag,
+                     const Number                          *values_dofs,
+                     FEEvaluationData<dim, Number, true>   &fe_eval);
+
+    void (*project_to_face)(
+      const unsigned int                     n_components,
+      const EvaluationFlags::EvaluationFlags evaluation_flag,
+      const Number                          *values_dofs,
+      FEEvaluationData<dim, Number, true>   &fe_eval);
+
+    void (*evaluate_in_face)(
+      const unsigned int                     n_components,
+      const EvaluationFlags::EvaluationFlags evaluation_flag,
+      FEEvaluationData<dim, Number, true>   &fe_eval);
+
+    void (*integrate)(const unsigned int                     n_components,
+                      const EvaluationFlags::EvaluationFlags integration_flag,
+                      Number                                *values_dofs,
+                      FEEvaluationData<dim, Number, true>   &fe_eval,
+                      const bool                             sum_into_values);
+
+    void (*collect_from_face)(
+      const unsigned int                     n_components,
+      const EvaluationFlags::EvaluationFlags integration_flag,
+      Number                                *values_dofs,
+      FEEvaluationData<dim, Number, true>   &fe_eval,
+      const bool                             sum_into_values);
+
+    void (*integrate_in_face)(
+      const unsigned int                     n_components,
+      const EvaluationFlags::EvaluationFlags integration_flag,
+      FEEvaluationData<dim, Number, true>   &fe_eval);
+
+    bool (*fast_evaluation_supported)(const unsigned int given_degree,
+                                      const unsigned int n_q_points_1d);
+
+    static std::vector<FEFaceEvaluationFactoryExtension> &
+    get_registry()
+    {
+      static std::vector<FEFaceEvaluationFactoryExtension> registry;
+      return registry;
+    }
+  };
+
+
+
+  /**
+   * The analogue of FEEvaluationFactoryExtension for the combined
+   * gather/evaluate and integrate/scatter kernels dispatched through
+   * FEFaceEvaluationGatherFactory.
+   */
+  template <int dim, typename Number, typename VectorizedArrayType>
+  struct FEFaceEvaluationGatherFactoryExtension
+  {
+    void (*evaluate)(const unsigned int                     n_components,
+                     const EvaluationFlags::EvaluationFlags evaluation_flag,
+                     const Number                          *src_ptr,
+                     const std::vector<ArrayView<const Number>>       *sm_ptr,
+                     FEEvaluationData<dim, VectorizedArrayType, true> &fe_eval);
+
+    void (*integrate)(const unsigned int                     n_components,
+                      const EvaluationFlags::EvaluationFlags integration_flag,
+                      Number                                *dst_ptr,
+                      const std::vector<ArrayView<const Number>>       *sm_ptr,
+                      FEEvaluationData<dim, VectorizedArrayType, true> &fe_eval);
+
+    bool (*fast_evaluation_supported)(const unsigned int given_degree,
+                                      const unsigned int n_q_points_1d);
+
+    static std::vector<FEFaceEvaluationGatherFactoryExtension> &
+    get_registry()
+    {
+      static std::vector<FEFaceEvaluationGatherFactoryExtension> registry;
+      return registry;
+    }
+  };
+
+
+
+  /**
+   * Scan the registry of the given extension type for an entry whose
+   * pre-compiled kernels cover the given degree and number of quadrature
+   * points, call the kernel identified by the given pointer to member on the
+   * remaining arguments, and return whether such an entry was found.
+   */
+  template <typename ExtensionType,
+            typename FunctionPointerType,
+            typename... Args>
+  bool
+  run_registered_kernel(FunctionPointerType ExtensionType::*function,
+                        const unsigned int                  given_degree,
+                        const unsigned int                  n_q_points_1d,
+                        Args &...args)
+  {
+    for (const ExtensionType &extension : ExtensionType::get_registry())
+      if (extension.fast_evaluation_supported(given_degree, n_q_points_1d))
+        {
+          (extension.*function)(args...);
+          return true;
+        }
+    return false;
+  }
+
+
+
+  /**
+   * Same as run_registered_kernel(), but for the kernels that dispatch on
+   * the polynomial degree only.
+   */
+  template <typename ExtensionType,
+            typename FunctionPointerType,
+            typename... Args>
+  bool
+  run_registered_kernel_degree(FunctionPointerType ExtensionType::*function,
+                               const unsigned int given_degree,
+                               Args &...args)
+  {
+    for (const ExtensionType &extension : ExtensionType::get_registry())
+      if (given_degree <= extension.max_degree)
+        {
+          (extension.*function)(args...);
+          return true;
+        }
+    return false;
+  }
+
+} // end of namespace internal
+
+
+
+namespace MatrixFreeTools
+{
+  /**
+   * Compile the templated tensor-product evaluation kernels used by
+   * FEEvaluation and FEFaceEvaluation with a run-time polynomial degree for
+   * all degrees up to @p max_degree into the calling translation unit and
+   * register them with the dispatch of the deal.II library. This extends the
+   * set of degrees reaching the templated fast path beyond the limit
+   * `FE_EVAL_FACTORY_DEGREE_MAX` the library was compiled with, without
+   * recompiling deal.II and without relying on the linker to resolve
+   * duplicate symbols in a particular order.
+   *
+   * The definition of this function template lives in
+   * `deal.II/matrix_free/evaluation_template_factory_extension.templates.h`,
+   * which needs to be included in the (typically single) translation unit of
+   * the application that instantiates it. Compiling that translation unit
+   * takes noticeably longer than ordinary client code, which is the reason
+   * the kernels are not part of the library for all degrees to begin with. A
+   * typical use for a simulation with polynomial degrees up to eleven in 3d
+   * looks as follows:
+   * @code
+   * #include <deal.II/matrix_free/evaluation_template_factory_extension.templates.h>
+   *
+   * void setup_high_degree_kernels()
+   * {
+   *   MatrixFreeTools::register_fe_evaluation_kernels<3,
+   *                                                   VectorizedArray<double>,
+   *                                                   11>();
+   * }
+   * @endcode
+   * The function must be called before the first cell or face evaluation,
+   * e.g. at the beginning of `main()`, and must not be called concurrently
+   * with evaluations running on other threads. Calling it multiple times
+   * with the same template arguments registers the kernels only once.
+   *
+   * The @p Number template argument is the vectorized value type the
+   * MatrixFree object is set up with, i.e., the default
+   * VectorizedArray<double> or VectorizedArray<float> for the usual
+   * configurations. Whether a given degree and quadrature formula actually
+   * reaches the fast path can be checked through
+   * FEEvaluation::fast_evaluation_supported() or enumerated with
+   * fast_evaluation_supported_pairs().
+   */
+  template <int dim, typename Number, int max_degree>
+  void
+  register_fe_evaluation_kernels();
+
+  /**
+   * Return the list of all pairs of polynomial degree and number of 1d
+   * quadrature points up to the given maximal degree for which FEEvaluation
+   * and FEFaceEvaluation objects with a run-time polynomial degree reach the
+   * templated fast path, taking both the kernels pre-compiled into the
+   * library and the kernels registered through
+   * register_fe_evaluation_kernels() into account. This is useful for
+   * verifying at run time that a performance-critical setup does not
+   * silently fall back to the non-templated evaluation path.
+   */
+  template <int dim, typename Number>
+  std::vector<std::pair<unsigned int, unsigned int>>
+  fast_evaluation_supported_pairs(const unsigned int max_degree);
+} // namespace MatrixFreeTools
+
+
+
+#ifndef DOXYGEN
+
+namespace MatrixFreeTools
+{
+  template <int dim, typename Number>
+  std::vector<std::pair<unsigned int, unsigned int>>
+  fast_evaluation_supported_pairs(const unsigned int max_degree)
+  {
+    std::vector<std::pair<unsigned int, unsigned int>> result;
+    for (unsigned int degree = 1; degree <= max_degree; ++degree)
+      for (unsigned int n_q_points_1d = 1; n_q_points_1d <= 2 * degree + 2;
+           ++n_q_points_1d)
+        if (internal::FEEvaluationFactory<dim, Number>::
+              fast_evaluation_supported(degree, n_q_points_1d))
+          result.emplace_back(degree, n_q_points_1d);
+    return result;
+  }
+} // namespace MatrixFreeTools
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
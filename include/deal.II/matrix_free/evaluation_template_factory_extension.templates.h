@@ -0,0 +1,368 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_evaluation_template_factory_extension_templates_h
+#define dealii_matrix_free_evaluation_template_factory_extension_templates_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/matrix_free/evaluation_kernels.h>
+#include <deal.II/matrix_free/evaluation_kernels_face.h>
+#include <deal.II/matrix_free/evaluation_selector.h>
+#include <deal.II/matrix_free/evaluation_template_factory_extension.h>
+#include <deal.II/matrix_free/evaluation_template_factory_internal.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace internal
+{
+  /**
+   * Implementation of the kernels registered by
+   * MatrixFreeTools::register_fe_evaluation_kernels(). The functions mirror
+   * the ones of FEEvaluationFactory, except that the maximal pre-compiled
+   * polynomial degree is a template argument rather than the value of
+   * `FE_EVAL_FACTORY_DEGREE_MAX` the library was compiled with, so the
+   * instantiations compiled into user code are distinct symbols from the
+   * ones inside the library.
+   */
+  template <int dim, typename Number, int max_degree>
+  struct FEEvaluationFactoryExtensionImplementation
+  {
+    static void
+    evaluate(const unsigned int                     n_components,
+             const EvaluationFlags::EvaluationFlags evaluation_flag,
+             const Number                          *values_dofs,
+             FEEvaluationData<dim, Number, false>  &fe_eval)
+    {
+      instantiation_helper_run<1,
+                               FEEvaluationImplSelector<dim, Number, false>,
+                               max_degree>(
+        fe_eval.get_shape_info().data[0].fe_degree,
+        fe_eval.get_shape_info().data[0].n_q_points_1d,
+        n_components,
+        evaluation_flag,
+        values_dofs,
+        fe_eval);
+    }
+
+    static void
+    integrate(const unsigned int                     n_components,
+              const EvaluationFlags::EvaluationFlags integration_flag,
+              Number                                *values_dofs,
+              FEEvaluationData<dim, Number, false>  &fe_eval,
+              const bool                             sum_into_values_array)
+    {
+      instantiation_helper_run<1,
+                               FEEvaluationImplSelector<dim, Number, true>,
+                               max_degree>(
+        fe_eval.get_shape_info().data[0].fe_degree,
+        fe_eval.get_shape_info().data[0].n_q_points_1d,
+        n_components,
+        integration_flag,
+        values_dofs,
+        fe_eval,
+        sum_into_values_array);
+    }
+
+    static bool
+    fast_evaluation_supported(const unsigned int given_degree,
+                              const unsigned int n_q_points_1d)
+    {
+      return instantiation_helper_run<1, FastEvaluationSupported, max_degree>(
+        given_degree, n_q_points_1d);
+    }
+  };
+
+
+
+  /**
+   * The analogue of FEEvaluationFactoryExtensionImplementation for the
+   * kernels of FEFaceEvaluationFactory.
+   */
+  template <int dim, typename Number, int max_degree>
+  struct FEFaceEvaluationFactoryExtensionImplementation
+  {
+    static void
+    evaluate(const unsigned int                     n_components,
+             const EvaluationFlags::EvaluationFlags evaluation_flag,
+             const Number                          *values_dofs,
+             FEEvaluationData<dim, Number, true>   &fe_eval)
+    {
+      instantiation_helper_run<
+        1,
+        FEFaceEvaluationImplEvaluateSelector<dim, Number>,
+        max_degree>(fe_eval.get_shape_info().data[0].fe_degree,
+                    fe_eval.get_shape_info().data[0].n_q_points_1d,
+                    n_components,
+                    evaluation_flag,
+                    values_dofs,
+                    fe_eval);
+    }
+
+    static void
+    project_to_face(const unsigned int                     n_components,
+                    const EvaluationFlags::EvaluationFlags evaluation_flag,
+                    const Number                          *values_dofs,
+                    FEEvaluationData<dim, Number, true>   &fe_eval)
+    {
+      instantiation_helper_degree_run<
+        1,
+        FEFaceEvaluationImplProjectToFaceSelector<dim, Number>,
+        max_degree>(fe_eval.get_shape_info().data[0].fe_degree,
+                    n_components,
+                    evaluation_flag,
+                    values_dofs,
+                    fe_eval);
+    }
+
+    static void
+    evaluate_in_face(const unsigned int                     n_components,
+                     const EvaluationFlags::EvaluationFlags evaluation_flag,
+                     FEEvaluationData<dim, Number, true>   &fe_eval)
+    {
+      instantiation_helper_run<
+        1,
+        FEFaceEvaluationImplEvaluateInFaceSelector<dim, Number>,
+        max_degree>(fe_eval.get_shape_info().data[0].fe_degree,
+                    fe_eval.get_shape_info().data[0].n_q_points_1d,
+                    n_components,
+                    evaluation_flag,
+                    fe_eval);
+    }
+
+    static void
+    integrate(const unsigned int                     n_components,
+              const EvaluationFlags::EvaluationFlags integration_flag,
+              Number                                *values_dofs,
+              FEEvaluationData<dim, Number, true>   &fe_eval,
+              const bool                             sum_into_values)
+    {
+      instantiation_helper_run<
+        1,
+        FEFaceEvaluationImplIntegrateSelector<dim, Number>,
+        max_degree>(fe_eval.get_shape_info().data[0].fe_degree,
+                    fe_eval.get_shape_info().data[0].n_q_points_1d,
+                    n_components,
+                    integration_flag,
+                    values_dofs,
+                    fe_eval,
+                    sum_into_values);
+    }
+
+    static void
+    collect_from_face(const unsigned int                     n_components,
+                      const EvaluationFlags::EvaluationFlags integration_flag,
+                      Number                                *values_dofs,
+                      FEEvaluationData<dim, Number, true>   &fe_eval,
+                      const bool                             sum_into_values)
+    {
+      instantiation_helper_degree_run<
+        1,
+        FEFaceEvaluationImplCollectFromFaceSelector<dim, Number>,
+        max_degree>(fe_eval.get_shape_info().data[0].fe_degree,
+                    n_components,
+                    integration_flag,
+                    values_dofs,
+                    fe_eval,
+                    sum_into_values);
+    }
+
+    static void
+    integrate_in_face(const unsigned int                     n_components,
+                      const EvaluationFlags::EvaluationFlags integration_flag,
+                      FEEvaluationData<dim, Number, true>   &fe_eval)
+    {
+      instantiation_helper_run<
+        1,
+        FEFaceEvaluationImplIntegrateInFaceSelector<dim, Number>,
+        max_degree>(fe_eval.get_shape_info().data[0].fe_degree,
+                    fe_eval.get_shape_info().data[0].n_q_points_1d,
+                    n_components,
+                    integration_flag,
+                    fe_eval);
+    }
+
+    static bool
+    fast_evaluation_supported(const unsigned int given_degree,
+                              const unsigned int n_q_points_1d)
+    {
+      return instantiation_helper_run<1, FastEvaluationSupported, max_degree>(
+        given_degree, n_q_points_1d);
+    }
+  };
+
+
+
+  /**
+   * The analogue of FEEvaluationFactoryExtensionImplementation for the
+   * kernels of FEFaceEvaluationGatherFactory.
+   */
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            int max_degree>
+  struct FEFaceEvaluationGatherFactoryExtensionImplementation
+  {
+    static void
+    evaluate(const unsigned int                                n_components,
+             const EvaluationFlags::EvaluationFlags            evaluation_flag,
+             const Number                                     *src_ptr,
+             const std::vector<ArrayView<const Number>>       *sm_ptr,
+             FEEvaluationData<dim, VectorizedArrayType, true> &fe_eval)
+    {
+      instantiation_helper_run<
+        1,
+        FEFaceEvaluationImplGatherEvaluateSelector<dim,
+                                                   Number,
+                                                   VectorizedArrayType>,
+        max_degree>(fe_eval.get_shape_info().data[0].fe_degree,
+                    fe_eval.get_shape_info().data[0].n_q_points_1d,
+                    n_components,
+                    evaluation_flag,
+                    src_ptr,
+                    sm_ptr,
+                    fe_eval);
+    }
+
+    static void
+    integrate(const unsigned int                                n_components,
+              const EvaluationFlags::EvaluationFlags            integration_flag,
+              Number                                           *dst_ptr,
+              const std::vector<ArrayView<const Number>>       *sm_ptr,
+              FEEvaluationData<dim, VectorizedArrayType, true> &fe_eval)
+    {
+      instantiation_helper_run<
+        1,
+        FEFaceEvaluationImplIntegrateScatterSelector<dim,
+                                                     Number,
+                                                     VectorizedArrayType>,
+        max_degree>(fe_eval.get_shape_info().data[0].fe_degree,
+                    fe_eval.get_shape_info().data[0].n_q_points_1d,
+                    n_components,
+                    integration_flag,
+                    dst_ptr,
+                    sm_ptr,
+                    fe_eval);
+    }
+
+    static bool
+    fast_evaluation_supported(const unsigned int given_degree,
+                              const unsigned int n_q_points_1d)
+    {
+      return instantiation_helper_run<1, FastEvaluationSupported, max_degree>(
+        given_degree, n_q_points_1d);
+    }
+  };
+
+
+
+  /**
+   * Append the given entry to the given registry unless an entry with the
+   * same kernels has been registered before.
+   */
+  template <typename ExtensionType>
+  void
+  register_factory_extension(std::vector<ExtensionType> &registry,
+                             const ExtensionType        &entry)
+  {
+    for (const ExtensionType &existing : registry)
+      if (existing.evaluate == entry.evaluate)
+        return;
+    registry.push_back(entry);
+  }
+
+} // end of namespace internal
+
+
+
+namespace MatrixFreeTools
+{
+  template <int dim, typename Number, int max_degree>
+  void
+  register_fe_evaluation_kernels()
+  {
+    static_assert(max_degree > 0,
+                  "The maximal degree must be a positive integer");
+
+    {
+      using Implementation = internal::
+        FEEvaluationFactoryExtensionImplementation<dim, Number, max_degree>;
+      internal::register_factory_extension(
+        internal::FEEvaluationFactoryExtension<dim, Number>::get_registry(),
+        internal::FEEvaluationFactoryExtension<dim, Number>{
+          &Implementation::evaluate,
+          &Implementation::integrate,
+          &Implementation::fast_evaluation_supported});
+    }
+
+    {
+      using Implementation = internal::
+        FEFaceEvaluationFactoryExtensionImplementation<dim, Number, max_degree>;
+      internal::register_factory_extension(
+        internal::FEFaceEvaluationFactoryExtension<dim,
+                                                   Number>::get_registry(),
+        internal::FEFaceEvaluationFactoryExtension<dim, Number>{
+          max_degree,
+          &Implementation::evaluate,
+          &Implementation::project_to_face,
+          &Implementation::evaluate_in_face,
+          &Implementation::integrate,
+          &Implementation::collect_from_face,
+          &Implementation::integrate_in_face,
+          &Implementation::fast_evaluation_supported});
+    }
+
+    // The gather/scatter kernels combine the vectorized evaluation with
+    // reading from and writing into vectors of either precision, so both
+    // scalar number types need to be registered, mirroring the
+    // instantiations inside the library.
+    {
+      using Implementation =
+        internal::FEFaceEvaluationGatherFactoryExtensionImplementation<
+          dim,
+          double,
+          Number,
+          max_degree>;
+      internal::register_factory_extension(
+        internal::FEFaceEvaluationGatherFactoryExtension<dim, double, Number>::
+          get_registry(),
+        internal::FEFaceEvaluationGatherFactoryExtension<dim, double, Number>{
+          &Implementation::evaluate,
+          &Implementation::integrate,
+          &Implementation::fast_evaluation_supported});
+    }
+
+    {
+      using Implementation =
+        internal::FEFaceEvaluationGatherFactoryExtensionImplementation<
+          dim,
+          float,
+          Number,
+          max_degree>;
+      internal::register_factory_extension(
+        internal::FEFaceEvaluationGatherFactoryExtension<dim, float, Number>::
+          get_registry(),
+        internal::FEFaceEvaluationGatherFactoryExtension<dim, float, Number>{
+          &Implementation::evaluate,
+          &Implementation::integrate,
+          &Implementation::fast_evaluation_supported});
+    }
+  }
+} // namespace MatrixFreeTools
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
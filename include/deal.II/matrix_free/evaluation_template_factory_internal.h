@@ -42,7 +42,15 @@ namespace internal
     }
   };
 
-  template <int degree, typename EvaluatorType, typename... Args>
+  // The maximal polynomial degree for which templated code paths get
+  // pre-compiled is passed as a template argument so that kernels compiled
+  // into user code with a higher limit (see
+  // MatrixFreeTools::register_fe_evaluation_kernels()) get distinct symbols
+  // and do not clash with the instantiations inside the deal.II library.
+  template <int degree,
+            typename EvaluatorType,
+            int max_degree = FE_EVAL_FACTORY_DEGREE_MAX,
+            typename... Args>
   bool
   instantiation_helper_run(const unsigned int given_degree,
                            const unsigned int n_q_points_1d,
@@ -65,16 +73,22 @@ namespace internal
           // slow path
           return EvaluatorType::template run<-1, 0>(args...);
       }
-    else if (degree < FE_EVAL_FACTORY_DEGREE_MAX)
-      return instantiation_helper_run<
-        (degree < FE_EVAL_FACTORY_DEGREE_MAX ? degree + 1 : degree),
-        EvaluatorType>(given_degree, n_q_points_1d, args...);
+    else if (degree < max_degree)
+      return instantiation_helper_run<(degree < max_degree ? degree + 1 :
+                                                             degree),
+                                      EvaluatorType,
+                                      max_degree>(given_degree,
+                                                  n_q_points_1d,
+                                                  args...);
     else
       // slow path
       return EvaluatorType::template run<-1, 0>(args...);
   }
 
-  template <int degree, typename EvaluatorType, typename... Args>
+  template <int degree,
+            typename EvaluatorType,
+            int max_degree = FE_EVAL_FACTORY_DEGREE_MAX,
+            typename... Args>
   bool
   instantiation_helper_degree_run(const unsigned int given_degree,
                                   Args &...args)
@@ -83,10 +97,13 @@ namespace internal
       {
         return EvaluatorType::template run<degree>(args...);
       }
-    else if (degree < FE_EVAL_FACTORY_DEGREE_MAX)
-      return instantiation_helper_degree_run<
-        (degree < FE_EVAL_FACTORY_DEGREE_MAX ? degree + 1 : degree),
-        EvaluatorType>(given_degree, args...);
+    else if (degree < max_degree)
+      return instantiation_helper_degree_run<(degree < max_degree ?
+                                                degree + 1 :
+                                                degree),
+                                             EvaluatorType,
+                                             max_degree>(given_degree,
+                                                         args...);
     else
       // slow path
       return EvaluatorType::template run<-1>(args...);
@@ -1099,7 +1099,12 @@ namespace internal
      * This comparator is used within collect_faces_vectorization() to create
      * a sorting of FaceToCellTopology objects based on their
      * identifiers. This is used to obtain a good data locality when
-     * processing the face integrals.
+     * processing the face integrals. Faces against neighbors on the same
+     * refinement level are sorted before faces with a 2:1 subdivision, so
+     * that the regular faces, which take the fast evaluation path without
+     * subface interpolation, are processed in one contiguous stretch of each
+     * partition and the batches needing the same subface interpolation
+     * matrices end up adjacent to each other.
      */
     template <int length>
     struct FaceComparator
@@ -1118,6 +1123,15 @@ namespace internal
         else if (face1.face_type > face2.face_type)
           return false;
 
+        // sort regular faces (whose subface index is the sentinel value
+        // GeometryInfo<dim>::max_children_per_cell and thus the largest
+        // possible value) before faces with hanging nodes, and group faces
+        // with the same subface index together
+        if (face1.subface_index > face2.subface_index)
+          return true;
+        else if (face1.subface_index < face2.subface_index)
+          return false;
+
         // check if active FE indices match
         if (active_fe_indices.size() > 0)
           {
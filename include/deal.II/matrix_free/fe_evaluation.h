@@ -1145,18 +1145,20 @@ using FEEvaluationAccess DEAL_II_DEPRECATED =
  * setting the macro `FE_EVAL_FACTORY_DEGREE_MAX` to the desired integer and
  * instantiating the classes FEEvaluationFactory and FEFaceEvaluationFactory
  * (the latter for FEFaceEvaluation) creates paths to templated functions for
- * a possibly larger set of degrees. This can both be set when configuring
- * deal.II by passing the flag `-D FE_EVAL_FACTORY_DEGREE_MAX=8` (in case you
- * want to compile all degrees up to eight; recommended setting) or by
- * compiling `evaluation_template_factory.templates.h` and
- * `evaluation_template_face_factory.templates.h` with the
- * `FE_EVAL_FACTORY_DEGREE_MAX` overridden to the desired value. In the second
- * option, symbols will be available twice, and it depends on your linker and
- * dynamic library loader whether the user-specified setting takes precedence;
- * use `LD_PRELOAD` to select the desired library. You can check if fast
+ * a possibly larger set of degrees. This can be set when configuring deal.II
+ * by passing the flag `-D FE_EVAL_FACTORY_DEGREE_MAX=8` (in case you want to
+ * compile all degrees up to eight; recommended setting). Alternatively, the
+ * kernels for higher degrees can be compiled into the application itself and
+ * registered with the dispatch of the library at run time by calling
+ * MatrixFreeTools::register_fe_evaluation_kernels() from a translation unit
+ * that includes
+ * `deal.II/matrix_free/evaluation_template_factory_extension.templates.h`,
+ * which avoids recompiling deal.II. You can check if fast
  * evaluation/integration for a given degree/n_quadrature_points pair by
  * calling FEEvaluation::fast_evaluation_supported() or
- * FEFaceEvaluation::fast_evaluation_supported().
+ * FEFaceEvaluation::fast_evaluation_supported(), and enumerate all pairs
+ * reaching the fast path with
+ * MatrixFreeTools::fast_evaluation_supported_pairs().
  *
  * <h3>Handling multi-component systems</h3>
  *
@@ -1970,7 +1972,12 @@ public:
   /**
    * Constructor. Takes all data stored in MatrixFree for a given face range,
    * which allows to automatically identify the active_fe_index and
-   * active_quad_index in case of a p-adaptive strategy.
+   * active_quad_index in case of a p-adaptive strategy. On interior faces
+   * between cells of different polynomial degree, both the interior and the
+   * exterior evaluator are set up with the quadrature formula of the
+   * interior side's active FE index, the formula the face geometry data is
+   * stored with, so that the interface terms of a DG discretization are
+   * integrated consistently on both sides.
    *
    * The rest of the arguments are the same as in the constructor above.
    */
@@ -5895,7 +5902,8 @@ inline FEEvaluation<dim,
                  dof_no,
                  quad_no,
                  first_selected_component,
-                 matrix_free.get_cell_active_fe_index(range))
+                 matrix_free.get_cell_active_fe_index(range),
+                 matrix_free.get_cell_active_quad_index(range, quad_no))
 {}
 
 
@@ -7051,7 +7059,7 @@ inline FEFaceEvaluation<dim,
                      first_selected_component,
                      matrix_free.get_face_active_fe_index(range,
                                                           is_interior_face),
-                     numbers::invalid_unsigned_int,
+                     matrix_free.get_face_active_quad_index(range, quad_no),
                      matrix_free.get_face_info(range.first).face_type)
 {}
 
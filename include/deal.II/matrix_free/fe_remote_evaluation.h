@@ -324,7 +324,9 @@ public:
 
 
   /**
-   * Fill the fields stored in PrecomputedEvaluationData.
+   * Fill the fields stored in PrecomputedEvaluationData. If both values and
+   * gradients are requested, they are exchanged within a single
+   * communication step via VectorTools::point_values_and_gradients().
    */
   template <int n_components,
             typename PrecomputedEvaluationDataType,
@@ -878,7 +880,43 @@ FERemoteEvaluationCommunicator<dim>::update_ghost_values(
 
   for (const auto &communication_object : communication_objects)
     {
-      if (eval_flags & EvaluationFlags::values)
+      if ((eval_flags & EvaluationFlags::values) &&
+          (eval_flags & EvaluationFlags::gradients))
+        {
+          // If both values and gradients are requested, fuse them into a
+          // single communication step: both quantities are interpolated in
+          // one sweep over the cells and exchanged within one message per
+          // pair of processes instead of two.
+          std::visit(
+            [&](const auto &obj) {
+              const auto fused_data =
+                VectorTools::point_values_and_gradients<n_components>(
+                  *obj.rpe, mesh, src, vec_flags, first_selected_component);
+
+              std::vector<typename std::decay_t<
+                decltype(fused_data)>::value_type::first_type>
+                values(fused_data.size());
+              std::vector<typename std::decay_t<
+                decltype(fused_data)>::value_type::second_type>
+                gradients(fused_data.size());
+
+              for (unsigned int i = 0; i < fused_data.size(); ++i)
+                {
+                  values[i]    = fused_data[i].first;
+                  gradients[i] = fused_data[i].second;
+                }
+
+              CopyInstructions::copy_data(
+                view, dst.values, values, obj.get_communication_object_pntrs());
+              CopyInstructions::copy_data(
+                view,
+                dst.gradients,
+                gradients,
+                obj.get_communication_object_pntrs());
+            },
+            communication_object);
+        }
+      else if (eval_flags & EvaluationFlags::values)
         {
           std::visit(
             [&](const auto &obj) {
@@ -891,8 +929,7 @@ FERemoteEvaluationCommunicator<dim>::update_ghost_values(
             },
             communication_object);
         }
-
-      if (eval_flags & EvaluationFlags::gradients)
+      else if (eval_flags & EvaluationFlags::gradients)
         {
           std::visit(
             [&](const auto &obj) {
@@ -671,9 +671,8 @@ namespace internal
               // fill this data in
               const unsigned int fe_index =
                 active_fe_index.size() > 0 ? active_fe_index[cell] : 0;
-              const unsigned int hp_quad_index =
-                mapping_info.cell_data[my_q].descriptor.size() == 1 ? 0 :
-                                                                      fe_index;
+              const unsigned int hp_quad_index = std::min<unsigned int>(
+                fe_index, mapping_info.cell_data[my_q].descriptor.size() - 1);
               const unsigned int hp_mapping_index =
                 mapping.size() == 1 ? 0 : fe_index;
               const unsigned int n_q_points = mapping_info.cell_data[my_q]
@@ -1643,9 +1642,8 @@ namespace internal
                   active_fe_index[faces[face].cells_interior[0] /
                                   VectorizedArrayType::size()] :
                   0;
-              const unsigned int hp_quad_index =
-                mapping_info.cell_data[my_q].descriptor.size() == 1 ? 0 :
-                                                                      fe_index;
+              const unsigned int hp_quad_index = std::min<unsigned int>(
+                fe_index, mapping_info.cell_data[my_q].descriptor.size() - 1);
               const unsigned int hp_mapping_index =
                 mapping_in.size() == 1 ? 0 : fe_index;
 
@@ -1831,10 +1829,10 @@ namespace internal
                                               VectorizedArrayType::size()] :
                               0;
                           const unsigned int hp_quad_index =
-                            mapping_info.cell_data[my_q].descriptor.size() ==
-                                1 ?
-                              0 :
-                              fe_index;
+                            std::min<unsigned int>(
+                              fe_index,
+                              mapping_info.cell_data[my_q].descriptor.size() -
+                                1);
                           const unsigned int hp_mapping_index =
                             mapping_in.size() == 1 ? 0 : fe_index;
 
@@ -3113,200 +3111,213 @@ namespace internal
       FE_Nothing<dim> dummy_fe;
       // currently no hp-indices implemented
       const unsigned int fe_index = 0;
-      std::vector<std::vector<std::shared_ptr<dealii::FEFaceValues<dim>>>>
-        fe_face_values(face_data_by_cells.size());
-      for (unsigned int i = 0; i < fe_face_values.size(); ++i)
-        fe_face_values[i].resize(face_data_by_cells[i].descriptor.size());
-      std::vector<std::vector<std::shared_ptr<dealii::FEFaceValues<dim>>>>
-        fe_face_values_neigh(face_data_by_cells.size());
-      for (unsigned int i = 0; i < fe_face_values_neigh.size(); ++i)
-        fe_face_values_neigh[i].resize(face_data_by_cells[i].descriptor.size());
-      for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
-        for (unsigned int my_q = 0; my_q < face_data_by_cells.size(); ++my_q)
-          for (const unsigned int face : GeometryInfo<dim>::face_indices())
-            {
-              if (fe_face_values[my_q][fe_index].get() == nullptr)
-                fe_face_values[my_q][fe_index] =
-                  std::make_shared<dealii::FEFaceValues<dim>>(
-                    mapping,
-                    dummy_fe,
-                    face_data[my_q].q_collection[fe_index],
-                    update_flags);
-              if (fe_face_values_neigh[my_q][fe_index].get() == nullptr)
-                fe_face_values_neigh[my_q][fe_index] =
-                  std::make_shared<dealii::FEFaceValues<dim>>(
-                    mapping,
-                    dummy_fe,
-                    face_data[my_q].q_collection[fe_index],
-                    update_flags);
-              dealii::FEFaceValues<dim> &fe_val =
-                *fe_face_values[my_q][fe_index];
-              dealii::FEFaceValues<dim> &fe_val_neigh =
-                *fe_face_values_neigh[my_q][fe_index];
-              const unsigned int offset =
-                face_data_by_cells[my_q]
-                  .data_index_offsets[cell * GeometryInfo<dim>::faces_per_cell +
-                                      face];
-
-              const GeometryType my_cell_type = faces_by_cells_type[cell][face];
-
-              for (unsigned int v = 0; v < n_lanes; ++v)
-                {
-                  typename dealii::Triangulation<dim>::cell_iterator cell_it(
-                    &tria,
-                    cells[cell * n_lanes + v].first,
-                    cells[cell * n_lanes + v].second);
-                  fe_val.reinit(cell_it, face);
 
-                  const unsigned int cell_neighbor =
-                    compute_neighbor_index(cell, face, v);
+      // all cells write into disjoint slots of the arrays allocated above,
+      // so the loop over cells can be distributed onto several tasks, each
+      // operating with its own set of FEFaceValues objects
+      const auto process_cell_range = [&](const unsigned int begin_cell,
+                                          const unsigned int end_cell) {
+        std::vector<std::vector<std::shared_ptr<dealii::FEFaceValues<dim>>>>
+          fe_face_values(face_data_by_cells.size());
+        for (unsigned int i = 0; i < fe_face_values.size(); ++i)
+          fe_face_values[i].resize(face_data_by_cells[i].descriptor.size());
+        std::vector<std::vector<std::shared_ptr<dealii::FEFaceValues<dim>>>>
+          fe_face_values_neigh(face_data_by_cells.size());
+        for (unsigned int i = 0; i < fe_face_values_neigh.size(); ++i)
+          fe_face_values_neigh[i].resize(
+            face_data_by_cells[i].descriptor.size());
+        for (unsigned int cell = begin_cell; cell < end_cell; ++cell)
+          for (unsigned int my_q = 0; my_q < face_data_by_cells.size(); ++my_q)
+            for (const unsigned int face : GeometryInfo<dim>::face_indices())
+              {
+                if (fe_face_values[my_q][fe_index].get() == nullptr)
+                  fe_face_values[my_q][fe_index] =
+                    std::make_shared<dealii::FEFaceValues<dim>>(
+                      mapping,
+                      dummy_fe,
+                      face_data[my_q].q_collection[fe_index],
+                      update_flags);
+                if (fe_face_values_neigh[my_q][fe_index].get() == nullptr)
+                  fe_face_values_neigh[my_q][fe_index] =
+                    std::make_shared<dealii::FEFaceValues<dim>>(
+                      mapping,
+                      dummy_fe,
+                      face_data[my_q].q_collection[fe_index],
+                      update_flags);
+                dealii::FEFaceValues<dim> &fe_val =
+                  *fe_face_values[my_q][fe_index];
+                dealii::FEFaceValues<dim> &fe_val_neigh =
+                  *fe_face_values_neigh[my_q][fe_index];
+                const unsigned int offset =
+                  face_data_by_cells[my_q]
+                    .data_index_offsets[cell * GeometryInfo<dim>::faces_per_cell +
+                                        face];
 
-                  if (cell_neighbor != numbers::invalid_unsigned_int)
-                    {
-                      typename dealii::Triangulation<dim>::cell_iterator
-                        cell_it_neigh(&tria,
-                                      cells[cell_neighbor].first,
-                                      cells[cell_neighbor].second);
-                      fe_val_neigh.reinit(cell_it_neigh,
-                                          cell_it->at_boundary(face) ?
-                                            cell_it->periodic_neighbor_face_no(
-                                              face) :
-                                            cell_it->neighbor_face_no(face));
-                    }
+                const GeometryType my_cell_type = faces_by_cells_type[cell][face];
 
-                  // copy data for affine data type
-                  if (my_cell_type <= affine)
-                    {
-                      if (update_flags & update_JxW_values)
-                        face_data_by_cells[my_q].JxW_values[offset][v] =
-                          fe_val.JxW(0) / fe_val.get_quadrature().weight(0);
-                      if (update_flags & update_jacobians)
-                        {
-                          DerivativeForm<1, dim, dim> inv_jac =
-                            fe_val.jacobian(0).covariant_form();
-                          for (unsigned int d = 0; d < dim; ++d)
-                            for (unsigned int e = 0; e < dim; ++e)
-                              {
-                                const unsigned int ee = ExtractFaceHelper::
-                                  reorder_face_derivative_indices<dim>(face, e);
-                                face_data_by_cells[my_q]
-                                  .jacobians[0][offset][d][e][v] =
-                                  inv_jac[d][ee];
-                              }
-                        }
-                      if (cell_neighbor != numbers::invalid_unsigned_int &&
-                          (update_flags & update_jacobians))
-                        for (unsigned int q = 0; q < fe_val.n_quadrature_points;
-                             ++q)
-                          {
-                            DerivativeForm<1, dim, dim> inv_jac =
-                              fe_val_neigh.jacobian(q).covariant_form();
-                            for (unsigned int d = 0; d < dim; ++d)
-                              for (unsigned int e = 0; e < dim; ++e)
-                                {
-                                  const unsigned int ee = ExtractFaceHelper::
-                                    reorder_face_derivative_indices<dim>(
-                                      fe_val_neigh.get_face_number(), e);
-                                  face_data_by_cells[my_q]
-                                    .jacobians[1][offset][d][e][v] =
-                                    inv_jac[d][ee];
-                                }
-                          }
-                      if (update_flags & update_jacobian_grads)
-                        {
-                          DEAL_II_NOT_IMPLEMENTED();
-                        }
-                      if (update_flags & update_normal_vectors)
-                        for (unsigned int d = 0; d < dim; ++d)
-                          face_data_by_cells[my_q]
-                            .normal_vectors[offset][d][v] =
-                            fe_val.normal_vector(0)[d];
-                    }
-                  // copy data for general data type
-                  else
-                    {
-                      if (update_flags & update_JxW_values)
-                        for (unsigned int q = 0; q < fe_val.n_quadrature_points;
-                             ++q)
-                          face_data_by_cells[my_q].JxW_values[offset + q][v] =
-                            fe_val.JxW(q);
-                      if (update_flags & update_jacobians)
-                        for (unsigned int q = 0; q < fe_val.n_quadrature_points;
-                             ++q)
+                for (unsigned int v = 0; v < n_lanes; ++v)
+                  {
+                    typename dealii::Triangulation<dim>::cell_iterator cell_it(
+                      &tria,
+                      cells[cell * n_lanes + v].first,
+                      cells[cell * n_lanes + v].second);
+                    fe_val.reinit(cell_it, face);
+
+                    const unsigned int cell_neighbor =
+                      compute_neighbor_index(cell, face, v);
+
+                    if (cell_neighbor != numbers::invalid_unsigned_int)
+                      {
+                        typename dealii::Triangulation<dim>::cell_iterator
+                          cell_it_neigh(&tria,
+                                        cells[cell_neighbor].first,
+                                        cells[cell_neighbor].second);
+                        fe_val_neigh.reinit(cell_it_neigh,
+                                            cell_it->at_boundary(face) ?
+                                              cell_it->periodic_neighbor_face_no(
+                                                face) :
+                                              cell_it->neighbor_face_no(face));
+                      }
+
+                    // copy data for affine data type
+                    if (my_cell_type <= affine)
+                      {
+                        if (update_flags & update_JxW_values)
+                          face_data_by_cells[my_q].JxW_values[offset][v] =
+                            fe_val.JxW(0) / fe_val.get_quadrature().weight(0);
+                        if (update_flags & update_jacobians)
                           {
                             DerivativeForm<1, dim, dim> inv_jac =
-                              fe_val.jacobian(q).covariant_form();
+                              fe_val.jacobian(0).covariant_form();
                             for (unsigned int d = 0; d < dim; ++d)
                               for (unsigned int e = 0; e < dim; ++e)
                                 {
                                   const unsigned int ee = ExtractFaceHelper::
-                                    reorder_face_derivative_indices<dim>(face,
-                                                                         e);
+                                    reorder_face_derivative_indices<dim>(face, e);
                                   face_data_by_cells[my_q]
-                                    .jacobians[0][offset + q][d][e][v] =
+                                    .jacobians[0][offset][d][e][v] =
                                     inv_jac[d][ee];
                                 }
                           }
-                      if (cell_neighbor != numbers::invalid_unsigned_int &&
-                          (update_flags & update_jacobians))
-                        for (unsigned int q = 0; q < fe_val.n_quadrature_points;
-                             ++q)
+                        if (cell_neighbor != numbers::invalid_unsigned_int &&
+                            (update_flags & update_jacobians))
+                          for (unsigned int q = 0; q < fe_val.n_quadrature_points;
+                               ++q)
+                            {
+                              DerivativeForm<1, dim, dim> inv_jac =
+                                fe_val_neigh.jacobian(q).covariant_form();
+                              for (unsigned int d = 0; d < dim; ++d)
+                                for (unsigned int e = 0; e < dim; ++e)
+                                  {
+                                    const unsigned int ee = ExtractFaceHelper::
+                                      reorder_face_derivative_indices<dim>(
+                                        fe_val_neigh.get_face_number(), e);
+                                    face_data_by_cells[my_q]
+                                      .jacobians[1][offset][d][e][v] =
+                                      inv_jac[d][ee];
+                                  }
+                            }
+                        if (update_flags & update_jacobian_grads)
                           {
-                            DerivativeForm<1, dim, dim> inv_jac =
-                              fe_val_neigh.jacobian(q).covariant_form();
-                            for (unsigned int d = 0; d < dim; ++d)
-                              for (unsigned int e = 0; e < dim; ++e)
-                                {
-                                  const unsigned int ee = ExtractFaceHelper::
-                                    reorder_face_derivative_indices<dim>(
-                                      fe_val_neigh.get_face_number(), e);
-                                  face_data_by_cells[my_q]
-                                    .jacobians[1][offset + q][d][e][v] =
-                                    inv_jac[d][ee];
-                                }
+                            DEAL_II_NOT_IMPLEMENTED();
                           }
-                      if (update_flags & update_jacobian_grads)
-                        {
-                          DEAL_II_NOT_IMPLEMENTED();
-                        }
-                      if (update_flags & update_normal_vectors)
-                        for (unsigned int q = 0; q < fe_val.n_quadrature_points;
-                             ++q)
+                        if (update_flags & update_normal_vectors)
                           for (unsigned int d = 0; d < dim; ++d)
                             face_data_by_cells[my_q]
-                              .normal_vectors[offset + q][d][v] =
-                              fe_val.normal_vector(q)[d];
-                    }
-                  if (update_flags & update_quadrature_points)
-                    for (unsigned int q = 0; q < fe_val.n_quadrature_points;
-                         ++q)
-                      for (unsigned int d = 0; d < dim; ++d)
-                        face_data_by_cells[my_q].quadrature_points
-                          [face_data_by_cells[my_q].quadrature_point_offsets
-                             [cell * GeometryInfo<dim>::faces_per_cell + face] +
-                           q][d][v] = fe_val.quadrature_point(q)[d];
-                }
-              if (update_flags & update_normal_vectors &&
-                  update_flags & update_jacobians)
-                for (unsigned int q = 0;
-                     q <
-                     (my_cell_type <= affine ? 1 : fe_val.n_quadrature_points);
-                     ++q)
-                  face_data_by_cells[my_q]
-                    .normals_times_jacobians[0][offset + q] =
-                    face_data_by_cells[my_q].normal_vectors[offset + q] *
-                    face_data_by_cells[my_q].jacobians[0][offset + q];
-              if (update_flags & update_normal_vectors &&
-                  update_flags & update_jacobians)
-                for (unsigned int q = 0;
-                     q <
-                     (my_cell_type <= affine ? 1 : fe_val.n_quadrature_points);
-                     ++q)
-                  face_data_by_cells[my_q]
-                    .normals_times_jacobians[1][offset + q] =
-                    face_data_by_cells[my_q].normal_vectors[offset + q] *
-                    face_data_by_cells[my_q].jacobians[1][offset + q];
-            }
+                              .normal_vectors[offset][d][v] =
+                              fe_val.normal_vector(0)[d];
+                      }
+                    // copy data for general data type
+                    else
+                      {
+                        if (update_flags & update_JxW_values)
+                          for (unsigned int q = 0; q < fe_val.n_quadrature_points;
+                               ++q)
+                            face_data_by_cells[my_q].JxW_values[offset + q][v] =
+                              fe_val.JxW(q);
+                        if (update_flags & update_jacobians)
+                          for (unsigned int q = 0; q < fe_val.n_quadrature_points;
+                               ++q)
+                            {
+                              DerivativeForm<1, dim, dim> inv_jac =
+                                fe_val.jacobian(q).covariant_form();
+                              for (unsigned int d = 0; d < dim; ++d)
+                                for (unsigned int e = 0; e < dim; ++e)
+                                  {
+                                    const unsigned int ee = ExtractFaceHelper::
+                                      reorder_face_derivative_indices<dim>(face,
+                                                                           e);
+                                    face_data_by_cells[my_q]
+                                      .jacobians[0][offset + q][d][e][v] =
+                                      inv_jac[d][ee];
+                                  }
+                            }
+                        if (cell_neighbor != numbers::invalid_unsigned_int &&
+                            (update_flags & update_jacobians))
+                          for (unsigned int q = 0; q < fe_val.n_quadrature_points;
+                               ++q)
+                            {
+                              DerivativeForm<1, dim, dim> inv_jac =
+                                fe_val_neigh.jacobian(q).covariant_form();
+                              for (unsigned int d = 0; d < dim; ++d)
+                                for (unsigned int e = 0; e < dim; ++e)
+                                  {
+                                    const unsigned int ee = ExtractFaceHelper::
+                                      reorder_face_derivative_indices<dim>(
+                                        fe_val_neigh.get_face_number(), e);
+                                    face_data_by_cells[my_q]
+                                      .jacobians[1][offset + q][d][e][v] =
+                                      inv_jac[d][ee];
+                                  }
+                            }
+                        if (update_flags & update_jacobian_grads)
+                          {
+                            DEAL_II_NOT_IMPLEMENTED();
+                          }
+                        if (update_flags & update_normal_vectors)
+                          for (unsigned int q = 0; q < fe_val.n_quadrature_points;
+                               ++q)
+                            for (unsigned int d = 0; d < dim; ++d)
+                              face_data_by_cells[my_q]
+                                .normal_vectors[offset + q][d][v] =
+                                fe_val.normal_vector(q)[d];
+                      }
+                    if (update_flags & update_quadrature_points)
+                      for (unsigned int q = 0; q < fe_val.n_quadrature_points;
+                           ++q)
+                        for (unsigned int d = 0; d < dim; ++d)
+                          face_data_by_cells[my_q].quadrature_points
+                            [face_data_by_cells[my_q].quadrature_point_offsets
+                               [cell * GeometryInfo<dim>::faces_per_cell + face] +
+                             q][d][v] = fe_val.quadrature_point(q)[d];
+                  }
+                if (update_flags & update_normal_vectors &&
+                    update_flags & update_jacobians)
+                  for (unsigned int q = 0;
+                       q <
+                       (my_cell_type <= affine ? 1 : fe_val.n_quadrature_points);
+                       ++q)
+                    face_data_by_cells[my_q]
+                      .normals_times_jacobians[0][offset + q] =
+                      face_data_by_cells[my_q].normal_vectors[offset + q] *
+                      face_data_by_cells[my_q].jacobians[0][offset + q];
+                if (update_flags & update_normal_vectors &&
+                    update_flags & update_jacobians)
+                  for (unsigned int q = 0;
+                       q <
+                       (my_cell_type <= affine ? 1 : fe_val.n_quadrature_points);
+                       ++q)
+                    face_data_by_cells[my_q]
+                      .normals_times_jacobians[1][offset + q] =
+                      face_data_by_cells[my_q].normal_vectors[offset + q] *
+                      face_data_by_cells[my_q].jacobians[1][offset + q];
+              }
+      };
+
+      dealii::parallel::apply_to_subranges(0U,
+                                           cell_type.size(),
+                                           process_cell_range,
+                                           8);
     }
 
 
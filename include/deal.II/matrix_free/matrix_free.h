@@ -99,6 +99,44 @@ DEAL_II_NAMESPACE_OPEN
  * operations for several cells with one CPU instruction and is one of the
  * main features of this framework.
  *
+ * <h3>Structured meshes</h3>
+ *
+ * On meshes with a regular structure, such as the Cartesian blocks produced
+ * by GridGenerator::subdivided_hyper_rectangle(), the initialization
+ * routines automatically select cheaper code paths: Cells whose Jacobian is
+ * constant (affine) or additionally diagonal (Cartesian) are detected during
+ * reinit(), their transformation data is compressed to a single entry per
+ * group of translated cells, and the evaluation kernels then apply the
+ * diagonal geometry terms at a cost comparable to a finite-difference
+ * stencil. Likewise, the unknowns of cells whose degrees of freedom are laid
+ * out consecutively in the solution vector are accessed with constant-stride
+ * loads and stores instead of indirect gather/scatter operations; the
+ * renumbering computed by DoFRenumbering::matrix_free_data_locality() brings
+ * general meshes into this form. No user action is required to activate the
+ * geometry detection, and meshes that mix structured and unstructured
+ * regions use the fast path on those cell batches where it applies.
+ *
+ * <h3>Memory consumption</h3>
+ *
+ * The memory consumed by an object of this class is dominated by DoFInfo and
+ * MappingInfo, both of which only describe the locally owned (and ghosted)
+ * cells of the respective MPI process, so this data is distributed rather
+ * than replicated when several processes share a compute node. MappingInfo
+ * furthermore detects affine cell geometries and then compresses the stored
+ * Jacobians to a single entry per group of identical transformations, which
+ * makes its contribution negligible on uniform meshes. The ShapeInfo tables
+ * hold one-dimensional shape data of a few kilobytes per finite element and
+ * quadrature formula, which is why they are stored per process rather than
+ * in an MPI shared-memory window. Use memory_consumption() and
+ * print_memory_consumption() to inspect the actual sizes. If an application
+ * needs to hold large read-only lookup tables next to this class, such as
+ * tabulated material data, the functions
+ * AlignedVector::replicate_across_communicator() and
+ * TableBase::replicate_across_communicator() can place a single copy of
+ * those tables in the shared memory of each compute node; similarly,
+ * AdditionalData::communicator_sm enables direct access to the locally
+ * relevant part of vectors held by other processes on the same node.
+ *
  * For details on usage of this class, see the description of FEEvaluation or
  * the
  * @ref matrixfree "matrix-free module".
@@ -250,6 +288,7 @@ public:
           cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(allow_ghosted_vectors_in_loops)
       , communicator_sm(MPI_COMM_SELF)
+      , use_intra_node_shared_memory(false)
     {}
 
     /**
@@ -276,6 +315,7 @@ public:
           other.cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(other.allow_ghosted_vectors_in_loops)
       , communicator_sm(other.communicator_sm)
+      , use_intra_node_shared_memory(other.use_intra_node_shared_memory)
     {}
 
     /**
@@ -304,6 +344,7 @@ public:
         other.cell_vectorization_categories_strict;
       allow_ghosted_vectors_in_loops = other.allow_ghosted_vectors_in_loops;
       communicator_sm                = other.communicator_sm;
+      use_intra_node_shared_memory   = other.use_intra_node_shared_memory;
 
       return *this;
     }
@@ -512,6 +553,19 @@ public:
      * consequence, can only processed together with cells with the same
      * category.
      *
+     * If a quadrature collection with more than one formula is attached to
+     * a quad index in MatrixFree::reinit(), the category additionally
+     * selects the quadrature formula each cell uses for that quad index,
+     * with mapping data only evaluated for the selected formula. This
+     * allows, e.g., an expensive high-order rule to be restricted to a
+     * small set of cells without splitting the operator evaluation into
+     * several loops: construct FEEvaluation with the constructor taking
+     * the cell range within the loop, which picks up the quadrature
+     * formula of the range via
+     * MatrixFree::get_cell_active_quad_index(). This setting requires
+     * @p cell_vectorization_categories_strict to be enabled so that cell
+     * ranges do not mix categories.
+     *
      * This array is accessed by the number given by cell->active_cell_index()
      * when working on the active cells (with
      * @p mg_level set to numbers::invalid_unsigned_int) and by cell->index()
@@ -551,6 +605,31 @@ public:
      * Shared-memory MPI communicator. Default: MPI_COMM_SELF.
      */
     MPI_Comm communicator_sm;
+
+    /**
+     * If set to true and @p communicator_sm has been left at its default
+     * value MPI_COMM_SELF, the MatrixFree object creates a communicator
+     * spanning all MPI processes that have access to a common shared-memory
+     * domain (typically the processes placed on the same compute node) by
+     * splitting the global communicator, and uses it in place of
+     * @p communicator_sm. Vectors initialized through
+     * MatrixFree::initialize_dof_vector() then allocate their data in an
+     * MPI-3.0 shared-memory window, and FEEvaluation::gather_evaluate() as
+     * well as FEFaceEvaluation::gather_evaluate() read vector entries owned
+     * by other processes of the same node directly from that window rather
+     * than going through the pack/send/unpack cycle of the ghost exchange.
+     * As a result, the communication in MatrixFree::loop() is reduced to
+     * the faces between nodes. The created communicator is owned by the
+     * MatrixFree object and freed in MatrixFree::clear().
+     *
+     * Note that the zero-copy access only applies to vectors whose memory
+     * has been allocated through the shared-memory communicator, which is
+     * most easily ensured by using MatrixFree::initialize_dof_vector();
+     * other vectors fall back to the regular ghost exchange.
+     *
+     * Default: false.
+     */
+    bool use_intra_node_shared_memory;
   };
 
   /**
@@ -570,7 +649,7 @@ public:
   /**
    * Destructor.
    */
-  ~MatrixFree() override = default;
+  ~MatrixFree() override;
 
   /**
    * Extracts the information needed to perform loops over cells. The
@@ -801,6 +880,41 @@ public:
             const InVector                                    &src,
             const bool zero_dst_vector = false) const;
 
+  /**
+   * Fused variant of the function above that chains several cell operations
+   * in a single loop: for each range of cell batches, the given functions
+   * are executed back-to-back while the DoF values of the batch are still in
+   * cache, rather than streaming the vectors through memory once per
+   * operation. The MPI ghost exchange on @p src and the compress operation
+   * on @p dst are performed only once for the whole chain.
+   *
+   * By passing the operations as one chain, the caller declares their data
+   * dependencies to be batch-local: every operation but the first may only
+   * read data that the previous operations have written for the same range
+   * of cell batches (plus the ghosted entries of @p src, which are valid
+   * throughout the loop). This is the typical situation for sequences of
+   * cell-local operations on discontinuous elements, e.g., applying the
+   * inverse mass matrix, evaluating a pointwise operator, and limiting the
+   * result. Operations that couple neighboring cells through @p dst, such
+   * as face integrals, must not be fused this way but require separate
+   * loops (or MatrixFree::loop()).
+   *
+   * Intermediate results that do not fit into @p dst or @p src can be passed
+   * between the operations through vectors captured in the closures; such
+   * vectors do not participate in the ghost exchange of this loop and must
+   * be accessed batch-locally as well.
+   */
+  template <typename OutVector, typename InVector>
+  void
+  cell_loop(const std::vector<std::function<void(
+              const MatrixFree<dim, Number, VectorizedArrayType> &,
+              OutVector &,
+              const InVector &,
+              const std::pair<unsigned int, unsigned int> &)>> &cell_operations,
+            OutVector                                          &dst,
+            const InVector                                     &src,
+            const bool zero_dst_vector = false) const;
+
   /**
    * This is the second variant to run the loop over all cells, now providing
    * a function pointer to a member function of class `CLASS`. This method
@@ -1624,6 +1738,23 @@ public:
   get_cell_active_fe_index(
     const std::pair<unsigned int, unsigned int> range) const;
 
+  /**
+   * Return the index of the quadrature formula within the hp::QCollection
+   * identified by @p quad_no that the cells in the given cell range should
+   * use. In the hp-adaptive case, this is the active FE index of the range,
+   * clamped to the number of available quadrature formulas. In the non-hp
+   * case with categories given in
+   * AdditionalData::cell_vectorization_category, the category of the range
+   * selects the quadrature formula, which allows expensive quadrature rules
+   * to be restricted to a subset of the cells without splitting the
+   * operator evaluation into several loops; note that this requires
+   * AdditionalData::cell_vectorization_categories_strict to be enabled so
+   * that the loop ranges do not mix categories.
+   */
+  unsigned int
+  get_cell_active_quad_index(const std::pair<unsigned int, unsigned int> range,
+                             const unsigned int quad_no = 0) const;
+
   /**
    * In the hp-adaptive case, return the active FE index of a face range.
    */
@@ -1631,6 +1762,23 @@ public:
   get_face_active_fe_index(const std::pair<unsigned int, unsigned int> range,
                            const bool is_interior_face = true) const;
 
+  /**
+   * In the hp-adaptive case, return the index of the quadrature formula
+   * within the hp::QCollection identified by @p quad_no that both sides of
+   * the faces in the given face range should use. On an interior face
+   * between cells of different active FE index, the interface terms are only
+   * consistent if the two sides integrate with the same quadrature formula;
+   * this function selects the formula associated with the FE index of the
+   * interior side, which is the formula the face geometry data (JxW values,
+   * normal vectors, Jacobians) has been evaluated and stored with. Note
+   * that this implies that the interface terms are integrated with the
+   * formula of the interior side also when the exterior side has a higher
+   * FE index.
+   */
+  unsigned int
+  get_face_active_quad_index(const std::pair<unsigned int, unsigned int> range,
+                             const unsigned int quad_no = 0) const;
+
   /** @} */
 
   /**
@@ -2089,6 +2237,23 @@ public:
   void
   print_memory_consumption(StreamType &out) const;
 
+  /**
+   * Prints a summary of the vectorization applied by this class to the given
+   * output stream: the number of lanes of the VectorizedArrayType the class
+   * has been instantiated with, the instruction set extension the library
+   * has been compiled for, and how well the cell and face batches fill the
+   * available lanes. This information is useful when choosing the width of
+   * the vectorization: since the width is a template parameter of this
+   * class, kernels can be instantiated at a narrower width than the widest
+   * one the hardware supports, e.g.
+   * `MatrixFree<dim, double, VectorizedArray<double, 4>>`, which is
+   * sometimes faster on hardware that reduces the clock frequency for the
+   * widest vector operations.
+   */
+  template <typename StreamType>
+  void
+  print_vectorization_statistics(StreamType &out) const;
+
   /**
    * Prints a summary of this class to the given output stream. It is focused
    * on the indices, and does not print all the data stored.
@@ -2323,6 +2488,13 @@ private:
    */
   internal::MatrixFreeFunctions::TaskInfo task_info;
 
+  /**
+   * The node-local communicator created and owned by this object in case
+   * AdditionalData::use_intra_node_shared_memory was set, and MPI_COMM_SELF
+   * otherwise. It is freed in clear().
+   */
+  MPI_Comm owned_communicator_sm;
+
   /**
    * Vector holding face information. Only initialized if
    * build_face_info=true.
@@ -2710,6 +2882,29 @@ MatrixFree<dim, Number, VectorizedArrayType>::get_cell_active_fe_index(
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+unsigned int
+MatrixFree<dim, Number, VectorizedArrayType>::get_cell_active_quad_index(
+  const std::pair<unsigned int, unsigned int> range,
+  const unsigned int                          quad_no) const
+{
+  const auto &fe_indices = dof_info[0].cell_active_fe_index;
+
+  if (fe_indices.empty() == true)
+    return 0;
+
+  const unsigned int index = fe_indices[range.first];
+
+  for (unsigned int i = range.first; i < range.second; ++i)
+    AssertDimension(index, fe_indices[i]);
+
+  AssertIndexRange(quad_no, mapping_info.cell_data.size());
+  return std::min<unsigned int>(
+    index, mapping_info.cell_data[quad_no].descriptor.size() - 1);
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 unsigned int
 MatrixFree<dim, Number, VectorizedArrayType>::get_face_active_fe_index(
@@ -2718,7 +2913,10 @@ MatrixFree<dim, Number, VectorizedArrayType>::get_face_active_fe_index(
 {
   const auto &fe_indices = dof_info[0].cell_active_fe_index;
 
-  if (fe_indices.empty() == true)
+  // in the non-hp case, the entries of cell_active_fe_index are the cell
+  // categories, which must not be used as an index into the FE collection
+  if (fe_indices.empty() == true ||
+      dof_handlers[0]->get_fe_collection().size() == 1)
     return 0;
 
   if (is_interior_face)
@@ -2751,6 +2949,31 @@ MatrixFree<dim, Number, VectorizedArrayType>::get_face_active_fe_index(
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+inline unsigned int
+MatrixFree<dim, Number, VectorizedArrayType>::get_face_active_quad_index(
+  const std::pair<unsigned int, unsigned int> range,
+  const unsigned int                          quad_no) const
+{
+  if (dof_info[0].cell_active_fe_index.empty())
+    return 0;
+
+  // the face geometry data is evaluated and stored with the quadrature
+  // formula selected by the FE index of the interior side of the face, see
+  // the face part of MappingInfo::initialize(), so this is the index both
+  // sides must use to address that data
+  const unsigned int index = get_face_category(range.first).first;
+
+  // the quadrature collection may contain fewer formulas than the finite
+  // element collection contains elements, in which case the last formula is
+  // used for all remaining FE indices
+  AssertIndexRange(quad_no, mapping_info.cell_data.size());
+  return std::min<unsigned int>(
+    index, mapping_info.cell_data[quad_no].descriptor.size() - 1);
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 inline unsigned int
 MatrixFree<dim, Number, VectorizedArrayType>::n_active_entries_per_cell_batch(
@@ -5011,6 +5234,47 @@ MatrixFree<dim, Number, VectorizedArrayType>::cell_loop(
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename OutVector, typename InVector>
+inline void
+MatrixFree<dim, Number, VectorizedArrayType>::cell_loop(
+  const std::vector<std::function<void(
+    const MatrixFree<dim, Number, VectorizedArrayType> &,
+    OutVector &,
+    const InVector &,
+    const std::pair<unsigned int, unsigned int> &)>> &cell_operations,
+  OutVector                                          &dst,
+  const InVector                                     &src,
+  const bool                                          zero_dst_vector) const
+{
+  Assert(cell_operations.size() > 0,
+         ExcMessage("Need at least one cell operation to run a fused loop."));
+
+  for (const auto &cell_operation : cell_operations)
+    Assert(cell_operation, ExcNotInitialized());
+
+  // run all operations back-to-back on each range of cell batches so that
+  // the DoF values of the range are reused while they are still in cache
+  this->cell_loop(
+    std::function<void(const MatrixFree<dim, Number, VectorizedArrayType> &,
+                       OutVector &,
+                       const InVector &,
+                       const std::pair<unsigned int, unsigned int> &)>(
+      [&cell_operations](
+        const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+        OutVector                                          &dst,
+        const InVector                                     &src,
+        const std::pair<unsigned int, unsigned int>        &range) {
+        for (const auto &cell_operation : cell_operations)
+          cell_operation(matrix_free, dst, src, range);
+      }),
+    dst,
+    src,
+    zero_dst_vector);
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 template <typename OutVector, typename InVector>
 inline void
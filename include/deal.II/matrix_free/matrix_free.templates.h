@@ -25,6 +25,7 @@
 #include <deal.II/base/polynomials_piecewise.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/tensor_product_polynomials.h>
+#include <deal.II/base/utilities.h>
 
 #include <deal.II/distributed/tria.h>
 
@@ -55,18 +56,11 @@
 
 //
 // TBB with oneAPI API has deprecated and removed the
-// <code>tbb::tasks</code> backend. With this it is no longer possible to
-// compile the following code that builds a directed acyclic graph (DAG) of
-// (thread parallel) tasks without a major porting effort. It turned out
-// that such a dynamic handling of dependencies and structures is not as
-// competitive as initially assumed. Consequently, this part of the matrix
-// free infrastructure has seen less attention than the rest over the last
-// years and is (presumably) not used that often.
-//
-// In case of detected oneAPI backend we simply disable threading in the
-// matrix free backend for now.
-//
-// Matthias Maier, Martin Kronbichler, 2021
+// <code>tbb::tasks</code> backend that was originally used to build the
+// directed acyclic graph (DAG) of (thread parallel) tasks. For the oneAPI
+// backend, the task graph of the partition-partition scheme is instead
+// scheduled through a tbb::task_group onto the work-stealing scheduler,
+// see the implementation in source/matrix_free/task_info.cc.
 //
 
 DEAL_II_NAMESPACE_OPEN
@@ -78,6 +72,7 @@ DEAL_II_NAMESPACE_OPEN
 template <int dim, typename Number, typename VectorizedArrayType>
 MatrixFree<dim, Number, VectorizedArrayType>::MatrixFree()
   : Subscriptor()
+  , owned_communicator_sm(MPI_COMM_SELF)
   , indices_are_initialized(false)
   , mapping_is_initialized(false)
   , mg_level(numbers::invalid_unsigned_int)
@@ -89,12 +84,21 @@ template <int dim, typename Number, typename VectorizedArrayType>
 MatrixFree<dim, Number, VectorizedArrayType>::MatrixFree(
   const MatrixFree<dim, Number, VectorizedArrayType> &other)
   : Subscriptor()
+  , owned_communicator_sm(MPI_COMM_SELF)
 {
   copy_from(other);
 }
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+MatrixFree<dim, Number, VectorizedArrayType>::~MatrixFree()
+{
+  clear();
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 std::pair<unsigned int, unsigned int>
 MatrixFree<dim, Number, VectorizedArrayType>::create_cell_subrange_hp_by_index(
@@ -449,6 +453,25 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
       task_info.n_procs =
         Utilities::MPI::n_mpi_processes(task_info.communicator);
 
+#ifdef DEAL_II_WITH_MPI
+      // If requested, create a communicator of the processes that have
+      // access to a common shared-memory domain (typically the processes
+      // placed on the same compute node), unless the user has provided a
+      // shared-memory communicator themselves.
+      if (additional_data.use_intra_node_shared_memory &&
+          additional_data.communicator_sm == MPI_COMM_SELF &&
+          task_info.n_procs > 1)
+        {
+          const int ierr = MPI_Comm_split_type(task_info.communicator,
+                                               MPI_COMM_TYPE_SHARED,
+                                               task_info.my_pid,
+                                               MPI_INFO_NULL,
+                                               &owned_communicator_sm);
+          AssertThrowMPI(ierr);
+          task_info.communicator_sm = owned_communicator_sm;
+        }
+#endif
+
 #ifdef DEBUG
       for (const auto &constraint : constraints)
         Assert(
@@ -472,7 +495,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
 
         // initialize the basic multithreading information that needs to be
         // passed to the DoFInfo structure
-#if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
+#if defined(DEAL_II_WITH_TBB)
       if (additional_data.tasks_parallel_scheme != AdditionalData::none &&
           MultithreadInfo::n_threads() > 1)
         {
@@ -831,11 +854,25 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
                       tensor_raviart_thomas)
                   piola_transform = true;
 
+      // In the non-hp case, the categories given in
+      // AdditionalData::cell_vectorization_category are also stored in
+      // cell_active_fe_index. If a quadrature collection with more than one
+      // formula has been attached to some quad index, the categories select
+      // the quadrature formula per cell and the mapping data must be
+      // evaluated per category; with a single formula per quad index, the
+      // categories only affect the loop order and the mapping
+      // initialization can ignore them and use its fast paths.
+      const bool categories_select_quadrature =
+        std::any_of(quad.begin(), quad.end(), [](const auto &q) {
+          return q.size() > 1;
+        });
+
       mapping_info.initialize(
         dof_handler[0]->get_triangulation(),
         cell_level_index,
         face_info,
-        dof_handler[0]->has_hp_capabilities() ?
+        (dof_handler[0]->has_hp_capabilities() ||
+         categories_select_quadrature) ?
           dof_info[0].cell_active_fe_index :
           std::vector<unsigned int>(),
         mapping,
@@ -990,7 +1027,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_dof_handlers(
 
 namespace internal
 {
-#if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
+#if defined(DEAL_II_WITH_TBB)
 
 #  ifdef DEAL_II_TBB_WITH_ONEAPI
   struct unsigned_int_pair_hash
@@ -1329,8 +1366,37 @@ namespace internal
           }
       }
 
+    // The hanging-node treatment below consists of a geometric part, the
+    // refinement configuration of a cell with respect to its neighbors, and
+    // an algebraic part that resolves the constrained indices. The geometric
+    // part only depends on the triangulation -- except for FE_Nothing
+    // elements, which make neighbors without degrees of freedom disappear
+    // from the constraints -- so we can compute it once per cell and share
+    // it between all DoFHandler objects instead of redoing the neighbor
+    // traversal for every one of them.
+    const bool has_hanging_node_components =
+      hanging_nodes != nullptr &&
+      std::any_of(dof_info.begin(), dof_info.end(), [](const auto &di) {
+        return di.hanging_node_constraint_masks_comp.empty() == false;
+      });
+    const bool hanging_node_configuration_is_shared =
+      std::all_of(dof_handlers.begin(),
+                  dof_handlers.end(),
+                  [](const auto &dofh) {
+                    const dealii::hp::FECollection<dim> &fes =
+                      dofh->get_fe_collection();
+                    return std::all_of(fes.begin(),
+                                       fes.end(),
+                                       [](const auto &fe) {
+                                         return fe.n_dofs_per_cell() > 0;
+                                       });
+                  });
+
     for (unsigned int counter = 0; counter < n_active_cells; ++counter)
       {
+        MatrixFreeFunctions::ConstraintKinds refinement_configuration =
+          MatrixFreeFunctions::ConstraintKinds::unconstrained;
+
         bool cell_at_subdomain_boundary =
           (face_setup.at_processor_boundary.size() > counter &&
            face_setup.at_processor_boundary[counter]) ||
@@ -1373,17 +1439,25 @@ namespace internal
                   local_dof_indices[i] =
                     local_dof_indices_resolved[lexicographic[no][fe_index][i]];
 
-                if (dim > 1 && use_fast_hanging_node_algorithm)
+                if (dim > 1 && use_fast_hanging_node_algorithm &&
+                    has_hanging_node_components)
                   {
                     local_dof_indices_resolved = local_dof_indices;
 
+                    if (no == 0 ||
+                        hanging_node_configuration_is_shared == false)
+                      refinement_configuration =
+                        hanging_nodes->compute_refinement_configuration(
+                          cell_it);
+
                     cell_has_hanging_node_constraints =
                       dof_info[no].process_hanging_node_constraints(
                         *hanging_nodes,
                         lexicographic[no],
                         counter,
                         cell_it,
-                        local_dof_indices_resolved);
+                        local_dof_indices_resolved,
+                        refinement_configuration);
                   }
               }
             // we are requested to use a multigrid level
@@ -1690,7 +1764,7 @@ namespace internal
         connectivity.reinit(task_info.n_active_cells, task_info.n_active_cells);
         if (do_face_integrals)
           {
-#if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
+#if defined(DEAL_II_WITH_TBB)
             // step 1: build map between the index in the matrix-free context
             // and the one in the triangulation
             tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,
@@ -2317,6 +2391,11 @@ MatrixFree<dim, Number, VectorizedArrayType>::clear()
   face_info.clear();
   indices_are_initialized = false;
   mapping_is_initialized  = false;
+  if (owned_communicator_sm != MPI_COMM_SELF)
+    {
+      Utilities::MPI::free_communicator(owned_communicator_sm);
+      owned_communicator_sm = MPI_COMM_SELF;
+    }
 }
 
 
@@ -2378,6 +2457,66 @@ MatrixFree<dim, Number, VectorizedArrayType>::print_memory_consumption(
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename StreamType>
+void
+MatrixFree<dim, Number, VectorizedArrayType>::print_vectorization_statistics(
+  StreamType &out) const
+{
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  out << "  Vectorization over " << n_lanes << " lane"
+      << (n_lanes > 1 ? "s" : "") << " of " << sizeof(Number)
+      << "-byte scalars = " << n_lanes * sizeof(Number) * 8 << " bits ("
+      << Utilities::System::get_current_vectorization_level() << ')'
+      << std::endl;
+
+  // Gather how well the lanes of the cell and face batches are filled. A
+  // large share of partially filled batches indicates that a narrower
+  // vectorization width might perform equally well or better.
+  const auto print_fill_statistics = [&](const char        *name,
+                                         const std::size_t  n_batches,
+                                         const std::size_t  n_lanes_filled) {
+    const std::size_t n_batches_global =
+      Utilities::MPI::sum(n_batches, task_info.communicator);
+    if (n_batches_global == 0)
+      return;
+    const std::size_t n_lanes_filled_global =
+      Utilities::MPI::sum(n_lanes_filled, task_info.communicator);
+    out << "   " << name << " batches: " << n_batches_global
+        << ", average lanes filled: "
+        << static_cast<double>(n_lanes_filled_global) / n_batches_global
+        << " of " << n_lanes << " ("
+        << 100. * n_lanes_filled_global / (n_batches_global * n_lanes) << "%)"
+        << std::endl;
+  };
+
+  {
+    std::size_t n_lanes_filled = 0;
+    for (unsigned int cell = 0; cell < n_cell_batches(); ++cell)
+      n_lanes_filled += n_active_entries_per_cell_batch(cell);
+    print_fill_statistics("Cell", n_cell_batches(), n_lanes_filled);
+  }
+  {
+    std::size_t n_lanes_filled = 0;
+    for (unsigned int face = 0; face < n_inner_face_batches(); ++face)
+      n_lanes_filled += n_active_entries_per_face_batch(face);
+    print_fill_statistics("Inner face", n_inner_face_batches(), n_lanes_filled);
+  }
+  {
+    std::size_t n_lanes_filled = 0;
+    for (unsigned int face = n_inner_face_batches();
+         face < n_inner_face_batches() + n_boundary_face_batches();
+         ++face)
+      n_lanes_filled += n_active_entries_per_face_batch(face);
+    print_fill_statistics("Boundary face",
+                          n_boundary_face_batches(),
+                          n_lanes_filled);
+  }
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 void
 MatrixFree<dim, Number, VectorizedArrayType>::print(std::ostream &out) const
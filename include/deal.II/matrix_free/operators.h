@@ -24,6 +24,7 @@
 #include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 #include <deal.II/matrix_free/fe_evaluation.h>
@@ -32,6 +33,8 @@
 
 #include <deal.II/multigrid/mg_constrained_dofs.h>
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -311,6 +314,34 @@ namespace MatrixFreeOperators
     void
     vmult(VectorType &dst, const VectorType &src) const;
 
+    /**
+     * Matrix-vector multiplication which interleaves the operations
+     * @p operation_before_loop and @p operation_after_loop with the cell
+     * loop, passing subranges of locally owned degrees of freedom in
+     * MPI-local numbering to the two functions as described for
+     * MatrixFree::cell_loop(). This keeps the vector entries touched by
+     * those operations in caches close to the operator evaluation and is
+     * detected by PreconditionChebyshev to fuse its vector updates with the
+     * operator application, saving several sweeps over the vectors per
+     * smoothing step in bandwidth-bound computations. The treatment of
+     * constrained degrees of freedom, including the edge constraints
+     * appearing in the multigrid context, is folded into the subrange
+     * operations as well, rather than being applied in separate passes over
+     * the vectors.
+     *
+     * In contrast to the two-argument vmult() function, the entries of
+     * @p dst are not zeroed inside this function; instead,
+     * @p operation_before_loop is expected to initialize the entries of the
+     * subrange it is handed, as PreconditionChebyshev does.
+     */
+    void
+    vmult(VectorType       &dst,
+          const VectorType &src,
+          const std::function<void(const unsigned int, const unsigned int)>
+            &operation_before_loop,
+          const std::function<void(const unsigned int, const unsigned int)>
+            &operation_after_loop) const;
+
     /**
      * Transpose matrix-vector multiplication.
      */
@@ -420,6 +451,25 @@ namespace MatrixFreeOperators
     virtual void
     apply_add(VectorType &dst, const VectorType &src) const = 0;
 
+    /**
+     * Apply operator to @p src and add result in @p dst, calling
+     * @p operation_before_loop and @p operation_after_loop on subranges of
+     * locally owned degrees of freedom. The default implementation runs
+     * @p operation_before_loop on the whole locally owned range, then calls
+     * apply_add(), and finally runs @p operation_after_loop, which is
+     * correct but does not interleave the operations. Derived classes
+     * should override this function and pass the two functions on to
+     * MatrixFree::cell_loop() to obtain the cache benefits described in the
+     * documentation of the four-argument vmult() function.
+     */
+    virtual void
+    apply_add(VectorType       &dst,
+              const VectorType &src,
+              const std::function<void(const unsigned int, const unsigned int)>
+                &operation_before_loop,
+              const std::function<void(const unsigned int, const unsigned int)>
+                &operation_after_loop) const;
+
     /**
      * Apply transpose operator to @p src and add result in @p dst.
      *
@@ -824,6 +874,18 @@ namespace MatrixFreeOperators
     virtual void
     apply_add(VectorType &dst, const VectorType &src) const override;
 
+    /**
+     * Same as above, but interleaving the given operations with the cell
+     * loop as described in Base::vmult().
+     */
+    virtual void
+    apply_add(VectorType       &dst,
+              const VectorType &src,
+              const std::function<void(const unsigned int, const unsigned int)>
+                &operation_before_loop,
+              const std::function<void(const unsigned int, const unsigned int)>
+                &operation_after_loop) const override;
+
     /**
      * For this operator, there is just a cell contribution.
      */
@@ -974,6 +1036,18 @@ namespace MatrixFreeOperators
     virtual void
     apply_add(VectorType &dst, const VectorType &src) const override;
 
+    /**
+     * Same as above, but interleaving the given operations with the cell
+     * loop as described in Base::vmult().
+     */
+    virtual void
+    apply_add(VectorType       &dst,
+              const VectorType &src,
+              const std::function<void(const unsigned int, const unsigned int)>
+                &operation_before_loop,
+              const std::function<void(const unsigned int, const unsigned int)>
+                &operation_after_loop) const override;
+
     /**
      * Applies the Laplace operator on a cell.
      */
@@ -1007,6 +1081,24 @@ namespace MatrixFreeOperators
                                       VectorizedArrayType> &phi,
                          const unsigned int                 cell) const;
 
+    /**
+     * The quadrature-point part of do_operation_on_cell(), i.e., the loop
+     * between the evaluate and integrate steps. It is factored out so that
+     * local_apply_cell() can fuse the evaluate and integrate steps with the
+     * access to the global vectors via FEEvaluation::gather_evaluate() and
+     * FEEvaluation::integrate_scatter(), avoiding a separate sweep over the
+     * local data arrays.
+     */
+    template <int n_components_compute>
+    void
+    do_quadrature_point_operation(FEEvaluation<dim,
+                                               fe_degree,
+                                               n_q_points_1d,
+                                               n_components_compute,
+                                               value_type,
+                                               VectorizedArrayType> &phi,
+                                  const unsigned int cell) const;
+
     /**
      * User-provided heterogeneity coefficient.
      */
@@ -1015,6 +1107,136 @@ namespace MatrixFreeOperators
 
 
 
+  /**
+   * This class implements a matrix-free operator for block systems, such as
+   * the Stokes equations, that evaluates all blocks of the operator within
+   * one single loop through the mesh. Rather than implementing one operator
+   * per (non-empty) block of the system, each running its own cell loop and
+   * re-reading the mapping and index data of every cell batch, the
+   * contributions of all blocks are registered with this class as "cell
+   * integrators" against a common MatrixFree object. During vmult(), the
+   * registered integrators are invoked on each chunk of cell batches inside
+   * one and the same cell loop: the source and destination block vectors are
+   * then swept (and their ghost values exchanged) only once, and the data of
+   * a cell batch is reused by all integrators while it is resident in fast
+   * cache memory.
+   *
+   * A cell integrator is a function object with the same signature as the
+   * cell operation handed to MatrixFree::cell_loop() and typically evaluates
+   * one or several couplings between the blocks of the system. For a Stokes
+   * system, the velocity-velocity block and the velocity-pressure couplings
+   * could, for example, be registered by separate program modules:
+   * @code
+   * using BlockVectorType = LinearAlgebra::distributed::BlockVector<double>;
+   *
+   * MatrixFreeOperators::BlockOperator<dim, BlockVectorType> stokes_operator;
+   * stokes_operator.initialize(matrix_free);
+   *
+   * // viscous term, block (0,0)
+   * stokes_operator.add_cell_integrator(
+   *   [](const auto &data, auto &dst, const auto &src, const auto &range) {
+   *     FEEvaluation<dim, degree, degree + 1, dim> velocity(data, 0);
+   *     for (unsigned int cell = range.first; cell < range.second; ++cell)
+   *       {
+   *         velocity.reinit(cell);
+   *         velocity.gather_evaluate(src.block(0),
+   *                                  EvaluationFlags::gradients);
+   *         for (unsigned int q = 0; q < velocity.n_q_points; ++q)
+   *           velocity.submit_symmetric_gradient(
+   *             2. * velocity.get_symmetric_gradient(q), q);
+   *         velocity.integrate_scatter(EvaluationFlags::gradients,
+   *                                    dst.block(0));
+   *       }
+   *   });
+   *
+   * // pressure couplings, blocks (0,1) and (1,0), registered elsewhere
+   * stokes_operator.add_cell_integrator(...);
+   * @endcode
+   *
+   * The diagonal of such an operator cannot be deduced from the registered
+   * function objects, so compute_diagonal() is not implemented by this
+   * class; diagonals needed for preconditioning should be assembled by the
+   * individual blocks, for example with the
+   * MatrixFreeTools::compute_diagonal() function.
+   */
+  template <int dim,
+            typename BlockVectorType =
+              LinearAlgebra::distributed::BlockVector<double>,
+            typename VectorizedArrayType =
+              VectorizedArray<typename BlockVectorType::value_type>>
+  class BlockOperator : public Base<dim, BlockVectorType, VectorizedArrayType>
+  {
+  public:
+    /**
+     * Number alias.
+     */
+    using value_type =
+      typename Base<dim, BlockVectorType, VectorizedArrayType>::value_type;
+
+    /**
+     * size_type needed for preconditioner classes.
+     */
+    using size_type =
+      typename Base<dim, BlockVectorType, VectorizedArrayType>::size_type;
+
+    /**
+     * The type of function objects that can be registered with
+     * add_cell_integrator(). The signature coincides with the cell
+     * operation argument of MatrixFree::cell_loop().
+     */
+    using CellIntegrator = std::function<void(
+      const MatrixFree<dim, value_type, VectorizedArrayType> &,
+      BlockVectorType &,
+      const BlockVectorType &,
+      const std::pair<unsigned int, unsigned int> &)>;
+
+    /**
+     * Constructor.
+     */
+    BlockOperator();
+
+    /**
+     * Register an additional cell integrator that is invoked within the
+     * single cell loop of this operator. The integrators are invoked in the
+     * order in which they have been added; since all of them accumulate
+     * into the destination vector, the order does not affect the result.
+     */
+    void
+    add_cell_integrator(const CellIntegrator &integrator);
+
+    /**
+     * Not implemented for this class, see the class documentation.
+     */
+    virtual void
+    compute_diagonal() override;
+
+  private:
+    /**
+     * Applies all registered cell integrators to an input vector within a
+     * single cell loop. It is assumed that the passed input and output
+     * vector are correctly initialized using initialize_dof_vector().
+     */
+    virtual void
+    apply_add(BlockVectorType &dst, const BlockVectorType &src) const override;
+
+    /**
+     * Invoke the registered cell integrators on a range of cell batches.
+     */
+    void
+    local_apply_cell(
+      const MatrixFree<dim, value_type, VectorizedArrayType> &data,
+      BlockVectorType                                        &dst,
+      const BlockVectorType                                  &src,
+      const std::pair<unsigned int, unsigned int>            &cell_range) const;
+
+    /**
+     * The cell integrators registered through add_cell_integrator().
+     */
+    std::vector<CellIntegrator> cell_integrators;
+  };
+
+
+
   // ------------------------------------ inline functions ---------------------
 
   template <int dim,
@@ -1470,6 +1692,85 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim, typename VectorType, typename VectorizedArrayType>
+  void
+  Base<dim, VectorType, VectorizedArrayType>::vmult(
+    VectorType       &dst,
+    const VectorType &src,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_before_loop,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_after_loop) const
+  {
+    using Number =
+      typename Base<dim, VectorType, VectorizedArrayType>::value_type;
+    AssertDimension(dst.size(), src.size());
+    Assert(BlockHelper::n_blocks(dst) == 1, ExcNotImplemented());
+    adjust_ghost_range_if_necessary(src, false);
+    adjust_ghost_range_if_necessary(dst, true);
+
+    // set zero Dirichlet values on the input vector; the values are restored
+    // within the subrange operations below once all cells touching the
+    // respective entries have completed
+    for (unsigned int i = 0; i < edge_constrained_indices[0].size(); ++i)
+      {
+        edge_constrained_values[0][i] = std::pair<Number, Number>(
+          BlockHelper::subblock(src, 0).local_element(
+            edge_constrained_indices[0][i]),
+          0.);
+        BlockHelper::subblock(const_cast<VectorType &>(src), 0)
+          .local_element(edge_constrained_indices[0][i]) = 0.;
+      }
+
+    const std::vector<unsigned int> &constrained_dofs =
+      data->get_constrained_dofs(selected_rows[0]);
+
+    const std::function<void(const unsigned int, const unsigned int)>
+      operation_after_loop_with_constraints =
+        [&](const unsigned int start_range, const unsigned int end_range) {
+          // turn the rows of constrained degrees of freedom within the
+          // present subrange into rows of the identity matrix before they
+          // are consumed by operation_after_loop; this mirrors what
+          // postprocess_constraints() does in separate sweeps for the
+          // two-argument vmult() function
+          auto next_constrained = std::lower_bound(constrained_dofs.begin(),
+                                                   constrained_dofs.end(),
+                                                   start_range);
+          for (; next_constrained != constrained_dofs.end() &&
+                 *next_constrained < end_range;
+               ++next_constrained)
+            BlockHelper::subblock(dst, 0).local_element(*next_constrained) +=
+              BlockHelper::subblock(src, 0).local_element(*next_constrained);
+
+          auto next_edge_constrained =
+            std::lower_bound(edge_constrained_indices[0].begin(),
+                             edge_constrained_indices[0].end(),
+                             start_range);
+          for (; next_edge_constrained != edge_constrained_indices[0].end() &&
+                 *next_edge_constrained < end_range;
+               ++next_edge_constrained)
+            {
+              const unsigned int i =
+                next_edge_constrained - edge_constrained_indices[0].begin();
+              BlockHelper::subblock(const_cast<VectorType &>(src), 0)
+                .local_element(*next_edge_constrained) =
+                edge_constrained_values[0][i].first;
+              BlockHelper::subblock(dst, 0).local_element(
+                *next_edge_constrained) = edge_constrained_values[0][i].first;
+            }
+
+          if (operation_after_loop)
+            operation_after_loop(start_range, end_range);
+        };
+
+    apply_add(dst,
+              src,
+              operation_before_loop,
+              operation_after_loop_with_constraints);
+  }
+
+
+
   template <int dim, typename VectorType, typename VectorizedArrayType>
   void
   Base<dim, VectorType, VectorizedArrayType>::vmult_add(
@@ -1785,6 +2086,29 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim, typename VectorType, typename VectorizedArrayType>
+  void
+  Base<dim, VectorType, VectorizedArrayType>::apply_add(
+    VectorType       &dst,
+    const VectorType &src,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_before_loop,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_after_loop) const
+  {
+    // fallback without interleaving: run the pre- and post-operations on the
+    // whole locally owned range around the operator application
+    if (operation_before_loop)
+      operation_before_loop(
+        0, BlockHelper::subblock(dst, 0).locally_owned_size());
+    apply_add(dst, src);
+    if (operation_after_loop)
+      operation_after_loop(0,
+                           BlockHelper::subblock(dst, 0).locally_owned_size());
+  }
+
+
+
   template <int dim, typename VectorType, typename VectorizedArrayType>
   void
   Base<dim, VectorType, VectorizedArrayType>::precondition_Jacobi(
@@ -2112,6 +2436,38 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  void
+  MassOperator<dim,
+               fe_degree,
+               n_q_points_1d,
+               n_components,
+               VectorType,
+               VectorizedArrayType>::
+    apply_add(VectorType       &dst,
+              const VectorType &src,
+              const std::function<void(const unsigned int, const unsigned int)>
+                &operation_before_loop,
+              const std::function<void(const unsigned int, const unsigned int)>
+                &operation_after_loop) const
+  {
+    Base<dim, VectorType, VectorizedArrayType>::data->cell_loop(
+      &MassOperator::local_apply_cell,
+      this,
+      dst,
+      src,
+      operation_before_loop,
+      operation_after_loop,
+      this->selected_rows[0]);
+  }
+
+
+
   template <int dim,
             int fe_degree,
             int n_q_points_1d,
@@ -2146,12 +2502,12 @@ namespace MatrixFreeOperators
     for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
       {
         phi.reinit(cell);
-        phi.read_dof_values(src);
-        phi.evaluate(EvaluationFlags::values);
+        // fuse the evaluate and integrate steps with the vector access to
+        // avoid a separate sweep over the local data arrays
+        phi.gather_evaluate(src, EvaluationFlags::values);
         for (unsigned int q = 0; q < phi.n_q_points; ++q)
           phi.submit_value(phi.get_value(q), q);
-        phi.integrate(EvaluationFlags::values);
-        phi.distribute_local_to_global(dst);
+        phi.integrate_scatter(EvaluationFlags::values, dst);
       }
   }
 
@@ -2305,6 +2661,38 @@ namespace MatrixFreeOperators
       &LaplaceOperator::local_apply_cell, this, dst, src);
   }
 
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  void
+  LaplaceOperator<dim,
+                  fe_degree,
+                  n_q_points_1d,
+                  n_components,
+                  VectorType,
+                  VectorizedArrayType>::
+    apply_add(VectorType       &dst,
+              const VectorType &src,
+              const std::function<void(const unsigned int, const unsigned int)>
+                &operation_before_loop,
+              const std::function<void(const unsigned int, const unsigned int)>
+                &operation_after_loop) const
+  {
+    Base<dim, VectorType, VectorizedArrayType>::data->cell_loop(
+      &LaplaceOperator::local_apply_cell,
+      this,
+      dst,
+      src,
+      operation_before_loop,
+      operation_after_loop,
+      this->selected_rows[0]);
+  }
+
   namespace Implementation
   {
     template <typename VectorizedArrayType>
@@ -2346,6 +2734,36 @@ namespace MatrixFreeOperators
       const unsigned int      cell) const
   {
     phi.evaluate(EvaluationFlags::gradients);
+    do_quadrature_point_operation(phi, cell);
+    phi.integrate(EvaluationFlags::gradients);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  template <int n_components_compute>
+  void
+  LaplaceOperator<dim,
+                  fe_degree,
+                  n_q_points_1d,
+                  n_components,
+                  VectorType,
+                  VectorizedArrayType>::
+    do_quadrature_point_operation(
+      FEEvaluation<
+        dim,
+        fe_degree,
+        n_q_points_1d,
+        n_components_compute,
+        typename Base<dim, VectorType, VectorizedArrayType>::value_type,
+        VectorizedArrayType> &phi,
+      const unsigned int      cell) const
+  {
     if (scalar_coefficient.get())
       {
         Assert(scalar_coefficient->size(1) == 1 ||
@@ -2382,7 +2800,6 @@ namespace MatrixFreeOperators
             phi.submit_gradient(phi.get_gradient(q), q);
           }
       }
-    phi.integrate(EvaluationFlags::gradients);
   }
 
 
@@ -2421,9 +2838,11 @@ namespace MatrixFreeOperators
     for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
       {
         phi.reinit(cell);
-        phi.read_dof_values(src);
-        do_operation_on_cell(phi, cell);
-        phi.distribute_local_to_global(dst);
+        // fuse the evaluate and integrate steps with the vector access to
+        // avoid a separate sweep over the local data arrays
+        phi.gather_evaluate(src, EvaluationFlags::gradients);
+        do_quadrature_point_operation(phi, cell);
+        phi.integrate_scatter(EvaluationFlags::gradients, dst);
       }
   }
 
@@ -2492,6 +2911,69 @@ namespace MatrixFreeOperators
   }
 
 
+
+  //------------------------- BlockOperator ----------------------------------
+
+  template <int dim, typename BlockVectorType, typename VectorizedArrayType>
+  BlockOperator<dim, BlockVectorType, VectorizedArrayType>::BlockOperator()
+    : Base<dim, BlockVectorType, VectorizedArrayType>()
+  {}
+
+
+
+  template <int dim, typename BlockVectorType, typename VectorizedArrayType>
+  void
+  BlockOperator<dim, BlockVectorType, VectorizedArrayType>::
+    add_cell_integrator(const CellIntegrator &integrator)
+  {
+    Assert(integrator,
+           ExcMessage("The given cell integrator must not be an empty "
+                      "function object."));
+    cell_integrators.push_back(integrator);
+  }
+
+
+
+  template <int dim, typename BlockVectorType, typename VectorizedArrayType>
+  void
+  BlockOperator<dim, BlockVectorType, VectorizedArrayType>::compute_diagonal()
+  {
+    DEAL_II_NOT_IMPLEMENTED();
+  }
+
+
+
+  template <int dim, typename BlockVectorType, typename VectorizedArrayType>
+  void
+  BlockOperator<dim, BlockVectorType, VectorizedArrayType>::apply_add(
+    BlockVectorType       &dst,
+    const BlockVectorType &src) const
+  {
+    Assert(cell_integrators.size() > 0,
+           ExcMessage("No cell integrators have been registered through "
+                      "add_cell_integrator()."));
+    Base<dim, BlockVectorType, VectorizedArrayType>::data->cell_loop(
+      &BlockOperator::local_apply_cell, this, dst, src);
+  }
+
+
+
+  template <int dim, typename BlockVectorType, typename VectorizedArrayType>
+  void
+  BlockOperator<dim, BlockVectorType, VectorizedArrayType>::local_apply_cell(
+    const MatrixFree<dim, value_type, VectorizedArrayType> &data,
+    BlockVectorType                                        &dst,
+    const BlockVectorType                                  &src,
+    const std::pair<unsigned int, unsigned int>            &cell_range) const
+  {
+    // invoke all integrators on the same chunk of cell batches, so that
+    // each integrator finds the mapping and index data of these batches in
+    // cache
+    for (const auto &integrator : cell_integrators)
+      integrator(data, dst, src, cell_range);
+  }
+
+
 } // end of namespace MatrixFreeOperators
 
 
@@ -271,6 +271,33 @@ namespace Portable
   {
     static_assert(n_components_ == 1, "This function only supports FE with one \
                   components");
+    if (data->use_general_constraints)
+      {
+        // Resolve the full constraint rows through the compressed table: an
+        // empty row denotes an unconstrained dof, which is read directly.
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(shared_data->team_member, n_q_points),
+          [&](const int &i) {
+            const unsigned int row_begin =
+              data->constraint_row_starts(cell_id, i);
+            const unsigned int row_end =
+              data->constraint_row_starts(cell_id, i + 1);
+            if (row_begin == row_end)
+              shared_data->values(i) = src[data->local_to_global(cell_id, i)];
+            else
+              {
+                Number value = 0.;
+                for (unsigned int j = row_begin; j < row_end; ++j)
+                  value += data->constraint_entry_weights(j) *
+                           src[data->constraint_columns(j)];
+                shared_data->values(i) = value;
+              }
+          });
+        shared_data->team_member.team_barrier();
+
+        return;
+      }
+
     // Populate the scratch memory
     Kokkos::parallel_for(Kokkos::TeamThreadRange(shared_data->team_member,
                                                  n_q_points),
@@ -301,6 +328,33 @@ namespace Portable
     static_assert(n_components_ == 1, "This function only supports FE with one \
                   components");
 
+    if (data->use_general_constraints)
+      {
+        // Apply the transpose of the constraint rows: unconstrained dofs add
+        // into their own vector entry, constrained dofs scatter their value
+        // into the constraining columns. Even with coloring, a constrained
+        // dof may scatter into a column that another thread of the same team
+        // writes to, so atomics are used unconditionally here.
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(shared_data->team_member, n_q_points),
+          [&](const int &i) {
+            const unsigned int row_begin =
+              data->constraint_row_starts(cell_id, i);
+            const unsigned int row_end =
+              data->constraint_row_starts(cell_id, i + 1);
+            if (row_begin == row_end)
+              Kokkos::atomic_add(&dst[data->local_to_global(cell_id, i)],
+                                 shared_data->values(i));
+            else
+              for (unsigned int j = row_begin; j < row_end; ++j)
+                Kokkos::atomic_add(&dst[data->constraint_columns(j)],
+                                   data->constraint_entry_weights(j) *
+                                     shared_data->values(i));
+          });
+
+        return;
+      }
+
     internal::resolve_hanging_nodes<dim, fe_degree, true>(
       shared_data->team_member,
       data->constraint_weights,
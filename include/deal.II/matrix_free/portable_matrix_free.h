@@ -111,10 +111,12 @@ namespace Portable
                        update_gradients | update_JxW_values |
                        update_quadrature_points,
                      const bool use_coloring                      = false,
-                     const bool overlap_communication_computation = false)
+                     const bool overlap_communication_computation = false,
+                     const bool use_general_constraints           = false)
         : mapping_update_flags(mapping_update_flags)
         , use_coloring(use_coloring)
         , overlap_communication_computation(overlap_communication_computation)
+        , use_general_constraints(use_general_constraints)
       {
 #ifndef DEAL_II_MPI_WITH_DEVICE_SUPPORT
         AssertThrow(
@@ -151,6 +153,22 @@ namespace Portable
        * MPI and use_coloring must be false.
        */
       bool overlap_communication_computation;
+
+      /**
+       * If true, the whole AffineConstraints object passed to reinit() --
+       * including chained and inhomogeneous constraints -- is resolved on
+       * the device through a compressed constraint table applied during
+       * FEEvaluation::read_dof_values() and
+       * FEEvaluation::distribute_local_to_global(), instead of only the
+       * hanging-node subface interpolations. This requires the
+       * AffineConstraints object to contain the hanging-node constraints of
+       * the mesh (the usual situation), since the mask-based hanging-node
+       * resolution is bypassed in this mode. Inhomogeneities are not applied
+       * during the cell loop, which computes the homogeneous operator
+       * action; they can be applied in device memory through
+       * distribute_constraints().
+       */
+      bool use_general_constraints;
     };
 
     /**
@@ -213,6 +231,32 @@ namespace Portable
       Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
         constraint_weights;
 
+      /**
+       * Row pointers into the compressed constraint table. Entry (cell, i)
+       * denotes the first entry in constraint_columns and
+       * constraint_entry_weights belonging to the i-th local degree of
+       * freedom of the given cell; an empty row means that the degree of
+       * freedom is unconstrained. Only allocated when
+       * AdditionalData::use_general_constraints is set.
+       */
+      Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>
+        constraint_row_starts;
+
+      /**
+       * Column indices (in the local numbering of the vectors used in the
+       * cell loop) of the compressed constraint table.
+       */
+      Kokkos::View<types::global_dof_index *,
+                   MemorySpace::Default::kokkos_space>
+        constraint_columns;
+
+      /**
+       * Weights of the compressed constraint table, one for each entry of
+       * constraint_columns.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+        constraint_entry_weights;
+
       /**
        * Number of cells.
        */
@@ -234,6 +278,14 @@ namespace Portable
        */
       bool use_coloring;
 
+      /**
+       * If true, the compressed constraint table above is applied in
+       * FEEvaluation::read_dof_values() and
+       * FEEvaluation::distribute_local_to_global() instead of the mask-based
+       * hanging-node resolution.
+       */
+      bool use_general_constraints;
+
       /**
        * Return the quadrature point index local. The index is
        * only unique for a given MPI process.
@@ -375,6 +427,21 @@ namespace Portable
     void
     set_constrained_values(const Number val, VectorType &dst) const;
 
+    /**
+     * Set the constrained entries of @p vec to the value implied by their
+     * constraint rows, i.e., perform the operation of
+     * AffineConstraints::distribute() entirely in device memory, including
+     * inhomogeneities. This function is only available if
+     * AdditionalData::use_general_constraints was set when calling reinit().
+     *
+     * For distributed vectors, the required ghost values are imported by this
+     * function and the ghost entries are zeroed out again afterwards.
+     */
+    void
+    distribute_constraints(
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> &vec)
+      const;
+
 #ifdef DEAL_II_WITH_CUDA
     /**
      * Initialize a serial vector. The size corresponds to the number of degrees
@@ -495,6 +562,12 @@ namespace Portable
      */
     bool overlap_communication_computation;
 
+    /**
+     * If true, resolve the whole AffineConstraints object on the device
+     * through the compressed constraint table.
+     */
+    bool use_general_constraints;
+
     /**
      * Total number of degrees of freedom.
      */
@@ -574,6 +647,57 @@ namespace Portable
                    MemorySpace::Default::kokkos_space>>
       constraint_mask;
 
+    /**
+     * Row pointers of the per-cell compressed constraint table, one
+     * Kokkos::View per color. Only allocated when use_general_constraints is
+     * set.
+     */
+    std::vector<Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>>
+      constraint_row_starts;
+
+    /**
+     * Column indices of the per-cell compressed constraint table, one
+     * Kokkos::View per color.
+     */
+    std::vector<Kokkos::View<types::global_dof_index *,
+                             MemorySpace::Default::kokkos_space>>
+      constraint_columns;
+
+    /**
+     * Weights of the per-cell compressed constraint table, one Kokkos::View
+     * per color.
+     */
+    std::vector<Kokkos::View<Number *, MemorySpace::Default::kokkos_space>>
+      constraint_entry_weights;
+
+    /**
+     * Row pointers of the constraint rows of all constrained degrees of
+     * freedom, ordered like constrained_dofs. Used by
+     * distribute_constraints().
+     */
+    Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+      distribute_row_starts;
+
+    /**
+     * Column indices (in the local numbering) of the constraint rows used by
+     * distribute_constraints().
+     */
+    Kokkos::View<types::global_dof_index *, MemorySpace::Default::kokkos_space>
+      distribute_columns;
+
+    /**
+     * Weights of the constraint rows used by distribute_constraints().
+     */
+    Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+      distribute_weights;
+
+    /**
+     * Inhomogeneities of the constraint rows used by
+     * distribute_constraints().
+     */
+    Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+      distribute_inhomogeneities;
+
     /**
      * Values of the shape functions.
      */
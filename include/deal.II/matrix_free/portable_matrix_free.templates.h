@@ -59,9 +59,10 @@ namespace Portable
         const FiniteElement<dim, dim> &fe,
         const Quadrature<1>           &quad,
         const ::dealii::internal::MatrixFreeFunctions::ShapeInfo<Number>
-                              &shape_info,
-        const DoFHandler<dim> &dof_handler,
-        const UpdateFlags     &update_flags);
+                                        &shape_info,
+        const DoFHandler<dim>           &dof_handler,
+        const AffineConstraints<Number> &constraints,
+        const UpdateFlags               &update_flags);
 
       void
       resize(const unsigned int n_colors);
@@ -75,12 +76,16 @@ namespace Portable
 
     private:
       MatrixFree<dim, Number> *data;
+      // The constraints to resolve on the device when general constraint
+      // resolution has been requested
+      const AffineConstraints<Number> &constraints;
       // Local buffer
       std::vector<types::global_dof_index> local_dof_indices;
       FEValues<dim>                        fe_values;
       // Convert the default dof numbering to a lexicographic one
       const std::vector<unsigned int>     &lexicographic_inv;
       std::vector<types::global_dof_index> lexicographic_dof_indices;
+      std::vector<types::global_dof_index> lexicographic_global_dof_indices;
       const unsigned int                   fe_degree;
       const unsigned int                   dofs_per_cell;
       const unsigned int                   q_points_per_cell;
@@ -98,10 +103,12 @@ namespace Portable
       const FiniteElement<dim> &fe,
       const Quadrature<1>      &quad,
       const ::dealii::internal::MatrixFreeFunctions::ShapeInfo<Number>
-                            &shape_info,
-      const DoFHandler<dim> &dof_handler,
-      const UpdateFlags     &update_flags)
+                                      &shape_info,
+      const DoFHandler<dim>           &dof_handler,
+      const AffineConstraints<Number> &constraints,
+      const UpdateFlags               &update_flags)
       : data(data)
+      , constraints(constraints)
       , fe_values(mapping,
                   fe,
                   Quadrature<dim>(quad),
@@ -117,6 +124,8 @@ namespace Portable
     {
       local_dof_indices.resize(data->dofs_per_cell);
       lexicographic_dof_indices.resize(dofs_per_cell);
+      if (data->use_general_constraints)
+        lexicographic_global_dof_indices.resize(dofs_per_cell);
       fe_values.always_allow_check_for_cell_similarity(true);
     }
 
@@ -132,6 +141,13 @@ namespace Portable
       data->local_to_global.resize(n_colors);
       data->constraint_mask.resize(n_colors);
 
+      if (data->use_general_constraints)
+        {
+          data->constraint_row_starts.resize(n_colors);
+          data->constraint_columns.resize(n_colors);
+          data->constraint_entry_weights.resize(n_colors);
+        }
+
       data->row_start.resize(n_colors);
 
       if (update_flags & update_quadrature_points)
@@ -200,6 +216,25 @@ namespace Portable
       auto constraint_mask_host =
         Kokkos::create_mirror_view(data->constraint_mask[color]);
 
+      // Compressed constraint table, built up while looping over the cells
+      typename Kokkos::View<unsigned int **,
+                            MemorySpace::Default::kokkos_space>::HostMirror
+                                           constraint_row_starts_host;
+      std::vector<types::global_dof_index> constraint_columns_host;
+      std::vector<Number>                  constraint_entry_weights_host;
+      if (data->use_general_constraints)
+        {
+          data->constraint_row_starts[color] =
+            Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>(
+              Kokkos::view_alloc("constraint_row_starts_" +
+                                   std::to_string(color),
+                                 Kokkos::WithoutInitializing),
+              n_cells,
+              dofs_per_cell + 1);
+          constraint_row_starts_host =
+            Kokkos::create_mirror_view(data->constraint_row_starts[color]);
+        }
+
       typename std::remove_reference_t<
         decltype(data->q_points[color])>::HostMirror q_points_host;
       typename std::remove_reference_t<decltype(data->JxW[color])>::HostMirror
@@ -236,6 +271,13 @@ namespace Portable
       for (unsigned int cell_id = 0; cell != end_cell; ++cell, ++cell_id)
         {
           (*cell)->get_dof_indices(local_dof_indices);
+          // Remember the global dof indices in lexicographic ordering: the
+          // AffineConstraints object is queried with global numbers.
+          if (data->use_general_constraints)
+            for (unsigned int i = 0; i < dofs_per_cell; ++i)
+              lexicographic_global_dof_indices[i] =
+                local_dof_indices[lexicographic_inv[i]];
+
           // When using MPI, we need to transform the local_dof_indices, which
           // contain global numbers of dof indices in the MPI universe, to get
           // local (to the current MPI process) dof indices.
@@ -247,15 +289,58 @@ namespace Portable
             lexicographic_dof_indices[i] =
               local_dof_indices[lexicographic_inv[i]];
 
-          const ArrayView<
-            dealii::internal::MatrixFreeFunctions::ConstraintKinds>
-            cell_id_view(constraint_mask_host[cell_id]);
-
-          hanging_nodes.setup_constraints(*cell,
-                                          partitioner,
-                                          {lexicographic_inv},
-                                          lexicographic_dof_indices,
-                                          cell_id_view);
+          if (data->use_general_constraints)
+            {
+              // Append the constraint rows of this cell to the compressed
+              // table. The constraint_mask stays unconstrained since the
+              // mask-based hanging-node resolution is bypassed in this mode.
+              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                {
+                  constraint_row_starts_host(cell_id, i) =
+                    constraint_columns_host.size();
+                  const types::global_dof_index global_dof =
+                    lexicographic_global_dof_indices[i];
+                  if (constraints.is_constrained(global_dof))
+                    {
+                      const auto *entries =
+                        constraints.get_constraint_entries(global_dof);
+                      if (entries != nullptr && entries->size() > 0)
+                        for (const auto &entry : *entries)
+                          {
+                            constraint_columns_host.push_back(
+                              partitioner ?
+                                partitioner->global_to_local(entry.first) :
+                                entry.first);
+                            constraint_entry_weights_host.push_back(
+                              entry.second);
+                          }
+                      else
+                        {
+                          // A constraint without entries (e.g. a Dirichlet
+                          // boundary dof): record a single zero-weight entry
+                          // so that the row is non-empty and the dof reads
+                          // as zero instead of its vector entry.
+                          constraint_columns_host.push_back(
+                            lexicographic_dof_indices[i]);
+                          constraint_entry_weights_host.push_back(Number());
+                        }
+                    }
+                }
+              constraint_row_starts_host(cell_id, dofs_per_cell) =
+                constraint_columns_host.size();
+            }
+          else
+            {
+              const ArrayView<
+                dealii::internal::MatrixFreeFunctions::ConstraintKinds>
+                cell_id_view(constraint_mask_host[cell_id]);
+
+              hanging_nodes.setup_constraints(*cell,
+                                              partitioner,
+                                              {lexicographic_inv},
+                                              lexicographic_dof_indices,
+                                              cell_id_view);
+            }
 
           for (unsigned int i = 0; i < dofs_per_cell; ++i)
             local_to_global_host(cell_id, i) = lexicographic_dof_indices[i];
@@ -288,6 +373,41 @@ namespace Portable
       // Copy the data to the device
       Kokkos::deep_copy(data->constraint_mask[color], constraint_mask_host);
       Kokkos::deep_copy(data->local_to_global[color], local_to_global_host);
+      if (data->use_general_constraints)
+        {
+          Kokkos::deep_copy(data->constraint_row_starts[color],
+                            constraint_row_starts_host);
+
+          data->constraint_columns[color] =
+            Kokkos::View<types::global_dof_index *,
+                         MemorySpace::Default::kokkos_space>(
+              Kokkos::view_alloc("constraint_columns_" + std::to_string(color),
+                                 Kokkos::WithoutInitializing),
+              constraint_columns_host.size());
+          data->constraint_entry_weights[color] =
+            Kokkos::View<Number *, MemorySpace::Default::kokkos_space>(
+              Kokkos::view_alloc("constraint_entry_weights_" +
+                                   std::to_string(color),
+                                 Kokkos::WithoutInitializing),
+              constraint_entry_weights_host.size());
+          if (constraint_columns_host.size() > 0)
+            {
+              Kokkos::deep_copy(
+                data->constraint_columns[color],
+                Kokkos::View<types::global_dof_index *,
+                             Kokkos::HostSpace,
+                             Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+                  constraint_columns_host.data(),
+                  constraint_columns_host.size()));
+              Kokkos::deep_copy(
+                data->constraint_entry_weights[color],
+                Kokkos::View<Number *,
+                             Kokkos::HostSpace,
+                             Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+                  constraint_entry_weights_host.data(),
+                  constraint_entry_weights_host.size()));
+            }
+        }
       if (update_flags & update_quadrature_points)
         Kokkos::deep_copy(data->q_points[color], q_points_host);
       if (update_flags & update_JxW_values)
@@ -410,6 +530,7 @@ namespace Portable
   template <int dim, typename Number>
   MatrixFree<dim, Number>::MatrixFree()
     : my_id(-1)
+    , use_general_constraints(false)
     , n_dofs(0)
     , padding_length(0)
     , dof_handler(nullptr)
@@ -503,10 +624,17 @@ namespace Portable
     data_copy.shape_gradients    = shape_gradients;
     data_copy.co_shape_gradients = co_shape_gradients;
     data_copy.constraint_weights = constraint_weights;
-    data_copy.n_cells            = n_cells[color];
-    data_copy.padding_length     = padding_length;
-    data_copy.row_start          = row_start[color];
-    data_copy.use_coloring       = use_coloring;
+    if (use_general_constraints)
+      {
+        data_copy.constraint_row_starts   = constraint_row_starts[color];
+        data_copy.constraint_columns      = constraint_columns[color];
+        data_copy.constraint_entry_weights = constraint_entry_weights[color];
+      }
+    data_copy.n_cells                 = n_cells[color];
+    data_copy.padding_length          = padding_length;
+    data_copy.row_start               = row_start[color];
+    data_copy.use_coloring            = use_coloring;
+    data_copy.use_general_constraints = use_general_constraints;
 
     return data_copy;
   }
@@ -698,6 +826,7 @@ namespace Portable
     this->use_coloring = additional_data.use_coloring;
     this->overlap_communication_computation =
       additional_data.overlap_communication_computation;
+    this->use_general_constraints = additional_data.use_general_constraints;
 
     n_dofs = dof_handler->n_dofs();
 
@@ -756,8 +885,14 @@ namespace Portable
             n_q_points_1d * n_q_points_1d));
       }
 
-    internal::ReinitHelper<dim, Number> helper(
-      this, mapping, fe, quad, shape_info, *dof_handler, update_flags);
+    internal::ReinitHelper<dim, Number> helper(this,
+                                               mapping,
+                                               fe,
+                                               quad,
+                                               shape_info,
+                                               *dof_handler,
+                                               constraints,
+                                               update_flags);
 
     const unsigned int constraint_weights_size =
       shape_info.data.front().subface_interpolation_matrices[0].size();
@@ -920,11 +1055,148 @@ namespace Portable
           constrained_dofs_host_view(constrained_dofs_host.data(),
                                      constrained_dofs_host.size());
         Kokkos::deep_copy(constrained_dofs, constrained_dofs_host_view);
+
+        if (use_general_constraints)
+          {
+            // Build the constraint rows of all constrained dofs, ordered
+            // like constrained_dofs, for distribute_constraints().
+            std::vector<unsigned int> row_starts_host(n_constrained_dofs + 1);
+            std::vector<types::global_dof_index> columns_host;
+            std::vector<Number>                  weights_host;
+            std::vector<Number> inhomogeneities_host(n_constrained_dofs);
+
+            for (unsigned int i = 0; i < n_constrained_dofs; ++i)
+              {
+                row_starts_host[i] = columns_host.size();
+                const types::global_dof_index global_dof =
+                  partitioner ?
+                    partitioner->local_to_global(constrained_dofs_host[i]) :
+                    constrained_dofs_host[i];
+                inhomogeneities_host[i] =
+                  constraints.get_inhomogeneity(global_dof);
+                const auto *entries =
+                  constraints.get_constraint_entries(global_dof);
+                if (entries != nullptr)
+                  for (const auto &entry : *entries)
+                    {
+                      columns_host.push_back(
+                        partitioner ?
+                          partitioner->global_to_local(entry.first) :
+                          entry.first);
+                      weights_host.push_back(entry.second);
+                    }
+              }
+            row_starts_host[n_constrained_dofs] = columns_host.size();
+
+            distribute_row_starts =
+              Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>(
+                Kokkos::view_alloc("distribute_row_starts",
+                                   Kokkos::WithoutInitializing),
+                row_starts_host.size());
+            Kokkos::deep_copy(
+              distribute_row_starts,
+              Kokkos::View<unsigned int *,
+                           Kokkos::HostSpace,
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+                row_starts_host.data(), row_starts_host.size()));
+
+            distribute_inhomogeneities =
+              Kokkos::View<Number *, MemorySpace::Default::kokkos_space>(
+                Kokkos::view_alloc("distribute_inhomogeneities",
+                                   Kokkos::WithoutInitializing),
+                inhomogeneities_host.size());
+            Kokkos::deep_copy(
+              distribute_inhomogeneities,
+              Kokkos::View<Number *,
+                           Kokkos::HostSpace,
+                           Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+                inhomogeneities_host.data(), inhomogeneities_host.size()));
+
+            distribute_columns =
+              Kokkos::View<types::global_dof_index *,
+                           MemorySpace::Default::kokkos_space>(
+                Kokkos::view_alloc("distribute_columns",
+                                   Kokkos::WithoutInitializing),
+                columns_host.size());
+            distribute_weights =
+              Kokkos::View<Number *, MemorySpace::Default::kokkos_space>(
+                Kokkos::view_alloc("distribute_weights",
+                                   Kokkos::WithoutInitializing),
+                weights_host.size());
+            if (columns_host.size() > 0)
+              {
+                Kokkos::deep_copy(
+                  distribute_columns,
+                  Kokkos::View<types::global_dof_index *,
+                               Kokkos::HostSpace,
+                               Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+                    columns_host.data(), columns_host.size()));
+                Kokkos::deep_copy(
+                  distribute_weights,
+                  Kokkos::View<Number *,
+                               Kokkos::HostSpace,
+                               Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+                    weights_host.data(), weights_host.size()));
+              }
+          }
       }
   }
 
 
 
+  template <int dim, typename Number>
+  void
+  MatrixFree<dim, Number>::distribute_constraints(
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> &vec) const
+  {
+    Assert(use_general_constraints,
+           ExcMessage(
+             "distribute_constraints() requires "
+             "AdditionalData::use_general_constraints to be set in reinit()."));
+
+    if (n_constrained_dofs == 0)
+      return;
+
+    // The constraint columns may refer to ghost entries, so make sure those
+    // hold their correct values. The columns themselves are unconstrained
+    // dofs, hence there is no conflict with the entries written below.
+    if (partitioner)
+      vec.update_ghost_values();
+
+    // FIXME When using C++17, we can use KOKKOS_CLASS_LAMBDA and this
+    // work-around can be removed.
+    auto               constr_dofs     = constrained_dofs;
+    auto               row_starts      = distribute_row_starts;
+    auto               columns         = distribute_columns;
+    auto               weights         = distribute_weights;
+    auto               inhomogeneities = distribute_inhomogeneities;
+    const unsigned int size =
+      partitioner ? vec.locally_owned_size() : vec.size();
+    Number *vec_ptr = vec.get_values();
+    Kokkos::parallel_for(
+      "dealii::distribute_constraints",
+      Kokkos::RangePolicy<MemorySpace::Default::kokkos_space::execution_space>(
+        0, n_constrained_dofs),
+      KOKKOS_LAMBDA(int dof) {
+        // Only set the locally owned constrained entries; the ghosted ones
+        // are owned (and set) by other processes.
+        const auto constrained_dof = constr_dofs[dof];
+        if (constrained_dof < size)
+          {
+            Number value = inhomogeneities[dof];
+            for (unsigned int j = row_starts[dof]; j < row_starts[dof + 1];
+                 ++j)
+              value += weights[j] * vec_ptr[columns[j]];
+            vec_ptr[constrained_dof] = value;
+          }
+      });
+
+    if (partitioner)
+      vec.zero_out_ghost_values();
+  }
+
+
+
   template <int dim, typename Number>
   template <typename Functor, typename VectorType>
   void
@@ -188,6 +188,17 @@ namespace internal
       bool
       check_shapes_collocation() const;
 
+      /**
+       * Return whether the even-odd matrix shape_gradients_collocation_eo
+       * has been set up for the present combination of element and
+       * quadrature formula. This is the prerequisite for the evaluation
+       * kernels that compute derivatives directly in the collocation space
+       * spanned by the quadrature points, without a transposition of the
+       * data to the original polynomial basis.
+       */
+      bool
+      has_collocation_gradients() const;
+
       /**
        * Encodes the type of element detected at construction. FEEvaluation
        * will select the most efficient algorithm based on the given element
@@ -628,6 +639,16 @@ namespace internal
 
     // ------------------------------------------ inline functions
 
+    template <typename Number>
+    inline bool
+    UnivariateShapeData<Number>::has_collocation_gradients() const
+    {
+      return shape_gradients_collocation_eo.size() ==
+             static_cast<std::size_t>((n_q_points_1d + 1) / 2) * n_q_points_1d;
+    }
+
+
+
     template <typename Number>
     inline const UnivariateShapeData<Number> &
     ShapeInfo<Number>::get_shape_data(const unsigned int dimension,
@@ -1022,7 +1022,14 @@ namespace internal
             return false;
 
       // shape values should be zero at x=0.5 for all basis functions except
-      // for the middle one for degrees of 4 and higher
+      // for the middle one for degrees of 4 and higher: the even-odd kernels
+      // skip the contributions between the middle basis function and the
+      // middle quadrature point in this case, see the mm > 3 conditions in
+      // the evaluate_evenodd variant of apply_matrix_vector_product(). This
+      // property holds for Lagrange bases in symmetric points, but excludes
+      // bases that are merely symmetric under reflection, such as the
+      // Bernstein basis of even degree, which then uses the general
+      // sum-factorization kernels instead
       if (n_dofs_1d > 3 && n_q_points_1d % 2 == 1 && n_dofs_1d % 2 == 1)
         {
           for (unsigned int i = 0; i < n_dofs_1d / 2; ++i)
@@ -1875,12 +1875,6 @@ namespace internal
            const int  subface_index_1d = 0)
     {
       AssertIndexRange(direction, dim);
-      AssertDimension(fe_degree, data.fe_degree);
-      AssertDimension(n_q_points_1d, data.n_q_points_1d);
-      constexpr int  n_rows    = fe_degree + 1;
-      constexpr int  n_columns = n_q_points_1d;
-      constexpr int  mm        = contract_over_rows ? n_rows : n_columns;
-      constexpr int  nn        = contract_over_rows ? n_columns : n_rows;
       const Number2 *shape_data =
         symmetric_evaluate ?
           data.shape_values_eo.data() :
@@ -1889,41 +1883,102 @@ namespace internal
       Assert(contract_over_rows == false || !add_into_result,
              ExcMessage("Cannot add into result if contract_over_rows = true"));
 
-      constexpr int n_blocks1  = Utilities::pow(fe_degree, direction);
-      constexpr int n_blocks2  = Utilities::pow(fe_degree, dim - direction - 1);
-      constexpr int stride_in  = contract_over_rows ? 1 : stride;
-      constexpr int stride_out = contract_over_rows ? stride : 1;
       constexpr EvaluatorVariant variant =
         symmetric_evaluate ? evaluate_evenodd : evaluate_general;
 
-      for (int i2 = 0; i2 < n_blocks2; ++i2)
+      if constexpr (fe_degree == -1)
         {
-          for (int i1 = 0; i1 < n_blocks1; ++i1)
+          // run-time path with the loop bounds taken from the shape data
+          const int degree     = data.fe_degree;
+          const int n_rows     = degree + 1;
+          const int n_columns  = data.n_q_points_1d;
+          const int mm         = contract_over_rows ? n_rows : n_columns;
+          const int nn         = contract_over_rows ? n_columns : n_rows;
+          const int n_blocks1  = Utilities::pow(degree, direction);
+          const int n_blocks2  = Utilities::pow(degree, dim - direction - 1);
+          const int stride_in  = contract_over_rows ? 1 : stride;
+          const int stride_out = contract_over_rows ? stride : 1;
+
+          for (int i2 = 0; i2 < n_blocks2; ++i2)
             {
-              if (contract_over_rows == false && add_into_result)
-                apply_matrix_vector_product<variant,
-                                            EvaluatorQuantity::value,
-                                            n_rows,
-                                            n_columns,
-                                            n_blocks1 * stride_in,
-                                            n_blocks1 * stride_out,
-                                            contract_over_rows,
-                                            true>(shape_data, in, out);
-              else
-                apply_matrix_vector_product<variant,
-                                            EvaluatorQuantity::value,
-                                            n_rows,
-                                            n_columns,
-                                            n_blocks1 * stride_in,
-                                            n_blocks1 * stride_out,
-                                            contract_over_rows,
-                                            false>(shape_data, in, out);
-
-              in += stride_in;
-              out += stride_out;
+              for (int i1 = 0; i1 < n_blocks1; ++i1)
+                {
+                  if (contract_over_rows == false && add_into_result)
+                    apply_matrix_vector_product<variant,
+                                                EvaluatorQuantity::value,
+                                                contract_over_rows,
+                                                true,
+                                                true>(shape_data,
+                                                      in,
+                                                      out,
+                                                      n_rows,
+                                                      n_columns,
+                                                      n_blocks1 * stride_in,
+                                                      n_blocks1 * stride_out);
+                  else
+                    apply_matrix_vector_product<variant,
+                                                EvaluatorQuantity::value,
+                                                contract_over_rows,
+                                                false,
+                                                true>(shape_data,
+                                                      in,
+                                                      out,
+                                                      n_rows,
+                                                      n_columns,
+                                                      n_blocks1 * stride_in,
+                                                      n_blocks1 * stride_out);
+
+                  in += stride_in;
+                  out += stride_out;
+                }
+              in += n_blocks1 * (mm - 1) * stride_in;
+              out += n_blocks1 * (nn - 1) * stride_out;
+            }
+        }
+      else
+        {
+          AssertDimension(fe_degree, data.fe_degree);
+          AssertDimension(n_q_points_1d, data.n_q_points_1d);
+          constexpr int n_rows    = fe_degree + 1;
+          constexpr int n_columns = n_q_points_1d;
+          constexpr int mm        = contract_over_rows ? n_rows : n_columns;
+          constexpr int nn        = contract_over_rows ? n_columns : n_rows;
+
+          constexpr int n_blocks1 = Utilities::pow(fe_degree, direction);
+          constexpr int n_blocks2 =
+            Utilities::pow(fe_degree, dim - direction - 1);
+          constexpr int stride_in  = contract_over_rows ? 1 : stride;
+          constexpr int stride_out = contract_over_rows ? stride : 1;
+
+          for (int i2 = 0; i2 < n_blocks2; ++i2)
+            {
+              for (int i1 = 0; i1 < n_blocks1; ++i1)
+                {
+                  if (contract_over_rows == false && add_into_result)
+                    apply_matrix_vector_product<variant,
+                                                EvaluatorQuantity::value,
+                                                n_rows,
+                                                n_columns,
+                                                n_blocks1 * stride_in,
+                                                n_blocks1 * stride_out,
+                                                contract_over_rows,
+                                                true>(shape_data, in, out);
+                  else
+                    apply_matrix_vector_product<variant,
+                                                EvaluatorQuantity::value,
+                                                n_rows,
+                                                n_columns,
+                                                n_blocks1 * stride_in,
+                                                n_blocks1 * stride_out,
+                                                contract_over_rows,
+                                                false>(shape_data, in, out);
+
+                  in += stride_in;
+                  out += stride_out;
+                }
+              in += n_blocks1 * (mm - 1) * stride_in;
+              out += n_blocks1 * (nn - 1) * stride_out;
             }
-          in += n_blocks1 * (mm - 1) * stride_in;
-          out += n_blocks1 * (nn - 1) * stride_out;
         }
     }
 
@@ -1939,83 +1994,170 @@ namespace internal
                const int subface_index_1d = 0)
     {
       AssertIndexRange(direction, dim);
-      AssertDimension(fe_degree - 1, data.fe_degree);
-      AssertDimension(n_q_points_1d, data.n_q_points_1d);
       static_assert(direction != normal_direction,
                     "Cannot interpolate tangentially in normal direction");
 
-      constexpr int  n_rows    = std::max(fe_degree, 0);
-      constexpr int  n_columns = n_q_points_1d;
       const Number2 *shape_data =
         symmetric_evaluate ?
           data.shape_values_eo.data() :
           data.values_within_subface[subface_index_1d].data();
       Assert(shape_data != nullptr, ExcNotInitialized());
 
-      constexpr int n_blocks1 =
-        (direction > normal_direction) ?
-          Utilities::pow(n_q_points_1d, direction) :
-          (direction > 0 ?
-             (Utilities::pow(fe_degree, direction - 1) * n_q_points_1d) :
-             1);
-      constexpr int n_blocks2 =
-        (direction > normal_direction) ?
-          Utilities::pow(fe_degree, dim - 1 - direction) :
-          ((direction + 1 < dim) ?
-             (Utilities::pow(fe_degree, dim - 2 - direction) * n_q_points_1d) :
-             1);
-
       constexpr EvaluatorVariant variant =
         symmetric_evaluate ? evaluate_evenodd : evaluate_general;
 
-      // Since we may perform an in-place interpolation, we must run the step
-      // expanding the size of the basis backward ('contract_over_rows' aka
-      // 'evaluate' case), so shift the pointers and decrement during the loop
-      if (contract_over_rows)
+      if constexpr (fe_degree == -1)
         {
-          in += (n_blocks2 - 1) * n_blocks1 * n_rows + n_blocks1 - 1;
-          out +=
-            stride * ((n_blocks2 - 1) * n_blocks1 * n_columns + n_blocks1 - 1);
-          for (int i2 = 0; i2 < n_blocks2; ++i2)
+          // run-time path with the loop bounds taken from the shape data; the
+          // tangential shape data holds one degree less than the anisotropic
+          // element's normal direction
+          const int degree    = data.fe_degree + 1;
+          const int n_rows    = degree;
+          const int n_columns = data.n_q_points_1d;
+
+          const int n_blocks1 =
+            (direction > normal_direction) ?
+              Utilities::pow(n_columns, direction) :
+              (direction > 0 ?
+                 (Utilities::pow(degree, direction - 1) * n_columns) :
+                 1);
+          const int n_blocks2 =
+            (direction > normal_direction) ?
+              Utilities::pow(degree, dim - 1 - direction) :
+              ((direction + 1 < dim) ?
+                 (Utilities::pow(degree, dim - 2 - direction) * n_columns) :
+                 1);
+
+          // Since we may perform an in-place interpolation, we must run the
+          // step expanding the size of the basis backward
+          // ('contract_over_rows' aka 'evaluate' case), so shift the pointers
+          // and decrement during the loop
+          if (contract_over_rows)
             {
-              for (int i1 = 0; i1 < n_blocks1; ++i1)
+              in += (n_blocks2 - 1) * n_blocks1 * n_rows + n_blocks1 - 1;
+              out += stride *
+                     ((n_blocks2 - 1) * n_blocks1 * n_columns + n_blocks1 - 1);
+              for (int i2 = 0; i2 < n_blocks2; ++i2)
+                {
+                  for (int i1 = 0; i1 < n_blocks1; ++i1)
+                    {
+                      apply_matrix_vector_product<variant,
+                                                  EvaluatorQuantity::value,
+                                                  true,
+                                                  false,
+                                                  true>(shape_data,
+                                                        in,
+                                                        out,
+                                                        n_rows,
+                                                        n_columns,
+                                                        n_blocks1,
+                                                        n_blocks1 * stride);
+
+                      --in;
+                      out -= stride;
+                    }
+                  in -= n_blocks1 * (n_rows - 1);
+                  out -= n_blocks1 * (n_columns - 1) * stride;
+                }
+            }
+          else
+            {
+              for (int i2 = 0; i2 < n_blocks2; ++i2)
                 {
-                  apply_matrix_vector_product<variant,
-                                              EvaluatorQuantity::value,
-                                              n_rows,
-                                              n_columns,
-                                              n_blocks1,
-                                              n_blocks1 * stride,
-                                              true,
-                                              false>(shape_data, in, out);
-
-                  --in;
-                  out -= stride;
+                  for (int i1 = 0; i1 < n_blocks1; ++i1)
+                    {
+                      apply_matrix_vector_product<variant,
+                                                  EvaluatorQuantity::value,
+                                                  false,
+                                                  false,
+                                                  true>(shape_data,
+                                                        in,
+                                                        out,
+                                                        n_rows,
+                                                        n_columns,
+                                                        n_blocks1 * stride,
+                                                        n_blocks1);
+
+                      in += stride;
+                      ++out;
+                    }
+                  in += n_blocks1 * (n_columns - 1) * stride;
+                  out += n_blocks1 * (n_rows - 1);
                 }
-              in -= n_blocks1 * (n_rows - 1);
-              out -= n_blocks1 * (n_columns - 1) * stride;
             }
         }
       else
         {
-          for (int i2 = 0; i2 < n_blocks2; ++i2)
+          AssertDimension(fe_degree - 1, data.fe_degree);
+          AssertDimension(n_q_points_1d, data.n_q_points_1d);
+
+          constexpr int n_rows    = std::max(fe_degree, 0);
+          constexpr int n_columns = n_q_points_1d;
+
+          constexpr int n_blocks1 =
+            (direction > normal_direction) ?
+              Utilities::pow(n_q_points_1d, direction) :
+              (direction > 0 ?
+                 (Utilities::pow(fe_degree, direction - 1) * n_q_points_1d) :
+                 1);
+          constexpr int n_blocks2 =
+            (direction > normal_direction) ?
+              Utilities::pow(fe_degree, dim - 1 - direction) :
+              ((direction + 1 < dim) ?
+                 (Utilities::pow(fe_degree, dim - 2 - direction) *
+                  n_q_points_1d) :
+                 1);
+
+          // Since we may perform an in-place interpolation, we must run the
+          // step expanding the size of the basis backward
+          // ('contract_over_rows' aka 'evaluate' case), so shift the pointers
+          // and decrement during the loop
+          if (contract_over_rows)
             {
-              for (int i1 = 0; i1 < n_blocks1; ++i1)
+              in += (n_blocks2 - 1) * n_blocks1 * n_rows + n_blocks1 - 1;
+              out += stride *
+                     ((n_blocks2 - 1) * n_blocks1 * n_columns + n_blocks1 - 1);
+              for (int i2 = 0; i2 < n_blocks2; ++i2)
+                {
+                  for (int i1 = 0; i1 < n_blocks1; ++i1)
+                    {
+                      apply_matrix_vector_product<variant,
+                                                  EvaluatorQuantity::value,
+                                                  n_rows,
+                                                  n_columns,
+                                                  n_blocks1,
+                                                  n_blocks1 * stride,
+                                                  true,
+                                                  false>(shape_data, in, out);
+
+                      --in;
+                      out -= stride;
+                    }
+                  in -= n_blocks1 * (n_rows - 1);
+                  out -= n_blocks1 * (n_columns - 1) * stride;
+                }
+            }
+          else
+            {
+              for (int i2 = 0; i2 < n_blocks2; ++i2)
                 {
-                  apply_matrix_vector_product<variant,
-                                              EvaluatorQuantity::value,
-                                              n_rows,
-                                              n_columns,
-                                              n_blocks1 * stride,
-                                              n_blocks1,
-                                              false,
-                                              false>(shape_data, in, out);
-
-                  in += stride;
-                  ++out;
+                  for (int i1 = 0; i1 < n_blocks1; ++i1)
+                    {
+                      apply_matrix_vector_product<variant,
+                                                  EvaluatorQuantity::value,
+                                                  n_rows,
+                                                  n_columns,
+                                                  n_blocks1 * stride,
+                                                  n_blocks1,
+                                                  false,
+                                                  false>(shape_data, in, out);
+
+                      in += stride;
+                      ++out;
+                    }
+                  in += n_blocks1 * (n_columns - 1) * stride;
+                  out += n_blocks1 * (n_rows - 1);
                 }
-              in += n_blocks1 * (n_columns - 1) * stride;
-              out += n_blocks1 * (n_rows - 1);
             }
         }
     }
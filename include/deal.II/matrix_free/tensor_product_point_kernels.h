@@ -311,6 +311,15 @@ namespace internal
                               n_values,
                               do_renumber,
                               stride>(values, renumber, shapes, n_shapes, i);
+        else if (n_shapes == 7)
+          inner_result =
+            do_interpolate_xy<dim,
+                              7,
+                              Number2,
+                              Number,
+                              n_values,
+                              do_renumber,
+                              stride>(values, renumber, shapes, n_shapes, i);
         else
           inner_result =
             do_interpolate_xy<dim,
@@ -642,6 +651,14 @@ namespace internal
                                                  do_renumber,
                                                  stride>(
             values, renumber, shapes, n_shapes, i);
+        else if (n_shapes == 7)
+          inner_result = do_interpolate_xy_value<dim,
+                                                 7,
+                                                 Number2,
+                                                 Number,
+                                                 do_renumber,
+                                                 stride>(
+            values, renumber, shapes, n_shapes, i);
         else
           inner_result = do_interpolate_xy_value<dim,
                                                  -1,
@@ -1137,6 +1154,9 @@ namespace internal
         else if (n_shapes == 6)
           do_apply_test_functions_xy<dim, 6, Number2, Number, add, n_values>(
             values, shapes, test_grads_value, n_shapes, i);
+        else if (n_shapes == 7)
+          do_apply_test_functions_xy<dim, 7, Number2, Number, add, n_values>(
+            values, shapes, test_grads_value, n_shapes, i);
         else
           do_apply_test_functions_xy<dim, -1, Number2, Number, add, n_values>(
             values, shapes, test_grads_value, n_shapes, i);
@@ -1474,6 +1494,9 @@ namespace internal
         else if (n_shapes == 6)
           do_apply_test_functions_xy_value<dim, 6, Number2, Number, add>(
             values, shapes, test_value, n_shapes, i);
+        else if (n_shapes == 7)
+          do_apply_test_functions_xy_value<dim, 7, Number2, Number, add>(
+            values, shapes, test_value, n_shapes, i);
         else
           do_apply_test_functions_xy_value<dim, -1, Number2, Number, add>(
             values, shapes, test_value, n_shapes, i);
@@ -17,8 +17,12 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
+
 #include <deal.II/grid/tria.h>
 
+#include <deal.II/lac/full_matrix.h>
+
 #include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/matrix_free/matrix_free.h>
 #include <deal.II/matrix_free/vector_access_internal.h>
@@ -42,6 +46,71 @@ namespace MatrixFreeTools
   categorize_by_boundary_ids(const Triangulation<dim> &tria,
                              AdditionalData           &additional_data);
 
+  /**
+   * Modify @p additional_data so that cells are categorized according to
+   * the computational weight returned by @p cell_weight, grouping cells of
+   * similar cost into the same SIMD batches. The weights, which must be
+   * non-negative, are sorted into @p n_categories bins spaced
+   * logarithmically between the smallest and the largest positive weight
+   * encountered on the locally owned cells. This is useful when the work
+   * per cell varies considerably, e.g., due to cell-wise varying material
+   * models or locally refined quadrature, because it avoids batches in
+   * which a single expensive cell determines the run time of all SIMD
+   * lanes.
+   *
+   * The function also sets
+   * MatrixFree::AdditionalData::cell_vectorization_categories_strict to
+   * true so that cells of different categories are never mixed within one
+   * batch. If all weights are equal (or zero), all cells end up in a
+   * single category and the batching is unchanged.
+   */
+  template <int dim, typename AdditionalData>
+  void
+  categorize_by_weight(
+    const Triangulation<dim> &tria,
+    const std::function<
+      double(const typename Triangulation<dim>::cell_iterator &)> &cell_weight,
+    AdditionalData                                                &additional_data,
+    const unsigned int n_categories = 8);
+
+  /**
+   * Fill @p cell_data with one entry per cell batch of @p matrix_free,
+   * evaluating @p cell_to_value on each cell of the batch. The resulting
+   * array follows the cell-batch order of MatrixFree::cell_loop() and is
+   * suitable for FEEvaluationData::read_cell_data(), so that per-cell
+   * quantities such as material properties are loaded with a single
+   * contiguous access per batch rather than by dereferencing cell iterators
+   * during operator evaluation. Lanes of a batch that are not backed by an
+   * actual cell are filled with the value of the last cell in the batch.
+   *
+   * The array is sized by MatrixFree::initialize_cell_data_vector() and also
+   * covers the ghosted cell batches that can be encountered in face loops.
+   */
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  fill_cell_data(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const std::function<typename VectorizedArrayType::value_type(
+      const typename Triangulation<dim>::cell_iterator &)> &cell_to_value,
+    AlignedVector<VectorizedArrayType>                     &cell_data);
+
+  /**
+   * Same as above, but reading the per-cell values from an array indexed by
+   * the active cell index, i.e., @p values_per_cell must have as many
+   * entries as the underlying triangulation has active cells. This variant
+   * is not available if @p matrix_free has been set up on a multigrid
+   * level.
+   */
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename Number2>
+  void
+  fill_cell_data(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const ArrayView<const Number2>                     &values_per_cell,
+    AlignedVector<VectorizedArrayType>                 &cell_data);
+
   /**
    * Compute the diagonal of a linear operator (@p diagonal_global), given
    * @p matrix_free and the local cell integral operation @p local_vmult. The
@@ -156,6 +225,72 @@ namespace MatrixFreeTools
     const unsigned int first_selected_component = 0);
 
 
+  /**
+   * Compute the cell-wise (element-wise) blocks of the matrix representation
+   * of a linear operator, given @p matrix_free and the local cell integral
+   * operation @p local_vmult, e.g., in order to set up an element-wise block
+   * Jacobi preconditioner. The vector @p matrices is resized to
+   * `matrix_free.n_cell_batches()` times the number of lanes in
+   * VectorizedArrayType, and the block of the cell `v` within the cell batch
+   * `cell` is stored at position `cell * VectorizedArrayType::size() + v`;
+   * entries associated to unfilled lanes remain empty. The rows and columns
+   * of each block are enumerated in the order of the degrees of freedom in
+   * FEEvaluation::begin_dof_values(), so the blocks can be applied (e.g.,
+   * after inversion by FullMatrix::gauss_jordan()) directly to the local
+   * values within a cell loop without further index translation.
+   *
+   * In contrast to compute_matrix(), no constraints are applied to the
+   * blocks, i.e., the blocks contain the raw element matrices.
+   *
+   * The parameters @p dof_no, @p quad_no, and @p first_selected_component are
+   * passed to the constructor of the FEEvaluation that is internally set up.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  compute_block_diagonal(
+    const MatrixFree<dim, Number, VectorizedArrayType>             &matrix_free,
+    std::vector<FullMatrix<Number>>                                &matrices,
+    const std::function<void(FEEvaluation<dim,
+                                          fe_degree,
+                                          n_q_points_1d,
+                                          n_components,
+                                          Number,
+                                          VectorizedArrayType> &)> &local_vmult,
+    const unsigned int                                              dof_no  = 0,
+    const unsigned int                                              quad_no = 0,
+    const unsigned int first_selected_component = 0);
+
+  /**
+   * Same as above but with a class and a function pointer.
+   */
+  template <typename CLASS,
+            int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  compute_block_diagonal(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    std::vector<FullMatrix<Number>>                    &matrices,
+    void (CLASS::*cell_operation)(FEEvaluation<dim,
+                                               fe_degree,
+                                               n_q_points_1d,
+                                               n_components,
+                                               Number,
+                                               VectorizedArrayType> &) const,
+    const CLASS       *owning_class,
+    const unsigned int dof_no                   = 0,
+    const unsigned int quad_no                  = 0,
+    const unsigned int first_selected_component = 0);
+
+
 
   /**
    * A wrapper around MatrixFree to help users to deal with DoFHandler
@@ -416,6 +551,166 @@ namespace MatrixFreeTools
       additional_data.mapping_update_flags_boundary_faces;
   }
 
+
+
+  template <int dim, typename AdditionalData>
+  void
+  categorize_by_weight(
+    const Triangulation<dim> &tria,
+    const std::function<
+      double(const typename Triangulation<dim>::cell_iterator &)> &cell_weight,
+    AdditionalData                                                &additional_data,
+    const unsigned int                                             n_categories)
+  {
+    Assert(n_categories > 0,
+           ExcMessage("The number of categories must be positive."));
+
+    // ... determine if we are on an active or a multigrid level
+    const unsigned int level = additional_data.mg_level;
+    const bool         is_mg = (level != numbers::invalid_unsigned_int);
+
+    // ... create empty list for the category of each cell
+    if (is_mg)
+      additional_data.cell_vectorization_category.assign(
+        std::distance(tria.begin(level), tria.end(level)), 0);
+    else
+      additional_data.cell_vectorization_category.assign(tria.n_active_cells(),
+                                                         0);
+
+    // ... determine the range of the positive weights in a first sweep over
+    // the locally owned cells
+    double min_weight = std::numeric_limits<double>::max();
+    double max_weight = 0.;
+
+    const auto collect_range = [&](const auto &cell) {
+      const double weight = cell_weight(cell);
+      Assert(weight >= 0., ExcMessage("Cell weights must be non-negative."));
+      if (weight > 0.)
+        {
+          min_weight = std::min(min_weight, weight);
+          max_weight = std::max(max_weight, weight);
+        }
+    };
+
+    if (!is_mg)
+      {
+        for (auto cell = tria.begin_active(); cell != tria.end(); ++cell)
+          if (cell->is_locally_owned())
+            collect_range(cell);
+      }
+    else
+      {
+        for (auto cell = tria.begin(level); cell != tria.end(level); ++cell)
+          if (cell->is_locally_owned_on_level())
+            collect_range(cell);
+      }
+
+    // ... if all weights coincide (or are zero), every cell belongs to the
+    // same category and there is nothing left to do
+    if (max_weight <= 0. || max_weight == min_weight)
+      {
+        additional_data.cell_vectorization_categories_strict = true;
+        return;
+      }
+
+    // ... map each weight to one of n_categories bins, spaced
+    // logarithmically between the smallest and the largest weight
+    const double log_min   = std::log(min_weight);
+    const double log_range = std::log(max_weight) - log_min;
+
+    const auto to_category = [&](const auto &cell) {
+      const double weight = cell_weight(cell);
+      if (weight <= 0.)
+        return 0u;
+      const unsigned int bin = static_cast<unsigned int>(
+        (std::log(weight) - log_min) / log_range * n_categories);
+      return std::min(bin, n_categories - 1);
+    };
+
+    if (!is_mg)
+      {
+        for (auto cell = tria.begin_active(); cell != tria.end(); ++cell)
+          {
+            if (cell->is_locally_owned())
+              additional_data
+                .cell_vectorization_category[cell->active_cell_index()] =
+                to_category(cell);
+          }
+      }
+    else
+      {
+        for (auto cell = tria.begin(level); cell != tria.end(level); ++cell)
+          {
+            if (cell->is_locally_owned_on_level())
+              additional_data.cell_vectorization_category[cell->index()] =
+                to_category(cell);
+          }
+      }
+
+    // ... make sure that cells of different categories are not mixed within
+    // a batch
+    additional_data.cell_vectorization_categories_strict = true;
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  fill_cell_data(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const std::function<typename VectorizedArrayType::value_type(
+      const typename Triangulation<dim>::cell_iterator &)> &cell_to_value,
+    AlignedVector<VectorizedArrayType>                     &cell_data)
+  {
+    matrix_free.initialize_cell_data_vector(cell_data);
+
+    const unsigned int n_cell_batches =
+      matrix_free.n_cell_batches() + matrix_free.n_ghost_cell_batches();
+    for (unsigned int cell = 0; cell < n_cell_batches; ++cell)
+      {
+        const unsigned int n_active =
+          matrix_free.n_active_entries_per_cell_batch(cell);
+        for (unsigned int v = 0; v < n_active; ++v)
+          cell_data[cell][v] =
+            cell_to_value(matrix_free.get_cell_iterator(cell, v));
+
+        // duplicate the last entry into the unused lanes so that operations
+        // on the full batch do not run into invalid data
+        for (unsigned int v = n_active; v < VectorizedArrayType::size(); ++v)
+          cell_data[cell][v] = cell_data[cell][n_active - 1];
+      }
+  }
+
+
+
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename Number2>
+  void
+  fill_cell_data(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const ArrayView<const Number2>                     &values_per_cell,
+    AlignedVector<VectorizedArrayType>                 &cell_data)
+  {
+    Assert(matrix_free.get_mg_level() == numbers::invalid_unsigned_int,
+           ExcMessage("This function indexes the given array by the active "
+                      "cell index and can thus not be used for a MatrixFree "
+                      "object set up on a multigrid level."));
+    AssertDimension(values_per_cell.size(),
+                    matrix_free.get_dof_handler()
+                      .get_triangulation()
+                      .n_active_cells());
+
+    fill_cell_data<dim, Number, VectorizedArrayType>(
+      matrix_free,
+      [&](const typename Triangulation<dim>::cell_iterator &cell) ->
+      typename VectorizedArrayType::value_type {
+        return values_per_cell[cell->active_cell_index()];
+      },
+      cell_data);
+  }
+
   namespace internal
   {
     template <typename Number>
@@ -1304,6 +1599,110 @@ namespace MatrixFreeTools
       first_selected_component);
   }
 
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  compute_block_diagonal(
+    const MatrixFree<dim, Number, VectorizedArrayType>             &matrix_free,
+    std::vector<FullMatrix<Number>>                                &matrices,
+    const std::function<void(FEEvaluation<dim,
+                                          fe_degree,
+                                          n_q_points_1d,
+                                          n_components,
+                                          Number,
+                                          VectorizedArrayType> &)> &local_vmult,
+    const unsigned int                                              dof_no,
+    const unsigned int                                              quad_no,
+    const unsigned int first_selected_component)
+  {
+    constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+    matrices.clear();
+    matrices.resize(matrix_free.n_cell_batches() * n_lanes);
+
+    int dummy = 0;
+    matrix_free.template cell_loop<int, int>(
+      [&](const auto &, auto &, const auto &, const auto range) {
+        FEEvaluation<dim,
+                     fe_degree,
+                     n_q_points_1d,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>
+          integrator(
+            matrix_free, range, dof_no, quad_no, first_selected_component);
+
+        const unsigned int dofs_per_cell = integrator.dofs_per_cell;
+
+        for (auto cell = range.first; cell < range.second; ++cell)
+          {
+            integrator.reinit(cell);
+
+            const unsigned int n_filled_lanes =
+              matrix_free.n_active_entries_per_cell_batch(cell);
+
+            for (unsigned int v = 0; v < n_filled_lanes; ++v)
+              matrices[cell * n_lanes + v].reinit(dofs_per_cell, dofs_per_cell);
+
+            for (unsigned int j = 0; j < dofs_per_cell; ++j)
+              {
+                for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                  integrator.begin_dof_values()[i] =
+                    static_cast<Number>(i == j);
+
+                local_vmult(integrator);
+
+                for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                  for (unsigned int v = 0; v < n_filled_lanes; ++v)
+                    matrices[cell * n_lanes + v](i, j) =
+                      integrator.begin_dof_values()[i][v];
+              }
+          }
+      },
+      dummy,
+      dummy);
+  }
+
+  template <typename CLASS,
+            int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  compute_block_diagonal(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    std::vector<FullMatrix<Number>>                    &matrices,
+    void (CLASS::*cell_operation)(FEEvaluation<dim,
+                                               fe_degree,
+                                               n_q_points_1d,
+                                               n_components,
+                                               Number,
+                                               VectorizedArrayType> &) const,
+    const CLASS       *owning_class,
+    const unsigned int dof_no,
+    const unsigned int quad_no,
+    const unsigned int first_selected_component)
+  {
+    compute_block_diagonal<dim,
+                           fe_degree,
+                           n_q_points_1d,
+                           n_components,
+                           Number,
+                           VectorizedArrayType>(
+      matrix_free,
+      matrices,
+      [&](auto &feeval) { (owning_class->*cell_operation)(feeval); },
+      dof_no,
+      quad_no,
+      first_selected_component);
+  }
+
 #endif // DOXYGEN
 
 } // namespace MatrixFreeTools
@@ -96,6 +96,329 @@ namespace MeshWorker
       // remove the template layers to retrieve the underlying iterator type.
       using type = typename CellIteratorBaseType<CellIteratorType>::type;
     };
+
+    /**
+     * A helper function used by the mesh_loop() overloads below. It verifies
+     * that the provided worker functions are consistent with the given
+     * @p flags, and combines the @p cell_worker, @p boundary_worker, and
+     * @p face_worker functions into a single function object that performs
+     * all of the requested work on one cell and its faces, following the
+     * logic described in the documentation of mesh_loop(). The returned
+     * object is what the mesh_loop() overloads hand off to WorkStream::run().
+     *
+     * The returned function object stores a reference to
+     * @p sample_copy_data; the latter consequently needs to live at least
+     * as long as the returned object is in use.
+     */
+    template <typename CellIteratorBaseType, class ScratchData, class CopyData>
+    std::function<void(const CellIteratorBaseType &, ScratchData &, CopyData &)>
+    make_cell_action(
+      const std::function<
+        void(const CellIteratorBaseType &, ScratchData &, CopyData &)>
+                          &cell_worker,
+      const CopyData      &sample_copy_data,
+      const AssembleFlags  flags,
+      const std::function<void(const CellIteratorBaseType &,
+                               const unsigned int,
+                               ScratchData &,
+                               CopyData &)> &boundary_worker,
+      const std::function<void(const CellIteratorBaseType &,
+                               const unsigned int,
+                               const unsigned int,
+                               const CellIteratorBaseType &,
+                               const unsigned int,
+                               const unsigned int,
+                               ScratchData &,
+                               CopyData &)> &face_worker)
+    {
+      Assert(
+        (!cell_worker) == !(flags & work_on_cells),
+        ExcMessage(
+          "If you provide a cell worker function, you also need to request "
+          "that work should be done on cells by setting the 'work_on_cells' flag. "
+          "Conversely, if you don't provide a cell worker function, you "
+          "cannot set the 'work_on_cells' flag. One of these two "
+          "conditions is not satisfied."));
+
+      Assert((flags & (assemble_own_interior_faces_once |
+                       assemble_own_interior_faces_both)) !=
+               (assemble_own_interior_faces_once |
+                assemble_own_interior_faces_both),
+             ExcMessage(
+               "If you provide a face worker function, you also need to request "
+               "that work should be done on interior faces by setting either the "
+               "'assemble_own_interior_faces_once' flag or the "
+               "'assemble_own_interior_faces_both' flag. "
+               "Conversely, if you don't provide a face worker function, you "
+               "cannot set either of these two flags. One of these two "
+               "conditions is not satisfied."));
+
+      Assert((flags &
+              (assemble_ghost_faces_once | assemble_ghost_faces_both)) !=
+               (assemble_ghost_faces_once | assemble_ghost_faces_both),
+             ExcMessage(
+               "You can only 'specify assemble_ghost_faces_once' "
+               "OR 'assemble_ghost_faces_both', but not both of these flags."));
+
+      Assert(
+        !(flags & cells_after_faces) ||
+          (flags & (assemble_own_cells | assemble_ghost_cells)),
+        ExcMessage(
+          "The option 'cells_after_faces' only makes sense if you assemble on cells."));
+
+      Assert(
+        (!face_worker) == !(flags & work_on_faces),
+        ExcMessage(
+          "If you provide a face worker function, you also need to request "
+          "that work should be done on faces by setting the 'work_on_faces' flag. "
+          "Conversely, if you don't provide a face worker function, you "
+          "cannot set the 'work_on_faces' flag. One of these two "
+          "conditions is not satisfied."));
+
+      Assert(
+        (!boundary_worker) == !(flags & assemble_boundary_faces),
+        ExcMessage(
+          "If you provide a boundary face worker function, you also need to request "
+          "that work should be done on boundary faces by setting the 'assemble_boundary_faces' flag. "
+          "Conversely, if you don't provide a boundary face worker function, you "
+          "cannot set the 'assemble_boundary_faces' flag. One of these two "
+          "conditions is not satisfied."));
+
+      return [cell_worker,
+              boundary_worker,
+              face_worker,
+              flags,
+              &sample_copy_data](const CellIteratorBaseType &cell,
+                                 ScratchData                &scratch,
+                                 CopyData                   &copy) {
+        // First reset the CopyData class to the empty copy_data given by the
+        // user.
+        copy = sample_copy_data;
+
+        // Store the dimension in which we are working for later use
+        const auto dim = cell->get_triangulation().dimension;
+
+        const bool ignore_subdomain =
+          (cell->get_triangulation().locally_owned_subdomain() ==
+           numbers::invalid_subdomain_id);
+
+        types::subdomain_id current_subdomain_id =
+          (cell->is_level_cell() ? cell->level_subdomain_id() :
+                                   cell->subdomain_id());
+
+        const bool own_cell =
+          ignore_subdomain ||
+          (current_subdomain_id ==
+           cell->get_triangulation().locally_owned_subdomain());
+
+        if ((!ignore_subdomain) &&
+            (current_subdomain_id == numbers::artificial_subdomain_id))
+          return;
+
+        if (!(flags & (cells_after_faces)) &&
+            (((flags & (assemble_own_cells)) && own_cell) ||
+             ((flags & assemble_ghost_cells) && !own_cell)))
+          cell_worker(cell, scratch, copy);
+
+        if (flags & (work_on_faces | work_on_boundary))
+          for (const unsigned int face_no : cell->face_indices())
+            {
+              if (cell->at_boundary(face_no) &&
+                  !cell->has_periodic_neighbor(face_no))
+                {
+                  // only integrate boundary faces of own cells
+                  if ((flags & assemble_boundary_faces) && own_cell)
+                    boundary_worker(cell, face_no, scratch, copy);
+                }
+              else
+                {
+                  // interior face, potentially assemble
+                  TriaIterator<typename CellIteratorBaseType::AccessorType>
+                    neighbor = cell->neighbor_or_periodic_neighbor(face_no);
+
+                  types::subdomain_id neighbor_subdomain_id =
+                    numbers::artificial_subdomain_id;
+                  if (neighbor->is_level_cell())
+                    neighbor_subdomain_id = neighbor->level_subdomain_id();
+                  // subdomain id is only valid for active cells
+                  else if (neighbor->is_active())
+                    neighbor_subdomain_id = neighbor->subdomain_id();
+
+                  const bool own_neighbor =
+                    ignore_subdomain ||
+                    (neighbor_subdomain_id ==
+                     cell->get_triangulation().locally_owned_subdomain());
+
+                  // skip all faces between two ghost cells
+                  if (!own_cell && !own_neighbor)
+                    continue;
+
+                  // skip if the user doesn't want faces between own cells
+                  if (own_cell && own_neighbor &&
+                      !(flags & (assemble_own_interior_faces_both |
+                                 assemble_own_interior_faces_once)))
+                    continue;
+
+                  // skip face to ghost
+                  if (own_cell != own_neighbor &&
+                      !(flags & (assemble_ghost_faces_both |
+                                 assemble_ghost_faces_once)))
+                    continue;
+
+                  // Deal with refinement edges from the refined side. Assuming
+                  // one-irregular meshes, this situation should only occur if
+                  // both cells are active.
+                  const bool periodic_neighbor =
+                    cell->has_periodic_neighbor(face_no);
+
+                  if (dim > 1 &&
+                      ((!periodic_neighbor &&
+                        cell->neighbor_is_coarser(face_no) &&
+                        neighbor->is_active()) ||
+                       (periodic_neighbor &&
+                        cell->periodic_neighbor_is_coarser(face_no) &&
+                        neighbor->is_active())))
+                    {
+                      Assert(cell->is_active(), ExcInternalError());
+
+                      // skip if only one processor needs to assemble the face
+                      // to a ghost cell and the fine cell is not ours.
+                      if (!own_cell && (flags & assemble_ghost_faces_once))
+                        continue;
+
+                      const std::pair<unsigned int, unsigned int>
+                        neighbor_face_no =
+                          periodic_neighbor ?
+                            cell
+                              ->periodic_neighbor_of_coarser_periodic_neighbor(
+                                face_no) :
+                            cell->neighbor_of_coarser_neighbor(face_no);
+
+                      face_worker(cell,
+                                  face_no,
+                                  numbers::invalid_unsigned_int,
+                                  neighbor,
+                                  neighbor_face_no.first,
+                                  neighbor_face_no.second,
+                                  scratch,
+                                  copy);
+
+                      if (flags & assemble_own_interior_faces_both)
+                        {
+                          // If own faces are to be assembled from both sides,
+                          // call the faceworker again with swapped arguments.
+                          // This is because we won't be looking at an
+                          // adaptively refined edge coming from the other side.
+                          face_worker(neighbor,
+                                      neighbor_face_no.first,
+                                      neighbor_face_no.second,
+                                      cell,
+                                      face_no,
+                                      numbers::invalid_unsigned_int,
+                                      scratch,
+                                      copy);
+                        }
+                    }
+                  else if (dim == 1 && cell->level() > neighbor->level())
+                    {
+                      // In one dimension, there is no other check to do
+                      const unsigned int neighbor_face_no =
+                        periodic_neighbor ?
+                          cell->periodic_neighbor_face_no(face_no) :
+                          cell->neighbor_face_no(face_no);
+                      Assert(periodic_neighbor ||
+                               neighbor->face(neighbor_face_no) ==
+                                 cell->face(face_no),
+                             ExcInternalError());
+
+                      face_worker(cell,
+                                  face_no,
+                                  numbers::invalid_unsigned_int,
+                                  neighbor,
+                                  neighbor_face_no,
+                                  numbers::invalid_unsigned_int,
+                                  scratch,
+                                  copy);
+
+                      if (flags & assemble_own_interior_faces_both)
+                        {
+                          // If own faces are to be assembled from both sides,
+                          // call the faceworker again with swapped arguments.
+                          face_worker(neighbor,
+                                      neighbor_face_no,
+                                      numbers::invalid_unsigned_int,
+                                      cell,
+                                      face_no,
+                                      numbers::invalid_unsigned_int,
+                                      scratch,
+                                      copy);
+                        }
+                    }
+                  else
+                    {
+                      // If iterator is active and neighbor is refined, skip
+                      // internal face.
+                      if (dealii::internal::is_active_iterator(cell) &&
+                          neighbor->has_children())
+                        continue;
+
+                      // Now neighbor is on the same refinement level.
+                      // Double check.
+                      Assert((!periodic_neighbor &&
+                              !cell->neighbor_is_coarser(face_no)) ||
+                               (periodic_neighbor &&
+                                !cell->periodic_neighbor_is_coarser(face_no)),
+                             ExcInternalError());
+
+                      // If we own both cells only do faces from one side
+                      // (unless AssembleFlags says otherwise). Here, we rely
+                      // on cell comparison that will look at cell->index().
+                      if (own_cell && own_neighbor &&
+                          (flags & assemble_own_interior_faces_once) &&
+                          (neighbor < cell))
+                        continue;
+
+                      // We only look at faces to ghost on the same level once
+                      // (only where own_cell=true and own_neighbor=false)
+                      if (!own_cell)
+                        continue;
+
+                      // now only one processor assembles faces_to_ghost. We
+                      // let the processor with the smaller (level-)subdomain
+                      // id assemble the face.
+                      if (own_cell && !own_neighbor &&
+                          (flags & assemble_ghost_faces_once) &&
+                          (neighbor_subdomain_id < current_subdomain_id))
+                        continue;
+
+                      const unsigned int neighbor_face_no =
+                        periodic_neighbor ?
+                          cell->periodic_neighbor_face_no(face_no) :
+                          cell->neighbor_face_no(face_no);
+                      Assert(periodic_neighbor ||
+                               neighbor->face(neighbor_face_no) ==
+                                 cell->face(face_no),
+                             ExcInternalError());
+
+                      face_worker(cell,
+                                  face_no,
+                                  numbers::invalid_unsigned_int,
+                                  neighbor,
+                                  neighbor_face_no,
+                                  numbers::invalid_unsigned_int,
+                                  scratch,
+                                  copy);
+                    }
+                }
+            } // faces
+
+        // Execute the cell_worker if faces are handled before cells
+        if ((flags & cells_after_faces) &&
+            (((flags & assemble_own_cells) && own_cell) ||
+             ((flags & assemble_ghost_cells) && !own_cell)))
+          cell_worker(cell, scratch, copy);
+      };
+    }
   } // namespace internal
 
 #ifdef DOXYGEN
@@ -345,286 +668,9 @@ namespace MeshWorker
 #endif
   )
   {
-    Assert(
-      (!cell_worker) == !(flags & work_on_cells),
-      ExcMessage(
-        "If you provide a cell worker function, you also need to request "
-        "that work should be done on cells by setting the 'work_on_cells' flag. "
-        "Conversely, if you don't provide a cell worker function, you "
-        "cannot set the 'work_on_cells' flag. One of these two "
-        "conditions is not satisfied."));
-
-    Assert((flags & (assemble_own_interior_faces_once |
-                     assemble_own_interior_faces_both)) !=
-             (assemble_own_interior_faces_once |
-              assemble_own_interior_faces_both),
-           ExcMessage(
-             "If you provide a face worker function, you also need to request "
-             "that work should be done on interior faces by setting either the "
-             "'assemble_own_interior_faces_once' flag or the "
-             "'assemble_own_interior_faces_both' flag. "
-             "Conversely, if you don't provide a face worker function, you "
-             "cannot set either of these two flags. One of these two "
-             "conditions is not satisfied."));
-
-    Assert((flags & (assemble_ghost_faces_once | assemble_ghost_faces_both)) !=
-             (assemble_ghost_faces_once | assemble_ghost_faces_both),
-           ExcMessage(
-             "You can only 'specify assemble_ghost_faces_once' "
-             "OR 'assemble_ghost_faces_both', but not both of these flags."));
-
-    Assert(
-      !(flags & cells_after_faces) ||
-        (flags & (assemble_own_cells | assemble_ghost_cells)),
-      ExcMessage(
-        "The option 'cells_after_faces' only makes sense if you assemble on cells."));
-
-    Assert(
-      (!face_worker) == !(flags & work_on_faces),
-      ExcMessage(
-        "If you provide a face worker function, you also need to request "
-        "that work should be done on faces by setting the 'work_on_faces' flag. "
-        "Conversely, if you don't provide a face worker function, you "
-        "cannot set the 'work_on_faces' flag. One of these two "
-        "conditions is not satisfied."));
-
-    Assert(
-      (!boundary_worker) == !(flags & assemble_boundary_faces),
-      ExcMessage(
-        "If you provide a boundary face worker function, you also need to request "
-        "that work should be done on boundary faces by setting the 'assemble_boundary_faces' flag. "
-        "Conversely, if you don't provide a boundary face worker function, you "
-        "cannot set the 'assemble_boundary_faces' flag. One of these two "
-        "conditions is not satisfied."));
-
-    auto cell_action = [&](const CellIteratorBaseType &cell,
-                           ScratchData                &scratch,
-                           CopyData                   &copy) {
-      // First reset the CopyData class to the empty copy_data given by the
-      // user.
-      copy = sample_copy_data;
-
-      // Store the dimension in which we are working for later use
-      const auto dim = cell->get_triangulation().dimension;
-
-      const bool ignore_subdomain =
-        (cell->get_triangulation().locally_owned_subdomain() ==
-         numbers::invalid_subdomain_id);
-
-      types::subdomain_id current_subdomain_id =
-        (cell->is_level_cell() ? cell->level_subdomain_id() :
-                                 cell->subdomain_id());
-
-      const bool own_cell =
-        ignore_subdomain ||
-        (current_subdomain_id ==
-         cell->get_triangulation().locally_owned_subdomain());
-
-      if ((!ignore_subdomain) &&
-          (current_subdomain_id == numbers::artificial_subdomain_id))
-        return;
-
-      if (!(flags & (cells_after_faces)) &&
-          (((flags & (assemble_own_cells)) && own_cell) ||
-           ((flags & assemble_ghost_cells) && !own_cell)))
-        cell_worker(cell, scratch, copy);
-
-      if (flags & (work_on_faces | work_on_boundary))
-        for (const unsigned int face_no : cell->face_indices())
-          {
-            if (cell->at_boundary(face_no) &&
-                !cell->has_periodic_neighbor(face_no))
-              {
-                // only integrate boundary faces of own cells
-                if ((flags & assemble_boundary_faces) && own_cell)
-                  boundary_worker(cell, face_no, scratch, copy);
-              }
-            else
-              {
-                // interior face, potentially assemble
-                TriaIterator<typename CellIteratorBaseType::AccessorType>
-                  neighbor = cell->neighbor_or_periodic_neighbor(face_no);
-
-                types::subdomain_id neighbor_subdomain_id =
-                  numbers::artificial_subdomain_id;
-                if (neighbor->is_level_cell())
-                  neighbor_subdomain_id = neighbor->level_subdomain_id();
-                // subdomain id is only valid for active cells
-                else if (neighbor->is_active())
-                  neighbor_subdomain_id = neighbor->subdomain_id();
-
-                const bool own_neighbor =
-                  ignore_subdomain ||
-                  (neighbor_subdomain_id ==
-                   cell->get_triangulation().locally_owned_subdomain());
-
-                // skip all faces between two ghost cells
-                if (!own_cell && !own_neighbor)
-                  continue;
-
-                // skip if the user doesn't want faces between own cells
-                if (own_cell && own_neighbor &&
-                    !(flags & (assemble_own_interior_faces_both |
-                               assemble_own_interior_faces_once)))
-                  continue;
-
-                // skip face to ghost
-                if (own_cell != own_neighbor &&
-                    !(flags &
-                      (assemble_ghost_faces_both | assemble_ghost_faces_once)))
-                  continue;
-
-                // Deal with refinement edges from the refined side. Assuming
-                // one-irregular meshes, this situation should only occur if
-                // both cells are active.
-                const bool periodic_neighbor =
-                  cell->has_periodic_neighbor(face_no);
-
-                if (dim > 1 && ((!periodic_neighbor &&
-                                 cell->neighbor_is_coarser(face_no) &&
-                                 neighbor->is_active()) ||
-                                (periodic_neighbor &&
-                                 cell->periodic_neighbor_is_coarser(face_no) &&
-                                 neighbor->is_active())))
-                  {
-                    Assert(cell->is_active(), ExcInternalError());
-
-                    // skip if only one processor needs to assemble the face
-                    // to a ghost cell and the fine cell is not ours.
-                    if (!own_cell && (flags & assemble_ghost_faces_once))
-                      continue;
-
-                    const std::pair<unsigned int, unsigned int>
-                      neighbor_face_no =
-                        periodic_neighbor ?
-                          cell->periodic_neighbor_of_coarser_periodic_neighbor(
-                            face_no) :
-                          cell->neighbor_of_coarser_neighbor(face_no);
-
-                    face_worker(cell,
-                                face_no,
-                                numbers::invalid_unsigned_int,
-                                neighbor,
-                                neighbor_face_no.first,
-                                neighbor_face_no.second,
-                                scratch,
-                                copy);
-
-                    if (flags & assemble_own_interior_faces_both)
-                      {
-                        // If own faces are to be assembled from both sides,
-                        // call the faceworker again with swapped arguments.
-                        // This is because we won't be looking at an adaptively
-                        // refined edge coming from the other side.
-                        face_worker(neighbor,
-                                    neighbor_face_no.first,
-                                    neighbor_face_no.second,
-                                    cell,
-                                    face_no,
-                                    numbers::invalid_unsigned_int,
-                                    scratch,
-                                    copy);
-                      }
-                  }
-                else if (dim == 1 && cell->level() > neighbor->level())
-                  {
-                    // In one dimension, there is no other check to do
-                    const unsigned int neighbor_face_no =
-                      periodic_neighbor ?
-                        cell->periodic_neighbor_face_no(face_no) :
-                        cell->neighbor_face_no(face_no);
-                    Assert(periodic_neighbor ||
-                             neighbor->face(neighbor_face_no) ==
-                               cell->face(face_no),
-                           ExcInternalError());
-
-                    face_worker(cell,
-                                face_no,
-                                numbers::invalid_unsigned_int,
-                                neighbor,
-                                neighbor_face_no,
-                                numbers::invalid_unsigned_int,
-                                scratch,
-                                copy);
-
-                    if (flags & assemble_own_interior_faces_both)
-                      {
-                        // If own faces are to be assembled from both sides,
-                        // call the faceworker again with swapped arguments.
-                        face_worker(neighbor,
-                                    neighbor_face_no,
-                                    numbers::invalid_unsigned_int,
-                                    cell,
-                                    face_no,
-                                    numbers::invalid_unsigned_int,
-                                    scratch,
-                                    copy);
-                      }
-                  }
-                else
-                  {
-                    // If iterator is active and neighbor is refined, skip
-                    // internal face.
-                    if (dealii::internal::is_active_iterator(cell) &&
-                        neighbor->has_children())
-                      continue;
-
-                    // Now neighbor is on the same refinement level.
-                    // Double check.
-                    Assert((!periodic_neighbor &&
-                            !cell->neighbor_is_coarser(face_no)) ||
-                             (periodic_neighbor &&
-                              !cell->periodic_neighbor_is_coarser(face_no)),
-                           ExcInternalError());
-
-                    // If we own both cells only do faces from one side (unless
-                    // AssembleFlags says otherwise). Here, we rely on cell
-                    // comparison that will look at cell->index().
-                    if (own_cell && own_neighbor &&
-                        (flags & assemble_own_interior_faces_once) &&
-                        (neighbor < cell))
-                      continue;
-
-                    // We only look at faces to ghost on the same level once
-                    // (only where own_cell=true and own_neighbor=false)
-                    if (!own_cell)
-                      continue;
-
-                    // now only one processor assembles faces_to_ghost. We let
-                    // the processor with the smaller (level-)subdomain id
-                    // assemble the face.
-                    if (own_cell && !own_neighbor &&
-                        (flags & assemble_ghost_faces_once) &&
-                        (neighbor_subdomain_id < current_subdomain_id))
-                      continue;
-
-                    const unsigned int neighbor_face_no =
-                      periodic_neighbor ?
-                        cell->periodic_neighbor_face_no(face_no) :
-                        cell->neighbor_face_no(face_no);
-                    Assert(periodic_neighbor ||
-                             neighbor->face(neighbor_face_no) ==
-                               cell->face(face_no),
-                           ExcInternalError());
-
-                    face_worker(cell,
-                                face_no,
-                                numbers::invalid_unsigned_int,
-                                neighbor,
-                                neighbor_face_no,
-                                numbers::invalid_unsigned_int,
-                                scratch,
-                                copy);
-                  }
-              }
-          } // faces
-
-      // Execute the cell_worker if faces are handled before cells
-      if ((flags & cells_after_faces) &&
-          (((flags & assemble_own_cells) && own_cell) ||
-           ((flags & assemble_ghost_cells) && !own_cell)))
-        cell_worker(cell, scratch, copy);
-    };
+    const auto cell_action =
+      internal::make_cell_action<CellIteratorBaseType, ScratchData, CopyData>(
+        cell_worker, sample_copy_data, flags, boundary_worker, face_worker);
 
     // Submit to workstream
     WorkStream::run(begin,
@@ -637,6 +683,145 @@ namespace MeshWorker
                     chunk_size);
   }
 
+
+
+  /**
+   * Same as the function above, but the cells to be worked on are described
+   * by a set of "colored" iterators, i.e., a vector of vectors of cell
+   * iterators in which all cells stored in the same inner vector (the same
+   * "color") can be worked on concurrently without their copiers conflicting
+   * with each other.
+   *
+   * This overload corresponds to the colored variant of WorkStream::run():
+   * within each color, the worker functions *and* the @p copier are executed
+   * in parallel on different cells without any synchronization between the
+   * copier invocations. The pipelined WorkStream implementation that backs
+   * the uncolored mesh_loop() overloads instead funnels all CopyData objects
+   * through a single, sequential copier stage; when the work done per cell
+   * and face is cheap -- as is often the case for the numerous face terms of
+   * discontinuous Galerkin discretizations -- that copier stage becomes the
+   * bottleneck that limits parallel scalability. With colored iterators, no
+   * such serialization takes place.
+   *
+   * A suitable coloring can be computed with
+   * GraphColoring::make_graph_coloring(). Since the @p copier scatters
+   * contributions not only into the matrix and vector rows of the current
+   * cell but -- if face terms are assembled -- also into those of its
+   * neighbors, the conflict indices returned for a cell must contain the
+   * degrees of freedom of the cell *and* of all of its face neighbors:
+   * @code
+   * using CellIteratorType = decltype(dof_handler.begin_active());
+   *
+   * const auto conflict_indices =
+   *   [](const CellIteratorType &cell)
+   *     -> std::vector<types::global_dof_index> {
+   *   std::vector<types::global_dof_index> indices(
+   *     cell->get_fe().n_dofs_per_cell());
+   *   cell->get_dof_indices(indices);
+   *
+   *   for (const unsigned int f : cell->face_indices())
+   *     if ((cell->at_boundary(f) == false) &&
+   *         (cell->neighbor(f)->has_children() == false))
+   *       {
+   *         std::vector<types::global_dof_index> neighbor_indices(
+   *           cell->neighbor(f)->get_fe().n_dofs_per_cell());
+   *         cell->neighbor(f)->get_dof_indices(neighbor_indices);
+   *         indices.insert(indices.end(),
+   *                        neighbor_indices.begin(),
+   *                        neighbor_indices.end());
+   *       }
+   *   return indices;
+   * };
+   *
+   * const std::vector<std::vector<CellIteratorType>> colored_iterators =
+   *   GraphColoring::make_graph_coloring(dof_handler.begin_active(),
+   *                                      dof_handler.end(),
+   *                                      conflict_indices);
+   *
+   * MeshWorker::mesh_loop(colored_iterators,
+   *                       cell_worker, copier,
+   *                       scratch, copy,
+   *                       MeshWorker::assemble_own_cells |
+   *                         MeshWorker::assemble_own_interior_faces_once,
+   *                       boundary_worker, face_worker);
+   * @endcode
+   * (On locally refined meshes, the conflict indices also need to cover the
+   * coarser and finer neighbors that the face workers touch.)
+   *
+   * The AssembleFlags, the worker functions, and the ScratchData and
+   * CopyData concepts have the same meaning as in the other mesh_loop()
+   * overloads.
+   *
+   * @ingroup MeshWorker
+   */
+  template <typename CellIteratorType,
+            class ScratchData,
+            class CopyData,
+            typename CellIteratorBaseType =
+              typename internal::CellIteratorBaseType<CellIteratorType>::type>
+  void
+  mesh_loop(
+    const std::vector<std::vector<CellIteratorType>> &colored_iterators,
+
+    const std_cxx20::type_identity_t<std::function<
+      void(const CellIteratorBaseType &, ScratchData &, CopyData &)>>
+      &cell_worker,
+    const std_cxx20::type_identity_t<std::function<void(const CopyData &)>>
+      &copier,
+
+    const ScratchData &sample_scratch_data,
+    const CopyData    &sample_copy_data,
+
+    const AssembleFlags flags = assemble_own_cells,
+
+    const std_cxx20::type_identity_t<
+      std::function<void(const CellIteratorBaseType &,
+                         const unsigned int,
+                         ScratchData &,
+                         CopyData &)>> &boundary_worker =
+      std::function<void(const CellIteratorBaseType &,
+                         const unsigned int,
+                         ScratchData &,
+                         CopyData &)>(),
+
+    const std_cxx20::type_identity_t<
+      std::function<void(const CellIteratorBaseType &,
+                         const unsigned int,
+                         const unsigned int,
+                         const CellIteratorBaseType &,
+                         const unsigned int,
+                         const unsigned int,
+                         ScratchData &,
+                         CopyData &)>> &face_worker =
+      std::function<void(const CellIteratorBaseType &,
+                         const unsigned int,
+                         const unsigned int,
+                         const CellIteratorBaseType &,
+                         const unsigned int,
+                         const unsigned int,
+                         ScratchData &,
+                         CopyData &)>(),
+
+    const unsigned int queue_length = 2 * MultithreadInfo::n_threads(),
+    const unsigned int chunk_size   = 8)
+  {
+    const auto cell_action =
+      internal::make_cell_action<CellIteratorBaseType, ScratchData, CopyData>(
+        cell_worker, sample_copy_data, flags, boundary_worker, face_worker);
+
+    // Submit to the colored version of workstream, which runs the copier
+    // concurrently on all cells of one color.
+    WorkStream::run(colored_iterators,
+                    cell_action,
+                    copier,
+                    sample_scratch_data,
+                    sample_copy_data,
+                    queue_length,
+                    chunk_size);
+  }
+
+
+
   /**
    * Same as the function above, but for iterator ranges (and, therefore,
    * filtered iterators).
@@ -31,6 +31,10 @@
 #include <boost/any.hpp>
 
 #include <algorithm>
+#include <map>
+#include <string>
+#include <tuple>
+#include <typeindex>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -1344,10 +1348,15 @@ namespace MeshWorker
   private:
     /**
      * Construct a unique name to store vectors of values, gradients,
-     * divergences, etc., in the internal GeneralDataStorage object.
+     * divergences, etc., in the internal GeneralDataStorage object. Since
+     * building these names involves a number of string concatenations and a
+     * call that demangles the name of the type @p Number, and since this
+     * function is called on every cell for every evaluated quantity, the
+     * constructed names are cached in #unique_names_cache and only built the
+     * first time a given quantity is requested.
      */
     template <typename Extractor, typename Number = double>
-    std::string
+    const std::string &
     get_unique_name(const std::string &global_vector_name,
                     const Extractor   &variable,
                     const std::string &object_type,
@@ -1355,10 +1364,12 @@ namespace MeshWorker
                     const Number      &exemplar_number) const;
 
     /**
-     * Construct a unique name to store local dof values.
+     * Construct a unique name to store local dof values. Like
+     * get_unique_name(), this function caches the constructed names in
+     * #unique_names_cache.
      */
     template <typename Number = double>
-    std::string
+    const std::string &
     get_unique_dofs_name(const std::string &global_vector_name,
                          const unsigned int size,
                          const Number      &exemplar_number) const;
@@ -1561,6 +1572,22 @@ namespace MeshWorker
      */
     GeneralDataStorage internal_data_storage;
 
+    /**
+     * A cache for the names built by get_unique_name() and
+     * get_unique_dofs_name(), indexed by the name of the global vector, the
+     * name of the extractor, the type of the stored object, its size, and
+     * the type of the stored numbers. Like the rest of this class, the cache
+     * is not protected by a mutex: each thread of a WorkStream loop works on
+     * its own copy of this class.
+     */
+    mutable std::map<std::tuple<std::string,
+                                std::string,
+                                std::string,
+                                unsigned int,
+                                std::type_index>,
+                     std::string>
+      unique_names_cache;
+
     /**
      * A pointer to the last used FEValues/FEFaceValues, or FESubfaceValues
      * object on this cell.
@@ -1577,7 +1604,7 @@ namespace MeshWorker
 #ifndef DOXYGEN
   template <int dim, int spacedim>
   template <typename Extractor, typename Number>
-  std::string
+  const std::string &
   ScratchData<dim, spacedim>::get_unique_name(
     const std::string &global_vector_name,
     const Extractor   &variable,
@@ -1585,24 +1612,48 @@ namespace MeshWorker
     const unsigned int size,
     const Number      &exemplar_number) const
   {
-    return global_vector_name + "_" + variable.get_name() + "_" + object_type +
-           "_" + Utilities::int_to_string(size) + "_" +
-           Utilities::type_to_string(exemplar_number);
+    const auto key = std::make_tuple(global_vector_name,
+                                     variable.get_name(),
+                                     object_type,
+                                     size,
+                                     std::type_index(typeid(Number)));
+
+    auto it = unique_names_cache.find(key);
+    if (it == unique_names_cache.end())
+      it = unique_names_cache
+             .emplace(key,
+                      global_vector_name + "_" + variable.get_name() + "_" +
+                        object_type + "_" + Utilities::int_to_string(size) +
+                        "_" + Utilities::type_to_string(exemplar_number))
+             .first;
+    return it->second;
   }
 
 
 
   template <int dim, int spacedim>
   template <typename Number>
-  std::string
+  const std::string &
   ScratchData<dim, spacedim>::get_unique_dofs_name(
     const std::string &global_vector_name,
     const unsigned int size,
     const Number      &exemplar_number) const
   {
-    return global_vector_name + "_independent_local_dofs_" +
-           Utilities::int_to_string(size) + "_" +
-           Utilities::type_to_string(exemplar_number);
+    const auto key = std::make_tuple(global_vector_name,
+                                     std::string(),
+                                     std::string("independent_local_dofs"),
+                                     size,
+                                     std::type_index(typeid(Number)));
+
+    auto it = unique_names_cache.find(key);
+    if (it == unique_names_cache.end())
+      it = unique_names_cache
+             .emplace(key,
+                      global_vector_name + "_independent_local_dofs_" +
+                        Utilities::int_to_string(size) + "_" +
+                        Utilities::type_to_string(exemplar_number))
+             .first;
+    return it->second;
   }
 
 
@@ -1617,7 +1668,7 @@ namespace MeshWorker
   {
     const unsigned int n_dofs = local_dof_indices.size();
 
-    const std::string name =
+    const std::string &name =
       get_unique_dofs_name(global_vector_name, n_dofs, dummy);
 
     auto &independent_local_dofs =
@@ -1650,7 +1701,7 @@ namespace MeshWorker
   {
     const unsigned int n_dofs = local_dof_indices.size();
 
-    const std::string dofs_name =
+    const std::string &dofs_name =
       get_unique_dofs_name(global_vector_name, n_dofs, dummy);
 
     Assert(
@@ -1679,7 +1730,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = fev.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_values_q", n_q_points, dummy);
 
     // Now build the return type
@@ -1716,7 +1767,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = fev.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_gradients_q", n_q_points, dummy);
 
     // Now build the return type
@@ -1753,7 +1804,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = fev.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_hessians_q", n_q_points, dummy);
 
     // Now build the return type
@@ -1791,7 +1842,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = fev.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_laplacians_q", n_q_points, dummy);
 
     // Now build the return type
@@ -1829,7 +1880,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = fev.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_third_derivatives_q", n_q_points, dummy);
 
     // Now build the return type
@@ -1867,7 +1918,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = fev.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_symmetric_gradient_q", n_q_points, dummy);
 
 
@@ -1905,7 +1956,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = fev.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_divergence_q", n_q_points, dummy);
 
     // Now build the return type
@@ -1942,7 +1993,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = fev.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_curl_q", n_q_points, dummy);
 
     // Now build the return type
@@ -1983,7 +2034,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = feiv.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_jump_values_q", n_q_points, dummy);
 
     // Now build the return type
@@ -2024,7 +2075,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = feiv.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_jump_gradients_q", n_q_points, dummy);
 
     // Now build the return type
@@ -2065,7 +2116,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = feiv.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_jump_hessians_q", n_q_points, dummy);
 
     // Now build the return type
@@ -2106,7 +2157,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = feiv.n_quadrature_points;
 
-    const std::string name = get_unique_name(global_vector_name,
+    const std::string &name = get_unique_name(global_vector_name,
                                              variable,
                                              "_jump_third_derivatives_q",
                                              n_q_points,
@@ -2150,7 +2201,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = feiv.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_average_values_q", n_q_points, dummy);
 
     // Now build the return type
@@ -2191,7 +2242,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = feiv.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_average_gradients_q", n_q_points, dummy);
 
     // Now build the return type
@@ -2232,7 +2283,7 @@ namespace MeshWorker
 
     const unsigned int n_q_points = feiv.n_quadrature_points;
 
-    const std::string name = get_unique_name(
+    const std::string &name = get_unique_name(
       global_vector_name, variable, "_average_hessians_q", n_q_points, dummy);
 
     // Now build the return type
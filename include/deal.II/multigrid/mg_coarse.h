@@ -20,6 +20,7 @@
 
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/householder.h>
+#include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/linear_operator.h>
 
 #include <deal.II/multigrid/mg_base.h>
@@ -80,6 +81,68 @@ private:
 
 
 
+/**
+ * Coarse grid solver by a single application of a preconditioner, e.g., one
+ * cycle of an algebraic multigrid method.
+ *
+ * In contrast to MGCoarseGridIterativeSolver, no outer Krylov iteration is
+ * performed, so no global reductions are incurred by the coarse solve. This
+ * is attractive at large process counts, where the inner products of an
+ * iterative coarse solver are dominated by communication latency while most
+ * processes hold only a small share of the coarse problem. The approximate
+ * nature of the coarse solve is usually compensated by the outer iteration
+ * the multigrid preconditioner is embedded in. To further reduce the
+ * process count that participates in the coarse solve, the coarse level can
+ * be partitioned onto a subset of the processes with
+ * RepartitioningPolicyTools::MinimalGranularityPolicy before setting up the
+ * level operators.
+ */
+template <typename VectorType, typename PreconditionerType>
+class MGCoarseGridApplyPreconditioner : public MGCoarseGridBase<VectorType>
+{
+public:
+  /**
+   * Default constructor.
+   */
+  MGCoarseGridApplyPreconditioner();
+
+  /**
+   * Constructor. Store a pointer to the preconditioner for later use.
+   */
+  MGCoarseGridApplyPreconditioner(const PreconditionerType &precondition);
+
+  /**
+   * Clear the pointer.
+   */
+  void
+  clear();
+
+  /**
+   * Initialize new data.
+   */
+  void
+  initialize(const PreconditionerType &precondition);
+
+  /**
+   * Implementation of the abstract function.
+   */
+  virtual void
+  operator()(const unsigned int level,
+             VectorType        &dst,
+             const VectorType  &src) const override;
+
+private:
+  /**
+   * Reference to the preconditioner.
+   */
+  SmartPointer<
+    const PreconditionerType,
+    MGCoarseGridApplyPreconditioner<VectorType, PreconditionerType>>
+    preconditioner;
+};
+
+
+
 /**
  * Coarse grid multigrid operator for an iterative solver.
  *
@@ -285,6 +348,99 @@ MGCoarseGridApplySmoother<VectorType>::operator()(const unsigned int level,
   coarse_smooth->apply(level, dst, src);
 }
 
+/* ------------- Functions for MGCoarseGridApplyPreconditioner ---------- */
+
+template <typename VectorType, typename PreconditionerType>
+MGCoarseGridApplyPreconditioner<VectorType, PreconditionerType>::
+  MGCoarseGridApplyPreconditioner()
+  : preconditioner(nullptr, typeid(*this).name())
+{}
+
+
+
+template <typename VectorType, typename PreconditionerType>
+MGCoarseGridApplyPreconditioner<VectorType, PreconditionerType>::
+  MGCoarseGridApplyPreconditioner(const PreconditionerType &preconditioner)
+  : preconditioner(&preconditioner, typeid(*this).name())
+{}
+
+
+
+template <typename VectorType, typename PreconditionerType>
+void
+MGCoarseGridApplyPreconditioner<VectorType, PreconditionerType>::initialize(
+  const PreconditionerType &preconditioner_)
+{
+  preconditioner = &preconditioner_;
+}
+
+
+
+template <typename VectorType, typename PreconditionerType>
+void
+MGCoarseGridApplyPreconditioner<VectorType, PreconditionerType>::clear()
+{
+  preconditioner = nullptr;
+}
+
+
+
+namespace internal
+{
+  namespace MGCoarseGridApplyPreconditioner
+  {
+    template <typename VectorType,
+              typename PreconditionerType,
+              std::enable_if_t<
+                std::is_same_v<typename VectorType::value_type, double>,
+                VectorType> * = nullptr>
+    void
+    solve(const PreconditionerType &preconditioner,
+          VectorType               &dst,
+          const VectorType         &src)
+    {
+      preconditioner.vmult(dst, src);
+    }
+
+    template <typename VectorType,
+              typename PreconditionerType,
+              std::enable_if_t<
+                !std::is_same_v<typename VectorType::value_type, double>,
+                VectorType> * = nullptr>
+    void
+    solve(const PreconditionerType &preconditioner,
+          VectorType               &dst,
+          const VectorType         &src)
+    {
+      // to avoid a compile-time error for preconditioners that only work
+      // on double vectors, copy over to a temporary double vector
+      LinearAlgebra::distributed::Vector<double> src_;
+      LinearAlgebra::distributed::Vector<double> dst_;
+
+      src_ = src;
+      dst_ = dst;
+
+      preconditioner.vmult(dst_, src_);
+
+      dst = dst_;
+    }
+  } // namespace MGCoarseGridApplyPreconditioner
+} // namespace internal
+
+
+
+template <typename VectorType, typename PreconditionerType>
+void
+MGCoarseGridApplyPreconditioner<VectorType, PreconditionerType>::operator()(
+  const unsigned int /*level*/,
+  VectorType        &dst,
+  const VectorType  &src) const
+{
+  Assert(preconditioner != nullptr, ExcNotInitialized());
+
+  internal::MGCoarseGridApplyPreconditioner::solve(*preconditioner, dst, src);
+}
+
 /* ------------------ Functions for MGCoarseGridIterativeSolver ------------ */
 
 template <typename VectorType,
@@ -17,6 +17,7 @@
 
 #include <deal.II/base/mg_level_object.h>
 #include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/vectorization.h>
 
 #include <deal.II/dofs/dof_handler.h>
@@ -299,6 +300,21 @@ protected:
   void
   update_ghost_values(const VectorType &vec) const;
 
+  /**
+   * Start the communication of update_ghost_values(). The counterpart
+   * update_ghost_values_finish() must be called before the ghost entries
+   * of @p vec are read, which allows overlapping the communication with
+   * independent local work.
+   */
+  void
+  update_ghost_values_start(const VectorType &vec) const;
+
+  /**
+   * Finish the communication started by update_ghost_values_start().
+   */
+  void
+  update_ghost_values_finish(const VectorType &vec) const;
+
   /**
    * A wrapper around compress() optimized in case the
    * present vector has the same parallel layout of one of the external
@@ -307,6 +323,21 @@ protected:
   void
   compress(VectorType &vec, const VectorOperation::values op) const;
 
+  /**
+   * Start the communication of compress(). The counterpart
+   * compress_finish() must be called before the locally owned entries of
+   * @p vec are read, which allows overlapping the communication with
+   * independent local work.
+   */
+  void
+  compress_start(VectorType &vec, const VectorOperation::values op) const;
+
+  /**
+   * Finish the communication started by compress_start().
+   */
+  void
+  compress_finish(VectorType &vec, const VectorOperation::values op) const;
+
   /**
    * A wrapper around zero_out_ghost_values() optimized in case the
    * present vector has the same parallel layout of one of the external
@@ -393,6 +424,19 @@ protected:
    * are a subset of an external Partitioner object.
    */
   mutable AlignedVector<Number> buffer_fine_embedded;
+
+  /**
+   * Outstanding communication requests of split-phase exchanges on the
+   * coarse level, kept here so that the communication can be finished by a
+   * later call than the one that started it.
+   */
+  mutable std::vector<MPI_Request> requests_coarse_embedded;
+
+  /**
+   * Outstanding communication requests of split-phase exchanges on the
+   * fine level.
+   */
+  mutable std::vector<MPI_Request> requests_fine_embedded;
 };
 
 
@@ -460,6 +504,32 @@ public:
     const unsigned int mg_level_fine   = numbers::invalid_unsigned_int,
     const unsigned int mg_level_coarse = numbers::invalid_unsigned_int);
 
+  /**
+   * Set up polynomial coarsening between the given DoFHandler object
+   * @p dof_handler_fine and the coarse finite element @p fe_coarse without
+   * creating a coarse DoFHandler. Since enumerating the coarse degrees of
+   * freedom via DoFHandler::distribute_dofs() is skipped, this setup path
+   * is considerably cheaper than the version above, which is relevant if
+   * a deep p-hierarchy has to be rebuilt after every mesh adaptation.
+   *
+   * The coarse degrees of freedom are enumerated cell by cell: the cell
+   * with global active cell index $c$ owns the contiguous index block
+   * $[c \cdot n, (c + 1) \cdot n)$, where $n$ is the number of degrees of
+   * freedom of @p fe_coarse, ordered lexicographically within each cell.
+   * As a consequence, @p fe_coarse has to be a discontinuous element,
+   * e.g., FE_DGQ. Coarse-level operators have to be built with respect to
+   * this enumeration, e.g., by chaining transfers of this kind or by
+   * evaluating cell-wise in lexicographic order.
+   *
+   * This function can only be used on active levels.
+   */
+  void
+  reinit_polynomial_transfer(
+    const DoFHandler<dim>           &dof_handler_fine,
+    const FiniteElement<dim>        &fe_coarse,
+    const AffineConstraints<Number> &constraint_fine =
+      AffineConstraints<Number>());
+
   /**
    * Set up transfer operator between the given DoFHandler objects (
    * @p dof_handler_fine and @p dof_handler_coarse). Depending on the
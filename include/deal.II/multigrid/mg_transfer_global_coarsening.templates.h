@@ -2622,6 +2622,375 @@ namespace internal
       // ------------------------------- weights -------------------------------
       setup_weights(constraints_fine, transfer, is_feq);
     }
+
+
+
+    /**
+     * Lightweight version of the function above that does not need a coarse
+     * DoFHandler: the coarse degrees of freedom are enumerated cell by cell
+     * (lexicographically within each cell) based on the global active cell
+     * index, which requires the coarse element to be discontinuous.
+     */
+    template <int dim, typename Number>
+    static void
+    reinit_polynomial_transfer(
+      const DoFHandler<dim>                   &dof_handler_fine,
+      const FiniteElement<dim>                &fe_coarse,
+      const dealii::AffineConstraints<Number> &constraints_fine,
+      MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>
+        &transfer)
+    {
+      AssertDimension(constraints_fine.n_inhomogeneities(), 0);
+
+      Assert(fe_coarse.n_dofs_per_cell() == 0 ||
+               fe_coarse.n_dofs_per_vertex() == 0,
+             ExcMessage(
+               "The lightweight polynomial transfer enumerates the coarse "
+               "degrees of freedom cell by cell and, hence, requires a "
+               "discontinuous coarse element."));
+      AssertDimension(fe_coarse.n_base_elements(), 1);
+
+      const unsigned int mg_level_fine = numbers::invalid_unsigned_int;
+
+      transfer.dof_handler_fine = &dof_handler_fine;
+      transfer.mg_level_fine    = mg_level_fine;
+
+      // extract number of components
+      AssertDimension(dof_handler_fine.get_fe_collection().n_components(),
+                      fe_coarse.n_components());
+
+      transfer.n_components = fe_coarse.n_components();
+
+      transfer.fine_element_is_continuous =
+        std::all_of(dof_handler_fine.get_fe_collection().begin(),
+                    dof_handler_fine.get_fe_collection().end(),
+                    [](const auto &fe) {
+                      return fe.n_dofs_per_cell() == 0 ||
+                             fe.n_dofs_per_vertex() > 0;
+                    });
+
+#ifdef DEBUG
+      const bool fine_element_is_discontinuous =
+        std::all_of(dof_handler_fine.get_fe_collection().begin(),
+                    dof_handler_fine.get_fe_collection().end(),
+                    [](const auto &fe) {
+                      return fe.n_dofs_per_cell() == 0 ||
+                             fe.n_dofs_per_vertex() == 0;
+                    });
+
+      Assert(transfer.fine_element_is_continuous !=
+               fine_element_is_discontinuous,
+             ExcNotImplemented());
+#endif
+
+      const bool is_feq =
+        std::all_of(dof_handler_fine.get_fe_collection().begin(),
+                    dof_handler_fine.get_fe_collection().end(),
+                    [](const auto &fe) {
+                      return fe.n_base_elements() == 1 &&
+                             (dynamic_cast<const FE_Q<dim> *>(
+                                &fe.base_element(0)) != nullptr);
+                    });
+
+      const auto process_cells = [&](const auto &fu) {
+        loop_over_active_or_level_cells(dof_handler_fine, mg_level_fine, fu);
+      };
+
+      // one scheme per fine finite-element index in use
+      std::map<unsigned int, unsigned int> fe_indices;
+
+      process_cells([&](const auto &cell) {
+        fe_indices.emplace(cell->active_fe_index(), 0);
+      });
+
+      unsigned int counter = 0;
+      for (auto &f : fe_indices)
+        f.second = counter++;
+
+      transfer.schemes.resize(fe_indices.size());
+
+      // extract number of coarse cells
+      {
+        for (auto &scheme : transfer.schemes)
+          scheme.n_coarse_cells = 0;
+        process_cells([&](const auto &cell) {
+          transfer.schemes[fe_indices[cell->active_fe_index()]]
+            .n_coarse_cells++;
+        });
+      }
+
+      for (const auto &fe_index : fe_indices)
+        {
+          auto &scheme = transfer.schemes[fe_index.second];
+
+          scheme.n_dofs_per_cell_coarse = fe_coarse.n_dofs_per_cell();
+          scheme.n_dofs_per_cell_fine =
+            dof_handler_fine.get_fe(fe_index.first).n_dofs_per_cell();
+
+          scheme.degree_coarse = fe_coarse.degree;
+          scheme.degree_fine   = dof_handler_fine.get_fe(fe_index.first).degree;
+        }
+
+      std::vector<unsigned int> cell_no(fe_indices.size() + 1, 0);
+      for (const auto &fe_index : fe_indices)
+        cell_no[fe_index.second + 1] =
+          transfer.schemes[fe_index.second].n_coarse_cells;
+      for (unsigned int i = 0; i < fe_indices.size(); ++i)
+        cell_no[i + 1] += cell_no[i];
+
+      // ------------------- lexicographic_numbering  --------------------
+      std::vector<std::vector<unsigned int>> lexicographic_numbering_fine(
+        fe_indices.size());
+
+      for (const auto &fe_index : fe_indices)
+        {
+          const auto &fe = dof_handler_fine.get_fe(fe_index.first);
+
+          const auto reference_cell = fe.reference_cell();
+
+          Assert(reference_cell == fe_coarse.reference_cell(),
+                 ExcNotImplemented());
+
+          if (reference_cell == ReferenceCells::get_hypercube<dim>())
+            {
+              const Quadrature<1> dummy_quadrature(
+                std::vector<Point<1>>(1, Point<1>()));
+              internal::MatrixFreeFunctions::ShapeInfo<VectorizedArray<Number>>
+                shape_info;
+              shape_info.reinit(dummy_quadrature, fe, 0);
+              lexicographic_numbering_fine[fe_index.second] =
+                shape_info.lexicographic_numbering;
+            }
+          else
+            {
+              const auto dummy_quadrature =
+                reference_cell.template get_gauss_type_quadrature<dim>(1);
+
+              internal::MatrixFreeFunctions::ShapeInfo<Number> shape_info;
+              shape_info.reinit(dummy_quadrature, fe, 0);
+              lexicographic_numbering_fine[fe_index.second] =
+                shape_info.lexicographic_numbering;
+            }
+        }
+
+      // ------------------------------ indices  -----------------------------
+
+      // The coarse DoFs are enumerated without a DoFHandler: cell c owns the
+      // contiguous index block [c * n, (c + 1) * n) with c the global active
+      // cell index and n the number of DoFs of the coarse element, ordered
+      // lexicographically within each cell.
+      const types::global_dof_index n_dofs_per_cell_coarse =
+        fe_coarse.n_dofs_per_cell();
+
+      IndexSet locally_owned_dofs_coarse(
+        dof_handler_fine.get_triangulation().n_global_active_cells() *
+        n_dofs_per_cell_coarse);
+      process_cells([&](const auto &cell) {
+        const types::global_dof_index first =
+          cell->global_active_cell_index() * n_dofs_per_cell_coarse;
+        locally_owned_dofs_coarse.add_range(first,
+                                            first + n_dofs_per_cell_coarse);
+      });
+      locally_owned_dofs_coarse.compress();
+
+      transfer.constraint_info_coarse.reinit(cell_no.back());
+      transfer.constraint_info_coarse.set_locally_owned_indices(
+        locally_owned_dofs_coarse);
+
+      transfer.constraint_info_fine.reinit(cell_no.back());
+      transfer.constraint_info_fine.set_locally_owned_indices(
+        dof_handler_fine.locally_owned_dofs());
+
+      std::vector<types::global_dof_index> local_dof_indices_coarse(
+        n_dofs_per_cell_coarse);
+      std::vector<std::vector<types::global_dof_index>> local_dof_indices_fine(
+        fe_indices.size());
+      std::vector<std::vector<types::global_dof_index>>
+        local_dof_indices_fine_lex(fe_indices.size());
+
+      for (const auto &fe_index : fe_indices)
+        {
+          local_dof_indices_fine[fe_index.second].resize(
+            transfer.schemes[fe_index.second].n_dofs_per_cell_fine);
+          local_dof_indices_fine_lex[fe_index.second].resize(
+            transfer.schemes[fe_index.second].n_dofs_per_cell_fine);
+        }
+
+      process_cells([&](const auto &cell) {
+        const auto fe_no = fe_indices[cell->active_fe_index()];
+
+        // parent: contiguous block of synthetic coarse indices
+        {
+          const types::global_dof_index first =
+            cell->global_active_cell_index() * n_dofs_per_cell_coarse;
+          for (unsigned int i = 0; i < n_dofs_per_cell_coarse; ++i)
+            local_dof_indices_coarse[i] = first + i;
+
+          transfer.constraint_info_coarse.read_dof_indices(
+            cell_no[fe_no], local_dof_indices_coarse, {});
+        }
+
+        // child
+        {
+          cell->get_dof_indices(local_dof_indices_fine[fe_no]);
+
+          for (unsigned int i = 0;
+               i < transfer.schemes[fe_no].n_dofs_per_cell_fine;
+               ++i)
+            local_dof_indices_fine_lex[fe_no][i] = local_dof_indices_fine
+              [fe_no][lexicographic_numbering_fine[fe_no][i]];
+
+          transfer.constraint_info_fine.read_dof_indices(
+            cell_no[fe_no], local_dof_indices_fine_lex[fe_no], {});
+        }
+
+        // move pointers
+        {
+          cell_no[fe_no]++;
+        }
+      });
+
+      {
+        transfer.partitioner_coarse = transfer.constraint_info_coarse.finalize(
+          dof_handler_fine.get_communicator());
+        transfer.vec_coarse.reinit(transfer.partitioner_coarse);
+
+        transfer.partitioner_fine = transfer.constraint_info_fine.finalize(
+          dof_handler_fine.get_communicator());
+        transfer.vec_fine.reinit(transfer.partitioner_fine);
+      }
+
+      // ------------------------- prolongation matrix -------------------------
+      for (const auto &fe_index : fe_indices)
+        {
+          const auto &fe_fine_full = dof_handler_fine.get_fe(fe_index.first);
+          const auto &fe_index_no  = fe_index.second;
+
+          AssertDimension(fe_fine_full.n_base_elements(), 1);
+
+          const auto reference_cell = fe_fine_full.reference_cell();
+
+          if (reference_cell == ReferenceCells::get_hypercube<dim>() &&
+              (fe_coarse != fe_fine_full) &&
+              (fe_coarse.n_dofs_per_cell() != 0 &&
+               fe_fine_full.n_dofs_per_cell() != 0))
+            {
+              const auto fe_fine = create_1D_fe(fe_fine_full.base_element(0));
+
+              std::vector<unsigned int> renumbering_fine(
+                fe_fine->n_dofs_per_cell());
+              {
+                AssertIndexRange(fe_fine->n_dofs_per_vertex(), 2);
+                renumbering_fine[0] = 0;
+                for (unsigned int i = 0; i < fe_fine->dofs_per_line; ++i)
+                  renumbering_fine[i + fe_fine->n_dofs_per_vertex()] =
+                    GeometryInfo<1>::vertices_per_cell *
+                      fe_fine->n_dofs_per_vertex() +
+                    i;
+                if (fe_fine->n_dofs_per_vertex() > 0)
+                  renumbering_fine[fe_fine->n_dofs_per_cell() -
+                                   fe_fine->n_dofs_per_vertex()] =
+                    fe_fine->n_dofs_per_vertex();
+              }
+
+              const auto fe_coarse_1d = create_1D_fe(fe_coarse.base_element(0));
+
+              std::vector<unsigned int> renumbering_coarse(
+                fe_coarse_1d->n_dofs_per_cell());
+              {
+                AssertIndexRange(fe_coarse_1d->n_dofs_per_vertex(), 2);
+                renumbering_coarse[0] = 0;
+                for (unsigned int i = 0; i < fe_coarse_1d->dofs_per_line; ++i)
+                  renumbering_coarse[i + fe_coarse_1d->n_dofs_per_vertex()] =
+                    GeometryInfo<1>::vertices_per_cell *
+                      fe_coarse_1d->n_dofs_per_vertex() +
+                    i;
+                if (fe_coarse_1d->n_dofs_per_vertex() > 0)
+                  renumbering_coarse[fe_coarse_1d->n_dofs_per_cell() -
+                                     fe_coarse_1d->n_dofs_per_vertex()] =
+                    fe_coarse_1d->n_dofs_per_vertex();
+              }
+
+              {
+                FullMatrix<double> matrix(fe_fine->n_dofs_per_cell(),
+                                          fe_coarse_1d->n_dofs_per_cell());
+                FETools::get_projection_matrix(*fe_coarse_1d, *fe_fine, matrix);
+                transfer.schemes[fe_index_no].prolongation_matrix_1d.resize(
+                  fe_fine->n_dofs_per_cell() *
+                  fe_coarse_1d->n_dofs_per_cell());
+
+                for (unsigned int i = 0, k = 0;
+                     i < fe_coarse_1d->n_dofs_per_cell();
+                     ++i)
+                  for (unsigned int j = 0; j < fe_fine->n_dofs_per_cell();
+                       ++j, ++k)
+                    transfer.schemes[fe_index_no].prolongation_matrix_1d[k] =
+                      matrix(renumbering_fine[j], renumbering_coarse[i]);
+              }
+
+              {
+                FullMatrix<double> matrix(fe_coarse_1d->n_dofs_per_cell(),
+                                          fe_fine->n_dofs_per_cell());
+                FETools::get_projection_matrix(*fe_fine, *fe_coarse_1d, matrix);
+                transfer.schemes[fe_index_no].restriction_matrix_1d.resize(
+                  fe_fine->n_dofs_per_cell() *
+                  fe_coarse_1d->n_dofs_per_cell());
+
+                for (unsigned int i = 0, k = 0;
+                     i < fe_coarse_1d->n_dofs_per_cell();
+                     ++i)
+                  for (unsigned int j = 0; j < fe_fine->n_dofs_per_cell();
+                       ++j, ++k)
+                    transfer.schemes[fe_index_no].restriction_matrix_1d[k] =
+                      matrix(renumbering_coarse[i], renumbering_fine[j]);
+              }
+            }
+          else if (reference_cell != ReferenceCells::get_hypercube<dim>() &&
+                   (fe_coarse != fe_fine_full) &&
+                   (fe_coarse.n_dofs_per_cell() != 0 &&
+                    fe_fine_full.n_dofs_per_cell() != 0))
+            {
+              const auto &fe_fine = fe_fine_full.base_element(0);
+
+              const auto &fe_coarse_base = fe_coarse.base_element(0);
+
+              {
+                FullMatrix<double> matrix(fe_fine.n_dofs_per_cell(),
+                                          fe_coarse_base.n_dofs_per_cell());
+                FETools::get_projection_matrix(fe_coarse_base, fe_fine, matrix);
+                transfer.schemes[fe_index_no].prolongation_matrix.resize(
+                  fe_fine.n_dofs_per_cell() * fe_coarse_base.n_dofs_per_cell());
+
+                for (unsigned int i = 0, k = 0;
+                     i < fe_coarse_base.n_dofs_per_cell();
+                     ++i)
+                  for (unsigned int j = 0; j < fe_fine.n_dofs_per_cell();
+                       ++j, ++k)
+                    transfer.schemes[fe_index_no].prolongation_matrix[k] =
+                      matrix(j, i);
+              }
+
+              {
+                FullMatrix<double> matrix(fe_coarse_base.n_dofs_per_cell(),
+                                          fe_fine.n_dofs_per_cell());
+                FETools::get_projection_matrix(fe_fine, fe_coarse_base, matrix);
+                transfer.schemes[fe_index_no].restriction_matrix.resize(
+                  fe_fine.n_dofs_per_cell() * fe_coarse_base.n_dofs_per_cell());
+
+                for (unsigned int i = 0, k = 0;
+                     i < fe_coarse_base.n_dofs_per_cell();
+                     ++i)
+                  for (unsigned int j = 0; j < fe_fine.n_dofs_per_cell();
+                       ++j, ++k)
+                    transfer.schemes[fe_index_no].restriction_matrix[k] =
+                      matrix(i, j);
+              }
+            }
+        }
+
+      // ------------------------------- weights -------------------------------
+      setup_weights(constraints_fine, transfer, is_feq);
+    }
   };
 
 
@@ -2635,6 +3004,22 @@ namespace internal
       AlignedVector<Number> &buffer)
       : embedded_partitioner(embedded_partitioner)
       , buffer(buffer)
+      , requests(own_requests)
+    {}
+
+    /**
+     * Constructor taking external storage for the communication requests,
+     * which allows the communication started by one of the `_start()`
+     * functions to be finished by a later instance of this class.
+     */
+    SimpleVectorDataExchange(
+      const std::shared_ptr<const Utilities::MPI::Partitioner>
+                               &embedded_partitioner,
+      AlignedVector<Number>    &buffer,
+      std::vector<MPI_Request> &external_requests)
+      : embedded_partitioner(embedded_partitioner)
+      , buffer(buffer)
+      , requests(external_requests)
     {}
 
     template <typename VectorType>
@@ -2771,9 +3156,10 @@ namespace internal
 
   private:
     const std::shared_ptr<const Utilities::MPI::Partitioner>
-                                     embedded_partitioner;
-    dealii::AlignedVector<Number>   &buffer;
-    mutable std::vector<MPI_Request> requests;
+                                      embedded_partitioner;
+    dealii::AlignedVector<Number>    &buffer;
+    mutable std::vector<MPI_Request>  own_requests;
+    std::vector<MPI_Request>         &requests;
   };
 
 } // namespace internal
@@ -3036,12 +3422,20 @@ MGTwoLevelTransferBase<VectorType>::prolongate_and_add(
   if (use_src_inplace == false)
     this->vec_coarse.copy_locally_owned_data_from(src);
 
-  if ((use_src_inplace == false) || (src_ghosts_have_been_set == false))
-    this->update_ghost_values(*vec_coarse_ptr);
+  const bool coarse_ghosts_need_update =
+    (use_src_inplace == false) || (src_ghosts_have_been_set == false);
+
+  // start the ghost-value update on the coarse vector and overlap the
+  // communication with zeroing the intermediate fine vector
+  if (coarse_ghosts_need_update)
+    this->update_ghost_values_start(*vec_coarse_ptr);
 
   if (use_dst_inplace == false)
     *vec_fine_ptr = Number(0.);
 
+  if (coarse_ghosts_need_update)
+    this->update_ghost_values_finish(*vec_coarse_ptr);
+
   this->prolongate_and_add_internal(*vec_fine_ptr, *vec_coarse_ptr);
 
   if (this->vec_fine_needs_ghost_update || use_dst_inplace == false)
@@ -3207,9 +3601,14 @@ MGTwoLevelTransferBase<VectorType>::restrict_and_add(
   if (use_src_inplace == false)
     this->vec_fine.copy_locally_owned_data_from(src);
 
-  if ((use_src_inplace == false) ||
-      (vec_fine_needs_ghost_update && (src_ghosts_have_been_set == false)))
-    this->update_ghost_values(*vec_fine_ptr);
+  const bool fine_ghosts_need_update =
+    (use_src_inplace == false) ||
+    (vec_fine_needs_ghost_update && (src_ghosts_have_been_set == false));
+
+  // start the ghost-value update on the fine vector and overlap the
+  // communication with preparing the coarse vector
+  if (fine_ghosts_need_update)
+    this->update_ghost_values_start(*vec_fine_ptr);
 
   if (use_dst_inplace == false)
     *vec_coarse_ptr = Number(0.0);
@@ -3218,9 +3617,15 @@ MGTwoLevelTransferBase<VectorType>::restrict_and_add(
     *vec_coarse_ptr); // since we might add into the
                       // ghost values and call compress
 
+  if (fine_ghosts_need_update)
+    this->update_ghost_values_finish(*vec_fine_ptr);
+
   this->restrict_and_add_internal(*vec_coarse_ptr, *vec_fine_ptr);
 
-  // clean up related to update_ghost_values()
+  // start the compress operation on the coarse vector and overlap the
+  // communication with the clean-up related to update_ghost_values()
+  this->compress_start(*vec_coarse_ptr, VectorOperation::add);
+
   if (vec_fine_needs_ghost_update == false && use_src_inplace == false)
     this->zero_out_ghost_values(*vec_fine_ptr); // internal vector (DG)
   else if (vec_fine_needs_ghost_update && use_src_inplace == false)
@@ -3228,7 +3633,7 @@ MGTwoLevelTransferBase<VectorType>::restrict_and_add(
   else if (vec_fine_needs_ghost_update && (src_ghosts_have_been_set == false))
     this->zero_out_ghost_values(*vec_fine_ptr); // external vector
 
-  this->compress(*vec_coarse_ptr, VectorOperation::add);
+  this->compress_finish(*vec_coarse_ptr, VectorOperation::add);
 
   if (use_dst_inplace == false)
     dst += this->vec_coarse;
@@ -3681,6 +4086,19 @@ MGTwoLevelTransfer<dim, VectorType>::reinit_polynomial_transfer(
 
 
 
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::reinit_polynomial_transfer(
+  const DoFHandler<dim>           &dof_handler_fine,
+  const FiniteElement<dim>        &fe_coarse,
+  const AffineConstraints<Number> &constraints_fine)
+{
+  internal::MGTwoLevelTransferImplementation::reinit_polynomial_transfer(
+    dof_handler_fine, fe_coarse, constraints_fine, *this);
+}
+
+
+
 template <int dim, typename VectorType>
 void
 MGTwoLevelTransfer<dim, VectorType>::reinit(
@@ -3836,6 +4254,54 @@ MGTwoLevelTransferBase<VectorType>::update_ghost_values(
 
 
 
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::update_ghost_values_start(
+  const VectorType &vec) const
+{
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .update_ghost_values_start(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .update_ghost_values_start(vec);
+  else
+    vec.update_ghost_values_start();
+}
+
+
+
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::update_ghost_values_finish(
+  const VectorType &vec) const
+{
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .update_ghost_values_finish(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .update_ghost_values_finish(vec);
+  else
+    vec.update_ghost_values_finish();
+}
+
+
+
 template <typename VectorType>
 void
 MGTwoLevelTransferBase<VectorType>::compress(
@@ -3860,6 +4326,60 @@ MGTwoLevelTransferBase<VectorType>::compress(
 
 
 
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::compress_start(
+  VectorType                   &vec,
+  const VectorOperation::values op) const
+{
+  Assert(op == VectorOperation::add, ExcNotImplemented());
+
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .compress_start(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .compress_start(vec);
+  else
+    vec.compress_start(0, op);
+}
+
+
+
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::compress_finish(
+  VectorType                   &vec,
+  const VectorOperation::values op) const
+{
+  Assert(op == VectorOperation::add, ExcNotImplemented());
+
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .compress_finish(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .compress_finish(vec);
+  else
+    vec.compress_finish(op);
+}
+
+
+
 template <typename VectorType>
 void
 MGTwoLevelTransferBase<VectorType>::zero_out_ghost_values(
@@ -0,0 +1,308 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_transfer_portable_h
+#define dealii_mg_transfer_portable_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/smartpointer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/multigrid/mg_base.h>
+#include <deal.II/multigrid/mg_constrained_dofs.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <memory>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+namespace Portable
+{
+  /**
+   * Implementation of the MGTransferBase interface for vectors stored in
+   * MemorySpace::Default, i.e., typically in device memory when deal.II is
+   * configured with a GPU backend of Kokkos. The transfer operations are
+   * implemented in a matrix-free way based on the interpolation matrices of
+   * the underlying finite element, using the same setup data as the
+   * host-side class dealii::MGTransferMatrixFree, but executing the
+   * interpolation within Kokkos kernels. As a consequence, a
+   * Multigrid::cycle() whose level operators are based on
+   * Portable::MatrixFree and whose smoothers work on
+   * LinearAlgebra::distributed::Vector with MemorySpace::Default can run
+   * without moving level vectors through host memory.
+   *
+   * Like dealii::MGTransferMatrixFree, this class currently only works for
+   * tensor-product finite elements based on FE_Q and FE_DGQ elements,
+   * including systems involving multiple components of one of these
+   * elements. Systems with different elements or other elements are
+   * currently not implemented. Furthermore, user-defined constraints
+   * attached to MGConstrainedDoFs are not supported, whereas Dirichlet
+   * boundary indices are.
+   *
+   * This class implements the level transfer used within Multigrid::cycle(),
+   * i.e., prolongate(), prolongate_and_add(), and restrict_and_add(). The
+   * transfer between global and level vectors that PreconditionMG
+   * additionally requires is not implemented yet.
+   */
+  template <int dim, typename Number>
+  class MGTransferMatrixFree
+    : public MGTransferBase<
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>>
+  {
+  public:
+    /**
+     * The vector type this class operates on.
+     */
+    using VectorType =
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>;
+
+    /**
+     * Constructor without constraint matrices. Use this constructor only
+     * with discontinuous finite elements or with no local refinement.
+     */
+    MGTransferMatrixFree();
+
+    /**
+     * Constructor with constraints. Equivalent to the default constructor
+     * followed by initialize_constraints().
+     */
+    MGTransferMatrixFree(const MGConstrainedDoFs &mg_constrained_dofs);
+
+    /**
+     * Destructor.
+     */
+    virtual ~MGTransferMatrixFree() override = default;
+
+    /**
+     * Initialize the constraints to be used in build().
+     */
+    void
+    initialize_constraints(const MGConstrainedDoFs &mg_constrained_dofs);
+
+    /**
+     * Reset the object to the state it had right after the default
+     * constructor.
+     */
+    void
+    clear();
+
+    /**
+     * Actually build the information for the prolongation for each level.
+     *
+     * The optional second argument of external partitioners allows the user
+     * to suggest vector partitioning on the levels, with the same semantics
+     * as in dealii::MGTransferMatrixFree::build().
+     */
+    void
+    build(const DoFHandler<dim> &dof_handler,
+          const std::vector<std::shared_ptr<const Utilities::MPI::Partitioner>>
+            &external_partitioners =
+              std::vector<std::shared_ptr<const Utilities::MPI::Partitioner>>());
+
+    /**
+     * Prolongate a vector from level <tt>to_level-1</tt> to level
+     * <tt>to_level</tt> using the embedding matrices of the underlying
+     * finite element, overwriting @p dst.
+     */
+    virtual void
+    prolongate(const unsigned int to_level,
+               VectorType        &dst,
+               const VectorType  &src) const override;
+
+    /**
+     * Same as above, but add the result to @p dst.
+     */
+    virtual void
+    prolongate_and_add(const unsigned int to_level,
+                       VectorType        &dst,
+                       const VectorType  &src) const override;
+
+    /**
+     * Restrict a vector from level <tt>from_level</tt> to level
+     * <tt>from_level-1</tt> using the transpose operation of the
+     * prolongate() method, adding the result to @p dst.
+     */
+    virtual void
+    restrict_and_add(const unsigned int from_level,
+                     VectorType        &dst,
+                     const VectorType  &src) const override;
+
+    /**
+     * Initialize the vectors of the given MGLevelObject with the level
+     * partitioners determined during build().
+     */
+    void
+    initialize_dof_vector(MGLevelObject<VectorType> &vectors) const;
+
+    /**
+     * Memory used by this object.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * Device-resident data describing the transfer between one pair of
+     * levels. The index arrays mirror the data computed by
+     * internal::MGTransfer::setup_transfer() in scalar (non-vectorized)
+     * layout.
+     */
+    struct TransferLevel
+    {
+      /**
+       * Number of cells owned on the coarser of the two levels.
+       */
+      unsigned int n_owned_cells;
+
+      /**
+       * For each owned coarse cell, the start offset into the dof index
+       * array of the coarser level, combining the parent index and the
+       * lexicographic shift of the cell within its parent's children.
+       */
+      Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+        coarse_dof_offsets;
+
+      /**
+       * Local dof indices of the children of each owned coarse cell on the
+       * finer level, n_child_cell_dofs contiguous entries per cell.
+       */
+      Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+        level_dof_indices_fine;
+
+      /**
+       * Local dof indices on the coarser level, addressed through
+       * coarse_dof_offsets.
+       */
+      Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+        level_dof_indices_coarse;
+
+      /**
+       * Start offsets into dirichlet_indices for each owned coarse cell
+       * (compressed row storage, n_owned_cells+1 entries).
+       */
+      Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+        dirichlet_offsets;
+
+      /**
+       * Local indices (in the compact coarse-cell dof enumeration) subject
+       * to Dirichlet boundary conditions on the parent cell.
+       */
+      Kokkos::View<unsigned short *, MemorySpace::Default::kokkos_space>
+        dirichlet_indices;
+
+      /**
+       * For continuous elements, the valence weights of the degrees of
+       * freedom on the refined cells, 3<sup>dim</sup> entries per owned
+       * coarse cell.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space> weights;
+    };
+
+    /**
+     * Perform the prolongation kernel between the given level and the next
+     * coarser one, adding into @p dst. Both vectors must be ghosted
+     * according to vector_partitioners.
+     */
+    void
+    do_prolongate_add(const unsigned int to_level,
+                      VectorType        &dst,
+                      const VectorType  &src) const;
+
+    /**
+     * Perform the restriction kernel, the transpose of do_prolongate_add().
+     */
+    void
+    do_restrict_add(const unsigned int from_level,
+                    VectorType        &dst,
+                    const VectorType  &src) const;
+
+    /**
+     * A variable storing the degree of the finite element contained in the
+     * DoFHandler passed to build().
+     */
+    unsigned int fe_degree;
+
+    /**
+     * A variable storing whether the element is continuous and there is a
+     * joint degree of freedom in the center of the 1d line.
+     */
+    bool element_is_continuous;
+
+    /**
+     * A variable storing the number of components in the finite element.
+     */
+    unsigned int n_components;
+
+    /**
+     * A variable storing the number of degrees of freedom on all child
+     * cells.
+     */
+    unsigned int n_child_cell_dofs;
+
+    /**
+     * The 1d prolongation matrix from the mother element to the two
+     * children, in the row-major layout produced by
+     * internal::MGTransfer::setup_element_info().
+     */
+    Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+      prolongation_matrix_1d;
+
+    /**
+     * The device data for the transfer between level l-1 and l, stored at
+     * position l-1.
+     */
+    std::vector<TransferLevel> transfer_levels;
+
+    /**
+     * The mg_constrained_dofs of the level systems.
+     */
+    SmartPointer<const MGConstrainedDoFs, MGTransferMatrixFree<dim, Number>>
+      mg_constrained_dofs;
+
+    /**
+     * The partitioners of the level vectors the transfer kernels operate
+     * on, as determined during build().
+     */
+    MGLevelObject<std::shared_ptr<const Utilities::MPI::Partitioner>>
+      vector_partitioners;
+
+    /**
+     * Ghosted level vectors used when the vectors passed to the transfer
+     * functions do not match the partitioners of this class.
+     */
+    mutable MGLevelObject<VectorType> ghosted_level_vector;
+  };
+
+} // namespace Portable
+
+/** @} */
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
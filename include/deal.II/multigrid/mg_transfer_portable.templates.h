@@ -0,0 +1,623 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_transfer_portable_templates_h
+#define dealii_mg_transfer_portable_templates_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_consumption.h>
+
+#include <deal.II/multigrid/mg_transfer_internal.h>
+#include <deal.II/multigrid/mg_transfer_portable.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Portable
+{
+  namespace internal
+  {
+    /**
+     * Copy the contents of a host-side vector into a newly allocated
+     * device view.
+     */
+    template <typename T>
+    Kokkos::View<T *, MemorySpace::Default::kokkos_space>
+    copy_to_device(const std::vector<T> &host_data, const std::string &label)
+    {
+      Kokkos::View<T *, MemorySpace::Default::kokkos_space> device_data(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, label),
+        host_data.size());
+      Kokkos::deep_copy(device_data,
+                        Kokkos::View<const T *,
+                                     Kokkos::HostSpace,
+                                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+                          host_data.data(), host_data.size()));
+      return device_data;
+    }
+
+    /**
+     * Map a 1d index within the patch of child cells to the entity index
+     * (vertex, line, interior) used for addressing the valence weights.
+     */
+    DEAL_II_HOST_DEVICE inline unsigned int
+    weight_index_1d(const unsigned int i, const unsigned int n_points_1d)
+    {
+      return (i == 0) ? 0 : ((i == n_points_1d - 1) ? 2 : 1);
+    }
+  } // namespace internal
+
+
+
+  template <int dim, typename Number>
+  MGTransferMatrixFree<dim, Number>::MGTransferMatrixFree()
+    : fe_degree(0)
+    , element_is_continuous(false)
+    , n_components(0)
+    , n_child_cell_dofs(0)
+  {}
+
+
+
+  template <int dim, typename Number>
+  MGTransferMatrixFree<dim, Number>::MGTransferMatrixFree(
+    const MGConstrainedDoFs &mg_c)
+    : fe_degree(0)
+    , element_is_continuous(false)
+    , n_components(0)
+    , n_child_cell_dofs(0)
+    , mg_constrained_dofs(&mg_c)
+  {}
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMatrixFree<dim, Number>::initialize_constraints(
+    const MGConstrainedDoFs &mg_c)
+  {
+    mg_constrained_dofs = &mg_c;
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMatrixFree<dim, Number>::clear()
+  {
+    fe_degree             = 0;
+    element_is_continuous = false;
+    n_components          = 0;
+    n_child_cell_dofs     = 0;
+    prolongation_matrix_1d =
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>();
+    transfer_levels.clear();
+    mg_constrained_dofs = nullptr;
+    vector_partitioners.resize(0, 0);
+    ghosted_level_vector.resize(0, 0);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMatrixFree<dim, Number>::build(
+    const DoFHandler<dim> &dof_handler,
+    const std::vector<std::shared_ptr<const Utilities::MPI::Partitioner>>
+      &external_partitioners)
+  {
+    Assert(dof_handler.has_level_dofs(),
+           ExcMessage(
+             "The underlying DoFHandler object has not had its "
+             "distribute_mg_dofs() function called, but this is a prerequisite "
+             "for multigrid transfers. You will need to call this function, "
+             "probably close to where you already call distribute_dofs()."));
+
+    const unsigned int n_levels =
+      dof_handler.get_triangulation().n_global_levels();
+
+    // user-defined constraints would require distributing an
+    // AffineConstraints object onto the source vector in each prolongation,
+    // which is not implemented for device vectors
+    if (mg_constrained_dofs != nullptr)
+      for (unsigned int level = 0; level < n_levels; ++level)
+        AssertThrow(mg_constrained_dofs->get_user_constraint_matrix(level)
+                        .get_local_lines()
+                        .size() == 0,
+                    ExcNotImplemented());
+
+    // run the host-side setup of MGTransferMatrixFree and then mirror the
+    // resulting index and weight arrays into device memory
+    dealii::internal::MGTransfer::ElementInfo<Number>     elem_info;
+    std::vector<std::vector<unsigned int>>                level_dof_indices;
+    std::vector<std::vector<std::pair<unsigned int, unsigned int>>>
+                                                          parent_child_connect;
+    std::vector<unsigned int>                             n_owned_level_cells;
+    std::vector<std::vector<std::vector<unsigned short>>> dirichlet_indices;
+    std::vector<std::vector<Number>>                      weights_on_refined;
+    std::vector<Table<2, unsigned int>> copy_indices_global_mine(n_levels);
+
+    vector_partitioners.resize(0, n_levels - 1);
+
+    dealii::internal::MGTransfer::setup_transfer<dim, Number>(
+      dof_handler,
+      mg_constrained_dofs,
+      external_partitioners,
+      elem_info,
+      level_dof_indices,
+      parent_child_connect,
+      n_owned_level_cells,
+      dirichlet_indices,
+      weights_on_refined,
+      copy_indices_global_mine,
+      vector_partitioners);
+
+    fe_degree             = elem_info.fe_degree;
+    element_is_continuous = elem_info.element_is_continuous;
+    n_components          = elem_info.n_components;
+    n_child_cell_dofs     = elem_info.n_child_cell_dofs;
+
+    prolongation_matrix_1d =
+      internal::copy_to_device(elem_info.prolongation_matrix_1d,
+                               "mg_transfer::prolongation_matrix_1d");
+
+    transfer_levels.clear();
+    transfer_levels.resize(n_levels > 0 ? n_levels - 1 : 0);
+    for (unsigned int level = 1; level < n_levels; ++level)
+      {
+        TransferLevel &transfer = transfer_levels[level - 1];
+        transfer.n_owned_cells  = n_owned_level_cells[level - 1];
+
+        // combine the parent cell index and the lexicographic shift of each
+        // cell within its parent's children into a single start offset into
+        // the coarse index array
+        std::vector<unsigned int> coarse_dof_offsets(transfer.n_owned_cells);
+        for (unsigned int c = 0; c < transfer.n_owned_cells; ++c)
+          {
+            const unsigned int shift =
+              dealii::internal::MGTransfer::compute_shift_within_children<dim>(
+                parent_child_connect[level - 1][c].second,
+                fe_degree + 1 - element_is_continuous,
+                fe_degree);
+            coarse_dof_offsets[c] =
+              parent_child_connect[level - 1][c].first * n_child_cell_dofs +
+              shift;
+          }
+
+        // flatten the ragged per-cell Dirichlet index lists into compressed
+        // row storage
+        std::vector<unsigned int>   dirichlet_offsets(transfer.n_owned_cells +
+                                                    1);
+        std::vector<unsigned short> dirichlet_flat;
+        dirichlet_offsets[0] = 0;
+        for (unsigned int c = 0; c < transfer.n_owned_cells; ++c)
+          {
+            dirichlet_flat.insert(dirichlet_flat.end(),
+                                  dirichlet_indices[level - 1][c].begin(),
+                                  dirichlet_indices[level - 1][c].end());
+            dirichlet_offsets[c + 1] = dirichlet_flat.size();
+          }
+
+        transfer.coarse_dof_offsets =
+          internal::copy_to_device(coarse_dof_offsets,
+                                   "mg_transfer::coarse_dof_offsets");
+        transfer.level_dof_indices_fine =
+          internal::copy_to_device(level_dof_indices[level],
+                                   "mg_transfer::level_dof_indices_fine");
+        transfer.level_dof_indices_coarse =
+          internal::copy_to_device(level_dof_indices[level - 1],
+                                   "mg_transfer::level_dof_indices_coarse");
+        transfer.dirichlet_offsets =
+          internal::copy_to_device(dirichlet_offsets,
+                                   "mg_transfer::dirichlet_offsets");
+        transfer.dirichlet_indices =
+          internal::copy_to_device(dirichlet_flat,
+                                   "mg_transfer::dirichlet_indices");
+        transfer.weights =
+          internal::copy_to_device(weights_on_refined[level - 1],
+                                   "mg_transfer::weights");
+      }
+
+    ghosted_level_vector.resize(0, n_levels - 1);
+    for (unsigned int level = 0; level < n_levels; ++level)
+      if (external_partitioners.size() == n_levels &&
+          external_partitioners[level].get() ==
+            vector_partitioners[level].get())
+        ghosted_level_vector[level].reinit(0);
+      else
+        ghosted_level_vector[level].reinit(vector_partitioners[level]);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMatrixFree<dim, Number>::do_prolongate_add(
+    const unsigned int to_level,
+    VectorType        &dst,
+    const VectorType  &src) const
+  {
+    const TransferLevel &transfer = transfer_levels[to_level - 1];
+    if (transfer.n_owned_cells == 0)
+      return;
+
+    const Number *src_ptr = src.get_values();
+    Number       *dst_ptr = dst.get_values();
+
+    // local copies of the member variables accessed in the device lambda
+    const auto prolongation_matrix   = prolongation_matrix_1d;
+    const auto coarse_dof_offsets    = transfer.coarse_dof_offsets;
+    const auto indices_fine          = transfer.level_dof_indices_fine;
+    const auto indices_coarse        = transfer.level_dof_indices_coarse;
+    const auto dirichlet_offsets     = transfer.dirichlet_offsets;
+    const auto dirichlet_index_array = transfer.dirichlet_indices;
+    const auto weights               = transfer.weights;
+
+    const bool         continuous  = element_is_continuous;
+    const unsigned int degree_size = fe_degree + 1;
+    const unsigned int n_child_dofs_1d =
+      2 * degree_size - element_is_continuous;
+    const unsigned int n_scalar_cell_dofs =
+      Utilities::fixed_power<dim>(n_child_dofs_1d);
+    const unsigned int n_coarse_scalar_dofs =
+      Utilities::fixed_power<dim>(degree_size);
+    const unsigned int n_dofs_per_cell       = n_child_cell_dofs;
+    const unsigned int n_weights_per_cell    = Utilities::pow(3u, dim);
+
+    MemorySpace::Default::kokkos_space::execution_space exec;
+    Kokkos::parallel_for(
+      "dealii::mg_transfer_portable::prolongate",
+      Kokkos::RangePolicy<
+        MemorySpace::Default::kokkos_space::execution_space>(
+        exec, 0, std::size_t(transfer.n_owned_cells) * n_dofs_per_cell),
+      KOKKOS_LAMBDA(std::size_t tid) {
+        const unsigned int cell = tid / n_dofs_per_cell;
+        const unsigned int m    = tid % n_dofs_per_cell;
+
+        const unsigned int comp = m / n_scalar_cell_dofs;
+        const unsigned int rem  = m % n_scalar_cell_dofs;
+        const unsigned int k =
+          (dim > 2) ? rem / (n_child_dofs_1d * n_child_dofs_1d) : 0;
+        const unsigned int j =
+          (dim > 1) ? (rem / n_child_dofs_1d) % n_child_dofs_1d : 0;
+        const unsigned int i = rem % n_child_dofs_1d;
+
+        const unsigned int coarse_base =
+          coarse_dof_offsets[cell] + comp * n_scalar_cell_dofs;
+        const unsigned int dirichlet_begin = dirichlet_offsets[cell];
+        const unsigned int dirichlet_end   = dirichlet_offsets[cell + 1];
+
+        // interpolate the coarse values of the parent cell to the present
+        // fine dof by a direct (non-sum-factorized) tensor product
+        Number sum = 0.;
+        for (unsigned int kk = 0; kk < (dim > 2 ? degree_size : 1); ++kk)
+          for (unsigned int jj = 0; jj < (dim > 1 ? degree_size : 1); ++jj)
+            for (unsigned int ii = 0; ii < degree_size; ++ii)
+              {
+                // apply Dirichlet boundary conditions on the parent cell by
+                // skipping the respective coarse dofs
+                const unsigned int compact =
+                  comp * n_coarse_scalar_dofs +
+                  (kk * degree_size + jj) * degree_size + ii;
+                bool constrained = false;
+                for (unsigned int d = dirichlet_begin; d < dirichlet_end; ++d)
+                  if (dirichlet_index_array[d] == compact)
+                    constrained = true;
+                if (constrained)
+                  continue;
+
+                Number shape = prolongation_matrix[ii * n_child_dofs_1d + i];
+                if (dim > 1)
+                  shape *= prolongation_matrix[jj * n_child_dofs_1d + j];
+                if (dim > 2)
+                  shape *= prolongation_matrix[kk * n_child_dofs_1d + k];
+
+                sum +=
+                  shape *
+                  src_ptr[indices_coarse[coarse_base +
+                                         (kk * n_child_dofs_1d + jj) *
+                                           n_child_dofs_1d +
+                                         ii]];
+              }
+
+        // weight the result by the inverse valence of the fine-level dof to
+        // make the transfer a partition of unity for continuous elements
+        if (continuous)
+          {
+            const unsigned int weight_index =
+              9 * internal::weight_index_1d(k, n_child_dofs_1d) +
+              3 * internal::weight_index_1d(j, n_child_dofs_1d) +
+              internal::weight_index_1d(i, n_child_dofs_1d);
+            sum *= weights[cell * n_weights_per_cell + weight_index];
+          }
+
+        Kokkos::atomic_add(
+          &dst_ptr[indices_fine[cell * n_dofs_per_cell + m]], sum);
+      });
+    exec.fence();
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMatrixFree<dim, Number>::do_restrict_add(
+    const unsigned int from_level,
+    VectorType        &dst,
+    const VectorType  &src) const
+  {
+    const TransferLevel &transfer = transfer_levels[from_level - 1];
+    if (transfer.n_owned_cells == 0)
+      return;
+
+    const Number *src_ptr = src.get_values();
+    Number       *dst_ptr = dst.get_values();
+
+    const auto prolongation_matrix   = prolongation_matrix_1d;
+    const auto coarse_dof_offsets    = transfer.coarse_dof_offsets;
+    const auto indices_fine          = transfer.level_dof_indices_fine;
+    const auto indices_coarse        = transfer.level_dof_indices_coarse;
+    const auto dirichlet_offsets     = transfer.dirichlet_offsets;
+    const auto dirichlet_index_array = transfer.dirichlet_indices;
+    const auto weights               = transfer.weights;
+
+    const bool         continuous  = element_is_continuous;
+    const unsigned int degree_size = fe_degree + 1;
+    const unsigned int n_child_dofs_1d =
+      2 * degree_size - element_is_continuous;
+    const unsigned int n_scalar_cell_dofs =
+      Utilities::fixed_power<dim>(n_child_dofs_1d);
+    const unsigned int n_coarse_scalar_dofs =
+      Utilities::fixed_power<dim>(degree_size);
+    const unsigned int n_coarse_cell_dofs =
+      n_components * n_coarse_scalar_dofs;
+    const unsigned int n_dofs_per_cell    = n_child_cell_dofs;
+    const unsigned int n_weights_per_cell = Utilities::pow(3u, dim);
+
+    MemorySpace::Default::kokkos_space::execution_space exec;
+    Kokkos::parallel_for(
+      "dealii::mg_transfer_portable::restrict",
+      Kokkos::RangePolicy<
+        MemorySpace::Default::kokkos_space::execution_space>(
+        exec, 0, std::size_t(transfer.n_owned_cells) * n_coarse_cell_dofs),
+      KOKKOS_LAMBDA(std::size_t tid) {
+        const unsigned int cell = tid / n_coarse_cell_dofs;
+        const unsigned int m    = tid % n_coarse_cell_dofs;
+
+        // apply Dirichlet boundary conditions on the parent cell by not
+        // writing to the respective coarse dofs
+        const unsigned int dirichlet_begin = dirichlet_offsets[cell];
+        const unsigned int dirichlet_end   = dirichlet_offsets[cell + 1];
+        for (unsigned int d = dirichlet_begin; d < dirichlet_end; ++d)
+          if (dirichlet_index_array[d] == m)
+            return;
+
+        const unsigned int comp = m / n_coarse_scalar_dofs;
+        const unsigned int rem  = m % n_coarse_scalar_dofs;
+        const unsigned int kk =
+          (dim > 2) ? rem / (degree_size * degree_size) : 0;
+        const unsigned int jj = (dim > 1) ? (rem / degree_size) % degree_size :
+                                            0;
+        const unsigned int ii = rem % degree_size;
+
+        const unsigned int fine_base =
+          cell * n_dofs_per_cell + comp * n_scalar_cell_dofs;
+
+        // transpose operation of the prolongation: accumulate the weighted
+        // fine values of all children into the present coarse dof
+        Number sum = 0.;
+        for (unsigned int k = 0; k < (dim > 2 ? n_child_dofs_1d : 1); ++k)
+          for (unsigned int j = 0; j < (dim > 1 ? n_child_dofs_1d : 1); ++j)
+            for (unsigned int i = 0; i < n_child_dofs_1d; ++i)
+              {
+                Number shape = prolongation_matrix[ii * n_child_dofs_1d + i];
+                if (dim > 1)
+                  shape *= prolongation_matrix[jj * n_child_dofs_1d + j];
+                if (dim > 2)
+                  shape *= prolongation_matrix[kk * n_child_dofs_1d + k];
+
+                Number value =
+                  src_ptr[indices_fine[fine_base +
+                                       (k * n_child_dofs_1d + j) *
+                                         n_child_dofs_1d +
+                                       i]];
+                if (continuous)
+                  {
+                    const unsigned int weight_index =
+                      9 * internal::weight_index_1d(k, n_child_dofs_1d) +
+                      3 * internal::weight_index_1d(j, n_child_dofs_1d) +
+                      internal::weight_index_1d(i, n_child_dofs_1d);
+                    value *=
+                      weights[cell * n_weights_per_cell + weight_index];
+                  }
+
+                sum += shape * value;
+              }
+
+        Kokkos::atomic_add(
+          &dst_ptr[indices_coarse[coarse_dof_offsets[cell] +
+                                  comp * n_scalar_cell_dofs +
+                                  (kk * n_child_dofs_1d + jj) *
+                                    n_child_dofs_1d +
+                                  ii]],
+          sum);
+      });
+    exec.fence();
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMatrixFree<dim, Number>::prolongate(const unsigned int to_level,
+                                                VectorType        &dst,
+                                                const VectorType  &src) const
+  {
+    dst = 0;
+    prolongate_and_add(to_level, dst, src);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMatrixFree<dim, Number>::prolongate_and_add(
+    const unsigned int to_level,
+    VectorType        &dst,
+    const VectorType  &src) const
+  {
+    Assert((to_level >= 1) && (to_level <= transfer_levels.size()),
+           ExcIndexRange(to_level, 1, transfer_levels.size() + 1));
+
+    const bool src_inplace = src.get_partitioner().get() ==
+                             vector_partitioners[to_level - 1].get();
+    if (src_inplace == false)
+      {
+        if (ghosted_level_vector[to_level - 1].get_partitioner().get() !=
+            vector_partitioners[to_level - 1].get())
+          ghosted_level_vector[to_level - 1].reinit(
+            vector_partitioners[to_level - 1]);
+        ghosted_level_vector[to_level - 1].copy_locally_owned_data_from(src);
+      }
+
+    const bool dst_inplace =
+      dst.get_partitioner().get() == vector_partitioners[to_level].get();
+    if (dst_inplace == false)
+      {
+        if (ghosted_level_vector[to_level].get_partitioner().get() !=
+            vector_partitioners[to_level].get())
+          ghosted_level_vector[to_level].reinit(vector_partitioners[to_level]);
+        AssertDimension(ghosted_level_vector[to_level].locally_owned_size(),
+                        dst.locally_owned_size());
+        ghosted_level_vector[to_level] = 0.;
+      }
+
+    const VectorType &src_vec =
+      src_inplace ? src : ghosted_level_vector[to_level - 1];
+    VectorType &dst_vec = dst_inplace ? dst : ghosted_level_vector[to_level];
+
+    src_vec.update_ghost_values();
+
+    do_prolongate_add(to_level, dst_vec, src_vec);
+
+    dst_vec.compress(VectorOperation::add);
+    if (dst_inplace == false)
+      dst += dst_vec;
+
+    if (src_inplace == true)
+      src.zero_out_ghost_values();
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMatrixFree<dim, Number>::restrict_and_add(
+    const unsigned int from_level,
+    VectorType        &dst,
+    const VectorType  &src) const
+  {
+    Assert((from_level >= 1) && (from_level <= transfer_levels.size()),
+           ExcIndexRange(from_level, 1, transfer_levels.size() + 1));
+
+    const bool src_inplace =
+      src.get_partitioner().get() == vector_partitioners[from_level].get();
+    if (src_inplace == false)
+      {
+        if (ghosted_level_vector[from_level].get_partitioner().get() !=
+            vector_partitioners[from_level].get())
+          ghosted_level_vector[from_level].reinit(
+            vector_partitioners[from_level]);
+        ghosted_level_vector[from_level].copy_locally_owned_data_from(src);
+      }
+
+    const bool dst_inplace =
+      dst.get_partitioner().get() == vector_partitioners[from_level - 1].get();
+    if (dst_inplace == false)
+      {
+        if (ghosted_level_vector[from_level - 1].get_partitioner().get() !=
+            vector_partitioners[from_level - 1].get())
+          ghosted_level_vector[from_level - 1].reinit(
+            vector_partitioners[from_level - 1]);
+        AssertDimension(
+          ghosted_level_vector[from_level - 1].locally_owned_size(),
+          dst.locally_owned_size());
+        ghosted_level_vector[from_level - 1] = 0.;
+      }
+
+    const VectorType &src_vec =
+      src_inplace ? src : ghosted_level_vector[from_level];
+    VectorType &dst_vec =
+      dst_inplace ? dst : ghosted_level_vector[from_level - 1];
+
+    src_vec.update_ghost_values();
+
+    do_restrict_add(from_level, dst_vec, src_vec);
+
+    dst_vec.compress(VectorOperation::add);
+    if (dst_inplace == false)
+      dst += dst_vec;
+
+    if (src_inplace == true)
+      src.zero_out_ghost_values();
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMatrixFree<dim, Number>::initialize_dof_vector(
+    MGLevelObject<VectorType> &vectors) const
+  {
+    vectors.resize(vector_partitioners.min_level(),
+                   vector_partitioners.max_level());
+    for (unsigned int level = vector_partitioners.min_level();
+         level <= vector_partitioners.max_level();
+         ++level)
+      if (vectors[level].get_partitioner().get() !=
+          vector_partitioners[level].get())
+        vectors[level].reinit(vector_partitioners[level]);
+  }
+
+
+
+  template <int dim, typename Number>
+  std::size_t
+  MGTransferMatrixFree<dim, Number>::memory_consumption() const
+  {
+    std::size_t memory = sizeof(*this);
+    memory += prolongation_matrix_1d.size() * sizeof(Number);
+    for (const TransferLevel &transfer : transfer_levels)
+      {
+        memory += transfer.coarse_dof_offsets.size() * sizeof(unsigned int);
+        memory +=
+          transfer.level_dof_indices_fine.size() * sizeof(unsigned int);
+        memory +=
+          transfer.level_dof_indices_coarse.size() * sizeof(unsigned int);
+        memory += transfer.dirichlet_offsets.size() * sizeof(unsigned int);
+        memory += transfer.dirichlet_indices.size() * sizeof(unsigned short);
+        memory += transfer.weights.size() * sizeof(Number);
+      }
+    for (unsigned int level = ghosted_level_vector.min_level();
+         level <= ghosted_level_vector.max_level();
+         ++level)
+      memory += ghosted_level_vector[level].memory_consumption();
+    return memory;
+  }
+
+} // namespace Portable
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
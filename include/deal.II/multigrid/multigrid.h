@@ -157,6 +157,24 @@ namespace mg
  * vector. This is a nontrivial operation, usually initiated automatically by
  * the class PreconditionMG and performed by the classes derived from
  * MGTransferBase.
+ *
+ * <h3>Mixed precision</h3>
+ *
+ * All levels of the hierarchy use the same vector type. To run the
+ * multigrid cycle in a lower precision than the outer iterative solver --
+ * typically single precision inside a double precision solver, which speeds
+ * up the memory-bound smoothers and transfers without affecting the
+ * iteration count of the outer solver when multigrid is used as a
+ * preconditioner -- instantiate this class (and the associated level
+ * matrices, smoothers, and transfer objects) with a vector type of the
+ * reduced precision and wrap it in a PreconditionMG object. The vmult()
+ * functions of PreconditionMG accept vectors of a different value type than
+ * the level vectors; the precision is converted element by element inside
+ * MGLevelGlobalTransfer::copy_to_mg() and
+ * MGLevelGlobalTransfer::copy_from_mg() at the finest level, i.e., within
+ * the vector copies that are performed anyway, so that no additional sweep
+ * through memory is required. See the results section of step-37 for a
+ * discussion and timings of this approach.
  */
 template <typename VectorType>
 class Multigrid : public Subscriptor
@@ -495,6 +513,13 @@ private:
  * If VectorType is in fact a block vector and the `TransferType` object
  * supports use of a separate DoFHandler for each block, this class also allows
  * to be initialized with a separate DoFHandler for each block.
+ *
+ * The vector type used by the outer iterative solver does not need to
+ * coincide with VectorType: vmult() and vmult_add() are templated on the
+ * vector type of their arguments and convert to and from the precision of
+ * the level vectors on the fly. This allows the multigrid cycle to run in
+ * single precision while the outer solver iterates in double precision; see
+ * the discussion in the documentation of Multigrid and of step-37.
  */
 template <int dim, typename VectorType, typename TransferType>
 class PreconditionMG : public Subscriptor
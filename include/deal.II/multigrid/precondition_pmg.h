@@ -0,0 +1,491 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_precondition_pmg_h
+#define dealii_precondition_pmg_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_tools.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+
+#include <deal.II/multigrid/mg_base.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * A turnkey polynomial multigrid (p-multigrid) preconditioner.
+ *
+ * Setting up a p-multigrid preconditioner by hand requires a considerable
+ * amount of boilerplate: one has to create a DoFHandler and an
+ * AffineConstraints object for every polynomial degree in the coarsening
+ * sequence, build a level operator for each of them, connect the levels with
+ * MGTwoLevelTransfer objects collected in an MGTransferGlobalCoarsening
+ * object, configure a PreconditionChebyshev smoother per level, and finally
+ * wire everything into Multigrid and PreconditionMG (see step-75 for a
+ * worked-out example). This class performs all of these steps internally.
+ * The user only provides the DoFHandler of the fine level, a factory
+ * function that builds the level operator for a given polynomial degree, and
+ * a coarse-grid solver:
+ * @code
+ * PreconditionPMG<dim, OperatorType> preconditioner(
+ *   dof_handler,
+ *   [&](const auto &dof_handler, const auto &constraints, const auto degree)
+ *   { return std::make_unique<OperatorType>(mapping, dof_handler,
+ *                                           constraints, degree); },
+ *   coarse_grid_solver);
+ *
+ * SolverCG<VectorType>(solver_control)
+ *   .solve(system_matrix, solution, rhs, preconditioner);
+ * @endcode
+ *
+ * The degree hierarchy is determined by
+ * MGTransferGlobalCoarseningTools::create_polynomial_coarsening_sequence()
+ * from the degree of the finite element of the given DoFHandler and the
+ * coarsening sequence selected in the AdditionalData object. On every level,
+ * the levels are smoothed by PreconditionChebyshev with the inverse diagonal
+ * of the level operator as preconditioner; the operator class consequently
+ * has to provide the functions `vmult()`, `initialize_dof_vector()`, and
+ * `compute_inverse_diagonal()`, as the matrix-free operators used in
+ * step-75, step-87, and the performance-oriented tutorial programs do.
+ *
+ * The level constraints consist of hanging-node constraints and homogeneous
+ * Dirichlet conditions on the boundary ids listed in
+ * AdditionalData::dirichlet_boundary_ids. Problems with more general
+ * constraints need to assemble the multigrid hierarchy by hand.
+ *
+ * Since the multigrid V-cycle only serves as a preconditioner, it can be run
+ * in reduced precision: instantiating this class with
+ * `VectorType = LinearAlgebra::distributed::Vector<float>` and applying it
+ * through the templated vmult() function to double-precision vectors
+ * performs all level operations in single precision, which is usually the
+ * fastest known configuration for high-order operators.
+ *
+ * @ingroup mg
+ */
+template <int dim,
+          typename OperatorType,
+          typename VectorType = LinearAlgebra::distributed::Vector<
+            typename OperatorType::value_type>>
+class PreconditionPMG : public Subscriptor
+{
+public:
+  /**
+   * Value type of the level vectors.
+   */
+  using Number = typename VectorType::value_type;
+
+  static_assert(
+    std::is_same_v<VectorType, LinearAlgebra::distributed::Vector<Number>>,
+    "The class is based on MGTransferGlobalCoarsening, which is only "
+    "available for LinearAlgebra::distributed::Vector.");
+
+  /**
+   * Type of the internal transfer operator.
+   */
+  using TransferType = MGTransferGlobalCoarsening<dim, VectorType>;
+
+  /**
+   * Additional parameters for the preconditioner.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(
+      const MGTransferGlobalCoarseningTools::PolynomialCoarseningSequenceType
+        p_sequence = MGTransferGlobalCoarseningTools::
+          PolynomialCoarseningSequenceType::bisect,
+      const std::set<types::boundary_id> &dirichlet_boundary_ids = {0},
+      const unsigned int                  smoothing_degree       = 5,
+      const double                        smoothing_range        = 20.,
+      const unsigned int                  eig_cg_n_iterations    = 20)
+      : p_sequence(p_sequence)
+      , dirichlet_boundary_ids(dirichlet_boundary_ids)
+      , smoothing_degree(smoothing_degree)
+      , smoothing_range(smoothing_range)
+      , eig_cg_n_iterations(eig_cg_n_iterations)
+    {}
+
+    /**
+     * The polynomial coarsening sequence, handed to
+     * MGTransferGlobalCoarseningTools::create_polynomial_coarsening_sequence().
+     */
+    MGTransferGlobalCoarseningTools::PolynomialCoarseningSequenceType
+      p_sequence;
+
+    /**
+     * The boundary ids on which homogeneous Dirichlet conditions are imposed
+     * in the level constraints.
+     */
+    std::set<types::boundary_id> dirichlet_boundary_ids;
+
+    /**
+     * The degree of the Chebyshev smoother, see
+     * PreconditionChebyshev::AdditionalData::degree.
+     */
+    unsigned int smoothing_degree;
+
+    /**
+     * The smoothing range of the Chebyshev smoother, see
+     * PreconditionChebyshev::AdditionalData::smoothing_range.
+     */
+    double smoothing_range;
+
+    /**
+     * The number of CG iterations used to estimate the largest eigenvalue on
+     * each level, see
+     * PreconditionChebyshev::AdditionalData::eig_cg_n_iterations.
+     */
+    unsigned int eig_cg_n_iterations;
+  };
+
+  /**
+   * Constructor. Builds the complete level hierarchy.
+   *
+   * @param dof_handler The DoFHandler of the fine level. Its finite element
+   *   must consist of a single base element whose name ends in the
+   *   polynomial degree, such as FE_Q or FE_DGQ, so that the elements of
+   *   the coarser levels can be derived from it.
+   * @param operator_factory A function that builds the operator of a level,
+   *   given the DoFHandler, the constraints, and the polynomial degree of
+   *   that level. It is called once per level, from the coarsest to the
+   *   finest degree.
+   * @param coarse_grid_solver The solver used on the coarsest level, e.g., a
+   *   MGCoarseGridIterativeSolver or MGCoarseGridApplyPreconditioner object.
+   *   The object needs to live at least as long as this preconditioner.
+   * @param additional_data Further options, see AdditionalData.
+   */
+  PreconditionPMG(const DoFHandler<dim> &dof_handler,
+                  const std::function<std::unique_ptr<OperatorType>(
+                    const DoFHandler<dim>           &dof_handler,
+                    const AffineConstraints<Number> &constraints,
+                    const unsigned int               fe_degree)>
+                                                     &operator_factory,
+                  const MGCoarseGridBase<VectorType> &coarse_grid_solver,
+                  const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Apply the preconditioner, i.e., perform a single multigrid V-cycle. The
+   * vector type of @p dst and @p src may differ from the level vector type,
+   * in which case the vectors are converted upon entering and leaving the
+   * level hierarchy, enabling mixed-precision preconditioning.
+   */
+  template <typename OtherVectorType>
+  void
+  vmult(OtherVectorType &dst, const OtherVectorType &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner.
+   */
+  template <typename OtherVectorType>
+  void
+  Tvmult(OtherVectorType &dst, const OtherVectorType &src) const;
+
+  /**
+   * Return the operator of the given level, e.g., to hand the coarsest
+   * operator to the coarse-grid solver.
+   */
+  const OperatorType &
+  get_level_operator(const unsigned int level) const;
+
+  /**
+   * Return the minimum level of the hierarchy, which is always zero.
+   */
+  unsigned int
+  min_level() const;
+
+  /**
+   * Return the maximum level of the hierarchy.
+   */
+  unsigned int
+  max_level() const;
+
+private:
+  /**
+   * Preconditioner type of the Chebyshev smoother.
+   */
+  using SmootherPreconditionerType = DiagonalMatrix<VectorType>;
+
+  /**
+   * Type of the Chebyshev smoother.
+   */
+  using SmootherType =
+    PreconditionChebyshev<OperatorType, VectorType, SmootherPreconditionerType>;
+
+  /**
+   * The DoFHandler objects of the levels, sharing the triangulation of the
+   * DoFHandler passed to the constructor.
+   */
+  MGLevelObject<DoFHandler<dim>> level_dof_handlers;
+
+  /**
+   * The constraints of the levels.
+   */
+  MGLevelObject<AffineConstraints<Number>> level_constraints;
+
+  /**
+   * The operators of the levels, created by the factory passed to the
+   * constructor.
+   */
+  MGLevelObject<std::unique_ptr<OperatorType>> level_operators;
+
+  /**
+   * The transfer operators between consecutive levels.
+   */
+  MGLevelObject<MGTwoLevelTransfer<dim, VectorType>> two_level_transfers;
+
+  /**
+   * The transfer operator collecting all two-level transfers.
+   */
+  std::unique_ptr<TransferType> transfer;
+
+  /**
+   * The level matrix interface handed to the Multigrid object.
+   */
+  mg::Matrix<VectorType> mg_matrix;
+
+  /**
+   * The level smoothers.
+   */
+  MGSmootherPrecondition<OperatorType, SmootherType, VectorType> mg_smoother;
+
+  /**
+   * Pointer to the coarse-grid solver passed to the constructor.
+   */
+  SmartPointer<const MGCoarseGridBase<VectorType>,
+               PreconditionPMG<dim, OperatorType, VectorType>>
+    coarse_grid_solver;
+
+  /**
+   * The multigrid object combining the structures above.
+   */
+  std::unique_ptr<Multigrid<VectorType>> multigrid;
+
+  /**
+   * The preconditioner interface around #multigrid that performs the
+   * transfer between the global vectors and the level vectors.
+   */
+  std::unique_ptr<PreconditionMG<dim, VectorType, TransferType>>
+    preconditioner;
+};
+
+
+#ifndef DOXYGEN
+
+// ------------------------------- inline functions --------------------------
+
+template <int dim, typename OperatorType, typename VectorType>
+PreconditionPMG<dim, OperatorType, VectorType>::PreconditionPMG(
+  const DoFHandler<dim> &dof_handler,
+  const std::function<std::unique_ptr<OperatorType>(
+    const DoFHandler<dim>           &dof_handler,
+    const AffineConstraints<Number> &constraints,
+    const unsigned int               fe_degree)>    &operator_factory,
+  const MGCoarseGridBase<VectorType>                &coarse_grid_solver,
+  const AdditionalData                              &additional_data)
+  : coarse_grid_solver(&coarse_grid_solver)
+{
+  Assert(operator_factory, ExcMessage("The operator factory must be a "
+                                      "non-empty function object."));
+
+  const Triangulation<dim> &tria = dof_handler.get_triangulation();
+  const FiniteElement<dim> &fe   = dof_handler.get_fe();
+  AssertDimension(fe.n_base_elements(), 1);
+
+  // 1) determine the degree hierarchy and derive the elements of the coarser
+  // levels from the name of the fine element, substituting the degree inside
+  // the trailing parentheses
+  const std::vector<unsigned int> degrees =
+    MGTransferGlobalCoarseningTools::create_polynomial_coarsening_sequence(
+      fe.degree, additional_data.p_sequence);
+
+  const unsigned int min_level = 0;
+  const unsigned int max_level = degrees.size() - 1;
+
+  const std::string fe_name     = fe.get_name();
+  const std::size_t parenthesis = fe_name.rfind('(');
+  AssertThrow(parenthesis != std::string::npos && fe_name.back() == ')' &&
+                fe_name.find_first_not_of("0123456789", parenthesis + 1) ==
+                  fe_name.size() - 1,
+              ExcMessage(
+                "The name of the finite element, '" + fe_name +
+                "', does not end in the polynomial degree, so elements of "
+                "lower degree cannot be derived from it. Use an element "
+                "such as FE_Q or FE_DGQ, or set up the p-multigrid "
+                "hierarchy manually."));
+
+  level_dof_handlers.resize(min_level, max_level);
+  level_constraints.resize(min_level, max_level);
+  level_operators.resize(min_level, max_level);
+  two_level_transfers.resize(min_level, max_level);
+
+  // 2) create the DoFHandler, constraints, and operator of each level
+  for (unsigned int level = min_level; level <= max_level; ++level)
+    {
+      DoFHandler<dim> &dof_handler_level = level_dof_handlers[level];
+      dof_handler_level.reinit(tria);
+
+      const std::unique_ptr<FiniteElement<dim>> fe_level =
+        FETools::get_fe_by_name<dim, dim>(fe_name.substr(0, parenthesis + 1) +
+                                          std::to_string(degrees[level]) +
+                                          ")");
+      dof_handler_level.distribute_dofs(*fe_level);
+
+      AffineConstraints<Number> &constraints_level = level_constraints[level];
+      constraints_level.reinit(
+        dof_handler_level.locally_owned_dofs(),
+        DoFTools::extract_locally_relevant_dofs(dof_handler_level));
+      DoFTools::make_hanging_node_constraints(dof_handler_level,
+                                              constraints_level);
+      for (const types::boundary_id boundary_id :
+           additional_data.dirichlet_boundary_ids)
+        DoFTools::make_zero_boundary_constraints(dof_handler_level,
+                                                 boundary_id,
+                                                 constraints_level);
+      constraints_level.close();
+
+      level_operators[level] =
+        operator_factory(dof_handler_level, constraints_level, degrees[level]);
+      Assert(level_operators[level] != nullptr,
+             ExcMessage("The operator factory returned a nullptr."));
+    }
+
+  // 3) connect consecutive levels by polynomial transfer operators
+  for (unsigned int level = min_level; level < max_level; ++level)
+    two_level_transfers[level + 1].reinit(level_dof_handlers[level + 1],
+                                          level_dof_handlers[level],
+                                          level_constraints[level + 1],
+                                          level_constraints[level]);
+
+  transfer = std::make_unique<TransferType>(
+    two_level_transfers, [this](const unsigned int level, VectorType &vec) {
+      level_operators[level]->initialize_dof_vector(vec);
+    });
+
+  // 4) set up the Chebyshev smoother of each level, preconditioned by the
+  // inverse diagonal of the level operator
+  MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
+    min_level, max_level);
+  for (unsigned int level = min_level; level <= max_level; ++level)
+    {
+      smoother_data[level].preconditioner =
+        std::make_shared<SmootherPreconditionerType>();
+      level_operators[level]->compute_inverse_diagonal(
+        smoother_data[level].preconditioner->get_vector());
+      smoother_data[level].degree = additional_data.smoothing_degree;
+      smoother_data[level].smoothing_range = additional_data.smoothing_range;
+      smoother_data[level].eig_cg_n_iterations =
+        additional_data.eig_cg_n_iterations;
+    }
+  mg_smoother.initialize(level_operators, smoother_data);
+
+  // 5) combine everything into a Multigrid object and wrap it into the
+  // PreconditionMG interface
+  mg_matrix.initialize(level_operators);
+
+  multigrid = std::make_unique<Multigrid<VectorType>>(mg_matrix,
+                                                      coarse_grid_solver,
+                                                      *transfer,
+                                                      mg_smoother,
+                                                      mg_smoother,
+                                                      min_level,
+                                                      max_level);
+
+  preconditioner =
+    std::make_unique<PreconditionMG<dim, VectorType, TransferType>>(
+      dof_handler, *multigrid, *transfer);
+}
+
+
+
+template <int dim, typename OperatorType, typename VectorType>
+template <typename OtherVectorType>
+inline void
+PreconditionPMG<dim, OperatorType, VectorType>::vmult(
+  OtherVectorType       &dst,
+  const OtherVectorType &src) const
+{
+  preconditioner->vmult(dst, src);
+}
+
+
+
+template <int dim, typename OperatorType, typename VectorType>
+template <typename OtherVectorType>
+inline void
+PreconditionPMG<dim, OperatorType, VectorType>::Tvmult(
+  OtherVectorType       &dst,
+  const OtherVectorType &src) const
+{
+  preconditioner->Tvmult(dst, src);
+}
+
+
+
+template <int dim, typename OperatorType, typename VectorType>
+inline const OperatorType &
+PreconditionPMG<dim, OperatorType, VectorType>::get_level_operator(
+  const unsigned int level) const
+{
+  AssertIndexRange(level, level_operators.max_level() + 1);
+  return *level_operators[level];
+}
+
+
+
+template <int dim, typename OperatorType, typename VectorType>
+inline unsigned int
+PreconditionPMG<dim, OperatorType, VectorType>::min_level() const
+{
+  return level_operators.min_level();
+}
+
+
+
+template <int dim, typename OperatorType, typename VectorType>
+inline unsigned int
+PreconditionPMG<dim, OperatorType, VectorType>::max_level() const
+{
+  return level_operators.max_level();
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -24,6 +24,7 @@
 #include <deal.II/fe/fe_update_flags.h>
 #include <deal.II/fe/fe_values.h>
 
+#include <deal.II/grid/cell_id.h>
 #include <deal.II/grid/tria_iterator.h>
 
 #include <deal.II/hp/fe_collection.h>
@@ -35,7 +36,9 @@
 #include <deal.II/non_matching/quadrature_generator.h>
 
 #include <deque>
+#include <map>
 #include <optional>
+#include <utility>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -300,6 +303,46 @@ namespace NonMatching
     const std::optional<FEImmersedSurfaceValues<dim>> &
     get_surface_fe_values() const;
 
+    /**
+     * Enable caching of the generated immersed quadrature rules. When the
+     * cache is enabled, the quadratures created for an intersected cell are
+     * stored the first time reinit() is called with that cell and reused in
+     * all later calls, instead of being regenerated from scratch. This is
+     * worthwhile when the same mesh and level set function are visited many
+     * times, for example when assembling several systems or many time steps
+     * on a fixed interface, since generating the immersed quadratures
+     * involves relatively expensive polynomial root finding on each
+     * intersected cell.
+     *
+     * The cached quadratures are only valid as long as the triangulation and
+     * the level set function are unchanged. It is the responsibility of the
+     * caller to call clear_quadrature_cache() whenever either of them
+     * changes; this is deliberately not done automatically since this class
+     * cannot observe changes to the level set vector.
+     *
+     * @note The cache stores the inside, outside, and surface quadratures of
+     * every intersected cell that reinit() has been called with, so the
+     * memory consumption grows with the number of cells cut by the
+     * interface.
+     */
+    void
+    enable_quadrature_cache();
+
+    /**
+     * Disable caching of the generated immersed quadrature rules and release
+     * the quadratures cached so far.
+     */
+    void
+    disable_quadrature_cache();
+
+    /**
+     * Release all cached immersed quadrature rules. This function needs to
+     * be called after the triangulation or the level set function has
+     * changed, see enable_quadrature_cache(). Caching stays enabled.
+     */
+    void
+    clear_quadrature_cache();
+
   private:
     /**
      * Internal function called by the reinit() functions.
@@ -418,6 +461,33 @@ namespace NonMatching
      * Object that generates the immersed quadrature rules.
      */
     DiscreteQuadratureGenerator<dim> quadrature_generator;
+
+    /**
+     * The quadratures generated for one intersected cell, together with the
+     * index of the 1-dimensional quadrature they were generated from, as
+     * stored in the cache used when caching is enabled with
+     * enable_quadrature_cache().
+     */
+    struct CellQuadratureCacheEntry
+    {
+      unsigned int                   q_index_1D;
+      Quadrature<dim>                inside;
+      Quadrature<dim>                outside;
+      ImmersedSurfaceQuadrature<dim> surface;
+    };
+
+    /**
+     * Cache of the immersed quadrature rules of the intersected cells that
+     * reinit() has been called with. Only filled while caching is enabled,
+     * see enable_quadrature_cache().
+     */
+    std::map<CellId, CellQuadratureCacheEntry> quadrature_cache;
+
+    /**
+     * Whether the generated immersed quadrature rules are currently being
+     * cached and reused, see enable_quadrature_cache().
+     */
+    bool quadrature_cache_is_enabled;
   };
 
 
@@ -616,6 +686,32 @@ namespace NonMatching
     const std::optional<dealii::FEInterfaceValues<dim>> &
     get_outside_fe_values() const;
 
+    /**
+     * Enable caching of the generated immersed face quadrature rules, so
+     * that the quadratures of an intersected face are generated only in the
+     * first reinit() call with that face and reused afterwards. This works
+     * in the same way as NonMatching::FEValues::enable_quadrature_cache();
+     * see the documentation of that function for when caching pays off and
+     * for the obligations of the caller.
+     */
+    void
+    enable_quadrature_cache();
+
+    /**
+     * Disable caching of the generated immersed face quadrature rules and
+     * release the quadratures cached so far.
+     */
+    void
+    disable_quadrature_cache();
+
+    /**
+     * Release all cached immersed face quadrature rules. This function needs
+     * to be called after the triangulation or the level set function has
+     * changed, see enable_quadrature_cache(). Caching stays enabled.
+     */
+    void
+    clear_quadrature_cache();
+
   private:
     /**
      * Do work common to the constructors. The incoming QCollection should be
@@ -731,6 +827,34 @@ namespace NonMatching
      * Object that generates the immersed quadrature rules.
      */
     DiscreteFaceQuadratureGenerator<dim> face_quadrature_generator;
+
+    /**
+     * The quadratures generated for one intersected face, together with the
+     * index of the 1-dimensional quadrature they were generated from, as
+     * stored in the cache used when caching is enabled with
+     * enable_quadrature_cache().
+     */
+    struct FaceQuadratureCacheEntry
+    {
+      unsigned int        q_index_1D;
+      Quadrature<dim - 1> inside;
+      Quadrature<dim - 1> outside;
+    };
+
+    /**
+     * Cache of the immersed quadrature rules of the intersected faces that
+     * reinit() has been called with, identified by the CellId of the cell
+     * and the face number within the cell. Only filled while caching is
+     * enabled, see enable_quadrature_cache().
+     */
+    std::map<std::pair<CellId, unsigned int>, FaceQuadratureCacheEntry>
+      quadrature_cache;
+
+    /**
+     * Whether the generated immersed quadrature rules are currently being
+     * cached and reused, see enable_quadrature_cache().
+     */
+    bool quadrature_cache_is_enabled;
   };
 
 
@@ -23,6 +23,8 @@
 
 #include <deal.II/numerics/data_out_dof_data.h>
 
+#include <boost/signals2/connection.hpp>
+
 #include <memory>
 
 DEAL_II_NAMESPACE_OPEN
@@ -216,6 +218,13 @@ public:
    */
   DataOut();
 
+  /**
+   * Destructor. Disconnects from the signals of the triangulation this
+   * object may have subscribed to for geometry caching, see
+   * set_geometry_caching().
+   */
+  virtual ~DataOut() override;
+
   /**
    * This is the central function of this class since it builds the list of
    * patches to be written by the low-level functions of the base class. A
@@ -415,6 +424,28 @@ public:
   std::pair<FirstCellFunctionType, NextCellFunctionType>
   get_cell_selection() const;
 
+  /**
+   * Instruct this class to retain the geometric part of the patches (vertex
+   * locations and, for curved cells, the evaluated quadrature points) across
+   * calls to build_patches(), so that repeated output of a time series on an
+   * unchanging mesh only re-evaluates the data vectors. Since evaluating the
+   * mapping is often the most expensive part of building patches, this can
+   * speed up the output of time-dependent solutions considerably.
+   *
+   * The cached geometry is invalidated automatically whenever the
+   * triangulation changes, by listening to the Triangulation::Signals
+   * structure of the attached triangulation, and whenever build_patches() is
+   * called with different arguments than in the previous call. However, this
+   * class cannot observe the mapping passed to build_patches(): if the
+   * mapping changes between two calls, e.g., for a MappingQEulerian whose
+   * underlying displacement field evolves, it is the caller's responsibility
+   * to not enable this mode (or to disable it again, which discards the
+   * cache). The same applies when changing the cell selection through
+   * set_cell_selection() between two calls.
+   */
+  void
+  set_geometry_caching(const bool cache_geometry = true);
+
 private:
   /**
    * A function object that is used to select what the first cell is going to
@@ -433,6 +464,51 @@ private:
                               const cell_iterator &)>
     next_cell_function;
 
+  /**
+   * Whether the geometric part of the patches should be retained across
+   * calls to build_patches(), see set_geometry_caching().
+   */
+  bool cache_geometry;
+
+  /**
+   * Whether the geometry stored in the patches of a previous call to
+   * build_patches() is still up to date. Reset by the signals of the
+   * triangulation.
+   */
+  bool cached_geometry_valid;
+
+  /**
+   * The value of the @p n_subdivisions argument of the previous call to
+   * build_patches(), to detect argument changes that invalidate the cached
+   * geometry.
+   */
+  unsigned int cached_n_subdivisions;
+
+  /**
+   * The value of the @p curved_region argument of the previous call to
+   * build_patches(), to detect argument changes that invalidate the cached
+   * geometry.
+   */
+  CurvedCellRegion cached_curved_region;
+
+  /**
+   * The triangulation the cached geometry and the signal connections below
+   * refer to.
+   */
+  const Triangulation<dim, spacedim> *cached_triangulation;
+
+  /**
+   * Connections to Triangulation::Signals::any_change and
+   * Triangulation::Signals::mesh_movement of the attached triangulation that
+   * invalidate the cached geometry.
+   */
+  boost::signals2::connection tria_change_connection;
+
+  /**
+   * @copydoc tria_change_connection
+   */
+  boost::signals2::connection tria_movement_connection;
+
   /**
    * Build one patch. This function is called in a WorkStream context.
    *
@@ -447,7 +523,8 @@ private:
     const std::pair<cell_iterator, unsigned int> *cell_and_index,
     internal::DataOutImplementation::ParallelData<dim, spacedim> &scratch_data,
     const unsigned int     n_subdivisions,
-    const CurvedCellRegion curved_cell_region);
+    const CurvedCellRegion curved_cell_region,
+    const bool             reuse_geometry);
 };
 
 
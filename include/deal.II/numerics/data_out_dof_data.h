@@ -22,6 +22,7 @@
 #include <deal.II/base/data_out_base.h>
 #include <deal.II/base/mg_level_object.h>
 #include <deal.II/base/smartpointer.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/dofs/dof_handler.h>
 
@@ -37,6 +38,7 @@
 #include <deal.II/numerics/data_component_interpretation.h>
 #include <deal.II/numerics/data_postprocessor.h>
 
+#include <functional>
 #include <memory>
 
 DEAL_II_NAMESPACE_OPEN
@@ -898,6 +900,41 @@ public:
   void
   clear_input_data_references();
 
+  /**
+   * Hand the patches created by the last call to the @p build_patches
+   * function of a derived class over to the given @p consumer, which is
+   * invoked on a background task created via Threads::new_task(). The
+   * patches are <i>moved</i> into the task, and the current object is left
+   * without patches: it can immediately be reused for the next call to
+   * build_patches() (or be destroyed) while the consumer is still running.
+   *
+   * This is intended for in-situ processing pipelines in the style of
+   * Catalyst or Ascent, where extracting visualization data from the
+   * patches -- or writing them to disk through DataOutInterface's
+   * functions on a second DataOut object -- should overlap with the next
+   * solve step instead of blocking it. A typical use looks as follows:
+   * @code
+   *   data_out.build_patches();
+   *   task = data_out.consume_patches_asynchronously(
+   *     [&](const std::vector<DataOutBase::Patch<dim, dim>> &patches) {
+   *       ...extract or write the patches...
+   *     });
+   *   // ...continue with the next time step...
+   *   task.join();
+   * @endcode
+   *
+   * Since the consumer runs concurrently with whatever the calling thread
+   * does next, it must not touch this object or the data vectors attached
+   * to it; everything it needs is contained in the patches it is given.
+   * The returned Threads::Task object must be joined before the consumer's
+   * captured state goes out of scope.
+   */
+  Threads::Task<void>
+  consume_patches_asynchronously(
+    const std::function<
+      void(const std::vector<DataOutBase::Patch<patch_dim, patch_spacedim>> &)>
+      &consumer);
+
   /**
    * This function can be used to merge the patches that were created using
    * the @p build_patches function of the object given as argument into the
@@ -831,6 +831,32 @@ namespace internal
           }
       }
 
+      /**
+       * Copy the data from a device vector to a
+       * LinearAlgebra::distributed::Vector on the host. The locally owned
+       * range is moved across the memory spaces with a single contiguous
+       * transfer instead of taking the detour through ReadWriteVector
+       * objects of the generic overload above, which matters when large
+       * device-resident solution vectors are written out in every time step.
+       */
+      template <typename Number, typename Number2>
+      void
+      copy_locally_owned_data_from(
+        const LinearAlgebra::distributed::Vector<Number2,
+                                                 MemorySpace::Default> &src,
+        LinearAlgebra::distributed::Vector<Number>                     &dst)
+      {
+        LinearAlgebra::distributed::Vector<Number2, MemorySpace::Host>
+          host_copy(src.get_partitioner());
+        host_copy.import_elements(src, VectorOperation::insert);
+
+        // both vectors share the locally owned range, so the data can be
+        // copied (and, if necessary, converted) element by element
+        AssertDimension(host_copy.locally_owned_size(),
+                        dst.locally_owned_size());
+        std::copy(host_copy.begin(), host_copy.end(), dst.begin());
+      }
+
 #ifdef DEAL_II_WITH_TRILINOS
       template <typename Number>
       void
@@ -2054,6 +2080,30 @@ DataOut_DoFData<dim, patch_dim, spacedim, patch_spacedim>::
 
 
 
+template <int dim, int patch_dim, int spacedim, int patch_spacedim>
+Threads::Task<void>
+DataOut_DoFData<dim, patch_dim, spacedim, patch_spacedim>::
+  consume_patches_asynchronously(
+    const std::function<
+      void(const std::vector<DataOutBase::Patch<patch_dim, patch_spacedim>> &)>
+      &consumer)
+{
+  Assert(consumer,
+         ExcMessage("The consumer function object must not be empty."));
+  Assert(patches.size() != 0, DataOutBase::ExcNoPatches());
+
+  // Move the patches into a shared_ptr: Threads::new_task() stores the
+  // closure in a std::function and therefore requires it to be copyable,
+  // which a lambda owning the vector by value would not be.
+  auto handed_off_patches = std::make_shared<std::vector<Patch>>();
+  handed_off_patches->swap(patches);
+
+  return Threads::new_task(
+    [handed_off_patches, consumer]() { consumer(*handed_off_patches); });
+}
+
+
+
 template <int dim, int patch_dim, int spacedim, int patch_spacedim>
 void
 DataOut_DoFData<dim, patch_dim, spacedim, patch_spacedim>::clear()
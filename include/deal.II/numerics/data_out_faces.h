@@ -20,6 +20,8 @@
 
 #include <deal.II/numerics/data_out.h>
 
+#include <boost/signals2.hpp>
+
 #include <string>
 #include <vector>
 
@@ -137,6 +139,12 @@ public:
    */
   DataOutFaces(const bool surface_only = true);
 
+  /**
+   * Destructor. Releases the connection to the triangulation signal that is
+   * used to invalidate the cached list of faces.
+   */
+  virtual ~DataOutFaces() override;
+
   /**
    * This is the central function of this class since it builds the list of
    * patches to be written by the low-level functions of the base class. A
@@ -232,6 +240,35 @@ private:
    */
   const bool surface_only;
 
+  /**
+   * The list of faces returned by first_face() and next_face(), as collected
+   * by the last call to build_patches(). Collecting the faces requires a
+   * sweep over all active cells of the triangulation, which is wasteful when
+   * output is generated repeatedly on a mesh that does not change, e.g.,
+   * every few time steps of a time-dependent computation. The list is
+   * therefore kept and reused as long as the triangulation does not change,
+   * which is detected via the signal connection stored below.
+   */
+  std::vector<FaceDescriptor> cached_faces;
+
+  /**
+   * Whether `cached_faces` is up to date with respect to the current
+   * triangulation.
+   */
+  bool cached_faces_valid;
+
+  /**
+   * The triangulation `cached_faces` was built for, so that the cache can
+   * also be discarded when a different triangulation is attached.
+   */
+  const Triangulation<dim, spacedim> *cached_faces_tria;
+
+  /**
+   * Connection to Triangulation::Signals::any_change by which the cached
+   * list of faces is invalidated.
+   */
+  boost::signals2::connection tria_change_signal;
+
   /**
    * Build one patch. This function is called in a WorkStream context.
    */
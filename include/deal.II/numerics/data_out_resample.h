@@ -25,6 +25,8 @@
 #include <deal.II/numerics/data_out.h>
 #include <deal.II/numerics/data_out_dof_data.h>
 
+#include <boost/signals2/connection.hpp>
+
 #include <memory>
 
 DEAL_II_NAMESPACE_OPEN
@@ -68,6 +70,11 @@ public:
   DataOutResample(const Triangulation<patch_dim, spacedim> &patch_tria,
                   const Mapping<patch_dim, spacedim>       &patch_mapping);
 
+  /**
+   * Destructor.
+   */
+  virtual ~DataOutResample();
+
   /**
    * Update the @p mapping of original triangulation. One needs to call this
    * function if the mapping has changed. Just like in the DataOut context,
@@ -76,7 +83,11 @@ public:
    *
    * This function involves an expensive setup: evaluation points are generated
    * and their owners are determined, which is used to set up the communication
-   * pattern.
+   * pattern. However, if the mapping, the number of subdivisions, and the two
+   * triangulations are unchanged with respect to the previous call, the setup
+   * is skipped and the cached state is reused, so calling this function (or
+   * the build_patches() function taking a mapping) once per output step is
+   * cheap as long as the meshes do not change.
    *
    * @note If you use the version of build_patches() that does not take a
    *   mapping, this function has to be called before its first usage.
@@ -162,6 +173,25 @@ private:
    * Mapping of the original triangulation provided in update_mapping().
    */
   SmartPointer<const Mapping<dim, spacedim>> mapping;
+
+  /**
+   * The number of subdivisions the current setup has been created for, used
+   * to decide whether update_mapping() can reuse the cached state.
+   */
+  unsigned int registered_n_subdivisions;
+
+  /**
+   * Flag set whenever the patch triangulation changes, invalidating the
+   * cached state. Changes of the source triangulation are detected by the
+   * RemotePointEvaluation object itself.
+   */
+  bool patch_tria_changed;
+
+  /**
+   * Connection to the signal of the patch triangulation that sets
+   * #patch_tria_changed.
+   */
+  boost::signals2::connection patch_tria_change_connection;
 };
 
 DEAL_II_NAMESPACE_CLOSE
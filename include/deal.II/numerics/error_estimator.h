@@ -510,6 +510,66 @@ public:
     const types::material_id  material_id  = numbers::invalid_material_id,
     const Strategy            strategy     = cell_diameter_over_24);
 
+  /**
+   * Incremental variant of estimate(): re-estimate only those cells for
+   * which the entry of @p cells_to_estimate (indexed by the active cell
+   * index) is set, and keep the indicator stored in @p error for all other
+   * cells. This is useful if the solution has changed only in parts of the
+   * domain since the previous call, e.g., because a time-dependent process
+   * is localized, and computing all face integrals anew every adaptation
+   * cycle would be wasteful.
+   *
+   * In contrast to estimate(), the vector @p error is consequently not
+   * reinitialized by this function: it must have one entry per active cell
+   * and contain the indicators returned by the previous call. Face integrals
+   * are computed for all faces adjacent to at least one flagged cell, so the
+   * cost is proportional to the size of the flagged region rather than to
+   * the size of the mesh. Which cells to flag is up to the caller; typical
+   * choices are the cells on which the solution has changed by more than
+   * some threshold, or the cells touched by mesh modifications as reported
+   * by the Triangulation signals.
+   *
+   * All other arguments have the same meaning as in estimate().
+   */
+  template <typename Number>
+  static void
+  estimate_incremental(
+    const Mapping<dim, spacedim>    &mapping,
+    const DoFHandler<dim, spacedim> &dof,
+    const Quadrature<dim - 1>       &quadrature,
+    const std::map<types::boundary_id, const Function<spacedim, Number> *>
+                             &neumann_bc,
+    const ReadVector<Number> &solution,
+    Vector<float>            &error,
+    const std::vector<bool>  &cells_to_estimate,
+    const ComponentMask      &component_mask = {},
+    const Function<spacedim> *coefficients   = nullptr,
+    const types::subdomain_id subdomain_id   = numbers::invalid_subdomain_id,
+    const types::material_id  material_id    = numbers::invalid_material_id,
+    const Strategy            strategy       = cell_diameter_over_24);
+
+  /**
+   * Same as the previous function, but accepting a quadrature collection
+   * and several solution vectors and one error vector for each solution
+   * vector, analogous to the corresponding estimate() function.
+   */
+  template <typename Number>
+  static void
+  estimate_incremental(
+    const Mapping<dim, spacedim>    &mapping,
+    const DoFHandler<dim, spacedim> &dof,
+    const hp::QCollection<dim - 1>  &quadrature,
+    const std::map<types::boundary_id, const Function<spacedim, Number> *>
+                                                &neumann_bc,
+    const ArrayView<const ReadVector<Number> *> &solutions,
+    ArrayView<Vector<float> *>                  &errors,
+    const std::vector<bool>                     &cells_to_estimate,
+    const ComponentMask                         &component_mask = {},
+    const Function<spacedim>                    *coefficients   = nullptr,
+    const types::subdomain_id subdomain_id = numbers::invalid_subdomain_id,
+    const types::material_id  material_id  = numbers::invalid_material_id,
+    const Strategy            strategy     = cell_diameter_over_24);
+
   /**
    * Exception
    */
@@ -800,6 +860,58 @@ public:
     const types::material_id  material_id  = numbers::invalid_material_id,
     const Strategy            strategy     = cell_diameter_over_24);
 
+  /**
+   * Incremental variant of estimate(): update the indicators only for those
+   * cells for which the entry of @p cells_to_estimate (indexed by the active
+   * cell index) is set, and keep the indicator stored in @p error for all
+   * other cells. Consequently, @p error is not reinitialized by this
+   * function: it must have one entry per active cell and contain the
+   * indicators returned by the previous call.
+   *
+   * Since the jump terms in 1d are cheap point evaluations, this function
+   * computes all of them and differs from estimate() only in which entries
+   * of @p error it overwrites; it exists to offer the same interface as the
+   * general template.
+   */
+  template <typename Number>
+  static void
+  estimate_incremental(
+    const Mapping<1, spacedim>    &mapping,
+    const DoFHandler<1, spacedim> &dof,
+    const Quadrature<0>           &quadrature,
+    const std::map<types::boundary_id, const Function<spacedim, Number> *>
+                             &neumann_bc,
+    const ReadVector<Number> &solution,
+    Vector<float>            &error,
+    const std::vector<bool>  &cells_to_estimate,
+    const ComponentMask      &component_mask = {},
+    const Function<spacedim> *coefficients   = nullptr,
+    const types::subdomain_id subdomain_id   = numbers::invalid_subdomain_id,
+    const types::material_id  material_id    = numbers::invalid_material_id,
+    const Strategy            strategy       = cell_diameter_over_24);
+
+  /**
+   * Same as the previous function, but accepting a quadrature collection
+   * and several solution vectors and one error vector for each solution
+   * vector, analogous to the corresponding estimate() function.
+   */
+  template <typename Number>
+  static void
+  estimate_incremental(
+    const Mapping<1, spacedim>    &mapping,
+    const DoFHandler<1, spacedim> &dof,
+    const hp::QCollection<0>      &quadrature,
+    const std::map<types::boundary_id, const Function<spacedim, Number> *>
+                                                &neumann_bc,
+    const ArrayView<const ReadVector<Number> *> &solutions,
+    ArrayView<Vector<float> *>                  &errors,
+    const std::vector<bool>                     &cells_to_estimate,
+    const ComponentMask                         &component_mask = {},
+    const Function<spacedim>                    *coefficients   = nullptr,
+    const types::subdomain_id subdomain_id = numbers::invalid_subdomain_id,
+    const types::material_id  material_id  = numbers::invalid_material_id,
+    const Strategy            strategy     = cell_diameter_over_24);
+
 
 
   /**
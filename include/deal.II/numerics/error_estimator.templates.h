@@ -1301,6 +1301,233 @@ KellyErrorEstimator<dim, spacedim>::estimate(
 
 
 
+template <int dim, int spacedim>
+template <typename Number>
+void
+KellyErrorEstimator<dim, spacedim>::estimate_incremental(
+  const Mapping<dim, spacedim>    &mapping,
+  const DoFHandler<dim, spacedim> &dof_handler,
+  const Quadrature<dim - 1>       &quadrature,
+  const std::map<types::boundary_id, const Function<spacedim, Number> *>
+                           &neumann_bc,
+  const ReadVector<Number> &solution,
+  Vector<float>            &error,
+  const std::vector<bool>  &cells_to_estimate,
+  const ComponentMask      &component_mask,
+  const Function<spacedim> *coefficients,
+  const types::subdomain_id subdomain_id,
+  const types::material_id  material_id,
+  const Strategy            strategy)
+{
+  // just pass on to the other function
+  std::vector<const ReadVector<Number> *> solutions(1, &solution);
+  std::vector<Vector<float> *>            errors(1, &error);
+  ArrayView<Vector<float> *>              error_view = make_array_view(errors);
+  estimate_incremental(mapping,
+                       dof_handler,
+                       hp::QCollection<dim - 1>(quadrature),
+                       neumann_bc,
+                       make_array_view(solutions),
+                       error_view,
+                       cells_to_estimate,
+                       component_mask,
+                       coefficients,
+                       subdomain_id,
+                       material_id,
+                       strategy);
+}
+
+
+
+template <int dim, int spacedim>
+template <typename Number>
+void
+KellyErrorEstimator<dim, spacedim>::estimate_incremental(
+  const Mapping<dim, spacedim>    &mapping,
+  const DoFHandler<dim, spacedim> &dof_handler,
+  const hp::QCollection<dim - 1>  &face_quadratures,
+  const std::map<types::boundary_id, const Function<spacedim, Number> *>
+                                              &neumann_bc,
+  const ArrayView<const ReadVector<Number> *> &solutions,
+  ArrayView<Vector<float> *>                  &errors,
+  const std::vector<bool>                     &cells_to_estimate,
+  const ComponentMask                         &component_mask,
+  const Function<spacedim>                    *coefficients,
+  const types::subdomain_id                    subdomain_id_,
+  const types::material_id                     material_id,
+  const Strategy                               strategy)
+{
+  types::subdomain_id subdomain_id = numbers::invalid_subdomain_id;
+  if (const auto *triangulation = dynamic_cast<
+        const parallel::DistributedTriangulationBase<dim, spacedim> *>(
+        &dof_handler.get_triangulation()))
+    {
+      Assert((subdomain_id_ == numbers::invalid_subdomain_id) ||
+               (subdomain_id_ == triangulation->locally_owned_subdomain()),
+             ExcMessage(
+               "For distributed Triangulation objects and associated "
+               "DoFHandler objects, asking for any subdomain other than the "
+               "locally owned one does not make sense."));
+      subdomain_id = triangulation->locally_owned_subdomain();
+    }
+  else
+    {
+      subdomain_id = subdomain_id_;
+    }
+
+  const unsigned int n_components = dof_handler.get_fe(0).n_components();
+  (void)n_components;
+
+  // sanity checks
+  Assert(solutions.size() > 0, ExcNoSolutions());
+  Assert(solutions.size() == errors.size(),
+         ExcIncompatibleNumberOfElements(solutions.size(), errors.size()));
+
+  for (const auto &boundary_function : neumann_bc)
+    {
+      (void)boundary_function;
+      Assert(boundary_function.second->n_components == n_components,
+             ExcInvalidBoundaryFunction(boundary_function.first,
+                                        boundary_function.second->n_components,
+                                        n_components));
+    }
+
+  Assert(component_mask.represents_n_components(n_components),
+         ExcInvalidComponentMask());
+  Assert(component_mask.n_selected_components(n_components) > 0,
+         ExcInvalidComponentMask());
+
+  Assert((coefficients == nullptr) ||
+           (coefficients->n_components == n_components) ||
+           (coefficients->n_components == 1),
+         ExcInvalidCoefficient());
+
+  for (unsigned int n = 0; n < solutions.size(); ++n)
+    Assert(solutions[n]->size() == dof_handler.n_dofs(),
+           ExcDimensionMismatch(solutions[n]->size(), dof_handler.n_dofs()));
+
+  const unsigned int n_active_cells =
+    dof_handler.get_triangulation().n_active_cells();
+  AssertDimension(cells_to_estimate.size(), n_active_cells);
+
+  // the error vectors carry the indicators of the previous call for the
+  // cells that are not re-estimated, so they must already have the correct
+  // size
+  for (unsigned int n = 0; n < errors.size(); ++n)
+    AssertDimension(errors[n]->size(), n_active_cells);
+
+  const unsigned int n_solution_vectors = solutions.size();
+
+  // Collect the cells to work on: every interior face integral is computed
+  // from only one of its two adjacent cells, and for a flagged cell that
+  // cell may well be an unflagged neighbor. We therefore run the face
+  // integration on the flagged cells plus all cells sharing a face with
+  // one of them; the cost stays proportional to the flagged region. Finer
+  // neighbors need not be included since a cell integrates over the
+  // subfaces towards finer neighbors itself.
+  std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+    cells_to_work_on;
+  {
+    std::vector<bool> work_flags(n_active_cells, false);
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cells_to_estimate[cell->active_cell_index()])
+        {
+          work_flags[cell->active_cell_index()] = true;
+          for (const unsigned int face_no : cell->face_indices())
+            if (!cell->at_boundary(face_no) &&
+                (cell->face(face_no)->has_children() == false))
+              work_flags[cell->neighbor(face_no)->active_cell_index()] = true;
+        }
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (work_flags[cell->active_cell_index()])
+        cells_to_work_on.push_back(cell);
+  }
+
+  // Map of integrals indexed by the corresponding face, as in estimate()
+  std::map<typename DoFHandler<dim, spacedim>::face_iterator,
+           std::vector<double>>
+    face_integrals;
+
+  const hp::MappingCollection<dim, spacedim> mapping_collection(mapping);
+  const internal::ParallelData<dim, spacedim, Number> parallel_data(
+    dof_handler.get_fe_collection(),
+    face_quadratures,
+    mapping_collection,
+    (!neumann_bc.empty() || (coefficients != nullptr)),
+    solutions.size(),
+    subdomain_id,
+    material_id,
+    &neumann_bc,
+    component_mask,
+    coefficients);
+  std::map<typename DoFHandler<dim, spacedim>::face_iterator,
+           std::vector<double>>
+    sample_local_face_integrals;
+
+  using CellIterator =
+    typename DoFHandler<dim, spacedim>::active_cell_iterator;
+  WorkStream::run(
+    cells_to_work_on.begin(),
+    cells_to_work_on.end(),
+    [&solutions,
+     strategy](const typename std::vector<CellIterator>::const_iterator &cell,
+               internal::ParallelData<dim, spacedim, Number> &parallel_data,
+               std::map<typename DoFHandler<dim, spacedim>::face_iterator,
+                        std::vector<double>> &local_face_integrals) {
+      internal::estimate_one_cell(
+        *cell, parallel_data, local_face_integrals, solutions, strategy);
+    },
+    [&face_integrals](
+      const std::map<typename DoFHandler<dim, spacedim>::face_iterator,
+                     std::vector<double>> &local_face_integrals) {
+      internal::copy_local_to_global<dim, spacedim>(local_face_integrals,
+                                                    face_integrals);
+    },
+    parallel_data,
+    sample_local_face_integrals);
+
+  // finally add up the contributions of the faces of the flagged cells; all
+  // other cells keep the indicators they were given on input
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    if (cells_to_estimate[cell->active_cell_index()] &&
+        ((subdomain_id == numbers::invalid_subdomain_id) ||
+         (cell->subdomain_id() == subdomain_id)) &&
+        ((material_id == numbers::invalid_material_id) ||
+         (cell->material_id() == material_id)))
+      {
+        const unsigned int present_cell = cell->active_cell_index();
+
+        for (unsigned int n = 0; n < n_solution_vectors; ++n)
+          (*errors[n])(present_cell) = 0;
+
+        // loop over all faces of this cell
+        for (const unsigned int face_no : cell->face_indices())
+          {
+            Assert(face_integrals.find(cell->face(face_no)) !=
+                     face_integrals.end(),
+                   ExcInternalError());
+            const double factor = internal::cell_factor<dim, spacedim>(
+              cell, face_no, dof_handler, strategy);
+
+            for (unsigned int n = 0; n < n_solution_vectors; ++n)
+              {
+                // make sure that we have written a meaningful value into this
+                // slot
+                Assert(face_integrals[cell->face(face_no)][n] >= 0,
+                       ExcInternalError());
+
+                (*errors[n])(present_cell) +=
+                  (face_integrals[cell->face(face_no)][n] * factor);
+              }
+          }
+
+        for (unsigned int n = 0; n < n_solution_vectors; ++n)
+          (*errors[n])(present_cell) = std::sqrt((*errors[n])(present_cell));
+      }
+}
+
+
+
 template <int dim, int spacedim>
 template <typename Number>
 void
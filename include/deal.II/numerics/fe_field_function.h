@@ -18,6 +18,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/function.h>
+#include <deal.II/base/mutex.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/thread_local_storage.h>
@@ -31,6 +32,9 @@
 
 #include <deal.II/lac/vector.h>
 
+#include <boost/signals2/connection.hpp>
+
+#include <mutex>
 #include <optional>
 
 
@@ -180,6 +184,11 @@ namespace Functions
       const VectorType                &data_vector,
       const Mapping<dim>              &mapping = StaticMappingQ1<dim>::mapping);
 
+    /**
+     * Destructor.
+     */
+    virtual ~FEFieldFunction() override;
+
     /**
      * Set the current cell. If you know in advance where your points lie, you
      * can tell this object by calling this function. This will speed things
@@ -433,6 +442,16 @@ namespace Functions
      * This function simply calls GridTools::compute_point_locations :
      * using the original function avoids computing a
      * new Cache at every function call.
+     *
+     * Since the cell search is by far the most expensive part of evaluating
+     * this function on many points, its result is cached internally: if this
+     * function (or one of the list functions calling it) is invoked
+     * repeatedly with an identical set of points, for example when
+     * extracting values along the same probe line after every time step, the
+     * points are sorted into cells only the first time. The cached
+     * association is discarded whenever the underlying triangulation
+     * changes. Note that the cache stores a copy of @p points and of the
+     * three output arrays.
      */
     unsigned int
     compute_point_locations(
@@ -476,6 +495,50 @@ namespace Functions
      */
     mutable cell_hint_t cell_hint;
 
+    /**
+     * The set of points for which the cached point-to-cell association
+     * stored in the following three members has been computed.
+     */
+    mutable std::vector<Point<dim>> cached_points;
+
+    /**
+     * The cells containing #cached_points, together with the corresponding
+     * reference coordinates and the permutation of the points, in the format
+     * produced by compute_point_locations().
+     */
+    mutable std::vector<
+      typename DoFHandler<dim, spacedim>::active_cell_iterator>
+      cached_cells;
+
+    /**
+     * The reference coordinates belonging to #cached_cells.
+     */
+    mutable std::vector<std::vector<Point<dim>>> cached_qpoints;
+
+    /**
+     * The point indices belonging to #cached_cells.
+     */
+    mutable std::vector<std::vector<unsigned int>> cached_maps;
+
+    /**
+     * Whether the cached point-to-cell association is still usable. The
+     * connection below sets this to @p false whenever the triangulation
+     * changes.
+     */
+    mutable bool point_location_cache_valid;
+
+    /**
+     * A connection to the signal of the triangulation that invalidates the
+     * cached point-to-cell association.
+     */
+    boost::signals2::connection tria_change_connection;
+
+    /**
+     * A mutex protecting the cached point-to-cell association, so that the
+     * list functions can be called from several threads at once.
+     */
+    mutable Threads::Mutex point_location_cache_mutex;
+
     /**
      * Given a cell, return the reference coordinates of the given point
      * within this cell if it indeed lies within the cell. Otherwise return an
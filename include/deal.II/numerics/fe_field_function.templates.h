@@ -51,7 +51,20 @@ namespace Functions
     , mapping(mymapping)
     , cache(dh->get_triangulation(), mymapping)
     , cell_hint(dh->end())
-  {}
+    , point_location_cache_valid(false)
+  {
+    tria_change_connection =
+      dh->get_triangulation().signals.any_change.connect(
+        [this]() { this->point_location_cache_valid = false; });
+  }
+
+
+
+  template <int dim, typename VectorType, int spacedim>
+  FEFieldFunction<dim, VectorType, spacedim>::~FEFieldFunction()
+  {
+    tria_change_connection.disconnect();
+  }
 
 
 
@@ -524,6 +537,22 @@ namespace Functions
     std::vector<std::vector<Point<dim>>>   &qpoints,
     std::vector<std::vector<unsigned int>> &maps) const
   {
+    // If we are asked about the same set of points as in the previous call
+    // and the triangulation has not changed in the meantime, reuse the
+    // cached association instead of searching through the mesh again. This
+    // is the common situation when, e.g., values along the same probe line
+    // are extracted after every time step.
+    {
+      std::lock_guard<std::mutex> lock(point_location_cache_mutex);
+      if (point_location_cache_valid && points == cached_points)
+        {
+          cells   = cached_cells;
+          qpoints = cached_qpoints;
+          maps    = cached_maps;
+          return cells.size();
+        }
+    }
+
     // Calling the GridTools routine and preparing output
     auto cell_qpoint_map =
       GridTools::compute_point_locations_try_all(cache,
@@ -540,6 +569,16 @@ namespace Functions
     // Ensure that we found all points
     AssertThrow(std::get<3>(cell_qpoint_map).empty(),
                 VectorTools::ExcPointNotAvailableHere());
+
+    {
+      std::lock_guard<std::mutex> lock(point_location_cache_mutex);
+      cached_points              = points;
+      cached_cells               = cells;
+      cached_qpoints             = qpoints;
+      cached_maps                = maps;
+      point_location_cache_valid = true;
+    }
+
     return cells.size();
   }
 
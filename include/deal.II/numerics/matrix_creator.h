@@ -148,6 +148,16 @@ namespace hp
  * case, the number of components must coincide with the number of components
  * of the system finite element.
  *
+ * The functions of this namespace compute the local matrices with generic
+ * FEValues loops, whose cost per cell grows quickly with the polynomial
+ * degree. If matrices for tensor-product elements at higher degrees have to
+ * be rebuilt frequently, for example after every remeshing step, consider
+ * assembling them through MatrixFreeTools::compute_matrix() instead: that
+ * function computes the same local matrices with the sum-factorized
+ * evaluators of the matrix-free framework, working on several cells at once
+ * using vectorization, and is considerably faster for degrees of about three
+ * and up.
+ *
  *
  * <h3>Matrices on the boundary</h3>
  *
@@ -17,6 +17,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/std_cxx20/iota_view.h>
 
@@ -25,6 +26,7 @@
 #include <deal.II/boost_adaptors/segment.h>
 
 #include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
 #include <boost/geometry/index/rtree.hpp>
 #include <boost/geometry/strategies/strategies.hpp>
 
@@ -466,6 +468,31 @@ extract_children_of_level(const Rtree &tree, const unsigned int level);
 
 
 
+/**
+ * Perform many intersection queries against an RTree object @p tree at once.
+ * The function returns, for each entry of @p queries, the vector of all leaf
+ * values stored in the tree whose indexable intersects that query object.
+ * The query type can be any geometry that boost::geometry can test against
+ * the indexables stored in the tree, for example a Point or a BoundingBox.
+ *
+ * Calling this function is equivalent to running a
+ * `boost::geometry::index::intersects` query for each element of @p queries,
+ * but considerably faster for large query sets: the queries are processed in
+ * chunks, each chunk descends the tree only once and tests every node against
+ * all still-active queries of the chunk, so that the cost of traversing the
+ * upper levels of the tree is amortized over many queries. The chunks are
+ * processed in parallel on the available threads.
+ *
+ * This function only reads from @p tree and may itself be called concurrently
+ * from several threads.
+ */
+template <typename Rtree, typename QueryType>
+std::vector<std::vector<typename Rtree::value_type>>
+batched_rtree_intersects(const Rtree                  &tree,
+                         const std::vector<QueryType> &queries);
+
+
+
 // Inline and template functions
 #ifndef DOXYGEN
 
@@ -851,6 +878,137 @@ extract_children_of_level(const Rtree &tree, const unsigned int level)
 
 
 
+/**
+ * A visitor used by batched_rtree_intersects() that carries a set of query
+ * objects down the tree in a single traversal. At every internal node, the
+ * set of queries intersecting a child box is computed, and the child is only
+ * visited if that set is non-empty; at the leaves, each stored value is
+ * tested against the still-active queries.
+ */
+template <typename Value,
+          typename Options,
+          typename Translator,
+          typename Box,
+          typename Allocators,
+          typename QueryType>
+struct BatchedIntersectsVisitor
+  : public boost::geometry::index::detail::rtree::visitor<
+      Value,
+      typename Options::parameters_type,
+      Box,
+      Allocators,
+      typename Options::node_tag,
+      true>::type
+{
+  using InternalNode =
+    typename boost::geometry::index::detail::rtree::internal_node<
+      Value,
+      typename Options::parameters_type,
+      Box,
+      Allocators,
+      typename Options::node_tag>::type;
+
+  using Leaf = typename boost::geometry::index::detail::rtree::leaf<
+    Value,
+    typename Options::parameters_type,
+    Box,
+    Allocators,
+    typename Options::node_tag>::type;
+
+  inline BatchedIntersectsVisitor(const Translator             &translator,
+                                  const std::vector<QueryType> &queries,
+                                  std::vector<std::size_t>      active_queries,
+                                  std::vector<std::vector<Value>> &results)
+    : translator(translator)
+    , queries(queries)
+    , active_queries(std::move(active_queries))
+    , results(results)
+  {}
+
+  inline void
+  operator()(const InternalNode &node)
+  {
+    const auto &elements =
+      boost::geometry::index::detail::rtree::elements(node);
+
+    for (const auto &element : elements)
+      {
+        std::vector<std::size_t> matching_queries;
+        matching_queries.reserve(active_queries.size());
+        for (const std::size_t q : active_queries)
+          if (boost::geometry::intersects(element.first, queries[q]))
+            matching_queries.push_back(q);
+
+        if (!matching_queries.empty())
+          {
+            std::swap(active_queries, matching_queries);
+            boost::geometry::index::detail::rtree::apply_visitor(
+              *this, *element.second);
+            std::swap(active_queries, matching_queries);
+          }
+      }
+  }
+
+  inline void
+  operator()(const Leaf &leaf)
+  {
+    const auto &elements =
+      boost::geometry::index::detail::rtree::elements(leaf);
+
+    for (const auto &value : elements)
+      for (const std::size_t q : active_queries)
+        if (boost::geometry::intersects(translator(value), queries[q]))
+          results[q].push_back(value);
+  }
+
+  const Translator               &translator;
+  const std::vector<QueryType>   &queries;
+  std::vector<std::size_t>        active_queries;
+  std::vector<std::vector<Value>> &results;
+};
+
+
+
+template <typename Rtree, typename QueryType>
+std::vector<std::vector<typename Rtree::value_type>>
+batched_rtree_intersects(const Rtree                  &tree,
+                         const std::vector<QueryType> &queries)
+{
+  std::vector<std::vector<typename Rtree::value_type>> results(queries.size());
+  if (queries.empty() || tree.empty())
+    return results;
+
+  using RtreeView =
+    boost::geometry::index::detail::rtree::utilities::view<Rtree>;
+
+  // Process chunks of queries on separate threads. Each chunk performs a
+  // single tree traversal shared by all of its queries, and only ever
+  // writes to the result entries of its own queries.
+  parallel::apply_to_subranges(
+    std::size_t(0),
+    queries.size(),
+    [&](const std::size_t begin, const std::size_t end) {
+      std::vector<std::size_t> active_queries(end - begin);
+      for (std::size_t q = begin; q < end; ++q)
+        active_queries[q - begin] = q;
+
+      RtreeView rtv(tree);
+      BatchedIntersectsVisitor<typename RtreeView::value_type,
+                               typename RtreeView::options_type,
+                               typename RtreeView::translator_type,
+                               typename RtreeView::box_type,
+                               typename RtreeView::allocators_type,
+                               QueryType>
+        visitor(rtv.translator(), queries, std::move(active_queries), results);
+      rtv.apply_visitor(visitor);
+    },
+    1024);
+
+  return results;
+}
+
+
+
 #endif
 
 DEAL_II_NAMESPACE_CLOSE
@@ -72,7 +72,24 @@ namespace TensorProductMatrixCreator
     const unsigned int                                  n_overlap = 1);
 
   /**
-   * Same as above but the boundary IDs are extracted from the given @p cell
+   * Same as above but the 1d mass matrix @p mass_matrix_1d and the 1d
+   * derivative matrix @p derivative_matrix_1d on the reference cell are
+   * passed in explicitly (in lexicographic ordering of the shape functions).
+   * This variant is useful if matrices for many cells are created, since the
+   * reference matrices only need to be computed once.
+   */
+  template <int dim, typename Number>
+  std::pair<std::array<FullMatrix<Number>, dim>,
+            std::array<FullMatrix<Number>, dim>>
+  create_laplace_tensor_product_matrix(
+    const FullMatrix<Number>                           &mass_matrix_1d,
+    const FullMatrix<Number>                           &derivative_matrix_1d,
+    const dealii::ndarray<LaplaceBoundaryType, dim, 2> &boundary_ids,
+    const dealii::ndarray<double, dim, 3>              &cell_extent,
+    const unsigned int                                  n_overlap = 1);
+
+  /**
+   * Same as the first variant but the boundary IDs are extracted from the given @p cell
    * and are mapped to the boundary type via the sets @p dirichlet_boundaries and @p neumann_boundaries.
    */
   template <int dim, typename Number>
@@ -191,11 +208,33 @@ namespace TensorProductMatrixCreator
     const auto &is_dg =
       std::get<2>(create_reference_mass_and_stiffness_matrices);
 
+    AssertThrow(is_dg == false, ExcNotImplemented());
+
+    return create_laplace_tensor_product_matrix<dim, Number>(
+      M_ref, K_ref, boundary_ids, cell_extent, n_overlap);
+  }
+
+
+  template <int dim, typename Number>
+  std::pair<std::array<FullMatrix<Number>, dim>,
+            std::array<FullMatrix<Number>, dim>>
+  create_laplace_tensor_product_matrix(
+    const FullMatrix<Number>                           &mass_matrix_1d,
+    const FullMatrix<Number>                           &derivative_matrix_1d,
+    const dealii::ndarray<LaplaceBoundaryType, dim, 2> &boundary_ids,
+    const dealii::ndarray<double, dim, 3>              &cell_extent,
+    const unsigned int                                  n_overlap)
+  {
+    const auto &M_ref = mass_matrix_1d;
+    const auto &K_ref = derivative_matrix_1d;
+
     AssertIndexRange(n_overlap, M_ref.n());
     AssertIndexRange(0, n_overlap);
-    AssertThrow(is_dg == false, ExcNotImplemented());
+    AssertDimension(M_ref.m(), M_ref.n());
+    AssertDimension(K_ref.m(), M_ref.m());
+    AssertDimension(K_ref.n(), M_ref.n());
 
-    // 2) loop over all dimensions and create 1d mass and stiffness
+    // loop over all dimensions and create 1d mass and stiffness
     // matrices so that boundary conditions and overlap are considered
 
     const unsigned int n_dofs_1D              = M_ref.n();
@@ -0,0 +1,653 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_tensor_product_schwarz_preconditioner_h
+#define dealii_tensor_product_schwarz_preconditioner_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/ndarray.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe.h>
+#include <deal.II/fe/fe_tools.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/numerics/tensor_product_matrix_creator.h>
+
+#include <set>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * An overlapping additive Schwarz preconditioner whose subproblems are
+ * solved by the fast diagonalization method.
+ *
+ * Each locally owned cell defines one subdomain (patch) consisting of the
+ * degrees of freedom of the cell itself plus, if
+ * AdditionalData::n_overlap is larger than one, layers of degrees of
+ * freedom of the face neighbors. On each patch, a separable approximation
+ * of the constant-coefficient Laplacian is set up from 1d mass and
+ * stiffness matrices via
+ * TensorProductMatrixCreator::create_laplace_tensor_product_matrix() and
+ * inverted by the fast diagonalization method. The patch inverses of
+ * VectorizedArray::size() cells are grouped into one batch and applied
+ * together, and identical 1d matrices are shared between patches by
+ * TensorProductMatrixSymmetricSumCollection, so that on a uniform
+ * Cartesian mesh only a single set of 1d eigendecompositions is stored.
+ * The result is a matrix-free replacement for the RelaxationBlock
+ * classes for tensor-product discretizations that does not require a
+ * sparse matrix or an explicit block list.
+ *
+ * The operation of vmult() is
+ * @f{align*}{
+ *   v = \sum_j R_j^T W_j A_j^{-1} W_j R_j u,
+ * @f}
+ * where $R_j$ is the restriction to the $j$th patch, $A_j$ the fast
+ * diagonalization approximation of the patch matrix, and $W_j$ a
+ * diagonal weight matrix. With the default choice
+ * AdditionalData::WeightingType::symmetric, the weight of a degree of
+ * freedom is one over the square root of the number of patches containing
+ * it, which keeps the preconditioner symmetric and bounds the additive
+ * over-counting in the overlap region; the operation then remains
+ * suitable for conjugate gradient iterations and as a smoother inside
+ * PreconditionChebyshev.
+ *
+ * Degrees of freedom that are constrained in the AffineConstraints object
+ * passed to initialize() - boundary values, hanging nodes, or periodicity
+ * constraints - are excluded from the patches: they contribute zero to the
+ * local right-hand side and do not receive updates. In addition, the 1d
+ * matrices incorporate the boundary conditions of the faces of the patch:
+ * faces on the outer boundary are treated as homogeneous Dirichlet
+ * boundaries unless their boundary id is contained in
+ * AdditionalData::neumann_boundary_ids.
+ *
+ * The class is restricted to scalar elements with a tensor-product
+ * structure on meshes consisting of quadrilaterals/hexahedra. The local
+ * solvers are exact for the Laplacian on axis-aligned meshes; on deformed
+ * meshes, the 1d matrices are built from the cell extents along the
+ * coordinate directions and the patch inverses become an approximation,
+ * which is typically still an effective smoother. Meshes with hanging
+ * nodes are supported for `n_overlap == 1`; for larger overlap, the
+ * face neighbors of locally owned cells must be on the same refinement
+ * level.
+ */
+template <int dim,
+          typename Number              = double,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class TensorProductSchwarzPreconditioner
+{
+public:
+  /**
+   * The type of vectors this class operates on.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * Struct to configure TensorProductSchwarzPreconditioner.
+   */
+  struct AdditionalData
+  {
+    /**
+     * How the contributions of overlapping patches are weighted.
+     */
+    enum class WeightingType
+    {
+      /**
+       * No weighting: contributions of all patches are simply added up.
+       */
+      none,
+      /**
+       * Multiply by one over the square root of the patch count of each
+       * degree of freedom both before and after the local solve. This
+       * keeps the preconditioner symmetric.
+       */
+      symmetric
+    };
+
+    /**
+     * Constructor.
+     */
+    AdditionalData(const unsigned int  n_overlap  = 1,
+                   const double        relaxation = 1.0,
+                   const WeightingType weighting_type = WeightingType::symmetric,
+                   const std::set<types::boundary_id> &neumann_boundary_ids = {})
+      : n_overlap(n_overlap)
+      , relaxation(relaxation)
+      , weighting_type(weighting_type)
+      , neumann_boundary_ids(neumann_boundary_ids)
+    {}
+
+    /**
+     * Number of layers of degrees of freedom a patch reaches into each
+     * face neighbor. The value 1 corresponds to cell-local patches that
+     * overlap only in the degrees of freedom shared between cells. The
+     * value needs to be smaller than or equal to the polynomial degree of
+     * the finite element.
+     */
+    unsigned int n_overlap;
+
+    /**
+     * Damping factor applied to the patch contributions.
+     */
+    double relaxation;
+
+    /**
+     * How the contributions of overlapping patches are weighted.
+     */
+    WeightingType weighting_type;
+
+    /**
+     * Boundary ids of faces on which natural (Neumann) boundary
+     * conditions are imposed. All other boundary faces are treated as
+     * homogeneous Dirichlet boundaries in the local solvers.
+     */
+    std::set<types::boundary_id> neumann_boundary_ids;
+  };
+
+  /**
+   * Set up the patches and compute the fast diagonalization data. The 1d
+   * element @p fe_1d and the 1d quadrature @p quadrature determine the 1d
+   * mass and stiffness matrices and have to match the tensor-product
+   * structure of the element of @p dof_handler. Degrees of freedom
+   * constrained in @p constraints are excluded from the patches.
+   */
+  void
+  initialize(const DoFHandler<dim>           &dof_handler,
+             const AffineConstraints<Number> &constraints,
+             const FiniteElement<1>          &fe_1d,
+             const Quadrature<1>             &quadrature,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Apply the preconditioner: loop over all patches, gather the local
+   * values of @p src, apply the batched patch inverses, and scatter the
+   * weighted results back into @p dst.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the transposed preconditioner. Since the preconditioner is
+   * symmetric, this is the same as vmult().
+   */
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return the memory consumption of this class in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Number of degrees of freedom per patch.
+   */
+  unsigned int n_patch_dofs;
+
+  /**
+   * Number of locally owned cells, i.e., of patches.
+   */
+  unsigned int n_patches;
+
+  /**
+   * Damping factor applied to the patch contributions.
+   */
+  double relaxation;
+
+  /**
+   * How the contributions of overlapping patches are weighted.
+   */
+  typename AdditionalData::WeightingType weighting_type;
+
+  /**
+   * For each patch, the local indices (into the ghosted vectors below) of
+   * its degrees of freedom in lexicographic ordering. Constrained degrees
+   * of freedom and patch positions outside the domain are marked by
+   * numbers::invalid_unsigned_int.
+   */
+  std::vector<unsigned int> patch_dof_indices;
+
+  /**
+   * The collection of batched fast diagonalization patch inverses.
+   */
+  TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType> matrices;
+
+  /**
+   * Ghosted scratch vector holding the source values during vmult().
+   */
+  mutable VectorType src_ghost;
+
+  /**
+   * Ghosted scratch vector accumulating the patch contributions during
+   * vmult().
+   */
+  mutable VectorType dst_ghost;
+
+  /**
+   * Ghosted vector with the weights of the degrees of freedom. Empty if
+   * no weighting is requested.
+   */
+  VectorType weights;
+};
+
+
+
+/*----------------------- Inline functions ----------------------------------*/
+
+#ifndef DOXYGEN
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+TensorProductSchwarzPreconditioner<dim, Number, VectorizedArrayType>::
+  initialize(const DoFHandler<dim>           &dof_handler,
+             const AffineConstraints<Number> &constraints,
+             const FiniteElement<1>          &fe_1d,
+             const Quadrature<1>             &quadrature,
+             const AdditionalData            &additional_data)
+{
+  const FiniteElement<dim> &fe = dof_handler.get_fe();
+
+  AssertThrow(fe.n_components() == 1, ExcNotImplemented());
+  AssertThrow(fe.reference_cell().is_hyper_cube(), ExcNotImplemented());
+  AssertDimension(fe_1d.tensor_degree(), fe.tensor_degree());
+  AssertDimension(Utilities::pow(fe_1d.n_dofs_per_cell(), dim),
+                  fe.n_dofs_per_cell());
+
+  const unsigned int n_overlap = additional_data.n_overlap;
+  const unsigned int n_dofs_1d = fe_1d.n_dofs_per_cell();
+
+  AssertIndexRange(0, n_overlap);
+  AssertIndexRange(n_overlap, n_dofs_1d);
+
+  this->relaxation     = additional_data.relaxation;
+  this->weighting_type = additional_data.weighting_type;
+
+  const unsigned int n_dofs_1d_patch = n_dofs_1d + 2 * (n_overlap - 1);
+  this->n_patch_dofs = Utilities::pow(n_dofs_1d_patch, dim);
+
+  // set up the ghosted scratch vectors; the patches of locally owned
+  // cells reach at most into the ghost cells, whose degrees of freedom
+  // are part of the locally relevant set
+  const IndexSet locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(dof_handler);
+  src_ghost.reinit(dof_handler.locally_owned_dofs(),
+                   locally_relevant_dofs,
+                   dof_handler.get_communicator());
+  dst_ghost.reinit(src_ghost);
+
+  const auto &partitioner = src_ghost.get_partitioner();
+
+  this->n_patches = 0;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    if (cell->is_locally_owned())
+      ++this->n_patches;
+
+  patch_dof_indices.resize(static_cast<std::size_t>(n_patches) * n_patch_dofs);
+
+  constexpr unsigned int n_lanes   = VectorizedArrayType::size();
+  const unsigned int     n_batches = (n_patches + n_lanes - 1) / n_lanes;
+
+  matrices.reserve(n_batches);
+
+  // 1d reference matrices, computed only once; the creation of the
+  // patch matrices below then only scales and combines them
+  const auto reference_matrices = TensorProductMatrixCreator::internal::
+    create_reference_mass_and_stiffness_matrices<Number>(fe_1d, quadrature);
+  AssertThrow(std::get<2>(reference_matrices) == false, ExcNotImplemented());
+
+  const std::vector<unsigned int> lexicographic_to_hierarchic =
+    FETools::lexicographic_to_hierarchic_numbering<dim>(fe.tensor_degree());
+
+  // returns the neighbor of a cell behind the given face, also across
+  // periodic boundaries, or an invalid iterator at the outer boundary
+  const auto neighbor_cell =
+    [](const typename DoFHandler<dim>::cell_iterator &cell,
+       const unsigned int face) -> typename DoFHandler<dim>::cell_iterator {
+    if (cell->has_periodic_neighbor(face))
+      return cell->periodic_neighbor(face);
+    else if (cell->at_boundary(face))
+      return {};
+    else
+      return cell->neighbor(face);
+  };
+
+  const unsigned int n_offset_codes = Utilities::pow(3, dim);
+  std::vector<std::vector<types::global_dof_index>> dofs_on_patch_cells(
+    n_offset_codes);
+
+  std::array<Table<2, VectorizedArrayType>, dim> batch_Ms;
+  std::array<Table<2, VectorizedArrayType>, dim> batch_Ks;
+
+  unsigned int patch = 0;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned() == false)
+        continue;
+
+      // 1) collect the dof indices of the cells making up the patch;
+      // the cells are identified by an offset code that encodes, for
+      // each direction, whether the cell lies to the left of, at, or to
+      // the right of the patch-defining cell. An empty vector indicates
+      // that the patch leaves the domain in this direction.
+      const unsigned int center_code = (n_offset_codes - 1) / 2;
+
+      dofs_on_patch_cells[center_code].resize(fe.n_dofs_per_cell());
+      cell->get_dof_indices(dofs_on_patch_cells[center_code]);
+
+      if (n_overlap > 1)
+        for (unsigned int code = 0; code < n_offset_codes; ++code)
+          {
+            if (code == center_code)
+              continue;
+
+            typename DoFHandler<dim>::cell_iterator other = cell;
+
+            for (unsigned int d = 0, c = code; d < dim; ++d, c /= 3)
+              {
+                const int offset = static_cast<int>(c % 3) - 1;
+
+                if (offset == 0 || other.state() != IteratorState::valid)
+                  continue;
+
+                other = neighbor_cell(other, 2 * d + (offset > 0 ? 1 : 0));
+
+                AssertThrow(other.state() != IteratorState::valid ||
+                              (other->is_active() &&
+                               other->level() == cell->level()),
+                            ExcMessage(
+                              "Patches with overlap into neighboring cells "
+                              "require the face neighbors of locally owned "
+                              "cells to be on the same refinement level."));
+              }
+
+            if (other.state() == IteratorState::valid)
+              {
+                dofs_on_patch_cells[code].resize(fe.n_dofs_per_cell());
+                other->get_dof_indices(dofs_on_patch_cells[code]);
+              }
+            else
+              dofs_on_patch_cells[code].clear();
+          }
+
+      // 2) translate the patch positions to local vector indices,
+      // excluding constrained degrees of freedom and positions outside
+      // the domain
+      for (unsigned int i = 0; i < n_patch_dofs; ++i)
+        {
+          unsigned int code        = 0;
+          unsigned int code_stride = 1;
+          unsigned int lex         = 0;
+          unsigned int lex_stride  = 1;
+
+          for (unsigned int d = 0, c = i; d < dim; ++d, c /= n_dofs_1d_patch)
+            {
+              const int t = static_cast<int>(c % n_dofs_1d_patch) -
+                            static_cast<int>(n_overlap - 1);
+
+              int          offset = 0;
+              unsigned int index_1d;
+              if (t < 0)
+                {
+                  offset   = -1;
+                  index_1d = n_dofs_1d - 1 + t;
+                }
+              else if (t >= static_cast<int>(n_dofs_1d))
+                {
+                  offset   = +1;
+                  index_1d = t - (n_dofs_1d - 1);
+                }
+              else
+                index_1d = t;
+
+              code += (offset + 1) * code_stride;
+              code_stride *= 3;
+              lex += index_1d * lex_stride;
+              lex_stride *= n_dofs_1d;
+            }
+
+          const auto &dofs = dofs_on_patch_cells[code];
+
+          unsigned int local_index = numbers::invalid_unsigned_int;
+
+          if (dofs.empty() == false)
+            {
+              const types::global_dof_index global_index =
+                dofs[lexicographic_to_hierarchic[lex]];
+
+              if (constraints.is_constrained(global_index) == false)
+                local_index = partitioner->global_to_local(global_index);
+            }
+
+          patch_dof_indices[static_cast<std::size_t>(patch) * n_patch_dofs +
+                            i] = local_index;
+        }
+
+      // 3) determine the cell extents and boundary types entering the 1d
+      // matrices
+      dealii::ndarray<double, dim, 3> cell_extent;
+      dealii::ndarray<TensorProductMatrixCreator::LaplaceBoundaryType, dim, 2>
+        boundary_type;
+
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          cell_extent[d][1] = cell->extent_in_direction(d);
+
+          for (unsigned int s = 0; s < 2; ++s)
+            {
+              const auto neighbor = neighbor_cell(cell, 2 * d + s);
+
+              if (neighbor.state() == IteratorState::valid)
+                {
+                  boundary_type[d][s] =
+                    TensorProductMatrixCreator::internal_boundary;
+                  cell_extent[d][2 * s] = neighbor->extent_in_direction(d);
+                }
+              else
+                {
+                  const auto bid = cell->face(2 * d + s)->boundary_id();
+                  boundary_type[d][s] =
+                    (additional_data.neumann_boundary_ids.count(bid) > 0) ?
+                      TensorProductMatrixCreator::neumann :
+                      TensorProductMatrixCreator::dirichlet;
+                  cell_extent[d][2 * s] = 0.0;
+                }
+            }
+        }
+
+      const auto patch_matrices =
+        TensorProductMatrixCreator::create_laplace_tensor_product_matrix<
+          dim,
+          Number>(std::get<0>(reference_matrices),
+                  std::get<1>(reference_matrices),
+                  boundary_type,
+                  cell_extent,
+                  n_overlap);
+
+      // 4) write the 1d matrices into the current lane of the batch and
+      // hand completed batches over to the collection; unused lanes stay
+      // zero and are filtered out by the collection
+      const unsigned int lane = patch % n_lanes;
+
+      if (lane == 0)
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            batch_Ms[d].reinit(n_dofs_1d_patch, n_dofs_1d_patch);
+            batch_Ks[d].reinit(n_dofs_1d_patch, n_dofs_1d_patch);
+          }
+
+      for (unsigned int d = 0; d < dim; ++d)
+        for (unsigned int i = 0; i < n_dofs_1d_patch; ++i)
+          for (unsigned int j = 0; j < n_dofs_1d_patch; ++j)
+            {
+              batch_Ms[d][i][j][lane] = patch_matrices.first[d][i][j];
+              batch_Ks[d][i][j][lane] = patch_matrices.second[d][i][j];
+            }
+
+      if (lane + 1 == n_lanes || patch + 1 == n_patches)
+        matrices.insert(patch / n_lanes, batch_Ms, batch_Ks);
+
+      ++patch;
+    }
+
+  matrices.finalize();
+
+  // 5) compute the weights as the inverse square root of the number of
+  // patches each degree of freedom belongs to, accumulated over all
+  // processes
+  if (weighting_type == AdditionalData::WeightingType::symmetric)
+    {
+      weights.reinit(src_ghost);
+
+      for (const unsigned int local_index : patch_dof_indices)
+        if (local_index != numbers::invalid_unsigned_int)
+          weights.local_element(local_index) += 1.0;
+
+      weights.compress(VectorOperation::add);
+
+      for (unsigned int i = 0; i < weights.locally_owned_size(); ++i)
+        {
+          const Number count = weights.local_element(i);
+          weights.local_element(i) =
+            (count > 0.0) ? Number(1.0) / std::sqrt(count) : 0.0;
+        }
+
+      weights.update_ghost_values();
+    }
+  else
+    weights.reinit(0);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+TensorProductSchwarzPreconditioner<dim, Number, VectorizedArrayType>::vmult(
+  VectorType &dst,
+  const VectorType &src) const
+{
+  AssertDimension(src.locally_owned_size(), src_ghost.locally_owned_size());
+  AssertDimension(dst.locally_owned_size(), dst_ghost.locally_owned_size());
+
+  src_ghost.copy_locally_owned_data_from(src);
+  src_ghost.update_ghost_values();
+
+  dst_ghost = 0.0;
+
+  const bool use_weights =
+    (weighting_type == AdditionalData::WeightingType::symmetric);
+
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  AlignedVector<VectorizedArrayType> src_local(n_patch_dofs);
+  AlignedVector<VectorizedArrayType> dst_local(n_patch_dofs);
+
+  const ArrayView<const VectorizedArrayType> src_view(src_local.data(),
+                                                      n_patch_dofs);
+  const ArrayView<VectorizedArrayType>       dst_view(dst_local.data(),
+                                                      n_patch_dofs);
+
+  for (unsigned int patch = 0; patch < n_patches; patch += n_lanes)
+    {
+      const unsigned int n_active_lanes =
+        std::min(n_lanes, n_patches - patch);
+
+      // gather the (weighted) source values of all lanes
+      for (unsigned int i = 0; i < n_patch_dofs; ++i)
+        src_local[i] = VectorizedArrayType();
+
+      for (unsigned int v = 0; v < n_active_lanes; ++v)
+        {
+          const unsigned int *indices =
+            patch_dof_indices.data() +
+            static_cast<std::size_t>(patch + v) * n_patch_dofs;
+
+          for (unsigned int i = 0; i < n_patch_dofs; ++i)
+            if (indices[i] != numbers::invalid_unsigned_int)
+              {
+                Number value = src_ghost.local_element(indices[i]);
+                if (use_weights)
+                  value *= weights.local_element(indices[i]);
+                src_local[i][v] = value;
+              }
+        }
+
+      matrices.apply_inverse(patch / n_lanes, dst_view, src_view);
+
+      // scatter the (weighted) patch solutions back
+      for (unsigned int v = 0; v < n_active_lanes; ++v)
+        {
+          const unsigned int *indices =
+            patch_dof_indices.data() +
+            static_cast<std::size_t>(patch + v) * n_patch_dofs;
+
+          for (unsigned int i = 0; i < n_patch_dofs; ++i)
+            if (indices[i] != numbers::invalid_unsigned_int)
+              {
+                Number value = relaxation * dst_local[i][v];
+                if (use_weights)
+                  value *= weights.local_element(indices[i]);
+                dst_ghost.local_element(indices[i]) += value;
+              }
+        }
+    }
+
+  dst_ghost.compress(VectorOperation::add);
+  dst.copy_locally_owned_data_from(dst_ghost);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+TensorProductSchwarzPreconditioner<dim, Number, VectorizedArrayType>::Tvmult(
+  VectorType &dst,
+  const VectorType &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+std::size_t
+TensorProductSchwarzPreconditioner<dim, Number, VectorizedArrayType>::
+  memory_consumption() const
+{
+  return MemoryConsumption::memory_consumption(patch_dof_indices) +
+         matrices.memory_consumption() + src_ghost.memory_consumption() +
+         dst_ghost.memory_consumption() + weights.memory_consumption();
+}
+
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -40,7 +40,10 @@
 #include <deal.II/numerics/matrix_tools.h>
 #include <deal.II/numerics/vector_tools_boundary.h>
 
+#include <algorithm>
 #include <limits>
+#include <utility>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -50,6 +53,12 @@ namespace VectorTools
 
   namespace internal
   {
+    // Collect the boundary values as a flat array of (index, value) pairs
+    // instead of writing into a std::map right away: one entry is appended
+    // per matching degree of freedom and face, so the array may contain
+    // duplicate indices, which sort_and_remove_duplicates() below removes in
+    // one sweep. This avoids the per-node allocations and pointer chasing of
+    // a std::map, which dominate the run time for fine meshes.
     template <int dim,
               int spacedim,
               typename number,
@@ -60,9 +69,9 @@ namespace VectorTools
       const M_or_MC<dim, spacedim>    &mapping,
       const DoFHandler<dim, spacedim> &dof,
       const std::map<types::boundary_id, const Function<spacedim, number> *>
-                                                &function_map,
-      std::map<types::global_dof_index, number> &boundary_values,
-      const ComponentMask                       &component_mask)
+        &function_map,
+      std::vector<std::pair<types::global_dof_index, number>> &boundary_values,
+      const ComponentMask                                     &component_mask)
     {
       Assert(
         component_mask.represents_n_components(dof.get_fe(0).n_components()),
@@ -136,11 +145,13 @@ namespace VectorTools
                     if (component_mask[fe.face_system_to_component_index(
                                            i, direction)
                                          .first])
-                      boundary_values[cell->vertex_dof_index(
-                        direction, i, cell->active_fe_index())] =
+                      boundary_values.emplace_back(
+                        cell->vertex_dof_index(direction,
+                                               i,
+                                               cell->active_fe_index()),
                         function_values(
                           fe.face_system_to_component_index(i, direction)
-                            .first);
+                            .first));
                 }
         }
       else // dim > 1
@@ -151,6 +162,11 @@ namespace VectorTools
           std::vector<types::global_dof_index> face_dofs;
           face_dofs.reserve(dof.get_fe_collection().max_dofs_per_face());
 
+          // field to store the interpolation points of the current face,
+          // kept outside the loop over faces to avoid reallocations
+          std::vector<Point<spacedim>> dof_locations;
+          dof_locations.reserve(dof.get_fe_collection().max_dofs_per_face());
+
           // array to store the values of the boundary function at the boundary
           // points. have two arrays for scalar and vector functions to use the
           // more efficient one respectively
@@ -284,9 +300,13 @@ namespace VectorTools
                       // dofs on this face
                       face_dofs.resize(fe.n_dofs_per_face(face_no));
                       face->get_dof_indices(face_dofs, cell->active_fe_index());
-                      std::vector<Point<spacedim>> dof_locations =
+                      const std::vector<Point<spacedim>> &quadrature_points =
                         fe_values.get_quadrature_points();
-                      dof_locations.resize(fe.n_dofs_per_face(face_no));
+                      AssertDimension(quadrature_points.size(),
+                                      fe.n_dofs_per_face(face_no));
+                      dof_locations.assign(quadrature_points.begin(),
+                                           quadrature_points.begin() +
+                                             fe.n_dofs_per_face(face_no));
 
                       if (fe_is_system)
                         {
@@ -362,8 +382,8 @@ namespace VectorTools
                                 }
 
                               if (component_mask[component] == true)
-                                boundary_values[face_dofs[i]] =
-                                  dof_values_system[i](component);
+                                boundary_values.emplace_back(
+                                  face_dofs[i], dof_values_system[i](component));
                             }
                         }
                       else
@@ -379,14 +399,45 @@ namespace VectorTools
                           // enter into list
 
                           for (unsigned int i = 0; i < face_dofs.size(); ++i)
-                            boundary_values[face_dofs[i]] =
-                              dof_values_scalar[i];
+                            boundary_values.emplace_back(face_dofs[i],
+                                                         dof_values_scalar[i]);
                         }
                     }
                 }
         }
     } // end of interpolate_boundary_values
-  }   // namespace internal
+
+
+
+    // Sort the (index, value) pairs produced by
+    // do_interpolate_boundary_values() by index and remove duplicate
+    // indices, keeping the value written last. The latter reproduces the
+    // overwrite semantics of the historic map-based implementation for
+    // degrees of freedom shared between several boundary faces.
+    template <typename number>
+    static inline void
+    sort_and_remove_duplicates(
+      std::vector<std::pair<types::global_dof_index, number>> &boundary_values)
+    {
+      std::stable_sort(boundary_values.begin(),
+                       boundary_values.end(),
+                       [](const auto &a, const auto &b) {
+                         return a.first < b.first;
+                       });
+
+      std::size_t n_unique = 0;
+      for (std::size_t i = 0; i < boundary_values.size();)
+        {
+          std::size_t j = i + 1;
+          while (j < boundary_values.size() &&
+                 boundary_values[j].first == boundary_values[i].first)
+            ++j;
+          boundary_values[n_unique++] = boundary_values[j - 1];
+          i                           = j;
+        }
+      boundary_values.resize(n_unique);
+    }
+  } // namespace internal
 
 
 
@@ -400,8 +451,21 @@ namespace VectorTools
     std::map<types::global_dof_index, number> &boundary_values,
     const ComponentMask                       &component_mask_)
   {
+    std::vector<std::pair<types::global_dof_index, number>> flat_values;
     internal::do_interpolate_boundary_values(
-      mapping, dof, function_map, boundary_values, component_mask_);
+      mapping, dof, function_map, flat_values, component_mask_);
+    internal::sort_and_remove_duplicates(flat_values);
+
+    // insert in ascending order of indices, so that each map insertion is
+    // done with a valid hint and runs in amortized constant time
+    auto hint = boundary_values.begin();
+    for (const auto &boundary_value : flat_values)
+      {
+        hint = boundary_values.insert_or_assign(hint,
+                                                boundary_value.first,
+                                                boundary_value.second);
+        ++hint;
+      }
   }
 
 
@@ -433,8 +497,19 @@ namespace VectorTools
     std::map<types::global_dof_index, number> &boundary_values,
     const ComponentMask                       &component_mask_)
   {
+    std::vector<std::pair<types::global_dof_index, number>> flat_values;
     internal::do_interpolate_boundary_values(
-      mapping, dof, function_map, boundary_values, component_mask_);
+      mapping, dof, function_map, flat_values, component_mask_);
+    internal::sort_and_remove_duplicates(flat_values);
+
+    auto hint = boundary_values.begin();
+    for (const auto &boundary_value : flat_values)
+      {
+        hint = boundary_values.insert_or_assign(hint,
+                                                boundary_value.first,
+                                                boundary_value.second);
+        ++hint;
+      }
   }
 
 
@@ -511,9 +586,12 @@ namespace VectorTools
     AffineConstraints<number> &constraints,
     const ComponentMask       &component_mask_)
   {
-    std::map<types::global_dof_index, number> boundary_values;
-    interpolate_boundary_values(
+    // skip the detour through a std::map and feed the sorted list of
+    // boundary values directly into the constraints object
+    std::vector<std::pair<types::global_dof_index, number>> boundary_values;
+    internal::do_interpolate_boundary_values(
       mapping, dof, function_map, boundary_values, component_mask_);
+    internal::sort_and_remove_duplicates(boundary_values);
     for (const auto &boundary_value : boundary_values)
       {
         if (constraints.can_store_line(boundary_value.first) &&
@@ -554,9 +632,12 @@ namespace VectorTools
     AffineConstraints<number> &constraints,
     const ComponentMask       &component_mask_)
   {
-    std::map<types::global_dof_index, number> boundary_values;
-    interpolate_boundary_values(
+    // skip the detour through a std::map and feed the sorted list of
+    // boundary values directly into the constraints object
+    std::vector<std::pair<types::global_dof_index, number>> boundary_values;
+    internal::do_interpolate_boundary_values(
       mapping, dof, function_map, boundary_values, component_mask_);
+    internal::sort_and_remove_duplicates(boundary_values);
     for (const auto &boundary_value : boundary_values)
       {
         if (constraints.can_store_line(boundary_value.first) &&
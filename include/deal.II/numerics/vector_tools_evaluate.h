@@ -29,6 +29,8 @@
 
 #include <deal.II/matrix_free/fe_point_evaluation.h>
 
+#include <boost/serialization/utility.hpp>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace VectorTools
@@ -277,6 +279,112 @@ namespace VectorTools
                                      const unsigned int
                                        first_selected_component = 0);
 
+  /**
+   * Given a (distributed) solution vector @p vector, reinitialize @p cache and
+   * evaluate both the values and the gradients at the (arbitrary and even
+   * remote) points specified by @p evaluation_points.
+   *
+   * The result is equivalent to calling point_values() and point_gradients()
+   * separately, but both quantities are interpolated in a single sweep over
+   * the cells and exchanged in a single message per pair of processes, which
+   * halves the number of communication rounds. This is beneficial if both
+   * quantities are needed anyway and the evaluation is performed repeatedly,
+   * e.g., once per time step at a non-matching interface.
+   *
+   * @note The same comments as in the case of point_values() are true for this
+   *   function.
+   *
+   * @warning This is a collective call that needs to be executed by all
+   *   processors in the communicator.
+   *
+   * @dealiiConceptRequires{(concepts::is_dealii_vector_type<VectorType> &&
+   *    concepts::is_triangulation_or_dof_handler<MeshType<dim, spacedim>>)}
+   */
+  template <int n_components,
+            template <int, int>
+            class MeshType,
+            int dim,
+            int spacedim,
+            typename VectorType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_dealii_vector_type<VectorType> &&
+     concepts::is_triangulation_or_dof_handler<MeshType<dim, spacedim>>))
+  std::vector<std::pair<
+    typename FEPointEvaluation<n_components,
+                               dim,
+                               spacedim,
+                               typename VectorType::value_type>::value_type,
+    typename FEPointEvaluation<n_components,
+                               dim,
+                               spacedim,
+                               typename VectorType::value_type>::
+      gradient_type>> point_values_and_gradients(const Mapping<dim> &mapping,
+                                                 const MeshType<dim, spacedim>
+                                                                  &mesh,
+                                                 const VectorType &vector,
+                                                 const std::vector<
+                                                   Point<spacedim>>
+                                                   &evaluation_points,
+                                                 Utilities::MPI::
+                                                   RemotePointEvaluation<
+                                                     dim,
+                                                     spacedim> &cache,
+                                                 const EvaluationFlags::
+                                                   EvaluationFlags flags =
+                                                     EvaluationFlags::avg,
+                                                 const unsigned int
+                                                   first_selected_component =
+                                                     0);
+
+  /**
+   * Given a (distributed) solution vector @p vector, evaluate both the values
+   * and the gradients at the points specified by @p cache which might have
+   * been set up by the above function.
+   *
+   * Compared to calling point_values() and point_gradients() separately, the
+   * data of both quantities is exchanged within a single communication step.
+   *
+   * @note The same comments as in the case of point_values() are true for this
+   *   function.
+   *
+   * @warning This is a collective call that needs to be executed by all
+   *   processors in the communicator.
+   *
+   * @dealiiConceptRequires{(concepts::is_dealii_vector_type<VectorType> &&
+   *    concepts::is_triangulation_or_dof_handler<MeshType<dim, spacedim>>)}
+   */
+  template <int n_components,
+            template <int, int>
+            class MeshType,
+            int dim,
+            int spacedim,
+            typename VectorType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_dealii_vector_type<VectorType> &&
+     concepts::is_triangulation_or_dof_handler<MeshType<dim, spacedim>>))
+  std::vector<std::pair<
+    typename FEPointEvaluation<n_components,
+                               dim,
+                               spacedim,
+                               typename VectorType::value_type>::value_type,
+    typename FEPointEvaluation<n_components,
+                               dim,
+                               spacedim,
+                               typename VectorType::value_type>::
+      gradient_type>> point_values_and_gradients(const Utilities::MPI::
+                                                   RemotePointEvaluation<
+                                                     dim,
+                                                     spacedim>     &cache,
+                                                 const MeshType<dim, spacedim>
+                                                                  &mesh,
+                                                 const VectorType &vector,
+                                                 const EvaluationFlags::
+                                                   EvaluationFlags flags =
+                                                     EvaluationFlags::avg,
+                                                 const unsigned int
+                                                   first_selected_component =
+                                                     0);
+
 
 
   // inlined functions
@@ -351,6 +459,48 @@ namespace VectorTools
 
 
 
+  template <int n_components,
+            template <int, int>
+            class MeshType,
+            int dim,
+            int spacedim,
+            typename VectorType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_dealii_vector_type<VectorType> &&
+     concepts::is_triangulation_or_dof_handler<MeshType<dim, spacedim>>))
+  inline std::vector<std::pair<
+    typename FEPointEvaluation<n_components,
+                               dim,
+                               spacedim,
+                               typename VectorType::value_type>::value_type,
+    typename FEPointEvaluation<n_components,
+                               dim,
+                               spacedim,
+                               typename VectorType::value_type>::
+      gradient_type>> point_values_and_gradients(const Mapping<dim> &mapping,
+                                                 const MeshType<dim, spacedim>
+                                                                  &mesh,
+                                                 const VectorType &vector,
+                                                 const std::vector<
+                                                   Point<spacedim>>
+                                                   &evaluation_points,
+                                                 Utilities::MPI::
+                                                   RemotePointEvaluation<
+                                                     dim,
+                                                     spacedim> &cache,
+                                                 const EvaluationFlags::
+                                                   EvaluationFlags flags,
+                                                 const unsigned int
+                                                   first_selected_component)
+  {
+    cache.reinit(evaluation_points, mesh.get_triangulation(), mapping);
+
+    return point_values_and_gradients<n_components>(
+      cache, mesh, vector, flags, first_selected_component);
+  }
+
+
+
   namespace internal
   {
     /**
@@ -445,6 +595,31 @@ namespace VectorTools
 
 
 
+    /**
+     * Perform reduction for pairs of values and gradients as produced by
+     * point_values_and_gradients(), by reducing both members separately.
+     */
+    template <typename T1, typename T2>
+    std::pair<T1, T2>
+    reduce(const EvaluationFlags::EvaluationFlags   &flags,
+           const ArrayView<const std::pair<T1, T2>> &values)
+    {
+      std::vector<T1> first(values.size());
+      std::vector<T2> second(values.size());
+
+      for (unsigned int i = 0; i < values.size(); ++i)
+        {
+          first[i]  = values[i].first;
+          second[i] = values[i].second;
+        }
+
+      return {reduce(flags, ArrayView<const T1>(first.data(), first.size())),
+              reduce(flags,
+                     ArrayView<const T2>(second.data(), second.size()))};
+    }
+
+
+
     template <int n_components,
               int dim,
               int spacedim,
@@ -585,6 +760,16 @@ namespace VectorTools
 
 
 
+    template <typename Number1, typename Number2, typename Number3>
+    void
+    set_value(std::pair<Number1, Number2> &, const Number3 &)
+    {
+      Assert(false,
+             ExcMessage("For cell-data vectors, only values can be queried."));
+    }
+
+
+
     template <int n_components,
               int dim,
               int spacedim,
@@ -840,6 +1025,68 @@ namespace VectorTools
       });
   }
 
+
+
+  template <int n_components,
+            template <int, int>
+            class MeshType,
+            int dim,
+            int spacedim,
+            typename VectorType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_dealii_vector_type<VectorType> &&
+     concepts::is_triangulation_or_dof_handler<MeshType<dim, spacedim>>))
+  inline std::vector<std::pair<
+    typename FEPointEvaluation<n_components,
+                               dim,
+                               spacedim,
+                               typename VectorType::value_type>::value_type,
+    typename FEPointEvaluation<n_components,
+                               dim,
+                               spacedim,
+                               typename VectorType::value_type>::
+      gradient_type>> point_values_and_gradients(const Utilities::MPI::
+                                                   RemotePointEvaluation<
+                                                     dim,
+                                                     spacedim>     &cache,
+                                                 const MeshType<dim, spacedim>
+                                                                  &mesh,
+                                                 const VectorType &vector,
+                                                 const EvaluationFlags::
+                                                   EvaluationFlags flags,
+                                                 const unsigned int
+                                                   first_selected_component)
+  {
+    using value_type =
+      typename FEPointEvaluation<n_components,
+                                 dim,
+                                 spacedim,
+                                 typename VectorType::value_type>::value_type;
+    using gradient_type = typename FEPointEvaluation<
+      n_components,
+      dim,
+      spacedim,
+      typename VectorType::value_type>::gradient_type;
+
+    return internal::evaluate_at_points<n_components,
+                                        dim,
+                                        spacedim,
+                                        MeshType<dim, spacedim>,
+                                        VectorType,
+                                        std::pair<value_type, gradient_type>>(
+      cache,
+      mesh,
+      vector,
+      flags,
+      first_selected_component,
+      update_values | update_gradients,
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients,
+      [](const auto &evaluator, const unsigned int &q) {
+        return std::make_pair(evaluator.get_value(q),
+                              evaluator.get_gradient(q));
+      });
+  }
+
 #endif
 } // namespace VectorTools
 
@@ -20,6 +20,8 @@
 
 #include <deal.II/numerics/vector_tools_common.h>
 
+#include <vector>
+
 DEAL_II_NAMESPACE_OPEN
 
 template <int dim, int spacedim>
@@ -243,6 +245,52 @@ namespace VectorTools
                               const NormType &norm,
                               const double    exponent = 2.);
 
+  /**
+   * Compute one or several global error norms of a finite element solution
+   * in a single sweep over the mesh. For each entry of @p norms, the result
+   * equals what the combination of VectorTools::integrate_difference() and
+   * VectorTools::compute_global_error() with that norm would return, but the
+   * finite element solution, its gradients, and the exact solution are only
+   * evaluated once at each quadrature point, and no vector with one entry
+   * per active cell is allocated. This makes the function the method of
+   * choice when several norms of the same solution are monitored repeatedly,
+   * for example the $L^2$ and $H^1$ errors in every time step.
+   *
+   * The arguments have the same meaning as in
+   * VectorTools::integrate_difference(); in particular, a vector-valued
+   * @p weight function can be used to restrict individual norms to a subset
+   * of the solution components. In the case of a parallel triangulation, the
+   * returned norms are global values, i.e., the necessary MPI reduction is
+   * performed internally.
+   *
+   * @note As with VectorTools::compute_global_error(), the
+   * NormType::W1infty_norm is not supported by this function.
+   */
+  template <int dim, typename Number, int spacedim>
+  std::vector<double>
+  compute_global_errors(const Mapping<dim, spacedim>     &mapping,
+                        const DoFHandler<dim, spacedim>  &dof,
+                        const ReadVector<Number>         &fe_function,
+                        const Function<spacedim, Number> &exact_solution,
+                        const Quadrature<dim>            &q,
+                        const std::vector<NormType>      &norms,
+                        const Function<spacedim, double> *weight = nullptr,
+                        const double                      exponent = 2.);
+
+  /**
+   * Call the compute_global_errors() function, see above, with
+   * <tt>mapping=MappingQ@<dim@>(1)</tt>.
+   */
+  template <int dim, typename Number, int spacedim>
+  std::vector<double>
+  compute_global_errors(const DoFHandler<dim, spacedim>  &dof,
+                        const ReadVector<Number>         &fe_function,
+                        const Function<spacedim, Number> &exact_solution,
+                        const Quadrature<dim>            &q,
+                        const std::vector<NormType>      &norms,
+                        const Function<spacedim, double> *weight = nullptr,
+                        const double                      exponent = 2.);
+
   /** @} */
 } // namespace VectorTools
 
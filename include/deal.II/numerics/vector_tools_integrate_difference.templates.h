@@ -138,18 +138,19 @@ namespace VectorTools
     } // namespace internal
 
 
-    // avoid compiling inner function for many vector types when we always
-    // really do the same thing by putting the main work into this helper
-    // function
+    // Evaluate the difference u-u_h (and, if requested by the update flags,
+    // its gradient) together with the weight function at the quadrature
+    // points of the current cell and store the results in the scratch data
+    // object. The expensive part of integrating a norm of the error happens
+    // here; the actual accumulation in reduce_cell_difference() below only
+    // reads the arrays filled by this function.
     template <int dim, int spacedim, typename Number>
-    double
-    integrate_difference_inner(const Function<spacedim, Number> &exact_solution,
-                               const NormType                   &norm,
-                               const Function<spacedim>         *weight,
-                               const UpdateFlags                 update_flags,
-                               const double                      exponent,
-                               const unsigned int                n_components,
-                               IDScratchData<dim, spacedim, Number> &data)
+    void
+    evaluate_cell_difference(const Function<spacedim, Number> &exact_solution,
+                             const Function<spacedim>         *weight,
+                             const UpdateFlags                 update_flags,
+                             const unsigned int                n_components,
+                             IDScratchData<dim, spacedim, Number> &data)
     {
       const bool                             fe_is_system = (n_components != 1);
       const dealii::FEValues<dim, spacedim> &fe_values =
@@ -255,6 +256,27 @@ namespace VectorTools
                 for (unsigned int d = 0; d < spacedim; ++d)
                   data.psi_grads[q][k][d] -= data.function_grads[q][k][d];
         }
+    }
+
+
+
+    // Accumulate the cell contribution of the given norm from the
+    // differences previously computed by evaluate_cell_difference(). The
+    // update flags passed to this function must be the ones the given norm
+    // requires (they decide, e.g., whether the p-th root is already taken
+    // here or only after gradient contributions have been added), which may
+    // be a subset of the flags the scratch data was evaluated with.
+    template <int dim, int spacedim, typename Number>
+    double
+    reduce_cell_difference(const NormType           &norm,
+                           const Function<spacedim> *weight,
+                           const UpdateFlags         update_flags,
+                           const double              exponent,
+                           const unsigned int        n_components,
+                           const IDScratchData<dim, spacedim, Number> &data)
+    {
+      const dealii::FEValues<dim, spacedim> &fe_values =
+        data.x_fe_values.get_present_fe_values();
 
       double diff      = 0;
       Number diff_mean = 0;
@@ -429,54 +451,55 @@ namespace VectorTools
 
 
 
-    template <int dim, int spacedim, typename Number, class OutVector>
-    DEAL_II_CXX20_REQUIRES(concepts::is_writable_dealii_vector_type<OutVector>)
-    static void do_integrate_difference(
-      const dealii::hp::MappingCollection<dim, spacedim> &mapping,
-      const DoFHandler<dim, spacedim>                    &dof,
-      const ReadVector<Number>                           &fe_function,
-      const Function<spacedim, Number>                   &exact_solution,
-      OutVector                                          &difference,
-      const dealii::hp::QCollection<dim>                 &q,
-      const NormType                                     &norm,
-      const Function<spacedim>                           *weight,
-      const double                                        exponent_1)
+    // avoid compiling inner function for many vector types when we always
+    // really do the same thing by putting the main work into this helper
+    // function
+    template <int dim, int spacedim, typename Number>
+    double
+    integrate_difference_inner(const Function<spacedim, Number> &exact_solution,
+                               const NormType                   &norm,
+                               const Function<spacedim>         *weight,
+                               const UpdateFlags                 update_flags,
+                               const double                      exponent,
+                               const unsigned int                n_components,
+                               IDScratchData<dim, spacedim, Number> &data)
     {
-      // we mark the "exponent" parameter to this function "const" since it is
-      // strictly incoming, but we need to set it to something different later
-      // on, if necessary, so have a read-write version of it:
-      double exponent = exponent_1;
-
-      const unsigned int n_components = dof.get_fe(0).n_components();
-
-      AssertDimension(exact_solution.n_components, n_components);
+      evaluate_cell_difference(
+        exact_solution, weight, update_flags, n_components, data);
+      return reduce_cell_difference(
+        norm, weight, update_flags, exponent, n_components, data);
+    }
 
-      if (weight != nullptr)
-        {
-          Assert((weight->n_components == 1) ||
-                   (weight->n_components == n_components),
-                 ExcDimensionMismatch(weight->n_components, n_components));
-        }
 
-      difference.reinit(dof.get_triangulation().n_active_cells());
 
+    // Return the exponent that is actually used when integrating the given
+    // norm: fixed-exponent norms override the user-provided value.
+    inline double
+    norm_adjusted_exponent(const NormType &norm, const double exponent)
+    {
       switch (norm)
         {
           case L2_norm:
           case H1_seminorm:
           case H1_norm:
           case Hdiv_seminorm:
-            exponent = 2.;
-            break;
+            return 2.;
 
           case L1_norm:
-            exponent = 1.;
-            break;
+            return 1.;
 
           default:
-            break;
+            return exponent;
         }
+    }
 
+
+
+    // Return the update flags required for integrating the given norm.
+    template <int dim, int spacedim>
+    UpdateFlags
+    norm_update_flags(const NormType &norm)
+    {
       UpdateFlags update_flags =
         UpdateFlags(update_quadrature_points | update_JxW_values);
       switch (norm)
@@ -504,6 +527,41 @@ namespace VectorTools
             break;
         }
 
+      return update_flags;
+    }
+
+
+
+    template <int dim, int spacedim, typename Number, class OutVector>
+    DEAL_II_CXX20_REQUIRES(concepts::is_writable_dealii_vector_type<OutVector>)
+    static void do_integrate_difference(
+      const dealii::hp::MappingCollection<dim, spacedim> &mapping,
+      const DoFHandler<dim, spacedim>                    &dof,
+      const ReadVector<Number>                           &fe_function,
+      const Function<spacedim, Number>                   &exact_solution,
+      OutVector                                          &difference,
+      const dealii::hp::QCollection<dim>                 &q,
+      const NormType                                     &norm,
+      const Function<spacedim>                           *weight,
+      const double                                        exponent_1)
+    {
+      const double exponent = norm_adjusted_exponent(norm, exponent_1);
+
+      const unsigned int n_components = dof.get_fe(0).n_components();
+
+      AssertDimension(exact_solution.n_components, n_components);
+
+      if (weight != nullptr)
+        {
+          Assert((weight->n_components == 1) ||
+                   (weight->n_components == n_components),
+                 ExcDimensionMismatch(weight->n_components, n_components));
+        }
+
+      difference.reinit(dof.get_triangulation().n_active_cells());
+
+      const UpdateFlags update_flags = norm_update_flags<dim, spacedim>(norm);
+
       const dealii::hp::FECollection<dim, spacedim> &fe_collection =
         dof.get_fe_collection();
       IDScratchData<dim, spacedim, Number> data(mapping,
@@ -544,6 +602,167 @@ namespace VectorTools
           difference(cell->active_cell_index()) = 0;
     }
 
+
+
+    template <int dim, int spacedim, typename Number>
+    std::vector<double>
+    do_compute_global_errors(
+      const dealii::hp::MappingCollection<dim, spacedim> &mapping,
+      const DoFHandler<dim, spacedim>                    &dof,
+      const ReadVector<Number>                           &fe_function,
+      const Function<spacedim, Number>                   &exact_solution,
+      const dealii::hp::QCollection<dim>                 &q,
+      const std::vector<NormType>                        &norms,
+      const Function<spacedim>                           *weight,
+      const double                                        exponent)
+    {
+      const unsigned int n_components = dof.get_fe(0).n_components();
+
+      AssertDimension(exact_solution.n_components, n_components);
+
+      if (weight != nullptr)
+        {
+          Assert((weight->n_components == 1) ||
+                   (weight->n_components == n_components),
+                 ExcDimensionMismatch(weight->n_components, n_components));
+        }
+
+      // determine the exponent and update flags of each requested norm, and
+      // the union of all flags with which the differences are evaluated
+      std::vector<double>      exponents(norms.size());
+      std::vector<UpdateFlags> update_flags(norms.size());
+      UpdateFlags              all_update_flags =
+        UpdateFlags(update_quadrature_points | update_JxW_values);
+      for (unsigned int i = 0; i < norms.size(); ++i)
+        {
+          AssertThrow(norms[i] != W1infty_norm,
+                      ExcMessage(
+                        "compute_global_errors() is impossible for "
+                        "the W1infty_norm. See the documentation for "
+                        "NormType::W1infty_norm for more information."));
+
+          exponents[i]    = norm_adjusted_exponent(norms[i], exponent);
+          update_flags[i] = norm_update_flags<dim, spacedim>(norms[i]);
+          all_update_flags |= update_flags[i];
+        }
+
+      const dealii::hp::FECollection<dim, spacedim> &fe_collection =
+        dof.get_fe_collection();
+      IDScratchData<dim, spacedim, Number> data(mapping,
+                                                fe_collection,
+                                                q,
+                                                all_update_flags);
+
+      // one running accumulator per requested norm: a sum of (powers of)
+      // the cell values for the integral-type norms, a maximum for the
+      // maximum-type norms
+      std::vector<double> local(norms.size(), 0.);
+
+      for (const auto &cell : dof.active_cell_iterators())
+        if (cell->is_locally_owned())
+          {
+            // initialize for this cell and evaluate the differences once,
+            // with the union of all update flags
+            data.x_fe_values.reinit(cell);
+
+            const dealii::FEValues<dim, spacedim> &fe_values =
+              data.x_fe_values.get_present_fe_values();
+            const unsigned int n_q_points = fe_values.n_quadrature_points;
+            data.resize_vectors(n_q_points, n_components);
+
+            if (all_update_flags & update_values)
+              fe_values.get_function_values(fe_function, data.function_values);
+            if (all_update_flags & update_gradients)
+              fe_values.get_function_gradients(fe_function,
+                                               data.function_grads);
+
+            evaluate_cell_difference(
+              exact_solution, weight, all_update_flags, n_components, data);
+
+            for (unsigned int i = 0; i < norms.size(); ++i)
+              {
+                const double cell_value =
+                  reduce_cell_difference(norms[i],
+                                         weight,
+                                         update_flags[i],
+                                         exponents[i],
+                                         n_components,
+                                         data);
+
+                // accumulate the cell value in the same way in which
+                // compute_global_error() combines the entries of the
+                // cellwise error vector
+                switch (norms[i])
+                  {
+                    case L2_norm:
+                    case H1_seminorm:
+                    case H1_norm:
+                    case Hdiv_seminorm:
+                      local[i] += cell_value * cell_value;
+                      break;
+
+                    case L1_norm:
+                    case mean:
+                      local[i] += cell_value;
+                      break;
+
+                    case Linfty_norm:
+                    case W1infty_seminorm:
+                      local[i] = std::max(local[i], cell_value);
+                      break;
+
+                    case Lp_norm:
+                    case W1p_norm:
+                    case W1p_seminorm:
+                      local[i] += std::pow(cell_value, exponents[i]);
+                      break;
+
+                    default:
+                      DEAL_II_NOT_IMPLEMENTED();
+                      break;
+                  }
+              }
+          }
+
+      // finally combine the processor-local results and undo the powers
+      const MPI_Comm comm = dof.get_triangulation().get_communicator();
+
+      std::vector<double> global(norms.size(), 0.);
+      for (unsigned int i = 0; i < norms.size(); ++i)
+        switch (norms[i])
+          {
+            case L2_norm:
+            case H1_seminorm:
+            case H1_norm:
+            case Hdiv_seminorm:
+              global[i] = std::sqrt(Utilities::MPI::sum(local[i], comm));
+              break;
+
+            case L1_norm:
+            case mean:
+              global[i] = Utilities::MPI::sum(local[i], comm);
+              break;
+
+            case Linfty_norm:
+            case W1infty_seminorm:
+              global[i] = Utilities::MPI::max(local[i], comm);
+              break;
+
+            case Lp_norm:
+            case W1p_norm:
+            case W1p_seminorm:
+              global[i] = std::pow(Utilities::MPI::sum(local[i], comm),
+                                   1. / exponents[i]);
+              break;
+
+            default:
+              DEAL_II_NOT_IMPLEMENTED();
+              break;
+          }
+
+      return global;
+    }
+
   } // namespace internal
 
 
@@ -736,6 +955,52 @@ namespace VectorTools
       }
     return 0.0;
   }
+
+
+
+  template <int dim, typename Number, int spacedim>
+  std::vector<double>
+  compute_global_errors(const Mapping<dim, spacedim>     &mapping,
+                        const DoFHandler<dim, spacedim>  &dof,
+                        const ReadVector<Number>         &fe_function,
+                        const Function<spacedim, Number> &exact_solution,
+                        const Quadrature<dim>            &q,
+                        const std::vector<NormType>      &norms,
+                        const Function<spacedim>         *weight,
+                        const double                      exponent)
+  {
+    return internal::do_compute_global_errors(
+      hp::MappingCollection<dim, spacedim>(mapping),
+      dof,
+      fe_function,
+      exact_solution,
+      hp::QCollection<dim>(q),
+      norms,
+      weight,
+      exponent);
+  }
+
+
+  template <int dim, typename Number, int spacedim>
+  std::vector<double>
+  compute_global_errors(const DoFHandler<dim, spacedim>  &dof,
+                        const ReadVector<Number>         &fe_function,
+                        const Function<spacedim, Number> &exact_solution,
+                        const Quadrature<dim>            &q,
+                        const std::vector<NormType>      &norms,
+                        const Function<spacedim>         *weight,
+                        const double                      exponent)
+  {
+    return internal::do_compute_global_errors(
+      hp::StaticMappingQ1<dim, spacedim>::mapping_collection,
+      dof,
+      fe_function,
+      exact_solution,
+      hp::QCollection<dim>(q),
+      norms,
+      weight,
+      exponent);
+  }
 } // namespace VectorTools
 
 DEAL_II_NAMESPACE_CLOSE
@@ -39,6 +39,8 @@
 
 #include <deal.II/numerics/vector_tools_interpolate.h>
 
+#include <algorithm>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace LinearAlgebra
@@ -296,13 +298,6 @@ namespace VectorTools
       std::vector<std::vector<Vector<number>>> fe_function_values(fe.size());
       std::vector<std::vector<number>>         fe_dof_values(fe.size());
 
-      // We will need two temporary global vectors that store the new values
-      // and weights.
-      VectorType interpolation;
-      VectorType weights;
-      interpolation.reinit(vec);
-      weights.reinit(vec);
-
       // Store locally owned dofs, so that we can skip all non-local dofs,
       // if they do not need to be interpolated.
       const IndexSet locally_owned_dofs = vec.locally_owned_elements();
@@ -340,6 +335,84 @@ namespace VectorTools
             }
         }
 
+      // For elements whose generalized support points are genuine support
+      // points (e.g. FE_Q and FE_DGQ and systems thereof), the nodal value
+      // of a degree of freedom is simply the function value at the support
+      // point. Since support points shared between cells are mapped to the
+      // same location from either side, every cell computes the identical
+      // value for a shared degree of freedom, and we can write the values
+      // straight into the output vector: no Jacobians need to be computed,
+      // and the averaging round-trip through the two auxiliary global
+      // vectors (including their compress() communication) is not needed.
+      // This fast path requires that all components are selected, since the
+      // mixed case must copy values of deselected components from @p vec
+      // through the weighted-average machinery below.
+      if (component_mask.n_selected_components(fe.n_components()) ==
+            fe.n_components() &&
+          std::find(needs_expensive_algorithm.begin(),
+                    needs_expensive_algorithm.end(),
+                    true) == needs_expensive_algorithm.end())
+        {
+          hp::FEValues<dim, spacedim> fe_values(mapping_collection,
+                                                fe,
+                                                support_quadrature,
+                                                update_quadrature_points);
+
+          for (const auto &cell : dof_handler.active_cell_iterators())
+            {
+              if (!cell->is_locally_owned())
+                continue;
+
+              const unsigned int fe_index = cell->active_fe_index();
+              const auto         n_dofs   = fe[fe_index].n_dofs_per_cell();
+              if (n_dofs == 0)
+                continue;
+
+              if (!function(cell))
+                continue;
+
+              fe_values.reinit(cell);
+              const std::vector<Point<spacedim>> &support_points =
+                fe_values.get_present_fe_values().get_quadrature_points();
+
+              dofs_on_cell.resize(n_dofs);
+              cell->get_dof_indices(dofs_on_cell);
+
+              auto &function_values = fe_function_values[fe_index];
+              if (function_values.size() != support_points.size())
+                function_values.resize(
+                  support_points.size(),
+                  Vector<number>(fe[fe_index].n_components()));
+
+              AssertDimension(fe[fe_index].n_components(),
+                              function(cell)->n_components);
+              function(cell)->vector_value_list(support_points,
+                                                function_values);
+
+              for (unsigned int i = 0; i < n_dofs; ++i)
+                if (locally_owned_dofs.is_element(dofs_on_cell[i]))
+                  {
+                    const auto base_index =
+                      fe[fe_index].system_to_base_index(i);
+                    ::dealii::internal::ElementAccess<VectorType>::set(
+                      function_values[base_index.second]
+                                     [base_index.first.second],
+                      dofs_on_cell[i],
+                      vec);
+                  }
+            }
+
+          vec.compress(VectorOperation::insert);
+          return;
+        }
+
+      // We will need two temporary global vectors that store the new values
+      // and weights.
+      VectorType interpolation;
+      VectorType weights;
+      interpolation.reinit(vec);
+      weights.reinit(vec);
+
       // An FEValues object to evaluate (generalized) support point
       // locations as well as Jacobians and their inverses.
       // The latter are only needed for Hcurl or Hdiv conforming elements,
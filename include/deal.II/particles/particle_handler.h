@@ -582,6 +582,39 @@ namespace Particles
     get_particle_positions(std::vector<Point<spacedim>> &positions,
                            const bool add_to_output_vector = false);
 
+    /**
+     * Gather the properties of the locally owned particles in a contiguous
+     * array. The particles are traversed in the same order as by
+     * get_particle_positions(), and the n_properties_per_particle()
+     * properties of each particle are written to consecutive entries.
+     *
+     * Together with get_particle_positions() and the corresponding set
+     * functions, this allows applications to exchange the complete particle
+     * state with flat arrays in bulk, for example to advect the particles
+     * with an accelerator-resident kernel and only hand the result back for
+     * the sorting and parallel migration steps.
+     *
+     * @param [in,out] properties A vector preallocated at size
+     * `n_locally_owned_particles() * n_properties_per_particle()` that is
+     * filled with the properties of the locally owned particles.
+     */
+    void
+    get_particle_properties(std::vector<double> &properties) const;
+
+    /**
+     * Set the properties of the locally owned particles from a contiguous
+     * array, following the same ordering as get_particle_properties(). In
+     * contrast to set_particle_positions(), no sorting step is necessary
+     * because the properties do not influence which cell a particle belongs
+     * to.
+     *
+     * @param [in] new_properties A vector of size
+     * `n_locally_owned_particles() * n_properties_per_particle()` containing
+     * the new properties of the locally owned particles.
+     */
+    void
+    set_particle_properties(const std::vector<double> &new_properties);
+
     /**
      * This function allows to register three additional functions that are
      * called every time a particle is transferred to another process
@@ -719,7 +752,15 @@ namespace Particles
     /**
      * Exchange all particles that live in cells that are ghost cells to
      * other processes. Clears and re-populates the ghost_neighbors
-     * member variable.
+     * member variable. The underlying communication is a dynamic-sparse
+     * exchange built on Utilities::MPI::ConsensusAlgorithms::nbx(), i.e.,
+     * only processes between which particles actually flow exchange
+     * messages.
+     *
+     * If this function is called with @p enable_ghost_cache set to true,
+     * the communication pattern is cached, and subsequent calls to
+     * update_ghost_particles() reuse it without any rediscovery as long
+     * as no particle changes its cell.
      */
     void
     exchange_ghost_particles(const bool enable_ghost_cache = false);
@@ -1038,7 +1079,10 @@ namespace Particles
      * Transfer particles that have crossed subdomain boundaries to other
      * processors.
      * All received particles and their new cells will be appended to the
-     * class variable `particles` at the right slot.
+     * class variable `particles` at the right slot. The communication
+     * pattern is discovered dynamically through
+     * Utilities::MPI::ConsensusAlgorithms::nbx(), so only processes that
+     * actually exchange particles communicate.
      *
      * @param [in] particles_to_send All particles that should be sent and
      * their new subdomain_ids are in this map.
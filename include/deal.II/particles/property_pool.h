@@ -96,6 +96,20 @@ namespace Particles
    * course the PropertyType could contain a pointer to dynamically allocated
    * memory with varying sizes per particle (this memory would not be managed by
    * this class).
+   *
+   * By default, the properties of a particle are stored next to each other in
+   * memory (an "array of structs" order), which is the layout the
+   * get_properties() function with its contiguous per-particle ArrayView
+   * requires. Alternatively, the constructor allows switching to a "struct of
+   * arrays" order in which all values of one property are stored in one
+   * contiguous array each, so that a sweep over a single property of many
+   * particles streams through memory and vectorizes. In this mode, the values
+   * of a single particle are no longer adjacent in memory; properties are then
+   * accessed through get_property() and set_property() for individual values,
+   * or in bulk through get_property_array(). Note that the ParticleHandler and
+   * related classes access properties through get_properties() and therefore
+   * require the default storage order; the component-wise storage is intended
+   * for user codes that manage particle data through this class directly.
    */
   template <int dim, int spacedim = dim>
   class PropertyPool
@@ -114,9 +128,14 @@ namespace Particles
     static const Handle invalid_handle;
 
     /**
-     * Constructor. Stores the number of properties per reserved slot.
+     * Constructor. Stores the number of properties per reserved slot. If
+     * @p store_properties_per_component is set to true, the pool stores all
+     * values of one property in one contiguous array each instead of
+     * interleaving the properties of a particle, see the general
+     * documentation of this class.
      */
-    PropertyPool(const unsigned int n_properties_per_slot);
+    PropertyPool(const unsigned int n_properties_per_slot,
+                 const bool         store_properties_per_component = false);
 
     /**
      * Destructor. This function ensures that all memory that had
@@ -200,11 +219,55 @@ namespace Particles
 
     /**
      * Return an ArrayView to the properties that correspond to the given
-     * handle @p handle.
+     * handle @p handle. This function is only available if the pool stores
+     * the properties of a particle contiguously, i.e., in the default
+     * storage order.
      */
     ArrayView<double>
     get_properties(const Handle handle);
 
+    /**
+     * Return the value of the property with index @p property_index of the
+     * particle identified by the given `handle`. In contrast to
+     * get_properties(), this function is available in both storage orders.
+     */
+    double
+    get_property(const Handle handle, const unsigned int property_index) const;
+
+    /**
+     * Set the value of the property with index @p property_index of the
+     * particle identified by the given `handle`. In contrast to
+     * get_properties(), this function is available in both storage orders.
+     */
+    void
+    set_property(const Handle       handle,
+                 const unsigned int property_index,
+                 const double       value);
+
+    /**
+     * Return an ArrayView to all stored values of the property with index
+     * @p property_index, with one entry per slot of the pool, indexed by
+     * handles in the same way as the views returned by get_properties() are
+     * indexed by slots. This function is only available if the pool stores
+     * one contiguous array per property, i.e., if the constructor was called
+     * with `store_properties_per_component` set to true.
+     */
+    ArrayView<double>
+    get_property_array(const unsigned int property_index);
+
+    /**
+     * Same as above, but returning a read-only view.
+     */
+    ArrayView<const double>
+    get_property_array(const unsigned int property_index) const;
+
+    /**
+     * Return whether the pool stores one contiguous array per property
+     * rather than the properties of each particle next to each other.
+     */
+    bool
+    stores_properties_per_component() const;
+
     /**
      * Reserve the dynamic memory needed for storing the properties of
      * @p size particles.
@@ -248,6 +311,32 @@ namespace Particles
      */
     const unsigned int n_properties;
 
+    /**
+     * Whether the `properties` array stores one contiguous array per
+     * property instead of the properties of each particle next to each
+     * other.
+     */
+    const bool properties_per_component;
+
+    /**
+     * The distance in the `properties` array between the arrays of two
+     * consecutive properties if `properties_per_component` is true, i.e.,
+     * the number of slots the component arrays have been allocated for.
+     * Growing a component-wise stored pool slot by slot would require
+     * shifting all following component arrays, so the arrays are kept at a
+     * capacity that grows geometrically, of which only the first n_slots()
+     * entries are in use.
+     */
+    std::vector<double>::size_type property_stride;
+
+    /**
+     * Resize the component arrays of a component-wise stored pool to a
+     * capacity of @p new_stride slots, moving the existing values to their
+     * new positions.
+     */
+    void
+    resize_property_stride(const std::vector<double>::size_type new_stride);
+
     /**
      * A vector that stores the locations of particles. It is indexed in the
      * same way as the `reference_locations` and `properties` arrays, i.e., via
@@ -459,6 +548,13 @@ namespace Particles
   inline ArrayView<double>
   PropertyPool<dim, spacedim>::get_properties(const Handle handle)
   {
+    Assert(properties_per_component == false,
+           ExcMessage("This pool stores one contiguous array per property, "
+                      "so the properties of an individual particle are not "
+                      "adjacent in memory and no contiguous view of them can "
+                      "be returned. Use get_property() and set_property() or "
+                      "the bulk accessor get_property_array() instead."));
+
     const std::vector<double>::size_type data_index =
       (handle != invalid_handle) ? handle * n_properties : 0;
 
@@ -478,6 +574,103 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  inline double
+  PropertyPool<dim, spacedim>::get_property(
+    const Handle       handle,
+    const unsigned int property_index) const
+  {
+    AssertIndexRange(property_index, n_properties);
+
+    const std::vector<double>::size_type slot_index =
+      (handle != invalid_handle) ? handle : 0;
+
+    // As in the other accessors, only check against the array range and
+    // rely on the fact that handles are invalidated upon deallocation.
+    Assert(slot_index <= locations.size() - 1,
+           ExcMessage("Invalid property handle. This can happen if the "
+                      "handle was duplicated and then one copy was deallocated "
+                      "before trying to access the properties."));
+
+    return properties[properties_per_component ?
+                        property_index * property_stride + slot_index :
+                        slot_index * n_properties + property_index];
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline void
+  PropertyPool<dim, spacedim>::set_property(const Handle       handle,
+                                            const unsigned int property_index,
+                                            const double       value)
+  {
+    AssertIndexRange(property_index, n_properties);
+
+    const std::vector<double>::size_type slot_index =
+      (handle != invalid_handle) ? handle : 0;
+
+    // As in the other accessors, only check against the array range and
+    // rely on the fact that handles are invalidated upon deallocation.
+    Assert(slot_index <= locations.size() - 1,
+           ExcMessage("Invalid property handle. This can happen if the "
+                      "handle was duplicated and then one copy was deallocated "
+                      "before trying to access the properties."));
+
+    properties[properties_per_component ?
+                 property_index * property_stride + slot_index :
+                 slot_index * n_properties + property_index] = value;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<double>
+  PropertyPool<dim, spacedim>::get_property_array(
+    const unsigned int property_index)
+  {
+    Assert(properties_per_component == true,
+           ExcMessage("A contiguous view of all values of one property is "
+                      "only available if the pool has been constructed with "
+                      "one contiguous array per property, i.e., with "
+                      "store_properties_per_component set to true."));
+    AssertIndexRange(property_index, n_properties);
+
+    return ArrayView<double>(properties.data() +
+                               property_index * property_stride,
+                             locations.size());
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<const double>
+  PropertyPool<dim, spacedim>::get_property_array(
+    const unsigned int property_index) const
+  {
+    Assert(properties_per_component == true,
+           ExcMessage("A contiguous view of all values of one property is "
+                      "only available if the pool has been constructed with "
+                      "one contiguous array per property, i.e., with "
+                      "store_properties_per_component set to true."));
+    AssertIndexRange(property_index, n_properties);
+
+    return ArrayView<const double>(properties.data() +
+                                     property_index * property_stride,
+                                   locations.size());
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline bool
+  PropertyPool<dim, spacedim>::stores_properties_per_component() const
+  {
+    return properties_per_component;
+  }
+
+
+
   template <int dim, int spacedim>
   inline unsigned int
   PropertyPool<dim, spacedim>::n_slots() const
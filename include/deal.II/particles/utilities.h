@@ -25,12 +25,15 @@
 
 #include <deal.II/fe/component_mask.h>
 #include <deal.II/fe/fe.h>
+#include <deal.II/fe/mapping_q1.h>
 
 #include <deal.II/grid/grid_tools_cache.h>
 
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/sparsity_pattern_base.h>
 
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
 #include <deal.II/particles/particle_handler.h>
 
 
@@ -217,6 +220,56 @@ namespace Particles
 
       std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
 
+      // For scalar elements whose shape functions can be evaluated through
+      // the tensor-product kernels of FEPointEvaluation, evaluate the field
+      // for all particles of a cell in one sweep. This vectorizes the
+      // evaluation across the particle locations and avoids the repeated
+      // calls to FiniteElement::shape_value() of the generic path below.
+      // Since only values at reference locations are required, the choice of
+      // mapping is irrelevant and the cheap $Q_1$ mapping suffices.
+      if (fe.n_components() == 1 && n_comps == 1 &&
+          internal::FEPointEvaluation::is_fast_path_supported(fe, 0))
+        {
+          using Number = typename InputVectorType::value_type;
+          FEPointEvaluation<1, dim, spacedim, Number> evaluator(
+            StaticMappingQ1<dim, spacedim>::mapping, fe, update_values);
+
+          std::vector<Point<dim>>            unit_points;
+          std::vector<types::particle_index> particle_ids;
+          std::vector<Number> solution_values(fe.n_dofs_per_cell());
+
+          while (particle != particle_handler.end())
+            {
+              const auto &cell = particle->get_surrounding_cell();
+              const auto &dh_cell =
+                typename DoFHandler<dim, spacedim>::cell_iterator(*cell,
+                                                                  &field_dh);
+              dh_cell->get_dof_indices(dof_indices);
+              for (unsigned int j = 0; j < fe.n_dofs_per_cell(); ++j)
+                solution_values[j] = field_vector(dof_indices[j]);
+
+              const auto pic = particle_handler.particles_in_cell(cell);
+              Assert(pic.begin() == particle, ExcInternalError());
+
+              unit_points.clear();
+              particle_ids.clear();
+              for (; particle != pic.end(); ++particle)
+                {
+                  unit_points.push_back(particle->get_reference_location());
+                  particle_ids.push_back(particle->get_id());
+                }
+
+              evaluator.reinit(cell, unit_points);
+              evaluator.evaluate(make_array_view(solution_values),
+                                 EvaluationFlags::values);
+
+              for (unsigned int i = 0; i < unit_points.size(); ++i)
+                interpolated_field[particle_ids[i]] += evaluator.get_value(i);
+            }
+          interpolated_field.compress(VectorOperation::add);
+          return;
+        }
+
       while (particle != particle_handler.end())
         {
           const auto &cell = particle->get_surrounding_cell();
@@ -13,6 +13,7 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/data_out_base.h>
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi.h>
@@ -2399,8 +2400,10 @@ namespace DataOutBase
   }
 
 
-  Hdf5Flags::Hdf5Flags(const CompressionLevel compression_level)
+  Hdf5Flags::Hdf5Flags(const CompressionLevel compression_level,
+                       const unsigned int     n_ranks_per_writer)
     : compression_level(compression_level)
+    , n_ranks_per_writer(n_ranks_per_writer)
   {}
 
 
@@ -5245,9 +5248,17 @@ namespace DataOutBase
   }
 
 
+  /**
+   * Produce the data that write_vtu_main() would write for the given
+   * patches, as a sequence of strings (one per part of the piece, i.e., per
+   * XML tag, mesh array, or data array). Keeping the individual parts
+   * separate allows the caller to stream them into a file in chunks of
+   * bounded size rather than concatenating everything into one large buffer
+   * first, see DataOutInterface::write_vtu_in_parallel().
+   */
   template <int dim, int spacedim>
-  void
-  write_vtu_main(
+  std::vector<std::string>
+  vtu_stringize_piece(
     const std::vector<Patch<dim, spacedim>> &patches,
     const std::vector<std::string>          &data_names,
     const std::vector<
@@ -5255,12 +5266,10 @@ namespace DataOutBase
                  unsigned int,
                  std::string,
                  DataComponentInterpretation::DataComponentInterpretation>>
-                   &nonscalar_data_ranges,
-    const VtkFlags &flags,
-    std::ostream   &out)
+                         &nonscalar_data_ranges,
+    const VtkFlags       &flags,
+    const std::streamsize output_precision)
   {
-    AssertThrow(out.fail() == false, ExcIO());
-
     // If the user provided physical units, make sure that they don't contain
     // quote characters as this would make the VTU file invalid XML and
     // probably lead to all sorts of difficult error messages. Other than that,
@@ -5289,6 +5298,7 @@ namespace DataOutBase
         // we still need to output a valid vtu file, because other CPUs might
         // output data. This is the minimal file that is accepted by paraview
         // and visit. if we remove the field definitions, visit is complaining.
+        std::ostringstream out;
         out << "<Piece NumberOfPoints=\"0\" NumberOfCells=\"0\" >\n"
             << "<Cells>\n"
             << "<DataArray type=\"UInt8\" Name=\"types\"></DataArray>\n"
@@ -5332,18 +5342,21 @@ namespace DataOutBase
         out << "  </PointData>\n";
         out << "</Piece>\n";
 
-        out << std::flush;
-
-        return;
+        return {out.str()};
       }
 #endif
 
+    // The list of strings that will make up the piece, in the order in which
+    // they are to appear in the output file.
+    std::vector<std::string> pieces;
+
     // first up: metadata
     //
     // if desired, output time and cycle of the simulation, following the
     // instructions at
     // http://www.visitusers.org/index.php?title=Time_and_Cycle_in_VTK_files
     {
+      std::ostringstream out;
       const unsigned int n_metadata =
         ((flags.cycle != std::numeric_limits<unsigned int>::min() ? 1 : 0) +
          (flags.time != std::numeric_limits<double>::min() ? 1 : 0));
@@ -5365,6 +5378,9 @@ namespace DataOutBase
 
       if (n_metadata > 0)
         out << "</FieldData>\n";
+
+      if (n_metadata > 0)
+        pieces.push_back(out.str());
     }
 
 
@@ -5400,8 +5416,7 @@ namespace DataOutBase
     // first make up a list of used vertices along with their coordinates
     const auto stringize_vertex_information = [&patches,
                                                &flags,
-                                               output_precision =
-                                                 out.precision(),
+                                               output_precision,
                                                ascii_or_binary]() {
       std::ostringstream o;
       o << "  <Points>\n";
@@ -5439,8 +5454,7 @@ namespace DataOutBase
     const auto stringize_cell_to_vertex_information = [&patches,
                                                        &flags,
                                                        ascii_or_binary,
-                                                       output_precision =
-                                                         out.precision()]() {
+                                                       output_precision]() {
       std::ostringstream o;
 
       o << "  <Cells>\n";
@@ -5768,7 +5782,7 @@ namespace DataOutBase
        &flags,
        ascii_or_binary,
        n_cells,
-       output_precision = out.precision()]() {
+       output_precision]() {
         std::ostringstream o;
 
         o << "    <DataArray type=\"Int32\" Name=\"offsets\" format=\""
@@ -5841,7 +5855,7 @@ namespace DataOutBase
        ascii_or_binary,
        n_data_sets,
        n_nodes,
-       output_precision = out.precision()](const Table<2, float> &data_vectors,
+       output_precision](const Table<2, float> &data_vectors,
                                            const auto            &range) {
         std::ostringstream o;
 
@@ -5996,7 +6010,7 @@ namespace DataOutBase
       [&flags,
        &data_names,
        ascii_or_binary,
-       output_precision = out.precision()](const Table<2, float> &data_vectors,
+       output_precision](const Table<2, float> &data_vectors,
                                            const unsigned int     data_set) {
         std::ostringstream o;
 
@@ -6078,17 +6092,46 @@ namespace DataOutBase
           });
         }
 
-    // Alright, all tasks are now running. Wait for their conclusion and output
-    // all of the data they have produced:
-    out << "<Piece NumberOfPoints=\"" << n_nodes << "\" NumberOfCells=\""
-        << n_cells << "\" >\n";
-    for (const auto &s : mesh_tasks.return_values())
-      out << s;
-    out << "  <PointData Scalars=\"scalars\">\n";
-    for (const auto &s : data_tasks.return_values())
+    // Alright, all tasks are now running. Wait for their conclusion and
+    // collect all of the data they have produced:
+    {
+      std::ostringstream out;
+      out << "<Piece NumberOfPoints=\"" << n_nodes << "\" NumberOfCells=\""
+          << n_cells << "\" >\n";
+      pieces.push_back(out.str());
+    }
+    for (std::string &s : mesh_tasks.return_values())
+      pieces.push_back(std::move(s));
+    pieces.emplace_back("  <PointData Scalars=\"scalars\">\n");
+    for (std::string &s : data_tasks.return_values())
+      pieces.push_back(std::move(s));
+    pieces.emplace_back("  </PointData>\n");
+    pieces.emplace_back(" </Piece>\n");
+
+    return pieces;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  write_vtu_main(
+    const std::vector<Patch<dim, spacedim>> &patches,
+    const std::vector<std::string>          &data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+                   &nonscalar_data_ranges,
+    const VtkFlags &flags,
+    std::ostream   &out)
+  {
+    AssertThrow(out.fail() == false, ExcIO());
+
+    for (const std::string &s : vtu_stringize_piece(
+           patches, data_names, nonscalar_data_ranges, flags, out.precision()))
       out << s;
-    out << "  </PointData>\n";
-    out << " </Piece>\n";
 
     // make sure everything now gets to disk
     out.flush();
@@ -7772,18 +7815,23 @@ DataOutInterface<dim, spacedim>::write_vtu_in_parallel(
     // Do not write pieces with 0 cells as this will crash paraview if this is
     // the first piece written. But if nobody has any pieces to write (file is
     // empty), let processor 0 write their empty data, otherwise the vtk file is
-    // invalid.
-    std::stringstream ss;
+    // invalid. Get the piece as a sequence of strings rather than one
+    // monolithic buffer, so that we can bound the memory consumption of the
+    // writing process below.
+    std::vector<std::string> piece_parts;
     if (my_n_patches > 0 || (global_n_patches == 0 && myrank == 0))
-      DataOutBase::write_vtu_main(patches,
-                                  get_dataset_names(),
-                                  get_nonscalar_data_ranges(),
-                                  vtk_flags,
-                                  ss);
+      piece_parts =
+        DataOutBase::vtu_stringize_piece(patches,
+                                         get_dataset_names(),
+                                         get_nonscalar_data_ranges(),
+                                         vtk_flags,
+                                         std::ostringstream().precision());
 
     // Use prefix sum to find specific offset to write at.
-    const std::uint64_t size_on_proc = ss.str().size();
-    std::uint64_t       prefix_sum   = 0;
+    std::uint64_t size_on_proc = 0;
+    for (const std::string &part : piece_parts)
+      size_on_proc += part.size();
+    std::uint64_t prefix_sum = 0;
     ierr =
       MPI_Exscan(&size_on_proc, &prefix_sum, 1, MPI_UINT64_T, MPI_SUM, comm);
     AssertThrowMPI(ierr);
@@ -7791,14 +7839,56 @@ DataOutInterface<dim, spacedim>::write_vtu_in_parallel(
     // Locate specific offset for each processor.
     const MPI_Offset offset = static_cast<MPI_Offset>(header_size) + prefix_sum;
 
-    ierr = Utilities::MPI::LargeCount::File_write_at_all_c(fh,
-                                                           offset,
-                                                           ss.str().c_str(),
-                                                           ss.str().size(),
-                                                           MPI_CHAR,
-                                                           MPI_STATUS_IGNORE);
+    // Stream the parts of the piece into the file in chunks of bounded
+    // size, freeing the memory of each part as soon as it has been copied
+    // out, rather than concatenating everything into a second buffer of the
+    // size of the complete local output. As the collective write needs to
+    // be called the same number of times on every rank, agree on the number
+    // of rounds first; ranks that run out of data participate with writes
+    // of zero bytes.
+    constexpr std::uint64_t max_chunk_size = 1ULL << 26; // 64 MB
+    const std::uint64_t     n_local_writes =
+      (size_on_proc + max_chunk_size - 1) / max_chunk_size;
+    std::uint64_t n_writes = 0;
+    ierr =
+      MPI_Allreduce(&n_local_writes, &n_writes, 1, MPI_UINT64_T, MPI_MAX, comm);
     AssertThrowMPI(ierr);
 
+    std::string buffer;
+    std::size_t current_part     = 0;
+    std::size_t position_in_part = 0;
+    MPI_Offset  current_offset   = offset;
+    for (std::uint64_t round = 0; round < n_writes; ++round)
+      {
+        buffer.clear();
+        while (buffer.size() < max_chunk_size &&
+               current_part < piece_parts.size())
+          {
+            const std::string &part    = piece_parts[current_part];
+            const std::size_t  n_bytes = std::min<std::size_t>(
+              max_chunk_size - buffer.size(), part.size() - position_in_part);
+            buffer.append(part, position_in_part, n_bytes);
+            position_in_part += n_bytes;
+            if (position_in_part == part.size())
+              {
+                // this part is completely contained in chunks written out
+                // (or about to be written out), so release its memory
+                std::string().swap(piece_parts[current_part]);
+                ++current_part;
+                position_in_part = 0;
+              }
+          }
+
+        ierr = Utilities::MPI::LargeCount::File_write_at_all_c(fh,
+                                                               current_offset,
+                                                               buffer.data(),
+                                                               buffer.size(),
+                                                               MPI_CHAR,
+                                                               MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+        current_offset += buffer.size();
+      }
+
     if (myrank == n_ranks - 1)
       {
         // Locating Footer with offset on last rank.
@@ -8116,6 +8206,26 @@ DataOutInterface<dim, spacedim>::create_xdmf_entry(
 #endif
 }
 
+
+
+template <int dim, int spacedim>
+XDMFEntry
+DataOutInterface<dim, spacedim>::create_xdmf_entry(
+  const DataOutBase::DataOutFilter &data_filter,
+  const std::string                &h5_mesh_filename,
+  const std::string                &h5_solution_filename,
+  const std::string                &h5_solution_group,
+  const double                      cur_time,
+  const MPI_Comm                    comm) const
+{
+  XDMFEntry entry = create_xdmf_entry(
+    data_filter, h5_mesh_filename, h5_solution_filename, cur_time, comm);
+  entry.set_solution_group(h5_solution_group);
+  return entry;
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOutInterface<dim, spacedim>::write_xdmf_file(
@@ -8177,7 +8287,19 @@ namespace
 {
 #ifdef DEAL_II_WITH_HDF5
   /**
-   * Helper function to actually perform the HDF5 output.
+   * Helper function to actually perform the HDF5 output. The data to be
+   * written is passed in as flat arrays: the node coordinates in
+   * @p node_data_vec, the cell connectivity in terms of global node indices
+   * in @p cell_data_vec, and one array of values per output variable in
+   * @p data_set_arrays. The @p data_filter argument is only used to query the
+   * names and dimensions of the data sets; this allows callers to aggregate
+   * the data of several ranks before handing it to this function.
+   *
+   * If @p solution_group is not empty, the solution file is opened in
+   * read-write mode (and only created if it does not exist yet) and the
+   * data sets are placed in a newly created HDF5 group of that name instead
+   * of the root of the file. This allows appending the records of many time
+   * steps to a single file.
    */
   template <int dim, int spacedim>
   void
@@ -8187,7 +8309,12 @@ namespace
                 const bool                        write_mesh_file,
                 const std::string                &mesh_filename,
                 const std::string                &solution_filename,
-                const MPI_Comm                    comm)
+                const std::string                &solution_group,
+                const std::uint64_t               local_node_cell_count[2],
+                const std::vector<double>        &node_data_vec,
+                const std::vector<unsigned int>  &cell_data_vec,
+                const std::vector<ArrayView<const double>> &data_set_arrays,
+                const MPI_Comm                              comm)
   {
     hid_t h5_mesh_file_id = -1, h5_solution_file_id, file_plist_id, plist_id;
     hid_t node_dataspace, node_dataset, node_file_dataspace,
@@ -8196,16 +8323,8 @@ namespace
       cell_memory_dataspace;
     hid_t pt_data_dataspace, pt_data_dataset, pt_data_file_dataspace,
       pt_data_memory_dataspace;
-    herr_t              status;
-    std::uint64_t       local_node_cell_count[2];
-    hsize_t             count[2], offset[2], node_ds_dim[2], cell_ds_dim[2];
-    std::vector<double> node_data_vec;
-    std::vector<unsigned int> cell_data_vec;
-
-
-
-    local_node_cell_count[0] = data_filter.n_nodes();
-    local_node_cell_count[1] = data_filter.n_cells();
+    herr_t  status;
+    hsize_t count[2], offset[2], node_ds_dim[2], cell_ds_dim[2];
 
     // Create file access properties
     file_plist_id = H5Pcreate(H5P_FILE_ACCESS);
@@ -8368,7 +8487,6 @@ namespace
         AssertThrow(status >= 0, ExcIO());
 
         // And finally, write the node data
-        data_filter.fill_node_data(node_data_vec);
         status = H5Dwrite(node_dataset,
                           H5T_NATIVE_DOUBLE,
                           node_memory_dataspace,
@@ -8376,10 +8494,8 @@ namespace
                           plist_id,
                           node_data_vec.data());
         AssertThrow(status >= 0, ExcIO());
-        node_data_vec.clear();
 
         // And the cell data
-        data_filter.fill_cell_data(global_node_cell_offsets[0], cell_data_vec);
         status = H5Dwrite(cell_dataset,
                           H5T_NATIVE_UINT,
                           cell_memory_dataspace,
@@ -8387,7 +8503,6 @@ namespace
                           plist_id,
                           cell_data_vec.data());
         AssertThrow(status >= 0, ExcIO());
-        cell_data_vec.clear();
 
         // Close the file dataspaces
         status = H5Sclose(node_file_dataspace);
@@ -8420,7 +8535,7 @@ namespace
       {
         h5_solution_file_id = h5_mesh_file_id;
       }
-    else
+    else if (solution_group.empty())
       {
         // Otherwise we need to open a new file
         h5_solution_file_id = H5Fcreate(solution_filename.c_str(),
@@ -8429,6 +8544,50 @@ namespace
                                         file_plist_id);
         AssertThrow(h5_solution_file_id >= 0, ExcIO());
       }
+    else
+      {
+        // When appending a group to a time series file, reopen the file if it
+        // already exists and only create it otherwise. The failing open is
+        // expected in the latter case, so suppress the error output HDF5
+        // would produce for it.
+        H5E_BEGIN_TRY
+          {
+            h5_solution_file_id = H5Fopen(solution_filename.c_str(),
+                                          H5F_ACC_RDWR,
+                                          file_plist_id);
+          }
+        H5E_END_TRY
+        if (h5_solution_file_id < 0)
+          h5_solution_file_id = H5Fcreate(solution_filename.c_str(),
+                                          H5F_ACC_TRUNC,
+                                          H5P_DEFAULT,
+                                          file_plist_id);
+        AssertThrow(h5_solution_file_id >= 0, ExcIO());
+      }
+
+    // If requested, place the data sets in a group of the solution file
+    // rather than at its root
+    hid_t solution_loc_id = h5_solution_file_id;
+    if (!solution_group.empty())
+      {
+#  if H5Gcreate_vers == 1
+        solution_loc_id =
+          H5Gcreate(h5_solution_file_id, solution_group.c_str(), 0);
+#  else
+        solution_loc_id = H5Gcreate(h5_solution_file_id,
+                                    solution_group.c_str(),
+                                    H5P_DEFAULT,
+                                    H5P_DEFAULT,
+                                    H5P_DEFAULT);
+#  endif
+        AssertThrow(solution_loc_id >= 0,
+                    ExcMessage("Could not create the HDF5 group <" +
+                               solution_group + "> in file <" +
+                               solution_filename +
+                               ">. Note that appending to a time series "
+                               "requires a group name that does not yet "
+                               "exist in the file."));
+      }
 
     // when writing, first write out all vector data, then handle the scalar
     // data sets that have been left over
@@ -8448,7 +8607,7 @@ namespace
         AssertThrow(pt_data_dataspace >= 0, ExcIO());
 
 #  if H5Gcreate_vers == 1
-        pt_data_dataset = H5Dcreate(h5_solution_file_id,
+        pt_data_dataset = H5Dcreate(solution_loc_id,
                                     vector_name.c_str(),
                                     H5T_NATIVE_DOUBLE,
                                     pt_data_dataspace,
@@ -8460,7 +8619,7 @@ namespace
                        get_zlib_compression_level(flags.compression_level));
         H5Pset_chunk(node_dataset_id, 2, node_ds_dim);
 #    endif
-        pt_data_dataset = H5Dcreate(h5_solution_file_id,
+        pt_data_dataset = H5Dcreate(solution_loc_id,
                                     vector_name.c_str(),
                                     H5T_NATIVE_DOUBLE,
                                     pt_data_dataspace,
@@ -8496,7 +8655,7 @@ namespace
                           pt_data_memory_dataspace,
                           pt_data_file_dataspace,
                           plist_id,
-                          data_filter.get_data_set(i));
+                          data_set_arrays[i].data());
         AssertThrow(status >= 0, ExcIO());
 
         // Close the dataspaces
@@ -8511,6 +8670,13 @@ namespace
         AssertThrow(status >= 0, ExcIO());
       }
 
+    // Close the group if we created one
+    if (solution_loc_id != h5_solution_file_id)
+      {
+        status = H5Gclose(solution_loc_id);
+        AssertThrow(status >= 0, ExcIO());
+      }
+
     // Close the file property list
     status = H5Pclose(file_plist_id);
     AssertThrow(status >= 0, ExcIO());
@@ -8684,6 +8850,28 @@ DataOutInterface<dim, spacedim>::write_hdf5_parallel(
 
 
 
+template <int dim, int spacedim>
+void
+DataOutInterface<dim, spacedim>::write_hdf5_parallel(
+  const DataOutBase::DataOutFilter &data_filter,
+  const bool                        write_mesh_file,
+  const std::string                &mesh_filename,
+  const std::string                &solution_filename,
+  const std::string                &solution_group,
+  const MPI_Comm                    comm) const
+{
+  DataOutBase::write_hdf5_parallel(get_patches(),
+                                   data_filter,
+                                   hdf5_flags,
+                                   write_mesh_file,
+                                   mesh_filename,
+                                   solution_filename,
+                                   solution_group,
+                                   comm);
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOutBase::write_hdf5_parallel(
@@ -8709,6 +8897,30 @@ DataOutBase::write_hdf5_parallel(
   const std::string                       &mesh_filename,
   const std::string                       &solution_filename,
   const MPI_Comm                           comm)
+{
+  write_hdf5_parallel(patches,
+                      data_filter,
+                      flags,
+                      write_mesh_file,
+                      mesh_filename,
+                      solution_filename,
+                      "",
+                      comm);
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOutBase::write_hdf5_parallel(
+  const std::vector<Patch<dim, spacedim>> &patches,
+  const DataOutBase::DataOutFilter        &data_filter,
+  const DataOutBase::Hdf5Flags            &flags,
+  const bool                               write_mesh_file,
+  const std::string                       &mesh_filename,
+  const std::string                       &solution_filename,
+  const std::string                       &solution_group,
+  const MPI_Comm                           comm)
 {
   AssertThrow(
     spacedim >= 2,
@@ -8725,6 +8937,7 @@ DataOutBase::write_hdf5_parallel(
   (void)write_mesh_file;
   (void)mesh_filename;
   (void)solution_filename;
+  (void)solution_group;
   (void)comm;
   AssertThrow(false, ExcNeedsHDF5());
 #else
@@ -8765,13 +8978,185 @@ DataOutBase::write_hdf5_parallel(
 
   if (have_patches)
     {
-      do_write_hdf5<dim, spacedim>(patches,
-                                   data_filter,
-                                   flags,
-                                   write_mesh_file,
-                                   mesh_filename,
-                                   solution_filename,
-                                   split_comm);
+      // Prepare the flat arrays describing this rank's share of the output:
+      // the node coordinates, the cell connectivity, and one array of values
+      // per output variable. The connectivity references global node
+      // indices, so the node offset of this rank has to be computed on the
+      // full set of participating ranks before any aggregation of data takes
+      // place.
+      const std::uint64_t local_node_cell_count[2] = {data_filter.n_nodes(),
+                                                      data_filter.n_cells()};
+      std::uint64_t       global_node_offset       = 0;
+#  ifdef DEAL_II_WITH_MPI
+      {
+        const int ierr = MPI_Exscan(local_node_cell_count,
+                                    &global_node_offset,
+                                    1,
+                                    MPI_UINT64_T,
+                                    MPI_SUM,
+                                    split_comm);
+        AssertThrowMPI(ierr);
+      }
+#  endif
+
+      std::vector<double> node_data_vec;
+      data_filter.fill_node_data(node_data_vec);
+
+      std::vector<unsigned int> cell_data_vec;
+      data_filter.fill_cell_data(global_node_offset, cell_data_vec);
+
+      std::vector<ArrayView<const double>> data_set_arrays(
+        data_filter.n_data_sets());
+      for (unsigned int i = 0; i < data_set_arrays.size(); ++i)
+        data_set_arrays[i] =
+          ArrayView<const double>(data_filter.get_data_set(i),
+                                  local_node_cell_count[0] *
+                                    data_filter.get_data_set_dim(i));
+
+      const unsigned int n_split_ranks =
+        Utilities::MPI::n_mpi_processes(split_comm);
+      const unsigned int group_size =
+        std::min(std::max(flags.n_ranks_per_writer, 1u), n_split_ranks);
+
+      if (group_size == 1)
+        {
+          // Every rank writes its own data:
+          do_write_hdf5<dim, spacedim>(patches,
+                                       data_filter,
+                                       flags,
+                                       write_mesh_file,
+                                       mesh_filename,
+                                       solution_filename,
+                                       solution_group,
+                                       local_node_cell_count,
+                                       node_data_vec,
+                                       cell_data_vec,
+                                       data_set_arrays,
+                                       split_comm);
+        }
+#  ifdef DEAL_II_WITH_MPI
+      else
+        {
+          // Two-level aggregation: gather the arrays of every group of
+          // group_size consecutive ranks on the first rank of the group, and
+          // let only these writer ranks participate in the collective HDF5
+          // file accesses. This takes metadata contention off the file
+          // system when running with very large numbers of ranks.
+          const unsigned int my_rank =
+            Utilities::MPI::this_mpi_process(split_comm);
+          const bool is_writer = (my_rank % group_size == 0);
+
+          MPI_Comm group_comm;
+          int      ierr = MPI_Comm_split(split_comm,
+                                    my_rank / group_size,
+                                    my_rank,
+                                    &group_comm);
+          AssertThrowMPI(ierr);
+
+          // Gather a variable-size array of doubles or unsigned ints on the
+          // first rank of group_comm, concatenated in rank order:
+          const auto gather_to_writer = [&group_comm](const auto &send_buffer,
+                                                      auto       &recv_buffer,
+                                                      const MPI_Datatype type) {
+            const unsigned int n_group_ranks =
+              Utilities::MPI::n_mpi_processes(group_comm);
+
+            AssertThrow(send_buffer.size() <
+                          static_cast<std::size_t>(
+                            std::numeric_limits<int>::max()),
+                        ExcMessage("The amount of data to be gathered on a "
+                                   "writer rank exceeds the maximum message "
+                                   "size supported by MPI. Use a smaller "
+                                   "value for Hdf5Flags::n_ranks_per_writer."));
+            const int send_count = send_buffer.size();
+
+            std::vector<int> counts(n_group_ranks);
+            int              ierr = MPI_Gather(
+              &send_count, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, group_comm);
+            AssertThrowMPI(ierr);
+
+            std::vector<int> displacements(n_group_ranks + 1, 0);
+            for (unsigned int i = 0; i < n_group_ranks; ++i)
+              {
+                AssertThrow(static_cast<std::int64_t>(displacements[i]) +
+                                counts[i] <
+                              std::numeric_limits<int>::max(),
+                            ExcMessage(
+                              "The amount of data to be gathered on a "
+                              "writer rank exceeds the maximum message "
+                              "size supported by MPI. Use a smaller "
+                              "value for Hdf5Flags::n_ranks_per_writer."));
+                displacements[i + 1] = displacements[i] + counts[i];
+              }
+
+            if (Utilities::MPI::this_mpi_process(group_comm) == 0)
+              recv_buffer.resize(displacements.back());
+            ierr = MPI_Gatherv(send_buffer.data(),
+                               send_count,
+                               type,
+                               recv_buffer.data(),
+                               counts.data(),
+                               displacements.data(),
+                               type,
+                               0,
+                               group_comm);
+            AssertThrowMPI(ierr);
+          };
+
+          std::vector<double> gathered_node_data;
+          gather_to_writer(node_data_vec, gathered_node_data, MPI_DOUBLE);
+
+          std::vector<unsigned int> gathered_cell_data;
+          gather_to_writer(cell_data_vec, gathered_cell_data, MPI_UNSIGNED);
+
+          std::vector<std::vector<double>> gathered_data_sets(
+            data_set_arrays.size());
+          for (unsigned int i = 0; i < data_set_arrays.size(); ++i)
+            gather_to_writer(data_set_arrays[i],
+                             gathered_data_sets[i],
+                             MPI_DOUBLE);
+
+          std::uint64_t group_node_cell_count[2] = {0, 0};
+          ierr                                   = MPI_Reduce(
+            local_node_cell_count, group_node_cell_count, 2, MPI_UINT64_T, MPI_SUM, 0, group_comm);
+          AssertThrowMPI(ierr);
+
+          ierr = MPI_Comm_free(&group_comm);
+          AssertThrowMPI(ierr);
+
+          MPI_Comm writer_comm;
+          ierr = MPI_Comm_split(split_comm,
+                                is_writer ? 0 : MPI_UNDEFINED,
+                                my_rank,
+                                &writer_comm);
+          AssertThrowMPI(ierr);
+
+          if (is_writer)
+            {
+              std::vector<ArrayView<const double>> gathered_views(
+                gathered_data_sets.size());
+              for (unsigned int i = 0; i < gathered_data_sets.size(); ++i)
+                gathered_views[i] =
+                  ArrayView<const double>(gathered_data_sets[i]);
+
+              do_write_hdf5<dim, spacedim>(patches,
+                                           data_filter,
+                                           flags,
+                                           write_mesh_file,
+                                           mesh_filename,
+                                           solution_filename,
+                                           solution_group,
+                                           group_node_cell_count,
+                                           gathered_node_data,
+                                           gathered_cell_data,
+                                           gathered_views,
+                                           writer_comm);
+
+              ierr = MPI_Comm_free(&writer_comm);
+              AssertThrowMPI(ierr);
+            }
+        }
+#  endif
     }
 
   const int ierr = MPI_Comm_free(&split_comm);
@@ -9534,6 +9919,19 @@ XDMFEntry::add_attribute(const std::string &attr_name,
 
 
 
+void
+XDMFEntry::set_solution_group(const std::string &group_name)
+{
+  // normalize to an absolute HDF5 path so that the generated data item
+  // references are valid regardless of how the caller spelled the name
+  if (!group_name.empty() && group_name[0] != '/')
+    h5_sol_group = '/' + group_name;
+  else
+    h5_sol_group = group_name;
+}
+
+
+
 namespace
 {
   /**
@@ -9665,8 +10063,8 @@ XDMFEntry::get_xdmf_content(const unsigned int indent_level) const
       ss << indent(indent_level + 2) << "<DataItem Dimensions=\"" << num_nodes
          << " " << (attribute_dim.second > 1 ? 3 : 1)
          << "\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">\n";
-      ss << indent(indent_level + 3) << h5_sol_filename << ":/"
-         << attribute_dim.first << '\n';
+      ss << indent(indent_level + 3) << h5_sol_filename << ':' << h5_sol_group
+         << '/' << attribute_dim.first << '\n';
       ss << indent(indent_level + 2) << "</DataItem>\n";
       ss << indent(indent_level + 1) << "</Attribute>\n";
     }
@@ -106,6 +106,23 @@ FunctionParser<dim>::value(const Point<dim>  &p,
   return this->do_value(p, this->get_time(), component);
 }
 
+
+
+template <int dim>
+void
+FunctionParser<dim>::value_list(const std::vector<Point<dim>> &points,
+                                std::vector<double>           &values,
+                                const unsigned int             component) const
+{
+  Assert(values.size() == points.size(),
+         ExcDimensionMismatch(values.size(), points.size()));
+  AssertIndexRange(component, this->n_components);
+
+  const ArrayView<const Point<dim>> points_view(points);
+  ArrayView<double>                 values_view(values);
+  this->do_value_list(points_view, this->get_time(), component, values_view);
+}
+
 // Explicit Instantiations.
 
 template class FunctionParser<1>;
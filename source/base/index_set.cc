@@ -869,6 +869,69 @@ IndexSet::index_within_set_binary_search(const size_type n) const
 
 
 
+void
+IndexSet::index_within_set(const ArrayView<const size_type> &global_indices,
+                           const ArrayView<size_type>       &local_indices) const
+{
+  // to make this call thread-safe, compress() must not be called through this
+  // function
+  Assert(is_compressed == true, ExcMessage("IndexSet must be compressed."));
+  AssertDimension(global_indices.size(), local_indices.size());
+
+  if (is_empty())
+    {
+      std::fill(local_indices.begin(),
+                local_indices.end(),
+                numbers::invalid_dof_index);
+      return;
+    }
+
+  // Keep a hint to the range the previous query fell into: callers typically
+  // translate sorted or locally clustered indices, in which case checking
+  // the hinted range first avoids the binary search over all ranges.
+  const std::vector<Range>::const_iterator main_range =
+    ranges.begin() + largest_range;
+  std::vector<Range>::const_iterator hint = main_range;
+
+  for (std::size_t i = 0; i < global_indices.size(); ++i)
+    {
+      const size_type n = global_indices[i];
+      AssertIndexRange(n, size());
+
+      if (n >= hint->begin && n < hint->end)
+        {
+          local_indices[i] = (n - hint->begin) + hint->nth_index_in_set;
+          continue;
+        }
+
+      // as in the single-index variant, check the largest range before
+      // resorting to the binary search
+      if (n >= main_range->begin && n < main_range->end)
+        {
+          local_indices[i] = (n - main_range->begin) +
+                             main_range->nth_index_in_set;
+          continue;
+        }
+
+      const Range                              r(n, n);
+      const std::vector<Range>::const_iterator p =
+        Utilities::lower_bound(ranges.begin(),
+                               ranges.end(),
+                               r,
+                               Range::end_compare);
+
+      if (p == ranges.end() || p->end == n || p->begin > n)
+        local_indices[i] = numbers::invalid_dof_index;
+      else
+        {
+          local_indices[i] = (n - p->begin) + p->nth_index_in_set;
+          hint             = p;
+        }
+    }
+}
+
+
+
 IndexSet::ElementIterator
 IndexSet::at(const size_type global_index) const
 {
@@ -27,6 +27,7 @@
 
 #include <boost/serialization/utility.hpp>
 
+#include <array>
 #include <iostream>
 #include <limits>
 #include <numeric>
@@ -87,6 +88,36 @@ namespace Utilities
 
 
 
+    void
+    print_memory_stats(const MPI_Comm mpi_communicator, std::ostream &out)
+    {
+      Utilities::System::MemoryStats stats;
+      Utilities::System::get_memory_stats(stats);
+
+      // aggregate all four fields with a single reduction sweep
+      const std::vector<double> my_values = {
+        static_cast<double>(stats.VmPeak),
+        static_cast<double>(stats.VmSize),
+        static_cast<double>(stats.VmHWM),
+        static_cast<double>(stats.VmRSS)};
+
+      const std::vector<MinMaxAvg> results =
+        min_max_avg(my_values, mpi_communicator);
+
+      if (this_mpi_process(mpi_communicator) == 0)
+        {
+          const std::array<const char *, 4> names = {
+            {"VmPeak", "VmSize", "VmHWM", "VmRSS"}};
+
+          for (unsigned int i = 0; i < names.size(); ++i)
+            out << names[i] << " [kB]: min=" << results[i].min
+                << " avg=" << results[i].avg << " max=" << results[i].max
+                << std::endl;
+        }
+    }
+
+
+
 #ifdef DEAL_II_WITH_MPI
     unsigned int
     n_mpi_processes(const MPI_Comm mpi_communicator)
@@ -487,7 +487,18 @@ namespace Utilities
               {
                 const unsigned int actual_owner =
                   dict.actually_owning_ranks[i - dict.local_range.first];
-                request_buffer.push_back(actual_owner);
+
+                // compress the answer into (owner, run length) pairs, given
+                // that long runs of consecutive indices are usually owned by
+                // the same rank; read_answer() expands the runs again
+                if (request_buffer.size() >= 2 &&
+                    request_buffer[request_buffer.size() - 2] == actual_owner)
+                  ++request_buffer.back();
+                else
+                  {
+                    request_buffer.push_back(actual_owner);
+                    request_buffer.push_back(1);
+                  }
 
                 if (track_index_requests)
                   append_index_origin(i - dict.local_range.first,
@@ -566,9 +577,23 @@ namespace Utilities
         {
           const auto &recv_indices =
             indices_to_look_up_by_dict_rank[other_rank].second;
-          AssertDimension(recv_indices.size(), recv_buffer.size());
-          for (unsigned int j = 0; j < recv_indices.size(); ++j)
-            owning_ranks[recv_indices[j]] = recv_buffer[j];
+
+          // expand the (owner, run length) pairs generated by
+          // answer_request(); the runs appear in the order of the (sorted)
+          // requested indices
+          Assert(recv_buffer.size() % 2 == 0, ExcInternalError());
+          unsigned int j = 0;
+          for (unsigned int i = 0; i < recv_buffer.size(); i += 2)
+            {
+              const unsigned int owner = recv_buffer[i];
+              for (unsigned int count = 0; count < recv_buffer[i + 1];
+                   ++count, ++j)
+                {
+                  AssertIndexRange(j, recv_indices.size());
+                  owning_ranks[recv_indices[j]] = owner;
+                }
+            }
+          AssertDimension(j, recv_indices.size());
         }
 
 
@@ -132,6 +132,74 @@ namespace Utilities
 
 
 
+    template <int dim, int spacedim>
+    void
+    RemotePointEvaluation<dim, spacedim>::update(
+      const std::vector<Point<spacedim>> &points)
+    {
+#ifndef DEAL_II_WITH_MPI
+      Assert(false, ExcNeedsMPI());
+      (void)points;
+#else
+      Assert(tria != nullptr && mapping != nullptr,
+             ExcMessage("reinit() has to be called before update()."));
+
+      // If the triangulation has changed since the last search or if not all
+      // points had been found (so that a point re-entering the domain could
+      // not be detected locally), the cached cell assignments cannot be
+      // revalidated: perform a full search instead.
+      if (this->is_ready() == false || all_points_found_flag == false)
+        {
+          this->reinit(points, *tria, *mapping);
+          return;
+        }
+
+      AssertDimension(points.size(), point_ptrs.size() - 1);
+
+      // Communicate the new coordinates to the processes owning the cells
+      // determined by the previous search and invert the mapping there. A
+      // point is lost if the inversion fails (the mapping marks such points
+      // with infinite coordinates) or if the resulting reference coordinates
+      // are outside the unit cell up to the tolerance also used during
+      // reinit().
+      unsigned int            n_lost_points = 0;
+      std::vector<Point<dim>> unit_points;
+
+      this->template process_and_evaluate<Point<spacedim>>(
+        points,
+        [&](const ArrayView<const Point<spacedim>> &real_points,
+            const CellData                         &cell_data) {
+          for (const auto cell : cell_data.cell_indices())
+            {
+              const auto cell_iterator =
+                cell_data.get_active_cell_iterator(cell);
+
+              const auto cell_real_points =
+                cell_data.get_data_view(cell, real_points);
+
+              unit_points.resize(cell_real_points.size());
+              mapping->transform_points_real_to_unit_cell(
+                cell_iterator, cell_real_points, make_array_view(unit_points));
+
+              for (unsigned int i = 0; i < unit_points.size(); ++i)
+                if (cell_iterator->reference_cell().contains_point(
+                      unit_points[i], additional_data.tolerance))
+                  this->cell_data->reference_point_values
+                    [cell_data.reference_point_ptrs[cell] + i] = unit_points[i];
+                else
+                  ++n_lost_points;
+            }
+        });
+
+      // If any point on any process has left its cell, the communication
+      // pattern is out of date and needs to be rebuilt by a full search.
+      if (Utilities::MPI::sum(n_lost_points, tria->get_communicator()) > 0)
+        this->reinit(points, *tria, *mapping);
+#endif
+    }
+
+
+
     template <int dim, int spacedim>
     void
     RemotePointEvaluation<dim, spacedim>::reinit(
@@ -454,6 +454,60 @@ namespace internal
       return std::numeric_limits<double>::signaling_NaN();
     }
 
+    template <int dim, typename Number>
+    void
+    ParserImplementation<dim, Number>::do_value_list(
+      const ArrayView<const Point<dim>> &points,
+      const double                       time,
+      const unsigned int                 component,
+      ArrayView<Number>                 &values) const
+    {
+#ifdef DEAL_II_WITH_MUPARSER
+      Assert(this->initialized == true, ExcNotInitialized());
+      AssertDimension(points.size(), values.size());
+
+      // initialize the parser if that hasn't happened yet on the current
+      // thread, and look up the thread-local data only once for the whole
+      // batch of points: the lookup requires synchronization with other
+      // threads and would otherwise be paid for every single point
+      internal::FunctionParser::ParserData &data = this->parser_data.get();
+      if (data.vars.empty())
+        init_muparser();
+
+      if (dim != this->n_vars)
+        data.vars[dim] = time;
+
+      try
+        {
+          Assert(dynamic_cast<Parser *>(data.parsers[component].get()),
+                 ExcInternalError());
+          // NOLINTNEXTLINE don't warn about using static_cast once we check
+          mu::Parser &parser = static_cast<Parser &>(*data.parsers[component]);
+          for (std::size_t k = 0; k < points.size(); ++k)
+            {
+              for (unsigned int i = 0; i < dim; ++i)
+                data.vars[i] = points[k][i];
+              values[k] = parser.Eval();
+            }
+        } // try
+      catch (mu::ParserError &e)
+        {
+          std::cerr << "Message:  <" << e.GetMsg() << ">\n";
+          std::cerr << "Formula:  <" << e.GetExpr() << ">\n";
+          std::cerr << "Token:    <" << e.GetToken() << ">\n";
+          std::cerr << "Position: <" << e.GetPos() << ">\n";
+          std::cerr << "Errc:     <" << e.GetCode() << ">" << std::endl;
+          AssertThrow(false, ExcParseError(e.GetCode(), e.GetMsg()));
+        } // catch
+#else
+      (void)points;
+      (void)time;
+      (void)component;
+      (void)values;
+      AssertThrow(false, ExcNeedsFunctionparser());
+#endif
+    }
+
     template <int dim, typename Number>
     void
     ParserImplementation<dim, Number>::do_all_values(
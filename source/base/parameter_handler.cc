@@ -21,6 +21,8 @@
 
 #define BOOST_BIND_GLOBAL_PLACEHOLDERS
 #include <boost/algorithm/string.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/io/ios_state.hpp>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -831,6 +833,35 @@ ParameterHandler::parse_input_from_json(std::istream &in,
 
 
 
+void
+ParameterHandler::save(const std::string &filename) const
+{
+  // Create a binary boost archive and call the templated version of the
+  // save function. In contrast to the text-based input files, the binary
+  // representation can be read back without parsing or pattern matching,
+  // which is what makes the save()/load() pair useful as a cache for
+  // repeated runs with identical parameter files.
+  std::ofstream ofs(filename, std::ios::binary);
+  AssertThrow(ofs.fail() == false, ExcIO());
+  boost::archive::binary_oarchive oa(ofs);
+  save(oa, 0);
+}
+
+
+
+void
+ParameterHandler::load(const std::string &filename)
+{
+  // Create a binary boost archive and call the templated version of the
+  // load function.
+  std::ifstream ifs(filename, std::ios::binary);
+  AssertThrow(ifs.fail() == false, ExcIO());
+  boost::archive::binary_iarchive ia(ifs);
+  load(ia, 0);
+}
+
+
+
 void
 ParameterHandler::clear()
 {
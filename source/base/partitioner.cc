@@ -511,8 +511,9 @@ namespace Utilities
       memory += MemoryConsumption::memory_consumption(ghost_targets_data);
       memory += MemoryConsumption::memory_consumption(import_indices_data);
       memory += sizeof(import_indices_plain_dev) +
-                sizeof(*import_indices_plain_dev.begin()) *
-                  import_indices_plain_dev.capacity();
+                sizeof(unsigned int) * import_indices_plain_dev.size();
+      memory += MemoryConsumption::memory_consumption(
+        import_indices_plain_chunks_by_rank);
       memory += MemoryConsumption::memory_consumption(n_import_indices_data);
       memory += MemoryConsumption::memory_consumption(import_targets_data);
       memory += MemoryConsumption::memory_consumption(
@@ -536,33 +537,39 @@ namespace Utilities
     Partitioner::initialize_import_indices_plain_dev() const
     {
       const unsigned int n_import_targets = import_targets_data.size();
-      import_indices_plain_dev.reserve(n_import_targets);
+
+      // Expand the indices on the host, concatenated over all ranks we
+      // import from, and keep track of where the part of each rank starts
+      std::vector<unsigned int> import_indices_plain_host;
+      import_indices_plain_host.reserve(n_import_indices());
+      import_indices_plain_chunks_by_rank.resize(n_import_targets + 1);
+      import_indices_plain_chunks_by_rank[0] = 0;
       for (unsigned int i = 0; i < n_import_targets; ++i)
         {
-          // Expand the indices on the host
           std::vector<std::pair<unsigned int, unsigned int>>::const_iterator
             my_imports = import_indices_data.begin() +
                          import_indices_chunks_by_rank_data[i],
             end_my_imports = import_indices_data.begin() +
                              import_indices_chunks_by_rank_data[i + 1];
-          std::vector<unsigned int> import_indices_plain_host;
           for (; my_imports != end_my_imports; ++my_imports)
-            {
-              const unsigned int chunk_size =
-                my_imports->second - my_imports->first;
-              for (unsigned int j = 0; j < chunk_size; ++j)
-                import_indices_plain_host.push_back(my_imports->first + j);
-            }
+            for (unsigned int j = my_imports->first; j < my_imports->second;
+                 ++j)
+              import_indices_plain_host.push_back(j);
 
-          // Move the indices to the device
-          const auto chunk_size = import_indices_plain_host.size();
-          import_indices_plain_dev.emplace_back("import_indices_plain_dev" +
-                                                  std::to_string(i),
-                                                chunk_size);
-          Kokkos::deep_copy(import_indices_plain_dev.back(),
-                            Kokkos::View<unsigned int *, Kokkos::HostSpace>(
-                              import_indices_plain_host.data(), chunk_size));
+          import_indices_plain_chunks_by_rank[i + 1] =
+            import_indices_plain_host.size();
         }
+
+      // Move the indices to the device in a single copy
+      const auto n_indices = import_indices_plain_host.size();
+      import_indices_plain_dev =
+        Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>(
+          Kokkos::view_alloc("import_indices_plain_dev",
+                             Kokkos::WithoutInitializing),
+          n_indices);
+      Kokkos::deep_copy(import_indices_plain_dev,
+                        Kokkos::View<unsigned int *, Kokkos::HostSpace>(
+                          import_indices_plain_host.data(), n_indices));
     }
 
   } // namespace MPI
@@ -574,4 +581,19 @@ namespace Utilities
 // explicit instantiations from .templates.h file
 #include "partitioner.inst"
 
+#ifdef DEAL_II_WITH_MPI
+// reduced-precision ghost exchange: double data sent as float payload
+template void
+Utilities::MPI::Partitioner::export_to_ghosted_array_start<double, float>(
+  const unsigned int,
+  const ArrayView<const double> &,
+  const ArrayView<float> &,
+  const ArrayView<double> &,
+  std::vector<MPI_Request> &) const;
+template void
+Utilities::MPI::Partitioner::export_to_ghosted_array_finish<double, float>(
+  const ArrayView<double> &,
+  std::vector<MPI_Request> &) const;
+#endif
+
 DEAL_II_NAMESPACE_CLOSE
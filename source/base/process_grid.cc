@@ -18,6 +18,10 @@
 
 #  include <deal.II/lac/scalapack.templates.h>
 
+#  include <map>
+#  include <mutex>
+#  include <tuple>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace
@@ -93,6 +97,24 @@ namespace
     // Pc = 0.5 * Pr  => 8x2 grid
     // Pc = 2.0 * Pr  => 3x5 grid
   }
+
+
+
+  /**
+   * Registry of the process grids handed out by
+   * ProcessGrid::get_shared_process_grid(), keyed by communicator and grid
+   * dimensions. Only weak references are kept so that grids (and their
+   * BLACS contexts) are released once the last user lets go of them;
+   * expired entries are cleaned up on the next query.
+   */
+  std::map<std::tuple<MPI_Comm, unsigned int, unsigned int>,
+           std::weak_ptr<const dealii::Utilities::MPI::ProcessGrid>>
+    shared_process_grids;
+
+  /**
+   * Mutex guarding access to the registry above.
+   */
+  std::mutex shared_process_grids_mutex;
 } // namespace
 
 namespace Utilities
@@ -228,6 +250,60 @@ namespace Utilities
 
 
 
+    std::shared_ptr<const ProcessGrid>
+    ProcessGrid::get_shared_process_grid(const MPI_Comm     mpi_communicator,
+                                         const unsigned int n_rows,
+                                         const unsigned int n_columns)
+    {
+      const std::lock_guard<std::mutex> lock(shared_process_grids_mutex);
+
+      const auto key = std::make_tuple(mpi_communicator, n_rows, n_columns);
+
+      // Drop registry entries whose grids have been destroyed in the
+      // meantime. Since grids are released collectively, all processes of
+      // the communicator see the same set of expired entries.
+      for (auto it = shared_process_grids.begin();
+           it != shared_process_grids.end();)
+        if (it->second.expired())
+          it = shared_process_grids.erase(it);
+        else
+          ++it;
+
+      const auto cached = shared_process_grids.find(key);
+      if (cached != shared_process_grids.end())
+        return cached->second.lock();
+
+      std::shared_ptr<const ProcessGrid> grid(
+        new ProcessGrid(mpi_communicator, n_rows, n_columns));
+      shared_process_grids[key] = grid;
+      return grid;
+    }
+
+
+
+    std::shared_ptr<const ProcessGrid>
+    ProcessGrid::get_shared_process_grid(const MPI_Comm     mpi_communicator,
+                                         const unsigned int n_rows_matrix,
+                                         const unsigned int n_columns_matrix,
+                                         const unsigned int row_block_size,
+                                         const unsigned int column_block_size)
+    {
+      // Determine the grid dimensions first so that matrices of different
+      // sizes which map to the same grid shape share a single BLACS
+      // context:
+      const std::pair<int, int> grid_dimensions =
+        compute_processor_grid_sizes(mpi_communicator,
+                                     n_rows_matrix,
+                                     n_columns_matrix,
+                                     row_block_size,
+                                     column_block_size);
+      return get_shared_process_grid(mpi_communicator,
+                                     grid_dimensions.first,
+                                     grid_dimensions.second);
+    }
+
+
+
     ProcessGrid::~ProcessGrid()
     {
       if (mpi_process_is_active)
@@ -28,11 +28,29 @@
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <mutex>
+#include <unordered_map>
 
 
 DEAL_II_NAMESPACE_OPEN
 
 
+namespace
+{
+  // The type of the process-wide caches for the points and weights of the
+  // one-dimensional quadrature formulas whose construction involves an
+  // expensive iterative computation of polynomial roots. Code that builds
+  // hp::QCollection or hp::FECollection objects constructs the same
+  // formulas over and over again, so the points and weights are computed
+  // only on the first request for a given number of points and copied out
+  // of the cache on subsequent requests, protected by a mutex to allow for
+  // concurrent construction from several threads.
+  using QuadratureCache =
+    std::unordered_map<unsigned int,
+                       std::pair<std::vector<Point<1>>, std::vector<double>>>;
+} // namespace
+
+
 // please note: for a given dimension, we need the quadrature formulae
 // for all lower dimensions as well. That is why in this file the check
 // is for deal_II_dimension >= any_number and not for ==
@@ -72,6 +90,18 @@ QGauss<1>::QGauss(const unsigned int n)
   if (n == 0)
     return;
 
+  static QuadratureCache cache;
+  static std::mutex      mutex;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  const auto it = cache.find(n);
+  if (it != cache.end())
+    {
+      this->quadrature_points = it->second.first;
+      this->weights           = it->second.second;
+      return;
+    }
+
   std::vector<long double> points =
     Polynomials::jacobi_polynomial_roots<long double>(n, 0, 0);
 
@@ -89,6 +119,8 @@ QGauss<1>::QGauss(const unsigned int n)
       this->weights[i]         = w;
       this->weights[n - i - 1] = w;
     }
+
+  cache.emplace(n, std::make_pair(this->quadrature_points, this->weights));
 }
 
 namespace internal
@@ -382,6 +414,18 @@ QGaussLobatto<1>::QGaussLobatto(const unsigned int n)
 {
   Assert(n >= 2, ExcNotImplemented());
 
+  static QuadratureCache cache;
+  static std::mutex      mutex;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  const auto it = cache.find(n);
+  if (it != cache.end())
+    {
+      this->quadrature_points = it->second.first;
+      this->weights           = it->second.second;
+      return;
+    }
+
   std::vector<long double> points =
     Polynomials::jacobi_polynomial_roots<long double>(n - 2, 1, 1);
   points.insert(points.begin(), 0);
@@ -395,6 +439,8 @@ QGaussLobatto<1>::QGaussLobatto(const unsigned int n)
       this->quadrature_points[i][0] = points[i];
       this->weights[i]              = 0.5 * w[i];
     }
+
+  cache.emplace(n, std::make_pair(this->quadrature_points, this->weights));
 }
 #endif
 
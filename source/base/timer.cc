@@ -434,11 +434,45 @@ TimerOutput::enter_subsection(const std::string &section_name)
   sections[section_name].timer.start();
   ++sections[section_name].n_calls;
 
+  if (trace_events_are_enabled)
+    sections[section_name].trace_start = std::chrono::steady_clock::now();
+
   active_sections.push_back(section_name);
 }
 
 
 
+void
+TimerOutput::add_section_time(const std::string &section_name,
+                              const double       wall_time,
+                              const unsigned int n_calls)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Assert(section_name.empty() == false, ExcMessage("Section string is empty."));
+
+  Assert(std::find(active_sections.begin(),
+                   active_sections.end(),
+                   section_name) == active_sections.end(),
+         ExcMessage(std::string("Cannot add time to the active section <") +
+                    section_name + ">."));
+
+  if (sections.find(section_name) == sections.end())
+    {
+      if (mpi_communicator != MPI_COMM_SELF)
+        sections[section_name].timer = Timer(mpi_communicator, true);
+
+      sections[section_name].total_cpu_time  = 0;
+      sections[section_name].total_wall_time = 0;
+      sections[section_name].n_calls         = 0;
+    }
+
+  sections[section_name].total_wall_time += wall_time;
+  sections[section_name].n_calls += n_calls;
+}
+
+
+
 void
 TimerOutput::leave_subsection(const std::string &section_name)
 {
@@ -473,6 +507,22 @@ TimerOutput::leave_subsection(const std::string &section_name)
   const double cpu_time = sections[actual_section_name].timer.last_cpu_time();
   sections[actual_section_name].total_cpu_time += cpu_time;
 
+  // record a trace event if requested. use the time stamps of
+  // std::chrono::steady_clock directly rather than the wall time measured by
+  // the Timer object, because all events need to refer to a common origin for
+  // the timeline written by write_trace() to make sense.
+  if (trace_events_are_enabled)
+    {
+      const std::chrono::time_point<std::chrono::steady_clock> now =
+        std::chrono::steady_clock::now();
+      const std::chrono::time_point<std::chrono::steady_clock> start =
+        sections[actual_section_name].trace_start;
+      trace_events.push_back(
+        {actual_section_name,
+         std::chrono::duration<double>(start - trace_reference_time).count(),
+         std::chrono::duration<double>(now - start).count()});
+    }
+
   // in case we have to print out something, do that here...
   if ((output_frequency == every_call ||
        output_frequency == every_call_and_summary) &&
@@ -1014,6 +1064,174 @@ TimerOutput::print_wall_time_statistics(const MPI_Comm mpi_comm,
 
 
 
+void
+TimerOutput::print_wall_time_histograms(const MPI_Comm     mpi_comm,
+                                        const unsigned int n_bins) const
+{
+  // we are going to change the precision and width of output below. store the
+  // old values so the get restored when exiting this function
+  const boost::io::ios_base_all_saver restore_stream(out_stream.get_stream());
+
+  AssertDimension(sections.size(),
+                  Utilities::MPI::max(sections.size(), mpi_comm));
+  Assert(n_bins > 0, ExcMessage("The histogram needs at least one bin."));
+
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  // get the maximum width among all sections
+  unsigned int max_width = 0;
+  for (const auto &i : sections)
+    max_width = std::max(max_width, static_cast<unsigned int>(i.first.size()));
+
+  // 17 is the default width until | character
+  max_width = std::max(max_width + 1, static_cast<unsigned int>(17));
+  const std::string extra_space = std::string(max_width - 17, ' ');
+
+  // each bin column needs to be able to hold the total number of ranks
+  const unsigned int bin_width = std::max(
+    static_cast<unsigned int>(std::to_string(n_ranks).size()) + 1, 6U);
+
+  // function to print the histogram of one quantity: compute the minimum and
+  // maximum over all ranks, sort the local value into one of the n_bins
+  // equally wide bins in between, and accumulate the per-bin rank counts
+  const auto print_histogram = [&](const double given_time) {
+    const Utilities::MPI::MinMaxAvg data =
+      Utilities::MPI::min_max_avg(given_time, mpi_comm);
+
+    std::vector<unsigned int> histogram(n_bins, 0);
+    unsigned int              my_bin = 0;
+    if (data.max > data.min)
+      my_bin = std::min(n_bins - 1,
+                        static_cast<unsigned int>((given_time - data.min) /
+                                                  (data.max - data.min) *
+                                                  n_bins));
+    histogram[my_bin] = 1;
+    Utilities::MPI::sum(histogram, mpi_comm, histogram);
+
+    out_stream << std::setw(10) << std::setprecision(4) << std::right;
+    out_stream << data.min << "s |";
+    for (const unsigned int count : histogram)
+      out_stream << std::setw(bin_width) << std::right << count;
+    out_stream << " |";
+    out_stream << std::setw(10) << std::setprecision(4) << std::right;
+    out_stream << data.max << "s |\n";
+  };
+
+  const std::string extra_dash = std::string(max_width - 17, '-');
+  const std::string bin_dash(n_bins * bin_width + 1, '-');
+  const std::string bin_space(n_bins * bin_width + 1, ' ');
+
+  // label of the histogram column, cut or padded to the column width
+  std::string bin_label =
+    " ranks per bin, " + std::to_string(n_bins) + " bins from min to max";
+  bin_label.resize(bin_space.size(), ' ');
+
+  // now generate a nice table
+  out_stream << '\n'
+             << "+------------------------------" << extra_dash << "+"
+             << "------------+" << bin_dash << "+------------+" << '\n'
+             << "| Total wallclock time elapsed " << extra_space << "|";
+
+  print_histogram(timer_all.wall_time());
+
+  out_stream << "|                              " << extra_space << "|"
+             << "            |" << bin_space << "|            |" << '\n';
+  out_stream << "| Section          " << extra_space << "| no. calls "
+             << "|   min time |" << bin_label << "|   max time |\n";
+  out_stream << "+------------------------------" << extra_dash << "+"
+             << "------------+" << bin_dash << "+------------+" << '\n';
+  for (const auto &i : sections)
+    {
+      std::string name_out = i.first;
+
+      // resize the array so that it is always of the same size
+      unsigned int pos_non_space = name_out.find_first_not_of(' ');
+      name_out.erase(0, pos_non_space);
+      name_out.resize(max_width, ' ');
+      out_stream << "| " << name_out;
+      out_stream << "| ";
+      out_stream << std::setw(9);
+      out_stream << i.second.n_calls << " |";
+
+      print_histogram(i.second.total_wall_time);
+    }
+  out_stream << "+------------------------------" << extra_dash << "+"
+             << "------------+" << bin_dash << "+------------+" << '\n';
+}
+
+
+
+void
+TimerOutput::enable_trace_events()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // give sections that are currently active a valid start time so that the
+  // event recorded when they are left refers to a meaningful interval
+  const std::chrono::time_point<std::chrono::steady_clock> now =
+    std::chrono::steady_clock::now();
+  for (const std::string &section_name : active_sections)
+    sections[section_name].trace_start = now;
+
+  trace_events_are_enabled = true;
+}
+
+
+
+void
+TimerOutput::disable_trace_events()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  trace_events_are_enabled = false;
+}
+
+
+
+void
+TimerOutput::write_trace(std::ostream &out) const
+{
+  const unsigned int my_rank =
+    Utilities::MPI::this_mpi_process(mpi_communicator);
+
+  // escape the characters that may not appear verbatim in a JSON string;
+  // section names are unlikely to contain any of them, but better be safe
+  const auto escape = [](const std::string &name) {
+    std::string escaped;
+    escaped.reserve(name.size());
+    for (const char c : name)
+      {
+        if (c == '"' || c == '\\')
+          escaped += '\\';
+        escaped += c;
+      }
+    return escaped;
+  };
+
+  // write the events in the JSON trace event format, with time stamps and
+  // durations expressed in microseconds as the format prescribes. the
+  // viewers derive the nesting of sections from the containment of the
+  // recorded time intervals, so no explicit hierarchy needs to be stored.
+  const boost::io::ios_base_all_saver restore_stream(out);
+  out << "{\"traceEvents\":[";
+  bool first_event = true;
+  for (const TraceEvent &event : trace_events)
+    {
+      if (first_event == false)
+        out << ',';
+      first_event = false;
+      out << "\n{\"name\":\"" << escape(event.name)
+          << "\",\"cat\":\"section\",\"ph\":\"X\",\"ts\":" << std::fixed
+          << std::setprecision(3) << 1e6 * event.start
+          << ",\"dur\":" << 1e6 * event.duration << ",\"pid\":" << my_rank
+          << ",\"tid\":0}";
+    }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  AssertThrow(out.fail() == false, ExcIO());
+}
+
+
+
 void
 TimerOutput::disable_output()
 {
@@ -1036,6 +1254,8 @@ TimerOutput::reset()
   std::lock_guard<std::mutex> lock(mutex);
   sections.clear();
   active_sections.clear();
+  trace_events.clear();
+  trace_reference_time = std::chrono::steady_clock::now();
   timer_all.restart();
 }
 
@@ -516,6 +516,32 @@ namespace Differentiation
 
 
 
+    template <enum AD::NumberTypes ADNumberTypeCode, typename ScalarType>
+    typename Types<
+      typename HelperBase<ADNumberTypeCode, ScalarType>::ad_type>::tape_index
+    HelperBase<ADNumberTypeCode, ScalarType>::get_tape_index_for_category(
+      const unsigned int category)
+    {
+      const auto it = category_to_tape_index.find(category);
+      if (it != category_to_tape_index.end())
+        return it->second;
+
+      // allocate the next unused index; since entries are never removed
+      // from the map, its size identifies the next free index
+      const auto new_tape_index =
+        static_cast<typename Types<ad_type>::tape_index>(
+          Numbers<ad_type>::invalid_tape_index + 1 +
+          category_to_tape_index.size());
+      Assert(new_tape_index < Numbers<ad_type>::max_tape_index,
+             ExcMessage("The number of cell categories exceeds the number of "
+                        "tapes that can be allocated."));
+
+      category_to_tape_index[category] = new_tape_index;
+      return new_tape_index;
+    }
+
+
+
     template <enum AD::NumberTypes ADNumberTypeCode, typename ScalarType>
     void
     HelperBase<ADNumberTypeCode, ScalarType>::activate_tape(
@@ -22,6 +22,7 @@
 #  include <boost/archive/text_iarchive.hpp>
 #  include <boost/archive/text_oarchive.hpp>
 
+#  include <fstream>
 #  include <utility>
 
 DEAL_II_NAMESPACE_OPEN
@@ -826,6 +827,72 @@ namespace Differentiation
         }
     }
 
+
+
+    template <typename ReturnType>
+    std::size_t
+    BatchOptimizer<ReturnType>::state_hash() const
+    {
+      std::size_t seed = 0;
+
+      const auto hash_combine = [&seed](const std::size_t hash) {
+        seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      };
+
+      hash_combine(static_cast<std::size_t>(method));
+      hash_combine(static_cast<std::size_t>(flags));
+
+      // use the structural hashes that SymEngine computes for its
+      // expression trees; the map and vector orderings are deterministic,
+      // so the combined hash is reproducible for a given setup
+      for (const auto &entry : independent_variables_symbols)
+        hash_combine(entry.first.get_RCP()->hash());
+      for (const auto &func : dependent_variables_functions)
+        hash_combine(func.get_RCP()->hash());
+
+      return seed;
+    }
+
+
+
+    template <typename ReturnType>
+    void
+    BatchOptimizer<ReturnType>::save_state(const std::string &filename) const
+    {
+      std::ofstream stream(filename);
+      AssertThrow(stream.fail() == false, ExcIO());
+
+      boost::archive::text_oarchive archive(stream);
+      archive << *this;
+
+      AssertThrow(stream.fail() == false, ExcIO());
+    }
+
+
+
+    template <typename ReturnType>
+    bool
+    BatchOptimizer<ReturnType>::load_state(const std::string &filename)
+    {
+      std::ifstream stream(filename);
+      if (stream.fail() == true)
+        return false;
+
+      // discard everything registered so far, so that the deserialization
+      // proceeds as for a newly constructed object
+      independent_variables_symbols.clear();
+      dependent_variables_functions.clear();
+      dependent_variables_output.clear();
+      map_dep_expr_vec_entry.clear();
+      ready_for_value_extraction = false;
+      optimizer.reset();
+
+      boost::archive::text_iarchive archive(stream);
+      archive >> *this;
+
+      return true;
+    }
+
   } // namespace SD
 } // namespace Differentiation
 
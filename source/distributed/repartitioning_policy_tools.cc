@@ -22,6 +22,8 @@
 #include <deal.II/grid/cell_id_translator.h>
 #include <deal.II/grid/filtered_iterator.h>
 
+#include <limits>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -258,6 +260,203 @@ namespace RepartitioningPolicyTools
 
 
 
+  template <int dim, int spacedim>
+  RecursiveBisectionPolicy<dim, spacedim>::RecursiveBisectionPolicy()
+    : weighting_function()
+  {}
+
+
+
+  template <int dim, int spacedim>
+  RecursiveBisectionPolicy<dim, spacedim>::RecursiveBisectionPolicy(
+    const std::function<
+      unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                   const CellStatus)> &weighting_function)
+    : weighting_function(weighting_function)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  LinearAlgebra::distributed::Vector<double>
+  RecursiveBisectionPolicy<dim, spacedim>::partition(
+    const Triangulation<dim, spacedim> &tria_in) const
+  {
+#ifndef DEAL_II_WITH_MPI
+    (void)tria_in;
+    return {};
+#else
+
+    const auto tria =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &tria_in);
+
+    Assert(tria, ExcNotImplemented());
+
+    const auto partitioner =
+      tria->global_active_cell_index_partitioner().lock();
+
+    const auto         comm         = tria_in.get_communicator();
+    const unsigned int n_subdomains = Utilities::MPI::n_mpi_processes(comm);
+
+    const unsigned int n_local_cells = partitioner->locally_owned_size();
+
+    // collect centers and weights of the locally owned cells
+    std::vector<Point<spacedim>> centers(n_local_cells);
+    std::vector<double>          weights(n_local_cells, 1.0);
+    for (const auto &cell :
+         tria->active_cell_iterators() | IteratorFilters::LocallyOwnedCell())
+      {
+        const unsigned int i =
+          partitioner->global_to_local(cell->global_active_cell_index());
+        centers[i] = cell->center();
+        if (weighting_function)
+          weights[i] = weighting_function(cell, CellStatus::cell_will_persist);
+      }
+
+    // the nodes of the current level of the bisection tree, described by the
+    // half-open range of ranks their cells will be distributed onto; every
+    // cell belongs to exactly one node. All processes traverse the tree
+    // level by level together, so the number of global reductions is
+    // logarithmic in the number of processes.
+    std::vector<std::pair<unsigned int, unsigned int>> nodes(
+      1, std::make_pair(0u, n_subdomains));
+    std::vector<unsigned int> cell_node(n_local_cells, 0);
+
+    for (unsigned int level = 0;; ++level)
+      {
+        const unsigned int n_nodes = nodes.size();
+
+        bool any_node_active = false;
+        for (const auto &node : nodes)
+          if (node.second - node.first > 1)
+            any_node_active = true;
+        if (any_node_active == false)
+          break;
+
+        // bounding boxes of the cell centers of each node; the minima are
+        // stored negated so that a single max reduction covers both
+        std::vector<double> bounds(n_nodes * 2 * spacedim,
+                                   -std::numeric_limits<double>::max());
+        for (unsigned int i = 0; i < n_local_cells; ++i)
+          {
+            double *node_bounds = bounds.data() + cell_node[i] * 2 * spacedim;
+            for (unsigned int d = 0; d < spacedim; ++d)
+              {
+                node_bounds[d] = std::max(node_bounds[d], -centers[i][d]);
+                node_bounds[spacedim + d] =
+                  std::max(node_bounds[spacedim + d], centers[i][d]);
+              }
+          }
+        Utilities::MPI::max(bounds, comm, bounds);
+
+        // each node is cut along the axis with the largest extent of its
+        // bounding box; use fewer histogram bins on the finer levels of the
+        // tree to keep the reduction volume bounded
+        const unsigned int n_bins = std::max<unsigned int>(32, 4096 >> level);
+
+        std::vector<unsigned int> node_axis(n_nodes, 0);
+        std::vector<double>       node_min(n_nodes, 0.);
+        std::vector<double>       node_extent(n_nodes, 0.);
+        for (unsigned int n = 0; n < n_nodes; ++n)
+          {
+            const double *node_bounds = bounds.data() + n * 2 * spacedim;
+            for (unsigned int d = 1; d < spacedim; ++d)
+              if (node_bounds[spacedim + d] + node_bounds[d] >
+                  node_bounds[spacedim + node_axis[n]] +
+                    node_bounds[node_axis[n]])
+                node_axis[n] = d;
+            node_min[n]    = -node_bounds[node_axis[n]];
+            node_extent[n] = node_bounds[spacedim + node_axis[n]] +
+                             node_bounds[node_axis[n]];
+          }
+
+        const auto bin_of_cell = [&](const unsigned int i) -> unsigned int {
+          const unsigned int n = cell_node[i];
+          if (node_extent[n] > 0)
+            return std::min<unsigned int>(
+              n_bins - 1,
+              static_cast<unsigned int>((centers[i][node_axis[n]] -
+                                         node_min[n]) /
+                                        node_extent[n] * n_bins));
+          else
+            // all centers of the node coincide: spread the cells over the
+            // bins by their index so that the weight can still be split
+            return partitioner->local_to_global(i) % n_bins;
+        };
+
+        // accumulate the weight histogram of each node
+        std::vector<double> histogram(n_nodes * n_bins, 0.);
+        for (unsigned int i = 0; i < n_local_cells; ++i)
+          histogram[cell_node[i] * n_bins + bin_of_cell(i)] += weights[i];
+        Utilities::MPI::sum(histogram, comm, histogram);
+
+        // split every active node such that the weights of the two children
+        // are proportional to the numbers of ranks assigned to them
+        std::vector<std::pair<unsigned int, unsigned int>> next_nodes;
+        std::vector<unsigned int>                          first_child(n_nodes);
+        std::vector<unsigned int> cut_bin(n_nodes, 0);
+        for (unsigned int n = 0; n < n_nodes; ++n)
+          {
+            first_child[n] = next_nodes.size();
+
+            const unsigned int n_ranks = nodes[n].second - nodes[n].first;
+            if (n_ranks == 1)
+              {
+                next_nodes.push_back(nodes[n]);
+                continue;
+              }
+
+            const double *node_histogram = histogram.data() + n * n_bins;
+            double        total_weight   = 0;
+            for (unsigned int b = 0; b < n_bins; ++b)
+              total_weight += node_histogram[b];
+
+            const unsigned int n_ranks_left = n_ranks / 2;
+            const double       target_weight =
+              total_weight * n_ranks_left / n_ranks;
+
+            double       cumulative_weight = 0;
+            unsigned int cut               = 1;
+            for (; cut < n_bins; ++cut)
+              {
+                cumulative_weight += node_histogram[cut - 1];
+                if (cumulative_weight >= target_weight)
+                  break;
+              }
+            cut_bin[n] = std::min(cut, n_bins - 1);
+
+            next_nodes.emplace_back(nodes[n].first,
+                                    nodes[n].first + n_ranks_left);
+            next_nodes.emplace_back(nodes[n].first + n_ranks_left,
+                                    nodes[n].second);
+          }
+
+        // move the cells to the child nodes
+        for (unsigned int i = 0; i < n_local_cells; ++i)
+          {
+            const unsigned int n = cell_node[i];
+            if (nodes[n].second - nodes[n].first == 1)
+              cell_node[i] = first_child[n];
+            else
+              cell_node[i] =
+                first_child[n] + (bin_of_cell(i) < cut_bin[n] ? 0 : 1);
+          }
+
+        nodes.swap(next_nodes);
+      }
+
+    // every node now corresponds to a single rank
+    LinearAlgebra::distributed::Vector<double> partition(partitioner);
+    for (unsigned int i = 0; i < n_local_cells; ++i)
+      partition.local_element(i) = nodes[cell_node[i]].first;
+
+    return partition;
+#endif
+  }
+
+
+
   template <int dim, int spacedim>
   CellWeightPolicy<dim, spacedim>::CellWeightPolicy(
     const std::function<
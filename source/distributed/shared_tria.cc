@@ -184,10 +184,15 @@ namespace parallel
             active_halo_layer_vector =
               dealii::GridTools::compute_active_cell_halo_layer(*this,
                                                                 predicate);
-          std::set<typename parallel::shared::Triangulation<dim, spacedim>::
-                     active_cell_iterator>
-            active_halo_layer(active_halo_layer_vector.begin(),
-                              active_halo_layer_vector.end());
+
+          // Record which cells are part of the halo layer in a flag vector
+          // indexed by active cell index. This is called after every
+          // refinement step, so avoid the per-cell cost of looking cells up
+          // in a std::set of iterators.
+          std::vector<bool> in_active_halo_layer(this->n_active_cells(),
+                                                 false);
+          for (const auto &halo_cell : active_halo_layer_vector)
+            in_active_halo_layer[halo_cell->active_cell_index()] = true;
 
           for (unsigned int index = 0; cell != endc; cell++, index++)
             {
@@ -195,7 +200,7 @@ namespace parallel
               true_subdomain_ids_of_cells[index] = cell->subdomain_id();
 
               if (cell->is_locally_owned() == false &&
-                  active_halo_layer.find(cell) == active_halo_layer.end())
+                  in_active_halo_layer[index] == false)
                 cell->set_subdomain_id(numbers::artificial_subdomain_id);
             }
 
@@ -219,10 +224,14 @@ namespace parallel
                     level_halo_layer_vector =
                       dealii::GridTools::compute_cell_halo_layer_on_level(
                         *this, predicate, lvl);
-                  std::set<typename parallel::shared::
-                             Triangulation<dim, spacedim>::cell_iterator>
-                    level_halo_layer(level_halo_layer_vector.begin(),
-                                     level_halo_layer_vector.end());
+
+                  // As for the active halo layer above, use a flag vector
+                  // (indexed by the index of a cell within its level) instead
+                  // of a std::set of iterators for the membership tests below.
+                  std::vector<bool> in_level_halo_layer(this->n_raw_cells(lvl),
+                                                        false);
+                  for (const auto &halo_cell : level_halo_layer_vector)
+                    in_level_halo_layer[halo_cell->index()] = true;
 
                   typename parallel::shared::Triangulation<dim, spacedim>::
                     cell_iterator cell = this->begin(lvl),
@@ -266,7 +275,7 @@ namespace parallel
                       // we must have knowledge of our neighbors on the same
                       // level
                       if (!cell->is_locally_owned_on_level() &&
-                          level_halo_layer.find(cell) != level_halo_layer.end())
+                          in_level_halo_layer[cell->index()] == true)
                         continue;
 
                       // mark all other cells to artificial
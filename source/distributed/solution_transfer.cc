@@ -35,6 +35,7 @@
 #  include <deal.II/lac/trilinos_vector.h>
 #  include <deal.II/lac/vector.h>
 
+#  include <cstring>
 #  include <functional>
 #  include <numeric>
 
@@ -42,71 +43,6 @@
 DEAL_II_NAMESPACE_OPEN
 
 
-namespace
-{
-  /**
-   * Optimized pack function for values assigned on degrees of freedom.
-   *
-   * Given that the elements of @p dof_values are stored in consecutive
-   * locations, we can just memcpy them. Since floating point values don't
-   * compress well, we also waive the compression that the default
-   * Utilities::pack() and Utilities::unpack() functions offer.
-   */
-  template <typename value_type>
-  std::vector<char>
-  pack_dof_values(std::vector<Vector<value_type>> &dof_values,
-                  const unsigned int               dofs_per_cell)
-  {
-    for (const auto &values : dof_values)
-      {
-        AssertDimension(values.size(), dofs_per_cell);
-        (void)values;
-      }
-
-    const std::size_t bytes_per_entry = sizeof(value_type) * dofs_per_cell;
-
-    std::vector<char> buffer(dof_values.size() * bytes_per_entry);
-    for (unsigned int i = 0; i < dof_values.size(); ++i)
-      std::memcpy(&buffer[i * bytes_per_entry],
-                  &dof_values[i](0),
-                  bytes_per_entry);
-
-    return buffer;
-  }
-
-
-
-  /**
-   * Optimized unpack function for values assigned on degrees of freedom.
-   */
-  template <typename value_type>
-  std::vector<Vector<value_type>>
-  unpack_dof_values(
-    const boost::iterator_range<std::vector<char>::const_iterator> &data_range,
-    const unsigned int dofs_per_cell)
-  {
-    const std::size_t  bytes_per_entry = sizeof(value_type) * dofs_per_cell;
-    const unsigned int n_elements      = data_range.size() / bytes_per_entry;
-
-    Assert((data_range.size() % bytes_per_entry == 0), ExcInternalError());
-
-    std::vector<Vector<value_type>> unpacked_data;
-    unpacked_data.reserve(n_elements);
-    for (unsigned int i = 0; i < n_elements; ++i)
-      {
-        Vector<value_type> dof_values(dofs_per_cell);
-        std::memcpy(&dof_values(0),
-                    &(*std::next(data_range.begin(), i * bytes_per_entry)),
-                    bytes_per_entry);
-        unpacked_data.emplace_back(std::move(dof_values));
-      }
-
-    return unpacked_data;
-  }
-} // namespace
-
-
-
 namespace parallel
 {
   namespace distributed
@@ -314,10 +250,6 @@ namespace parallel
       typename DoFHandler<dim, spacedim>::cell_iterator cell(*cell_,
                                                              dof_handler);
 
-      // create buffer for each individual object
-      std::vector<::dealii::Vector<typename VectorType::value_type>> dof_values(
-        input_vectors.size());
-
       unsigned int fe_index = 0;
       if (dof_handler->has_hp_capabilities())
         {
@@ -359,16 +291,29 @@ namespace parallel
       if (dofs_per_cell == 0)
         return std::vector<char>(); // nothing to do for FE_Nothing
 
-      auto it_input  = input_vectors.cbegin();
-      auto it_output = dof_values.begin();
-      for (; it_input != input_vectors.cend(); ++it_input, ++it_output)
+      // Read the DoF values of one vector at a time into the scratch
+      // object and copy them straight into the buffer that the
+      // triangulation's data transfer machinery will ship around. The
+      // values are stored in consecutive locations, so we can just
+      // memcpy them; since floating point values don't compress well,
+      // we also waive the compression that Utilities::pack() and
+      // Utilities::unpack() offer.
+      const std::size_t bytes_per_entry =
+        sizeof(typename VectorType::value_type) * dofs_per_cell;
+      std::vector<char> buffer(input_vectors.size() * bytes_per_entry);
+
+      for (unsigned int i = 0; i < input_vectors.size(); ++i)
         {
-          it_output->reinit(dofs_per_cell);
-          cell->get_interpolated_dof_values(*(*it_input), *it_output, fe_index);
+          cell_dof_values.reinit(dofs_per_cell);
+          cell->get_interpolated_dof_values(*input_vectors[i],
+                                            cell_dof_values,
+                                            fe_index);
+          std::memcpy(&buffer[i * bytes_per_entry],
+                      &cell_dof_values(0),
+                      bytes_per_entry);
         }
 
-      return pack_dof_values<typename VectorType::value_type>(dof_values,
-                                                              dofs_per_cell);
+      return buffer;
     }
 
 
@@ -427,38 +372,40 @@ namespace parallel
       if (dofs_per_cell == 0)
         return; // nothing to do for FE_Nothing
 
-      const std::vector<::dealii::Vector<typename VectorType::value_type>>
-        dof_values =
-          unpack_dof_values<typename VectorType::value_type>(data_range,
-                                                             dofs_per_cell);
+      // check if we have enough dofs provided by the FE object
+      // to interpolate the transferred data correctly
+      const std::size_t bytes_per_entry =
+        sizeof(typename VectorType::value_type) * dofs_per_cell;
+      Assert(
+        data_range.size() % bytes_per_entry == 0,
+        ExcMessage(
+          "The transferred data was packed with a different number of dofs than the "
+          "currently registered FE object assigned to the DoFHandler has."));
 
       // check if sizes match
-      Assert(dof_values.size() == all_out.size(), ExcInternalError());
+      Assert(data_range.size() / bytes_per_entry == all_out.size(),
+             ExcInternalError());
 
-      // check if we have enough dofs provided by the FE object
-      // to interpolate the transferred data correctly
-      for (auto it_dof_values = dof_values.begin();
-           it_dof_values != dof_values.end();
-           ++it_dof_values)
-        Assert(
-          dofs_per_cell == it_dof_values->size(),
-          ExcMessage(
-            "The transferred data was packed with a different number of dofs than the "
-            "currently registered FE object assigned to the DoFHandler has."));
-
-      // distribute data for each registered vector on mesh
-      auto it_input  = dof_values.cbegin();
-      auto it_output = all_out.begin();
-      for (; it_input != dof_values.cend(); ++it_input, ++it_output)
-        if (average_values)
-          cell->distribute_local_to_global_by_interpolation(*it_input,
-                                                            *(*it_output),
-                                                            fe_index);
-        else
-          cell->set_dof_values_by_interpolation(*it_input,
-                                                *(*it_output),
-                                                fe_index,
-                                                true);
+      // distribute data for each registered vector on mesh, copying the
+      // values for one vector at a time out of the packed data range into
+      // the scratch object
+      for (unsigned int i = 0; i < all_out.size(); ++i)
+        {
+          cell_dof_values.reinit(dofs_per_cell);
+          std::memcpy(&cell_dof_values(0),
+                      &(*std::next(data_range.begin(), i * bytes_per_entry)),
+                      bytes_per_entry);
+
+          if (average_values)
+            cell->distribute_local_to_global_by_interpolation(cell_dof_values,
+                                                              *all_out[i],
+                                                              fe_index);
+          else
+            cell->set_dof_values_by_interpolation(cell_dof_values,
+                                                  *all_out[i],
+                                                  fe_index,
+                                                  true);
+        }
 
       if (average_values)
         {
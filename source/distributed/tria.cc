@@ -1845,6 +1845,7 @@ namespace parallel
     void Triangulation<dim, spacedim>::clear()
     {
       triangulation_has_content = false;
+      local_forest_snapshot     = LocalForestSnapshot();
 
       if (parallel_ghost != nullptr)
         {
@@ -2084,6 +2085,151 @@ namespace parallel
 
 
 
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    Threads::Task<void> Triangulation<dim, spacedim>::save_async(
+      const std::string &filename) const
+    {
+      Assert(
+        this->cell_attached_data.n_attached_deserialize == 0,
+        ExcMessage(
+          "Not all SolutionTransfer objects have been deserialized after the last call to load()."));
+      Assert(this->n_cells() > 0,
+             ExcMessage("Can not save() an empty Triangulation."));
+
+      // the background task communicates concurrently with whatever the
+      // ongoing computation does, which is only safe with full MPI thread
+      // support
+      int mpi_thread_support = 0;
+      int ierr               = MPI_Query_thread(&mpi_thread_support);
+      AssertThrowMPI(ierr);
+      AssertThrow(
+        mpi_thread_support == MPI_THREAD_MULTIPLE,
+        ExcMessage(
+          "Asynchronous checkpointing requires that MPI has been initialized "
+          "with MPI_THREAD_MULTIPLE thread support. Either initialize MPI "
+          "accordingly, or use the synchronous save() function."));
+
+      const int myrank =
+        Utilities::MPI::this_mpi_process(this->mpi_communicator);
+
+      // signal that serialization is going to happen
+      this->signals.pre_distributed_save();
+
+      if (this->my_subdomain == 0)
+        {
+          std::string   fname = std::string(filename) + ".info";
+          std::ofstream f(fname);
+          f << "version nproc n_attached_fixed_size_objs n_attached_variable_size_objs n_coarse_cells"
+            << std::endl
+            << 5 << " "
+            << Utilities::MPI::n_mpi_processes(this->mpi_communicator) << " "
+            << this->cell_attached_data.pack_callbacks_fixed.size() << " "
+            << this->cell_attached_data.pack_callbacks_variable.size() << " "
+            << this->n_cells(0) << std::endl;
+        }
+
+      // each cell should have been flagged `CellStatus::cell_will_persist`
+      for (const auto &cell_rel : this->local_cell_relations)
+        {
+          (void)cell_rel;
+          Assert((cell_rel.second == // cell_status
+                  CellStatus::cell_will_persist),
+                 ExcInternalError());
+        }
+
+      // cast away constness as in save_attached_data()
+      auto tria = const_cast<Triangulation<dim, spacedim> *>(this);
+
+      // Pack the attached data now, while the mesh is guaranteed not to
+      // change, and move the resulting buffers out of the triangulation so
+      // that they stay valid while the background task writes them to disk.
+      auto serializer = std::make_shared<
+        dealii::internal::CellAttachedDataSerializer<dim, spacedim>>();
+      const bool have_attached_data =
+        this->cell_attached_data.n_attached_data_sets > 0;
+      if (have_attached_data)
+        {
+          tria->data_serializer.pack_data(
+            tria->local_cell_relations,
+            tria->cell_attached_data.pack_callbacks_fixed,
+            tria->cell_attached_data.pack_callbacks_variable,
+            this->get_communicator());
+          *serializer = std::move(tria->data_serializer);
+          tria->data_serializer.clear();
+        }
+
+      // clear all of the callback data, as explained in the documentation of
+      // register_data_attach()
+      {
+        tria->cell_attached_data.n_attached_data_sets = 0;
+        tria->cell_attached_data.pack_callbacks_fixed.clear();
+        tria->cell_attached_data.pack_callbacks_variable.clear();
+      }
+
+      const unsigned int global_first_cell =
+        parallel_forest->global_first_quadrant[myrank];
+      const unsigned int global_num_cells = parallel_forest->global_num_quadrants;
+
+      // Take a snapshot of the forest so that the mesh may be adapted while
+      // the background task is still writing. p4est_copy() shares the
+      // (immutable) connectivity with the original forest, which is why the
+      // triangulation must outlive the returned task.
+      typename dealii::internal::p4est::types<dim>::forest *forest_snapshot =
+        dealii::internal::p4est::functions<dim>::copy_forest(
+          parallel_forest, /*copy_data=*/false);
+
+      // Perform all communication of the background task on a duplicate of
+      // our communicator so that it cannot interfere with messages of the
+      // ongoing computation. The forest snapshot is redirected to the
+      // duplicate as well; this is safe because the duplicate is congruent
+      // to the original communicator.
+      MPI_Comm background_comm;
+      ierr = MPI_Comm_dup(this->mpi_communicator, &background_comm);
+      AssertThrowMPI(ierr);
+      forest_snapshot->mpicomm = background_comm;
+
+      const unsigned int compression_level =
+        this->attached_data_compression_level;
+      const unsigned int compression_chunk_cells =
+        this->attached_data_compression_chunk_cells;
+
+      return Threads::new_task([serializer,
+                                have_attached_data,
+                                global_first_cell,
+                                global_num_cells,
+                                filename,
+                                forest_snapshot,
+                                background_comm,
+                                compression_level,
+                                compression_chunk_cells,
+                                tria]() mutable {
+        if (have_attached_data)
+          {
+            serializer->save(global_first_cell,
+                             global_num_cells,
+                             filename,
+                             background_comm,
+                             compression_level,
+                             compression_chunk_cells);
+            serializer->clear();
+          }
+
+        dealii::internal::p4est::functions<dim>::save(filename.c_str(),
+                                                      forest_snapshot,
+                                                      false);
+        dealii::internal::p4est::functions<dim>::destroy(forest_snapshot);
+
+        const int ierr = MPI_Comm_free(&background_comm);
+        AssertThrowMPI(ierr);
+
+        // signal that serialization has finished
+        tria->signals.post_distributed_save();
+      });
+    }
+
+
+
     template <int dim, int spacedim>
     DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
     void Triangulation<dim, spacedim>::load(const std::string &filename)
@@ -2103,6 +2249,8 @@ namespace parallel
       // signal that de-serialization is going to happen
       this->signals.pre_distributed_load();
 
+      local_forest_snapshot = LocalForestSnapshot();
+
       if (parallel_ghost != nullptr)
         {
           dealii::internal::p4est::functions<dim>::ghost_destroy(
@@ -2210,6 +2358,7 @@ namespace parallel
                "of the provided forest!"));
 
       // clear the old forest
+      local_forest_snapshot = LocalForestSnapshot();
       if (parallel_ghost != nullptr)
         {
           dealii::internal::p4est::functions<dim>::ghost_destroy(
@@ -2787,6 +2936,154 @@ namespace parallel
 
 
 
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    void Triangulation<dim, spacedim>::store_local_forest_snapshot()
+    {
+      LocalForestSnapshot &snapshot = local_forest_snapshot;
+
+      snapshot.first_local_tree = parallel_forest->first_local_tree;
+      snapshot.last_local_tree  = parallel_forest->last_local_tree;
+
+      snapshot.quadrants_per_tree.clear();
+      snapshot.local_quadrants.clear();
+      snapshot.local_quadrants.reserve(parallel_forest->local_num_quadrants);
+      for (typename dealii::internal::p4est::types<dim>::topidx tt =
+             parallel_forest->first_local_tree;
+           tt <= parallel_forest->last_local_tree;
+           ++tt)
+        {
+          const typename dealii::internal::p4est::types<dim>::tree *tree =
+            static_cast<typename dealii::internal::p4est::types<dim>::tree *>(
+              sc_array_index(parallel_forest->trees, tt));
+
+          snapshot.quadrants_per_tree.push_back(tree->quadrants.elem_count);
+          for (unsigned int q = 0; q < tree->quadrants.elem_count; ++q)
+            snapshot.local_quadrants.push_back(
+              *static_cast<
+                typename dealii::internal::p4est::types<dim>::quadrant *>(
+                sc_array_index(
+                  const_cast<sc_array_t *>(&tree->quadrants), q)));
+        }
+
+      snapshot.ghost_quadrants.clear();
+      snapshot.ghost_quadrants.reserve(parallel_ghost->ghosts.elem_count);
+      for (unsigned int g = 0; g < parallel_ghost->ghosts.elem_count; ++g)
+        snapshot.ghost_quadrants.push_back(
+          *static_cast<
+            typename dealii::internal::p4est::types<dim>::quadrant *>(
+            sc_array_index(&parallel_ghost->ghosts, g)));
+
+      const unsigned int n_trees = parallel_forest->connectivity->num_trees;
+      snapshot.ghost_tree_offsets.assign(parallel_ghost->tree_offsets,
+                                         parallel_ghost->tree_offsets +
+                                           n_trees + 1);
+      snapshot.ghost_proc_offsets.assign(parallel_ghost->proc_offsets,
+                                         parallel_ghost->proc_offsets +
+                                           parallel_forest->mpisize + 1);
+      snapshot.global_first_quadrant.assign(
+        parallel_forest->global_first_quadrant,
+        parallel_forest->global_first_quadrant + parallel_forest->mpisize + 1);
+
+      snapshot.is_valid = true;
+    }
+
+
+
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    bool Triangulation<dim, spacedim>::local_forest_matches_snapshot() const
+    {
+      const LocalForestSnapshot &snapshot = local_forest_snapshot;
+
+      if (snapshot.is_valid == false)
+        return false;
+
+      // when a multigrid hierarchy is maintained, the level subdomain ids
+      // also depend on the global partition through the owner lookup of
+      // coarser level cells, so any shift of the partition boundaries
+      // requires a full synchronization
+      if (settings & construct_multigrid_hierarchy)
+        {
+          if (snapshot.global_first_quadrant.size() !=
+              static_cast<std::size_t>(parallel_forest->mpisize + 1))
+            return false;
+          if (std::equal(snapshot.global_first_quadrant.begin(),
+                         snapshot.global_first_quadrant.end(),
+                         parallel_forest->global_first_quadrant) == false)
+            return false;
+        }
+
+      if (snapshot.first_local_tree != parallel_forest->first_local_tree ||
+          snapshot.last_local_tree != parallel_forest->last_local_tree)
+        return false;
+
+      if (snapshot.local_quadrants.size() !=
+          static_cast<std::size_t>(parallel_forest->local_num_quadrants))
+        return false;
+
+      unsigned int index = 0;
+      unsigned int tree_number = 0;
+      for (typename dealii::internal::p4est::types<dim>::topidx tt =
+             parallel_forest->first_local_tree;
+           tt <= parallel_forest->last_local_tree;
+           ++tt, ++tree_number)
+        {
+          const typename dealii::internal::p4est::types<dim>::tree *tree =
+            static_cast<typename dealii::internal::p4est::types<dim>::tree *>(
+              sc_array_index(parallel_forest->trees, tt));
+
+          if (tree_number >= snapshot.quadrants_per_tree.size() ||
+              snapshot.quadrants_per_tree[tree_number] !=
+                static_cast<typename dealii::internal::p4est::types<
+                  dim>::locidx>(tree->quadrants.elem_count))
+            return false;
+
+          for (unsigned int q = 0; q < tree->quadrants.elem_count;
+               ++q, ++index)
+            if (dealii::internal::p4est::quadrant_is_equal<dim>(
+                  snapshot.local_quadrants[index],
+                  *static_cast<
+                    typename dealii::internal::p4est::types<dim>::quadrant *>(
+                    sc_array_index(const_cast<sc_array_t *>(&tree->quadrants),
+                                   q))) == false)
+              return false;
+        }
+
+      if (snapshot.ghost_quadrants.size() != parallel_ghost->ghosts.elem_count)
+        return false;
+
+      for (unsigned int g = 0; g < parallel_ghost->ghosts.elem_count; ++g)
+        if (dealii::internal::p4est::quadrant_is_equal<dim>(
+              snapshot.ghost_quadrants[g],
+              *static_cast<
+                typename dealii::internal::p4est::types<dim>::quadrant *>(
+                sc_array_index(&parallel_ghost->ghosts, g))) == false)
+          return false;
+
+      // the tree and owner association of the ghost quadrants has to match,
+      // too: an unchanged quadrant could have been handed over to a
+      // different owner by repartitioning
+      const unsigned int n_trees = parallel_forest->connectivity->num_trees;
+      if (snapshot.ghost_tree_offsets.size() !=
+            static_cast<std::size_t>(n_trees + 1) ||
+          std::equal(snapshot.ghost_tree_offsets.begin(),
+                     snapshot.ghost_tree_offsets.end(),
+                     parallel_ghost->tree_offsets) == false)
+        return false;
+
+      if (snapshot.ghost_proc_offsets.size() !=
+            static_cast<std::size_t>(parallel_forest->mpisize + 1) ||
+          std::equal(snapshot.ghost_proc_offsets.begin(),
+                     snapshot.ghost_proc_offsets.end(),
+                     parallel_ghost->proc_offsets) == false)
+        return false;
+
+      return true;
+    }
+
+
+
     template <int dim, int spacedim>
     DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
     void Triangulation<dim, spacedim>::copy_local_forest_to_triangulation()
@@ -2867,6 +3164,31 @@ namespace parallel
 
       Assert(parallel_ghost, ExcInternalError());
 
+      // If the locally owned quadrants, the ghost layer, and (when needed)
+      // the partition boundaries are identical to the state the
+      // triangulation was last synchronized with, the triangulation already
+      // matches the forest and all of the matching and refinement work below
+      // would find nothing to do. This is a common situation on processes
+      // far away from the region touched by an adaptation or repartition
+      // step, so detect it and return early. When the mesh is deliberately
+      // reconstructed from scratch after repartitioning, the local mesh has
+      // already been coarsened away above and we always need the full
+      // rebuild.
+      if (!(settings & mesh_reconstruction_after_repartitioning) &&
+          local_forest_matches_snapshot())
+        {
+          // drop left-over refinement flags that p4est did not act on (for
+          // example coarsening requests rejected by the 2:1 balance); the
+          // full rebuild below would consume them as well
+          for (const auto &cell : this->active_cell_iterators())
+            {
+              cell->clear_refine_flag();
+              cell->clear_coarsen_flag();
+            }
+
+          this->smooth_grid = save_smooth;
+          return;
+        }
 
       // set all cells to artificial. we will later set it to the correct
       // subdomain in match_tree_recursively
@@ -3159,6 +3481,10 @@ namespace parallel
       // repartitioning, further refinement/coarsening, and unpacking
       // of stored or transferred data.
       update_cell_relations();
+
+      // remember the forest state the triangulation now matches, so that the
+      // next call can detect when nothing has changed locally
+      store_local_forest_snapshot();
     }
 
 
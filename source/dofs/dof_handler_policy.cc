@@ -15,6 +15,7 @@
 
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/mpi_consensus_algorithms.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/types.h>
@@ -3477,19 +3478,25 @@ namespace internal
 
 
         /**
-         * A function that communicates the DoF indices from that subset of
-         * locally owned cells that have their user indices set to the
-         * corresponding ghost cells on other processors.
+         * A function that communicates the DoF indices of locally owned
+         * cells to the processes on which these cells are ghosts, using a
+         * single sparse push per process pair implemented with the
+         * ConsensusAlgorithms framework. In contrast to the request/reply
+         * scheme of GridTools::exchange_cell_data_to_ghosts(), which costs
+         * two message latencies per round, the owners of the cells send
+         * their data directly; the destinations are known from the map
+         * @p vertices_with_ghost_neighbors, since a locally owned cell is a
+         * ghost cell exactly on those processes that own a ghost cell
+         * sharing a vertex with it.
          *
-         * This function makes use of the user flags in the following
-         * way:
-         * - On locally owned cells, the flag indicates whether we still
+         * This function makes use of the marks in the following way:
+         * - On locally owned cells, the mark indicates whether we still
          *   need to send the DoF indices to other processors on which
          *   the current cell is a ghost. In phase 1, this is true for
          *   all locally owned cells that are adjacent to ghost cells
          *   in some way. In phase 2, this is only true if before phase
          *   1 we did not know all dof indices yet
-         * - On ghost cells, the flag indicates whether we still expect
+         * - On ghost cells, the mark indicates whether we still expect
          *   information to be sent to us. In phase 1, this is true for
          *   all ghost cells. In phase 2, this is only true if we
          *   did not receive a complete set of DoF indices in phase 1.
@@ -3498,89 +3505,140 @@ namespace internal
         void
         communicate_dof_indices_on_marked_cells(
           const DoFHandler<dim, spacedim> &dof_handler,
-          std::vector<bool>               &cell_marked)
+          std::vector<bool>               &cell_marked,
+          const std::map<unsigned int, std::set<types::subdomain_id>>
+            &vertices_with_ghost_neighbors)
         {
-#  ifndef DEAL_II_WITH_MPI
-          (void)dof_handler;
-          DEAL_II_NOT_IMPLEMENTED();
-#  else
+          using CellDataType =
+            std::vector<std::pair<typename CellId::binary_type,
+                                  std::vector<types::global_dof_index>>>;
 
-          // define functions that pack data on cells that are ghost cells
-          // somewhere else, and unpack data on cells where we get information
-          // from elsewhere
-          const auto pack = [](const auto &cell) {
-            Assert(cell->is_locally_owned(), ExcInternalError());
+          // collect the payload for each destination process: for every
+          // marked locally owned cell, the dof indices are sent to the
+          // owners of all ghost cells that share a vertex with it
+          std::map<unsigned int, CellDataType> data_for_destination;
 
-            std::vector<dealii::types::global_dof_index> data(
-              cell->get_fe().n_dofs_per_cell());
+          std::vector<types::global_dof_index> local_dof_indices;
+          for (const auto &cell : dof_handler.active_cell_iterators())
+            if (cell->is_locally_owned() &&
+                cell_marked[cell->active_cell_index()])
+              {
+                std::set<types::subdomain_id> destinations;
+                for (const unsigned int v : cell->vertex_indices())
+                  {
+                    const auto it = vertices_with_ghost_neighbors.find(
+                      cell->vertex_index(v));
+                    if (it != vertices_with_ghost_neighbors.end())
+                      destinations.insert(it->second.begin(),
+                                          it->second.end());
+                  }
 
-            // bypass the cache which is not filled yet
-            internal::DoFAccessorImplementation::Implementation::
-              get_dof_indices(*cell, data, cell->active_fe_index());
+                Assert(destinations.empty() == false, ExcInternalError());
 
-            return data;
-          };
+                local_dof_indices.resize(cell->get_fe().n_dofs_per_cell());
 
-          const auto unpack = [&cell_marked](const auto &cell,
-                                             const auto &dofs) {
-            Assert(cell->get_fe().n_dofs_per_cell() == dofs.size(),
-                   ExcInternalError());
+                // bypass the cache which is not filled yet
+                internal::DoFAccessorImplementation::Implementation::
+                  get_dof_indices(*cell,
+                                  local_dof_indices,
+                                  cell->active_fe_index());
 
-            Assert(cell->is_ghost(), ExcInternalError());
+                // if we do not know all indices of this cell yet, we will
+                // have to send the then completed set again in the next
+                // phase; otherwise this send finishes the work on the cell
+                cell_marked[cell->active_cell_index()] =
+                  (std::find(local_dof_indices.begin(),
+                             local_dof_indices.end(),
+                             numbers::invalid_dof_index) !=
+                   local_dof_indices.end());
+
+                const typename CellId::binary_type binary_id =
+                  cell->id().template to_binary<spacedim>();
+                for (const types::subdomain_id destination : destinations)
+                  data_for_destination[destination].emplace_back(
+                    binary_id, local_dof_indices);
+              }
 
-            // Use a combined read/set function on the entities of the dof
-            // indices to speed things up against get_dof_indices +
-            // set_dof_indices
-            bool complete = true;
-            DoFAccessorImplementation::Implementation::process_dof_indices(
-              *cell,
-              dofs,
-              cell->active_fe_index(),
-              DoFAccessorImplementation::Implementation::
-                DoFIndexProcessor<dim, spacedim>(),
+          std::vector<unsigned int> targets;
+          targets.reserve(data_for_destination.size());
+          for (const auto &i : data_for_destination)
+            targets.push_back(i.first);
 
-              // Intel ICC 18 and earlier for some reason believe that
-              // numbers::invalid_dof_index is not a valid object
-              // inside the lambda function. Fix this by creating a
-              // local variable initialized by the global one.
-              //
-              // Intel ICC 19 and earlier have trouble with our Assert
-              // macros inside the lambda function. We disable the macro
-              // for these compilers.
-              [&complete, invalid_dof_index = numbers::invalid_dof_index](
-                auto &stored_index, const auto received_index) {
-                if (*received_index != invalid_dof_index)
+          const auto create_request =
+            [&data_for_destination](const unsigned int other_rank) {
+              return data_for_destination.at(other_rank);
+            };
+
+          const auto process_request = [&](const unsigned int,
+                                           const CellDataType &cell_data) {
+            for (const auto &[binary_id, dofs] : cell_data)
+              {
+                const auto tria_cell =
+                  dof_handler.get_triangulation().create_cell_iterator(
+                    CellId(binary_id));
+
+                const typename DoFHandler<dim, spacedim>::active_cell_iterator
+                  cell(&dof_handler.get_triangulation(),
+                       tria_cell->level(),
+                       tria_cell->index(),
+                       &dof_handler);
+
+                Assert(cell->get_fe().n_dofs_per_cell() == dofs.size(),
+                       ExcInternalError());
+
+                Assert(cell->is_ghost(), ExcInternalError());
+
+                // Use a combined read/set function on the entities of the
+                // dof indices to speed things up against get_dof_indices +
+                // set_dof_indices
+                bool complete = true;
+                DoFAccessorImplementation::Implementation::process_dof_indices(
+                  *cell,
+                  dofs,
+                  cell->active_fe_index(),
+                  DoFAccessorImplementation::Implementation::
+                    DoFIndexProcessor<dim, spacedim>(),
+
+                  // Intel ICC 18 and earlier for some reason believe that
+                  // numbers::invalid_dof_index is not a valid object
+                  // inside the lambda function. Fix this by creating a
+                  // local variable initialized by the global one.
+                  //
+                  // Intel ICC 19 and earlier have trouble with our Assert
+                  // macros inside the lambda function. We disable the macro
+                  // for these compilers.
+                  [&complete, invalid_dof_index = numbers::invalid_dof_index](
+                    auto &stored_index, const auto received_index) {
+                    if (*received_index != invalid_dof_index)
+                      {
+#  if !defined(__INTEL_COMPILER) || __INTEL_COMPILER >= 1900
+                        Assert((stored_index == invalid_dof_index) ||
+                                 (stored_index == *received_index),
+                               ExcInternalError());
+#  endif
+                        stored_index = *received_index;
+                      }
+                    else
+                      complete = false;
+                  },
+                  false);
+
+                if (!complete)
                   {
-#    if !defined(__INTEL_COMPILER) || __INTEL_COMPILER >= 1900
-                    Assert((stored_index == invalid_dof_index) ||
-                             (stored_index == *received_index),
+                    // We should have the cell already marked
+                    Assert(cell_marked[cell->active_cell_index()],
                            ExcInternalError());
-#    endif
-                    stored_index = *received_index;
                   }
                 else
-                  complete = false;
-              },
-              false);
-
-            if (!complete)
-              {
-                // We should have the cell already marked
-                Assert(cell_marked[cell->active_cell_index()],
-                       ExcInternalError());
+                  cell_marked[cell->active_cell_index()] = false;
               }
-            else
-              cell_marked[cell->active_cell_index()] = false;
-          };
-
-          const auto filter = [&cell_marked](const auto &cell) {
-            return cell_marked[cell->active_cell_index()];
           };
 
-          GridTools::exchange_cell_data_to_ghosts<
-            std::vector<types::global_dof_index>,
-            DoFHandler<dim, spacedim>>(dof_handler, pack, unpack, filter);
-#  endif
+          Utilities::MPI::ConsensusAlgorithms::nbx<CellDataType>(
+            targets,
+            create_request,
+            process_request,
+            dof_handler.get_communicator());
         }
 
 
@@ -3727,21 +3785,37 @@ namespace internal
         //                    cells somewhere else, send our own DoF indices
         //                    to the appropriate set of other processors
         {
+          // the destinations of the data sent below are determined by the
+          // ghost cells adjacent to the vertices of each cell, so compute
+          // the vertex-to-ghost-owner map once for both phases
+          const std::map<unsigned int, std::set<types::subdomain_id>>
+            vertices_with_ghost_neighbors =
+              GridTools::compute_vertices_with_ghost_neighbors(*triangulation);
+
           // mark all cells that either have to send data (locally
           // owned cells that are adjacent to ghost neighbors in some
-          // way) or receive data (all ghost cells) via the user flags
+          // way) or receive data (all ghost cells)
           std::vector<bool> cell_marked(triangulation->n_active_cells());
           for (const auto &cell : dof_handler->active_cell_iterators())
             if (cell->is_ghost())
               cell_marked[cell->active_cell_index()] = true;
+            else if (cell->is_locally_owned())
+              for (const unsigned int v : cell->vertex_indices())
+                if (vertices_with_ghost_neighbors.find(cell->vertex_index(
+                      v)) != vertices_with_ghost_neighbors.end())
+                  {
+                    cell_marked[cell->active_cell_index()] = true;
+                    break;
+                  }
 
-          // Send and receive cells. After this, only the local cells
-          // are marked, that received new data. This has to be
-          // communicated in a second communication step.
+          // Send and receive cells. After this, only the cells
+          // are marked that have to participate in a second round because
+          // their data was still incomplete.
           //
           // as explained in the 'distributed' paper, this has to be
           // done twice
-          communicate_dof_indices_on_marked_cells(*dof_handler, cell_marked);
+          communicate_dof_indices_on_marked_cells(
+            *dof_handler, cell_marked, vertices_with_ghost_neighbors);
 
           // If the DoFHandler has hp-capabilities enabled, then we may have
           // received valid indices of degrees of freedom that are dominated
@@ -3754,7 +3828,8 @@ namespace internal
           //                    DoF indices set. however, some ghost cells
           //                    may still have invalid ones. thus, exchange
           //                    one more time.
-          communicate_dof_indices_on_marked_cells(*dof_handler, cell_marked);
+          communicate_dof_indices_on_marked_cells(
+            *dof_handler, cell_marked, vertices_with_ghost_neighbors);
 
           // at this point, we must have taken care of the data transfer
           // on all cells we had previously marked. verify this
@@ -4081,19 +4156,33 @@ namespace internal
         // taking into account that we have to unify a few DoFs in between
         // then communication phases if we do hp-numbering
         {
-          // mark all ghost cells for transfer
+          const std::map<unsigned int, std::set<types::subdomain_id>>
+            vertices_with_ghost_neighbors =
+              GridTools::compute_vertices_with_ghost_neighbors(*triangulation);
+
+          // mark all ghost cells and all locally owned cells adjacent to
+          // the ghost layer for transfer
           std::vector<bool> cell_marked(triangulation->n_active_cells());
           for (const auto &cell : dof_handler->active_cell_iterators())
             if (cell->is_ghost())
               cell_marked[cell->active_cell_index()] = true;
+            else if (cell->is_locally_owned())
+              for (const unsigned int v : cell->vertex_indices())
+                if (vertices_with_ghost_neighbors.find(cell->vertex_index(
+                      v)) != vertices_with_ghost_neighbors.end())
+                  {
+                    cell_marked[cell->active_cell_index()] = true;
+                    break;
+                  }
 
-          // Send and receive cells. After this, only the local cells
-          // are marked, that received new data. This has to be
-          // communicated in a second communication step.
+          // Send and receive cells. After this, only the cells
+          // are marked that have to participate in a second round because
+          // their data was still incomplete.
           //
           // as explained in the 'distributed' paper, this has to be
           // done twice
-          communicate_dof_indices_on_marked_cells(*dof_handler, cell_marked);
+          communicate_dof_indices_on_marked_cells(
+            *dof_handler, cell_marked, vertices_with_ghost_neighbors);
 
           // if the DoFHandler has hp-capabilities then we may have
           // received valid indices of degrees of freedom that are
@@ -4103,7 +4192,8 @@ namespace internal
           Implementation::merge_invalid_dof_indices_on_ghost_interfaces(
             *dof_handler);
 
-          communicate_dof_indices_on_marked_cells(*dof_handler, cell_marked);
+          communicate_dof_indices_on_marked_cells(
+            *dof_handler, cell_marked, vertices_with_ghost_neighbors);
         }
 
         NumberCache number_cache;
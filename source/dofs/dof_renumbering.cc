@@ -61,6 +61,7 @@
 #include <cmath>
 #include <functional>
 #include <map>
+#include <ostream>
 #include <vector>
 
 
@@ -2790,6 +2791,88 @@ namespace DoFRenumbering
       return std::make_pair(dof_numbers_mf_order, touch_count);
     }
 
+
+
+    // Predict the number of cache-line transfers of a single
+    // MatrixFree::cell_loop for the locally owned range of one input vector,
+    // given a permutation from the present local numbering to a new local
+    // numbering of the unknowns (the identity in case the permutation is
+    // empty). We assume a cache line of 64 bytes and count a line as
+    // transferred once per range of cell batches (i.e., per call-back into
+    // the loop) that touches at least one of its entries, assuming the line
+    // to stay in cache for the duration of the range. The second entry of
+    // the returned pair is the number of lines touched at all, i.e., the
+    // lower bound reached when every line gets touched by a single range
+    // only.
+    template <int dim, typename Number, typename VectorizedArrayType>
+    std::pair<std::size_t, std::size_t>
+    count_cache_line_transfers(
+      const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+      const unsigned int                                  component,
+      const std::vector<unsigned int>                    &permutation)
+    {
+      constexpr unsigned int dofs_per_cache_line =
+        std::max<unsigned int>(64 / sizeof(Number), 1U);
+
+      const unsigned int n_owned_dofs =
+        matrix_free.get_dof_info(component)
+          .vector_partitioner->locally_owned_size();
+      Assert(permutation.empty() || permutation.size() == n_owned_dofs,
+             ExcDimensionMismatch(permutation.size(), n_owned_dofs));
+
+      const unsigned int n_cache_lines =
+        (n_owned_dofs + dofs_per_cache_line - 1) / dofs_per_cache_line;
+      std::vector<unsigned int> last_touch_by_cell_batch_range(
+        n_cache_lines, dealii::numbers::invalid_unsigned_int);
+
+      std::size_t               n_transfers = 0;
+      std::size_t               n_lines_touched = 0;
+      std::vector<unsigned int> dofs_extracted;
+
+      const auto operation_on_cell_range =
+        [&](const MatrixFree<dim, Number, VectorizedArrayType> &data,
+            unsigned int &,
+            const unsigned int &,
+            const std::pair<unsigned int, unsigned int> &cell_range) {
+          for (unsigned int cell = cell_range.first; cell < cell_range.second;
+               ++cell)
+            {
+              data.get_dof_info(component).get_dof_indices_on_cell_batch(
+                dofs_extracted, cell);
+              for (const unsigned int dof_index : dofs_extracted)
+                if (dof_index < n_owned_dofs)
+                  {
+                    const unsigned int line =
+                      (permutation.empty() ? dof_index :
+                                             permutation[dof_index]) /
+                      dofs_per_cache_line;
+                    if (last_touch_by_cell_batch_range[line] !=
+                        cell_range.first)
+                      {
+                        if (last_touch_by_cell_batch_range[line] ==
+                            dealii::numbers::invalid_unsigned_int)
+                          ++n_lines_touched;
+                        ++n_transfers;
+                        last_touch_by_cell_batch_range[line] =
+                          cell_range.first;
+                      }
+                  }
+            }
+        };
+
+      Assert(matrix_free.get_task_info().scheme ==
+               dealii::internal::MatrixFreeFunctions::TaskInfo::none,
+             ExcNotImplemented("Cache-line prediction only available for "
+                               "non-threaded version of "
+                               "MatrixFree::cell_loop"));
+
+      unsigned int dummy = 0;
+      matrix_free.template cell_loop<unsigned int, unsigned int>(
+        operation_on_cell_range, dummy, dummy);
+
+      return std::make_pair(n_transfers, n_lines_touched);
+    }
+
   } // namespace
 
 
@@ -2803,38 +2886,127 @@ namespace DoFRenumbering
     const DoFHandler<dim, spacedim>                    &dof_handler,
     const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free)
   {
-    Assert(matrix_free.indices_initialized(),
-           ExcMessage("You need to set up indices in MatrixFree "
+    return compute_matrix_free_data_locality(
+      dof_handler,
+      std::vector<const MatrixFree<dim, Number, VectorizedArrayType> *>{
+        &matrix_free});
+  }
+
+
+
+  template <int dim,
+            int spacedim,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  matrix_free_data_locality(
+    DoFHandler<dim, spacedim> &dof_handler,
+    const std::vector<const MatrixFree<dim, Number, VectorizedArrayType> *>
+      &matrix_free_objects)
+  {
+    Assert(matrix_free_objects.size() > 0,
+           ExcMessage("You need to provide at least one MatrixFree object "
                       "to be able to compute a renumbering!"));
+    const std::vector<types::global_dof_index> new_global_numbers =
+      compute_matrix_free_data_locality(dof_handler, matrix_free_objects);
+    if (matrix_free_objects[0]->get_mg_level() ==
+        dealii::numbers::invalid_unsigned_int)
+      dof_handler.renumber_dofs(new_global_numbers);
+    else
+      dof_handler.renumber_dofs(matrix_free_objects[0]->get_mg_level(),
+                                new_global_numbers);
+  }
 
-    // try to locate the `DoFHandler` within the given MatrixFree object.
-    unsigned int component = 0;
-    for (; component < matrix_free.n_components(); ++component)
-      if (&matrix_free.get_dof_handler(component) == &dof_handler)
-        break;
 
-    Assert(component < matrix_free.n_components(),
-           ExcMessage("Could not locate the given DoFHandler in MatrixFree"));
+
+  template <int dim,
+            int spacedim,
+            typename Number,
+            typename VectorizedArrayType>
+  std::vector<types::global_dof_index>
+  compute_matrix_free_data_locality(
+    const DoFHandler<dim, spacedim> &dof_handler,
+    const std::vector<const MatrixFree<dim, Number, VectorizedArrayType> *>
+      &matrix_free_objects)
+  {
+    Assert(matrix_free_objects.size() > 0,
+           ExcMessage("You need to provide at least one MatrixFree object "
+                      "to be able to compute a renumbering!"));
+
+    // try to locate the `DoFHandler` within each given MatrixFree object.
+    std::vector<unsigned int> components;
+    for (const MatrixFree<dim, Number, VectorizedArrayType> *matrix_free :
+         matrix_free_objects)
+      {
+        Assert(matrix_free != nullptr, ExcNotInitialized());
+        Assert(matrix_free->indices_initialized(),
+               ExcMessage("You need to set up indices in MatrixFree "
+                          "to be able to compute a renumbering!"));
+        Assert(matrix_free->get_mg_level() ==
+                 matrix_free_objects[0]->get_mg_level(),
+               ExcMessage("All MatrixFree objects need to be set up on the "
+                          "same multigrid level to compute a renumbering!"));
+
+        unsigned int component = 0;
+        for (; component < matrix_free->n_components(); ++component)
+          if (&matrix_free->get_dof_handler(component) == &dof_handler)
+            break;
+
+        Assert(component < matrix_free->n_components(),
+               ExcMessage(
+                 "Could not locate the given DoFHandler in MatrixFree"));
+        components.push_back(component);
+      }
 
     // Summary of the algorithm below:
     // (a) compute renumbering of each DoF in the order the corresponding
-    //     object appears in the mf loop -> local_numbering
+    //     object appears in the mf loop of the first given MatrixFree object
+    //     -> local_numbering
     // (b) determine by how many cell groups (call-back places in the loop) a
-    //     dof is touched -> touch_count
-    // (c) determine by how many MPI processes a dof is touched
-    //     -> dofs_by_rank_access
+    //     dof is touched -> touch_count; when several MatrixFree objects are
+    //     given, we take the maximum over all of their loops, as a dof can
+    //     only be considered local to a group of cells if that holds for
+    //     every loop alternating on the vector
+    // (c) determine which dofs are touched by other MPI processes in any of
+    //     the loops -> is_mpi_dof
     // (d) combine both category types of (b) and (c) and list the indices
     //     according to four categories
 
-    const std::vector<std::vector<unsigned int>> dofs_by_rank_access =
-      group_dofs_by_rank_access(
-        *matrix_free.get_dof_info(component).vector_partitioner);
+    auto [local_numbering, touch_count] =
+      compute_mf_numbering(*matrix_free_objects[0], components[0]);
 
-    const auto &[local_numbering, touch_count] =
-      compute_mf_numbering(matrix_free, component);
+    const IndexSet &owned_dofs =
+      matrix_free_objects[0]
+        ->get_dof_info(components[0])
+        .vector_partitioner->locally_owned_range();
 
-    const IndexSet &owned_dofs = matrix_free.get_dof_info(component)
-                                   .vector_partitioner->locally_owned_range();
+    std::vector<bool> is_mpi_dof(owned_dofs.n_elements(), false);
+    for (unsigned int k = 0; k < matrix_free_objects.size(); ++k)
+      {
+        const dealii::Utilities::MPI::Partitioner &partitioner =
+          *matrix_free_objects[k]->get_dof_info(components[k]).vector_partitioner;
+        Assert(partitioner.locally_owned_range() == owned_dofs,
+               ExcMessage("All MatrixFree objects need to agree on the set "
+                          "of locally owned dofs of the DoFHandler to "
+                          "compute a renumbering!"));
+
+        const std::vector<std::vector<unsigned int>> dofs_by_rank_access =
+          group_dofs_by_rank_access(partitioner);
+        for (unsigned int chunk = 1; chunk < dofs_by_rank_access.size();
+             ++chunk)
+          for (const unsigned int i : dofs_by_rank_access[chunk])
+            is_mpi_dof[i] = true;
+
+        if (k > 0)
+          {
+            const auto &[local_numbering_k, touch_count_k] =
+              compute_mf_numbering(*matrix_free_objects[k], components[k]);
+            (void)local_numbering_k;
+            AssertDimension(touch_count_k.size(), touch_count.size());
+            for (unsigned int i = 0; i < touch_count.size(); ++i)
+              touch_count[i] = std::max(touch_count[i], touch_count_k[i]);
+          }
+      }
     const types::global_dof_index locally_owned_size = owned_dofs.n_elements();
     AssertDimension(locally_owned_size, local_numbering.size());
     AssertDimension(locally_owned_size, touch_count.size());
@@ -2862,8 +3034,8 @@ namespace DoFRenumbering
             categories[local_numbering[i]] = Category::multiple;
             break;
         }
-    for (unsigned int chunk = 1; chunk < dofs_by_rank_access.size(); ++chunk)
-      for (const auto i : dofs_by_rank_access[chunk])
+    for (unsigned int i = 0; i < locally_owned_size; ++i)
+      if (is_mpi_dof[i])
         categories[local_numbering[i]] = Category::mpi_dof;
 
     // Assign numbers to the categories in the order listed in the enum, which
@@ -2895,6 +3067,94 @@ namespace DoFRenumbering
     return new_global_numbers;
   }
 
+
+
+  template <int dim,
+            int spacedim,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  report_matrix_free_data_locality(
+    std::ostream                    &out,
+    const DoFHandler<dim, spacedim> &dof_handler,
+    const std::vector<const MatrixFree<dim, Number, VectorizedArrayType> *>
+      &matrix_free_objects,
+    const std::vector<types::global_dof_index> &new_global_numbers)
+  {
+    Assert(matrix_free_objects.size() > 0,
+           ExcMessage("You need to provide at least one MatrixFree object "
+                      "to be able to predict cache-line transfers!"));
+    Assert(matrix_free_objects[0] != nullptr, ExcNotInitialized());
+
+    unsigned int first_component = 0;
+    for (; first_component < matrix_free_objects[0]->n_components();
+         ++first_component)
+      if (&matrix_free_objects[0]->get_dof_handler(first_component) ==
+          &dof_handler)
+        break;
+    Assert(first_component < matrix_free_objects[0]->n_components(),
+           ExcMessage("Could not locate the given DoFHandler in MatrixFree"));
+
+    const IndexSet &owned_dofs =
+      matrix_free_objects[0]
+        ->get_dof_info(first_component)
+        .vector_partitioner->locally_owned_range();
+    AssertDimension(new_global_numbers.size(), owned_dofs.n_elements());
+
+    // translate the new global numbers into a permutation within the locally
+    // owned range, which is possible because the renumbering keeps the set
+    // of locally owned dofs unchanged
+    std::vector<unsigned int> permutation(new_global_numbers.size());
+    for (unsigned int i = 0; i < permutation.size(); ++i)
+      {
+        const types::global_dof_index new_local_index =
+          owned_dofs.index_within_set(new_global_numbers[i]);
+        Assert(new_local_index != numbers::invalid_dof_index,
+               ExcMessage("The given numbering must be a permutation of the "
+                          "locally owned dofs of the DoFHandler"));
+        permutation[i] = new_local_index;
+      }
+
+    constexpr unsigned int dofs_per_cache_line =
+      std::max<unsigned int>(64 / sizeof(Number), 1U);
+    out << "Predicted cache-line transfers per MatrixFree::cell_loop for one "
+        << "input vector (cache line of 64 bytes, " << dofs_per_cache_line
+        << " vector entries):" << std::endl;
+    for (unsigned int k = 0; k < matrix_free_objects.size(); ++k)
+      {
+        const MatrixFree<dim, Number, VectorizedArrayType> *matrix_free =
+          matrix_free_objects[k];
+        Assert(matrix_free != nullptr, ExcNotInitialized());
+        Assert(matrix_free->indices_initialized(),
+               ExcMessage("You need to set up indices in MatrixFree "
+                          "to be able to predict cache-line transfers!"));
+
+        unsigned int component = 0;
+        for (; component < matrix_free->n_components(); ++component)
+          if (&matrix_free->get_dof_handler(component) == &dof_handler)
+            break;
+        Assert(component < matrix_free->n_components(),
+               ExcMessage(
+                 "Could not locate the given DoFHandler in MatrixFree"));
+        Assert(matrix_free->get_dof_info(component)
+                   .vector_partitioner->locally_owned_range() == owned_dofs,
+               ExcMessage("All MatrixFree objects need to agree on the set "
+                          "of locally owned dofs of the DoFHandler"));
+
+        const auto [transfers_current, lines_current] =
+          count_cache_line_transfers(*matrix_free,
+                                     component,
+                                     std::vector<unsigned int>());
+        const auto [transfers_new, lines_new] =
+          count_cache_line_transfers(*matrix_free, component, permutation);
+        (void)lines_current;
+        out << "  loop " << k << ": " << transfers_current
+            << " with the current numbering, " << transfers_new
+            << " with the new numbering, lower bound " << lines_new
+            << std::endl;
+      }
+  }
+
 } // namespace DoFRenumbering
 
 
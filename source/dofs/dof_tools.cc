@@ -1207,6 +1207,77 @@ namespace DoFTools
 
 
 
+  template <int dim, int spacedim>
+  IndexSet
+  extract_face_halo_dofs(const DoFHandler<dim, spacedim> &dof_handler)
+  {
+    // collect all the locally owned dofs
+    IndexSet dof_set = dof_handler.locally_owned_dofs();
+
+    // now add the DoFs of those ghost cells that share a face with a locally
+    // owned cell. we find these cells by looking at the face neighbors of the
+    // locally owned cells, which are never artificial, rather than by
+    // scanning the ghost cells themselves. see the comment in
+    // extract_locally_relevant_dofs() for the choice of data structures
+    std::vector<types::global_dof_index> dof_indices;
+    std::vector<types::global_dof_index> dofs_on_ghosts;
+
+    const auto add_dofs_if_ghost = [&](const auto &neighbor) {
+      if (neighbor->is_ghost())
+        {
+          dof_indices.resize(neighbor->get_fe().n_dofs_per_cell());
+          neighbor->get_dof_indices(dof_indices);
+          for (const auto dof_index : dof_indices)
+            if (!dof_set.is_element(dof_index))
+              dofs_on_ghosts.push_back(dof_index);
+        }
+    };
+
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->is_locally_owned())
+        for (const unsigned int f : cell->face_indices())
+          {
+            if (cell->at_boundary(f) && !cell->has_periodic_neighbor(f))
+              continue;
+
+            const bool periodic_neighbor = cell->has_periodic_neighbor(f);
+            const auto neighbor = cell->neighbor_or_periodic_neighbor(f);
+
+            if (neighbor->is_active())
+              add_dofs_if_ghost(neighbor);
+            else if (dim == 1)
+              {
+                // in 1d, descend to the active neighbor adjacent to the
+                // common vertex
+                auto fine_neighbor = neighbor;
+                while (fine_neighbor->has_children())
+                  fine_neighbor = fine_neighbor->child(f == 0 ? 1 : 0);
+                add_dofs_if_ghost(fine_neighbor);
+              }
+            else
+              {
+                // the neighbor is refined: the active cells behind this face
+                // are its children, which can have different owners, so look
+                // at each of them
+                for (unsigned int sf = 0; sf < cell->face(f)->n_children();
+                     ++sf)
+                  add_dofs_if_ghost(
+                    periodic_neighbor ?
+                      cell->periodic_neighbor_child_on_subface(f, sf) :
+                      cell->neighbor_child_on_subface(f, sf));
+              }
+          }
+
+    // sort and put into an index set
+    std::sort(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
+    dof_set.add_indices(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
+    dof_set.compress();
+
+    return dof_set;
+  }
+
+
+
   template <int dim, int spacedim>
   IndexSet
   extract_locally_relevant_level_dofs(
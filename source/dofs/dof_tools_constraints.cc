@@ -43,6 +43,7 @@
 
 #include <algorithm>
 #include <array>
+#include <functional>
 #include <memory>
 #include <numeric>
 
@@ -595,7 +596,10 @@ namespace DoFTools
     void
     make_hp_hanging_node_constraints(
       const DoFHandler<1, spacedim> & /*dof_handler*/,
-      AffineConstraints<number> & /*constraints*/)
+      AffineConstraints<number> & /*constraints*/,
+      const std::function<bool(
+        const typename DoFHandler<1, spacedim>::active_cell_iterator &)>
+        & /*cell_filter*/)
     {
       // nothing to do for dof handlers in 1d
     }
@@ -607,6 +611,9 @@ namespace DoFTools
     make_hanging_node_constraints_nedelec(
       const dealii::DoFHandler<1, spacedim> & /*dof_handler*/,
       AffineConstraints<number> & /*constraints*/,
+      const std::function<bool(
+        const typename DoFHandler<1, spacedim>::active_cell_iterator &)>
+        & /*cell_filter*/,
       std::integral_constant<int, 1>)
     {
       // nothing to do for dof handlers in 1d
@@ -619,6 +626,9 @@ namespace DoFTools
     make_oldstyle_hanging_node_constraints(
       const DoFHandler<1, spacedim> & /*dof_handler*/,
       AffineConstraints<number> & /*constraints*/,
+      const std::function<bool(
+        const typename DoFHandler<1, spacedim>::active_cell_iterator &)>
+        & /*cell_filter*/,
       std::integral_constant<int, 1>)
     {
       // nothing to do for dof handlers in 1d
@@ -631,6 +641,9 @@ namespace DoFTools
     make_oldstyle_hanging_node_constraints(
       const DoFHandler<dim_, spacedim> &dof_handler,
       AffineConstraints<number>        &constraints,
+      const std::function<bool(
+        const typename DoFHandler<dim_, spacedim>::active_cell_iterator &)>
+        &cell_filter,
       std::integral_constant<int, 2>)
     {
       const unsigned int dim = 2;
@@ -663,6 +676,10 @@ namespace DoFTools
           if (cell->is_artificial())
             continue;
 
+          // honor a restriction of the computation to a subset of cells
+          if (cell_filter && (cell_filter(cell) == false))
+            continue;
+
           for (const unsigned int face : cell->face_indices())
             if (cell->face(face)->has_children())
               {
@@ -792,6 +809,9 @@ namespace DoFTools
     make_oldstyle_hanging_node_constraints(
       const DoFHandler<dim_, spacedim> &dof_handler,
       AffineConstraints<number>        &constraints,
+      const std::function<bool(
+        const typename DoFHandler<dim_, spacedim>::active_cell_iterator &)>
+        &cell_filter,
       std::integral_constant<int, 3>)
     {
       const unsigned int dim = 3;
@@ -824,6 +844,10 @@ namespace DoFTools
           if (cell->is_artificial())
             continue;
 
+          // honor a restriction of the computation to a subset of cells
+          if (cell_filter && (cell_filter(cell) == false))
+            continue;
+
           for (const unsigned int face : cell->face_indices())
             if (cell->face(face)->has_children())
               {
@@ -1052,6 +1076,9 @@ namespace DoFTools
     make_hanging_node_constraints_nedelec(
       const DoFHandler<dim_, spacedim> &dof_handler,
       AffineConstraints<number>        &constraints,
+      const std::function<bool(
+        const typename DoFHandler<dim_, spacedim>::active_cell_iterator &)>
+        &cell_filter,
       std::integral_constant<int, 2>)
     {
       // Parts of this function are very similar to
@@ -1072,6 +1099,10 @@ namespace DoFTools
           if (cell->is_artificial())
             continue;
 
+          // honor a restriction of the computation to a subset of cells
+          if (cell_filter && (cell_filter(cell) == false))
+            continue;
+
           // loop over all faces:
           for (const unsigned int f : cell->face_indices())
             {
@@ -1181,6 +1212,9 @@ namespace DoFTools
     make_hanging_node_constraints_nedelec(
       const DoFHandler<dim_, spacedim> &dof_handler,
       AffineConstraints<number>        &constraints,
+      const std::function<bool(
+        const typename DoFHandler<dim_, spacedim>::active_cell_iterator &)>
+        &cell_filter,
       std::integral_constant<int, 3>)
     {
       // Parts of this function are very similar to
@@ -1200,6 +1234,10 @@ namespace DoFTools
           if (cell->is_artificial())
             continue;
 
+          // honor a restriction of the computation to a subset of cells
+          if (cell_filter && (cell_filter(cell) == false))
+            continue;
+
           // loop over all faces
           for (const unsigned int face : cell->face_indices())
             {
@@ -2315,7 +2353,10 @@ namespace DoFTools
     void
     make_hp_hanging_node_constraints(
       const DoFHandler<dim, spacedim> &dof_handler,
-      AffineConstraints<number>       &constraints)
+      AffineConstraints<number>       &constraints,
+      const std::function<bool(
+        const typename DoFHandler<dim, spacedim>::active_cell_iterator &)>
+        &cell_filter)
     {
       // note: this function is going to be hard to understand if you haven't
       // read the hp-paper. however, we try to follow the notation laid out
@@ -2372,6 +2413,10 @@ namespace DoFTools
           if (cell->is_artificial())
             continue;
 
+          // honor a restriction of the computation to a subset of cells
+          if (cell_filter && (cell_filter(cell) == false))
+            continue;
+
           for (const unsigned int face : cell->face_indices())
             if (cell->face(face)->has_children())
               {
@@ -3070,8 +3115,12 @@ namespace DoFTools
 
   template <int dim, int spacedim, typename number>
   void
-  make_hanging_node_constraints(const DoFHandler<dim, spacedim> &dof_handler,
-                                AffineConstraints<number>       &constraints)
+  make_hanging_node_constraints(
+    const DoFHandler<dim, spacedim> &dof_handler,
+    AffineConstraints<number>       &constraints,
+    const std::function<bool(
+      const typename DoFHandler<dim, spacedim>::active_cell_iterator &)>
+      &cell_filter)
   {
     Assert(dof_handler.has_active_dofs(),
            ExcMessage(
@@ -3086,12 +3135,20 @@ namespace DoFTools
     if (dof_handler.get_fe().get_name().find("FE_NedelecSZ") !=
         std::string::npos)
       internal::make_hanging_node_constraints_nedelec(
-        dof_handler, constraints, std::integral_constant<int, dim>());
+        dof_handler,
+        constraints,
+        cell_filter,
+        std::integral_constant<int, dim>());
     else if (dof_handler.get_fe_collection().hp_constraints_are_implemented())
-      internal::make_hp_hanging_node_constraints(dof_handler, constraints);
+      internal::make_hp_hanging_node_constraints(dof_handler,
+                                                 constraints,
+                                                 cell_filter);
     else
       internal::make_oldstyle_hanging_node_constraints(
-        dof_handler, constraints, std::integral_constant<int, dim>());
+        dof_handler,
+        constraints,
+        cell_filter,
+        std::integral_constant<int, dim>());
   }
 
 
@@ -1007,11 +1007,16 @@ FiniteElement<dim, spacedim>::operator==(
   const FiniteElement<dim, spacedim> &f) const
 {
   // Compare fields in roughly increasing order of how expensive the
-  // comparison is
+  // comparison is. Only compare the interface constraint matrices if both
+  // elements have initialized them: FESystem builds these matrices upon
+  // first access, and the deferred initialization must not make otherwise
+  // identical elements compare unequal.
   return ((typeid(*this) == typeid(f)) && (this->get_name() == f.get_name()) &&
           (static_cast<const FiniteElementData<dim> &>(*this) ==
            static_cast<const FiniteElementData<dim> &>(f)) &&
-          (interface_constraints == f.interface_constraints));
+          ((interface_constraints.m() == 0) ||
+           (f.interface_constraints.m() == 0) ||
+           (interface_constraints == f.interface_constraints)));
 }
 
 
@@ -469,8 +469,10 @@ FE_Enriched<dim, spacedim>::initialize(
   // restriction and prolongation matrices are built on demand
 
   // now set up the interface constraints for h-refinement.
-  // take them from fe_system:
-  this->interface_constraints = fe_system->interface_constraints;
+  // take them from fe_system (whose constraints() function builds the
+  // matrix on first access):
+  if (fe_system->constraints_are_implemented())
+    this->interface_constraints = fe_system->constraints();
 
   // if we just wrap another FE (i.e. use FE_Nothing as a second FE)
   // then it makes sense to have support points.
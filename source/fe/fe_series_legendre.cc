@@ -314,6 +314,63 @@ namespace FESeries
 
     legendre_coefficients.fill(unrolled_coefficients.begin());
   }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Number>
+  void
+  Legendre<dim, spacedim>::calculate(
+    const std::vector<dealii::Vector<Number>> &local_dof_values,
+    const unsigned int                         cell_active_fe_index,
+    std::vector<Table<dim, CoefficientType>>  &legendre_coefficients)
+  {
+    AssertDimension(local_dof_values.size(), legendre_coefficients.size());
+
+    const unsigned int n_cells = local_dof_values.size();
+    if (n_cells == 0)
+      return;
+
+    ensure_existence(n_coefficients_per_direction,
+                     *fe_collection,
+                     q_collection,
+                     cell_active_fe_index,
+                     component,
+                     legendre_transform_matrices);
+
+    const FullMatrix<CoefficientType> &matrix =
+      legendre_transform_matrices[cell_active_fe_index];
+
+    // gather the local degrees of freedom of all cells into the columns of
+    // one matrix, such that the expansion of the whole batch becomes a
+    // single matrix-matrix product
+    FullMatrix<CoefficientType> batched_values(matrix.n(), n_cells);
+    for (unsigned int b = 0; b < n_cells; ++b)
+      {
+        Assert(local_dof_values[b].size() == matrix.n(),
+               ExcDimensionMismatch(local_dof_values[b].size(), matrix.n()));
+
+        for (unsigned int j = 0; j < matrix.n(); ++j)
+          batched_values(j, b) = local_dof_values[b][j];
+      }
+
+    FullMatrix<CoefficientType> batched_coefficients(matrix.m(), n_cells);
+    matrix.mmult(batched_coefficients, batched_values);
+
+    // scatter the columns back into the coefficient tables
+    std::vector<CoefficientType> coefficients(matrix.m());
+    for (unsigned int b = 0; b < n_cells; ++b)
+      {
+        for (unsigned int d = 0; d < dim; ++d)
+          AssertDimension(legendre_coefficients[b].size(d),
+                          n_coefficients_per_direction[cell_active_fe_index]);
+
+        for (unsigned int i = 0; i < matrix.m(); ++i)
+          coefficients[i] = batched_coefficients(i, b);
+
+        legendre_coefficients[b].fill(coefficients.begin());
+      }
+  }
 } // namespace FESeries
 
 
@@ -1026,6 +1026,50 @@ FESystem<dim, spacedim>::get_prolongation_matrix(
 }
 
 
+
+template <int dim, int spacedim>
+const FullMatrix<double> &
+FESystem<dim, spacedim>::constraints(
+  const internal::SubfaceCase<dim> &subface_case) const
+{
+  // initialization upon first request, analogous to the restriction and
+  // prolongation matrices above
+  if ((this->interface_constraints.m() == 0) &&
+      constraints_are_implemented(subface_case))
+    {
+      std::lock_guard<std::mutex> lock(interface_constraints_mutex);
+
+      // check if updated while waiting for lock
+      if (this->interface_constraints.m() == 0)
+        const_cast<FESystem<dim, spacedim> *>(this)
+          ->build_interface_constraints();
+    }
+
+  return FiniteElement<dim, spacedim>::constraints(subface_case);
+}
+
+
+
+template <int dim, int spacedim>
+bool
+FESystem<dim, spacedim>::constraints_are_implemented(
+  const internal::SubfaceCase<dim> &subface_case) const
+{
+  if (subface_case != internal::SubfaceCase<dim>::case_isotropic)
+    return false;
+
+  // the composed element can provide an interface constraint matrix if
+  // and only if all of its base elements can; this mirrors the early
+  // return in build_interface_constraints() and avoids building the
+  // matrix just to answer the question
+  for (unsigned int base = 0; base < this->n_base_elements(); ++base)
+    if (base_element(base).constraints_are_implemented() == false)
+      return false;
+
+  return true;
+}
+
+
 template <int dim, int spacedim>
 unsigned int
 FESystem<dim, spacedim>::face_to_cell_index(
@@ -1801,15 +1845,12 @@ FESystem<dim, spacedim>::initialize(
       }
   }
 
-  // now initialize interface constraints, support points, and other tables.
-  // (restriction and prolongation matrices are only built on demand.) do
-  // this in parallel
+  // now initialize support points and other tables. (restriction,
+  // prolongation, and interface constraint matrices are only built on
+  // demand.) do this in parallel
 
   Threads::TaskGroup<> init_tasks;
 
-  init_tasks +=
-    Threads::new_task([&]() { this->build_interface_constraints(); });
-
   init_tasks += Threads::new_task([&]() {
     // if one of the base elements has no support points, then it makes no sense
     // to define support points for the composed element, so return an empty
@@ -0,0 +1,148 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/memory_consumption.h>
+
+#include <deal.II/fe/fe_values_batch.h>
+
+#include <deal.II/grid/reference_cell.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+template <int dim, int spacedim>
+FEValuesBatch<dim, spacedim>::FEValuesBatch(
+  const Mapping<dim, spacedim>       &mapping,
+  const FiniteElement<dim, spacedim> &fe,
+  const Quadrature<dim>              &quadrature,
+  const UpdateFlags                   update_flags)
+  : n_quadrature_points(quadrature.size())
+  , dofs_per_cell(fe.n_dofs_per_cell())
+  , n_filled_lanes_of_batch(0)
+{
+  fe_values.reserve(n_lanes);
+  for (unsigned int v = 0; v < n_lanes; ++v)
+    fe_values.emplace_back(std::make_unique<FEValues<dim, spacedim>>(
+      mapping, fe, quadrature, update_flags));
+
+  // allocate the batched tables once; their sizes do not change between
+  // calls to reinit()
+  const UpdateFlags flags = fe_values[0]->get_update_flags();
+  if (flags & update_values)
+    batched_shape_values.reinit(dofs_per_cell, n_quadrature_points);
+  if (flags & update_gradients)
+    batched_shape_gradients.reinit(dofs_per_cell, n_quadrature_points);
+  if (flags & update_JxW_values)
+    batched_JxW_values.resize(n_quadrature_points);
+  if (flags & update_quadrature_points)
+    batched_quadrature_points.resize(n_quadrature_points);
+}
+
+
+
+template <int dim, int spacedim>
+FEValuesBatch<dim, spacedim>::FEValuesBatch(
+  const FiniteElement<dim, spacedim> &fe,
+  const Quadrature<dim>              &quadrature,
+  const UpdateFlags                   update_flags)
+  : FEValuesBatch(fe.reference_cell()
+                    .template get_default_linear_mapping<dim, spacedim>(),
+                  fe,
+                  quadrature,
+                  update_flags)
+{}
+
+
+
+template <int dim, int spacedim>
+void
+FEValuesBatch<dim, spacedim>::fill_batched_tables()
+{
+  const UpdateFlags flags = fe_values[0]->get_update_flags();
+
+  // transpose the per-lane data into the vectorized tables. The shape
+  // values are gathered across the lanes as well since they may differ
+  // from cell to cell for mapping-dependent (non-affine conforming)
+  // elements.
+  if (flags & update_values)
+    for (unsigned int i = 0; i < dofs_per_cell; ++i)
+      for (unsigned int q = 0; q < n_quadrature_points; ++q)
+        {
+          VectorizedArrayType value;
+          for (unsigned int v = 0; v < n_lanes; ++v)
+            value[v] = fe_values[v]->shape_value(i, q);
+          batched_shape_values(i, q) = value;
+        }
+
+  if (flags & update_gradients)
+    for (unsigned int i = 0; i < dofs_per_cell; ++i)
+      for (unsigned int q = 0; q < n_quadrature_points; ++q)
+        {
+          Tensor<1, spacedim, VectorizedArrayType> gradient;
+          for (unsigned int v = 0; v < n_lanes; ++v)
+            {
+              const Tensor<1, spacedim> lane_gradient =
+                fe_values[v]->shape_grad(i, q);
+              for (unsigned int d = 0; d < spacedim; ++d)
+                gradient[d][v] = lane_gradient[d];
+            }
+          batched_shape_gradients(i, q) = gradient;
+        }
+
+  if (flags & update_JxW_values)
+    for (unsigned int q = 0; q < n_quadrature_points; ++q)
+      {
+        VectorizedArrayType weight;
+        for (unsigned int v = 0; v < n_lanes; ++v)
+          weight[v] = fe_values[v]->JxW(q);
+        batched_JxW_values[q] = weight;
+      }
+
+  if (flags & update_quadrature_points)
+    for (unsigned int q = 0; q < n_quadrature_points; ++q)
+      {
+        Point<spacedim, VectorizedArrayType> point;
+        for (unsigned int v = 0; v < n_lanes; ++v)
+          {
+            const Point<spacedim> lane_point =
+              fe_values[v]->quadrature_point(q);
+            for (unsigned int d = 0; d < spacedim; ++d)
+              point[d][v] = lane_point[d];
+          }
+        batched_quadrature_points[q] = point;
+      }
+}
+
+
+
+template <int dim, int spacedim>
+std::size_t
+FEValuesBatch<dim, spacedim>::memory_consumption() const
+{
+  std::size_t memory = sizeof(*this);
+  for (unsigned int v = 0; v < n_lanes; ++v)
+    memory += fe_values[v]->memory_consumption();
+  memory += batched_shape_values.memory_consumption();
+  memory += batched_shape_gradients.memory_consumption();
+  memory += batched_JxW_values.memory_consumption();
+  memory += batched_quadrature_points.memory_consumption();
+  return memory;
+}
+
+
+/*------------------------------- Explicit Instantiations -------------*/
+
+#include "fe_values_batch.inst"
+
+DEAL_II_NAMESPACE_CLOSE
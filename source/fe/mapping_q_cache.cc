@@ -30,6 +30,7 @@
 #include <deal.II/lac/trilinos_vector.h>
 
 #include <functional>
+#include <type_traits>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -309,23 +310,54 @@ MappingQCache<dim, spacedim>::initialize(
       FETools::hierarchic_to_lexicographic_numbering<spacedim>(
         this->get_degree()));
 
-  // Step 1: copy global vector so that the ghost values are such that the
-  // cache can be set up for all ghost cells
+  // Step 1: provide a vector whose ghost values are set up such that the
+  // cache can be set up for all ghost cells. If the given vector already
+  // stores all locally relevant entries, read from it directly; otherwise,
+  // copy the vector and import the ghost values. The first case avoids a
+  // communication step, which matters if the cache is rebuilt in every time
+  // step from an already ghosted solution vector.
   LinearAlgebra::distributed::Vector<typename VectorType::value_type>
                  vector_ghosted;
   const IndexSet locally_relevant_dofs =
     DoFTools::extract_locally_relevant_dofs(dof_handler);
-  vector_ghosted.reinit(dof_handler.locally_owned_dofs(),
-                        locally_relevant_dofs,
-                        dof_handler.get_communicator());
-  copy_locally_owned_data_from(vector, vector_ghosted);
-  vector_ghosted.update_ghost_values();
+
+  const LinearAlgebra::distributed::Vector<typename VectorType::value_type>
+    *vector_to_read = nullptr;
+  if constexpr (std::is_same_v<VectorType,
+                               LinearAlgebra::distributed::Vector<
+                                 typename VectorType::value_type>>)
+    if (vector.has_ghost_elements())
+      {
+        IndexSet needed_ghosts = locally_relevant_dofs;
+        needed_ghosts.subtract_set(dof_handler.locally_owned_dofs());
+        if ((needed_ghosts & vector.get_partitioner()->ghost_indices()) ==
+            needed_ghosts)
+          vector_to_read = &vector;
+      }
+
+  if (vector_to_read == nullptr)
+    {
+      vector_ghosted.reinit(dof_handler.locally_owned_dofs(),
+                            locally_relevant_dofs,
+                            dof_handler.get_communicator());
+      copy_locally_owned_data_from(vector, vector_ghosted);
+      vector_ghosted.update_ghost_values();
+      vector_to_read = &vector_ghosted;
+    }
 
   // FE and FEValues in the case they are needed
   FE_Nothing<dim, spacedim> fe_nothing;
   Threads::ThreadLocalStorage<std::unique_ptr<FEValues<dim, spacedim>>>
     fe_values_all;
 
+  // scratch arrays, kept across the cells worked on by each thread to avoid
+  // allocating memory on every cell
+  Threads::ThreadLocalStorage<std::vector<types::global_dof_index>>
+    dof_indices_all;
+  Threads::ThreadLocalStorage<
+    std::vector<Vector<typename VectorType::value_type>>>
+    values_all;
+
   // Interpolation of values is needed if we cannot just read off locations
   // from the solution vectors (as in the case of FE_Q and FE_DGQ with the
   // same polynomial degree as this class has).
@@ -422,8 +454,9 @@ MappingQCache<dim, spacedim>::initialize(
         {
           // case 1: FE_Q or FE_DGQ with same degree as this class has; this
           // is the simple case since no interpolation is needed
-          std::vector<types::global_dof_index> dof_indices(
-            fe.n_dofs_per_cell());
+          std::vector<types::global_dof_index> &dof_indices =
+            dof_indices_all.get();
+          dof_indices.resize(fe.n_dofs_per_cell());
           cell_dofs->get_dof_indices(dof_indices);
 
           for (unsigned int i = 0; i < dof_indices.size(); ++i)
@@ -435,20 +468,20 @@ MappingQCache<dim, spacedim>::initialize(
                   // case 1a: FE_Q
                   if (vector_describes_relative_displacement)
                     result[id.second][id.first] +=
-                      vector_ghosted(dof_indices[i]);
+                      (*vector_to_read)(dof_indices[i]);
                   else
                     result[id.second][id.first] =
-                      vector_ghosted(dof_indices[i]);
+                      (*vector_to_read)(dof_indices[i]);
                 }
               else
                 {
                   // case 1b: FE_DGQ
                   if (vector_describes_relative_displacement)
                     result[lexicographic_to_hierarchic_numbering[id.second]]
-                          [id.first] += vector_ghosted(dof_indices[i]);
+                          [id.first] += (*vector_to_read)(dof_indices[i]);
                   else
                     result[lexicographic_to_hierarchic_numbering[id.second]]
-                          [id.first] = vector_ghosted(dof_indices[i]);
+                          [id.first] = (*vector_to_read)(dof_indices[i]);
                 }
             }
         }
@@ -460,11 +493,11 @@ MappingQCache<dim, spacedim>::initialize(
           // MatrixFree/FEEvaluation
           auto &fe_values = fe_values_all.get();
 
-          std::vector<Vector<typename VectorType::value_type>> values(
-            fe_values->n_quadrature_points,
-            Vector<typename VectorType::value_type>(spacedim));
+          auto &values = values_all.get();
+          values.resize(fe_values->n_quadrature_points,
+                        Vector<typename VectorType::value_type>(spacedim));
 
-          fe_values->get_function_values(vector_ghosted, values);
+          fe_values->get_function_values(*vector_to_read, values);
 
           for (unsigned int q = 0; q < fe_values->n_quadrature_points; ++q)
             for (unsigned int c = 0; c < spacedim; ++c)
@@ -531,6 +564,13 @@ MappingQCache<dim, spacedim>::initialize(
   Threads::ThreadLocalStorage<std::unique_ptr<FEValues<dim, spacedim>>>
     fe_values_all;
 
+  // scratch arrays, kept across the cells worked on by each thread to avoid
+  // allocating memory on every cell
+  Threads::ThreadLocalStorage<std::vector<types::global_dof_index>>
+    dof_indices_all;
+  Threads::ThreadLocalStorage<std::vector<typename VectorType::value_type>>
+    dof_values_all;
+
   // Interpolation of values is needed if we cannot just read off locations
   // from the solution vectors (as in the case of FE_Q and FE_DGQ with the
   // same polynomial degree as this class has).
@@ -626,8 +666,9 @@ MappingQCache<dim, spacedim>::initialize(
         {
           // case 1: FE_Q or FE_DGQ with same degree as this class has; this
           // is the simple case since no interpolation is needed
-          std::vector<types::global_dof_index> dof_indices(
-            fe.n_dofs_per_cell());
+          std::vector<types::global_dof_index> &dof_indices =
+            dof_indices_all.get();
+          dof_indices.resize(fe.n_dofs_per_cell());
           cell_dofs->get_mg_dof_indices(dof_indices);
 
           for (unsigned int i = 0; i < dof_indices.size(); ++i)
@@ -666,12 +707,14 @@ MappingQCache<dim, spacedim>::initialize(
           // MatrixFree/FEEvaluation
           auto &fe_values = fe_values_all.get();
 
-          std::vector<types::global_dof_index> dof_indices(
-            fe.n_dofs_per_cell());
+          std::vector<types::global_dof_index> &dof_indices =
+            dof_indices_all.get();
+          dof_indices.resize(fe.n_dofs_per_cell());
           cell_dofs->get_mg_dof_indices(dof_indices);
 
-          std::vector<typename VectorType::value_type> dof_values(
-            fe.n_dofs_per_cell());
+          std::vector<typename VectorType::value_type> &dof_values =
+            dof_values_all.get();
+          dof_values.resize(fe.n_dofs_per_cell());
 
           for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
             dof_values[i] = vectors_ghosted[cell_tria->level()](dof_indices[i]);
@@ -695,6 +738,43 @@ MappingQCache<dim, spacedim>::initialize(
 
 
 
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::update(
+  const typename Triangulation<dim, spacedim>::cell_iterator &begin,
+  const typename Triangulation<dim, spacedim>::cell_iterator &end,
+  const std::function<std::vector<Point<spacedim>>(
+    const typename Triangulation<dim, spacedim>::cell_iterator &)>
+    &compute_points_on_cell)
+{
+  Assert(support_point_cache.get() != nullptr,
+         ExcMessage("Must call MappingQCache::initialize() before "
+                    "updating individual cells or after mesh has changed!"));
+
+  WorkStream::run(
+    begin,
+    end,
+    [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+        void *,
+        void *) {
+      AssertIndexRange(cell->level(), support_point_cache->size());
+      AssertIndexRange(cell->index(),
+                       (*support_point_cache)[cell->level()].size());
+      (*support_point_cache)[cell->level()][cell->index()] =
+        compute_points_on_cell(cell);
+      AssertDimension(
+        (*support_point_cache)[cell->level()][cell->index()].size(),
+        Utilities::pow(this->get_degree() + 1, dim));
+    },
+    /* copier */ std::function<void(void *)>(),
+    /* scratch_data */ nullptr,
+    /* copy_data */ nullptr,
+    2 * MultithreadInfo::n_threads(),
+    /* chunk_size = */ 1);
+}
+
+
+
 template <int dim, int spacedim>
 std::size_t
 MappingQCache<dim, spacedim>::memory_consumption() const
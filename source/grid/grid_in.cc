@@ -25,6 +25,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/io/ios_state.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 #include <boost/serialization/serialization.hpp>
@@ -33,6 +35,13 @@
 #  include <gmsh.h>
 #endif
 
+#ifdef DEAL_II_HAVE_UNISTD_H
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <cctype>
 #include <fstream>
@@ -162,6 +171,8 @@ template <int dim, int spacedim>
 void
 GridIn<dim, spacedim>::read_vtk(std::istream &in)
 {
+  cell_data.clear();
+
   std::string line;
 
   // verify that the first, third and fourth lines match
@@ -456,35 +467,34 @@ GridIn<dim, spacedim>::read_vtk(std::istream &in)
                                      subcelldata.boundary_lines.size()) +
                                    ") in 2d."));
 
-            const std::vector<std::string> data_sets{"MaterialID",
-                                                     "ManifoldID"};
-
-            for (unsigned int i = 0; i < data_sets.size(); ++i)
+            // Walk over the SCALARS data sets in the CELL_DATA section. The
+            // MaterialID and ManifoldID fields are interpreted directly and
+            // stored in the cell and subcell data objects; all other fields
+            // are recorded verbatim in the cell_data map so that callers can
+            // retrieve them via get_cell_data(). Stop when we run into the
+            // POINT_DATA section (or the end of the file).
+            while (in >> keyword)
               {
-                // Ignore everything until we get to a SCALARS data set
-                while (in >> keyword)
-                  if (keyword == "SCALARS")
-                    {
-                      // Now see if we know about this type of data set,
-                      // if not, just ignore everything till the next SCALARS
-                      // keyword
-                      std::string field_name;
-                      in >> field_name;
-                      if (std::find(data_sets.begin(),
-                                    data_sets.end(),
-                                    field_name) == data_sets.end())
-                        // The data set here is not one of the ones we know, so
-                        // keep ignoring everything until the next SCALARS
-                        // keyword.
-                        continue;
-
-                      // Now we got somewhere. Proceed from here, assert
-                      // that the type of the table is int, and ignore the
-                      // rest of the line.
-                      // SCALARS MaterialID int 1
-                      // (the last number is optional)
-                      std::string line;
-                      std::getline(in, line);
+                if (keyword == "POINT_DATA")
+                  break;
+                else if (keyword == "SCALARS")
+                  {
+                    std::string field_name;
+                    in >> field_name;
+
+                    const bool is_id_field = (field_name == "MaterialID" ||
+                                              field_name == "ManifoldID");
+
+                    // The rest of the line contains the data type of the
+                    // table and an optional number of components. Material
+                    // and manifold ids have to be integers; for all other
+                    // fields we accept any type whose values can be read as
+                    // a double.
+                    // SCALARS MaterialID int 1
+                    // (the last number is optional)
+                    std::string line;
+                    std::getline(in, line);
+                    if (is_id_field)
                       AssertThrow(
                         line.substr(1,
                                     std::min(static_cast<std::size_t>(3),
@@ -492,83 +502,100 @@ GridIn<dim, spacedim>::read_vtk(std::istream &in)
                         ExcMessage(
                           "While reading VTK file, material- and manifold IDs can only have type 'int'."));
 
-                      in >> keyword;
-                      AssertThrow(
-                        keyword == "LOOKUP_TABLE",
-                        ExcMessage(
-                          "While reading VTK file, missing keyword 'LOOKUP_TABLE'."));
+                    in >> keyword;
+                    AssertThrow(
+                      keyword == "LOOKUP_TABLE",
+                      ExcMessage(
+                        "While reading VTK file, missing keyword 'LOOKUP_TABLE'."));
 
-                      in >> keyword;
-                      AssertThrow(
-                        keyword == "default",
-                        ExcMessage(
-                          "While reading VTK file, missing keyword 'default'."));
-
-                      // read material or manifold ids first for all cells,
-                      // then for all faces, and finally for all lines. the
-                      // assumption that cells come before all faces and
-                      // lines has been verified above via an assertion, so
-                      // the order used in the following blocks makes sense
-                      for (unsigned int i = 0; i < cells.size(); ++i)
-                        {
-                          int id;
-                          in >> id;
-                          if (field_name == "MaterialID")
-                            cells[i].material_id =
-                              static_cast<types::material_id>(id);
-                          else if (field_name == "ManifoldID")
-                            cells[i].manifold_id =
-                              static_cast<types::manifold_id>(id);
-                          else
-                            DEAL_II_ASSERT_UNREACHABLE();
-                        }
+                    in >> keyword;
+                    AssertThrow(
+                      keyword == "default",
+                      ExcMessage(
+                        "While reading VTK file, missing keyword 'default'."));
 
-                      if (dim == 3)
-                        {
-                          for (auto &boundary_quad : subcelldata.boundary_quads)
-                            {
-                              int id;
-                              in >> id;
-                              if (field_name == "MaterialID")
-                                boundary_quad.material_id =
-                                  static_cast<types::material_id>(id);
-                              else if (field_name == "ManifoldID")
-                                boundary_quad.manifold_id =
-                                  static_cast<types::manifold_id>(id);
-                              else
-                                DEAL_II_ASSERT_UNREACHABLE();
-                            }
-                          for (auto &boundary_line : subcelldata.boundary_lines)
-                            {
-                              int id;
-                              in >> id;
-                              if (field_name == "MaterialID")
-                                boundary_line.material_id =
-                                  static_cast<types::material_id>(id);
-                              else if (field_name == "ManifoldID")
-                                boundary_line.manifold_id =
-                                  static_cast<types::manifold_id>(id);
-                              else
-                                DEAL_II_ASSERT_UNREACHABLE();
-                            }
-                        }
-                      else if (dim == 2)
-                        {
-                          for (auto &boundary_line : subcelldata.boundary_lines)
-                            {
-                              int id;
-                              in >> id;
-                              if (field_name == "MaterialID")
-                                boundary_line.material_id =
-                                  static_cast<types::material_id>(id);
-                              else if (field_name == "ManifoldID")
-                                boundary_line.manifold_id =
-                                  static_cast<types::manifold_id>(id);
-                              else
-                                DEAL_II_ASSERT_UNREACHABLE();
-                            }
-                        }
-                    }
+                    if (is_id_field == false)
+                      {
+                        // a generic cell data field: store the values
+                        // attached to the cells and skip over the values
+                        // attached to the boundary faces and edges
+                        std::vector<double> &values = cell_data[field_name];
+                        values.resize(cells.size());
+                        for (unsigned int i = 0; i < cells.size(); ++i)
+                          in >> values[i];
+
+                        double dummy;
+                        for (unsigned int i = cells.size(); i < n_ids; ++i)
+                          in >> dummy;
+
+                        continue;
+                      }
+
+                    // read material or manifold ids first for all cells,
+                    // then for all faces, and finally for all lines. the
+                    // assumption that cells come before all faces and
+                    // lines has been verified above via an assertion, so
+                    // the order used in the following blocks makes sense
+                    for (unsigned int i = 0; i < cells.size(); ++i)
+                      {
+                        int id;
+                        in >> id;
+                        if (field_name == "MaterialID")
+                          cells[i].material_id =
+                            static_cast<types::material_id>(id);
+                        else if (field_name == "ManifoldID")
+                          cells[i].manifold_id =
+                            static_cast<types::manifold_id>(id);
+                        else
+                          DEAL_II_ASSERT_UNREACHABLE();
+                      }
+
+                    if (dim == 3)
+                      {
+                        for (auto &boundary_quad : subcelldata.boundary_quads)
+                          {
+                            int id;
+                            in >> id;
+                            if (field_name == "MaterialID")
+                              boundary_quad.material_id =
+                                static_cast<types::material_id>(id);
+                            else if (field_name == "ManifoldID")
+                              boundary_quad.manifold_id =
+                                static_cast<types::manifold_id>(id);
+                            else
+                              DEAL_II_ASSERT_UNREACHABLE();
+                          }
+                        for (auto &boundary_line : subcelldata.boundary_lines)
+                          {
+                            int id;
+                            in >> id;
+                            if (field_name == "MaterialID")
+                              boundary_line.material_id =
+                                static_cast<types::material_id>(id);
+                            else if (field_name == "ManifoldID")
+                              boundary_line.manifold_id =
+                                static_cast<types::manifold_id>(id);
+                            else
+                              DEAL_II_ASSERT_UNREACHABLE();
+                          }
+                      }
+                    else if (dim == 2)
+                      {
+                        for (auto &boundary_line : subcelldata.boundary_lines)
+                          {
+                            int id;
+                            in >> id;
+                            if (field_name == "MaterialID")
+                              boundary_line.material_id =
+                                static_cast<types::material_id>(id);
+                            else if (field_name == "ManifoldID")
+                              boundary_line.manifold_id =
+                                static_cast<types::manifold_id>(id);
+                            else
+                              DEAL_II_ASSERT_UNREACHABLE();
+                          }
+                      }
+                  }
               }
           }
 
@@ -583,6 +610,15 @@ GridIn<dim, spacedim>::read_vtk(std::istream &in)
 
 
 
+template <int dim, int spacedim>
+const std::map<std::string, std::vector<double>> &
+GridIn<dim, spacedim>::get_cell_data() const
+{
+  return cell_data;
+}
+
+
+
 template <int dim, int spacedim>
 void
 GridIn<dim, spacedim>::read_vtu(std::istream &in)
@@ -4171,6 +4207,56 @@ GridIn<dim, spacedim>::read(const std::string &filename, Format format)
     }
   else
     {
+#ifdef DEAL_II_HAVE_UNISTD_H
+      // On POSIX systems, map the file into memory and parse from the mapped
+      // pages through a zero-copy array stream. This avoids the buffering
+      // layer of std::ifstream, which dominates the run time when reading
+      // large meshes, and does not increase the resident memory beyond the
+      // pages actually touched. If anything goes wrong (e.g., the name does
+      // not refer to a regular file), fall back to the plain stream path.
+      const int fd = ::open(name.c_str(), O_RDONLY);
+      if (fd != -1)
+        {
+          struct stat file_info;
+          if (::fstat(fd, &file_info) == 0 && S_ISREG(file_info.st_mode) &&
+              file_info.st_size > 0)
+            {
+              void *mapped = ::mmap(nullptr,
+                                    file_info.st_size,
+                                    PROT_READ,
+                                    MAP_PRIVATE,
+                                    fd,
+                                    0);
+              if (mapped != MAP_FAILED)
+                {
+                  // advise the kernel that we are going to read the file
+                  // front to back so that it can prefetch aggressively
+#  ifdef POSIX_MADV_SEQUENTIAL
+                  ::posix_madvise(mapped,
+                                  file_info.st_size,
+                                  POSIX_MADV_SEQUENTIAL);
+#  endif
+                  boost::iostreams::stream<boost::iostreams::array_source> in(
+                    static_cast<const char *>(mapped), file_info.st_size);
+                  try
+                    {
+                      read(in, format);
+                    }
+                  catch (...)
+                    {
+                      ::munmap(mapped, file_info.st_size);
+                      ::close(fd);
+                      throw;
+                    }
+                  ::munmap(mapped, file_info.st_size);
+                  ::close(fd);
+                  return;
+                }
+            }
+          ::close(fd);
+        }
+#endif
+
       std::ifstream in(name);
       read(in, format);
     }
@@ -21,6 +21,7 @@
 
 #ifdef DEAL_II_WITH_ARBORX
 #  include <deal.II/arborx/access_traits.h>
+#  include <deal.II/arborx/bvh.h>
 #  include <deal.II/arborx/distributed_tree.h>
 #else
 template <int dim, typename Number>
@@ -3515,6 +3516,150 @@ namespace GridTools
 
 
 
+  template <int dim, int spacedim>
+#ifndef DOXYGEN
+  std::tuple<
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>,
+    std::vector<std::vector<Point<dim>>>,
+    std::vector<std::vector<unsigned int>>,
+    std::vector<unsigned int>>
+#else
+  return_type
+#endif
+  compute_point_locations_batched(
+    const Cache<dim, spacedim>         &cache,
+    const std::vector<Point<spacedim>> &points,
+    const double                        tolerance)
+  {
+    Assert((dim == spacedim),
+           ExcMessage("Only implemented for dim==spacedim."));
+
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+                                           cells_out;
+    std::vector<std::vector<Point<dim>>>   qpoints_out;
+    std::vector<std::vector<unsigned int>> maps_out;
+    std::vector<unsigned int>              missing_points_out;
+
+#ifndef DEAL_II_WITH_ARBORX
+    (void)cache;
+    (void)points;
+    (void)tolerance;
+    AssertThrow(false,
+                ExcMessage(
+                  "GridTools::compute_point_locations_batched() requires "
+                  "deal.II to be configured with ArborX."));
+#else
+    const unsigned int np = points.size();
+    if (np == 0)
+      return std::make_tuple(std::move(cells_out),
+                             std::move(qpoints_out),
+                             std::move(maps_out),
+                             std::move(missing_points_out));
+
+    const auto &mapping = cache.get_mapping();
+
+    // Collect all non-artificial cells together with their bounding boxes,
+    // which form the primitives of the bounding volume hierarchy.
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+                                       all_cells;
+    std::vector<BoundingBox<spacedim>> cell_boxes;
+    for (const auto &cell :
+         cache.get_triangulation().active_cell_iterators())
+      if (cell->is_artificial() == false)
+        {
+          all_cells.push_back(cell);
+          cell_boxes.push_back(mapping.get_bounding_box(cell));
+        }
+
+    ArborXWrappers::BVH bvh(cell_boxes);
+
+    // Query the candidate cells of all points in one sweep. The query boxes
+    // are slightly enlarged to compensate for the tolerance of the inverse
+    // mapping and the single-precision arithmetic inside ArborX.
+    std::vector<BoundingBox<spacedim>> query_boxes;
+    query_boxes.reserve(np);
+    for (const auto &point : points)
+      query_boxes.emplace_back(
+        BoundingBox<spacedim>(point).create_extended(tolerance));
+
+    ArborXWrappers::BoundingBoxIntersectPredicate bb_intersect(query_boxes);
+    const auto &[candidate_indices, candidate_offsets] =
+      bvh.query(bb_intersect);
+
+    // Invert the candidate lists: for each cell, the ids of the points whose
+    // query boxes intersect its bounding box. This groups the expensive
+    // inverse mapping by cell, so that all points of a cell can be processed
+    // in one vectorized batch.
+    std::vector<std::vector<unsigned int>> candidates_per_cell(
+      all_cells.size());
+    for (unsigned int i = 0; i < np; ++i)
+      for (int j = candidate_offsets[i]; j < candidate_offsets[i + 1]; ++j)
+        candidates_per_cell[candidate_indices[j]].push_back(i);
+
+    std::vector<bool> found_points(np, false);
+
+    std::vector<Point<spacedim>> cell_real_points;
+    std::vector<Point<dim>>      cell_unit_points;
+    for (unsigned int c = 0; c < all_cells.size(); ++c)
+      {
+        // Only consider the points that have not been assigned to a
+        // previously visited cell.
+        std::vector<unsigned int> ids;
+        for (const unsigned int i : candidates_per_cell[c])
+          if (found_points[i] == false)
+            ids.push_back(i);
+
+        if (ids.empty())
+          continue;
+
+        cell_real_points.clear();
+        for (const unsigned int i : ids)
+          cell_real_points.push_back(points[i]);
+        cell_unit_points.resize(cell_real_points.size());
+
+        mapping.transform_points_real_to_unit_cell(
+          all_cells[c],
+          make_array_view(cell_real_points),
+          make_array_view(cell_unit_points));
+
+        std::vector<Point<dim>>   cell_qpoints;
+        std::vector<unsigned int> cell_maps;
+        const auto reference_cell = all_cells[c]->reference_cell();
+        for (unsigned int k = 0; k < ids.size(); ++k)
+          if (cell_unit_points[k][0] !=
+                std::numeric_limits<double>::infinity() &&
+              reference_cell.contains_point(cell_unit_points[k], tolerance))
+            {
+              cell_qpoints.push_back(
+                reference_cell.closest_point(cell_unit_points[k]));
+              cell_maps.push_back(ids[k]);
+              found_points[ids[k]] = true;
+            }
+
+        if (cell_qpoints.size() > 0)
+          {
+            cells_out.push_back(all_cells[c]);
+            qpoints_out.push_back(std::move(cell_qpoints));
+            maps_out.push_back(std::move(cell_maps));
+          }
+      }
+
+    for (unsigned int i = 0; i < np; ++i)
+      if (found_points[i] == false)
+        missing_points_out.push_back(i);
+
+    AssertDimension(cells_out.size(), maps_out.size());
+    AssertDimension(cells_out.size(), qpoints_out.size());
+#endif
+
+    return std::make_tuple(std::move(cells_out),
+                           std::move(qpoints_out),
+                           std::move(maps_out),
+                           std::move(missing_points_out));
+  }
+
+
+
   template <int dim, int spacedim>
 #ifndef DOXYGEN
   std::tuple<
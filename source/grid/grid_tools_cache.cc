@@ -14,11 +14,14 @@
 
 #include <deal.II/base/bounding_box.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
+#include <mutex>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace GridTools
@@ -49,7 +52,44 @@ namespace GridTools
   void
   Cache<dim, spacedim>::mark_for_update(const CacheUpdateFlags &flags)
   {
-    update_flags |= flags;
+    update_flags.fetch_or(static_cast<unsigned int>(flags));
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::warm_up(const CacheUpdateFlags &flags) const
+  {
+    Threads::TaskGroup<> tasks;
+
+    if (flags & update_vertex_to_cell_map)
+      tasks += Threads::new_task([&]() { get_vertex_to_cell_map(); });
+    // The flag for the cell center directions also contains the bit of the
+    // vertex-to-cell map it depends on, so compare against the full mask:
+    if ((flags & update_vertex_to_cell_centers_directions) ==
+        update_vertex_to_cell_centers_directions)
+      tasks +=
+        Threads::new_task([&]() { get_vertex_to_cell_centers_directions(); });
+    if (flags & update_used_vertices)
+      tasks += Threads::new_task([&]() { get_used_vertices(); });
+    if (flags & update_used_vertices_rtree)
+      tasks += Threads::new_task([&]() { get_used_vertices_rtree(); });
+    if (flags & update_cell_bounding_boxes_rtree)
+      tasks += Threads::new_task([&]() { get_cell_bounding_boxes_rtree(); });
+    if (flags & update_locally_owned_cell_bounding_boxes_rtree)
+      tasks += Threads::new_task(
+        [&]() { get_locally_owned_cell_bounding_boxes_rtree(); });
+    if (flags & update_vertex_to_neighbor_subdomain)
+      tasks += Threads::new_task([&]() { get_vertex_to_neighbor_subdomain(); });
+    if (flags & update_vertex_with_ghost_neighbors)
+      tasks +=
+        Threads::new_task([&]() { get_vertices_with_ghost_neighbors(); });
+
+    // The covering rtree is deliberately not built here: doing so requires
+    // collective MPI communication, which must not happen on a task.
+
+    tasks.join_all();
   }
 
 
@@ -59,10 +99,18 @@ namespace GridTools
     std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>> &
   Cache<dim, spacedim>::get_vertex_to_cell_map() const
   {
-    if (update_flags & update_vertex_to_cell_map)
+    if (update_flags.load(std::memory_order_acquire) &
+        update_vertex_to_cell_map)
       {
-        vertex_to_cells = GridTools::vertex_to_cell_map(*tria);
-        update_flags    = update_flags & ~update_vertex_to_cell_map;
+        std::lock_guard<std::mutex> lock(vertex_to_cells_mutex);
+        if (update_flags.load(std::memory_order_relaxed) &
+            update_vertex_to_cell_map)
+          {
+            vertex_to_cells = GridTools::vertex_to_cell_map(*tria);
+            update_flags.fetch_and(static_cast<unsigned int>(
+                                     ~update_vertex_to_cell_map),
+                                   std::memory_order_release);
+          }
       }
     return vertex_to_cells;
   }
@@ -73,11 +121,20 @@ namespace GridTools
   const std::vector<std::vector<Tensor<1, spacedim>>> &
   Cache<dim, spacedim>::get_vertex_to_cell_centers_directions() const
   {
-    if (update_flags & update_vertex_to_cell_centers_directions)
+    if (update_flags.load(std::memory_order_acquire) &
+        update_vertex_to_cell_centers_directions)
       {
-        vertex_to_cell_centers = GridTools::vertex_to_cell_centers_directions(
-          *tria, get_vertex_to_cell_map());
-        update_flags = update_flags & ~update_vertex_to_cell_centers_directions;
+        std::lock_guard<std::mutex> lock(vertex_to_cell_centers_mutex);
+        if (update_flags.load(std::memory_order_relaxed) &
+            update_vertex_to_cell_centers_directions)
+          {
+            vertex_to_cell_centers =
+              GridTools::vertex_to_cell_centers_directions(
+                *tria, get_vertex_to_cell_map());
+            update_flags.fetch_and(static_cast<unsigned int>(
+                                     ~update_vertex_to_cell_centers_directions),
+                                   std::memory_order_release);
+          }
       }
     return vertex_to_cell_centers;
   }
@@ -88,10 +145,17 @@ namespace GridTools
   const std::map<unsigned int, Point<spacedim>> &
   Cache<dim, spacedim>::get_used_vertices() const
   {
-    if (update_flags & update_used_vertices)
+    if (update_flags.load(std::memory_order_acquire) & update_used_vertices)
       {
-        used_vertices = GridTools::extract_used_vertices(*tria, *mapping);
-        update_flags  = update_flags & ~update_used_vertices;
+        std::lock_guard<std::mutex> lock(used_vertices_mutex);
+        if (update_flags.load(std::memory_order_relaxed) &
+            update_used_vertices)
+          {
+            used_vertices = GridTools::extract_used_vertices(*tria, *mapping);
+            update_flags.fetch_and(static_cast<unsigned int>(
+                                     ~update_used_vertices),
+                                   std::memory_order_release);
+          }
       }
     return used_vertices;
   }
@@ -102,16 +166,24 @@ namespace GridTools
   const RTree<std::pair<Point<spacedim>, unsigned int>> &
   Cache<dim, spacedim>::get_used_vertices_rtree() const
   {
-    if (update_flags & update_used_vertices_rtree)
+    if (update_flags.load(std::memory_order_acquire) &
+        update_used_vertices_rtree)
       {
-        const auto &used_vertices = get_used_vertices();
-        std::vector<std::pair<Point<spacedim>, unsigned int>> vertices(
-          used_vertices.size());
-        unsigned int i = 0;
-        for (const auto &it : used_vertices)
-          vertices[i++] = std::make_pair(it.second, it.first);
-        used_vertices_rtree = pack_rtree(vertices);
-        update_flags        = update_flags & ~update_used_vertices_rtree;
+        std::lock_guard<std::mutex> lock(used_vertices_rtree_mutex);
+        if (update_flags.load(std::memory_order_relaxed) &
+            update_used_vertices_rtree)
+          {
+            const auto &used_vertices = get_used_vertices();
+            std::vector<std::pair<Point<spacedim>, unsigned int>> vertices(
+              used_vertices.size());
+            unsigned int i = 0;
+            for (const auto &it : used_vertices)
+              vertices[i++] = std::make_pair(it.second, it.first);
+            used_vertices_rtree = pack_rtree(vertices);
+            update_flags.fetch_and(static_cast<unsigned int>(
+                                     ~update_used_vertices_rtree),
+                                   std::memory_order_release);
+          }
       }
     return used_vertices_rtree;
   }
@@ -124,18 +196,26 @@ namespace GridTools
               typename Triangulation<dim, spacedim>::active_cell_iterator>> &
   Cache<dim, spacedim>::get_cell_bounding_boxes_rtree() const
   {
-    if (update_flags & update_cell_bounding_boxes_rtree)
+    if (update_flags.load(std::memory_order_acquire) &
+        update_cell_bounding_boxes_rtree)
       {
-        std::vector<std::pair<
-          BoundingBox<spacedim>,
-          typename Triangulation<dim, spacedim>::active_cell_iterator>>
-          boxes;
-        boxes.reserve(tria->n_active_cells());
-        for (const auto &cell : tria->active_cell_iterators())
-          boxes.emplace_back(mapping->get_bounding_box(cell), cell);
-
-        cell_bounding_boxes_rtree = pack_rtree(boxes);
-        update_flags = update_flags & ~update_cell_bounding_boxes_rtree;
+        std::lock_guard<std::mutex> lock(cell_bounding_boxes_rtree_mutex);
+        if (update_flags.load(std::memory_order_relaxed) &
+            update_cell_bounding_boxes_rtree)
+          {
+            std::vector<std::pair<
+              BoundingBox<spacedim>,
+              typename Triangulation<dim, spacedim>::active_cell_iterator>>
+              boxes;
+            boxes.reserve(tria->n_active_cells());
+            for (const auto &cell : tria->active_cell_iterators())
+              boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+
+            cell_bounding_boxes_rtree = pack_rtree(boxes);
+            update_flags.fetch_and(static_cast<unsigned int>(
+                                     ~update_cell_bounding_boxes_rtree),
+                                   std::memory_order_release);
+          }
       }
     return cell_bounding_boxes_rtree;
   }
@@ -148,25 +228,34 @@ namespace GridTools
               typename Triangulation<dim, spacedim>::active_cell_iterator>> &
   Cache<dim, spacedim>::get_locally_owned_cell_bounding_boxes_rtree() const
   {
-    if (update_flags & update_locally_owned_cell_bounding_boxes_rtree)
+    if (update_flags.load(std::memory_order_acquire) &
+        update_locally_owned_cell_bounding_boxes_rtree)
       {
-        std::vector<std::pair<
-          BoundingBox<spacedim>,
-          typename Triangulation<dim, spacedim>::active_cell_iterator>>
-          boxes;
-        if (const parallel::TriangulationBase<dim, spacedim> *parallel_tria =
-              dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
-                &*tria))
-          boxes.reserve(parallel_tria->n_locally_owned_active_cells());
-        else
-          boxes.reserve(tria->n_active_cells());
-        for (const auto &cell : tria->active_cell_iterators() |
-                                  IteratorFilters::LocallyOwnedCell())
-          boxes.emplace_back(mapping->get_bounding_box(cell), cell);
-
-        locally_owned_cell_bounding_boxes_rtree = pack_rtree(boxes);
-        update_flags =
-          update_flags & ~update_locally_owned_cell_bounding_boxes_rtree;
+        std::lock_guard<std::mutex> lock(
+          locally_owned_cell_bounding_boxes_rtree_mutex);
+        if (update_flags.load(std::memory_order_relaxed) &
+            update_locally_owned_cell_bounding_boxes_rtree)
+          {
+            std::vector<std::pair<
+              BoundingBox<spacedim>,
+              typename Triangulation<dim, spacedim>::active_cell_iterator>>
+              boxes;
+            if (const parallel::TriangulationBase<dim, spacedim>
+                  *parallel_tria = dynamic_cast<
+                    const parallel::TriangulationBase<dim, spacedim> *>(&*tria))
+              boxes.reserve(parallel_tria->n_locally_owned_active_cells());
+            else
+              boxes.reserve(tria->n_active_cells());
+            for (const auto &cell : tria->active_cell_iterators() |
+                                      IteratorFilters::LocallyOwnedCell())
+              boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+
+            locally_owned_cell_bounding_boxes_rtree = pack_rtree(boxes);
+            update_flags.fetch_and(
+              static_cast<unsigned int>(
+                ~update_locally_owned_cell_bounding_boxes_rtree),
+              std::memory_order_release);
+          }
       }
     return locally_owned_cell_bounding_boxes_rtree;
   }
@@ -177,7 +266,15 @@ namespace GridTools
   const RTree<std::pair<BoundingBox<spacedim>, unsigned int>> &
   Cache<dim, spacedim>::get_covering_rtree(const unsigned int level) const
   {
-    if (update_flags & update_covering_rtree ||
+    // Unlike the other data structures of this class, the covering rtree is
+    // a map that may grow by one entry for every requested level, so we
+    // cannot hand out references to existing entries while another thread
+    // inserts a new one. Hold the mutex for the whole function; given that
+    // building the tree involves collective MPI communication, concurrent
+    // calls with different arguments would be erroneous anyway.
+    std::lock_guard<std::mutex> lock(covering_rtree_mutex);
+
+    if (update_flags.load(std::memory_order_relaxed) & update_covering_rtree ||
         covering_rtree.find(level) == covering_rtree.end())
       {
         const auto boxes =
@@ -196,7 +293,9 @@ namespace GridTools
             covering_rtree[level] =
               GridTools::build_global_description_tree(boxes, MPI_COMM_SELF);
           }
-        update_flags = update_flags & ~update_covering_rtree;
+        update_flags.fetch_and(static_cast<unsigned int>(
+                                 ~update_covering_rtree),
+                               std::memory_order_release);
       }
 
     return covering_rtree[level];
@@ -206,18 +305,26 @@ namespace GridTools
   const std::vector<std::set<unsigned int>> &
   Cache<dim, spacedim>::get_vertex_to_neighbor_subdomain() const
   {
-    if (update_flags & update_vertex_to_neighbor_subdomain)
+    if (update_flags.load(std::memory_order_acquire) &
+        update_vertex_to_neighbor_subdomain)
       {
-        vertex_to_neighbor_subdomain.clear();
-        vertex_to_neighbor_subdomain.resize(tria->n_vertices());
-        for (const auto &cell : tria->active_cell_iterators())
+        std::lock_guard<std::mutex> lock(vertex_to_neighbor_subdomain_mutex);
+        if (update_flags.load(std::memory_order_relaxed) &
+            update_vertex_to_neighbor_subdomain)
           {
-            if (cell->is_ghost())
-              for (const unsigned int v : cell->vertex_indices())
-                vertex_to_neighbor_subdomain[cell->vertex_index(v)].insert(
-                  cell->subdomain_id());
+            vertex_to_neighbor_subdomain.clear();
+            vertex_to_neighbor_subdomain.resize(tria->n_vertices());
+            for (const auto &cell : tria->active_cell_iterators())
+              {
+                if (cell->is_ghost())
+                  for (const unsigned int v : cell->vertex_indices())
+                    vertex_to_neighbor_subdomain[cell->vertex_index(v)].insert(
+                      cell->subdomain_id());
+              }
+            update_flags.fetch_and(static_cast<unsigned int>(
+                                     ~update_vertex_to_neighbor_subdomain),
+                                   std::memory_order_release);
           }
-        update_flags = update_flags & ~update_vertex_to_neighbor_subdomain;
       }
     return vertex_to_neighbor_subdomain;
   }
@@ -226,12 +333,20 @@ namespace GridTools
   const std::map<unsigned int, std::set<types::subdomain_id>> &
   Cache<dim, spacedim>::get_vertices_with_ghost_neighbors() const
   {
-    if (update_flags & update_vertex_with_ghost_neighbors)
+    if (update_flags.load(std::memory_order_acquire) &
+        update_vertex_with_ghost_neighbors)
       {
-        vertices_with_ghost_neighbors =
-          GridTools::compute_vertices_with_ghost_neighbors(*tria);
+        std::lock_guard<std::mutex> lock(vertices_with_ghost_neighbors_mutex);
+        if (update_flags.load(std::memory_order_relaxed) &
+            update_vertex_with_ghost_neighbors)
+          {
+            vertices_with_ghost_neighbors =
+              GridTools::compute_vertices_with_ghost_neighbors(*tria);
 
-        update_flags = update_flags & ~update_vertex_with_ghost_neighbors;
+            update_flags.fetch_and(static_cast<unsigned int>(
+                                     ~update_vertex_with_ghost_neighbors),
+                                   std::memory_order_release);
+          }
       }
 
     return vertices_with_ghost_neighbors;
@@ -16,6 +16,7 @@
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/distributed/tria_base.h>
 
@@ -388,6 +389,136 @@ namespace GridTools
 
 
 
+  template <int dim>
+  MeshGeometryStatistics
+  compute_mesh_geometry_statistics(const Mapping<dim>       &mapping,
+                                   const Triangulation<dim> &triangulation,
+                                   const Quadrature<dim>    &quadrature)
+  {
+    const FE_Nothing<dim> fe;
+
+    // Each thread evaluates the mapping through its own FEValues object. The
+    // copy constructor creates an independent object initialized with the
+    // same mapping, element, and quadrature rule.
+    struct ScratchData
+    {
+      ScratchData(const Mapping<dim>       &mapping,
+                  const FiniteElement<dim> &fe,
+                  const Quadrature<dim>    &quadrature)
+        : fe_values(mapping,
+                    fe,
+                    quadrature,
+                    update_JxW_values | update_jacobians)
+      {}
+
+      ScratchData(const ScratchData &other)
+        : fe_values(other.fe_values.get_mapping(),
+                    other.fe_values.get_fe(),
+                    other.fe_values.get_quadrature(),
+                    update_JxW_values | update_jacobians)
+      {}
+
+      FEValues<dim> fe_values;
+    };
+
+    // The contribution of a single cell, merged into the global statistics
+    // by the sequentially running copier below. The default values are
+    // neutral with respect to the min/max/sum reductions, so cells that are
+    // not locally owned simply contribute nothing.
+    struct CopyData
+    {
+      double min_diameter = std::numeric_limits<double>::max();
+      double max_diameter = 0.;
+      double volume       = 0.;
+      double aspect_ratio = 0.;
+    };
+
+    const auto worker =
+      [&mapping,
+       &quadrature](const typename Triangulation<dim>::active_cell_iterator
+                      &cell,
+                    ScratchData &scratch,
+                    CopyData    &copy) {
+        // WorkStream reuses copy data objects, so reset to neutral values
+        // before filling them for this cell
+        copy = CopyData();
+
+        if (cell->is_locally_owned() == false)
+          return;
+
+        copy.min_diameter = copy.max_diameter = cell->diameter(mapping);
+
+        scratch.fe_values.reinit(cell);
+
+        for (unsigned int q = 0; q < quadrature.size(); ++q)
+          {
+            copy.volume += scratch.fe_values.JxW(q);
+
+            const Tensor<2, dim, double> jacobian =
+              Tensor<2, dim, double>(scratch.fe_values.jacobian(q));
+
+            // As in compute_aspect_ratio_of_cells(), inverted elements are
+            // not an error here; they show up as an infinite aspect ratio
+            // that survives the max operations below.
+            if (determinant(jacobian) <= 0)
+              {
+                copy.aspect_ratio = std::numeric_limits<double>::infinity();
+              }
+            else
+              {
+                LAPACKFullMatrix<double> J = LAPACKFullMatrix<double>(dim);
+                for (unsigned int i = 0; i < dim; ++i)
+                  for (unsigned int j = 0; j < dim; ++j)
+                    J(i, j) = jacobian[i][j];
+
+                J.compute_svd();
+
+                const double max_sv = J.singular_value(0);
+                const double min_sv = J.singular_value(dim - 1);
+
+                copy.aspect_ratio =
+                  std::max(copy.aspect_ratio, max_sv / min_sv);
+              }
+          }
+      };
+
+    MeshGeometryStatistics statistics;
+    statistics.min_cell_diameter = std::numeric_limits<double>::max();
+    statistics.max_cell_diameter = 0.;
+    statistics.volume            = 0.;
+    statistics.max_aspect_ratio  = 0.;
+
+    const auto copier = [&statistics](const CopyData &copy) {
+      statistics.min_cell_diameter =
+        std::min(statistics.min_cell_diameter, copy.min_diameter);
+      statistics.max_cell_diameter =
+        std::max(statistics.max_cell_diameter, copy.max_diameter);
+      statistics.volume += copy.volume;
+      statistics.max_aspect_ratio =
+        std::max(statistics.max_aspect_ratio, copy.aspect_ratio);
+    };
+
+    WorkStream::run(triangulation.active_cell_iterators(),
+                    worker,
+                    copier,
+                    ScratchData(mapping, fe, quadrature),
+                    CopyData());
+
+    const MPI_Comm mpi_communicator = triangulation.get_communicator();
+
+    statistics.min_cell_diameter =
+      Utilities::MPI::min(statistics.min_cell_diameter, mpi_communicator);
+    statistics.max_cell_diameter =
+      Utilities::MPI::max(statistics.max_cell_diameter, mpi_communicator);
+    statistics.volume = Utilities::MPI::sum(statistics.volume, mpi_communicator);
+    statistics.max_aspect_ratio =
+      Utilities::MPI::max(statistics.max_aspect_ratio, mpi_communicator);
+
+    return statistics;
+  }
+
+
+
   template <int dim, int spacedim>
   BoundingBox<spacedim>
   compute_bounding_box(const Triangulation<dim, spacedim> &tria)
@@ -12,7 +12,6 @@
 //
 // ------------------------------------------------------------------------
 
-#include <deal.II/base/bounding_box.h>
 #include <deal.II/base/floating_point_comparator.h>
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/utilities.h>
@@ -21,8 +20,12 @@
 #include <deal.II/grid/grid_tools_topology.h>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -363,46 +366,35 @@ namespace GridTools
       considered_vertices = new_vertex_numbers;
     Assert(considered_vertices.size() <= vertices.size(), ExcInternalError());
 
-    // The algorithm below improves upon the naive O(n^2) algorithm by first
-    // sorting vertices by their value in one component and then only
-    // comparing vertices for equality which are nearly equal in that
-    // component. For example, if @p vertices form a cube, then we will only
-    // compare points that have the same x coordinate when we try to find
-    // duplicated vertices.
-
-    // Start by finding the longest coordinate direction. This minimizes the
-    // number of points that need to be compared against each-other in a
-    // single set for typical geometries.
-    const BoundingBox<spacedim> bbox(vertices);
-
-    unsigned int longest_coordinate_direction = 0;
-    double       longest_coordinate_length    = bbox.side_length(0);
-    for (unsigned int d = 1; d < spacedim; ++d)
-      {
-        const double coordinate_length = bbox.side_length(d);
-        if (longest_coordinate_length < coordinate_length)
-          {
-            longest_coordinate_length    = coordinate_length;
-            longest_coordinate_direction = d;
-          }
-      }
+    // The algorithm below improves upon the naive O(n^2) algorithm by
+    // subdividing space into a uniform grid of buckets with side length
+    // 'tol' (a spatial hash): two points within the tolerance of each other
+    // are then located either in the same bucket or in directly neighboring
+    // buckets, so the number of distance computations per vertex is bounded
+    // by the occupancy of 3^spacedim buckets rather than by the number of
+    // vertices that happen to be nearly equal in a single coordinate, as in
+    // the sorting-based predecessor of this code.
+
+    const auto compute_bin = [tol](const Point<spacedim> &p) {
+      std::array<std::int64_t, spacedim> bin;
+      for (unsigned int d = 0; d < spacedim; ++d)
+        bin[d] = static_cast<std::int64_t>(std::floor(p[d] / tol));
+      return bin;
+    };
 
-    // Sort vertices (while preserving their vertex numbers) along that
-    // coordinate direction:
-    std::vector<std::pair<unsigned int, Point<spacedim>>> sorted_vertices;
-    sorted_vertices.reserve(vertices.size());
-    for (const unsigned int vertex_n : considered_vertices)
-      {
-        AssertIndexRange(vertex_n, vertices.size());
-        sorted_vertices.emplace_back(vertex_n, vertices[vertex_n]);
-      }
-    std::sort(sorted_vertices.begin(),
-              sorted_vertices.end(),
-              [&](const std::pair<unsigned int, Point<spacedim>> &a,
-                  const std::pair<unsigned int, Point<spacedim>> &b) {
-                return a.second[longest_coordinate_direction] <
-                       b.second[longest_coordinate_direction];
-              });
+    // Hash an integer bucket index into a single number. Collisions between
+    // different buckets are harmless since the points stored in a bucket are
+    // always compared with the actual tolerance below.
+    const auto compute_hash =
+      [](const std::array<std::int64_t, spacedim> &bin) {
+        constexpr std::uint64_t primes[3] = {73856093ULL,
+                                             19349669ULL,
+                                             83492791ULL};
+        std::uint64_t           hash      = 0;
+        for (unsigned int d = 0; d < spacedim; ++d)
+          hash ^= static_cast<std::uint64_t>(bin[d]) * primes[d];
+        return hash;
+      };
 
     auto within_tolerance = [=](const Point<spacedim> &a,
                                 const Point<spacedim> &b) {
@@ -412,47 +404,52 @@ namespace GridTools
       return true;
     };
 
-    // Find a range of numbers that have the same component in the longest
-    // coordinate direction:
-    auto range_start = sorted_vertices.begin();
-    while (range_start != sorted_vertices.end())
+    // Process the vertices in ascending order of their numbers so that, as
+    // in previous versions of this function, duplicates are deterministically
+    // replaced by the vertex with the lowest number among the kept vertices
+    // within the tolerance.
+    std::vector<unsigned int> sorted_considered_vertices =
+      considered_vertices;
+    std::sort(sorted_considered_vertices.begin(),
+              sorted_considered_vertices.end());
+
+    std::unordered_map<std::uint64_t, std::vector<unsigned int>> buckets;
+    buckets.reserve(sorted_considered_vertices.size());
+
+    for (const unsigned int vertex_n : sorted_considered_vertices)
       {
-        auto range_end = range_start + 1;
-        while (range_end != sorted_vertices.end() &&
-               std::abs(range_end->second[longest_coordinate_direction] -
-                        range_start->second[longest_coordinate_direction]) <
-                 tol)
-          ++range_end;
-
-        // preserve behavior with older versions of this function by replacing
-        // higher vertex numbers by lower vertex numbers
-        std::sort(range_start,
-                  range_end,
-                  [](const std::pair<unsigned int, Point<spacedim>> &a,
-                     const std::pair<unsigned int, Point<spacedim>> &b) {
-                    return a.first < b.first;
-                  });
-
-        // Now de-duplicate [range_start, range_end)
-        //
-        // We have identified all points that are within a strip of width 'tol'
-        // in one coordinate direction. Now we need to figure out which of these
-        // are also close in other coordinate directions. If two are close, we
-        // can mark the second one for deletion.
-        for (auto reference = range_start; reference != range_end; ++reference)
+        AssertIndexRange(vertex_n, vertices.size());
+        const Point<spacedim> &vertex = vertices[vertex_n];
+        const auto             bin    = compute_bin(vertex);
+
+        // Look for an already kept vertex within the tolerance in the
+        // current bucket and all neighboring buckets, choosing the one with
+        // the lowest vertex number if there are several.
+        unsigned int replace_by = numbers::invalid_unsigned_int;
+
+        std::array<std::int64_t, spacedim> neighbor_bin;
+        for (unsigned int n = 0; n < Utilities::pow(3u, spacedim); ++n)
           {
-            if (reference->first != numbers::invalid_unsigned_int)
-              for (auto it = reference + 1; it != range_end; ++it)
-                {
-                  if (within_tolerance(reference->second, it->second))
-                    {
-                      new_vertex_numbers[it->first] = reference->first;
-                      // skip the replaced vertex in the future
-                      it->first = numbers::invalid_unsigned_int;
-                    }
-                }
+            unsigned int reduced = n;
+            for (unsigned int d = 0; d < spacedim; ++d)
+              {
+                neighbor_bin[d] =
+                  bin[d] + (static_cast<int>(reduced % 3) - 1);
+                reduced /= 3;
+              }
+
+            const auto it = buckets.find(compute_hash(neighbor_bin));
+            if (it != buckets.end())
+              for (const unsigned int other_vertex_n : it->second)
+                if (other_vertex_n < replace_by &&
+                    within_tolerance(vertex, vertices[other_vertex_n]))
+                  replace_by = other_vertex_n;
           }
-        range_start = range_end;
+
+        if (replace_by != numbers::invalid_unsigned_int)
+          new_vertex_numbers[vertex_n] = replace_by;
+        else
+          buckets[compute_hash(bin)].push_back(vertex_n);
       }
 
     // now we got a renumbering list. simply renumber all vertices
@@ -1647,6 +1647,8 @@ TransfiniteInterpolationManifold<dim, spacedim>::initialize(
   level_coarse = triangulation.last()->level();
   coarse_cell_is_flat.resize(triangulation.n_cells(level_coarse), false);
   quadratic_approximation.clear();
+  chart_points_cache.clear();
+  chart_points_cache.resize(triangulation.n_cells(level_coarse));
 
   // In case of dim == spacedim we perform a quadratic approximation in
   // InverseQuadraticApproximation(), thus initialize the unit_points
@@ -2413,6 +2415,24 @@ TransfiniteInterpolationManifold<dim, spacedim>::compute_chart_points(
   auto compute_chart_point =
     [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
         const unsigned int point_index) {
+      // check whether this point has already been pulled back with respect
+      // to the present coarse cell in a previous query; this happens a lot
+      // during refinement, where every vertex appears in the surrounding
+      // points of all its adjacent lines, quads, and cells
+      std::array<double, spacedim> cache_key;
+      for (unsigned int d = 0; d < spacedim; ++d)
+        cache_key[d] = surrounding_points[point_index][d];
+      auto &cache = chart_points_cache[cell->index()];
+      {
+        std::lock_guard<std::mutex> lock(chart_points_cache_mutex);
+        const auto                  cached = cache.find(cache_key);
+        if (cached != cache.end())
+          {
+            chart_points[point_index] = cached->second;
+            return;
+          }
+      }
+
       Point<dim> guess;
       // an optimization: keep track of whether or not we used the quadratic
       // approximation so that we don't call pull_back with the same
@@ -2476,6 +2496,16 @@ TransfiniteInterpolationManifold<dim, spacedim>::compute_chart_points(
           chart_points[point_index] =
             pull_back(cell, surrounding_points[point_index], guess);
         }
+
+      // remember successful pull backs; failed attempts are not recorded
+      // because a later query with a different chain of initial guesses
+      // might still succeed
+      if (chart_points[point_index][0] !=
+          internal::invalid_pull_back_coordinate)
+        {
+          std::lock_guard<std::mutex> lock(chart_points_cache_mutex);
+          cache.insert({cache_key, chart_points[point_index]});
+        }
     };
 
   // check whether all points are inside the unit cell of the current chart
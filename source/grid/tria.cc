@@ -36,10 +36,19 @@
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 
+#ifdef DEAL_II_WITH_ZLIB
+#  include <boost/iostreams/copy.hpp>
+#  include <boost/iostreams/device/array.hpp>
+#  include <boost/iostreams/device/back_inserter.hpp>
+#  include <boost/iostreams/filter/gzip.hpp>
+#  include <boost/iostreams/filtering_streambuf.hpp>
+#endif
+
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <limits>
@@ -129,6 +138,318 @@ namespace internal
   } // namespace TriangulationImplementation
 
 
+  namespace
+  {
+#ifdef DEAL_II_WITH_ZLIB
+    /**
+     * Compress the given memory range with zlib at the given effort and
+     * return the compressed bytes.
+     */
+    std::vector<char>
+    compress_chunk(const char        *data,
+                   const std::size_t  size,
+                   const unsigned int compression_level)
+    {
+      namespace bio = boost::iostreams;
+
+      std::vector<char> compressed;
+
+      bio::filtering_streambuf<bio::input> in;
+      in.push(
+        bio::gzip_compressor(bio::gzip_params(std::min(compression_level, 9u))));
+      in.push(bio::array_source(data, size));
+      bio::copy(in, bio::back_inserter(compressed));
+
+      return compressed;
+    }
+
+
+
+    /**
+     * Decompress a memory range written by compress_chunk() into @p dest,
+     * whose expected size has to be known from the surrounding bookkeeping.
+     */
+    void
+    decompress_chunk(const char       *compressed,
+                     const std::size_t compressed_size,
+                     char             *dest,
+                     const std::size_t expected_size)
+    {
+      namespace bio = boost::iostreams;
+
+      std::vector<char> decompressed;
+
+      bio::filtering_streambuf<bio::input> in;
+      in.push(bio::gzip_decompressor());
+      in.push(bio::array_source(compressed, compressed_size));
+      bio::copy(in, bio::back_inserter(decompressed));
+
+      AssertThrow(decompressed.size() == expected_size,
+                  ExcMessage(
+                    "A compressed chunk of cell-attached data did not "
+                    "decompress to the expected number of bytes. The file is "
+                    "either corrupted, or it has been written with different "
+                    "compression settings than the ones used for reading."));
+
+      std::memcpy(dest, decompressed.data(), expected_size);
+    }
+
+
+
+#  ifdef DEAL_II_WITH_MPI
+    /**
+     * Collectively write a set of independently compressed chunks into
+     * @p fh, starting at @p base_offset. The layout consists of two
+     * integers denoting the global number of chunks and the nominal number
+     * of cells per chunk, followed by one record per chunk (the first cell
+     * it covers, the number of cells, the absolute file position of its
+     * payload, and the payload size in bytes), followed by the concatenated
+     * payloads. Since every chunk can be decompressed independently, the
+     * data can be read back by an arbitrary number of processes.
+     */
+    void
+    write_compressed_chunks(
+      MPI_File                              fh,
+      const MPI_Offset                      base_offset,
+      const std::uint64_t                   cells_per_chunk,
+      const std::vector<std::uint64_t>     &chunk_first_cell,
+      const std::vector<std::uint64_t>     &chunk_n_cells,
+      const std::vector<std::vector<char>> &compressed_chunks,
+      const MPI_Comm                       &mpi_communicator)
+    {
+      const std::uint64_t n_local_chunks = compressed_chunks.size();
+
+      std::uint64_t chunk_index_offset = 0;
+      int           ierr               = MPI_Exscan(&n_local_chunks,
+                            &chunk_index_offset,
+                            1,
+                            MPI_UINT64_T,
+                            MPI_SUM,
+                            mpi_communicator);
+      AssertThrowMPI(ierr);
+
+      std::uint64_t n_global_chunks = 0;
+      ierr                          = MPI_Allreduce(&n_local_chunks,
+                           &n_global_chunks,
+                           1,
+                           MPI_UINT64_T,
+                           MPI_SUM,
+                           mpi_communicator);
+      AssertThrowMPI(ierr);
+
+      std::uint64_t local_payload_bytes = 0;
+      for (const auto &chunk : compressed_chunks)
+        local_payload_bytes += chunk.size();
+
+      std::uint64_t payload_byte_offset = 0;
+      ierr                              = MPI_Exscan(&local_payload_bytes,
+                        &payload_byte_offset,
+                        1,
+                        MPI_UINT64_T,
+                        MPI_SUM,
+                        mpi_communicator);
+      AssertThrowMPI(ierr);
+
+      const MPI_Offset table_start = base_offset + 2 * sizeof(std::uint64_t);
+      const MPI_Offset payload_start =
+        table_start +
+        static_cast<MPI_Offset>(n_global_chunks) * 4 * sizeof(std::uint64_t);
+
+      // Assemble the table records of the locally compressed chunks.
+      std::vector<std::uint64_t> table(4 * n_local_chunks);
+      std::uint64_t              running_offset =
+        static_cast<std::uint64_t>(payload_start) + payload_byte_offset;
+      for (std::uint64_t c = 0; c < n_local_chunks; ++c)
+        {
+          table[4 * c + 0] = chunk_first_cell[c];
+          table[4 * c + 1] = chunk_n_cells[c];
+          table[4 * c + 2] = running_offset;
+          table[4 * c + 3] = compressed_chunks[c].size();
+          running_offset += compressed_chunks[c].size();
+        }
+
+      if (Utilities::MPI::this_mpi_process(mpi_communicator) == 0)
+        {
+          const std::uint64_t header[2] = {n_global_chunks, cells_per_chunk};
+          ierr = Utilities::MPI::LargeCount::File_write_at_c(
+            fh, base_offset, header, 2, MPI_UINT64_T, MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+
+      ierr = Utilities::MPI::LargeCount::File_write_at_c(
+        fh,
+        table_start +
+          static_cast<MPI_Offset>(chunk_index_offset) * 4 *
+            sizeof(std::uint64_t),
+        table.data(),
+        table.size(),
+        MPI_UINT64_T,
+        MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      MPI_Offset write_position =
+        static_cast<MPI_Offset>(payload_start) + payload_byte_offset;
+      for (const auto &chunk : compressed_chunks)
+        {
+          ierr = Utilities::MPI::LargeCount::File_write_at_c(
+            fh,
+            write_position,
+            chunk.data(),
+            chunk.size(),
+            MPI_BYTE,
+            MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+          write_position += chunk.size();
+        }
+    }
+
+
+
+    /**
+     * Counterpart of write_compressed_chunks(): read the chunk table
+     * starting at @p base_offset and hand the compressed payload of every
+     * chunk overlapping the cell range
+     * <tt>[global_first_cell, global_first_cell + local_num_cells)</tt> to
+     * @p process_chunk.
+     */
+    void
+    read_compressed_chunks(
+      MPI_File            fh,
+      const MPI_Offset    base_offset,
+      const std::uint64_t global_first_cell,
+      const std::uint64_t local_num_cells,
+      const std::function<void(const std::uint64_t      first_cell,
+                               const std::uint64_t      n_cells,
+                               const std::vector<char> &compressed)>
+        &process_chunk)
+    {
+      std::uint64_t header[2];
+      int           ierr = Utilities::MPI::LargeCount::File_read_at_c(
+        fh, base_offset, header, 2, MPI_UINT64_T, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+      const std::uint64_t n_global_chunks = header[0];
+
+      std::vector<std::uint64_t> table(4 * n_global_chunks);
+      ierr = Utilities::MPI::LargeCount::File_read_at_c(
+        fh,
+        base_offset + 2 * sizeof(std::uint64_t),
+        table.data(),
+        table.size(),
+        MPI_UINT64_T,
+        MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      std::vector<char> compressed;
+      for (std::uint64_t c = 0; c < n_global_chunks; ++c)
+        {
+          const std::uint64_t first_cell      = table[4 * c + 0];
+          const std::uint64_t n_cells         = table[4 * c + 1];
+          const std::uint64_t offset          = table[4 * c + 2];
+          const std::uint64_t compressed_size = table[4 * c + 3];
+
+          if (first_cell + n_cells <= global_first_cell ||
+              first_cell >= global_first_cell + local_num_cells)
+            continue;
+
+          compressed.resize(compressed_size);
+          ierr = Utilities::MPI::LargeCount::File_read_at_c(
+            fh,
+            static_cast<MPI_Offset>(offset),
+            compressed.data(),
+            compressed.size(),
+            MPI_BYTE,
+            MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+
+          process_chunk(first_cell, n_cells, compressed);
+        }
+    }
+#  endif
+
+
+
+    /**
+     * Serial variant of write_compressed_chunks() that appends the chunk
+     * table and the payloads at the current position of @p file, using the
+     * same layout as the MPI version.
+     */
+    void
+    write_compressed_chunks(
+      std::ofstream                        &file,
+      const std::uint64_t                   cells_per_chunk,
+      const std::vector<std::uint64_t>     &chunk_first_cell,
+      const std::vector<std::uint64_t>     &chunk_n_cells,
+      const std::vector<std::vector<char>> &compressed_chunks)
+    {
+      const std::uint64_t n_chunks  = compressed_chunks.size();
+      const std::uint64_t header[2] = {n_chunks, cells_per_chunk};
+      file.write(reinterpret_cast<const char *>(header), sizeof(header));
+
+      std::uint64_t running_offset = static_cast<std::uint64_t>(file.tellp()) +
+                                     n_chunks * 4 * sizeof(std::uint64_t);
+      std::vector<std::uint64_t> table(4 * n_chunks);
+      for (std::uint64_t c = 0; c < n_chunks; ++c)
+        {
+          table[4 * c + 0] = chunk_first_cell[c];
+          table[4 * c + 1] = chunk_n_cells[c];
+          table[4 * c + 2] = running_offset;
+          table[4 * c + 3] = compressed_chunks[c].size();
+          running_offset += compressed_chunks[c].size();
+        }
+      file.write(reinterpret_cast<const char *>(table.data()),
+                 table.size() * sizeof(std::uint64_t));
+
+      for (const auto &chunk : compressed_chunks)
+        file.write(chunk.data(), chunk.size());
+    }
+
+
+
+    /**
+     * Serial variant of read_compressed_chunks() that reads the chunk table
+     * at the current position of @p file.
+     */
+    void
+    read_compressed_chunks(
+      std::ifstream      &file,
+      const std::uint64_t global_first_cell,
+      const std::uint64_t local_num_cells,
+      const std::function<void(const std::uint64_t      first_cell,
+                               const std::uint64_t      n_cells,
+                               const std::vector<char> &compressed)>
+        &process_chunk)
+    {
+      std::uint64_t header[2];
+      file.read(reinterpret_cast<char *>(header), sizeof(header));
+      const std::uint64_t n_chunks = header[0];
+
+      std::vector<std::uint64_t> table(4 * n_chunks);
+      file.read(reinterpret_cast<char *>(table.data()),
+                table.size() * sizeof(std::uint64_t));
+
+      std::vector<char> compressed;
+      for (std::uint64_t c = 0; c < n_chunks; ++c)
+        {
+          const std::uint64_t first_cell      = table[4 * c + 0];
+          const std::uint64_t n_cells         = table[4 * c + 1];
+          const std::uint64_t offset          = table[4 * c + 2];
+          const std::uint64_t compressed_size = table[4 * c + 3];
+
+          if (first_cell + n_cells <= global_first_cell ||
+              first_cell >= global_first_cell + local_num_cells)
+            continue;
+
+          compressed.resize(compressed_size);
+          file.seekg(offset);
+          file.read(compressed.data(), compressed.size());
+
+          process_chunk(first_cell, n_cells, compressed);
+        }
+    }
+#endif
+  } // namespace
+
+
   template <int dim, int spacedim>
   DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
   CellAttachedDataSerializer<dim, spacedim>::CellAttachedDataSerializer()
@@ -673,10 +994,21 @@ namespace internal
     const unsigned int global_first_cell,
     const unsigned int global_num_cells,
     const std::string &filename,
-    const MPI_Comm    &mpi_communicator) const
+    const MPI_Comm    &mpi_communicator,
+    const unsigned int compression_level,
+    const unsigned int cells_per_compression_chunk) const
   {
     Assert(sizes_fixed_cumulative.size() > 0,
            ExcMessage("No data has been packed!"));
+    Assert(compression_level == 0 || cells_per_compression_chunk > 0,
+           ExcMessage("Compression chunks have to cover at least one cell."));
+#ifndef DEAL_II_WITH_ZLIB
+    AssertThrow(compression_level == 0,
+                ExcMessage(
+                  "Writing compressed cell-attached data requires deal.II "
+                  "to be configured with zlib."));
+    (void)cells_per_compression_chunk;
+#endif
 
 #ifdef DEAL_II_WITH_MPI
     // Large fractions of this function have been copied from
@@ -738,20 +1070,59 @@ namespace internal
           const MPI_Offset size_header =
             sizes_fixed_cumulative.size() * sizeof(unsigned int);
 
-          // Make sure we do the following computation in 64bit integers to be
-          // able to handle 4GB+ files:
-          const MPI_Offset my_global_file_position =
-            size_header +
-            static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
-
-          ierr =
-            Utilities::MPI::LargeCount::File_write_at_c(fh,
-                                                        my_global_file_position,
-                                                        src_data_fixed.data(),
-                                                        src_data_fixed.size(),
-                                                        MPI_BYTE,
-                                                        MPI_STATUS_IGNORE);
-          AssertThrowMPI(ierr);
+          if (compression_level == 0)
+            {
+              // Make sure we do the following computation in 64bit integers
+              // to be able to handle 4GB+ files:
+              const MPI_Offset my_global_file_position =
+                size_header +
+                static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
+
+              ierr = Utilities::MPI::LargeCount::File_write_at_c(
+                fh,
+                my_global_file_position,
+                src_data_fixed.data(),
+                src_data_fixed.size(),
+                MPI_BYTE,
+                MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+            }
+#ifdef DEAL_II_WITH_ZLIB
+          else
+            {
+              // Compress the local cell records in independent chunks and
+              // write them, together with a table describing which cells
+              // each chunk covers, behind the header.
+              const unsigned int local_num_cells =
+                src_data_fixed.size() / bytes_per_cell;
+
+              std::vector<std::vector<char>> compressed_chunks;
+              std::vector<std::uint64_t>     chunk_first_cell, chunk_n_cells;
+              for (unsigned int first = 0; first < local_num_cells;
+                   first += cells_per_compression_chunk)
+                {
+                  const unsigned int n_cells_in_chunk =
+                    std::min(cells_per_compression_chunk,
+                             local_num_cells - first);
+                  compressed_chunks.push_back(compress_chunk(
+                    src_data_fixed.data() +
+                      static_cast<std::size_t>(first) * bytes_per_cell,
+                    static_cast<std::size_t>(n_cells_in_chunk) * bytes_per_cell,
+                    compression_level));
+                  chunk_first_cell.push_back(
+                    static_cast<std::uint64_t>(global_first_cell) + first);
+                  chunk_n_cells.push_back(n_cells_in_chunk);
+                }
+
+              write_compressed_chunks(fh,
+                                      size_header,
+                                      cells_per_compression_chunk,
+                                      chunk_first_cell,
+                                      chunk_n_cells,
+                                      compressed_chunks,
+                                      mpi_communicator);
+            }
+#endif
 
           ierr = MPI_File_close(&fh);
           AssertThrowMPI(ierr);
@@ -811,33 +1182,80 @@ namespace internal
               AssertThrowMPI(ierr);
             }
 
-            // Gather size of data in bytes we want to store from this
-            // processor and compute the prefix sum. We do this in 64 bit
-            // to avoid overflow for files larger than 4GB:
-            const std::uint64_t size_on_proc = src_data_variable.size();
-            std::uint64_t       prefix_sum   = 0;
-            ierr                             = MPI_Exscan(&size_on_proc,
-                              &prefix_sum,
-                              1,
-                              MPI_UINT64_T,
-                              MPI_SUM,
-                              mpi_communicator);
-            AssertThrowMPI(ierr);
-
-            const MPI_Offset my_global_file_position =
-              static_cast<MPI_Offset>(global_num_cells) * sizeof(unsigned int) +
-              prefix_sum;
-
-            // Write data consecutively into file.
-            ierr = Utilities::MPI::LargeCount::File_write_at_c(
-              fh,
-              my_global_file_position,
-              src_data_variable.data(),
-              src_data_variable.size(),
-              MPI_BYTE,
-              MPI_STATUS_IGNORE);
-            AssertThrowMPI(ierr);
+            if (compression_level == 0)
+              {
+                // Gather size of data in bytes we want to store from this
+                // processor and compute the prefix sum. We do this in 64 bit
+                // to avoid overflow for files larger than 4GB:
+                const std::uint64_t size_on_proc = src_data_variable.size();
+                std::uint64_t       prefix_sum   = 0;
+                ierr                             = MPI_Exscan(&size_on_proc,
+                                  &prefix_sum,
+                                  1,
+                                  MPI_UINT64_T,
+                                  MPI_SUM,
+                                  mpi_communicator);
+                AssertThrowMPI(ierr);
+
+                const MPI_Offset my_global_file_position =
+                  static_cast<MPI_Offset>(global_num_cells) *
+                    sizeof(unsigned int) +
+                  prefix_sum;
+
+                // Write data consecutively into file.
+                ierr = Utilities::MPI::LargeCount::File_write_at_c(
+                  fh,
+                  my_global_file_position,
+                  src_data_variable.data(),
+                  src_data_variable.size(),
+                  MPI_BYTE,
+                  MPI_STATUS_IGNORE);
+                AssertThrowMPI(ierr);
+              }
+#ifdef DEAL_II_WITH_ZLIB
+            else
+              {
+                // Chunk the local cells and compress the corresponding
+                // slices of the data buffer; the (uncompressed) cell data
+                // sizes written above tell readers how large each chunk is
+                // after decompression.
+                const unsigned int local_num_cells = src_sizes_variable.size();
+
+                std::vector<std::uint64_t> data_offsets(local_num_cells + 1,
+                                                        0);
+                for (unsigned int i = 0; i < local_num_cells; ++i)
+                  data_offsets[i + 1] =
+                    data_offsets[i] + src_sizes_variable[i];
+
+                std::vector<std::vector<char>> compressed_chunks;
+                std::vector<std::uint64_t>     chunk_first_cell, chunk_n_cells;
+                for (unsigned int first = 0; first < local_num_cells;
+                     first += cells_per_compression_chunk)
+                  {
+                    const unsigned int n_cells_in_chunk =
+                      std::min(cells_per_compression_chunk,
+                               local_num_cells - first);
+                    compressed_chunks.push_back(compress_chunk(
+                      src_data_variable.data() + data_offsets[first],
+                      data_offsets[first + n_cells_in_chunk] -
+                        data_offsets[first],
+                      compression_level));
+                    chunk_first_cell.push_back(
+                      static_cast<std::uint64_t>(global_first_cell) + first);
+                    chunk_n_cells.push_back(n_cells_in_chunk);
+                  }
 
+                write_compressed_chunks(
+                  fh,
+                  static_cast<MPI_Offset>(global_num_cells) *
+                    sizeof(unsigned int),
+                  cells_per_compression_chunk,
+                  chunk_first_cell,
+                  chunk_n_cells,
+                  compressed_chunks,
+                  mpi_communicator);
+              }
+#endif
 
             ierr = MPI_File_close(&fh);
             AssertThrowMPI(ierr);
@@ -863,9 +1281,43 @@ namespace internal
                        sizes_fixed_cumulative.data()),
                      sizes_fixed_cumulative.size() * sizeof(unsigned int));
 
-          // Write packed data.
-          file.write(reinterpret_cast<const char *>(src_data_fixed.data()),
-                     src_data_fixed.size() * sizeof(char));
+          if (compression_level == 0)
+            {
+              // Write packed data.
+              file.write(reinterpret_cast<const char *>(src_data_fixed.data()),
+                         src_data_fixed.size() * sizeof(char));
+            }
+#ifdef DEAL_II_WITH_ZLIB
+          else
+            {
+              const unsigned int bytes_per_cell = sizes_fixed_cumulative.back();
+              const unsigned int local_num_cells =
+                src_data_fixed.size() / bytes_per_cell;
+
+              std::vector<std::vector<char>> compressed_chunks;
+              std::vector<std::uint64_t>     chunk_first_cell, chunk_n_cells;
+              for (unsigned int first = 0; first < local_num_cells;
+                   first += cells_per_compression_chunk)
+                {
+                  const unsigned int n_cells_in_chunk =
+                    std::min(cells_per_compression_chunk,
+                             local_num_cells - first);
+                  compressed_chunks.push_back(compress_chunk(
+                    src_data_fixed.data() +
+                      static_cast<std::size_t>(first) * bytes_per_cell,
+                    static_cast<std::size_t>(n_cells_in_chunk) * bytes_per_cell,
+                    compression_level));
+                  chunk_first_cell.push_back(first);
+                  chunk_n_cells.push_back(n_cells_in_chunk);
+                }
+
+              write_compressed_chunks(file,
+                                      cells_per_compression_chunk,
+                                      chunk_first_cell,
+                                      chunk_n_cells,
+                                      compressed_chunks);
+            }
+#endif
 
           file.close();
         }
@@ -886,9 +1338,48 @@ namespace internal
                          src_sizes_variable.data()),
                        src_sizes_variable.size() * sizeof(int));
 
-            // Write packed data.
-            file.write(reinterpret_cast<const char *>(src_data_variable.data()),
-                       src_data_variable.size() * sizeof(char));
+            if (compression_level == 0)
+              {
+                // Write packed data.
+                file.write(reinterpret_cast<const char *>(
+                             src_data_variable.data()),
+                           src_data_variable.size() * sizeof(char));
+              }
+#ifdef DEAL_II_WITH_ZLIB
+            else
+              {
+                const unsigned int local_num_cells = src_sizes_variable.size();
+
+                std::vector<std::uint64_t> data_offsets(local_num_cells + 1,
+                                                        0);
+                for (unsigned int i = 0; i < local_num_cells; ++i)
+                  data_offsets[i + 1] =
+                    data_offsets[i] + src_sizes_variable[i];
+
+                std::vector<std::vector<char>> compressed_chunks;
+                std::vector<std::uint64_t>     chunk_first_cell, chunk_n_cells;
+                for (unsigned int first = 0; first < local_num_cells;
+                     first += cells_per_compression_chunk)
+                  {
+                    const unsigned int n_cells_in_chunk =
+                      std::min(cells_per_compression_chunk,
+                               local_num_cells - first);
+                    compressed_chunks.push_back(compress_chunk(
+                      src_data_variable.data() + data_offsets[first],
+                      data_offsets[first + n_cells_in_chunk] -
+                        data_offsets[first],
+                      compression_level));
+                    chunk_first_cell.push_back(first);
+                    chunk_n_cells.push_back(n_cells_in_chunk);
+                  }
+
+                write_compressed_chunks(file,
+                                        cells_per_compression_chunk,
+                                        chunk_first_cell,
+                                        chunk_n_cells,
+                                        compressed_chunks);
+              }
+#endif
 
             file.close();
           }
@@ -905,11 +1396,19 @@ namespace internal
     const std::string &filename,
     const unsigned int n_attached_deserialize_fixed,
     const unsigned int n_attached_deserialize_variable,
-    const MPI_Comm    &mpi_communicator)
+    const MPI_Comm    &mpi_communicator,
+    const bool         data_is_compressed)
   {
     Assert(dest_data_fixed.empty(),
            ExcMessage("Previously loaded data has not been released yet!"));
 
+#ifndef DEAL_II_WITH_ZLIB
+    AssertThrow(data_is_compressed == false,
+                ExcMessage(
+                  "Reading compressed cell-attached data requires deal.II "
+                  "to be configured with zlib."));
+#endif
+
     variable_size_data_stored = (n_attached_deserialize_variable > 0);
 
 #ifdef DEAL_II_WITH_MPI
@@ -963,21 +1462,61 @@ namespace internal
           const MPI_Offset size_header =
             sizes_fixed_cumulative.size() * sizeof(unsigned int);
 
-          // Make sure we do the following computation in 64bit integers to be
-          // able to handle 4GB+ files:
-          const MPI_Offset my_global_file_position =
-            size_header +
-            static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
-
-          ierr =
-            Utilities::MPI::LargeCount::File_read_at_c(fh,
-                                                       my_global_file_position,
-                                                       dest_data_fixed.data(),
-                                                       dest_data_fixed.size(),
-                                                       MPI_BYTE,
-                                                       MPI_STATUS_IGNORE);
-          AssertThrowMPI(ierr);
+          if (data_is_compressed == false)
+            {
+              // Make sure we do the following computation in 64bit integers
+              // to be able to handle 4GB+ files:
+              const MPI_Offset my_global_file_position =
+                size_header +
+                static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
 
+              ierr = Utilities::MPI::LargeCount::File_read_at_c(
+                fh,
+                my_global_file_position,
+                dest_data_fixed.data(),
+                dest_data_fixed.size(),
+                MPI_BYTE,
+                MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+            }
+#ifdef DEAL_II_WITH_ZLIB
+          else
+            {
+              // Decompress every chunk that overlaps the locally owned cell
+              // range and copy the relevant cell records into place. Since
+              // chunks are keyed by global cell indices, this also works if
+              // the data is read by a different number of processes than it
+              // was written with.
+              read_compressed_chunks(
+                fh,
+                size_header,
+                global_first_cell,
+                local_num_cells,
+                [&](const std::uint64_t      first_cell,
+                    const std::uint64_t      n_cells,
+                    const std::vector<char> &compressed) {
+                  std::vector<char> data(n_cells * bytes_per_cell);
+                  decompress_chunk(compressed.data(),
+                                   compressed.size(),
+                                   data.data(),
+                                   data.size());
+
+                  const std::uint64_t overlap_begin =
+                    std::max<std::uint64_t>(first_cell, global_first_cell);
+                  const std::uint64_t overlap_end =
+                    std::min<std::uint64_t>(first_cell + n_cells,
+                                            static_cast<std::uint64_t>(
+                                              global_first_cell) +
+                                              local_num_cells);
+                  std::memcpy(dest_data_fixed.data() +
+                                (overlap_begin - global_first_cell) *
+                                  bytes_per_cell,
+                              data.data() +
+                                (overlap_begin - first_cell) * bytes_per_cell,
+                              (overlap_end - overlap_begin) * bytes_per_cell);
+                });
+            }
+#endif
 
           ierr = MPI_File_close(&fh);
           AssertThrowMPI(ierr);
@@ -1029,29 +1568,96 @@ namespace internal
                               dest_sizes_variable.end(),
                               0ULL);
 
-            std::uint64_t prefix_sum = 0;
-            ierr                     = MPI_Exscan(&size_on_proc,
-                              &prefix_sum,
-                              1,
-                              MPI_UINT64_T,
-                              MPI_SUM,
-                              mpi_communicator);
-            AssertThrowMPI(ierr);
-
-            const MPI_Offset my_global_file_position =
-              static_cast<MPI_Offset>(global_num_cells) * sizeof(unsigned int) +
-              prefix_sum;
-
             dest_data_variable.resize(size_on_proc);
 
-            ierr = Utilities::MPI::LargeCount::File_read_at_c(
-              fh,
-              my_global_file_position,
-              dest_data_variable.data(),
-              dest_data_variable.size(),
-              MPI_BYTE,
-              MPI_STATUS_IGNORE);
-            AssertThrowMPI(ierr);
+            if (data_is_compressed == false)
+              {
+                std::uint64_t prefix_sum = 0;
+                ierr                     = MPI_Exscan(&size_on_proc,
+                                  &prefix_sum,
+                                  1,
+                                  MPI_UINT64_T,
+                                  MPI_SUM,
+                                  mpi_communicator);
+                AssertThrowMPI(ierr);
+
+                const MPI_Offset my_global_file_position =
+                  static_cast<MPI_Offset>(global_num_cells) *
+                    sizeof(unsigned int) +
+                  prefix_sum;
+
+                ierr = Utilities::MPI::LargeCount::File_read_at_c(
+                  fh,
+                  my_global_file_position,
+                  dest_data_variable.data(),
+                  dest_data_variable.size(),
+                  MPI_BYTE,
+                  MPI_STATUS_IGNORE);
+                AssertThrowMPI(ierr);
+              }
+#ifdef DEAL_II_WITH_ZLIB
+            else
+              {
+                // Destination offset of each locally owned cell within
+                // dest_data_variable:
+                std::vector<std::uint64_t> dest_offsets(local_num_cells + 1,
+                                                        0);
+                for (unsigned int i = 0; i < local_num_cells; ++i)
+                  dest_offsets[i + 1] =
+                    dest_offsets[i] + dest_sizes_variable[i];
+
+                read_compressed_chunks(
+                  fh,
+                  static_cast<MPI_Offset>(global_num_cells) *
+                    sizeof(unsigned int),
+                  global_first_cell,
+                  local_num_cells,
+                  [&](const std::uint64_t      first_cell,
+                      const std::uint64_t      n_cells,
+                      const std::vector<char> &compressed) {
+                    // The data sizes of the cells covered by this chunk may
+                    // belong to other processes, so fetch them from the
+                    // uncompressed size block at the beginning of the file.
+                    std::vector<int> chunk_sizes(n_cells);
+                    const int        ierr_sizes =
+                      Utilities::MPI::LargeCount::File_read_at_c(
+                        fh,
+                        static_cast<MPI_Offset>(first_cell) *
+                          sizeof(unsigned int),
+                        chunk_sizes.data(),
+                        chunk_sizes.size(),
+                        MPI_INT,
+                        MPI_STATUS_IGNORE);
+                    AssertThrowMPI(ierr_sizes);
+
+                    std::vector<std::uint64_t> chunk_offsets(n_cells + 1, 0);
+                    for (std::uint64_t i = 0; i < n_cells; ++i)
+                      chunk_offsets[i + 1] = chunk_offsets[i] + chunk_sizes[i];
+
+                    std::vector<char> data(chunk_offsets.back());
+                    decompress_chunk(compressed.data(),
+                                     compressed.size(),
+                                     data.data(),
+                                     data.size());
+
+                    const std::uint64_t overlap_begin =
+                      std::max<std::uint64_t>(first_cell, global_first_cell);
+                    const std::uint64_t overlap_end =
+                      std::min<std::uint64_t>(first_cell + n_cells,
+                                              static_cast<std::uint64_t>(
+                                                global_first_cell) +
+                                                local_num_cells);
+                    for (std::uint64_t cell = overlap_begin;
+                         cell < overlap_end;
+                         ++cell)
+                      std::memcpy(dest_data_variable.data() +
+                                    dest_offsets[cell - global_first_cell],
+                                  data.data() +
+                                    chunk_offsets[cell - first_cell],
+                                  chunk_sizes[cell - first_cell]);
+                  });
+              }
+#endif
 
             ierr = MPI_File_close(&fh);
             AssertThrowMPI(ierr);
@@ -1082,9 +1688,38 @@ namespace internal
           dest_data_fixed.resize(static_cast<size_t>(local_num_cells) *
                                  bytes_per_cell);
 
-          // Read packed data.
-          file.read(reinterpret_cast<char *>(dest_data_fixed.data()),
-                    dest_data_fixed.size() * sizeof(char));
+          if (data_is_compressed == false)
+            {
+              // Read packed data.
+              file.read(reinterpret_cast<char *>(dest_data_fixed.data()),
+                        dest_data_fixed.size() * sizeof(char));
+            }
+#ifdef DEAL_II_WITH_ZLIB
+          else
+            {
+              read_compressed_chunks(
+                file,
+                0,
+                local_num_cells,
+                [&](const std::uint64_t      first_cell,
+                    const std::uint64_t      n_cells,
+                    const std::vector<char> &compressed) {
+                  std::vector<char> data(n_cells * bytes_per_cell);
+                  decompress_chunk(compressed.data(),
+                                   compressed.size(),
+                                   data.data(),
+                                   data.size());
+
+                  const std::uint64_t overlap_end =
+                    std::min<std::uint64_t>(first_cell + n_cells,
+                                            local_num_cells);
+                  std::memcpy(dest_data_fixed.data() +
+                                first_cell * bytes_per_cell,
+                              data.data(),
+                              (overlap_end - first_cell) * bytes_per_cell);
+                });
+            }
+#endif
 
           file.close();
         }
@@ -1110,8 +1745,45 @@ namespace internal
                               dest_sizes_variable.end(),
                               0ULL);
             dest_data_variable.resize(size);
-            file.read(reinterpret_cast<char *>(dest_data_variable.data()),
-                      dest_data_variable.size() * sizeof(char));
+
+            if (data_is_compressed == false)
+              {
+                file.read(reinterpret_cast<char *>(dest_data_variable.data()),
+                          dest_data_variable.size() * sizeof(char));
+              }
+#ifdef DEAL_II_WITH_ZLIB
+            else
+              {
+                std::vector<std::uint64_t> dest_offsets(local_num_cells + 1,
+                                                        0);
+                for (unsigned int i = 0; i < local_num_cells; ++i)
+                  dest_offsets[i + 1] =
+                    dest_offsets[i] + dest_sizes_variable[i];
+
+                read_compressed_chunks(
+                  file,
+                  0,
+                  local_num_cells,
+                  [&](const std::uint64_t      first_cell,
+                      const std::uint64_t      n_cells,
+                      const std::vector<char> &compressed) {
+                    std::vector<char> data(
+                      dest_offsets[std::min<std::uint64_t>(first_cell +
+                                                             n_cells,
+                                                           local_num_cells)] -
+                      dest_offsets[first_cell]);
+                    decompress_chunk(compressed.data(),
+                                     compressed.size(),
+                                     data.data(),
+                                     data.size());
+
+                    std::memcpy(dest_data_variable.data() +
+                                  dest_offsets[first_cell],
+                                data.data(),
+                                data.size());
+                  });
+              }
+#endif
 
             file.close();
           }
@@ -12490,6 +13162,18 @@ void Triangulation<dim, spacedim>::copy_triangulation(
 
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+std::unique_ptr<Triangulation<dim, spacedim>>
+Triangulation<dim, spacedim>::create_snapshot() const
+{
+  auto snapshot = std::make_unique<Triangulation<dim, spacedim>>();
+  snapshot->copy_triangulation(*this);
+  return snapshot;
+}
+
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::reset_policy()
@@ -13072,6 +13756,33 @@ namespace internal
         refine_flags[level] = levels[level]->refine_flags;
       return refine_flags;
     }
+
+    bool
+    any_coarsen_flag_set(
+      const std::vector<std::unique_ptr<
+        dealii::internal::TriangulationImplementation::TriaLevel>> &levels)
+    {
+      for (const auto &level : levels)
+        if (std::find(level->coarsen_flags.begin(),
+                      level->coarsen_flags.end(),
+                      true) != level->coarsen_flags.end())
+          return true;
+      return false;
+    }
+
+    bool
+    any_refine_flag_set(
+      const std::vector<std::unique_ptr<
+        dealii::internal::TriangulationImplementation::TriaLevel>> &levels)
+    {
+      for (const auto &level : levels)
+        for (const std::uint8_t flag : level->refine_flags)
+          // the raw flags store RefinementCase values, and
+          // RefinementCase<dim>::no_refinement is zero in all dimensions
+          if (flag != 0u)
+            return true;
+      return false;
+    }
   } // namespace
 } // namespace internal
 
@@ -15550,6 +16261,76 @@ void Triangulation<dim, spacedim>::add_periodicity(
 
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+std::vector<typename Triangulation<dim, spacedim>::PeriodicFacePairData>
+  Triangulation<dim, spacedim>::pack_periodic_face_pairs_level_0() const
+{
+  std::vector<PeriodicFacePairData> periodic_face_pair_data;
+  periodic_face_pair_data.reserve(periodic_face_pairs_level_0.size());
+
+  for (const auto &face_pair : periodic_face_pairs_level_0)
+    {
+      Assert(face_pair.cell[0]->level() == 0 &&
+               face_pair.cell[1]->level() == 0,
+             ExcInternalError());
+
+      PeriodicFacePairData data;
+      data.first_cell_index  = face_pair.cell[0]->index();
+      data.second_cell_index = face_pair.cell[1]->index();
+      data.first_face_idx    = face_pair.face_idx[0];
+      data.second_face_idx   = face_pair.face_idx[1];
+      data.orientation       = face_pair.orientation;
+      AssertDimension(face_pair.matrix.m(), face_pair.matrix.n());
+      data.matrix_size = face_pair.matrix.m();
+      data.matrix_entries.reserve(face_pair.matrix.m() *
+                                  face_pair.matrix.n());
+      for (unsigned int i = 0; i < face_pair.matrix.m(); ++i)
+        for (unsigned int j = 0; j < face_pair.matrix.n(); ++j)
+          data.matrix_entries.push_back(face_pair.matrix(i, j));
+
+      periodic_face_pair_data.push_back(std::move(data));
+    }
+
+  return periodic_face_pair_data;
+}
+
+
+
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void Triangulation<dim, spacedim>::restore_periodic_face_pairs_level_0(
+  const std::vector<PeriodicFacePairData> &periodic_face_pair_data)
+{
+  periodic_face_pairs_level_0.clear();
+  periodic_face_pairs_level_0.reserve(periodic_face_pair_data.size());
+
+  for (const auto &data : periodic_face_pair_data)
+    {
+      GridTools::PeriodicFacePair<cell_iterator> face_pair;
+      face_pair.cell[0] = cell_iterator(this, 0, data.first_cell_index);
+      face_pair.cell[1] = cell_iterator(this, 0, data.second_cell_index);
+      face_pair.face_idx[0] = data.first_face_idx;
+      face_pair.face_idx[1] = data.second_face_idx;
+      face_pair.orientation = data.orientation;
+
+      AssertDimension(data.matrix_entries.size(),
+                      data.matrix_size * data.matrix_size);
+      face_pair.matrix.reinit(data.matrix_size, data.matrix_size);
+      for (unsigned int i = 0; i < data.matrix_size; ++i)
+        for (unsigned int j = 0; j < data.matrix_size; ++j)
+          face_pair.matrix(i, j) =
+            data.matrix_entries[i * data.matrix_size + j];
+
+      periodic_face_pairs_level_0.push_back(std::move(face_pair));
+    }
+
+  if (periodic_face_pairs_level_0.size() > 0)
+    update_periodic_face_map();
+}
+
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 const typename std::map<
@@ -15971,6 +16752,28 @@ void Triangulation<dim, spacedim>::notify_ready_to_unpack(
 
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void Triangulation<dim, spacedim>::set_attached_data_compression(
+  const unsigned int compression_level,
+  const unsigned int cells_per_compression_chunk)
+{
+  AssertIndexRange(compression_level, 10);
+  Assert(cells_per_compression_chunk > 0,
+         ExcMessage("Compression chunks have to cover at least one cell."));
+#ifndef DEAL_II_WITH_ZLIB
+  AssertThrow(compression_level == 0,
+              ExcMessage(
+                "Compressing cell-attached data requires deal.II to be "
+                "configured with zlib."));
+#endif
+
+  this->attached_data_compression_level       = compression_level;
+  this->attached_data_compression_chunk_cells = cells_per_compression_chunk;
+}
+
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::save_attached_data(
@@ -15994,7 +16797,9 @@ void Triangulation<dim, spacedim>::save_attached_data(
       tria->data_serializer.save(global_first_cell,
                                  global_num_cells,
                                  filename,
-                                 this->get_communicator());
+                                 this->get_communicator(),
+                                 this->attached_data_compression_level,
+                                 this->attached_data_compression_chunk_cells);
 
       // and release the memory afterwards
       tria->data_serializer.clear();
@@ -16029,7 +16834,8 @@ void Triangulation<dim, spacedim>::load_attached_data(
                                  filename,
                                  n_attached_deserialize_fixed,
                                  n_attached_deserialize_variable,
-                                 this->get_communicator());
+                                 this->get_communicator(),
+                                 this->attached_data_compression_level > 0);
 
       this->data_serializer.unpack_cell_status(this->local_cell_relations);
 
@@ -16212,6 +17018,18 @@ void Triangulation<dim, spacedim>::fix_coarsen_flags()
   // in particular we set flags right if
   // limit_level_difference_at_vertices is set. to do so we iterate
   // until the flags don't change any more
+  //
+  // before we do any of this, check for the common situation that no
+  // cell is flagged for coarsening at all: without the vertex-level
+  // smoothing, everything this function does is driven by coarsen flags
+  // that are already set, so the sweeps over the whole mesh below then
+  // cannot change anything and we can skip them. (with the vertex-level
+  // smoothing, flags can also appear based on the mesh structure alone,
+  // so we must not take this shortcut in that case.)
+  if (!(smooth_grid & limit_level_difference_at_vertices) &&
+      !internal::any_coarsen_flag_set(levels))
+    return;
+
   auto previous_coarsen_flags = internal::extract_raw_coarsen_flags(levels);
 
   bool continue_iterating = true;
@@ -16625,6 +17443,22 @@ template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 bool Triangulation<dim, spacedim>::prepare_coarsening_and_refinement()
 {
+  // Every smoothing and regularization step below either reacts to
+  // refinement or coarsening flags that are already set, or -- for the
+  // smoothing options listed here -- may introduce new flags based on the
+  // mesh structure alone. If no cell is flagged and none of these options
+  // is active, nothing in this function can change any flag, so return
+  // early instead of paying for (repeated) sweeps over a potentially
+  // large mesh.
+  const unsigned int structure_driven_smoothing =
+    (limit_level_difference_at_vertices | eliminate_unrefined_islands |
+     patch_level_1 | eliminate_refined_inner_islands |
+     eliminate_refined_boundary_islands);
+  if (((smooth_grid & structure_driven_smoothing) == 0u) &&
+      !internal::any_refine_flag_set(levels) &&
+      !internal::any_coarsen_flag_set(levels))
+    return false;
+
   // save the flags to determine whether something was changed in the
   // course of this function
   const auto coarsen_flags_before = internal::extract_raw_coarsen_flags(levels);
@@ -27,6 +27,11 @@
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_description.h>
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <fstream>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -116,12 +121,6 @@ namespace TriangulationDescription
           // Use the some-to-some version of the consensus algorithm framework
           // whereby we send requests to other processes that then deal with
           // them but do not send anything back.
-          //
-          // Note that the input (description_temp) *may* contain an entry for
-          // the current process. As documented, the consensus algorithm will
-          // simply copy that into the output queue, i.e., it will call
-          // process_request() on it as well, and the data will simply come
-          // back out on the local process.
           const auto create_request = [&](const unsigned int other_rank) {
             const auto ptr =
               std::find(future_owners_of_locally_owned_cells.begin(),
@@ -143,12 +142,31 @@ namespace TriangulationDescription
             this->merge(request, vertices_have_unique_ids);
           };
 
+          // The input (description_temp) *may* contain an entry for the
+          // current process. In the common case of repartitioning a
+          // triangulation in which only a small fraction of the cells
+          // changes ownership, that entry makes up nearly the entire mesh.
+          // Merge it directly instead of routing it through the consensus
+          // algorithm, which would serialize it and send it through MPI to
+          // the current process itself; this way, only the cells that
+          // actually change ranks -- plus their parents and surrounding
+          // ghost cells -- need to be packed and communicated.
+          const unsigned int my_rank =
+            dealii::Utilities::MPI::this_mpi_process(comm);
+
+          std::vector<unsigned int> other_ranks;
+          other_ranks.reserve(future_owners_of_locally_owned_cells.size());
+          for (const unsigned int rank : future_owners_of_locally_owned_cells)
+            if (rank == my_rank)
+              this->merge(create_request(rank), vertices_have_unique_ids);
+            else
+              other_ranks.push_back(rank);
+
           dealii::Utilities::MPI::ConsensusAlgorithms::selector<
-            DescriptionTemp<dim, spacedim>>(
-            future_owners_of_locally_owned_cells,
-            create_request,
-            process_request,
-            comm);
+            DescriptionTemp<dim, spacedim>>(other_ranks,
+                                            create_request,
+                                            process_request,
+                                            comm);
         }
 
         /**
@@ -1165,6 +1183,80 @@ namespace TriangulationDescription
                                         settings);
     }
 
+
+
+    template <int dim, int spacedim>
+    void
+    save_description(const Description<dim, spacedim> &description,
+                     const std::string                &filename)
+    {
+      std::ofstream stream(filename, std::ios::binary);
+      AssertThrow(stream.fail() == false,
+                  ExcMessage("The file <" + filename +
+                             "> can not be opened for writing."));
+
+      boost::archive::binary_oarchive archive(stream);
+
+      // store the template parameters and the number of processes the
+      // description has been created for, so that reading the file back in
+      // can detect mismatches before interpreting the data
+      const unsigned int stored_dim      = dim;
+      const unsigned int stored_spacedim = spacedim;
+      const unsigned int stored_n_ranks =
+        description.comm == MPI_COMM_NULL ?
+          numbers::invalid_unsigned_int :
+          dealii::Utilities::MPI::n_mpi_processes(description.comm);
+      archive << stored_dim << stored_spacedim << stored_n_ranks;
+
+      archive << description;
+    }
+
+
+
+    template <int dim, int spacedim>
+    Description<dim, spacedim>
+    create_description_from_file(const std::string &filename,
+                                 const MPI_Comm     comm)
+    {
+      std::ifstream stream(filename, std::ios::binary);
+      AssertThrow(stream.fail() == false,
+                  ExcMessage("The file <" + filename +
+                             "> can not be opened for reading."));
+
+      boost::archive::binary_iarchive archive(stream);
+
+      unsigned int stored_dim      = 0;
+      unsigned int stored_spacedim = 0;
+      unsigned int stored_n_ranks  = 0;
+      archive >> stored_dim >> stored_spacedim >> stored_n_ranks;
+
+      AssertThrow(stored_dim == dim && stored_spacedim == spacedim,
+                  ExcMessage("The file <" + filename +
+                             "> contains the description of a Triangulation<" +
+                             std::to_string(stored_dim) + "," +
+                             std::to_string(stored_spacedim) +
+                             ">, but a description of a Triangulation<" +
+                             std::to_string(dim) + "," +
+                             std::to_string(spacedim) + "> was requested."));
+      AssertThrow(stored_n_ranks == numbers::invalid_unsigned_int ||
+                    stored_n_ranks ==
+                      dealii::Utilities::MPI::n_mpi_processes(comm),
+                  ExcMessage(
+                    "The file <" + filename +
+                    "> has been created for a partition onto " +
+                    std::to_string(stored_n_ranks) +
+                    " MPI processes, but the given communicator comprises " +
+                    std::to_string(
+                      dealii::Utilities::MPI::n_mpi_processes(comm)) +
+                    " processes."));
+
+      Description<dim, spacedim> description;
+      archive >> description;
+      description.comm = comm;
+
+      return description;
+    }
+
   } // namespace Utilities
 } // namespace TriangulationDescription
 
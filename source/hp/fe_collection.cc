@@ -527,11 +527,28 @@ namespace hp
   FECollection<dim, spacedim>::hp_vertex_dof_identities(
     const std::set<unsigned int> &fes) const
   {
+    // check whether we have computed the identities for this set of
+    // elements before; the elements of the collection cannot change once
+    // they have been added, so cached results never become stale
+    const auto key =
+      std::make_tuple(0u, numbers::invalid_unsigned_int, fes);
+    {
+      std::lock_guard<std::mutex> lock(hp_dof_identities_cache_mutex);
+      const auto                  cached = hp_dof_identities_cache.find(key);
+      if (cached != hp_dof_identities_cache.end())
+        return cached->second;
+    }
+
     auto query_vertex_dof_identities = [this](const unsigned int fe_index_1,
                                               const unsigned int fe_index_2) {
       return (*this)[fe_index_1].hp_vertex_dof_identities((*this)[fe_index_2]);
     };
-    return compute_hp_dof_identities(fes, query_vertex_dof_identities);
+    const auto identities =
+      compute_hp_dof_identities(fes, query_vertex_dof_identities);
+
+    std::lock_guard<std::mutex> lock(hp_dof_identities_cache_mutex);
+    hp_dof_identities_cache.emplace(key, identities);
+    return identities;
   }
 
 
@@ -541,11 +558,25 @@ namespace hp
   FECollection<dim, spacedim>::hp_line_dof_identities(
     const std::set<unsigned int> &fes) const
   {
+    const auto key =
+      std::make_tuple(1u, numbers::invalid_unsigned_int, fes);
+    {
+      std::lock_guard<std::mutex> lock(hp_dof_identities_cache_mutex);
+      const auto                  cached = hp_dof_identities_cache.find(key);
+      if (cached != hp_dof_identities_cache.end())
+        return cached->second;
+    }
+
     auto query_line_dof_identities = [this](const unsigned int fe_index_1,
                                             const unsigned int fe_index_2) {
       return (*this)[fe_index_1].hp_line_dof_identities((*this)[fe_index_2]);
     };
-    return compute_hp_dof_identities(fes, query_line_dof_identities);
+    const auto identities =
+      compute_hp_dof_identities(fes, query_line_dof_identities);
+
+    std::lock_guard<std::mutex> lock(hp_dof_identities_cache_mutex);
+    hp_dof_identities_cache.emplace(key, identities);
+    return identities;
   }
 
 
@@ -556,13 +587,26 @@ namespace hp
     const std::set<unsigned int> &fes,
     const unsigned int            face_no) const
   {
+    const auto key = std::make_tuple(2u, face_no, fes);
+    {
+      std::lock_guard<std::mutex> lock(hp_dof_identities_cache_mutex);
+      const auto                  cached = hp_dof_identities_cache.find(key);
+      if (cached != hp_dof_identities_cache.end())
+        return cached->second;
+    }
+
     auto query_quad_dof_identities = [this,
                                       face_no](const unsigned int fe_index_1,
                                                const unsigned int fe_index_2) {
       return (*this)[fe_index_1].hp_quad_dof_identities((*this)[fe_index_2],
                                                         face_no);
     };
-    return compute_hp_dof_identities(fes, query_quad_dof_identities);
+    const auto identities =
+      compute_hp_dof_identities(fes, query_quad_dof_identities);
+
+    std::lock_guard<std::mutex> lock(hp_dof_identities_cache_mutex);
+    hp_dof_identities_cache.emplace(key, identities);
+    return identities;
   }
 
 
@@ -237,6 +237,57 @@ namespace hp
 
 
 
+  template <int dim, int q_dim, typename FEValuesType>
+  void
+  FEValuesBase<dim, q_dim, FEValuesType>::precalculate_fe_values(
+    const std::vector<std::array<unsigned int, 3>> &indices)
+  {
+    Threads::TaskGroup<> task_group;
+    for (const std::array<unsigned int, 3> &index_set : indices)
+      {
+        const unsigned int fe_index      = index_set[0],
+                           mapping_index = index_set[1],
+                           q_index       = index_set[2];
+
+        AssertIndexRange(fe_index, fe_collection->size());
+        AssertIndexRange(mapping_index, mapping_collection->size());
+        AssertIndexRange(q_index, q_collections.size());
+
+        task_group +=
+          Threads::new_task([&, fe_index, mapping_index, q_index]() {
+            fe_values_table[fe_index][mapping_index][q_index] =
+              std::make_unique<FEValuesType>(
+                (*mapping_collection)[mapping_index],
+                (*fe_collection)[fe_index],
+                q_collections[q_index],
+                update_flags);
+          });
+      }
+
+    task_group.join_all();
+  }
+
+
+
+  template <int dim, int q_dim, typename FEValuesType>
+  std::vector<std::array<unsigned int, 3>>
+  FEValuesBase<dim, q_dim, FEValuesType>::get_used_fe_value_indices() const
+  {
+    std::vector<std::array<unsigned int, 3>> used_indices;
+    for (unsigned int fe_index = 0; fe_index < fe_values_table.size(0);
+         ++fe_index)
+      for (unsigned int m_index = 0; m_index < fe_values_table.size(1);
+           ++m_index)
+        for (unsigned int q_index = 0; q_index < fe_values_table.size(2);
+             ++q_index)
+          if (fe_values_table[fe_index][m_index][q_index].get() != nullptr)
+            used_indices.push_back({{fe_index, m_index, q_index}});
+
+    return used_indices;
+  }
+
+
+
   template <int dim, int q_dim, typename FEValuesType>
   void
   FEValuesBase<dim, q_dim, FEValuesType>::precalculate_fe_values()
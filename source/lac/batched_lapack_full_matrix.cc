@@ -0,0 +1,329 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/lac/batched_lapack_full_matrix.h>
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/vector.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+template <typename number>
+BatchedLAPACKFullMatrix<number>::BatchedLAPACKFullMatrix()
+  : matrix_size(0)
+  , n_matrices(0)
+  , state(LAPACKSupport::matrix)
+  , property(LAPACKSupport::general)
+{}
+
+
+
+template <typename number>
+BatchedLAPACKFullMatrix<number>::BatchedLAPACKFullMatrix(
+  const size_type size,
+  const size_type batch_size)
+  : BatchedLAPACKFullMatrix()
+{
+  reinit(size, batch_size);
+}
+
+
+
+template <typename number>
+void
+BatchedLAPACKFullMatrix<number>::reinit(const size_type size,
+                                        const size_type batch_size)
+{
+  matrix_size = size;
+  n_matrices  = batch_size;
+
+  values.resize(0);
+  values.resize(n_blocks() * matrix_size * matrix_size,
+                VectorizedArray<number>(number(0.)));
+  row_permutation.clear();
+
+  // Fill the unused lanes of the last group with identity matrices, so that
+  // the factorization and solve kernels, which act on all lanes in
+  // lockstep, do not divide by zero or flag the padding as singular.
+  if (n_matrices % n_lanes != 0)
+    for (std::size_t lane = n_matrices % n_lanes; lane < n_lanes; ++lane)
+      for (size_type i = 0; i < matrix_size; ++i)
+        values[((n_blocks() - 1) * matrix_size + i) * matrix_size + i][lane] =
+          number(1.);
+
+  state    = LAPACKSupport::matrix;
+  property = LAPACKSupport::general;
+}
+
+
+
+template <typename number>
+void
+BatchedLAPACKFullMatrix<number>::compute_lu_factorization()
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  state = LAPACKSupport::unusable;
+
+  const size_type nn = matrix_size;
+  row_permutation.resize(n_blocks() * nn);
+
+  for (size_type b = 0; b < n_blocks(); ++b)
+    {
+      VectorizedArray<number> *matrix      = values.data() + b * nn * nn;
+      VectorizedArray<number> *permutation = row_permutation.data() + b * nn;
+
+      for (size_type i = 0; i < nn; ++i)
+        permutation[i] = static_cast<number>(i);
+
+      const std::size_t n_active_lanes =
+        std::min<std::size_t>(n_lanes, n_matrices - b * n_lanes);
+
+      for (size_type k = 0; k < nn; ++k)
+        {
+          // Partial pivoting in lockstep across the lanes: successively
+          // exchange the current pivot row with any later row holding a
+          // larger entry in column k, independently in each lane. After the
+          // loop, row k holds the largest remaining entry of column k in
+          // every lane.
+          for (size_type r = k + 1; r < nn; ++r)
+            {
+              const VectorizedArray<number> abs_pivot =
+                std::abs(matrix[k * nn + k]);
+              const VectorizedArray<number> abs_candidate =
+                std::abs(matrix[r * nn + k]);
+
+              for (size_type j = 0; j < nn; ++j)
+                {
+                  const VectorizedArray<number> row_k = matrix[k * nn + j];
+                  const VectorizedArray<number> row_r = matrix[r * nn + j];
+                  matrix[k * nn + j] =
+                    compare_and_apply_mask<SIMDComparison::greater_than>(
+                      abs_candidate, abs_pivot, row_r, row_k);
+                  matrix[r * nn + j] =
+                    compare_and_apply_mask<SIMDComparison::greater_than>(
+                      abs_candidate, abs_pivot, row_k, row_r);
+                }
+
+              const VectorizedArray<number> perm_k = permutation[k];
+              const VectorizedArray<number> perm_r = permutation[r];
+              permutation[k] =
+                compare_and_apply_mask<SIMDComparison::greater_than>(
+                  abs_candidate, abs_pivot, perm_r, perm_k);
+              permutation[r] =
+                compare_and_apply_mask<SIMDComparison::greater_than>(
+                  abs_candidate, abs_pivot, perm_k, perm_r);
+            }
+
+          const VectorizedArray<number> pivot = matrix[k * nn + k];
+          for (std::size_t lane = 0; lane < n_active_lanes; ++lane)
+            AssertThrow(pivot[lane] != number(0.),
+                        LACExceptions::ExcSingular());
+
+          const VectorizedArray<number> inverse_pivot =
+            VectorizedArray<number>(number(1.)) / pivot;
+
+          for (size_type r = k + 1; r < nn; ++r)
+            {
+              matrix[r * nn + k] *= inverse_pivot;
+              const VectorizedArray<number> factor = matrix[r * nn + k];
+              for (size_type j = k + 1; j < nn; ++j)
+                matrix[r * nn + j] -= factor * matrix[k * nn + j];
+            }
+        }
+    }
+
+  state = LAPACKSupport::lu;
+}
+
+
+
+template <typename number>
+void
+BatchedLAPACKFullMatrix<number>::compute_cholesky_factorization()
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  Assert(property == LAPACKSupport::symmetric,
+         LAPACKSupport::ExcProperty(property));
+  state = LAPACKSupport::unusable;
+
+  const size_type nn = matrix_size;
+
+  for (size_type b = 0; b < n_blocks(); ++b)
+    {
+      VectorizedArray<number> *matrix = values.data() + b * nn * nn;
+
+      const std::size_t n_active_lanes =
+        std::min<std::size_t>(n_lanes, n_matrices - b * n_lanes);
+
+      for (size_type k = 0; k < nn; ++k)
+        {
+          VectorizedArray<number> diagonal_entry = matrix[k * nn + k];
+          for (size_type j = 0; j < k; ++j)
+            diagonal_entry -= matrix[k * nn + j] * matrix[k * nn + j];
+
+          for (std::size_t lane = 0; lane < n_active_lanes; ++lane)
+            AssertThrow(diagonal_entry[lane] > number(0.),
+                        LACExceptions::ExcSingular());
+
+          matrix[k * nn + k] = std::sqrt(diagonal_entry);
+          const VectorizedArray<number> inverse_diagonal =
+            VectorizedArray<number>(number(1.)) / matrix[k * nn + k];
+
+          for (size_type i = k + 1; i < nn; ++i)
+            {
+              VectorizedArray<number> sum = matrix[i * nn + k];
+              for (size_type j = 0; j < k; ++j)
+                sum -= matrix[i * nn + j] * matrix[k * nn + j];
+              matrix[i * nn + k] = sum * inverse_diagonal;
+            }
+        }
+    }
+
+  state = LAPACKSupport::cholesky;
+}
+
+
+
+template <typename number>
+void
+BatchedLAPACKFullMatrix<number>::solve(
+  AlignedVector<VectorizedArray<number>> &v,
+  const bool                              transposed) const
+{
+  Assert(state == LAPACKSupport::lu || state == LAPACKSupport::cholesky,
+         LAPACKSupport::ExcState(state));
+  AssertDimension(v.size(), n_blocks() * matrix_size);
+
+  const size_type nn = matrix_size;
+
+  AlignedVector<VectorizedArray<number>> scratch(
+    state == LAPACKSupport::lu ? nn : 0);
+
+  for (size_type b = 0; b < n_blocks(); ++b)
+    {
+      const VectorizedArray<number> *matrix = values.data() + b * nn * nn;
+      VectorizedArray<number>       *rhs    = v.data() + b * nn;
+
+      if (state == LAPACKSupport::lu)
+        {
+          const VectorizedArray<number> *permutation =
+            row_permutation.data() + b * nn;
+
+          if (transposed == false)
+            {
+              // apply the row permutation of the pivoting to the right-hand
+              // side, entry by entry as the permutation differs between the
+              // lanes
+              for (size_type i = 0; i < nn; ++i)
+                for (std::size_t lane = 0; lane < n_lanes; ++lane)
+                  scratch[i][lane] =
+                    rhs[static_cast<size_type>(permutation[i][lane])][lane];
+              for (size_type i = 0; i < nn; ++i)
+                rhs[i] = scratch[i];
+
+              // forward substitution with the unit lower triangular factor
+              for (size_type i = 1; i < nn; ++i)
+                for (size_type j = 0; j < i; ++j)
+                  rhs[i] -= matrix[i * nn + j] * rhs[j];
+
+              // backward substitution with the upper triangular factor
+              for (size_type i = nn; i > 0;)
+                {
+                  --i;
+                  for (size_type j = i + 1; j < nn; ++j)
+                    rhs[i] -= matrix[i * nn + j] * rhs[j];
+                  rhs[i] /= matrix[i * nn + i];
+                }
+            }
+          else
+            {
+              // solve U^T y = b by forward substitution
+              for (size_type i = 0; i < nn; ++i)
+                {
+                  for (size_type j = 0; j < i; ++j)
+                    rhs[i] -= matrix[j * nn + i] * rhs[j];
+                  rhs[i] /= matrix[i * nn + i];
+                }
+
+              // solve L^T z = y by backward substitution (unit diagonal)
+              for (size_type i = nn; i > 0;)
+                {
+                  --i;
+                  for (size_type j = i + 1; j < nn; ++j)
+                    rhs[i] -= matrix[j * nn + i] * rhs[j];
+                }
+
+              // undo the row permutation of the pivoting
+              for (size_type i = 0; i < nn; ++i)
+                for (std::size_t lane = 0; lane < n_lanes; ++lane)
+                  scratch[static_cast<size_type>(permutation[i][lane])][lane] =
+                    rhs[i][lane];
+              for (size_type i = 0; i < nn; ++i)
+                rhs[i] = scratch[i];
+            }
+        }
+      else
+        {
+          // Cholesky factorization: L y = b, then L^T x = y. The transposed
+          // system coincides with the original one for symmetric matrices.
+          for (size_type i = 0; i < nn; ++i)
+            {
+              for (size_type j = 0; j < i; ++j)
+                rhs[i] -= matrix[i * nn + j] * rhs[j];
+              rhs[i] /= matrix[i * nn + i];
+            }
+
+          for (size_type i = nn; i > 0;)
+            {
+              --i;
+              for (size_type j = i + 1; j < nn; ++j)
+                rhs[i] -= matrix[j * nn + i] * rhs[j];
+              rhs[i] /= matrix[i * nn + i];
+            }
+        }
+    }
+}
+
+
+
+template <typename number>
+void
+BatchedLAPACKFullMatrix<number>::solve(std::vector<Vector<number>> &v,
+                                       const bool transposed) const
+{
+  AssertDimension(v.size(), n_matrices);
+
+  const size_type nn = matrix_size;
+
+  AlignedVector<VectorizedArray<number>> interleaved(n_blocks() * nn);
+  for (size_type index = 0; index < n_matrices; ++index)
+    {
+      AssertDimension(v[index].size(), nn);
+      for (size_type i = 0; i < nn; ++i)
+        interleaved[(index / n_lanes) * nn + i][index % n_lanes] =
+          v[index](i);
+    }
+
+  solve(interleaved, transposed);
+
+  for (size_type index = 0; index < n_matrices; ++index)
+    for (size_type i = 0; i < nn; ++i)
+      v[index](i) = interleaved[(index / n_lanes) * nn + i][index % n_lanes];
+}
+
+
+
+#include "batched_lapack_full_matrix.inst"
+
+DEAL_II_NAMESPACE_CLOSE
@@ -0,0 +1,43 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/lac/concurrent_sparsity_pattern.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+ConcurrentSparsityPattern::ConcurrentSparsityPattern(
+  SparsityPatternBase &pattern,
+  const unsigned int   n_shards)
+  : SparsityPatternBase(pattern.n_rows(), pattern.n_cols())
+  , pattern(&pattern)
+  , mutexes(n_shards)
+{
+  Assert(n_shards > 0, ExcMessage("The number of shards must be positive."));
+}
+
+
+
+void
+ConcurrentSparsityPattern::add_row_entries(
+  const size_type                  &row,
+  const ArrayView<const size_type> &columns,
+  const bool                        indices_are_sorted)
+{
+  AssertIndexRange(row, n_rows());
+
+  std::lock_guard<std::mutex> lock(mutexes[row % mutexes.size()]);
+  pattern->add_row_entries(row, columns, indices_are_sorted);
+}
+
+DEAL_II_NAMESPACE_CLOSE
@@ -0,0 +1,476 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/cuda_size.h>
+#include <deal.II/base/exceptions.h>
+
+#include <deal.II/lac/cuda_kernels.h>
+#include <deal.II/lac/cuda_solver_cg.h>
+
+#include <cmath>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace CUDAWrappers
+{
+  namespace internal
+  {
+    namespace
+    {
+      using kernel_size_type = LinearAlgebra::CUDAWrappers::kernel::size_type;
+
+      /**
+       * Compute <tt>r = b - q</tt>, used once to initialize the residual
+       * from the right-hand side and <tt>q = Ax</tt>.
+       */
+      template <typename Number>
+      __global__ void
+      compute_initial_residual(Number                *r,
+                               const Number          *b,
+                               const Number          *q,
+                               const kernel_size_type N)
+      {
+        const kernel_size_type idx_base =
+          threadIdx.x + blockIdx.x * (blockDim.x * chunk_size);
+        for (unsigned int i = 0; i < chunk_size; ++i)
+          {
+            const kernel_size_type idx = idx_base + i * block_size;
+            if (idx < N)
+              r[idx] = b[idx] - q[idx];
+          }
+      }
+
+
+
+      /**
+       * Compute the step lengths of the current iteration from the
+       * device-resident dot products: <tt>*alpha = *rs_old / *pq</tt> and
+       * <tt>*minus_alpha = -*alpha</tt>. Launched with a single thread.
+       */
+      template <typename Number>
+      __global__ void
+      compute_alpha(Number       *alpha,
+                    Number       *minus_alpha,
+                    const Number *rs_old,
+                    const Number *pq)
+      {
+        *alpha       = *rs_old / *pq;
+        *minus_alpha = -*alpha;
+      }
+
+
+
+      /**
+       * Compute <tt>*beta = *rs_new / *rs_old</tt>, move the new residual
+       * norm square into @p rs_old, and reset @p rs_new and @p pq for the
+       * next iteration. Launched with a single thread.
+       */
+      template <typename Number>
+      __global__ void
+      compute_beta(Number *beta, Number *rs_old, Number *rs_new, Number *pq)
+      {
+        *beta   = *rs_new / *rs_old;
+        *rs_old = *rs_new;
+        *rs_new = Number(0.);
+        *pq     = Number(0.);
+      }
+
+
+
+      /**
+       * Addition of a multiple of a vector with a device-resident
+       * coefficient, i.e., <tt>val += (*a) * V_val</tt>.
+       */
+      template <typename Number>
+      __global__ void
+      add_aV_device(Number                *val,
+                    const Number          *a,
+                    const Number          *V_val,
+                    const kernel_size_type N)
+      {
+        const kernel_size_type idx_base =
+          threadIdx.x + blockIdx.x * (blockDim.x * chunk_size);
+        for (unsigned int i = 0; i < chunk_size; ++i)
+          {
+            const kernel_size_type idx = idx_base + i * block_size;
+            if (idx < N)
+              val[idx] += (*a) * V_val[idx];
+          }
+      }
+
+
+
+      /**
+       * Update of the search direction with a device-resident coefficient,
+       * i.e., <tt>p = r + (*beta) * p</tt>.
+       */
+      template <typename Number>
+      __global__ void
+      update_direction(Number                *p,
+                       const Number          *beta,
+                       const Number          *r,
+                       const kernel_size_type N)
+      {
+        const kernel_size_type idx_base =
+          threadIdx.x + blockIdx.x * (blockDim.x * chunk_size);
+        for (unsigned int i = 0; i < chunk_size; ++i)
+          {
+            const kernel_size_type idx = idx_base + i * block_size;
+            if (idx < N)
+              p[idx] = r[idx] + (*beta) * p[idx];
+          }
+      }
+
+
+
+      /**
+       * Wrapper around cusparseSpMV() computing <tt>y = A x</tt> with
+       * device-resident constants and a work buffer that has been allocated
+       * up front.
+       */
+      template <typename Number>
+      void
+      spmv(cusparseHandle_t           handle,
+           const cusparseSpMatDescr_t sp_descr,
+           cusparseDnVecDescr_t       x_cuvec,
+           cusparseDnVecDescr_t       y_cuvec,
+           const Number              *one,
+           const Number              *zero,
+           const cudaDataType_t       cuda_data_type,
+           void                      *buffer)
+      {
+        const cusparseStatus_t error_code =
+          cusparseSpMV(handle,
+                       CUSPARSE_OPERATION_NON_TRANSPOSE,
+                       one,
+                       sp_descr,
+                       x_cuvec,
+                       zero,
+                       y_cuvec,
+                       cuda_data_type,
+                       CUSPARSE_MV_ALG_DEFAULT,
+                       buffer);
+        AssertCusparse(error_code);
+      }
+    } // namespace
+  }   // namespace internal
+
+
+
+  template <typename Number>
+  SolverCG<Number>::AdditionalData::AdditionalData(
+    const unsigned int convergence_check_interval,
+    const bool         use_graph_capture)
+    : convergence_check_interval(convergence_check_interval)
+    , use_graph_capture(use_graph_capture)
+  {}
+
+
+
+  template <typename Number>
+  SolverCG<Number>::SolverCG(const Utilities::CUDA::Handle &handle,
+                             SolverControl                 &cn,
+                             const AdditionalData          &data)
+    : cuda_handle(handle)
+    , solver_control(cn)
+    , additional_data(data)
+  {
+    Assert(additional_data.convergence_check_interval > 0,
+           ExcMessage("The convergence check interval must be at least one."));
+  }
+
+
+
+  template <typename Number>
+  SolverControl &
+  SolverCG<Number>::control() const
+  {
+    return solver_control;
+  }
+
+
+
+  template <typename Number>
+  void
+  SolverCG<Number>::solve(
+    const SparseMatrix<Number>                        &A,
+    LinearAlgebra::CUDAWrappers::Vector<Number>       &x,
+    const LinearAlgebra::CUDAWrappers::Vector<Number> &b)
+  {
+    using size_type = typename SparseMatrix<Number>::size_type;
+
+    AssertDimension(A.m(), A.n());
+    AssertDimension(A.m(), x.size());
+    AssertDimension(A.m(), b.size());
+
+    const size_type n        = A.m();
+    const int       n_blocks = 1 + (n - 1) / (chunk_size * block_size);
+
+    const cusparseSpMatDescr_t sp_descr =
+      std::get<4>(A.get_cusparse_matrix());
+
+    // All operations of the iteration are enqueued on a dedicated stream,
+    // both so that the host does not implicitly synchronize with the device
+    // and because graph capture is not available on the default stream.
+    cudaStream_t stream;
+    cudaError_t  cuda_error_code = cudaStreamCreate(&stream);
+    AssertCuda(cuda_error_code);
+    cusparseStatus_t cusparse_error_code =
+      cusparseSetStream(cuda_handle.cusparse_handle, stream);
+    AssertCusparse(cusparse_error_code);
+
+    // Auxiliary vectors: residual r, search direction p, and matrix-vector
+    // product q.
+    std::unique_ptr<Number[], void (*)(Number *)> r(
+      Utilities::CUDA::allocate_device_data<Number>(n),
+      Utilities::CUDA::delete_device_data<Number>);
+    std::unique_ptr<Number[], void (*)(Number *)> p(
+      Utilities::CUDA::allocate_device_data<Number>(n),
+      Utilities::CUDA::delete_device_data<Number>);
+    std::unique_ptr<Number[], void (*)(Number *)> q(
+      Utilities::CUDA::allocate_device_data<Number>(n),
+      Utilities::CUDA::delete_device_data<Number>);
+
+    // Device-resident scalars: the dot products p.q and r.r, the
+    // coefficients of the recurrence computed from them, and the constants
+    // of the matrix-vector product. No scalar is transferred to the host
+    // within an iteration.
+    constexpr unsigned int n_scalars = 7;
+    std::unique_ptr<Number[], void (*)(Number *)> scalars(
+      Utilities::CUDA::allocate_device_data<Number>(n_scalars),
+      Utilities::CUDA::delete_device_data<Number>);
+    Number *const rs_old      = scalars.get() + 0;
+    Number *const rs_new      = scalars.get() + 1;
+    Number *const pq          = scalars.get() + 2;
+    Number *const alpha       = scalars.get() + 3;
+    Number *const minus_alpha = scalars.get() + 4;
+    Number *const one         = scalars.get() + 5;
+    Number *const zero        = scalars.get() + 6;
+    {
+      const std::vector<Number> initial_scalars = {0., 0., 0., 0., 0., 1., 0.};
+      cuda_error_code = cudaMemcpyAsync(scalars.get(),
+                                        initial_scalars.data(),
+                                        n_scalars * sizeof(Number),
+                                        cudaMemcpyHostToDevice,
+                                        stream);
+      AssertCuda(cuda_error_code);
+      cuda_error_code = cudaStreamSynchronize(stream);
+      AssertCuda(cuda_error_code);
+    }
+
+    // The constants of cusparseSpMV() live in device memory as well, so
+    // that the call is free of host references and can be captured.
+    cusparse_error_code = cusparseSetPointerMode(
+      cuda_handle.cusparse_handle, CUSPARSE_POINTER_MODE_DEVICE);
+    AssertCusparse(cusparse_error_code);
+
+    // Dense vector descriptions of p and q and the work buffer of
+    // cusparseSpMV(), allocated once up front instead of in every product.
+    const cudaDataType_t cuda_data_type =
+      std::is_same_v<Number, float> ? CUDA_R_32F : CUDA_R_64F;
+    cusparseDnVecDescr_t p_cuvec;
+    cusparse_error_code = cusparseCreateDnVec(
+      &p_cuvec, n, reinterpret_cast<void *>(p.get()), cuda_data_type);
+    AssertCusparse(cusparse_error_code);
+    cusparseDnVecDescr_t q_cuvec;
+    cusparse_error_code = cusparseCreateDnVec(
+      &q_cuvec, n, reinterpret_cast<void *>(q.get()), cuda_data_type);
+    AssertCusparse(cusparse_error_code);
+
+    std::size_t buffer_size = 0;
+    cusparse_error_code     = cusparseSpMV_bufferSize(
+      cuda_handle.cusparse_handle,
+      CUSPARSE_OPERATION_NON_TRANSPOSE,
+      one,
+      sp_descr,
+      p_cuvec,
+      zero,
+      q_cuvec,
+      cuda_data_type,
+      CUSPARSE_MV_ALG_DEFAULT,
+      &buffer_size);
+    AssertCusparse(cusparse_error_code);
+    void *buffer    = nullptr;
+    cuda_error_code = cudaMalloc(&buffer, buffer_size);
+    AssertCuda(cuda_error_code);
+
+    // Compute the initial residual r = b - Ax and search direction p = r,
+    // re-using the descriptors of p and q: q = Ax with x copied into p.
+    cuda_error_code = cudaMemcpyAsync(p.get(),
+                                      x.get_values(),
+                                      n * sizeof(Number),
+                                      cudaMemcpyDeviceToDevice,
+                                      stream);
+    AssertCuda(cuda_error_code);
+    internal::spmv(cuda_handle.cusparse_handle,
+                   sp_descr,
+                   p_cuvec,
+                   q_cuvec,
+                   one,
+                   zero,
+                   cuda_data_type,
+                   buffer);
+    internal::compute_initial_residual<Number>
+      <<<n_blocks, block_size, 0, stream>>>(r.get(),
+                                            b.get_values(),
+                                            q.get(),
+                                            n);
+    AssertCudaKernel();
+    cuda_error_code = cudaMemcpyAsync(p.get(),
+                                      r.get(),
+                                      n * sizeof(Number),
+                                      cudaMemcpyDeviceToDevice,
+                                      stream);
+    AssertCuda(cuda_error_code);
+    LinearAlgebra::CUDAWrappers::kernel::double_vector_reduction<
+      Number,
+      LinearAlgebra::CUDAWrappers::kernel::DotProduct<Number>>
+      <<<n_blocks, block_size, 0, stream>>>(rs_old, r.get(), r.get(), n);
+    AssertCudaKernel();
+
+    // The body of one iteration. All launches are asynchronous with respect
+    // to the host and read their coefficients from device memory.
+    const auto enqueue_iteration = [&]() {
+      internal::spmv(cuda_handle.cusparse_handle,
+                     sp_descr,
+                     p_cuvec,
+                     q_cuvec,
+                     one,
+                     zero,
+                     cuda_data_type,
+                     buffer);
+      LinearAlgebra::CUDAWrappers::kernel::double_vector_reduction<
+        Number,
+        LinearAlgebra::CUDAWrappers::kernel::DotProduct<Number>>
+        <<<n_blocks, block_size, 0, stream>>>(pq, p.get(), q.get(), n);
+      internal::compute_alpha<Number>
+        <<<1, 1, 0, stream>>>(alpha, minus_alpha, rs_old, pq);
+      internal::add_aV_device<Number>
+        <<<n_blocks, block_size, 0, stream>>>(x.get_values(),
+                                              alpha,
+                                              p.get(),
+                                              n);
+      internal::add_aV_device<Number>
+        <<<n_blocks, block_size, 0, stream>>>(r.get(),
+                                              minus_alpha,
+                                              q.get(),
+                                              n);
+      LinearAlgebra::CUDAWrappers::kernel::double_vector_reduction<
+        Number,
+        LinearAlgebra::CUDAWrappers::kernel::DotProduct<Number>>
+        <<<n_blocks, block_size, 0, stream>>>(rs_new, r.get(), r.get(), n);
+      internal::compute_beta<Number>
+        <<<1, 1, 0, stream>>>(alpha, rs_old, rs_new, pq);
+      internal::update_direction<Number>
+        <<<n_blocks, block_size, 0, stream>>>(p.get(), alpha, r.get(), n);
+    };
+
+    // If requested, record the iteration into a graph whose replay then
+    // issues all kernels of an iteration with a single launch call.
+    cudaGraph_t     graph          = nullptr;
+    cudaGraphExec_t graph_instance = nullptr;
+    if (additional_data.use_graph_capture)
+      {
+        cuda_error_code =
+          cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal);
+        AssertCuda(cuda_error_code);
+        enqueue_iteration();
+        cuda_error_code = cudaStreamEndCapture(stream, &graph);
+        AssertCuda(cuda_error_code);
+        cuda_error_code =
+          cudaGraphInstantiate(&graph_instance, graph, nullptr, nullptr, 0);
+        AssertCuda(cuda_error_code);
+      }
+
+    // Fetch the norm of the initial residual for the first check, then
+    // iterate, letting the host look at the residual norm only every
+    // convergence_check_interval iterations.
+    Number residual_norm_square;
+    cuda_error_code = cudaMemcpyAsync(&residual_norm_square,
+                                      rs_old,
+                                      sizeof(Number),
+                                      cudaMemcpyDeviceToHost,
+                                      stream);
+    AssertCuda(cuda_error_code);
+    cuda_error_code = cudaStreamSynchronize(stream);
+    AssertCuda(cuda_error_code);
+
+    unsigned int          iteration = 0;
+    SolverControl::State  state =
+      solver_control.check(iteration, std::sqrt(residual_norm_square));
+    while (state == SolverControl::iterate)
+      {
+        for (unsigned int i = 0;
+             i < additional_data.convergence_check_interval;
+             ++i)
+          if (additional_data.use_graph_capture)
+            {
+              cuda_error_code = cudaGraphLaunch(graph_instance, stream);
+              AssertCuda(cuda_error_code);
+            }
+          else
+            enqueue_iteration();
+        iteration += additional_data.convergence_check_interval;
+
+        cuda_error_code = cudaMemcpyAsync(&residual_norm_square,
+                                          rs_old,
+                                          sizeof(Number),
+                                          cudaMemcpyDeviceToHost,
+                                          stream);
+        AssertCuda(cuda_error_code);
+        cuda_error_code = cudaStreamSynchronize(stream);
+        AssertCuda(cuda_error_code);
+
+        state =
+          solver_control.check(iteration, std::sqrt(residual_norm_square));
+      }
+
+    // Release all resources and restore the modes of the shared cuSPARSE
+    // handle before reporting the result.
+    if (graph_instance != nullptr)
+      {
+        cuda_error_code = cudaGraphExecDestroy(graph_instance);
+        AssertCuda(cuda_error_code);
+      }
+    if (graph != nullptr)
+      {
+        cuda_error_code = cudaGraphDestroy(graph);
+        AssertCuda(cuda_error_code);
+      }
+    cusparse_error_code = cusparseDestroyDnVec(p_cuvec);
+    AssertCusparse(cusparse_error_code);
+    cusparse_error_code = cusparseDestroyDnVec(q_cuvec);
+    AssertCusparse(cusparse_error_code);
+    cuda_error_code = cudaFree(buffer);
+    AssertCuda(cuda_error_code);
+    cusparse_error_code = cusparseSetPointerMode(cuda_handle.cusparse_handle,
+                                                 CUSPARSE_POINTER_MODE_HOST);
+    AssertCusparse(cusparse_error_code);
+    cusparse_error_code = cusparseSetStream(cuda_handle.cusparse_handle,
+                                            nullptr);
+    AssertCusparse(cusparse_error_code);
+    cuda_error_code = cudaStreamDestroy(stream);
+    AssertCuda(cuda_error_code);
+
+    AssertThrow(state == SolverControl::success,
+                SolverControl::NoConvergence(solver_control.last_step(),
+                                             solver_control.last_value()));
+  }
+
+
+  template class SolverCG<float>;
+  template class SolverCG<double>;
+} // namespace CUDAWrappers
+
+DEAL_II_NAMESPACE_CLOSE
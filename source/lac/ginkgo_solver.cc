@@ -29,31 +29,171 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace GinkgoWrappers
 {
+  namespace internal
+  {
+    /**
+     * Create the Ginkgo executor described by the string @p exec_type.
+     */
+    std::shared_ptr<gko::Executor>
+    create_executor(const std::string &exec_type)
+    {
+      std::shared_ptr<gko::Executor> executor;
+      if (exec_type == "reference")
+        {
+          executor = gko::ReferenceExecutor::create();
+        }
+      else if (exec_type == "omp")
+        {
+          executor = gko::OmpExecutor::create();
+        }
+      else if (exec_type == "cuda" && gko::CudaExecutor::get_num_devices() > 0)
+        {
+          executor = gko::CudaExecutor::create(0, gko::OmpExecutor::create());
+        }
+      else
+        {
+          Assert(
+            false,
+            ExcMessage(
+              " exec_type needs to be one of the three strings: \"reference\", \"cuda\" or \"omp\" "));
+        }
+      return executor;
+    }
+
+
+
+    /**
+     * Copy the deal.II matrix into a Ginkgo CSR matrix living on the device
+     * described by @p executor.
+     */
+    template <typename ValueType, typename IndexType>
+    std::shared_ptr<gko::matrix::Csr<ValueType, IndexType>>
+    copy_matrix_to_device(const std::shared_ptr<gko::Executor> &executor,
+                          const SparseMatrix<ValueType>        &matrix)
+    {
+      // Needs to be a square matrix
+      Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
+
+      using size_type   = dealii::types::global_dof_index;
+      const size_type N = matrix.m();
+
+      using mtx = gko::matrix::Csr<ValueType, IndexType>;
+      std::shared_ptr<mtx> system_matrix_compute;
+      system_matrix_compute   = mtx::create(executor->get_master(),
+                                          gko::dim<2>(N),
+                                          matrix.n_nonzero_elements());
+      ValueType *mat_values   = system_matrix_compute->get_values();
+      IndexType *mat_row_ptrs = system_matrix_compute->get_row_ptrs();
+      IndexType *mat_col_idxs = system_matrix_compute->get_col_idxs();
+
+      // Copy over the data from the matrix to the data structures Ginkgo
+      // needs.
+      //
+      // Final note: if the matrix has entries in the sparsity pattern that
+      // are actually occupied by entries that have a zero numerical value,
+      // then we keep them anyway. people are supposed to provide accurate
+      // sparsity patterns.
+
+      // first fill row lengths array
+      mat_row_ptrs[0] = 0;
+      for (size_type row = 1; row <= N; ++row)
+        mat_row_ptrs[row] =
+          mat_row_ptrs[row - 1] + matrix.get_row_length(row - 1);
+
+      // Copy over matrix elements. note that for sparse matrices,
+      // iterators are sorted so that they traverse each row from start to end
+      // before moving on to the next row. however, this isn't true for block
+      // matrices, so we have to do a bit of book keeping
+      {
+        // Have an array that for each row points to the first entry not yet
+        // written to
+        std::vector<IndexType> row_pointers(N + 1);
+        std::copy(system_matrix_compute->get_row_ptrs(),
+                  system_matrix_compute->get_row_ptrs() + N + 1,
+                  row_pointers.begin());
+
+        // Loop over the elements of the matrix row by row, as suggested in
+        // the documentation of the sparse matrix iterator class
+        for (size_type row = 0; row < N; ++row)
+          {
+            for (typename SparseMatrix<ValueType>::const_iterator p =
+                   matrix.begin(row);
+                 p != matrix.end(row);
+                 ++p)
+              {
+                // Write entry into the first free one for this row
+                mat_col_idxs[row_pointers[row]] = p->column();
+                mat_values[row_pointers[row]]   = p->value();
+
+                // Then move pointer ahead
+                ++row_pointers[row];
+              }
+          }
+
+        // At the end, we should have written all rows completely
+        for (size_type i = 0; i < N - 1; ++i)
+          Assert(row_pointers[i] == mat_row_ptrs[i + 1], ExcInternalError());
+      }
+      std::shared_ptr<mtx> system_matrix =
+        mtx::create(executor, gko::dim<2>(N), matrix.n_nonzero_elements());
+      system_matrix->copy_from(system_matrix_compute.get());
+
+      return system_matrix;
+    }
+
+
+
+    /**
+     * Overwrite the values of the Ginkgo CSR matrix @p system_matrix, which
+     * must have been created from a matrix with the same sparsity pattern as
+     * @p matrix by copy_matrix_to_device(), with the values of @p matrix. The
+     * row pointer and column index arrays on the device are left untouched.
+     */
+    template <typename ValueType, typename IndexType>
+    void
+    refresh_matrix_values(
+      const std::shared_ptr<gko::Executor> &executor,
+      const std::shared_ptr<gko::matrix::Csr<ValueType, IndexType>>
+                                    &system_matrix,
+      const SparseMatrix<ValueType> &matrix)
+    {
+      Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
+      AssertDimension(matrix.m(), system_matrix->get_size()[0]);
+      AssertDimension(matrix.n_nonzero_elements(),
+                      system_matrix->get_num_stored_elements());
+
+      using size_type   = dealii::types::global_dof_index;
+      const size_type N = matrix.m();
+
+      // collect the values on the host in the same row-by-row order in which
+      // copy_matrix_to_device() has written the column indices ...
+      std::vector<ValueType> values(matrix.n_nonzero_elements());
+      size_type              index = 0;
+      for (size_type row = 0; row < N; ++row)
+        for (typename SparseMatrix<ValueType>::const_iterator p =
+               matrix.begin(row);
+             p != matrix.end(row);
+             ++p, ++index)
+          values[index] = p->value();
+
+      // ... and copy them into the value array on the device
+      executor->copy_from(executor->get_master().get(),
+                          values.size(),
+                          values.data(),
+                          system_matrix->get_values());
+    }
+  } // namespace internal
+
+
+
   template <typename ValueType, typename IndexType>
   SolverBase<ValueType, IndexType>::SolverBase(SolverControl &solver_control,
                                                const std::string &exec_type)
     : solver_control(solver_control)
     , exec_type(exec_type)
   {
-    if (exec_type == "reference")
-      {
-        executor = gko::ReferenceExecutor::create();
-      }
-    else if (exec_type == "omp")
-      {
-        executor = gko::OmpExecutor::create();
-      }
-    else if (exec_type == "cuda" && gko::CudaExecutor::get_num_devices() > 0)
-      {
-        executor = gko::CudaExecutor::create(0, gko::OmpExecutor::create());
-      }
-    else
-      {
-        Assert(
-          false,
-          ExcMessage(
-            " exec_type needs to be one of the three strings: \"reference\", \"cuda\" or \"omp\" "));
-      }
+    executor = internal::create_executor(exec_type);
+
     using ResidualCriterionFactory = gko::stop::ResidualNormReduction<>;
     residual_criterion             = ResidualCriterionFactory::build()
                            .with_reduction_factor(solver_control.tolerance())
@@ -92,13 +232,11 @@ namespace GinkgoWrappers
     using vec       = gko::matrix::Dense<ValueType>;
 
     Assert(system_matrix, ExcNotInitialized());
+    Assert(generated_solver, ExcNotInitialized());
     Assert(executor, ExcNotInitialized());
     Assert(rhs.size() == solution.size(),
            ExcDimensionMismatch(rhs.size(), solution.size()));
 
-    // Generate the solver from the solver using the system matrix.
-    auto solver = solver_gen->generate(system_matrix);
-
     // Create the rhs vector in Ginkgo's format.
     std::vector<ValueType> f(rhs.size());
     std::copy(rhs.begin(), rhs.begin() + rhs.size(), f.begin());
@@ -127,8 +265,10 @@ namespace GinkgoWrappers
     // solver and other data
     combined_factory->add_logger(convergence_logger);
 
-    // Finally, apply the solver to b and get the solution in x.
-    solver->apply(gko::lend(b), gko::lend(x));
+    // Finally, apply the solver, which has been generated in initialize()
+    // and is reused together with the matrix and preconditioner on the
+    // device for all subsequent calls, to b and get the solution in x.
+    generated_solver->apply(gko::lend(b), gko::lend(x));
 
     // The convergence_logger object contains the residual vector after the
     // solver has returned. use this vector to compute the residual norm of the
@@ -217,71 +357,30 @@ namespace GinkgoWrappers
   SolverBase<ValueType, IndexType>::initialize(
     const SparseMatrix<ValueType> &matrix)
   {
-    // Needs to be a square matrix
-    Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
-
-    using size_type   = dealii::types::global_dof_index;
-    const size_type N = matrix.m();
-
-    using mtx = gko::matrix::Csr<ValueType, IndexType>;
-    std::shared_ptr<mtx> system_matrix_compute;
-    system_matrix_compute   = mtx::create(executor->get_master(),
-                                        gko::dim<2>(N),
-                                        matrix.n_nonzero_elements());
-    ValueType *mat_values   = system_matrix_compute->get_values();
-    IndexType *mat_row_ptrs = system_matrix_compute->get_row_ptrs();
-    IndexType *mat_col_idxs = system_matrix_compute->get_col_idxs();
-
-    // Copy over the data from the matrix to the data structures Ginkgo needs.
-    //
-    // Final note: if the matrix has entries in the sparsity pattern that are
-    // actually occupied by entries that have a zero numerical value, then we
-    // keep them anyway. people are supposed to provide accurate sparsity
-    // patterns.
-
-    // first fill row lengths array
-    mat_row_ptrs[0] = 0;
-    for (size_type row = 1; row <= N; ++row)
-      mat_row_ptrs[row] =
-        mat_row_ptrs[row - 1] + matrix.get_row_length(row - 1);
-
-    // Copy over matrix elements. note that for sparse matrices,
-    // iterators are sorted so that they traverse each row from start to end
-    // before moving on to the next row. however, this isn't true for block
-    // matrices, so we have to do a bit of book keeping
-    {
-      // Have an array that for each row points to the first entry not yet
-      // written to
-      std::vector<IndexType> row_pointers(N + 1);
-      std::copy(system_matrix_compute->get_row_ptrs(),
-                system_matrix_compute->get_row_ptrs() + N + 1,
-                row_pointers.begin());
-
-      // Loop over the elements of the matrix row by row, as suggested in the
-      // documentation of the sparse matrix iterator class
-      for (size_type row = 0; row < N; ++row)
-        {
-          for (typename SparseMatrix<ValueType>::const_iterator p =
-                 matrix.begin(row);
-               p != matrix.end(row);
-               ++p)
-            {
-              // Write entry into the first free one for this row
-              mat_col_idxs[row_pointers[row]] = p->column();
-              mat_values[row_pointers[row]]   = p->value();
-
-              // Then move pointer ahead
-              ++row_pointers[row];
-            }
-        }
+    system_matrix = internal::copy_matrix_to_device<ValueType, IndexType>(
+      executor, matrix);
 
-      // At the end, we should have written all rows completely
-      for (size_type i = 0; i < N - 1; ++i)
-        Assert(row_pointers[i] == mat_row_ptrs[i + 1], ExcInternalError());
-    }
-    system_matrix =
-      mtx::create(executor, gko::dim<2>(N), matrix.n_nonzero_elements());
-    system_matrix->copy_from(system_matrix_compute.get());
+    // Generate the solver from the system matrix once, so that repeated
+    // calls to apply() reuse the matrix and a possibly generated
+    // preconditioner on the device.
+    generated_solver = gko::share(solver_gen->generate(system_matrix));
+  }
+
+
+
+  template <typename ValueType, typename IndexType>
+  void
+  SolverBase<ValueType, IndexType>::update_values(
+    const SparseMatrix<ValueType> &matrix)
+  {
+    Assert(system_matrix, ExcNotInitialized());
+
+    internal::refresh_matrix_values(executor, system_matrix, matrix);
+
+    // Regenerating the solver recomputes the numerical part of a possible
+    // preconditioner from the updated values, while the structural data of
+    // the matrix on the device is kept.
+    generated_solver = gko::share(solver_gen->generate(system_matrix));
   }
 
 
@@ -509,6 +608,148 @@ namespace GinkgoWrappers
 
 
 
+  /* ---------------------- PreconditionBase ------------------------ */
+  template <typename ValueType, typename IndexType>
+  PreconditionBase<ValueType, IndexType>::PreconditionBase(
+    const std::string &exec_type)
+  {
+    executor = internal::create_executor(exec_type);
+  }
+
+
+
+  template <typename ValueType, typename IndexType>
+  void
+  PreconditionBase<ValueType, IndexType>::initialize(
+    const SparseMatrix<ValueType> &matrix)
+  {
+    Assert(preconditioner_gen, ExcNotInitialized());
+
+    system_matrix = internal::copy_matrix_to_device<ValueType, IndexType>(
+      executor, matrix);
+    preconditioner = gko::share(preconditioner_gen->generate(system_matrix));
+  }
+
+
+
+  template <typename ValueType, typename IndexType>
+  void
+  PreconditionBase<ValueType, IndexType>::update_values(
+    const SparseMatrix<ValueType> &matrix)
+  {
+    Assert(system_matrix, ExcNotInitialized());
+
+    internal::refresh_matrix_values(executor, system_matrix, matrix);
+    preconditioner = gko::share(preconditioner_gen->generate(system_matrix));
+  }
+
+
+
+  template <typename ValueType, typename IndexType>
+  void
+  PreconditionBase<ValueType, IndexType>::vmult(
+    Vector<ValueType>       &dst,
+    const Vector<ValueType> &src) const
+  {
+    // some shortcuts.
+    using val_array = gko::Array<ValueType>;
+    using vec       = gko::matrix::Dense<ValueType>;
+
+    Assert(preconditioner, ExcNotInitialized());
+    Assert(src.size() == dst.size(),
+           ExcDimensionMismatch(src.size(), dst.size()));
+
+    // Create the source vector in Ginkgo's format.
+    std::vector<ValueType> f(src.size());
+    std::copy(src.begin(), src.begin() + src.size(), f.begin());
+    auto b =
+      vec::create(executor,
+                  gko::dim<2>(src.size(), 1),
+                  val_array::view(executor->get_master(), src.size(), f.data()),
+                  1);
+
+    // Create the result vector in Ginkgo's format.
+    std::vector<ValueType> u(dst.size());
+    auto                   x = vec::create(executor,
+                         gko::dim<2>(dst.size(), 1),
+                         val_array::view(executor->get_master(),
+                                         dst.size(),
+                                         u.data()),
+                         1);
+
+    // Apply the preconditioner to b and get the result in x.
+    preconditioner->apply(gko::lend(b), gko::lend(x));
+
+    // Check if the result is on a CUDA device, if so, copy it over to the
+    // host.
+    if (executor != executor->get_master())
+      {
+        auto x_master = vec::create(executor->get_master(),
+                                    gko::dim<2>(dst.size(), 1),
+                                    val_array::view(executor,
+                                                    dst.size(),
+                                                    x->get_values()),
+                                    1);
+        x.reset(x_master.release());
+      }
+    // Finally copy over the result to deal.II's vector.
+    std::copy(x->get_values(), x->get_values() + dst.size(), dst.begin());
+  }
+
+
+
+  template <typename ValueType, typename IndexType>
+  const std::shared_ptr<gko::LinOpFactory> &
+  PreconditionBase<ValueType, IndexType>::get_factory() const
+  {
+    return preconditioner_gen;
+  }
+
+
+
+  /* ---------------------- PreconditionJacobi ------------------------ */
+  template <typename ValueType, typename IndexType>
+  PreconditionJacobi<ValueType, IndexType>::AdditionalData::AdditionalData(
+    const unsigned int max_block_size)
+    : max_block_size(max_block_size)
+  {}
+
+
+
+  template <typename ValueType, typename IndexType>
+  PreconditionJacobi<ValueType, IndexType>::PreconditionJacobi(
+    const std::string    &exec_type,
+    const AdditionalData &data)
+    : PreconditionBase<ValueType, IndexType>(exec_type)
+    , additional_data(data)
+  {
+    using jacobi = gko::preconditioner::Jacobi<ValueType, IndexType>;
+    this->preconditioner_gen =
+      jacobi::build()
+        .with_max_block_size(additional_data.max_block_size)
+        .on(this->executor);
+  }
+
+
+
+  /* ---------------------- PreconditionILU ------------------------ */
+  template <typename ValueType, typename IndexType>
+  PreconditionILU<ValueType, IndexType>::PreconditionILU(
+    const std::string    &exec_type,
+    const AdditionalData &data)
+    : PreconditionBase<ValueType, IndexType>(exec_type)
+    , additional_data(data)
+  {
+    using ilu = gko::preconditioner::
+      Ilu<gko::solver::LowerTrs<ValueType, IndexType>,
+          gko::solver::UpperTrs<ValueType, IndexType>,
+          false,
+          IndexType>;
+    this->preconditioner_gen = ilu::build().on(this->executor);
+  }
+
+
+
   // Explicit instantiations in GinkgoWrappers
 #  define DEALII_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(_macro) \
     template _macro(float, int32_t);                               \
@@ -551,6 +792,21 @@ namespace GinkgoWrappers
   DEALII_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(DECLARE_SOLVER_IR)
 #  undef DECLARE_SOLVER_IR
 
+#  define DECLARE_PRECONDITION_BASE(ValueType, IndexType) \
+    class PreconditionBase<ValueType, IndexType>
+  DEALII_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(DECLARE_PRECONDITION_BASE)
+#  undef DECLARE_PRECONDITION_BASE
+
+#  define DECLARE_PRECONDITION_JACOBI(ValueType, IndexType) \
+    class PreconditionJacobi<ValueType, IndexType>
+  DEALII_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(DECLARE_PRECONDITION_JACOBI)
+#  undef DECLARE_PRECONDITION_JACOBI
+
+#  define DECLARE_PRECONDITION_ILU(ValueType, IndexType) \
+    class PreconditionILU<ValueType, IndexType>
+  DEALII_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(DECLARE_PRECONDITION_ILU)
+#  undef DECLARE_PRECONDITION_ILU
+
 } // namespace GinkgoWrappers
 
 
@@ -282,6 +282,21 @@ namespace PETScWrappers
 
 
 
+  void
+  MatrixBase::flush_assembly()
+  {
+    // exchange the off-process entries accumulated so far with their owning
+    // processes, but do not compress the matrix storage: further entries can
+    // still be added afterwards
+    PetscErrorCode ierr = MatAssemblyBegin(matrix, MAT_FLUSH_ASSEMBLY);
+    AssertThrow(ierr == 0, ExcPETScError(ierr));
+
+    ierr = MatAssemblyEnd(matrix, MAT_FLUSH_ASSEMBLY);
+    AssertThrow(ierr == 0, ExcPETScError(ierr));
+  }
+
+
+
   MatrixBase::size_type
   MatrixBase::m() const
   {
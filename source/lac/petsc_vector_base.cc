@@ -539,6 +539,18 @@ namespace PETScWrappers
   void
   VectorBase::compress(const VectorOperation::values operation)
   {
+    compress_start(0, operation);
+    compress_finish(operation);
+  }
+
+
+
+  void
+  VectorBase::compress_start(const unsigned int            communication_channel,
+                             const VectorOperation::values operation)
+  {
+    (void)communication_channel;
+
     Assert(has_ghost_elements() == false,
            ExcMessage("Calling compress() is only useful if a vector "
                       "has been written into, but this is a vector with ghost "
@@ -587,9 +599,18 @@ namespace PETScWrappers
     // we still need to call
     // VecAssemblyBegin/End on all
     // processors.
-    PetscErrorCode ierr = VecAssemblyBegin(vector);
+    const PetscErrorCode ierr = VecAssemblyBegin(vector);
     AssertThrow(ierr == 0, ExcPETScError(ierr));
-    ierr = VecAssemblyEnd(vector);
+  }
+
+
+
+  void
+  VectorBase::compress_finish(const VectorOperation::values operation)
+  {
+    (void)operation;
+
+    const PetscErrorCode ierr = VecAssemblyEnd(vector);
     AssertThrow(ierr == 0, ExcPETScError(ierr));
 
     // reset the last action field to
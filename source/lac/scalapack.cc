@@ -29,6 +29,7 @@
 
 #  include <limits>
 #  include <memory>
+#  include <random>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -2138,6 +2139,228 @@ ScaLAPACKMatrix<NumberType>::compute_SVD(ScaLAPACKMatrix<NumberType> *U,
 
 
 
+template <typename NumberType>
+void
+ScaLAPACKMatrix<NumberType>::orthonormalize_columns()
+{
+  Assert(state == LAPACKSupport::matrix,
+         ExcMessage(
+           "Matrix has to be in Matrix state before calling this function."));
+  Assert(n_rows >= n_columns, ExcDimensionMismatch(n_rows, n_columns));
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (grid->mpi_process_is_active)
+    {
+      NumberType *A_loc = this->values.data();
+      int         info  = 0;
+
+      // compute the QR factorization; the scalar factors of the elementary
+      // reflectors are stored by column, so a local array of size
+      // LOCc(min(M,N)) <= n_local_columns suffices
+      std::vector<NumberType> tau(std::max(1, n_local_columns));
+      int                     lwork = -1;
+      work.resize(1);
+      pgeqrf(&n_rows,
+             &n_columns,
+             A_loc,
+             &submatrix_row,
+             &submatrix_column,
+             descriptor,
+             tau.data(),
+             work.data(),
+             &lwork,
+             &info);
+      AssertThrow(info == 0, LAPACKSupport::ExcErrorCode("pgeqrf", info));
+      lwork = static_cast<int>(work[0]);
+      work.resize(lwork);
+      pgeqrf(&n_rows,
+             &n_columns,
+             A_loc,
+             &submatrix_row,
+             &submatrix_column,
+             descriptor,
+             tau.data(),
+             work.data(),
+             &lwork,
+             &info);
+      AssertThrow(info == 0, LAPACKSupport::ExcErrorCode("pgeqrf", info));
+
+      // overwrite the factorization by the explicit representation of Q
+      lwork = -1;
+      work.resize(1);
+      porgqr(&n_rows,
+             &n_columns,
+             &n_columns,
+             A_loc,
+             &submatrix_row,
+             &submatrix_column,
+             descriptor,
+             tau.data(),
+             work.data(),
+             &lwork,
+             &info);
+      AssertThrow(info == 0, LAPACKSupport::ExcErrorCode("porgqr", info));
+      lwork = static_cast<int>(work[0]);
+      work.resize(lwork);
+      porgqr(&n_rows,
+             &n_columns,
+             &n_columns,
+             A_loc,
+             &submatrix_row,
+             &submatrix_column,
+             descriptor,
+             tau.data(),
+             work.data(),
+             &lwork,
+             &info);
+      AssertThrow(info == 0, LAPACKSupport::ExcErrorCode("porgqr", info));
+    }
+
+  property = LAPACKSupport::Property::general;
+}
+
+
+
+template <typename NumberType>
+std::vector<NumberType>
+ScaLAPACKMatrix<NumberType>::compute_randomized_SVD(
+  const unsigned int           rank,
+  ScaLAPACKMatrix<NumberType> *U,
+  ScaLAPACKMatrix<NumberType> *VT,
+  const unsigned int           oversampling,
+  const unsigned int           n_power_iterations,
+  const unsigned int           seed)
+{
+  Assert(state == LAPACKSupport::matrix,
+         ExcMessage(
+           "Matrix has to be in Matrix state before calling this function."));
+  Assert(row_block_size == column_block_size,
+         ExcDimensionMismatch(row_block_size, column_block_size));
+  Assert(rank > 0, ExcMessage("The rank of the factorization must be >= 1"));
+  AssertIndexRange(rank + oversampling,
+                   static_cast<unsigned int>(std::min(n_rows, n_columns)) + 1);
+
+  if (U != nullptr)
+    {
+      Assert(n_rows == U->n_rows, ExcDimensionMismatch(n_rows, U->n_rows));
+      Assert(static_cast<int>(rank) == U->n_columns,
+             ExcDimensionMismatch(rank, U->n_columns));
+      Assert(row_block_size == U->row_block_size,
+             ExcDimensionMismatch(row_block_size, U->row_block_size));
+      Assert(column_block_size == U->column_block_size,
+             ExcDimensionMismatch(column_block_size, U->column_block_size));
+      Assert(grid->blacs_context == U->grid->blacs_context,
+             ExcDimensionMismatch(grid->blacs_context, U->grid->blacs_context));
+    }
+  if (VT != nullptr)
+    {
+      Assert(static_cast<int>(rank) == VT->n_rows,
+             ExcDimensionMismatch(rank, VT->n_rows));
+      Assert(n_columns == VT->n_columns,
+             ExcDimensionMismatch(n_columns, VT->n_columns));
+      Assert(row_block_size == VT->row_block_size,
+             ExcDimensionMismatch(row_block_size, VT->row_block_size));
+      Assert(column_block_size == VT->column_block_size,
+             ExcDimensionMismatch(column_block_size, VT->column_block_size));
+      Assert(grid->blacs_context == VT->grid->blacs_context,
+             ExcDimensionMismatch(grid->blacs_context,
+                                  VT->grid->blacs_context));
+    }
+
+  const int k = rank + oversampling;
+
+  // fill the Gaussian random test matrix; every process seeds its own
+  // engine so that no communication is needed and the result is
+  // reproducible for a fixed process grid
+  ScaLAPACKMatrix<NumberType> Omega(
+    n_columns, k, grid, row_block_size, row_block_size);
+  if (grid->mpi_process_is_active)
+    {
+      std::mt19937                       engine(seed + grid->this_mpi_process);
+      std::normal_distribution<NumberType> distribution(0., 1.);
+      for (int i = 0; i < Omega.n_local_rows; ++i)
+        for (int j = 0; j < Omega.n_local_columns; ++j)
+          Omega.local_el(i, j) = distribution(engine);
+    }
+
+  // sample the range of the matrix and orthonormalize the sample
+  ScaLAPACKMatrix<NumberType> Q(
+    n_rows, k, grid, row_block_size, row_block_size);
+  this->mmult(Q, Omega);
+  Q.orthonormalize_columns();
+
+  // optional subspace iterations Q <- orth(A * orth(A^T * Q)) to improve
+  // the approximation of the dominant singular space for matrices with
+  // slowly decaying singular values
+  if (n_power_iterations > 0)
+    {
+      ScaLAPACKMatrix<NumberType> Z(
+        n_columns, k, grid, row_block_size, row_block_size);
+      for (unsigned int it = 0; it < n_power_iterations; ++it)
+        {
+          this->Tmmult(Z, Q);
+          Z.orthonormalize_columns();
+          this->mmult(Q, Z);
+          Q.orthonormalize_columns();
+        }
+    }
+
+  // restrict the matrix to the sampled subspace: B = Q^T * A
+  ScaLAPACKMatrix<NumberType> B(
+    k, n_columns, grid, row_block_size, row_block_size);
+  Q.Tmmult(B, *this);
+
+  // compute the SVD of the small matrix B = U_B * Sigma * VT_B. Only the
+  // k x k matrix of left singular vectors is computed; the right singular
+  // vectors are recovered below as VT = Sigma^{-1} * U_B^T * B, which
+  // avoids allocating an N x N matrix for strongly rectangular input.
+  ScaLAPACKMatrix<NumberType> B_copy(
+    k, n_columns, grid, row_block_size, row_block_size);
+  B.copy_to(B_copy);
+  ScaLAPACKMatrix<NumberType> U_B(
+    k, k, grid, row_block_size, row_block_size);
+  std::vector<NumberType> sv = B.compute_SVD(&U_B, nullptr);
+  AssertThrow(sv[0] > std::numeric_limits<NumberType>::min(),
+              ExcMessage("Matrix has rank 0"));
+
+  if (U != nullptr)
+    {
+      // lift the left singular vectors back to the full space and keep the
+      // leading columns: U = Q * U_B
+      ScaLAPACKMatrix<NumberType> U_full(
+        n_rows, k, grid, row_block_size, row_block_size);
+      Q.mmult(U_full, U_B);
+      U_full.copy_to(*U,
+                     std::make_pair(0, 0),
+                     std::make_pair(0, 0),
+                     std::make_pair(n_rows, rank));
+      U->state = LAPACKSupport::matrix;
+    }
+  if (VT != nullptr)
+    {
+      ScaLAPACKMatrix<NumberType> VT_full(
+        k, n_columns, grid, row_block_size, row_block_size);
+      U_B.Tmmult(VT_full, B_copy);
+
+      std::vector<NumberType> inv_sigma(k);
+      for (int i = 0; i < k; ++i)
+        inv_sigma[i] = (sv[i] > std::numeric_limits<NumberType>::min()) ?
+                         1 / sv[i] :
+                         NumberType();
+      VT_full.scale_rows(inv_sigma);
+      VT_full.copy_to(*VT,
+                      std::make_pair(0, 0),
+                      std::make_pair(0, 0),
+                      std::make_pair(rank, n_columns));
+      VT->state = LAPACKSupport::matrix;
+    }
+
+  sv.resize(rank);
+  return sv;
+}
+
+
+
 template <typename NumberType>
 void
 ScaLAPACKMatrix<NumberType>::least_squares(ScaLAPACKMatrix<NumberType> &B,
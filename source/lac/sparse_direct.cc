@@ -253,10 +253,23 @@ SparseDirectUMFPACK::factorize(const Matrix &matrix)
 {
   Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
 
-  clear();
-
   using number = typename Matrix::value_type;
 
+  // Move the sparsity pattern of the previous factorization out of the way
+  // before releasing everything else: we need it further down to decide
+  // whether the symbolic decomposition can be reused. The same goes for the
+  // symbolic decomposition itself, which clear() would otherwise free.
+  std::vector<types::suitesparse_index> previous_Ap;
+  std::vector<types::suitesparse_index> previous_Ai;
+  previous_Ap.swap(Ap);
+  previous_Ai.swap(Ai);
+  const bool previous_was_complex = (Az.size() != 0);
+
+  void *previous_symbolic_decomposition = symbolic_decomposition;
+  symbolic_decomposition                = nullptr;
+
+  clear();
+
   n_rows = matrix.m();
   n_cols = matrix.n();
 
@@ -325,28 +338,46 @@ SparseDirectUMFPACK::factorize(const Matrix &matrix)
   // different function
   sort_arrays(matrix);
 
+  // The symbolic analysis only depends on the sparsity pattern of the
+  // matrix, not on its entries. If the pattern is unchanged from the
+  // previous call to this function (and both matrices are real-valued or
+  // both are complex-valued), we can therefore reuse the previous symbolic
+  // decomposition and only have to redo the numeric factorization. This
+  // saves a substantial fraction of the factorization time, for example
+  // when refactoring the Jacobian in every step of a Newton iteration on an
+  // unchanged mesh.
   int status;
-  if (numbers::NumberTraits<number>::is_complex == false)
-    status = umfpack_dl_symbolic(N,
-                                 N,
-                                 Ap.data(),
-                                 Ai.data(),
-                                 Ax.data(),
-                                 &symbolic_decomposition,
-                                 control.data(),
-                                 nullptr);
+  if ((previous_symbolic_decomposition != nullptr) &&
+      (previous_was_complex == numbers::NumberTraits<number>::is_complex) &&
+      (previous_Ap == Ap) && (previous_Ai == Ai))
+    symbolic_decomposition = previous_symbolic_decomposition;
   else
-    status = umfpack_zl_symbolic(N,
-                                 N,
-                                 Ap.data(),
-                                 Ai.data(),
-                                 Ax.data(),
-                                 Az.data(),
-                                 &symbolic_decomposition,
-                                 control.data(),
-                                 nullptr);
-  AssertThrow(status == UMFPACK_OK,
-              ExcUMFPACKError("umfpack_dl_symbolic", status));
+    {
+      if (previous_symbolic_decomposition != nullptr)
+        umfpack_dl_free_symbolic(&previous_symbolic_decomposition);
+
+      if (numbers::NumberTraits<number>::is_complex == false)
+        status = umfpack_dl_symbolic(N,
+                                     N,
+                                     Ap.data(),
+                                     Ai.data(),
+                                     Ax.data(),
+                                     &symbolic_decomposition,
+                                     control.data(),
+                                     nullptr);
+      else
+        status = umfpack_zl_symbolic(N,
+                                     N,
+                                     Ap.data(),
+                                     Ai.data(),
+                                     Ax.data(),
+                                     Az.data(),
+                                     &symbolic_decomposition,
+                                     control.data(),
+                                     nullptr);
+      AssertThrow(status == UMFPACK_OK,
+                  ExcUMFPACKError("umfpack_dl_symbolic", status));
+    }
 
   if (numbers::NumberTraits<number>::is_complex == false)
     status = umfpack_dl_numeric(Ap.data(),
@@ -368,7 +399,9 @@ SparseDirectUMFPACK::factorize(const Matrix &matrix)
   AssertThrow(status == UMFPACK_OK,
               ExcUMFPACKError("umfpack_dl_numeric", status));
 
-  umfpack_dl_free_symbolic(&symbolic_decomposition);
+  // Keep the symbolic decomposition around: the next call to this function
+  // can reuse it if the sparsity pattern has not changed in the meantime.
+  // It is eventually released in clear().
 }
 
 
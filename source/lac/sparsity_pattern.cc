@@ -539,6 +539,50 @@ SparsityPattern::copy_from(const DynamicSparsityPattern &dsp)
 
 
 
+void
+SparsityPattern::copy_from(DynamicSparsityPattern &&dsp)
+{
+  // same algorithm as the copy_from() function for a constant argument
+  // above, except that each row of the source pattern is released right
+  // after it has been consumed in order to keep the peak memory low
+  const bool  do_diag_optimize = (dsp.n_rows() == dsp.n_cols());
+  const auto &row_index_set    = dsp.row_index_set();
+
+  std::vector<unsigned int> row_lengths(dsp.n_rows());
+
+  for (size_type i = 0; i < dsp.n_rows(); ++i)
+    {
+      if (row_index_set.size() == 0 || row_index_set.is_element(i))
+        {
+          row_lengths[i] = dsp.row_length(i);
+          if (do_diag_optimize && !dsp.exists(i, i))
+            ++row_lengths[i];
+        }
+      else
+        row_lengths[i] = do_diag_optimize ? 1 : 0;
+    }
+  reinit(dsp.n_rows(), dsp.n_cols(), row_lengths);
+
+  if (n_rows() != 0 && n_cols() != 0)
+    for (size_type row = 0; row < dsp.n_rows(); ++row)
+      {
+        size_type *cols = &colnums[rowstart[row]] + (do_diag_optimize ? 1 : 0);
+        const unsigned int row_length = dsp.row_length(row);
+        for (unsigned int index = 0; index < row_length; ++index)
+          {
+            const size_type col = dsp.column_number(row, index);
+            if ((col != row) || !do_diag_optimize)
+              *cols++ = col;
+          }
+
+        dsp.clear_row(row);
+      }
+
+  compressed = true;
+}
+
+
+
 template <typename number>
 void
 SparsityPattern::copy_from(const FullMatrix<number> &matrix)
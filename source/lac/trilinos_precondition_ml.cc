@@ -316,6 +316,34 @@ namespace TrilinosWrappers
 
 
 
+  template <typename number>
+  void
+  PreconditionAMG::update_values(
+    const ::dealii::SparseMatrix<number> &deal_ii_sparse_matrix)
+  {
+    Assert(trilinos_matrix.get() != nullptr,
+           ExcMessage("update_values() can only be called after the "
+                      "preconditioner has been set up through the "
+                      "initialize() function taking a deal.II sparse "
+                      "matrix."));
+    AssertDimension(trilinos_matrix->m(), deal_ii_sparse_matrix.m());
+    AssertDimension(trilinos_matrix->n(), deal_ii_sparse_matrix.n());
+
+    // Copy the new values into the internally stored Trilinos matrix by
+    // walking its sparsity pattern. This keeps the Epetra matrix object the
+    // multilevel hierarchy references (and its structure) unchanged, and
+    // automatically skips entries that were dropped when the pattern was
+    // created.
+    for (auto entry = trilinos_matrix->begin(); entry != trilinos_matrix->end();
+         ++entry)
+      entry->value() = deal_ii_sparse_matrix.el(entry->row(), entry->column());
+    trilinos_matrix->compress(VectorOperation::insert);
+
+    reinit();
+  }
+
+
+
   void
   PreconditionAMG::clear()
   {
@@ -351,6 +379,11 @@ namespace TrilinosWrappers
                               const AdditionalData &,
                               const double,
                               const ::dealii::SparsityPattern *);
+
+  template void
+  PreconditionAMG::update_values(const ::dealii::SparseMatrix<double> &);
+  template void
+  PreconditionAMG::update_values(const ::dealii::SparseMatrix<float> &);
 #  endif
 
 
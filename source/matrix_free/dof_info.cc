@@ -553,8 +553,6 @@ namespace internal
       dof_indices_contiguous[dof_access_cell].resize(
         irregular_cells.size() * vectorization_length,
         numbers::invalid_unsigned_int);
-      dof_indices_interleaved.resize(dof_indices.size(),
-                                     numbers::invalid_unsigned_int);
       dof_indices_interleave_strides[dof_access_cell].resize(
         irregular_cells.size() * vectorization_length,
         numbers::invalid_unsigned_int);
@@ -846,7 +844,14 @@ namespace internal
                 index_storage_variants[dof_access_cell][i])]++;
             }
 
-      // Step 4: Copy the interleaved indices into their own data structure
+      // Step 4: Copy the interleaved indices into their own data structure,
+      // which is only allocated in case the interleaved kind is actually in
+      // use - otherwise, this array would double the memory spent on index
+      // storage without ever being accessed
+      if (index_kinds[static_cast<unsigned int>(
+            IndexStorageVariants::interleaved)] > 0)
+        dof_indices_interleaved.resize(dof_indices.size(),
+                                       numbers::invalid_unsigned_int);
       for (unsigned int i = 0; i < irregular_cells.size(); ++i)
         if (index_storage_variants[dof_access_cell][i] ==
             IndexStorageVariants::interleaved)
@@ -1571,21 +1576,24 @@ namespace internal
       const std::vector<std::vector<unsigned int>> &,
       const unsigned int,
       const TriaIterator<DoFCellAccessor<1, 1, false>> &,
-      std::vector<types::global_dof_index> &);
+      std::vector<types::global_dof_index> &,
+      const ConstraintKinds &);
     template bool
     DoFInfo::process_hanging_node_constraints<2>(
       const HangingNodes<2> &,
       const std::vector<std::vector<unsigned int>> &,
       const unsigned int,
       const TriaIterator<DoFCellAccessor<2, 2, false>> &,
-      std::vector<types::global_dof_index> &);
+      std::vector<types::global_dof_index> &,
+      const ConstraintKinds &);
     template bool
     DoFInfo::process_hanging_node_constraints<3>(
       const HangingNodes<3> &,
       const std::vector<std::vector<unsigned int>> &,
       const unsigned int,
       const TriaIterator<DoFCellAccessor<3, 3, false>> &,
-      std::vector<types::global_dof_index> &);
+      std::vector<types::global_dof_index> &,
+      const ConstraintKinds &);
 
     template void
     DoFInfo::compute_face_index_compression<1>(
@@ -29,8 +29,10 @@
 #ifdef DEAL_II_WITH_TBB
 #  include <tbb/blocked_range.h>
 #  include <tbb/parallel_for.h>
-#  include <tbb/task.h>
-#  ifndef DEAL_II_TBB_WITH_ONEAPI
+#  ifdef DEAL_II_TBB_WITH_ONEAPI
+#    include <tbb/task_group.h>
+#  else
+#    include <tbb/task.h>
 #    include <tbb/task_scheduler_init.h>
 #  endif
 #endif
@@ -42,16 +44,12 @@
 // TBB with oneAPI API has deprecated and removed the
 // <code>tbb::tasks</code> backend. With this it is no longer possible to
 // compile the following code that builds a directed acyclic graph (DAG) of
-// (thread parallel) tasks without a major porting effort. It turned out
-// that such a dynamic handling of dependencies and structures is not as
-// competitive as initially assumed. Consequently, this part of the matrix
-// free infrastructure has seen less attention than the rest over the last
-// years and is (presumably) not used that often.
-//
-// In case of detected oneAPI backend we simply disable threading in the
-// matrix free backend for now.
-//
-// Matthias Maier, Martin Kronbichler, 2021
+// (thread parallel) tasks without a major porting effort. For the oneAPI
+// backend, the dependency graph of the partition-partition scheme is
+// instead expressed through a tbb::task_group further down in this file:
+// the partitions are scheduled in waves of mutually independent partitions
+// onto the work-stealing scheduler, which keeps the overlap of interior
+// cell work with the MPI ghost exchange intact.
 //
 
 DEAL_II_NAMESPACE_OPEN
@@ -344,6 +342,55 @@ namespace internal
 
 #endif // DEAL_II_WITH_TBB
 
+#if defined(DEAL_II_WITH_TBB) && defined(DEAL_II_TBB_WITH_ONEAPI)
+
+    // With the oneAPI backend of TBB, the low-level tbb::task interface used
+    // above to encode the dependency graph of the partition-partition scheme
+    // is no longer available. We instead express the same dependencies
+    // through a tbb::task_group: The partitions are processed in two waves
+    // of mutually independent partitions (partitions of the same parity do
+    // not share degrees of freedom by construction of
+    // TaskInfo::make_partitioning), and the work-stealing scheduler
+    // dynamically balances the cell batches within each wave. The odd
+    // partitions consist of interior cells only and thus overlap with the
+    // MPI ghost exchange, whereas partition 0 contains all cells touching
+    // ghosted entries, so the compress() export can start as soon as it has
+    // been processed.
+    namespace taskgraph
+    {
+      // Process the cell (and possibly face) chunks of one outer partition.
+      // Within the partition, the chunks are again grouped into an even/odd
+      // structure where chunks of the same parity are independent and can be
+      // processed concurrently.
+      inline void
+      process_partition(MFWorkerInterface &funct,
+                        const TaskInfo    &task_info,
+                        const unsigned int partition)
+      {
+        const unsigned int evens  = task_info.partition_evens[partition];
+        const unsigned int odds   = task_info.partition_odds[partition];
+        const unsigned int offset = task_info.partition_row_index[partition];
+
+        const auto do_chunk = [&](const unsigned int chunk) {
+          funct.cell(offset + chunk);
+          if (task_info.face_partition_data.empty() == false)
+            {
+              funct.face(offset + chunk);
+              funct.boundary(offset + chunk);
+            }
+        };
+
+        tbb::parallel_for(0U, odds, [&](const unsigned int j) {
+          do_chunk(2 * j + 1);
+        });
+        tbb::parallel_for(0U, evens, [&](const unsigned int j) {
+          do_chunk(2 * j);
+        });
+      }
+    } // end of namespace taskgraph
+
+#endif // DEAL_II_WITH_TBB && DEAL_II_TBB_WITH_ONEAPI
+
 
 
     void
@@ -601,6 +648,83 @@ namespace internal
             }
         }
       else
+#elif defined(DEAL_II_WITH_TBB)
+
+      // oneAPI backend: schedule the partitions as dependency-tracked tasks
+      // on a tbb::task_group, see the documentation of the taskgraph
+      // namespace above.
+      if (scheme != none)
+        {
+          funct.zero_dst_vector_range(numbers::invalid_unsigned_int);
+          if (scheme == partition_partition && evens > 0)
+            {
+              tbb::task_group group;
+
+              // The odd partitions consist of interior cells and are
+              // processed while the ghost exchange is in flight.
+              for (unsigned int j = 0; j < odds; ++j)
+                group.run([&funct, this, j]() {
+                  taskgraph::process_partition(funct, *this, 2 * j + 1);
+                });
+              funct.vector_update_ghosts_finish();
+              group.wait();
+
+              // The even partitions are mutually independent. Partition 0
+              // contains all cells contributing to the data exchanged in
+              // compress(), so the export is started as soon as it has been
+              // processed.
+              group.run([&funct, this]() {
+                taskgraph::process_partition(funct, *this, 0);
+                funct.vector_compress_start();
+              });
+              for (unsigned int j = 1; j < evens; ++j)
+                group.run([&funct, this, j]() {
+                  taskgraph::process_partition(funct, *this, 2 * j);
+                });
+              group.wait();
+            }
+          else if (scheme == partition_partition)
+            {
+              // catch the case of empty partition list: we still need to call
+              // the vector communication routines to clean up and initiate
+              // things
+              funct.vector_update_ghosts_finish();
+              funct.vector_compress_start();
+            }
+          else // partition-color and color schemes
+            {
+              funct.vector_update_ghosts_finish();
+              for (unsigned int part = 0;
+                   part < partition_row_index.size() - 1;
+                   ++part)
+                for (unsigned int color = partition_row_index[part];
+                     color < partition_row_index[part + 1];
+                     ++color)
+                  {
+                    // chunks within one color are independent of each other
+                    Assert(face_partition_data.empty(), ExcNotImplemented());
+                    const unsigned int n_chunks =
+                      (cell_partition_data[color + 1] -
+                       cell_partition_data[color] + block_size - 1) /
+                      block_size;
+                    tbb::parallel_for(0U,
+                                      n_chunks,
+                                      [&](const unsigned int chunk) {
+                                        const unsigned int start_index =
+                                          cell_partition_data[color] +
+                                          block_size * chunk;
+                                        const unsigned int end_index =
+                                          std::min(start_index + block_size,
+                                                   cell_partition_data[color +
+                                                                       1]);
+                                        funct.cell(std::make_pair(start_index,
+                                                                  end_index));
+                                      });
+                  }
+              funct.vector_compress_start();
+            }
+        }
+      else
 #endif
         // serial loop, go through up to three times and do the MPI transfer at
         // the beginning/end of the second part
@@ -13,6 +13,8 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/distributed/tria.h>
 
 #include <deal.II/dofs/dof_tools.h>
@@ -468,13 +470,29 @@ namespace internal
     {
       localized_indices.resize(mine.size() + remote.size(),
                                numbers::invalid_unsigned_int);
-      for (unsigned int i = 0; i < mine.size(); ++i)
-        if (mine[i] != numbers::invalid_dof_index)
-          localized_indices[i] = part.global_to_local(mine[i]);
 
-      for (unsigned int i = 0; i < remote.size(); ++i)
-        if (remote[i] != numbers::invalid_dof_index)
-          localized_indices[i + mine.size()] = part.global_to_local(remote[i]);
+      // the translation of each index only reads from the partitioner, so we
+      // can distribute the (possibly long) arrays onto several threads
+      parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(mine.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
+            if (mine[i] != numbers::invalid_dof_index)
+              localized_indices[i] = part.global_to_local(mine[i]);
+        },
+        512);
+
+      parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(remote.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
+            if (remote[i] != numbers::invalid_dof_index)
+              localized_indices[i + mine.size()] =
+                part.global_to_local(remote[i]);
+        },
+        512);
     }
 
 
@@ -962,43 +980,71 @@ namespace internal
       // get the valence of the individual components and compute the weights as
       // the inverse of the valence
       weights_on_refined.resize(n_levels - 1);
+
+      // accumulate the valence of the DoFs level by level, starting the data
+      // exchange of a level as soon as its local contributions are complete
+      // so that the communication of the various levels can overlap; the
+      // communication channels keep the messages of different levels apart
+      std::vector<LinearAlgebra::distributed::Vector<Number>> touch_count(
+        n_levels);
       for (unsigned int level = 1; level < n_levels; ++level)
         {
-          LinearAlgebra::distributed::Vector<Number> touch_count(
-            target_partitioners[level]);
+          touch_count[level].reinit(target_partitioners[level]);
           for (unsigned int c = 0; c < n_owned_level_cells[level - 1]; ++c)
             for (unsigned int j = 0; j < elem_info.n_child_cell_dofs; ++j)
-              touch_count.local_element(
+              touch_count[level].local_element(
                 level_dof_indices[level][elem_info.n_child_cell_dofs * c +
                                          j]) += Number(1.);
-          touch_count.compress(VectorOperation::add);
-          touch_count.update_ghost_values();
+          touch_count[level].compress_start(level, VectorOperation::add);
+        }
+      for (unsigned int level = 1; level < n_levels; ++level)
+        {
+          touch_count[level].compress_finish(VectorOperation::add);
+          touch_count[level].update_ghost_values_start(n_levels + level);
+        }
+      for (unsigned int level = 1; level < n_levels; ++level)
+        touch_count[level].update_ghost_values_finish();
 
-          std::vector<unsigned int> degree_to_3(n_child_dofs_1d);
-          degree_to_3[0] = 0;
-          for (unsigned int i = 1; i < n_child_dofs_1d - 1; ++i)
-            degree_to_3[i] = 1;
-          degree_to_3.back() = 2;
+      std::vector<unsigned int> degree_to_3(n_child_dofs_1d);
+      degree_to_3[0] = 0;
+      for (unsigned int i = 1; i < n_child_dofs_1d - 1; ++i)
+        degree_to_3[i] = 1;
+      degree_to_3.back() = 2;
 
+      for (unsigned int level = 1; level < n_levels; ++level)
+        {
           // we only store 3^dim weights because all dofs on a line have the
-          // same valence, and all dofs on a quad have the same valence.
+          // same valence, and all dofs on a quad have the same valence. the
+          // cells are independent of each other, so the inversion of the
+          // valences can be distributed onto several threads
           weights_on_refined[level - 1].resize(n_owned_level_cells[level - 1] *
                                                Utilities::fixed_power<dim>(3));
-          for (unsigned int c = 0; c < n_owned_level_cells[level - 1]; ++c)
-            for (unsigned int k = 0, m = 0; k < (dim > 2 ? n_child_dofs_1d : 1);
-                 ++k)
-              for (unsigned int j = 0; j < (dim > 1 ? n_child_dofs_1d : 1); ++j)
-                {
-                  unsigned int shift = 9 * degree_to_3[k] + 3 * degree_to_3[j];
-                  for (unsigned int i = 0; i < n_child_dofs_1d; ++i, ++m)
-                    weights_on_refined[level -
-                                       1][c * Utilities::fixed_power<dim>(3) +
-                                          shift + degree_to_3[i]] =
-                      Number(1.) /
-                      touch_count.local_element(
-                        level_dof_indices[level]
-                                         [elem_info.n_child_cell_dofs * c + m]);
-                }
+          parallel::apply_to_subranges(
+            0U,
+            n_owned_level_cells[level - 1],
+            [&](const unsigned int begin_cell, const unsigned int end_cell) {
+              for (unsigned int c = begin_cell; c < end_cell; ++c)
+                for (unsigned int k = 0, m = 0;
+                     k < (dim > 2 ? n_child_dofs_1d : 1);
+                     ++k)
+                  for (unsigned int j = 0; j < (dim > 1 ? n_child_dofs_1d : 1);
+                       ++j)
+                    {
+                      unsigned int shift =
+                        9 * degree_to_3[k] + 3 * degree_to_3[j];
+                      for (unsigned int i = 0; i < n_child_dofs_1d; ++i, ++m)
+                        weights_on_refined
+                          [level - 1][c * Utilities::fixed_power<dim>(3) +
+                                      shift + degree_to_3[i]] =
+                            Number(1.) /
+                            touch_count[level].local_element(
+                              level_dof_indices[level]
+                                               [elem_info.n_child_cell_dofs *
+                                                  c +
+                                                m]);
+                    }
+            },
+            64);
         }
     }
 
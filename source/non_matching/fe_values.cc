@@ -100,8 +100,9 @@ namespace NonMatching
   void
   FEValues<dim>::initialize(const hp::QCollection<dim> &q_collection)
   {
-    current_cell_location = LocationToLevelSet::unassigned;
-    active_fe_index       = numbers::invalid_unsigned_int;
+    current_cell_location       = LocationToLevelSet::unassigned;
+    active_fe_index             = numbers::invalid_unsigned_int;
+    quadrature_cache_is_enabled = false;
 
     Assert(fe_collection->size() > 0,
            ExcMessage("Incoming hp::FECollection can not be empty."));
@@ -247,15 +248,49 @@ namespace NonMatching
           }
         case LocationToLevelSet::intersected:
           {
-            quadrature_generator.set_1D_quadrature(q_index_1D);
-            quadrature_generator.generate(cell);
+            // check if we have already generated quadratures for this cell in
+            // an earlier call to reinit(). if not, generate them now and, if
+            // requested, store them for later reuse.
+            const CellQuadratureCacheEntry *cached_quadratures = nullptr;
+            if (quadrature_cache_is_enabled)
+              {
+                const auto entry = quadrature_cache.find(cell->id());
+                if (entry != quadrature_cache.end() &&
+                    entry->second.q_index_1D == q_index_1D)
+                  cached_quadratures = &entry->second;
+              }
+
+            if (cached_quadratures == nullptr)
+              {
+                quadrature_generator.set_1D_quadrature(q_index_1D);
+                quadrature_generator.generate(cell);
+
+                if (quadrature_cache_is_enabled)
+                  {
+                    CellQuadratureCacheEntry &entry =
+                      quadrature_cache[cell->id()];
+                    entry.q_index_1D = q_index_1D;
+                    entry.inside  = quadrature_generator.get_inside_quadrature();
+                    entry.outside =
+                      quadrature_generator.get_outside_quadrature();
+                    entry.surface =
+                      quadrature_generator.get_surface_quadrature();
+                    cached_quadratures = &entry;
+                  }
+              }
 
             const Quadrature<dim> &inside_quadrature =
-              quadrature_generator.get_inside_quadrature();
+              cached_quadratures != nullptr ?
+                cached_quadratures->inside :
+                quadrature_generator.get_inside_quadrature();
             const Quadrature<dim> &outside_quadrature =
-              quadrature_generator.get_outside_quadrature();
+              cached_quadratures != nullptr ?
+                cached_quadratures->outside :
+                quadrature_generator.get_outside_quadrature();
             const ImmersedSurfaceQuadrature<dim> &surface_quadrature =
-              quadrature_generator.get_surface_quadrature();
+              cached_quadratures != nullptr ?
+                cached_quadratures->surface :
+                quadrature_generator.get_surface_quadrature();
 
             // Even if a cell is formally intersected the number of created
             // quadrature points can be 0. Avoid creating an FEValues object
@@ -334,6 +369,34 @@ namespace NonMatching
 
 
 
+  template <int dim>
+  void
+  FEValues<dim>::enable_quadrature_cache()
+  {
+    quadrature_cache_is_enabled = true;
+  }
+
+
+
+  template <int dim>
+  void
+  FEValues<dim>::disable_quadrature_cache()
+  {
+    quadrature_cache_is_enabled = false;
+    quadrature_cache.clear();
+  }
+
+
+
+  template <int dim>
+  void
+  FEValues<dim>::clear_quadrature_cache()
+  {
+    quadrature_cache.clear();
+  }
+
+
+
   template <int dim>
   template <typename VectorType>
   FEInterfaceValues<dim>::FEInterfaceValues(
@@ -397,8 +460,9 @@ namespace NonMatching
   FEInterfaceValues<dim>::initialize(
     const hp::QCollection<dim - 1> &q_collection)
   {
-    current_face_location = LocationToLevelSet::unassigned;
-    active_fe_index       = numbers::invalid_unsigned_int;
+    current_face_location       = LocationToLevelSet::unassigned;
+    active_fe_index             = numbers::invalid_unsigned_int;
+    quadrature_cache_is_enabled = false;
 
     Assert(fe_collection->size() > 0,
            ExcMessage("Incoming hp::FECollection can not be empty."));
@@ -479,13 +543,45 @@ namespace NonMatching
             const unsigned int q1D_index =
               q_collection_1D.size() > 1 ? active_fe_index : 0;
 
-            face_quadrature_generator.set_1D_quadrature(q1D_index);
-            face_quadrature_generator.generate(cell, face_no);
+            // check if we have already generated quadratures for this face in
+            // an earlier call to reinit(). if not, generate them now and, if
+            // requested, store them for later reuse.
+            const FaceQuadratureCacheEntry *cached_quadratures = nullptr;
+            if (quadrature_cache_is_enabled)
+              {
+                const auto entry =
+                  quadrature_cache.find(std::make_pair(cell->id(), face_no));
+                if (entry != quadrature_cache.end() &&
+                    entry->second.q_index_1D == q1D_index)
+                  cached_quadratures = &entry->second;
+              }
+
+            if (cached_quadratures == nullptr)
+              {
+                face_quadrature_generator.set_1D_quadrature(q1D_index);
+                face_quadrature_generator.generate(cell, face_no);
+
+                if (quadrature_cache_is_enabled)
+                  {
+                    FaceQuadratureCacheEntry &entry =
+                      quadrature_cache[std::make_pair(cell->id(), face_no)];
+                    entry.q_index_1D = q1D_index;
+                    entry.inside =
+                      face_quadrature_generator.get_inside_quadrature();
+                    entry.outside =
+                      face_quadrature_generator.get_outside_quadrature();
+                    cached_quadratures = &entry;
+                  }
+              }
 
             const Quadrature<dim - 1> &inside_quadrature =
-              face_quadrature_generator.get_inside_quadrature();
+              cached_quadratures != nullptr ?
+                cached_quadratures->inside :
+                face_quadrature_generator.get_inside_quadrature();
             const Quadrature<dim - 1> &outside_quadrature =
-              face_quadrature_generator.get_outside_quadrature();
+              cached_quadratures != nullptr ?
+                cached_quadratures->outside :
+                face_quadrature_generator.get_outside_quadrature();
 
             // Even if a cell is formally intersected the number of created
             // quadrature points can be 0. Avoid creating an FEInterfaceValues
@@ -544,6 +640,34 @@ namespace NonMatching
   }
 
 
+
+  template <int dim>
+  void
+  FEInterfaceValues<dim>::enable_quadrature_cache()
+  {
+    quadrature_cache_is_enabled = true;
+  }
+
+
+
+  template <int dim>
+  void
+  FEInterfaceValues<dim>::disable_quadrature_cache()
+  {
+    quadrature_cache_is_enabled = false;
+    quadrature_cache.clear();
+  }
+
+
+
+  template <int dim>
+  void
+  FEInterfaceValues<dim>::clear_quadrature_cache()
+  {
+    quadrature_cache.clear();
+  }
+
+
 #include "fe_values.inst"
 
 } // namespace NonMatching
@@ -410,6 +410,18 @@ namespace NonMatching
                                                       face_index,
                                                       local_levelset_values);
 
+    // Since the Lagrange dofs are point values of the level set function,
+    // dof values of different signs imply that the function changes sign
+    // over the face, irrespective of the polynomial degree. In this case,
+    // we can classify the face as intersected right away and skip the
+    // comparably expensive change of basis to FE_Bernstein below. This is
+    // the common case for the faces cut by the zero contour.
+    const LocationToLevelSet location_from_support_points =
+      internal::MeshClassifierImplementation::location_from_dof_signs(
+        local_levelset_values);
+    if (location_from_support_points == LocationToLevelSet::intersected)
+      return LocationToLevelSet::intersected;
+
     const FiniteElement<dim> &fe =
       level_set_description->get_fe_collection()[fe_index];
 
@@ -421,12 +433,9 @@ namespace NonMatching
     const bool is_linear = fe_q_iso_q1 != nullptr ||
                            (fe_poly != nullptr && fe_poly->get_degree() == 1);
 
-    // shortcut for linear elements
+    // shortcut for linear elements, whose dof signs are conclusive
     if (is_linear)
-      {
-        return internal::MeshClassifierImplementation::location_from_dof_signs(
-          local_levelset_values);
-      }
+      return location_from_support_points;
 
     lagrange_to_bernstein_face[fe_index][face_index].solve(
       local_levelset_values);
@@ -65,6 +65,11 @@ namespace internal
 
 template <int dim, int spacedim>
 DataOut<dim, spacedim>::DataOut()
+  : cache_geometry(false)
+  , cached_geometry_valid(false)
+  , cached_n_subdivisions(numbers::invalid_unsigned_int)
+  , cached_curved_region(no_curved_cells)
+  , cached_triangulation(nullptr)
 {
   set_cell_selection(
     [this](const Triangulation<dim, spacedim> &) {
@@ -90,14 +95,48 @@ DataOut<dim, spacedim>::DataOut()
 
 
 
+template <int dim, int spacedim>
+DataOut<dim, spacedim>::~DataOut()
+{
+  tria_change_connection.disconnect();
+  tria_movement_connection.disconnect();
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOut<dim, spacedim>::set_geometry_caching(const bool cache_geometry)
+{
+  this->cache_geometry = cache_geometry;
+  if (cache_geometry == false)
+    {
+      // discard the cache and stop listening to the triangulation
+      cached_geometry_valid = false;
+      cached_triangulation  = nullptr;
+      tria_change_connection.disconnect();
+      tria_movement_connection.disconnect();
+    }
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOut<dim, spacedim>::build_one_patch(
   const std::pair<cell_iterator, unsigned int>                 *cell_and_index,
   internal::DataOutImplementation::ParallelData<dim, spacedim> &scratch_data,
   const unsigned int                                            n_subdivisions,
-  const CurvedCellRegion curved_cell_region)
+  const CurvedCellRegion curved_cell_region,
+  const bool             reuse_geometry)
 {
+  // determine the index of the patch this cell corresponds to
+  const unsigned int patch_idx =
+    (*scratch_data.cell_to_patch_index_map)[cell_and_index->first->level()]
+                                           [cell_and_index->first->index()];
+  // did we mess up the indices?
+  Assert(patch_idx < this->patches.size(), ExcInternalError());
+
   // first create the output object that we will write into
 
   ::dealii::DataOutBase::Patch<dim, spacedim> patch;
@@ -110,9 +149,21 @@ DataOut<dim, spacedim>::build_one_patch(
   const FEValuesBase<dim, spacedim> &fe_patch_values =
     scratch_data.get_present_fe_values(0);
 
-  const auto vertices =
-    fe_patch_values.get_mapping().get_vertices(cell_and_index->first);
-  std::copy(vertices.begin(), vertices.end(), std::begin(patch.vertices));
+  if (reuse_geometry)
+    {
+      // the geometry of this patch is known from the previous call to
+      // build_patches(), see set_geometry_caching()
+      const auto &cached_patch = this->patches[patch_idx];
+      std::copy(std::begin(cached_patch.vertices),
+                std::end(cached_patch.vertices),
+                std::begin(patch.vertices));
+    }
+  else
+    {
+      const auto vertices =
+        fe_patch_values.get_mapping().get_vertices(cell_and_index->first);
+      std::copy(vertices.begin(), vertices.end(), std::begin(patch.vertices));
+    }
 
   const unsigned int n_q_points = fe_patch_values.n_quadrature_points;
 
@@ -139,11 +190,30 @@ DataOut<dim, spacedim>::build_one_patch(
   // want to produce curved cells everywhere
   //
   // note: a cell is *always* at the boundary if dim<spacedim
-  if (curved_cell_region == curved_inner_cells ||
-      (curved_cell_region == curved_boundary &&
-       (cell_and_index->first->at_boundary() || (dim != spacedim))) ||
-      (cell_and_index->first->reference_cell() !=
-       ReferenceCells::get_hypercube<dim>()))
+  if (reuse_geometry)
+    {
+      // copy the cached point locations (if any) into the last rows of the
+      // newly sized data table; only the rows holding the data set values
+      // will be recomputed below
+      const auto &cached_patch    = this->patches[patch_idx];
+      patch.points_are_available  = cached_patch.points_are_available;
+      const unsigned int n_points =
+        (patch.points_are_available ? spacedim : 0);
+      patch.data.reinit(scratch_data.n_datasets + n_points, n_q_points);
+      if (patch.points_are_available)
+        {
+          AssertDimension(cached_patch.data.n_cols(), n_q_points);
+          for (unsigned int i = 0; i < spacedim; ++i)
+            for (unsigned int q = 0; q < n_q_points; ++q)
+              patch.data(patch.data.size(0) - spacedim + i, q) =
+                cached_patch.data(cached_patch.data.size(0) - spacedim + i, q);
+        }
+    }
+  else if (curved_cell_region == curved_inner_cells ||
+           (curved_cell_region == curved_boundary &&
+            (cell_and_index->first->at_boundary() || (dim != spacedim))) ||
+           (cell_and_index->first->reference_cell() !=
+            ReferenceCells::get_hypercube<dim>()))
     {
       Assert(patch.space_dim == spacedim, ExcInternalError());
 
@@ -1042,11 +1112,6 @@ DataOut<dim, spacedim>::build_one_patch(
             .cell_to_patch_index_map)[neighbor->level()][neighbor->index()];
     }
 
-  const unsigned int patch_idx =
-    (*scratch_data.cell_to_patch_index_map)[cell_and_index->first->level()]
-                                           [cell_and_index->first->index()];
-  // did we mess up the indices?
-  Assert(patch_idx < this->patches.size(), ExcInternalError());
   patch.patch_index = patch_idx;
 
   // Put the patch into the patches vector. instead of copying the data,
@@ -1105,6 +1170,22 @@ DataOut<dim, spacedim>::build_patches(
 
   this->validate_dataset_names();
 
+  // If the geometry of the patches is to be cached, make sure we hear about
+  // any changes of the (possibly newly attached) triangulation that would
+  // invalidate the cache.
+  if (cache_geometry && (cached_triangulation != &*this->triangulation))
+    {
+      tria_change_connection.disconnect();
+      tria_movement_connection.disconnect();
+      tria_change_connection = this->triangulation->signals.any_change.connect(
+        [this]() { this->cached_geometry_valid = false; });
+      tria_movement_connection =
+        this->triangulation->signals.mesh_movement.connect(
+          [this]() { this->cached_geometry_valid = false; });
+      cached_triangulation  = &*this->triangulation;
+      cached_geometry_valid = false;
+    }
+
   // First count the cells we want to create patches of. Also fill the object
   // that maps the cell indices to the patch numbers, as this will be needed
   // for generation of neighborship information.
@@ -1176,8 +1257,22 @@ DataOut<dim, spacedim>::build_patches(
       }
   }
 
-  this->patches.clear();
-  this->patches.resize(all_cells.size());
+  // Determine whether the geometric part of the patches from the previous
+  // call to this function can be reused, see set_geometry_caching(). Besides
+  // the invalidation through the triangulation signals, be conservative and
+  // rebuild the geometry whenever the arguments of this function or the
+  // number of patches changed.
+  const bool reuse_geometry =
+    (cache_geometry && cached_geometry_valid &&
+     (n_subdivisions == cached_n_subdivisions) &&
+     (curved_region == cached_curved_region) &&
+     (this->patches.size() == all_cells.size()));
+
+  if (reuse_geometry == false)
+    {
+      this->patches.clear();
+      this->patches.resize(all_cells.size());
+    }
 
   // Now create a default object for the WorkStream object to work with. The
   // first step is to count how many output data sets there will be. This is,
@@ -1210,7 +1305,10 @@ DataOut<dim, spacedim>::build_patches(
     (n_subdivisions < 2 ? no_curved_cells : curved_region);
 
   UpdateFlags update_flags = update_values;
-  if (curved_cell_region != no_curved_cells)
+  // when reusing the cached geometry, the point locations of curved cells
+  // are copied from the previous patches, so there is no need to have the
+  // mapping compute the quadrature point locations again
+  if (curved_cell_region != no_curved_cells && !reuse_geometry)
     update_flags |= update_quadrature_points;
 
   for (unsigned int i = 0; i < this->dof_data.size(); ++i)
@@ -1234,7 +1332,7 @@ DataOut<dim, spacedim>::build_patches(
     update_flags,
     cell_to_patch_index_map);
 
-  auto worker = [this, n_subdivisions, curved_cell_region](
+  auto worker = [this, n_subdivisions, curved_cell_region, reuse_geometry](
                   const std::pair<cell_iterator, unsigned int> *cell_and_index,
                   internal::DataOutImplementation::ParallelData<dim, spacedim>
                     &scratch_data,
@@ -1244,7 +1342,8 @@ DataOut<dim, spacedim>::build_patches(
     this->build_one_patch(cell_and_index,
                           scratch_data,
                           n_subdivisions,
-                          curved_cell_region);
+                          curved_cell_region,
+                          reuse_geometry);
   };
 
   // now build the patches in parallel
@@ -1264,6 +1363,15 @@ DataOut<dim, spacedim>::build_patches(
                     // @ref workstream_paper, on 32 cores) and if
                     8 * MultithreadInfo::n_threads(),
                     64);
+
+  // The geometry stored in the patches is now up to date, so remember the
+  // arguments it was built for.
+  if (cache_geometry)
+    {
+      cached_n_subdivisions = n_subdivisions;
+      cached_curved_region  = curved_region;
+      cached_geometry_valid = true;
+    }
 }
 
 
@@ -87,10 +87,21 @@ namespace internal
 template <int dim, int spacedim>
 DataOutFaces<dim, spacedim>::DataOutFaces(const bool so)
   : surface_only(so)
+  , cached_faces_valid(false)
+  , cached_faces_tria(nullptr)
 {}
 
 
 
+template <int dim, int spacedim>
+DataOutFaces<dim, spacedim>::~DataOutFaces()
+{
+  if (tria_change_signal.connected())
+    tria_change_signal.disconnect();
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOutFaces<dim, spacedim>::build_one_patch(
@@ -365,13 +376,30 @@ DataOutFaces<dim, spacedim>::build_patches(
   // first collect the cells we want to create patches of; we will
   // then iterate over them. the end-condition of the loop needs to
   // test that next_face() returns an end iterator, as well as for the
-  // case that first_face() returns an invalid FaceDescriptor object
-  std::vector<FaceDescriptor> all_faces;
-  for (FaceDescriptor face = first_face();
-       ((face.first != this->triangulation->end()) &&
-        (face != FaceDescriptor()));
-       face = next_face(face))
-    all_faces.push_back(face);
+  // case that first_face() returns an invalid FaceDescriptor object.
+  // since this sweep over all cells is wasteful if output is created
+  // repeatedly on a mesh that does not change, reuse the list of faces
+  // from a previous call if the triangulation has not changed in the
+  // meantime, which we monitor via a signal connection
+  if (cached_faces_valid == false ||
+      cached_faces_tria != &*this->triangulation)
+    {
+      cached_faces.clear();
+      for (FaceDescriptor face = first_face();
+           ((face.first != this->triangulation->end()) &&
+            (face != FaceDescriptor()));
+           face = next_face(face))
+        cached_faces.push_back(face);
+
+      tria_change_signal.disconnect();
+      tria_change_signal =
+        this->triangulation->signals.any_change.connect([this]() -> void {
+          this->cached_faces_valid = false;
+        });
+      cached_faces_valid = true;
+      cached_faces_tria  = &*this->triangulation;
+    }
+  const std::vector<FaceDescriptor> &all_faces = cached_faces;
 
   // clear the patches array and allocate the right number of elements
   this->patches.clear();
@@ -28,6 +28,36 @@
 
 DEAL_II_NAMESPACE_OPEN
 
+namespace
+{
+  /**
+   * Evaluate all @p n_components components of @p vector at the points
+   * registered in @p rpe in a single communication round and write the
+   * result, sorted by component, into @p component_values.
+   */
+  template <int n_components, int dim, int spacedim, typename VectorType>
+  void
+  fill_component_values(
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &rpe,
+    const DoFHandler<dim, spacedim>  &dof_handler,
+    const VectorType                 &vector,
+    std::vector<std::vector<double>> &component_values)
+  {
+    const auto values = VectorTools::point_values<n_components>(
+      rpe, dof_handler, vector, VectorTools::EvaluationFlags::avg);
+
+    for (unsigned int c = 0; c < n_components; ++c)
+      {
+        component_values[c].resize(values.size());
+        for (unsigned int j = 0; j < values.size(); ++j)
+          if constexpr (n_components == 1)
+            component_values[c][j] = values[j];
+          else
+            component_values[c][j] = values[j][c];
+      }
+  }
+} // namespace
+
 
 template <int dim, int patch_dim, int spacedim>
 DataOutResample<dim, patch_dim, spacedim>::DataOutResample(
@@ -35,7 +65,20 @@ DataOutResample<dim, patch_dim, spacedim>::DataOutResample(
   const Mapping<patch_dim, spacedim>       &patch_mapping)
   : patch_dof_handler(patch_tria)
   , patch_mapping(&patch_mapping)
-{}
+  , registered_n_subdivisions(numbers::invalid_unsigned_int)
+  , patch_tria_changed(false)
+{
+  patch_tria_change_connection = patch_tria.signals.any_change.connect(
+    [this]() { this->patch_tria_changed = true; });
+}
+
+
+
+template <int dim, int patch_dim, int spacedim>
+DataOutResample<dim, patch_dim, spacedim>::~DataOutResample()
+{
+  patch_tria_change_connection.disconnect();
+}
 
 
 
@@ -45,11 +88,26 @@ DataOutResample<dim, patch_dim, spacedim>::update_mapping(
   const Mapping<dim, spacedim> &mapping,
   const unsigned int            n_subdivisions)
 {
-  this->mapping = &mapping;
+  const unsigned int effective_n_subdivisions =
+    std::max<unsigned int>(1, n_subdivisions);
+
+  // The setup below is expensive, so skip it if it would reproduce the
+  // current state: this is the case if neither the mapping nor the number of
+  // subdivisions have changed and both triangulations are unmodified.
+  // Changes of the source triangulation are detected by the
+  // RemotePointEvaluation object, changes of the patch triangulation by the
+  // signal connected in the constructor.
+  if (this->mapping == &mapping &&
+      effective_n_subdivisions == registered_n_subdivisions &&
+      patch_tria_changed == false && rpe.is_ready())
+    return;
+
+  this->mapping             = &mapping;
+  registered_n_subdivisions = effective_n_subdivisions;
+  patch_tria_changed        = false;
   this->point_to_local_vector_indices.clear();
 
-  FE_Q_iso_Q1<patch_dim, spacedim> fe(
-    std::max<unsigned int>(1, n_subdivisions));
+  FE_Q_iso_Q1<patch_dim, spacedim> fe(effective_n_subdivisions);
   patch_dof_handler.distribute_dofs(fe);
 
   std::vector<std::pair<types::global_dof_index, Point<spacedim>>> points_all;
@@ -159,11 +217,47 @@ DataOutResample<dim, patch_dim, spacedim>::build_patches(
             "with a single base element."));
 #endif
 
-      for (unsigned int comp = 0; comp < dh.get_fe_collection().n_components();
-           ++comp)
+      const unsigned int n_components = dh.get_fe_collection().n_components();
+
+      // evaluate all components of this data vector in as few communication
+      // rounds as possible. the number of components is a template argument
+      // of VectorTools::point_values(), so dispatch over the common cases
+      // and fall back to one communication round per component otherwise
+      std::vector<std::vector<double>> component_values(n_components);
+      switch (n_components)
+        {
+          case 1:
+            fill_component_values<1>(rpe, dh, data_ptr->vector,
+                                     component_values);
+            break;
+          case 2:
+            fill_component_values<2>(rpe, dh, data_ptr->vector,
+                                     component_values);
+            break;
+          case 3:
+            fill_component_values<3>(rpe, dh, data_ptr->vector,
+                                     component_values);
+            break;
+          case 4:
+            fill_component_values<4>(rpe, dh, data_ptr->vector,
+                                     component_values);
+            break;
+          default:
+            for (unsigned int comp = 0; comp < n_components; ++comp)
+              {
+                const auto values =
+                  VectorTools::point_values<1>(rpe,
+                                               dh,
+                                               data_ptr->vector,
+                                               VectorTools::EvaluationFlags::avg,
+                                               comp);
+                component_values[comp].assign(values.begin(), values.end());
+              }
+        }
+
+      for (unsigned int comp = 0; comp < n_components; ++comp)
         {
-          const auto values = VectorTools::point_values<1>(
-            rpe, dh, data_ptr->vector, VectorTools::EvaluationFlags::avg, comp);
+          const std::vector<double> &values = component_values[comp];
 
           vectors.emplace_back(
             std::make_shared<LinearAlgebra::distributed::Vector<double>>(
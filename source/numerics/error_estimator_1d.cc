@@ -557,6 +557,125 @@ KellyErrorEstimator<1, spacedim>::estimate(
 
 
 
+template <int spacedim>
+template <typename Number>
+void
+KellyErrorEstimator<1, spacedim>::estimate_incremental(
+  const Mapping<1, spacedim>    &mapping,
+  const DoFHandler<1, spacedim> &dof_handler,
+  const Quadrature<0>           &quadrature,
+  const std::map<types::boundary_id, const Function<spacedim, Number> *>
+                           &neumann_bc,
+  const ReadVector<Number> &solution,
+  Vector<float>            &error,
+  const std::vector<bool>  &cells_to_estimate,
+  const ComponentMask      &component_mask,
+  const Function<spacedim> *coefficients,
+  const types::subdomain_id subdomain_id,
+  const types::material_id  material_id,
+  const Strategy            strategy)
+{
+  // just pass on to the other function
+  std::vector<const ReadVector<Number> *> solutions(1, &solution);
+  std::vector<Vector<float> *>            errors(1, &error);
+  ArrayView<Vector<float> *>              error_view = make_array_view(errors);
+  estimate_incremental(mapping,
+                       dof_handler,
+                       hp::QCollection<0>(quadrature),
+                       neumann_bc,
+                       make_array_view(solutions),
+                       error_view,
+                       cells_to_estimate,
+                       component_mask,
+                       coefficients,
+                       subdomain_id,
+                       material_id,
+                       strategy);
+}
+
+
+
+template <int spacedim>
+template <typename Number>
+void
+KellyErrorEstimator<1, spacedim>::estimate_incremental(
+  const Mapping<1, spacedim>    &mapping,
+  const DoFHandler<1, spacedim> &dof_handler,
+  const hp::QCollection<0>      &quadrature,
+  const std::map<types::boundary_id, const Function<spacedim, Number> *>
+                                              &neumann_bc,
+  const ArrayView<const ReadVector<Number> *> &solutions,
+  ArrayView<Vector<float> *>                  &errors,
+  const std::vector<bool>                     &cells_to_estimate,
+  const ComponentMask                         &component_mask,
+  const Function<spacedim>                    *coefficients,
+  const types::subdomain_id                    subdomain_id_,
+  const types::material_id                     material_id,
+  const Strategy                               strategy)
+{
+  types::subdomain_id subdomain_id = numbers::invalid_subdomain_id;
+  if (const auto *triangulation = dynamic_cast<
+        const parallel::DistributedTriangulationBase<1, spacedim> *>(
+        &dof_handler.get_triangulation()))
+    {
+      Assert((subdomain_id_ == numbers::invalid_subdomain_id) ||
+               (subdomain_id_ == triangulation->locally_owned_subdomain()),
+             ExcMessage(
+               "For distributed Triangulation objects and associated "
+               "DoFHandler objects, asking for any subdomain other than the "
+               "locally owned one does not make sense."));
+      subdomain_id = triangulation->locally_owned_subdomain();
+    }
+  else
+    {
+      subdomain_id = subdomain_id_;
+    }
+
+  const unsigned int n_active_cells =
+    dof_handler.get_triangulation().n_active_cells();
+  AssertDimension(cells_to_estimate.size(), n_active_cells);
+
+  // the error vectors carry the indicators of the previous call for the
+  // cells that are not re-estimated, so they must already have the correct
+  // size
+  for (unsigned int n = 0; n < errors.size(); ++n)
+    AssertDimension(errors[n]->size(), n_active_cells);
+
+  // in 1d, the jump terms are point evaluations and computing them for all
+  // cells is cheap, so simply compute a full set of indicators and copy
+  // back only the entries of the flagged cells
+  std::vector<Vector<float>>   new_errors(errors.size());
+  std::vector<Vector<float> *> new_error_ptrs(errors.size());
+  for (unsigned int n = 0; n < errors.size(); ++n)
+    new_error_ptrs[n] = &new_errors[n];
+  ArrayView<Vector<float> *> new_error_view = make_array_view(new_error_ptrs);
+
+  estimate(mapping,
+           dof_handler,
+           quadrature,
+           neumann_bc,
+           solutions,
+           new_error_view,
+           component_mask,
+           coefficients,
+           numbers::invalid_unsigned_int,
+           subdomain_id,
+           material_id,
+           strategy);
+
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    if (cells_to_estimate[cell->active_cell_index()] &&
+        ((subdomain_id == numbers::invalid_subdomain_id) ||
+         (cell->subdomain_id() == subdomain_id)) &&
+        ((material_id == numbers::invalid_material_id) ||
+         (cell->material_id() == material_id)))
+      for (unsigned int n = 0; n < errors.size(); ++n)
+        (*errors[n])(cell->active_cell_index()) =
+          new_errors[n](cell->active_cell_index());
+}
+
+
+
 // explicit instantiations
 #include "error_estimator_1d.inst"
 
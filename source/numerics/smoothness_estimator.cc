@@ -14,6 +14,7 @@
 
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/signaling_nan.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/dofs/dof_handler.h>
 
@@ -113,65 +114,107 @@ namespace SmoothnessEstimator
       smoothness_indicators.reinit(
         dof_handler.get_triangulation().n_active_cells());
 
-      unsigned int             n_modes;
-      Table<dim, number_coeff> expansion_coefficients;
+      // Group all cells to estimate by their active FE index, so that each
+      // batch of cells can be transformed with a single matrix-matrix
+      // product.
+      using CellIterator =
+        typename DoFHandler<dim, spacedim>::active_cell_iterator;
+      std::vector<std::vector<CellIterator>> cells_per_fe_index(
+        dof_handler.get_fe_collection().size());
 
-      Vector<number>      local_dof_values;
-      std::vector<double> converted_indices;
-      std::pair<std::vector<unsigned int>, std::vector<double>> res;
       for (const auto &cell : dof_handler.active_cell_iterators() |
                                 IteratorFilters::LocallyOwnedCell())
         {
           if (!only_flagged_cells || cell->refine_flag_set() ||
               cell->coarsen_flag_set())
-            {
-              n_modes = fe_legendre.get_n_coefficients_per_direction(
-                cell->active_fe_index());
-              resize(expansion_coefficients, n_modes);
-
-              local_dof_values.reinit(cell->get_fe().n_dofs_per_cell());
-              cell->get_dof_values(solution, local_dof_values);
-
-              fe_legendre.calculate(local_dof_values,
-                                    cell->active_fe_index(),
-                                    expansion_coefficients);
-
-              // We fit our exponential decay of expansion coefficients to the
-              // provided regression_strategy on each possible value of |k|.
-              // To this end, we use FESeries::process_coefficients() to
-              // rework coefficients into the desired format.
-              res = FESeries::process_coefficients<dim>(
-                expansion_coefficients,
-                [n_modes](const TableIndices<dim> &indices) {
-                  return index_sum_less_than_N(indices, n_modes);
-                },
-                regression_strategy,
-                smallest_abs_coefficient);
-
-              Assert(res.first.size() == res.second.size(), ExcInternalError());
-
-              // Last, do the linear regression.
-              float regularity = std::numeric_limits<float>::infinity();
-              if (res.first.size() > 1)
-                {
-                  // Prepare linear equation for the logarithmic least squares
-                  // fit.
-                  converted_indices.assign(res.first.begin(), res.first.end());
-
-                  for (auto &residual_element : res.second)
-                    residual_element = std::log(residual_element);
-
-                  const std::pair<double, double> fit =
-                    FESeries::linear_regression(converted_indices, res.second);
-                  regularity = static_cast<float>(-fit.first);
-                }
-
-              smoothness_indicators(cell->active_cell_index()) = regularity;
-            }
+            cells_per_fe_index[cell->active_fe_index()].push_back(cell);
           else
             smoothness_indicators(cell->active_cell_index()) =
               numbers::signaling_nan<float>();
         }
+
+      // Make the batched FESeries::Legendre::calculate() calls below
+      // thread-safe.
+      fe_legendre.precalculate_all_transformation_matrices();
+
+      // Process the batches as independent tasks; each task writes only the
+      // entries of smoothness_indicators that belong to its own cells.
+      constexpr unsigned int max_batch_size = 64;
+
+      Threads::TaskGroup<> task_group;
+      for (unsigned int fe_index = 0; fe_index < cells_per_fe_index.size();
+           ++fe_index)
+        for (std::size_t batch_begin = 0;
+             batch_begin < cells_per_fe_index[fe_index].size();
+             batch_begin += max_batch_size)
+          task_group += Threads::new_task([&, fe_index, batch_begin]() {
+            const auto        &cells = cells_per_fe_index[fe_index];
+            const unsigned int batch_size =
+              std::min<std::size_t>(max_batch_size,
+                                    cells.size() - batch_begin);
+
+            const unsigned int n_modes =
+              fe_legendre.get_n_coefficients_per_direction(fe_index);
+
+            std::vector<Vector<number>>           local_dof_values(batch_size);
+            std::vector<Table<dim, number_coeff>> expansion_coefficients(
+              batch_size);
+            for (unsigned int b = 0; b < batch_size; ++b)
+              {
+                const auto &cell = cells[batch_begin + b];
+
+                resize(expansion_coefficients[b], n_modes);
+
+                local_dof_values[b].reinit(cell->get_fe().n_dofs_per_cell());
+                cell->get_dof_values(solution, local_dof_values[b]);
+              }
+
+            fe_legendre.calculate(local_dof_values,
+                                  fe_index,
+                                  expansion_coefficients);
+
+            std::vector<double> converted_indices;
+            std::pair<std::vector<unsigned int>, std::vector<double>> res;
+            for (unsigned int b = 0; b < batch_size; ++b)
+              {
+                // We fit our exponential decay of expansion coefficients to
+                // the provided regression_strategy on each possible value of
+                // |k|. To this end, we use FESeries::process_coefficients()
+                // to rework coefficients into the desired format.
+                res = FESeries::process_coefficients<dim>(
+                  expansion_coefficients[b],
+                  [n_modes](const TableIndices<dim> &indices) {
+                    return index_sum_less_than_N(indices, n_modes);
+                  },
+                  regression_strategy,
+                  smallest_abs_coefficient);
+
+                Assert(res.first.size() == res.second.size(),
+                       ExcInternalError());
+
+                // Last, do the linear regression.
+                float regularity = std::numeric_limits<float>::infinity();
+                if (res.first.size() > 1)
+                  {
+                    // Prepare linear equation for the logarithmic least
+                    // squares fit.
+                    converted_indices.assign(res.first.begin(),
+                                             res.first.end());
+
+                    for (auto &residual_element : res.second)
+                      residual_element = std::log(residual_element);
+
+                    const std::pair<double, double> fit =
+                      FESeries::linear_regression(converted_indices,
+                                                  res.second);
+                    regularity = static_cast<float>(-fit.first);
+                  }
+
+                smoothness_indicators(
+                  cells[batch_begin + b]->active_cell_index()) = regularity;
+              }
+          });
+      task_group.join_all();
     }
 
 
@@ -380,83 +423,126 @@ namespace SmoothnessEstimator
       smoothness_indicators.reinit(
         dof_handler.get_triangulation().n_active_cells());
 
-      unsigned int             n_modes;
-      Table<dim, number_coeff> expansion_coefficients;
+      // Group all cells to estimate by their active FE index, so that each
+      // batch of cells can be transformed with a single matrix-matrix
+      // product.
+      using CellIterator =
+        typename DoFHandler<dim, spacedim>::active_cell_iterator;
+      std::vector<std::vector<CellIterator>> cells_per_fe_index(
+        dof_handler.get_fe_collection().size());
 
-      Vector<number>      local_dof_values;
-      std::vector<double> ln_k;
-      std::pair<std::vector<unsigned int>, std::vector<double>> res;
       for (const auto &cell : dof_handler.active_cell_iterators() |
                                 IteratorFilters::LocallyOwnedCell())
         {
           if (!only_flagged_cells || cell->refine_flag_set() ||
               cell->coarsen_flag_set())
-            {
-              n_modes = fe_fourier.get_n_coefficients_per_direction(
-                cell->active_fe_index());
-              resize(expansion_coefficients, n_modes);
-
-              // Inside the loop, we first need to get the values of the local
-              // degrees of freedom and then need to compute the series
-              // expansion by multiplying this vector with the matrix ${\cal
-              // F}$ corresponding to this finite element.
-              local_dof_values.reinit(cell->get_fe().n_dofs_per_cell());
-              cell->get_dof_values(solution, local_dof_values);
-
-              fe_fourier.calculate(local_dof_values,
-                                   cell->active_fe_index(),
-                                   expansion_coefficients);
-
-              // We fit our exponential decay of expansion coefficients to the
-              // provided regression_strategy on each possible value of |k|.
-              // To this end, we use FESeries::process_coefficients() to
-              // rework coefficients into the desired format.
-              res = FESeries::process_coefficients<dim>(
-                expansion_coefficients,
-                [n_modes](const TableIndices<dim> &indices) {
-                  return index_norm_greater_than_zero_and_less_than_N_squared(
-                    indices, n_modes);
-                },
-                regression_strategy,
-                smallest_abs_coefficient);
-
-              Assert(res.first.size() == res.second.size(), ExcInternalError());
-
-              // Last, do the linear regression.
-              float regularity = std::numeric_limits<float>::infinity();
-              if (res.first.size() > 1)
-                {
-                  // Prepare linear equation for the logarithmic least squares
-                  // fit.
-                  //
-                  // First, calculate ln(|k|).
-                  //
-                  // For Fourier expansion, this translates to
-                  // ln(2*pi*sqrt(predicate)) = ln(2*pi) + 0.5*ln(predicate).
-                  // Since we are just interested in the slope of a linear
-                  // regression later, we omit the ln(2*pi) factor.
-                  ln_k.resize(res.first.size());
-                  for (unsigned int f = 0; f < res.first.size(); ++f)
-                    ln_k[f] = 0.5 * std::log(static_cast<double>(res.first[f]));
-
-                  // Second, calculate ln(U_k).
-                  for (auto &residual_element : res.second)
-                    residual_element = std::log(residual_element);
-
-                  const std::pair<double, double> fit =
-                    FESeries::linear_regression(ln_k, res.second);
-                  // Compute regularity s = mu - dim/2
-                  regularity = static_cast<float>(-fit.first) -
-                               ((dim > 1) ? (.5 * dim) : 0);
-                }
-
-              // Store result in the vector of estimated values for each cell.
-              smoothness_indicators(cell->active_cell_index()) = regularity;
-            }
+            cells_per_fe_index[cell->active_fe_index()].push_back(cell);
           else
             smoothness_indicators(cell->active_cell_index()) =
               numbers::signaling_nan<float>();
         }
+
+      // Make the batched FESeries::Fourier::calculate() calls below
+      // thread-safe.
+      fe_fourier.precalculate_all_transformation_matrices();
+
+      // Process the batches as independent tasks; each task writes only the
+      // entries of smoothness_indicators that belong to its own cells.
+      constexpr unsigned int max_batch_size = 64;
+
+      Threads::TaskGroup<> task_group;
+      for (unsigned int fe_index = 0; fe_index < cells_per_fe_index.size();
+           ++fe_index)
+        for (std::size_t batch_begin = 0;
+             batch_begin < cells_per_fe_index[fe_index].size();
+             batch_begin += max_batch_size)
+          task_group += Threads::new_task([&, fe_index, batch_begin]() {
+            const auto        &cells = cells_per_fe_index[fe_index];
+            const unsigned int batch_size =
+              std::min<std::size_t>(max_batch_size,
+                                    cells.size() - batch_begin);
+
+            const unsigned int n_modes =
+              fe_fourier.get_n_coefficients_per_direction(fe_index);
+
+            // We first need to get the values of the local degrees of
+            // freedom of the whole batch and then need to compute the series
+            // expansion by multiplying this set of vectors with the matrix
+            // ${\cal F}$ corresponding to this finite element.
+            std::vector<Vector<number>>           local_dof_values(batch_size);
+            std::vector<Table<dim, number_coeff>> expansion_coefficients(
+              batch_size);
+            for (unsigned int b = 0; b < batch_size; ++b)
+              {
+                const auto &cell = cells[batch_begin + b];
+
+                resize(expansion_coefficients[b], n_modes);
+
+                local_dof_values[b].reinit(cell->get_fe().n_dofs_per_cell());
+                cell->get_dof_values(solution, local_dof_values[b]);
+              }
+
+            fe_fourier.calculate(local_dof_values,
+                                 fe_index,
+                                 expansion_coefficients);
+
+            std::vector<double> ln_k;
+            std::pair<std::vector<unsigned int>, std::vector<double>> res;
+            for (unsigned int b = 0; b < batch_size; ++b)
+              {
+                // We fit our exponential decay of expansion coefficients to
+                // the provided regression_strategy on each possible value of
+                // |k|. To this end, we use FESeries::process_coefficients()
+                // to rework coefficients into the desired format.
+                res = FESeries::process_coefficients<dim>(
+                  expansion_coefficients[b],
+                  [n_modes](const TableIndices<dim> &indices) {
+                    return index_norm_greater_than_zero_and_less_than_N_squared(
+                      indices, n_modes);
+                  },
+                  regression_strategy,
+                  smallest_abs_coefficient);
+
+                Assert(res.first.size() == res.second.size(),
+                       ExcInternalError());
+
+                // Last, do the linear regression.
+                float regularity = std::numeric_limits<float>::infinity();
+                if (res.first.size() > 1)
+                  {
+                    // Prepare linear equation for the logarithmic least
+                    // squares fit.
+                    //
+                    // First, calculate ln(|k|).
+                    //
+                    // For Fourier expansion, this translates to
+                    // ln(2*pi*sqrt(predicate)) = ln(2*pi) +
+                    // 0.5*ln(predicate). Since we are just interested in the
+                    // slope of a linear regression later, we omit the
+                    // ln(2*pi) factor.
+                    ln_k.resize(res.first.size());
+                    for (unsigned int f = 0; f < res.first.size(); ++f)
+                      ln_k[f] =
+                        0.5 * std::log(static_cast<double>(res.first[f]));
+
+                    // Second, calculate ln(U_k).
+                    for (auto &residual_element : res.second)
+                      residual_element = std::log(residual_element);
+
+                    const std::pair<double, double> fit =
+                      FESeries::linear_regression(ln_k, res.second);
+                    // Compute regularity s = mu - dim/2
+                    regularity = static_cast<float>(-fit.first) -
+                                 ((dim > 1) ? (.5 * dim) : 0);
+                  }
+
+                // Store result in the vector of estimated values for each
+                // cell.
+                smoothness_indicators(
+                  cells[batch_begin + b]->active_cell_index()) = regularity;
+              }
+          });
+      task_group.join_all();
     }
 
 
@@ -12,6 +12,8 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/mpi_consensus_algorithms.h>
+
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
@@ -19,6 +21,7 @@
 
 #include <deal.II/particles/particle_handler.h>
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -1114,6 +1117,29 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::get_particle_properties(
+    std::vector<double> &properties) const
+  {
+    const unsigned int n_properties = n_properties_per_particle();
+
+    // There should be one set of properties per particle to gather
+    AssertDimension(properties.size(),
+                    n_locally_owned_particles() * n_properties);
+
+    unsigned int i = 0;
+    for (auto it = begin(); it != end(); ++it, ++i)
+      {
+        const ArrayView<double> particle_properties = it->get_properties();
+        std::copy(particle_properties.begin(),
+                  particle_properties.end(),
+                  properties.begin() + i * n_properties);
+      }
+  }
+
+
+
   template <int dim, int spacedim>
   void
   ParticleHandler<dim, spacedim>::set_particle_positions(
@@ -1137,6 +1163,29 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::set_particle_properties(
+    const std::vector<double> &new_properties)
+  {
+    const unsigned int n_properties = n_properties_per_particle();
+
+    // There should be one set of properties per particle to set
+    AssertDimension(new_properties.size(),
+                    n_locally_owned_particles() * n_properties);
+
+    unsigned int i = 0;
+    for (auto it = begin(); it != end(); ++it, ++i)
+      {
+        const ArrayView<double> particle_properties = it->get_properties();
+        std::copy(new_properties.begin() + i * n_properties,
+                  new_properties.begin() + (i + 1) * n_properties,
+                  particle_properties.begin());
+      }
+  }
+
+
+
   template <int dim, int spacedim>
   void
   ParticleHandler<dim, spacedim>::set_particle_positions(
@@ -1319,164 +1368,213 @@ namespace Particles
 
       std::vector<unsigned int> neighbor_permutation;
 
-      // Reuse these vectors below, but only with a single element.
-      // Avoid resizing for every particle.
-      Point<dim>      invalid_reference_point;
-      Point<spacedim> invalid_point;
-      invalid_reference_point[0] = std::numeric_limits<double>::infinity();
-      invalid_point[0]           = std::numeric_limits<double>::infinity();
-      reference_locations.resize(1, invalid_reference_point);
-      real_locations.resize(1, invalid_point);
-
-      // Find the cells that the particles moved to.
-      for (auto &out_particle : particles_out_of_cell)
-        {
-          // make a copy of the current cell, since we will modify the
-          // variable current_cell below, but we need the original in
-          // the case the particle is not found
-          auto current_cell = out_particle->get_surrounding_cell();
-
-          real_locations[0] = out_particle->get_location();
-
-          // Record if the new cell was found
-          bool found_cell = false;
-
-          // Check if the particle is in one of the old cell's neighbors
-          // that are adjacent to the closest vertex
-          const unsigned int closest_vertex =
-            GridTools::find_closest_vertex_of_cell<dim, spacedim>(
-              current_cell, out_particle->get_location(), *mapping);
-          Tensor<1, spacedim> vertex_to_particle =
-            out_particle->get_location() - current_cell->vertex(closest_vertex);
-          vertex_to_particle /= vertex_to_particle.norm();
-
-          const unsigned int closest_vertex_index =
-            current_cell->vertex_index(closest_vertex);
-          const unsigned int n_neighbor_cells =
-            vertex_to_cells[closest_vertex_index].size();
-
-          neighbor_permutation.resize(n_neighbor_cells);
-          for (unsigned int i = 0; i < n_neighbor_cells; ++i)
-            neighbor_permutation[i] = i;
-
-          const auto &cell_centers =
-            vertex_to_cell_centers[closest_vertex_index];
-          std::sort(neighbor_permutation.begin(),
-                    neighbor_permutation.end(),
-                    [&vertex_to_particle, &cell_centers](const unsigned int a,
-                                                         const unsigned int b) {
-                      return compare_particle_association(a,
-                                                          b,
-                                                          vertex_to_particle,
-                                                          cell_centers);
-                    });
-
-          // Search all of the cells adjacent to the closest vertex of the
-          // previous cell. Most likely we will find the particle in them.
-          for (unsigned int i = 0; i < n_neighbor_cells; ++i)
+      // Once a particle has been found in a new cell, it is either
+      // reinserted into our domain if we own that cell, or marked for MPI
+      // transfer to the owning process otherwise.
+      const auto found_particle_in_cell =
+        [&](particle_iterator particle,
+            const typename Triangulation<dim, spacedim>::active_cell_iterator
+              &new_cell) {
+          if (new_cell->is_locally_owned())
             {
-              typename std::set<typename Triangulation<dim, spacedim>::
-                                  active_cell_iterator>::const_iterator cell =
-                vertex_to_cells[closest_vertex_index].begin();
+              typename PropertyPool<dim, spacedim>::Handle &old =
+                particle->particles_in_cell
+                  ->particles[particle->particle_index_within_cell];
 
-              std::advance(cell, neighbor_permutation[i]);
-              mapping->transform_points_real_to_unit_cell(*cell,
-                                                          real_locations,
-                                                          reference_locations);
+              // Avoid deallocating the memory of this particle
+              const auto old_value = old;
+              old = PropertyPool<dim, spacedim>::invalid_handle;
 
-              if (GeometryInfo<dim>::is_inside_unit_cell(reference_locations[0],
-                                                         tolerance_inside_cell))
-                {
-                  current_cell = *cell;
-                  found_cell   = true;
-                  break;
-                }
+              // Allocate particle with the old handle
+              insert_particle(old_value, new_cell);
+            }
+          else
+            {
+              moved_particles[new_cell->subdomain_id()].push_back(particle);
+              moved_cells[new_cell->subdomain_id()].push_back(new_cell);
+            }
+        };
+
+      // Find the cells that the particles moved to. Since the particles
+      // were collected in a loop over the cells above, particles that left
+      // the same cell are adjacent in the vector. Group them, and sort each
+      // group into buckets according to the vertex of the old cell the
+      // particles are closest to: the particles of a bucket need to be
+      // searched for in the same set of neighboring cells, which allows
+      // checking each candidate cell with a single, batched call to
+      // Mapping::transform_points_real_to_unit_cell() for all particles of
+      // the bucket -- which vectorizes the inverse mapping across the
+      // points for the MappingQ family -- instead of one call per particle
+      // and candidate cell.
+      std::map<unsigned int, std::vector<particle_iterator>> buckets;
+      std::vector<particle_iterator>                         unfound_particles;
+      std::vector<particle_iterator> still_unfound_particles;
+
+      for (auto group_begin = particles_out_of_cell.begin();
+           group_begin != particles_out_of_cell.end();)
+        {
+          const auto previous_cell = (*group_begin)->get_surrounding_cell();
+
+          auto group_end = group_begin + 1;
+          while (group_end != particles_out_of_cell.end() &&
+                 (*group_end)->get_surrounding_cell() == previous_cell)
+            ++group_end;
+
+          buckets.clear();
+          for (auto it = group_begin; it != group_end; ++it)
+            {
+              const unsigned int closest_vertex =
+                GridTools::find_closest_vertex_of_cell<dim, spacedim>(
+                  previous_cell, (*it)->get_location(), *mapping);
+              buckets[previous_cell->vertex_index(closest_vertex)].push_back(
+                *it);
             }
 
-          if (!found_cell)
+          for (const auto &bucket : buckets)
             {
-              // For some clang-based compilers and boost versions the call to
-              // RTree::query doesn't compile. We use a slower implementation as
-              // workaround.
-              // This is fixed in boost in
-              // https://github.com/boostorg/numeric_conversion/commit/50a1eae942effb0a9b90724323ef8f2a67e7984a
+              const unsigned int closest_vertex_index = bucket.first;
+              const unsigned int n_neighbor_cells =
+                vertex_to_cells[closest_vertex_index].size();
+
+              // Compute the average direction from the vertex to the
+              // particles of the bucket, and check the cells adjacent to
+              // the vertex ordered by the alignment of their centers with
+              // this direction, so that we will most likely find the
+              // particles in the first cells checked.
+              Tensor<1, spacedim> vertex_to_particles;
+              for (const auto &particle : bucket.second)
+                {
+                  Tensor<1, spacedim> vertex_to_particle =
+                    particle->get_location() -
+                    triangulation->get_vertices()[closest_vertex_index];
+                  vertex_to_particles +=
+                    vertex_to_particle / vertex_to_particle.norm();
+                }
+              if (vertex_to_particles.norm() > 0.)
+                vertex_to_particles /= vertex_to_particles.norm();
+
+              neighbor_permutation.resize(n_neighbor_cells);
+              for (unsigned int i = 0; i < n_neighbor_cells; ++i)
+                neighbor_permutation[i] = i;
+
+              const auto &cell_centers =
+                vertex_to_cell_centers[closest_vertex_index];
+              std::sort(neighbor_permutation.begin(),
+                        neighbor_permutation.end(),
+                        [&vertex_to_particles,
+                         &cell_centers](const unsigned int a,
+                                        const unsigned int b) {
+                          return compare_particle_association(
+                            a, b, vertex_to_particles, cell_centers);
+                        });
+
+              // Search all of the cells adjacent to the closest vertex of
+              // the previous cell, each time with all particles of the
+              // bucket that have not been found yet in one batch. Most
+              // likely we will find the particles in them.
+              unfound_particles = bucket.second;
+              for (unsigned int i = 0;
+                   i < n_neighbor_cells && unfound_particles.size() > 0;
+                   ++i)
+                {
+                  typename std::set<typename Triangulation<dim, spacedim>::
+                                      active_cell_iterator>::const_iterator
+                    cell = vertex_to_cells[closest_vertex_index].begin();
+                  std::advance(cell, neighbor_permutation[i]);
+
+                  real_locations.clear();
+                  for (const auto &particle : unfound_particles)
+                    real_locations.push_back(particle->get_location());
+                  reference_locations.resize(real_locations.size());
+
+                  mapping->transform_points_real_to_unit_cell(
+                    *cell, real_locations, reference_locations);
+
+                  still_unfound_particles.clear();
+                  for (unsigned int p = 0; p < unfound_particles.size(); ++p)
+                    if (numbers::is_finite(reference_locations[p][0]) &&
+                        GeometryInfo<dim>::is_inside_unit_cell(
+                          reference_locations[p], tolerance_inside_cell))
+                      {
+                        unfound_particles[p]->set_reference_location(
+                          reference_locations[p]);
+                        found_particle_in_cell(unfound_particles[p], *cell);
+                      }
+                    else
+                      still_unfound_particles.push_back(unfound_particles[p]);
+
+                  unfound_particles.swap(still_unfound_particles);
+                }
+
+              // The remaining particles are not in a neighbor of their old
+              // cell. Look for their new cell in the whole local domain.
+              // This case is rare.
+              for (auto &out_particle : unfound_particles)
+                {
+                  real_locations.resize(1);
+                  reference_locations.resize(1);
+                  real_locations[0] = out_particle->get_location();
+
+                  // Record if the new cell was found
+                  bool found_cell = false;
+
+                  // For some clang-based compilers and boost versions the
+                  // call to RTree::query doesn't compile. We use a slower
+                  // implementation as workaround.
+                  // This is fixed in boost in
+                  // https://github.com/boostorg/numeric_conversion/commit/50a1eae942effb0a9b90724323ef8f2a67e7984a
 #if defined(DEAL_II_WITH_BOOST_BUNDLED) ||                \
   !(defined(__clang_major__) && __clang_major__ >= 16) || \
   BOOST_VERSION >= 108100
-              // The particle is not in a neighbor of the old cell.
-              // Look for the new cell in the whole local domain.
-              // This case is rare.
-              std::vector<std::pair<Point<spacedim>, unsigned int>>
-                closest_vertex_in_domain;
-              triangulation_cache->get_used_vertices_rtree().query(
-                boost::geometry::index::nearest(out_particle->get_location(),
-                                                1),
-                std::back_inserter(closest_vertex_in_domain));
-
-              // We should have one and only one result
-              AssertDimension(closest_vertex_in_domain.size(), 1);
-              const unsigned int closest_vertex_index_in_domain =
-                closest_vertex_in_domain[0].second;
+                  std::vector<std::pair<Point<spacedim>, unsigned int>>
+                    closest_vertex_in_domain;
+                  triangulation_cache->get_used_vertices_rtree().query(
+                    boost::geometry::index::nearest(
+                      out_particle->get_location(), 1),
+                    std::back_inserter(closest_vertex_in_domain));
+
+                  // We should have one and only one result
+                  AssertDimension(closest_vertex_in_domain.size(), 1);
+                  const unsigned int closest_vertex_index_in_domain =
+                    closest_vertex_in_domain[0].second;
 #else
-              const unsigned int closest_vertex_index_in_domain =
-                GridTools::find_closest_vertex(*mapping,
-                                               *triangulation,
-                                               out_particle->get_location());
+                  const unsigned int closest_vertex_index_in_domain =
+                    GridTools::find_closest_vertex(
+                      *mapping, *triangulation, out_particle->get_location());
 #endif
 
-              // Search all of the cells adjacent to the closest vertex of the
-              // domain. Most likely we will find the particle in them.
-              for (const auto &cell :
-                   vertex_to_cells[closest_vertex_index_in_domain])
-                {
-                  mapping->transform_points_real_to_unit_cell(
-                    cell, real_locations, reference_locations);
+                  // Search all of the cells adjacent to the closest vertex
+                  // of the domain. Most likely we will find the particle in
+                  // them.
+                  for (const auto &cell :
+                       vertex_to_cells[closest_vertex_index_in_domain])
+                    {
+                      mapping->transform_points_real_to_unit_cell(
+                        cell, real_locations, reference_locations);
+
+                      if (GeometryInfo<dim>::is_inside_unit_cell(
+                            reference_locations[0], tolerance_inside_cell))
+                        {
+                          out_particle->set_reference_location(
+                            reference_locations[0]);
+                          found_particle_in_cell(out_particle, cell);
+                          found_cell = true;
+                          break;
+                        }
+                    }
 
-                  if (GeometryInfo<dim>::is_inside_unit_cell(
-                        reference_locations[0], tolerance_inside_cell))
+                  if (!found_cell)
                     {
-                      current_cell = cell;
-                      found_cell   = true;
-                      break;
+                      // We can find no cell for this particle. It has left
+                      // the domain due to an integration error or an open
+                      // boundary. Signal the loss and move on.
+                      signals.particle_lost(
+                        out_particle, out_particle->get_surrounding_cell());
                     }
                 }
             }
 
-          if (!found_cell)
-            {
-              // We can find no cell for this particle. It has left the
-              // domain due to an integration error or an open boundary.
-              // Signal the loss and move on.
-              signals.particle_lost(out_particle,
-                                    out_particle->get_surrounding_cell());
-              continue;
-            }
-
-          // If we are here, we found a cell and reference position for this
-          // particle
-          out_particle->set_reference_location(reference_locations[0]);
-
-          // Reinsert the particle into our domain if we own its cell.
-          // Mark it for MPI transfer otherwise
-          if (current_cell->is_locally_owned())
-            {
-              typename PropertyPool<dim, spacedim>::Handle &old =
-                out_particle->particles_in_cell
-                  ->particles[out_particle->particle_index_within_cell];
-
-              // Avoid deallocating the memory of this particle
-              const auto old_value = old;
-              old = PropertyPool<dim, spacedim>::invalid_handle;
-
-              // Allocate particle with the old handle
-              insert_particle(old_value, current_cell);
-            }
-          else
-            {
-              moved_particles[current_cell->subdomain_id()].push_back(
-                out_particle);
-              moved_cells[current_cell->subdomain_id()].push_back(current_cell);
-            }
+          group_begin = group_end;
         }
     }
 
@@ -1679,13 +1777,6 @@ namespace Particles
            ExcMessage("This function is only implemented for "
                       "parallel::TriangulationBase objects."));
 
-    // Determine the communication pattern
-    const std::set<types::subdomain_id> ghost_owners =
-      parallel_triangulation->ghost_owners();
-    const std::vector<types::subdomain_id> neighbors(ghost_owners.begin(),
-                                                     ghost_owners.end());
-    const unsigned int                     n_neighbors = neighbors.size();
-
     if (send_cells.size() != 0)
       Assert(particles_to_send.size() == send_cells.size(), ExcInternalError());
 
@@ -1695,28 +1786,20 @@ namespace Particles
              particles_to_send.end(),
            ExcInternalError());
 
+#  ifdef DEBUG
     // TODO: Implement the shipping of particles to processes that are not
     // ghost owners of the local domain
+    const std::set<types::subdomain_id> &ghost_owners =
+      parallel_triangulation->ghost_owners();
     for (auto send_particles = particles_to_send.begin();
          send_particles != particles_to_send.end();
          ++send_particles)
       Assert(ghost_owners.find(send_particles->first) != ghost_owners.end(),
              ExcNotImplemented());
-
-    std::size_t n_send_particles = 0;
-    for (auto send_particles = particles_to_send.begin();
-         send_particles != particles_to_send.end();
-         ++send_particles)
-      n_send_particles += send_particles->second.size();
+#  endif
 
     const unsigned int cellid_size = sizeof(CellId::binary_type);
 
-    // Containers for the amount and offsets of data we will send
-    // to other processors and the data itself.
-    std::vector<unsigned int> n_send_data(n_neighbors, 0);
-    std::vector<unsigned int> send_offsets(n_neighbors, 0);
-    std::vector<char>         send_data;
-
     Particle<dim, spacedim> test_particle;
     test_particle.set_property_pool(*property_pool);
 
@@ -1727,155 +1810,79 @@ namespace Particles
     const unsigned int individual_total_particle_data_size =
       individual_particle_data_size + cellid_size;
 
-    // Only serialize things if there are particles to be send.
-    // We can not return early even if no particles
-    // are send, because we might receive particles from other processes
-    if (n_send_particles > 0)
+    // Serialize the data sorted by receiving process, one buffer per
+    // destination. Only destinations that actually receive particles from
+    // us appear here: the consensus algorithm below informs the other side
+    // of who communicates with whom, so there is no need to send empty
+    // messages to the remaining neighbors.
+    std::map<types::subdomain_id, std::vector<char>> send_buffers;
+    for (auto send_particles = particles_to_send.begin();
+         send_particles != particles_to_send.end();
+         ++send_particles)
       {
-        // Allocate space for sending particle data
-        send_data.resize(n_send_particles *
+        const types::subdomain_id destination = send_particles->first;
+        const unsigned int        n_particles_to_send =
+          send_particles->second.size();
+
+        if (n_particles_to_send == 0)
+          continue;
+
+        std::vector<char> &send_data = send_buffers[destination];
+        send_data.resize(static_cast<std::size_t>(n_particles_to_send) *
                          individual_total_particle_data_size);
 
         void *data = static_cast<void *>(&send_data.front());
 
-        // Serialize the data sorted by receiving process
-        for (unsigned int i = 0; i < n_neighbors; ++i)
+        for (unsigned int j = 0; j < n_particles_to_send; ++j)
           {
-            send_offsets[i] = reinterpret_cast<std::size_t>(data) -
-                              reinterpret_cast<std::size_t>(&send_data.front());
-
-            const unsigned int n_particles_to_send =
-              particles_to_send.at(neighbors[i]).size();
+            // If no target cells are given, use the iterator
+            // information
+            typename Triangulation<dim, spacedim>::active_cell_iterator cell;
+            if (send_cells.empty())
+              cell = send_particles->second[j]->get_surrounding_cell();
+            else
+              cell = send_cells.at(destination)[j];
 
-            Assert(static_cast<std::size_t>(n_particles_to_send) *
-                       individual_total_particle_data_size ==
-                     static_cast<std::size_t>(
-                       n_particles_to_send *
-                       individual_total_particle_data_size),
-                   ExcMessage("Overflow when trying to send particle "
-                              "data"));
+            const CellId::binary_type cellid =
+              cell->id().template to_binary<dim>();
+            memcpy(data, &cellid, cellid_size);
+            data = static_cast<char *>(data) + cellid_size;
 
-            for (unsigned int j = 0; j < n_particles_to_send; ++j)
-              {
-                // If no target cells are given, use the iterator
-                // information
-                typename Triangulation<dim, spacedim>::active_cell_iterator
-                  cell;
-                if (send_cells.empty())
-                  cell = particles_to_send.at(neighbors[i])[j]
-                           ->get_surrounding_cell();
-                else
-                  cell = send_cells.at(neighbors[i])[j];
-
-                const CellId::binary_type cellid =
-                  cell->id().template to_binary<dim>();
-                memcpy(data, &cellid, cellid_size);
-                data = static_cast<char *>(data) + cellid_size;
-
-                data = particles_to_send.at(neighbors[i])[j]
-                         ->write_particle_data_to_memory(data);
-                if (store_callback)
-                  data =
-                    store_callback(particles_to_send.at(neighbors[i])[j], data);
-              }
-            n_send_data[i] = n_particles_to_send;
+            data =
+              send_particles->second[j]->write_particle_data_to_memory(data);
+            if (store_callback)
+              data = store_callback(send_particles->second[j], data);
           }
-      }
-
-    // Containers for the data we will receive from other processors
-    std::vector<unsigned int> n_recv_data(n_neighbors);
-    std::vector<unsigned int> recv_offsets(n_neighbors);
-
-    {
-      const int mpi_tag = Utilities::MPI::internal::Tags::
-        particle_handler_send_recv_particles_setup;
-
-      std::vector<MPI_Request> n_requests(2 * n_neighbors);
-      for (unsigned int i = 0; i < n_neighbors; ++i)
-        {
-          const int ierr = MPI_Irecv(&(n_recv_data[i]),
-                                     1,
-                                     MPI_UNSIGNED,
-                                     neighbors[i],
-                                     mpi_tag,
-                                     parallel_triangulation->get_communicator(),
-                                     &(n_requests[2 * i]));
-          AssertThrowMPI(ierr);
-        }
-      for (unsigned int i = 0; i < n_neighbors; ++i)
-        {
-          const int ierr = MPI_Isend(&(n_send_data[i]),
-                                     1,
-                                     MPI_UNSIGNED,
-                                     neighbors[i],
-                                     mpi_tag,
-                                     parallel_triangulation->get_communicator(),
-                                     &(n_requests[2 * i + 1]));
-          AssertThrowMPI(ierr);
-        }
-      const int ierr =
-        MPI_Waitall(2 * n_neighbors, n_requests.data(), MPI_STATUSES_IGNORE);
-      AssertThrowMPI(ierr);
-    }
 
-    // Determine how many particles and data we will receive
-    unsigned int total_recv_data = 0;
-    for (unsigned int neighbor_id = 0; neighbor_id < n_neighbors; ++neighbor_id)
-      {
-        recv_offsets[neighbor_id] = total_recv_data;
-        total_recv_data +=
-          n_recv_data[neighbor_id] * individual_total_particle_data_size;
+        Assert(data == static_cast<const void *>(send_data.data() +
+                                                 send_data.size()),
+               ExcInternalError());
       }
 
-    // Set up the space for the received particle data
-    std::vector<char> recv_data(total_recv_data);
-
-    // Exchange the particle data between domains
-    {
-      std::vector<MPI_Request> requests(2 * n_neighbors);
-      unsigned int             send_ops = 0;
-      unsigned int             recv_ops = 0;
-
-      const int mpi_tag = Utilities::MPI::internal::Tags::
-        particle_handler_send_recv_particles_send;
-
-      for (unsigned int i = 0; i < n_neighbors; ++i)
-        if (n_recv_data[i] > 0)
-          {
-            const int ierr =
-              MPI_Irecv(&(recv_data[recv_offsets[i]]),
-                        n_recv_data[i] * individual_total_particle_data_size,
-                        MPI_CHAR,
-                        neighbors[i],
-                        mpi_tag,
-                        parallel_triangulation->get_communicator(),
-                        &(requests[send_ops]));
-            AssertThrowMPI(ierr);
-            ++send_ops;
-          }
-
-      for (unsigned int i = 0; i < n_neighbors; ++i)
-        if (n_send_data[i] > 0)
-          {
-            const int ierr =
-              MPI_Isend(&(send_data[send_offsets[i]]),
-                        n_send_data[i] * individual_total_particle_data_size,
-                        MPI_CHAR,
-                        neighbors[i],
-                        mpi_tag,
-                        parallel_triangulation->get_communicator(),
-                        &(requests[send_ops + recv_ops]));
-            AssertThrowMPI(ierr);
-            ++recv_ops;
-          }
-      const int ierr =
-        MPI_Waitall(send_ops + recv_ops, requests.data(), MPI_STATUSES_IGNORE);
-      AssertThrowMPI(ierr);
-    }
-
-    // Put the received particles into the domain if they are in the
-    // triangulation
-    const void *recv_data_it = static_cast<const void *>(recv_data.data());
+    std::vector<unsigned int> targets;
+    targets.reserve(send_buffers.size());
+    for (const auto &buffer : send_buffers)
+      targets.push_back(buffer.first);
+
+    // Exchange the buffers through a dynamic-sparse consensus algorithm:
+    // only processes between which particles actually flow communicate at
+    // all, and the message sizes are implied by the messages themselves,
+    // so no separate round of eager size messages to all neighbors is
+    // necessary. Because the incoming messages arrive in an unspecified
+    // order, first store them by source rank and deserialize them in
+    // sorted order below to keep the resulting particle ordering
+    // deterministic.
+    std::map<types::subdomain_id, std::vector<char>> recv_buffers;
+    Utilities::MPI::ConsensusAlgorithms::nbx<std::vector<char>>(
+      targets,
+      [&send_buffers](const unsigned int rank) {
+        return send_buffers.at(rank);
+      },
+      [&recv_buffers](const unsigned int       source_rank,
+                      const std::vector<char> &buffer) {
+        recv_buffers[source_rank] = buffer;
+      },
+      parallel_triangulation->get_communicator());
 
     // Store the particle iterators in the cache
     auto &ghost_particles_iterators =
@@ -1885,23 +1892,49 @@ namespace Particles
       {
         ghost_particles_iterators.clear();
 
-        auto &send_pointers_particles = ghost_particles_cache.send_pointers;
-        send_pointers_particles.assign(n_neighbors + 1, 0);
+        // Cache the communication pattern for update_ghost_particles():
+        // the ranks involved are the union of the ranks we sent particles
+        // to and the ranks we received particles from, and the amount of
+        // data per rank is the one of this exchange minus the cell ids,
+        // which need not be sent again as long as no particle changes its
+        // cell.
+        std::set<types::subdomain_id> pattern_neighbors;
+        for (const auto &buffer : send_buffers)
+          pattern_neighbors.insert(buffer.first);
+        for (const auto &buffer : recv_buffers)
+          pattern_neighbors.insert(buffer.first);
+
+        auto &neighbors = ghost_particles_cache.neighbors;
+        neighbors.assign(pattern_neighbors.begin(), pattern_neighbors.end());
 
-        for (unsigned int i = 0; i < n_neighbors; ++i)
-          send_pointers_particles[i + 1] =
-            send_pointers_particles[i] +
-            n_send_data[i] * individual_particle_data_size;
+        auto &send_pointers_particles = ghost_particles_cache.send_pointers;
+        send_pointers_particles.assign(neighbors.size() + 1, 0);
 
         auto &recv_pointers_particles = ghost_particles_cache.recv_pointers;
-        recv_pointers_particles.assign(n_neighbors + 1, 0);
-
-        for (unsigned int i = 0; i < n_neighbors; ++i)
-          recv_pointers_particles[i + 1] =
-            recv_pointers_particles[i] +
-            n_recv_data[i] * individual_particle_data_size;
+        recv_pointers_particles.assign(neighbors.size() + 1, 0);
 
-        ghost_particles_cache.neighbors = neighbors;
+        for (unsigned int i = 0; i < neighbors.size(); ++i)
+          {
+            const auto         send_buffer = send_buffers.find(neighbors[i]);
+            const unsigned int n_send_particles =
+              (send_buffer != send_buffers.end() ?
+                 send_buffer->second.size() /
+                   individual_total_particle_data_size :
+                 0);
+            send_pointers_particles[i + 1] =
+              send_pointers_particles[i] +
+              n_send_particles * individual_particle_data_size;
+
+            const auto         recv_buffer = recv_buffers.find(neighbors[i]);
+            const unsigned int n_recv_particles =
+              (recv_buffer != recv_buffers.end() ?
+                 recv_buffer->second.size() /
+                   individual_total_particle_data_size :
+                 0);
+            recv_pointers_particles[i + 1] =
+              recv_pointers_particles[i] +
+              n_recv_particles * individual_particle_data_size;
+          }
 
         ghost_particles_cache.send_data.resize(
           ghost_particles_cache.send_pointers.back());
@@ -1909,41 +1942,55 @@ namespace Particles
           ghost_particles_cache.recv_pointers.back());
       }
 
-    while (reinterpret_cast<std::size_t>(recv_data_it) -
-             reinterpret_cast<std::size_t>(recv_data.data()) <
-           total_recv_data)
+    // Put the received particles into the domain if they are in the
+    // triangulation. recv_buffers is an std::map and thus sorted by the
+    // rank of the sending process, so the order in which particles are
+    // created here (and, in case a cache is built, the buffer layout
+    // assumed by send_recv_particles_properties_and_location()) does not
+    // depend on the order in which the messages happened to arrive.
+    for (const auto &buffer : recv_buffers)
       {
-        CellId::binary_type binary_cellid;
-        memcpy(&binary_cellid, recv_data_it, cellid_size);
-        const CellId id(binary_cellid);
-        recv_data_it = static_cast<const char *>(recv_data_it) + cellid_size;
+        const std::vector<char> &recv_data = buffer.second;
 
-        const typename Triangulation<dim, spacedim>::active_cell_iterator cell =
-          triangulation->create_cell_iterator(id);
+        const void *recv_data_it = static_cast<const void *>(recv_data.data());
 
-        insert_particle(property_pool->register_particle(), cell);
-        const typename particle_container::iterator &cache =
-          cells_to_particle_cache[cell->active_cell_index()];
-        Assert(cache->cell == cell, ExcInternalError());
+        while (reinterpret_cast<std::size_t>(recv_data_it) -
+                 reinterpret_cast<std::size_t>(recv_data.data()) <
+               recv_data.size())
+          {
+            CellId::binary_type binary_cellid;
+            memcpy(&binary_cellid, recv_data_it, cellid_size);
+            const CellId id(binary_cellid);
+            recv_data_it =
+              static_cast<const char *>(recv_data_it) + cellid_size;
 
-        particle_iterator particle_it(cache,
-                                      *property_pool,
-                                      cache->particles.size() - 1);
+            const typename Triangulation<dim, spacedim>::active_cell_iterator
+              cell = triangulation->create_cell_iterator(id);
 
-        recv_data_it =
-          particle_it->read_particle_data_from_memory(recv_data_it);
+            insert_particle(property_pool->register_particle(), cell);
+            const typename particle_container::iterator &cache =
+              cells_to_particle_cache[cell->active_cell_index()];
+            Assert(cache->cell == cell, ExcInternalError());
 
-        if (load_callback)
-          recv_data_it = load_callback(particle_it, recv_data_it);
+            particle_iterator particle_it(cache,
+                                          *property_pool,
+                                          cache->particles.size() - 1);
 
-        if (build_cache) // TODO: is this safe?
-          ghost_particles_iterators.push_back(particle_it);
-      }
+            recv_data_it =
+              particle_it->read_particle_data_from_memory(recv_data_it);
 
-    AssertThrow(recv_data_it == recv_data.data() + recv_data.size(),
-                ExcMessage(
-                  "The amount of data that was read into new particles "
-                  "does not match the amount of data sent around."));
+            if (load_callback)
+              recv_data_it = load_callback(particle_it, recv_data_it);
+
+            if (build_cache) // TODO: is this safe?
+              ghost_particles_iterators.push_back(particle_it);
+          }
+
+        AssertThrow(recv_data_it == recv_data.data() + recv_data.size(),
+                    ExcMessage(
+                      "The amount of data that was read into new particles "
+                      "does not match the amount of data sent around."));
+      }
   }
 #endif
 
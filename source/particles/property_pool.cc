@@ -29,8 +29,11 @@ namespace Particles
 
   template <int dim, int spacedim>
   PropertyPool<dim, spacedim>::PropertyPool(
-    const unsigned int n_properties_per_slot)
+    const unsigned int n_properties_per_slot,
+    const bool         store_properties_per_component)
     : n_properties(n_properties_per_slot)
+    , properties_per_component(store_properties_per_component)
+    , property_stride(0)
   {}
 
 
@@ -70,6 +73,7 @@ namespace Particles
 
     properties.clear();
     properties.shrink_to_fit();
+    property_stride = 0;
 
     currently_available_handles.clear();
     currently_available_handles.shrink_to_fit();
@@ -91,10 +95,19 @@ namespace Particles
       {
         handle = locations.size();
 
+        // With one contiguous array per property, appending a slot in place
+        // would require shifting all following component arrays, so keep the
+        // arrays at a geometrically growing capacity instead.
+        if (properties_per_component && n_properties > 0 &&
+            locations.size() == property_stride)
+          resize_property_stride(
+            std::max<std::vector<double>::size_type>(2 * property_stride, 64));
+
         locations.resize(locations.size() + 1);
         reference_locations.resize(reference_locations.size() + 1);
         ids.resize(ids.size() + 1);
-        properties.resize(properties.size() + n_properties);
+        if (properties_per_component == false)
+          properties.resize(properties.size() + n_properties);
       }
 
     // Then initialize whatever slot we have taken with invalid locations,
@@ -102,14 +115,47 @@ namespace Particles
     set_location(handle, numbers::signaling_nan<Point<spacedim>>());
     set_reference_location(handle, numbers::signaling_nan<Point<dim>>());
     set_id(handle, numbers::invalid_unsigned_int);
-    for (double &x : get_properties(handle))
-      x = 0;
+    if (properties_per_component)
+      for (unsigned int c = 0; c < n_properties; ++c)
+        set_property(handle, c, 0.);
+    else
+      for (double &x : get_properties(handle))
+        x = 0;
 
     return handle;
   }
 
 
 
+  template <int dim, int spacedim>
+  void
+  PropertyPool<dim, spacedim>::resize_property_stride(
+    const std::vector<double>::size_type new_stride)
+  {
+    Assert(properties_per_component == true, ExcInternalError());
+    Assert(new_stride >= locations.size(), ExcInternalError());
+
+    if (new_stride == property_stride || n_properties == 0)
+      return;
+
+    const std::vector<double>::size_type n_used_slots = locations.size();
+    properties.resize(new_stride * n_properties, 0.);
+
+    // Move the component arrays to their new offsets, starting from the last
+    // one so that no values are overwritten before they have been copied.
+    // The vacated ranges may keep stale values, which is harmless because
+    // the entries of a slot are zeroed out upon registration.
+    for (unsigned int c = n_properties - 1; c > 0; --c)
+      std::copy_backward(properties.begin() + c * property_stride,
+                         properties.begin() + c * property_stride +
+                           n_used_slots,
+                         properties.begin() + c * new_stride + n_used_slots);
+
+    property_stride = new_stride;
+  }
+
+
+
   template <int dim, int spacedim>
   void
   PropertyPool<dim, spacedim>::deregister_particle(Handle &handle)
@@ -136,6 +182,7 @@ namespace Particles
       {
         currently_available_handles.clear();
         properties.clear();
+        property_stride = 0;
         locations.clear();
         reference_locations.clear();
         ids.clear();
@@ -150,7 +197,13 @@ namespace Particles
   {
     locations.reserve(size);
     reference_locations.reserve(size);
-    properties.reserve(size * n_properties);
+    if (properties_per_component)
+      {
+        if (size > property_stride)
+          resize_property_stride(size);
+      }
+    else
+      properties.reserve(size * n_properties);
     ids.reserve(size);
   }
 
@@ -177,9 +230,15 @@ namespace Particles
            ExcMessage("Number of registered locations is not equal to number "
                       "of registered ids."));
 
-    Assert(locations.size() * n_properties == properties.size(),
-           ExcMessage("Number of registered locations is not equal to number "
-                      "of registered property slots."));
+    if (properties_per_component)
+      Assert(property_stride * n_properties == properties.size() &&
+               property_stride >= locations.size(),
+             ExcMessage("Number of registered locations is not equal to number "
+                        "of registered property slots."));
+    else
+      Assert(locations.size() * n_properties == properties.size(),
+             ExcMessage("Number of registered locations is not equal to number "
+                        "of registered property slots."));
 
     return locations.size() - currently_available_handles.size();
   }
@@ -199,10 +258,21 @@ namespace Particles
     sorted_locations.reserve(locations.size());
     sorted_reference_locations.reserve(reference_locations.size());
     sorted_ids.reserve(ids.size());
-    sorted_properties.reserve(properties.size());
 
-    for (const auto &handle : handles_to_sort)
+    // In the component-wise storage order, the sorted pool holds exactly as
+    // many slots as handles, i.e., the capacity padding of the component
+    // arrays is dropped.
+    const std::vector<double>::size_type sorted_stride =
+      handles_to_sort.size();
+    if (properties_per_component)
+      sorted_properties.resize(sorted_stride * n_properties);
+    else
+      sorted_properties.reserve(properties.size());
+
+    for (std::size_t i = 0; i < handles_to_sort.size(); ++i)
       {
+        const Handle handle = handles_to_sort[i];
+
         Assert(handle != invalid_handle,
                ExcMessage(
                  "Invalid handle detected during sorting particle memory."));
@@ -211,8 +281,13 @@ namespace Particles
         sorted_reference_locations.push_back(reference_locations[handle]);
         sorted_ids.push_back(ids[handle]);
 
-        for (unsigned int j = 0; j < n_properties; ++j)
-          sorted_properties.push_back(properties[handle * n_properties + j]);
+        if (properties_per_component)
+          for (unsigned int j = 0; j < n_properties; ++j)
+            sorted_properties[j * sorted_stride + i] =
+              properties[j * property_stride + handle];
+        else
+          for (unsigned int j = 0; j < n_properties; ++j)
+            sorted_properties.push_back(properties[handle * n_properties + j]);
       }
 
     Assert(sorted_locations.size() ==
@@ -227,6 +302,8 @@ namespace Particles
     reference_locations = std::move(sorted_reference_locations);
     ids                 = std::move(sorted_ids);
     properties          = std::move(sorted_properties);
+    if (properties_per_component)
+      property_stride = sorted_stride;
 
     currently_available_handles.clear();
   }
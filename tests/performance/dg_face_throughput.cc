@@ -0,0 +1,260 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Measure the throughput of a matrix-free interior-penalty operator for
+// discontinuous elements on hexahedral and simplex meshes of comparable
+// size. The face loop is the interesting part of this benchmark: faces
+// are batched by face number and orientation during MatrixFree::reinit(),
+// and on simplex meshes FEFaceEvaluation selects a precomputed
+// interpolation matrix per (face number, orientation) pair, so this
+// benchmark tracks the per-DoF cost ratio between the tensor-product
+// sum-factorized face kernels and the full-matrix simplex face kernels.
+// Every measurement is printed both as a human-readable line and as one
+// JSON object per line.
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_simplex_p.h>
+#include <deal.II/fe/mapping_fe.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+using namespace dealii;
+
+using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+// Run the given operation several times and return the wall time per
+// repetition.
+template <typename Operation>
+double
+measure(const Operation &operation, const unsigned int n_repetitions)
+{
+  // warm up caches
+  operation();
+
+  Timer timer;
+  timer.restart();
+  for (unsigned int r = 0; r < n_repetitions; ++r)
+    operation();
+  timer.stop();
+
+  return timer.wall_time() / n_repetitions;
+}
+
+
+template <int dim>
+void
+benchmark_dg_face_loop(const bool                    use_simplex_mesh,
+                       const unsigned int            degree,
+                       const types::global_dof_index target_n_dofs)
+{
+  const std::unique_ptr<FiniteElement<dim>> fe =
+    use_simplex_mesh ?
+      std::unique_ptr<FiniteElement<dim>>(
+        std::make_unique<FE_SimplexDGP<dim>>(degree)) :
+      std::unique_ptr<FiniteElement<dim>>(
+        std::make_unique<FE_DGQ<dim>>(degree));
+  const std::unique_ptr<Mapping<dim>> mapping =
+    use_simplex_mesh ? std::unique_ptr<Mapping<dim>>(
+                         std::make_unique<MappingFE<dim>>(FE_SimplexP<dim>(1))) :
+                       std::unique_ptr<Mapping<dim>>(
+                         std::make_unique<MappingQ1<dim>>());
+  const Quadrature<dim> quadrature =
+    use_simplex_mesh ? Quadrature<dim>(QGaussSimplex<dim>(degree + 1)) :
+                       Quadrature<dim>(QGauss<dim>(degree + 1));
+
+  // subdivided_hyper_cube_with_simplices() splits every cube of the
+  // subdivided mesh into five tetrahedra in 3d and two triangles in 2d
+  const unsigned int cells_per_cube =
+    use_simplex_mesh ? (dim == 3 ? 5 : 2) : 1;
+  const unsigned int n_subdivisions = std::max(
+    1U,
+    static_cast<unsigned int>(std::round(
+      std::pow(static_cast<double>(target_n_dofs) /
+                 (cells_per_cube * fe->n_dofs_per_cell()),
+               1. / dim))));
+
+  Triangulation<dim> triangulation;
+  if (use_simplex_mesh)
+    GridGenerator::subdivided_hyper_cube_with_simplices(triangulation,
+                                                        n_subdivisions);
+  else
+    GridGenerator::subdivided_hyper_cube(triangulation, n_subdivisions);
+
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(*fe);
+  const types::global_dof_index n_dofs = dof_handler.n_dofs();
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+  additional_data.mapping_update_flags_inner_faces =
+    update_values | update_gradients | update_JxW_values |
+    update_normal_vectors;
+  additional_data.mapping_update_flags_boundary_faces =
+    additional_data.mapping_update_flags_inner_faces;
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    *mapping, dof_handler, constraints, quadrature, additional_data);
+
+  VectorType src, dst;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  src = 1.;
+
+  // constant penalty factor: this benchmark measures throughput, so the
+  // 1/h scaling of a production interior-penalty operator is left out
+  const double sigma = (degree + 1) * (degree + 1);
+
+  const auto cell_operation =
+    [&](const MatrixFree<dim, double>               &data,
+        VectorType                                  &dst,
+        const VectorType                            &src,
+        const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, -1, 0, 1, double> phi(data);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src, EvaluationFlags::gradients);
+          for (unsigned int q = 0; q < phi.n_q_points; ++q)
+            phi.submit_gradient(phi.get_gradient(q), q);
+          phi.integrate_scatter(EvaluationFlags::gradients, dst);
+        }
+    };
+
+  const auto face_operation =
+    [&](const MatrixFree<dim, double>               &data,
+        VectorType                                  &dst,
+        const VectorType                            &src,
+        const std::pair<unsigned int, unsigned int> &range) {
+      FEFaceEvaluation<dim, -1, 0, 1, double> phi_m(data, true);
+      FEFaceEvaluation<dim, -1, 0, 1, double> phi_p(data, false);
+      for (unsigned int face = range.first; face < range.second; ++face)
+        {
+          phi_m.reinit(face);
+          phi_p.reinit(face);
+          phi_m.gather_evaluate(src,
+                                EvaluationFlags::values |
+                                  EvaluationFlags::gradients);
+          phi_p.gather_evaluate(src,
+                                EvaluationFlags::values |
+                                  EvaluationFlags::gradients);
+          for (unsigned int q = 0; q < phi_m.n_q_points; ++q)
+            {
+              const auto jump = phi_m.get_value(q) - phi_p.get_value(q);
+              const auto average_normal_derivative =
+                0.5 * (phi_m.get_normal_derivative(q) +
+                       phi_p.get_normal_derivative(q));
+              const auto flux = sigma * jump - average_normal_derivative;
+
+              phi_m.submit_value(flux, q);
+              phi_p.submit_value(-flux, q);
+              phi_m.submit_normal_derivative(-0.5 * jump, q);
+              phi_p.submit_normal_derivative(-0.5 * jump, q);
+            }
+          phi_m.integrate_scatter(EvaluationFlags::values |
+                                    EvaluationFlags::gradients,
+                                  dst);
+          phi_p.integrate_scatter(EvaluationFlags::values |
+                                    EvaluationFlags::gradients,
+                                  dst);
+        }
+    };
+
+  const auto boundary_operation =
+    [&](const MatrixFree<dim, double>               &data,
+        VectorType                                  &dst,
+        const VectorType                            &src,
+        const std::pair<unsigned int, unsigned int> &range) {
+      FEFaceEvaluation<dim, -1, 0, 1, double> phi_m(data, true);
+      for (unsigned int face = range.first; face < range.second; ++face)
+        {
+          phi_m.reinit(face);
+          phi_m.gather_evaluate(src,
+                                EvaluationFlags::values |
+                                  EvaluationFlags::gradients);
+          for (unsigned int q = 0; q < phi_m.n_q_points; ++q)
+            {
+              const auto jump = phi_m.get_value(q);
+              const auto flux = sigma * jump - phi_m.get_normal_derivative(q);
+
+              phi_m.submit_value(flux, q);
+              phi_m.submit_normal_derivative(-0.5 * jump, q);
+            }
+          phi_m.integrate_scatter(EvaluationFlags::values |
+                                    EvaluationFlags::gradients,
+                                  dst);
+        }
+    };
+
+  const unsigned int n_repetitions =
+    std::max<types::global_dof_index>(5, 2000000 / n_dofs);
+
+  const double wall_time = measure(
+    [&]() {
+      matrix_free.loop(
+        cell_operation, face_operation, boundary_operation, dst, src, true);
+    },
+    n_repetitions);
+
+  const char *mesh_name = use_simplex_mesh ? "simplex" : "hexahedral";
+
+  std::cout << "dg_face_loop: " << mesh_name << " mesh, degree " << degree
+            << ", " << n_dofs << " dofs, " << wall_time << " s/call, "
+            << n_dofs / wall_time * 1e-6 << " MDoF/s" << std::endl;
+  std::cout << "{\"benchmark\": \"dg_face_loop\", \"mesh\": \"" << mesh_name
+            << "\", \"degree\": " << degree << ", \"n_dofs\": " << n_dofs
+            << ", \"wall_time\": " << wall_time
+            << ", \"MDoF_per_s\": " << n_dofs / wall_time * 1e-6 << "}"
+            << std::endl;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+#ifdef ENABLE_PERFORMANCE_TESTS
+  const types::global_dof_index target_n_dofs = 2000000;
+#else
+  const types::global_dof_index target_n_dofs = 100000;
+#endif
+
+  for (unsigned int degree = 1; degree <= 3; ++degree)
+    benchmark_dg_face_loop<3>(false, degree, target_n_dofs);
+  for (unsigned int degree = 1; degree <= 3; ++degree)
+    benchmark_dg_face_loop<3>(true, degree, target_n_dofs);
+
+  std::cout << "OK" << std::endl;
+}
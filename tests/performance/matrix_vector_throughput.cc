@@ -0,0 +1,238 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Compare the throughput of the matrix-vector product of an assembled
+// SparseMatrix against the matrix-free evaluation of the same Laplace
+// operator on a 3d hypercube mesh for a range of polynomial degrees.
+// For the sparse matrix the number of nonzeros grows like (2p+1)^3 per
+// row, so its measurements are restricted to degrees up to four and to
+// a problem size with a bounded number of nonzero entries, whereas the
+// matrix-free operator is measured for degrees one through eight at a
+// fixed number of unknowns. Every measurement is printed both as a
+// human-readable line and as one JSON object per line; the sparse
+// matrix lines additionally contain the arithmetic intensity in
+// Flop/byte, which together with the bandwidth numbers from the
+// vector_ops benchmark locates the kernels in a roofline plot.
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include <deal.II/numerics/matrix_tools.h>
+
+#include <cmath>
+#include <iostream>
+
+using namespace dealii;
+
+// Run the given operation several times and return the wall time per
+// repetition.
+template <typename Operation>
+double
+measure(const Operation &operation, const unsigned int n_repetitions)
+{
+  // warm up caches
+  operation();
+
+  Timer timer;
+  timer.restart();
+  for (unsigned int r = 0; r < n_repetitions; ++r)
+    operation();
+  timer.stop();
+
+  return timer.wall_time() / n_repetitions;
+}
+
+
+// Create a mesh whose number of Q_p degrees of freedom is close to the
+// given target: a subdivided hypercube with n subdivisions has
+// (n p + 1)^dim unknowns.
+template <int dim>
+void
+make_mesh(Triangulation<dim>            &triangulation,
+          const unsigned int             fe_degree,
+          const types::global_dof_index  target_n_dofs)
+{
+  const unsigned int n_subdivisions = std::max(
+    1U,
+    static_cast<unsigned int>(
+      std::round((std::pow(static_cast<double>(target_n_dofs), 1. / dim) - 1.) /
+                 fe_degree)));
+  GridGenerator::subdivided_hyper_cube(triangulation, n_subdivisions);
+}
+
+
+template <int dim, int fe_degree>
+void
+benchmark_sparse_matrix(const types::global_dof_index target_n_nonzeros)
+{
+  // bound the memory consumption of the assembled matrix by choosing
+  // the number of unknowns according to the stencil size of Q_p
+  const types::global_dof_index target_n_dofs =
+    target_n_nonzeros / Utilities::pow(2 * fe_degree + 1, dim);
+
+  Triangulation<dim> triangulation;
+  make_mesh(triangulation, fe_degree, target_n_dofs);
+
+  const FE_Q<dim> fe(fe_degree);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+  const types::global_dof_index n_dofs = dof_handler.n_dofs();
+
+  DynamicSparsityPattern dsp(n_dofs);
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<double> sparse_matrix(sparsity);
+  MatrixCreator::create_laplace_matrix(MappingQ1<dim>(),
+                                       dof_handler,
+                                       QGauss<dim>(fe_degree + 1),
+                                       sparse_matrix);
+
+  Vector<double> src(n_dofs);
+  Vector<double> dst(n_dofs);
+  src = 1.;
+
+  const std::size_t  n_nonzeros = sparse_matrix.n_nonzero_elements();
+  const unsigned int n_repetitions =
+    std::max<std::size_t>(5, 40000000 / n_nonzeros);
+
+  const double wall_time =
+    measure([&]() { sparse_matrix.vmult(dst, src); }, n_repetitions);
+
+  // values and column indices of the matrix plus reading the source and
+  // writing the destination vector
+  const double bytes = n_nonzeros * (sizeof(double) + sizeof(unsigned int)) +
+                       2. * sizeof(double) * n_dofs;
+  const double flops     = 2. * n_nonzeros;
+  const double intensity = flops / bytes;
+
+  std::cout << "sparse_matrix_vmult: degree " << fe_degree << ", " << n_dofs
+            << " dofs, " << wall_time << " s/call, " << bytes / wall_time * 1e-9
+            << " GB/s, " << flops / wall_time * 1e-9 << " GFlop/s"
+            << std::endl;
+  std::cout << "{\"benchmark\": \"sparse_matrix_vmult\", \"degree\": "
+            << fe_degree << ", \"n_dofs\": " << n_dofs
+            << ", \"n_nonzeros\": " << n_nonzeros
+            << ", \"wall_time\": " << wall_time
+            << ", \"GB_per_s\": " << bytes / wall_time * 1e-9
+            << ", \"GFlop_per_s\": " << flops / wall_time * 1e-9
+            << ", \"arithmetic_intensity\": " << intensity << "}" << std::endl;
+}
+
+
+template <int dim, int fe_degree>
+void
+benchmark_matrix_free(const types::global_dof_index target_n_dofs)
+{
+  Triangulation<dim> triangulation;
+  make_mesh(triangulation, fe_degree, target_n_dofs);
+
+  const FE_Q<dim> fe(fe_degree);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+  const types::global_dof_index n_dofs = dof_handler.n_dofs();
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    update_gradients | update_JxW_values;
+
+  const auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+  matrix_free->reinit(MappingQ1<dim>(),
+                      dof_handler,
+                      constraints,
+                      QGauss<1>(fe_degree + 1),
+                      additional_data);
+
+  MatrixFreeOperators::LaplaceOperator<dim, fe_degree> laplace_operator;
+  laplace_operator.initialize(matrix_free);
+
+  LinearAlgebra::distributed::Vector<double> src, dst;
+  laplace_operator.initialize_dof_vector(src);
+  laplace_operator.initialize_dof_vector(dst);
+  src = 1.;
+
+  const unsigned int n_repetitions =
+    std::max<types::global_dof_index>(5, 2000000 / n_dofs);
+
+  const double wall_time =
+    measure([&]() { laplace_operator.vmult(dst, src); }, n_repetitions);
+
+  // reading the source and writing the destination vector is a lower
+  // bound for the data transfer; index and geometry data come on top
+  const double bytes = 2. * sizeof(double) * n_dofs;
+
+  std::cout << "matrix_free_vmult: degree " << fe_degree << ", " << n_dofs
+            << " dofs, " << wall_time << " s/call, "
+            << n_dofs / wall_time * 1e-6 << " MDoF/s, at least "
+            << bytes / wall_time * 1e-9 << " GB/s" << std::endl;
+  std::cout << "{\"benchmark\": \"matrix_free_vmult\", \"degree\": "
+            << fe_degree << ", \"n_dofs\": " << n_dofs
+            << ", \"wall_time\": " << wall_time
+            << ", \"MDoF_per_s\": " << n_dofs / wall_time * 1e-6
+            << ", \"GB_per_s\": " << bytes / wall_time * 1e-9 << "}"
+            << std::endl;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+#ifdef ENABLE_PERFORMANCE_TESTS
+  const types::global_dof_index target_n_dofs     = 2000000;
+  const types::global_dof_index target_n_nonzeros = 100000000;
+#else
+  const types::global_dof_index target_n_dofs     = 100000;
+  const types::global_dof_index target_n_nonzeros = 10000000;
+#endif
+
+  benchmark_sparse_matrix<3, 1>(target_n_nonzeros);
+  benchmark_sparse_matrix<3, 2>(target_n_nonzeros);
+  benchmark_sparse_matrix<3, 3>(target_n_nonzeros);
+  benchmark_sparse_matrix<3, 4>(target_n_nonzeros);
+
+  benchmark_matrix_free<3, 1>(target_n_dofs);
+  benchmark_matrix_free<3, 2>(target_n_dofs);
+  benchmark_matrix_free<3, 3>(target_n_dofs);
+  benchmark_matrix_free<3, 4>(target_n_dofs);
+  benchmark_matrix_free<3, 5>(target_n_dofs);
+  benchmark_matrix_free<3, 6>(target_n_dofs);
+  benchmark_matrix_free<3, 7>(target_n_dofs);
+  benchmark_matrix_free<3, 8>(target_n_dofs);
+
+  std::cout << "OK" << std::endl;
+}
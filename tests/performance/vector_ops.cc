@@ -0,0 +1,202 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Measure the achievable throughput of basic operations on
+// LinearAlgebra::distributed::Vector (copy, vector update, inner
+// product, norm) as well as the cost of a ghost exchange as a function
+// of the number of ghost entries. Each measurement is printed both as a
+// human-readable line and as one JSON object per line so that scripts
+// collecting performance numbers across machines or library versions
+// can parse the output without further conventions. The vector
+// operations are memory-bandwidth bound, so the GB/s numbers reported
+// here are an estimate of the attainable memory bandwidth and thus of
+// the roofline that limits sparse and matrix-free operator evaluation.
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <iostream>
+
+using namespace dealii;
+
+// Run the given operation several times and return the wall time per
+// repetition, maximized over all MPI ranks so that rank 0 reports the
+// time of the slowest participant.
+template <typename Operation>
+double
+measure(const Operation    &operation,
+        const unsigned int  n_repetitions,
+        const MPI_Comm      communicator)
+{
+  // warm up caches and MPI buffers
+  operation();
+
+  Timer timer;
+  MPI_Barrier(communicator);
+  timer.restart();
+  for (unsigned int r = 0; r < n_repetitions; ++r)
+    operation();
+  timer.stop();
+
+  return Utilities::MPI::max(timer.wall_time(), communicator) /
+         n_repetitions;
+}
+
+
+void
+report(const std::string &name,
+       const std::size_t  size,
+       const double       wall_time,
+       const double       bytes,
+       const bool         do_print)
+{
+  if (do_print == false)
+    return;
+
+  const double gb_per_s = bytes / wall_time * 1e-9;
+  std::cout << name << ": size " << size << ", " << wall_time
+            << " s/call, " << gb_per_s << " GB/s" << std::endl;
+  std::cout << "{\"benchmark\": \"" << name << "\", \"size\": " << size
+            << ", \"wall_time\": " << wall_time
+            << ", \"GB_per_s\": " << gb_per_s << "}" << std::endl;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  const MPI_Comm     communicator = MPI_COMM_WORLD;
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(communicator);
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(communicator);
+  const bool         do_print = (my_rank == 0);
+
+#ifdef ENABLE_PERFORMANCE_TESTS
+  const types::global_dof_index max_local_size = 8000000;
+#else
+  const types::global_dof_index max_local_size = 400000;
+#endif
+
+  if (do_print)
+    std::cout << "Running on " << n_ranks << " MPI ranks" << std::endl;
+
+  for (types::global_dof_index local_size = 40000;
+       local_size <= max_local_size;
+       local_size *= 10)
+    {
+      const types::global_dof_index global_size = local_size * n_ranks;
+      IndexSet                      owned(global_size);
+      owned.add_range(my_rank * local_size, (my_rank + 1) * local_size);
+
+      LinearAlgebra::distributed::Vector<double> src(owned, communicator);
+      LinearAlgebra::distributed::Vector<double> dst(owned, communicator);
+      for (const auto i : owned)
+        src(i) = 1. + static_cast<double>(i % 17);
+
+      // choose the number of repetitions such that every measurement
+      // touches a comparable amount of memory
+      const unsigned int n_repetitions =
+        std::max<unsigned int>(5, 20000000 / local_size);
+
+      report("vector_copy",
+             global_size,
+             measure([&]() { dst = src; }, n_repetitions, communicator),
+             2. * sizeof(double) * global_size,
+             do_print);
+
+      report("vector_update",
+             global_size,
+             measure([&]() { dst.add(2., src); }, n_repetitions, communicator),
+             3. * sizeof(double) * global_size,
+             do_print);
+
+      double dot_result = 0.;
+      report("vector_inner_product",
+             global_size,
+             measure([&]() { dot_result += src * dst; },
+                     n_repetitions,
+                     communicator),
+             2. * sizeof(double) * global_size,
+             do_print);
+
+      report("vector_norm",
+             global_size,
+             measure([&]() { dot_result += src.l2_norm(); },
+                     n_repetitions,
+                     communicator),
+             1. * sizeof(double) * global_size,
+             do_print);
+
+      // keep the compiler from optimizing away the reductions
+      if (dot_result < 0.)
+        std::cout << dot_result << std::endl;
+    }
+
+  // Ghost exchange latency: each rank imports the first n_ghosts
+  // entries of the next rank, which measures the latency of small
+  // messages and the bandwidth of large ones in a nearest-neighbor
+  // communication pattern.
+  if (n_ranks > 1)
+    {
+      const types::global_dof_index local_size  = max_local_size;
+      const types::global_dof_index global_size = local_size * n_ranks;
+      IndexSet                      owned(global_size);
+      owned.add_range(my_rank * local_size, (my_rank + 1) * local_size);
+
+      for (types::global_dof_index n_ghosts = 1; n_ghosts <= local_size;
+           n_ghosts *= 100)
+        {
+          const unsigned int next_rank = (my_rank + 1) % n_ranks;
+          IndexSet           ghosts(global_size);
+          ghosts.add_range(next_rank * local_size,
+                           next_rank * local_size + n_ghosts);
+
+          LinearAlgebra::distributed::Vector<double> vec(owned,
+                                                         ghosts,
+                                                         communicator);
+          vec = 1.;
+
+          const unsigned int n_repetitions =
+            std::max<unsigned int>(10, 100000 / n_ghosts);
+
+          const double wall_time = measure(
+            [&]() {
+              vec.zero_out_ghost_values();
+              vec.update_ghost_values();
+            },
+            n_repetitions,
+            communicator);
+
+          if (do_print)
+            {
+              std::cout << "ghost_exchange: " << n_ghosts << " ghosts, "
+                        << wall_time << " s/exchange" << std::endl;
+              std::cout << "{\"benchmark\": \"ghost_exchange\", "
+                        << "\"n_ghosts\": " << n_ghosts
+                        << ", \"message_bytes\": "
+                        << n_ghosts * sizeof(double)
+                        << ", \"wall_time\": " << wall_time << "}"
+                        << std::endl;
+            }
+        }
+    }
+
+  if (do_print)
+    std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,101 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test GridTools::CellDataExchanger with a cell filter that excludes all
+// ghost cells owned by one of the neighbors: the number of messages must
+// stay balanced, and in particular no stale payload may be left behind
+// that a subsequent exchange() with a different data type would pick up.
+
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+using namespace dealii;
+
+template <int dim>
+void
+test()
+{
+  const unsigned int myid = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(3);
+
+  using TriaType = parallel::distributed::Triangulation<dim>;
+  using CellIteratorType = typename TriaType::active_cell_iterator;
+
+  // keep only ghost cells owned by process 0: on process 0 itself, this
+  // excludes every ghost cell, so its request to process 1 is empty and no
+  // payload must flow from process 1 to process 0
+  GridTools::CellDataExchanger<TriaType> exchanger(
+    triangulation, [](const CellIteratorType &cell) {
+      return cell->subdomain_id() == 0;
+    });
+
+  unsigned int n_unpacked = 0;
+  exchanger.exchange<unsigned int>(
+    [&](const CellIteratorType &cell) -> std::optional<unsigned int> {
+      return 10 * myid + cell->level();
+    },
+    [&](const CellIteratorType &cell, const unsigned int &data) {
+      AssertThrow(data == 10 * cell->subdomain_id() + cell->level(),
+                  ExcInternalError());
+      ++n_unpacked;
+    });
+
+  // process 0 filtered out all of its ghost cells and must not have
+  // received anything, while the other processes see the ghost cells owned
+  // by process 0
+  if (myid == 0)
+    {
+      AssertThrow(n_unpacked == 0, ExcInternalError());
+    }
+  else
+    {
+      AssertThrow(n_unpacked > 0, ExcInternalError());
+    }
+
+  // a second exchange with a different data type: if the first round left
+  // an unmatched message behind, this round would try to unpack it as the
+  // wrong type
+  exchanger.exchange<double>(
+    [&](const CellIteratorType &) -> std::optional<double> {
+      return 100.25 + myid;
+    },
+    [&](const CellIteratorType &cell, const double &data) {
+      AssertThrow(data == 100.25 + cell->subdomain_id(), ExcInternalError());
+    });
+
+  if (myid == 0)
+    deallog << "OK in " << dim << 'd' << std::endl;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  test<2>();
+  test<3>();
+
+  return 0;
+}